@@ -36,6 +36,7 @@
 /* USER CODE BEGIN Includes */
 #include "app_main/app_main.h"
 #include "hw_usb.h"
+#include "hw_timer.h"
 /* USER CODE END Includes */
 
 /* Private typedef -----------------------------------------------------------*/
@@ -370,7 +371,11 @@ void HAL_TIM_PeriodElapsedCallback(TIM_HandleTypeDef *htim)
     HAL_IncTick();
   }
   /* USER CODE BEGIN Callback 1 */
-
+  if (htim->Instance == TIM14)
+  {
+    /* The HAL tick always runs, so it keeps the microsecond time base ahead of the DWT wrap */
+    (void)HW_TIMER_Get_Time_Us();
+  }
   /* USER CODE END Callback 1 */
 }
 
@@ -41,11 +41,7 @@
 #define CONSOLE_PRINTF_BUFFER_SIZE 128U
 #define CONSOLE_RX_BUFFER_SIZE 32U
 
-#define CONSOLE_TX_BUFFER_SIZE 2048U
-#define CONSOLE_TX_FLUSH_CHUNK_SIZE 64U
-#define CONSOLE_TX_TIMEOUT_MS 100U
-
-#define CONSOLE_BAUD_RATE 115200U
+#define CONSOLE_BAUD_RATE 921600U
 
 #define CONSOLE_HISTORY_DEPTH 8U
 
@@ -73,10 +69,6 @@ TaskHandle_t ConsoleTaskHandle = NULL;  // NOLINT(readability-identifier-naming)
  *------------------------------------------------------------------------------
  */
 static const uint8_t WELCOME_MESSAGE[] = "Welcome to HIL-RIG MCU!\r\n";
-static uint8_t       s_tx_buf[CONSOLE_TX_BUFFER_SIZE];
-static uint32_t      s_tx_head           = 0U;
-static uint32_t      s_tx_tail           = 0U;
-static uint32_t      s_tx_overflow_count = 0U;
 
 static ConsoleEscapeState_T s_escape_state = ESC_IDLE;
 static char                 s_history[CONSOLE_HISTORY_DEPTH][CONSOLE_LINE_MAX + 1U];
@@ -236,42 +228,14 @@ static void CONSOLE_On_Line_Complete( void )
 }
 
 /**
- * @brief Get the number of bytes currently queued in the console TX ring buffer.
- *
- * Computes the occupied length of the software-managed TX ring buffer using
- * the current head and tail indices.
- *
- * @returns Number of bytes currently pending transmission.
- */
-static inline uint32_t CONSOLE_Tx_Used( void )
-{
-    return ( s_tx_head >= s_tx_tail ) ? ( s_tx_head - s_tx_tail )
-                                      : ( CONSOLE_TX_BUFFER_SIZE - ( s_tx_tail - s_tx_head ) );
-}
-
-/**
- * @brief Get the remaining free space in the console TX ring buffer.
- *
- * Computes how many additional bytes can be appended to the software-managed
- * TX ring buffer while preserving the empty/full distinction by leaving one
- * slot unused.
- *
- * @returns Number of free bytes available for enqueue.
- */
-static inline uint32_t CONSOLE_Tx_Free( void )
-{
-    return ( CONSOLE_TX_BUFFER_SIZE - CONSOLE_Tx_Used() ) - 1U;
-}
-
-/**
- * @brief Append raw bytes to the console TX ring buffer.
+ * @brief Queue raw bytes for console output.
  *
- * Attempts to enqueue the provided bytes into the console-owned TX ring buffer.
- * Queued bytes are transmitted later by CONSOLE_Flush_Tx() from task context
- * using a blocking UART transmit call.
+ * Hands the provided bytes to the low-level console UART driver, which copies
+ * them into its TX ring buffer and sends them from the USART3 interrupt. The
+ * call never blocks the console task.
  *
  * If insufficient space is available, only the bytes that fit are queued and
- * the overflow counter is incremented.
+ * the driver's drop accounting is updated.
  *
  * @param data    Pointer to bytes to enqueue.
  * @param length  Number of bytes to enqueue.
@@ -285,60 +249,7 @@ static void CONSOLE_Write_Raw( const uint8_t* data, uint32_t length )
         return;
     }
 
-    uint32_t free_space = CONSOLE_Tx_Free();
-    uint32_t copy_len   = ( length < free_space ) ? length : free_space;
-
-    if ( copy_len < length )
-    {
-        s_tx_overflow_count++;
-    }
-
-    for ( uint32_t i = 0U; i < copy_len; i++ )
-    {
-        s_tx_buf[s_tx_head] = data[i];
-        s_tx_head           = ( s_tx_head + 1U ) % CONSOLE_TX_BUFFER_SIZE;
-    }
-}
-
-/**
- * @brief Transmit one pending chunk from the console TX ring buffer.
- *
- * If queued TX data is available, this function selects the next contiguous
- * region starting at the TX tail, limits the transfer to the configured flush
- * chunk size, and sends it using the blocking console UART transmit function.
- *
- * On successful transmission, the TX tail is advanced by the transmitted
- * length. If transmission fails, the pending data remains queued for a later
- * retry.
- *
- * @returns void
- */
-static void CONSOLE_Flush_Tx( void )
-{
-    if ( s_tx_head == s_tx_tail )
-    {
-        return;
-    }
-
-    uint32_t contiguous_len = 0U;
-
-    if ( s_tx_head > s_tx_tail )
-    {
-        contiguous_len = s_tx_head - s_tx_tail;
-    }
-    else
-    {
-        contiguous_len = CONSOLE_TX_BUFFER_SIZE - s_tx_tail;
-    }
-
-    uint32_t chunk_len = ( contiguous_len > CONSOLE_TX_FLUSH_CHUNK_SIZE )
-                             ? CONSOLE_TX_FLUSH_CHUNK_SIZE
-                             : contiguous_len;
-
-    if ( HW_UART_CONSOLE_Write_Blocking( &s_tx_buf[s_tx_tail], chunk_len, CONSOLE_TX_TIMEOUT_MS ) )
-    {
-        s_tx_tail = ( s_tx_tail + chunk_len ) % CONSOLE_TX_BUFFER_SIZE;
-    }
+    ( void )HW_UART_CONSOLE_Write( data, length );
 }
 
 /**
@@ -442,9 +353,9 @@ static void CONSOLE_Process_Byte( uint8_t byte )
 /**
  * @brief Initialise the console subsystem and queue the welcome banner.
  *
- * Initialises the low-level console UART driver, resets local TX and line
- * editing state, queues the console welcome banner, and performs an initial
- * TX flush so the banner is sent immediately.
+ * Initialises the low-level console UART driver, resets line editing state,
+ * and queues the console welcome banner, which the driver starts sending
+ * immediately.
  *
  * @returns true if console initialisation succeeds, otherwise false.
  */
@@ -455,12 +366,9 @@ bool CONSOLE_Init( void )
         return false;
     }
 
-    s_tx_head = 0U;
-    s_tx_tail = 0U;
     CONSOLE_Reset_Line_State();
 
     CONSOLE_Write_Raw( WELCOME_MESSAGE, sizeof( WELCOME_MESSAGE ) - 1U );
-    CONSOLE_Flush_Tx();
     return true;
 }
 
@@ -720,7 +628,6 @@ void CONSOLE_Task( void* task_parameters )
     while ( true )
     {
         CONSOLE_Process();
-        CONSOLE_Flush_Tx();
 
 #ifndef TEST_BUILD
         /*
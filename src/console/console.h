@@ -65,8 +65,9 @@ void CONSOLE_Printf( const char* format, ... );
  * @brief Console task entry point.
  *
  * This task initialises the console subsystem, drains buffered RX data from the
- * low-level console UART driver, processes command line input, and flushes
- * buffered console TX output from task context.
+ * low-level console UART driver and processes command line input. Console TX
+ * output is queued to the driver and sent from its interrupt, so the task never
+ * blocks on output.
  *
  * @param task_parameters  Unused task parameter.
  *
@@ -32,6 +32,10 @@
 #define CONSOLE_CAN_BITRATE ( 1000000U )
 #define CONSOLE_CAN_MAX_RX_PACKETS ( EXEC_CAN_MAX_BATCH_SIZE )
 #define CONSOLE_CAN_MAX_TX_PACKETS ( 4U )
+#define CONSOLE_CAN_MAX_ID_TEXT ( 16U )
+#define CONSOLE_CAN_EXTENDED_SUFFIX ( 'x' )
+#define CONSOLE_CAN_RANGE_SEPARATOR ( '-' )
+#define CONSOLE_CAN_PERMILLE_PER_PERCENT ( 10U )
 
 /**-----------------------------------------------------------------------------
  *  Private Function Prototypes
@@ -43,9 +47,18 @@ static bool         CONSOLE_CAN_Parse_Channel( const char* text, EXEC_CAN_Channe
 static unsigned int CONSOLE_CAN_Channel_Number( EXEC_CAN_Channel_T channel );
 static bool         CONSOLE_CAN_Parse_U16( const char* text, int base, uint16_t min_value,
                                            uint16_t max_value, uint16_t* value );
+static bool         CONSOLE_CAN_Parse_U32( const char* text, uint32_t max_value, uint32_t* value );
+static bool         CONSOLE_CAN_Parse_Id( const char* text, uint32_t* id, bool* extended );
+static bool         CONSOLE_CAN_Parse_Filter_Rule( const char* text, EXEC_CAN_Filter_Rule_T* rule );
+static void         CONSOLE_CAN_Print_Filter_Report( EXEC_CAN_Channel_T channel );
+static const char*  CONSOLE_CAN_Error_State_Name( const EXEC_CAN_Bus_Stats_T* stats );
+static void         CONSOLE_CAN_Print_Bus_Stats( EXEC_CAN_Channel_T          channel,
+                                                 const EXEC_CAN_Bus_Stats_T* stats );
 static void         CONSOLE_Command_Can_tx( uint16_t argc, char* argv[] );
 static void         CONSOLE_Command_Can_config( uint16_t argc, char* argv[] );
 static void         CONSOLE_Command_Can_rx( uint16_t argc, char* argv[] );
+static void         CONSOLE_Command_Can_filter( uint16_t argc, char* argv[] );
+static void         CONSOLE_Command_Can_stats( uint16_t argc, char* argv[] );
 
 /**-----------------------------------------------------------------------------
  *  Private Function Definitions
@@ -58,8 +71,11 @@ static void CONSOLE_CAN_Print_Usage( void )
     CONSOLE_Printf( "  can tx <channel> <id> <payload> [<id> <payload> ...]\r\n" );
     CONSOLE_Printf( "  can rx <channel>\r\n" );
     CONSOLE_Printf( "  can config <can1_bank> <can2_bank> <filter_id> <filter_mask>\r\n" );
+    CONSOLE_Printf( "  can filter <channel> <id|first-last> [<id|first-last> ...]\r\n" );
+    CONSOLE_Printf( "  can stats <channel> [reset]\r\n" );
     CONSOLE_Printf( "    channel: 1 or 2; payload: 1 to 8 text bytes\r\n" );
     CONSOLE_Printf( "    CAN IDs and masks accept decimal or 0x-prefixed hexadecimal\r\n" );
+    CONSOLE_Printf( "    append x to an ID for a 29-bit extended ID, e.g. 0x18FEF100x\r\n" );
 }
 
 static bool CONSOLE_CAN_Parse_Channel( const char* text, EXEC_CAN_Channel_T* channel )
@@ -108,6 +124,178 @@ static bool CONSOLE_CAN_Parse_U16( const char* text, int base, uint16_t min_valu
     return true;
 }
 
+static bool CONSOLE_CAN_Parse_U32( const char* text, uint32_t max_value, uint32_t* value )
+{
+    if ( text == NULL || value == NULL || text[0] == '\0' )
+    {
+        return false;
+    }
+
+    errno                = 0;
+    char*         end    = NULL;
+    unsigned long parsed = strtoul( text, &end, 0 );
+
+    if ( errno == ERANGE || end == text || *end != '\0' || parsed > max_value )
+    {
+        return false;
+    }
+
+    *value = ( uint32_t )parsed;
+    return true;
+}
+
+/**
+ * Parse a CAN identifier. A trailing CONSOLE_CAN_EXTENDED_SUFFIX selects a
+ * 29-bit extended identifier; otherwise the identifier must be standard.
+ */
+static bool CONSOLE_CAN_Parse_Id( const char* text, uint32_t* id, bool* extended )
+{
+    if ( text == NULL || id == NULL || extended == NULL )
+    {
+        return false;
+    }
+
+    size_t length = strlen( text );
+    if ( length < 2U || text[length - 1U] != CONSOLE_CAN_EXTENDED_SUFFIX )
+    {
+        *extended = false;
+        return CONSOLE_CAN_Parse_U32( text, EXEC_CAN_STANDARD_ID_MAX, id );
+    }
+    if ( length > CONSOLE_CAN_MAX_ID_TEXT )
+    {
+        return false;
+    }
+
+    char digits[CONSOLE_CAN_MAX_ID_TEXT] = { 0 };
+    memcpy( digits, text, length - 1U );
+    *extended = true;
+    return CONSOLE_CAN_Parse_U32( digits, EXEC_CAN_EXTENDED_ID_MAX, id );
+}
+
+/**
+ * Parse a filter rule: a single CAN identifier or an inclusive range of two
+ * identifiers separated by CONSOLE_CAN_RANGE_SEPARATOR. Both ends of a range
+ * must use the same identifier format.
+ */
+static bool CONSOLE_CAN_Parse_Filter_Rule( const char* text, EXEC_CAN_Filter_Rule_T* rule )
+{
+    if ( text == NULL || rule == NULL )
+    {
+        return false;
+    }
+
+    const char* separator = strchr( text, CONSOLE_CAN_RANGE_SEPARATOR );
+    if ( separator == NULL )
+    {
+        if ( !CONSOLE_CAN_Parse_Id( text, &rule->first_id, &rule->extended ) )
+        {
+            return false;
+        }
+        rule->last_id = rule->first_id;
+        return true;
+    }
+
+    size_t length = ( size_t )( separator - text );
+    if ( length >= CONSOLE_CAN_MAX_ID_TEXT )
+    {
+        return false;
+    }
+
+    char first[CONSOLE_CAN_MAX_ID_TEXT] = { 0 };
+    bool last_extended                  = false;
+    memcpy( first, text, length );
+    return CONSOLE_CAN_Parse_Id( first, &rule->first_id, &rule->extended )
+           && CONSOLE_CAN_Parse_Id( separator + 1, &rule->last_id, &last_extended )
+           && last_extended == rule->extended && rule->first_id <= rule->last_id;
+}
+
+static void CONSOLE_CAN_Print_Filter_Report( EXEC_CAN_Channel_T channel )
+{
+    EXEC_CAN_Filter_Report_T report = { 0 };
+    if ( EXEC_CAN_Get_Filter_Report( channel, &report ) != EXEC_CAN_RESULT_OK )
+    {
+        return;
+    }
+
+    if ( report.bank_count == 0U )
+    {
+        CONSOLE_Printf( "CAN%u filters: no banks\r\n", CONSOLE_CAN_Channel_Number( channel ) );
+        return;
+    }
+
+    CONSOLE_Printf( "CAN%u filters: banks %u-%u, %lu ID(s) in hardware, %lu ID(s) in software\r\n",
+                    CONSOLE_CAN_Channel_Number( channel ), ( unsigned int )report.first_bank,
+                    ( unsigned int )( report.first_bank + report.bank_count - 1U ),
+                    ( unsigned long )report.hardware_ids, ( unsigned long )report.software_ids );
+}
+
+static const char* CONSOLE_CAN_Error_State_Name( const EXEC_CAN_Bus_Stats_T* stats )
+{
+    if ( stats->bus_off )
+    {
+        return "bus-off";
+    }
+    if ( stats->error_passive )
+    {
+        return "error passive";
+    }
+    return stats->error_warning ? "error warning" : "error active";
+}
+
+/**
+ * Print bus statistics. Loads are shown in percent as the range between the
+ * estimate without stuff bits and the worst-case estimate.
+ */
+static void CONSOLE_CAN_Print_Bus_Stats( EXEC_CAN_Channel_T          channel,
+                                         const EXEC_CAN_Bus_Stats_T* stats )
+{
+    unsigned int number = CONSOLE_CAN_Channel_Number( channel );
+
+    CONSOLE_Printf( "CAN%u traffic: %lu tx, %lu rx, %lu frame/s, %lu bit/s over %lu us\r\n",
+                    number, ( unsigned long )stats->tx_frames, ( unsigned long )stats->rx_frames,
+                    ( unsigned long )stats->frames_per_s, ( unsigned long )stats->bits_per_s,
+                    ( unsigned long )stats->window_us );
+    CONSOLE_Printf( "CAN%u load: %u.%u-%u.%u%%, peak %u.%u%%\r\n", number,
+                    stats->bus_load_permille / CONSOLE_CAN_PERMILLE_PER_PERCENT,
+                    stats->bus_load_permille % CONSOLE_CAN_PERMILLE_PER_PERCENT,
+                    stats->bus_load_max_permille / CONSOLE_CAN_PERMILLE_PER_PERCENT,
+                    stats->bus_load_max_permille % CONSOLE_CAN_PERMILLE_PER_PERCENT,
+                    stats->peak_load_permille / CONSOLE_CAN_PERMILLE_PER_PERCENT,
+                    stats->peak_load_permille % CONSOLE_CAN_PERMILLE_PER_PERCENT );
+    CONSOLE_Printf( "CAN%u errors: %s, TEC %u (peak %u), REC %u (peak %u), %lu bus error(s), "
+                    "last code %u, %lu tx error(s)\r\n",
+                    number, CONSOLE_CAN_Error_State_Name( stats ), ( unsigned int )stats->tec,
+                    ( unsigned int )stats->peak_tec, ( unsigned int )stats->rec,
+                    ( unsigned int )stats->peak_rec, ( unsigned long )stats->bus_errors,
+                    ( unsigned int )stats->last_error_code, ( unsigned long )stats->tx_errors );
+    CONSOLE_Printf( "CAN%u bus-off: %lu time(s), recovery last %lu us, max %lu us\r\n", number,
+                    ( unsigned long )stats->bus_off_count, ( unsigned long )stats->last_recovery_us,
+                    ( unsigned long )stats->max_recovery_us );
+    CONSOLE_Printf( "CAN%u rx dropped: %lu, %lu/s\r\n", number,
+                    ( unsigned long )stats->rx_dropped, ( unsigned long )stats->rx_dropped_per_s );
+    CONSOLE_Printf( "CAN%u arbitration lost: %lu, %lu untracked\r\n", number,
+                    ( unsigned long )stats->arbitration_lost,
+                    ( unsigned long )stats->arbitration_untracked );
+
+    uint8_t entries = stats->arbitration_id_count <= EXEC_CAN_MAX_ARBITRATION_IDS
+                          ? stats->arbitration_id_count
+                          : EXEC_CAN_MAX_ARBITRATION_IDS;
+    for ( uint8_t i = 0U; i < entries; i++ )
+    {
+        const EXEC_CAN_Arbitration_Count_T* entry = &stats->arbitration_ids[i];
+        if ( entry->extended )
+        {
+            CONSOLE_Printf( "  id 0x%08lX (ext): %lu\r\n", ( unsigned long )entry->id,
+                            ( unsigned long )entry->count );
+        }
+        else
+        {
+            CONSOLE_Printf( "  id 0x%03X: %lu\r\n", ( unsigned int )entry->id,
+                            ( unsigned long )entry->count );
+        }
+    }
+}
+
 static void CONSOLE_Command_Can_tx( uint16_t argc, char* argv[] )
 {
     if ( argc < 5U || ( ( argc - 3U ) % 2U ) != 0U )
@@ -136,11 +324,12 @@ static void CONSOLE_Command_Can_tx( uint16_t argc, char* argv[] )
     {
         uint16_t id_index      = ( uint16_t )( 3U + ( i * 2U ) );
         uint16_t payload_index = id_index + 1U;
-        uint16_t id            = 0U;
+        uint32_t id            = 0U;
+        bool     extended      = false;
 
-        if ( !CONSOLE_CAN_Parse_U16( argv[id_index], 0, 0U, EXEC_CAN_STANDARD_ID_MAX, &id ) )
+        if ( !CONSOLE_CAN_Parse_Id( argv[id_index], &id, &extended ) )
         {
-            CONSOLE_Printf( "Invalid standard CAN ID\r\n" );
+            CONSOLE_Printf( "Invalid CAN ID\r\n" );
             return;
         }
         if ( argv[payload_index] == NULL )
@@ -156,8 +345,9 @@ static void CONSOLE_Command_Can_tx( uint16_t argc, char* argv[] )
             return;
         }
 
-        packets[i].id  = id;
-        packets[i].dlc = ( uint8_t )payload_length;
+        packets[i].id       = id;
+        packets[i].dlc      = ( uint8_t )payload_length;
+        packets[i].extended = extended;
         memcpy( packets[i].data, argv[payload_index], payload_length );
     }
 
@@ -185,14 +375,18 @@ static void CONSOLE_Command_Can_config( uint16_t argc, char* argv[] )
         return;
     }
 
-    uint16_t can1_bank   = 0U;
-    uint16_t can2_bank   = 0U;
-    uint16_t filter_id   = 0U;
-    uint16_t filter_mask = 0U;
+    uint16_t can1_bank       = 0U;
+    uint16_t can2_bank       = 0U;
+    uint32_t filter_id       = 0U;
+    uint32_t filter_mask     = 0U;
+    bool     filter_extended = false;
     if ( !CONSOLE_CAN_Parse_U16( argv[2], 10, 0U, 13U, &can1_bank )
          || !CONSOLE_CAN_Parse_U16( argv[3], 10, 14U, 27U, &can2_bank )
-         || !CONSOLE_CAN_Parse_U16( argv[4], 0, 0U, EXEC_CAN_STANDARD_ID_MAX, &filter_id )
-         || !CONSOLE_CAN_Parse_U16( argv[5], 0, 0U, EXEC_CAN_STANDARD_ID_MAX, &filter_mask ) )
+         || !CONSOLE_CAN_Parse_Id( argv[4], &filter_id, &filter_extended )
+         || !CONSOLE_CAN_Parse_U32( argv[5],
+                                    filter_extended ? EXEC_CAN_EXTENDED_ID_MAX
+                                                    : EXEC_CAN_STANDARD_ID_MAX,
+                                    &filter_mask ) )
     {
         CONSOLE_Printf( "Invalid CAN configuration values\r\n" );
         CONSOLE_CAN_Print_Usage();
@@ -200,7 +394,8 @@ static void CONSOLE_Command_Can_config( uint16_t argc, char* argv[] )
     }
 
     EXEC_CAN_Result_T result = EXEC_CAN_Configure( EXEC_CAN_CHANNEL_1, CONSOLE_CAN_BITRATE,
-                                                   can1_bank, filter_id, filter_mask );
+                                                   can1_bank, filter_id, filter_mask,
+                                                   filter_extended );
     if ( result != EXEC_CAN_RESULT_OK )
     {
         CONSOLE_Printf( "CAN1 configuration failed with error %d\r\n", result );
@@ -208,7 +403,7 @@ static void CONSOLE_Command_Can_config( uint16_t argc, char* argv[] )
     }
 
     result = EXEC_CAN_Configure( EXEC_CAN_CHANNEL_2, CONSOLE_CAN_BITRATE, can2_bank, filter_id,
-                                 filter_mask );
+                                 filter_mask, filter_extended );
     if ( result != EXEC_CAN_RESULT_OK )
     {
         CONSOLE_Printf( "CAN2 configuration failed with error %d\r\n", result );
@@ -262,8 +457,16 @@ static void CONSOLE_Command_Can_rx( uint16_t argc, char* argv[] )
         uint8_t payload_length = packets[i].dlc <= EXEC_CAN_MAX_PAYLOAD_SIZE
                                      ? packets[i].dlc
                                      : EXEC_CAN_MAX_PAYLOAD_SIZE;
-        CONSOLE_Printf( "Received id: 0x%03X, dlc: %u, data:", ( unsigned int )packets[i].id,
-                        ( unsigned int )packets[i].dlc );
+        if ( packets[i].extended )
+        {
+            CONSOLE_Printf( "Received id: 0x%08lX (ext), dlc: %u, data:",
+                            ( unsigned long )packets[i].id, ( unsigned int )packets[i].dlc );
+        }
+        else
+        {
+            CONSOLE_Printf( "Received id: 0x%03X, dlc: %u, data:", ( unsigned int )packets[i].id,
+                            ( unsigned int )packets[i].dlc );
+        }
         for ( uint8_t j = 0U; j < payload_length; j++ )
         {
             CONSOLE_Printf( " %02X", ( unsigned int )packets[i].data[j] );
@@ -272,6 +475,93 @@ static void CONSOLE_Command_Can_rx( uint16_t argc, char* argv[] )
     }
 }
 
+static void CONSOLE_Command_Can_filter( uint16_t argc, char* argv[] )
+{
+    if ( argc < 4U )
+    {
+        CONSOLE_CAN_Print_Usage();
+        return;
+    }
+
+    uint16_t rule_count = ( uint16_t )( argc - 3U );
+    if ( rule_count > EXEC_CAN_MAX_FILTER_RULES )
+    {
+        CONSOLE_Printf( "Too many CAN filter rules; maximum is %u\r\n",
+                        ( unsigned int )EXEC_CAN_MAX_FILTER_RULES );
+        return;
+    }
+
+    EXEC_CAN_Channel_T channel;
+    if ( !CONSOLE_CAN_Parse_Channel( argv[2], &channel ) )
+    {
+        CONSOLE_Printf( "Invalid CAN channel; expected 1 or 2\r\n" );
+        return;
+    }
+
+    EXEC_CAN_Filter_Rule_T rules[EXEC_CAN_MAX_FILTER_RULES] = { 0 };
+    for ( uint16_t i = 0U; i < rule_count; i++ )
+    {
+        if ( !CONSOLE_CAN_Parse_Filter_Rule( argv[3U + i], &rules[i] ) )
+        {
+            CONSOLE_Printf( "Invalid CAN filter rule: %s\r\n",
+                            argv[3U + i] != NULL ? argv[3U + i] : "" );
+            return;
+        }
+    }
+
+    EXEC_CAN_Result_T result = EXEC_CAN_Set_Filters( channel, rules, rule_count );
+    if ( result != EXEC_CAN_RESULT_OK )
+    {
+        CONSOLE_Printf( "CAN%u filter update failed with error %d\r\n",
+                        CONSOLE_CAN_Channel_Number( channel ), result );
+        return;
+    }
+
+    CONSOLE_CAN_Print_Filter_Report( EXEC_CAN_CHANNEL_1 );
+    CONSOLE_CAN_Print_Filter_Report( EXEC_CAN_CHANNEL_2 );
+}
+
+static void CONSOLE_Command_Can_stats( uint16_t argc, char* argv[] )
+{
+    if ( argc != 3U && argc != 4U )
+    {
+        CONSOLE_CAN_Print_Usage();
+        return;
+    }
+
+    EXEC_CAN_Channel_T channel;
+    if ( !CONSOLE_CAN_Parse_Channel( argv[2], &channel ) )
+    {
+        CONSOLE_Printf( "Invalid CAN channel; expected 1 or 2\r\n" );
+        return;
+    }
+
+    if ( argc == 4U )
+    {
+        if ( argv[3] == NULL || strcmp( argv[3], "reset" ) != 0 )
+        {
+            CONSOLE_CAN_Print_Usage();
+            return;
+        }
+        if ( EXEC_CAN_Reset_Bus_Stats( channel ) == EXEC_CAN_RESULT_OK )
+        {
+            CONSOLE_Printf( "CAN%u statistics reset\r\n", CONSOLE_CAN_Channel_Number( channel ) );
+        }
+        return;
+    }
+
+    EXEC_CAN_Bus_Stats_T stats;
+    memset( &stats, 0, sizeof( stats ) );
+    if ( EXEC_CAN_Get_Bus_Stats( channel, &stats ) != EXEC_CAN_RESULT_OK )
+    {
+        CONSOLE_Printf( "Unable to read CAN%u statistics\r\n",
+                        CONSOLE_CAN_Channel_Number( channel ) );
+        return;
+    }
+
+    CONSOLE_CAN_Print_Bus_Stats( channel, &stats );
+}
+
 /**-----------------------------------------------------------------------------
  *  Public Function Definitions
  *------------------------------------------------------------------------------
@@ -297,6 +587,14 @@ void CONSOLE_CAN_Command_Handler( uint16_t argc, char* argv[] )
     {
         CONSOLE_Command_Can_config( argc, argv );
     }
+    else if ( strcmp( argv[1], "filter" ) == 0 )
+    {
+        CONSOLE_Command_Can_filter( argc, argv );
+    }
+    else if ( strcmp( argv[1], "stats" ) == 0 )
+    {
+        CONSOLE_Command_Can_stats( argc, argv );
+    }
     else
     {
         CONSOLE_Printf( "Unknown CAN command: %s\r\n", argv[1] );
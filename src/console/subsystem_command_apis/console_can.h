@@ -40,6 +40,14 @@ extern "C"
  *   can tx <channel> <id> <payload> [<id> <payload> ...]
  *   can rx <channel>
  *   can config <can1_bank> <can2_bank> <filter_id> <filter_mask>
+ *   can filter <channel> <id|first-last> [<id|first-last> ...]
+ *   can stats <channel> [reset]
+ *
+ * IDs are standard 11-bit identifiers unless suffixed with x, which selects a
+ * 29-bit extended identifier (e.g. 0x18FEF100x). An extended filter_id makes
+ * the acceptance filter match extended frames with a 29-bit filter_mask.
+ * can stats prints the channel's traffic, bus load, error counters, bus-off
+ * recoveries, receive drops and lost arbitrations; with reset it clears them.
  *
  * @param argc Number of parsed command arguments.
  * @param argv Parsed command argument array.
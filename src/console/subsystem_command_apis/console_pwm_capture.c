@@ -204,8 +204,9 @@ void CONSOLE_PWM_Capture_Command( uint16_t argc, char* argv[] )
             return;
         }
 
-        config.mode       = mode;
-        config.is_enabled = true;
+        config.mode          = mode;
+        config.is_enabled    = true;
+        config.capture_edges = false;
 
         if ( !EXEC_PWM_Capture_Start_Channel( channel, &config ) )
         {
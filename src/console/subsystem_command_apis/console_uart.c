@@ -7,7 +7,8 @@
  *      Console command API for DUT facing UART functionality.
  *
  *      This module owns UART related console command handling, including
- *      channel configuration and UART loopback testing commands.
+ *      channel configuration, UART loopback testing commands, and a zero copy
+ *      TX streaming throughput benchmark.
  *
  *  Notes:
  *      The top level console command handler dispatches to this module for the
@@ -49,6 +50,16 @@
 #define CONSOLE_UART_BLAST_RANDOM_DEFAULT_CHUNK_SIZE 0U
 #define CONSOLE_UART_BLAST_RANDOM_MAX_LENGTH EXEC_UART_MAX_CHUNK_SIZE
 
+/*
+ * The stream benchmark transmits the start of the internal flash, which is always
+ * mapped and readable by DMA, as one zero copy segment per queue slot.
+ */
+#define CONSOLE_UART_STREAM_SOURCE_ADDRESS 0x08000000U
+#define CONSOLE_UART_STREAM_SEGMENT_SIZE 16384U
+#define CONSOLE_UART_STREAM_MAX_LENGTH                                                             \
+    ( CONSOLE_UART_STREAM_SEGMENT_SIZE * HW_UART_TX_SEGMENT_QUEUE_DEPTH )
+#define CONSOLE_UART_STREAM_POLL_MS 1U
+
 /*
  * argv index constants for the "uart loopback <subcommand> [params...]" layout.
  *
@@ -110,6 +121,7 @@ static void CONSOLE_UART_Loopback_Deconfigure( uint16_t argc, char* argv[] );
 static void CONSOLE_UART_Loopback_Status( uint16_t argc, char* argv[] );
 static void CONSOLE_UART_Loopback_Start( uint16_t argc, char* argv[] );
 static void CONSOLE_UART_Loopback_Blast_Random( uint16_t argc, char* argv[] );
+static void CONSOLE_UART_Loopback_Stream( uint16_t argc, char* argv[] );
 
 static bool CONSOLE_UART_Parse_Baud_Rate( const char* text, uint32_t* baud_rate_out );
 static bool CONSOLE_UART_Parse_Channel( const char* text, HwUartChannel_T* channel_out );
@@ -155,6 +167,7 @@ static const ConsoleUartSubcommand_T LOOPBACK_SUBCOMMANDS[] = {
     { "status", CONSOLE_UART_Loopback_Status },
     { "start", CONSOLE_UART_Loopback_Start },
     { "blast_random", CONSOLE_UART_Loopback_Blast_Random },
+    { "stream", CONSOLE_UART_Loopback_Stream },
 };
 
 /**-----------------------------------------------------------------------------
@@ -180,12 +193,16 @@ static void CONSOLE_UART_Loopback_Print_Usage( void )
     CONSOLE_Printf( "  uart loopback start <sender_ch> <receiver_ch> <data ...>\r\n" );
     CONSOLE_Printf( "  uart loopback blast_random <sender_ch> <receiver_ch> <length> <seed> "
                     "[iterations] [chunk_size]\r\n" );
+    CONSOLE_Printf( "  uart loopback stream <sender_ch> <length>\r\n" );
     CONSOLE_Printf( "    note: sender_ch and receiver_ch must be in {ch1,ch2}\r\n" );
     CONSOLE_Printf( "    note: configure uses fixed mode TTL_3V3 with RX+TX enabled\r\n" );
     CONSOLE_Printf( "    note: default framing is 8N1\r\n" );
     CONSOLE_Printf( "    note: supported framing values are 8N1, 8E1, 8O1, 8N2, 9N1\r\n" );
     CONSOLE_Printf( "    note: blast_random uses deterministic pseudo-random data\r\n" );
     CONSOLE_Printf( "    note: chunk_size 0 sends the payload in one transmit call\r\n" );
+    CONSOLE_Printf( "    note: stream sends up to %lu bytes of flash zero copy and reports "
+                    "throughput\r\n",
+                    ( unsigned long )CONSOLE_UART_STREAM_MAX_LENGTH );
 }
 
 static bool CONSOLE_UART_Parse_U32( const char* text, const char* field_name, uint32_t min_value,
@@ -829,6 +846,100 @@ static void CONSOLE_UART_Loopback_Blast_Random( uint16_t argc, char* argv[] )
     CONSOLE_Printf( "  bytes tested: %lu\r\n", ( unsigned long )( passed * length ) );
 }
 
+static void CONSOLE_UART_Loopback_Stream( uint16_t argc, char* argv[] )
+{
+    HwUartChannel_T   sender_ch;
+    HwUartTxSegment_T segments[HW_UART_TX_SEGMENT_QUEUE_DEPTH];
+
+    uint32_t length        = 0U;
+    uint32_t segment_count = 0U;
+
+    if ( argc != 5U )
+    {
+        CONSOLE_UART_Loopback_Print_Usage();
+        return;
+    }
+
+    if ( !s_uart_loopback_state.is_configured )
+    {
+        CONSOLE_Printf( "uart loopback not configured\r\n" );
+        return;
+    }
+
+    if ( !CONSOLE_UART_Parse_Channel( argv[CONSOLE_UART_ARGV_PARAM_1], &sender_ch ) )
+    {
+        CONSOLE_Printf( "Invalid sender channel: use ch1 or ch2\r\n" );
+        return;
+    }
+
+    if ( !CONSOLE_UART_Parse_U32( argv[CONSOLE_UART_ARGV_PARAM_2], "length", 1U,
+                                  CONSOLE_UART_STREAM_MAX_LENGTH, &length ) )
+    {
+        return;
+    }
+
+    const uint8_t* source = ( const uint8_t* )( uintptr_t )CONSOLE_UART_STREAM_SOURCE_ADDRESS;
+
+    for ( uint32_t offset = 0U; offset < length; offset += CONSOLE_UART_STREAM_SEGMENT_SIZE )
+    {
+        uint32_t remaining = length - offset;
+
+        segments[segment_count].data = &source[offset];
+        segments[segment_count].length_bytes =
+            ( remaining < CONSOLE_UART_STREAM_SEGMENT_SIZE ) ? remaining
+                                                             : CONSOLE_UART_STREAM_SEGMENT_SIZE;
+        segment_count++;
+    }
+
+    uint32_t   timeout_ms  = 2U * CONSOLE_UART_Calc_Loopback_Delay_Ms( length );
+    uint32_t   waited_ms   = 0U;
+    TickType_t start_ticks = xTaskGetTickCount();
+
+    if ( !EXEC_UART_Transmit_Zero_Copy( sender_ch, segments, segment_count ) )
+    {
+        CONSOLE_Printf( "TX failed\r\n" );
+        return;
+    }
+
+    while ( !EXEC_UART_Is_Tx_Complete( sender_ch ) && ( waited_ms < timeout_ms ) )
+    {
+        vTaskDelay( pdMS_TO_TICKS( CONSOLE_UART_STREAM_POLL_MS ) );
+        waited_ms += CONSOLE_UART_STREAM_POLL_MS;
+    }
+
+    uint32_t elapsed_ticks = ( uint32_t )( xTaskGetTickCount() - start_ticks );
+
+    /* The receiver's RX ring has wrapped many times over; discard what is left. */
+    CONSOLE_UART_Clear_Rx_Data();
+
+    if ( !EXEC_UART_Is_Tx_Complete( sender_ch ) )
+    {
+        CONSOLE_Printf( "FAIL: TX did not complete within %lu ms\r\n",
+                        ( unsigned long )timeout_ms );
+        return;
+    }
+
+    if ( elapsed_ticks == 0U )
+    {
+        elapsed_ticks = 1U;
+    }
+
+    uint32_t ticks_per_second = pdMS_TO_TICKS( 1000U );
+    uint32_t wire_bits        = s_uart_loopback_state.wire_bits_per_byte;
+    uint32_t line_rate        = s_uart_loopback_state.baud_rate / wire_bits;
+    uint64_t scaled_bytes     = ( uint64_t )length * ticks_per_second;
+    uint32_t throughput       = ( uint32_t )( scaled_bytes / elapsed_ticks );
+
+    CONSOLE_Printf( "uart loopback stream\r\n" );
+    CONSOLE_Printf( "  bytes: %lu in %lu segments\r\n", ( unsigned long )length,
+                    ( unsigned long )segment_count );
+    CONSOLE_Printf( "  elapsed: %lu ms\r\n",
+                    ( unsigned long )( ( elapsed_ticks * 1000U ) / ticks_per_second ) );
+    CONSOLE_Printf( "  throughput: %lu bytes/s\r\n", ( unsigned long )throughput );
+    CONSOLE_Printf( "  line rate: %lu bytes/s (%lu%%)\r\n", ( unsigned long )line_rate,
+                    ( unsigned long )( ( ( uint64_t )throughput * 100U ) / line_rate ) );
+}
+
 static void CONSOLE_UART_Command_Loopback( uint16_t argc, char* argv[] )
 {
     if ( argc < 3U )
@@ -22,20 +22,27 @@ extern "C"
 #include <string>
 #include <vector>
 
-static std::string                    console_output;
-static std::vector<EXEC_CAN_Packet_T> transmitted_packets[2];
-static EXEC_CAN_Result_T              transmit_results[2];
-static uint16_t                       transmit_counts[2];
-static EXEC_CAN_Packet_T              received_packets[2][4];
-static uint16_t                       received_counts[2];
-static EXEC_CAN_Result_T              receive_results[2];
-static uint32_t                       dropped_counts[2];
-static uint16_t                       configure_counts[2];
-static uint32_t                       configured_bitrates[2];
-static uint16_t                       configured_banks[2];
-static uint16_t                       configured_ids[2];
-static uint16_t                       configured_masks[2];
-static EXEC_CAN_Result_T              configure_results[2];
+static std::string                         console_output;
+static std::vector<EXEC_CAN_Packet_T>      transmitted_packets[2];
+static EXEC_CAN_Result_T                   transmit_results[2];
+static uint16_t                            transmit_counts[2];
+static EXEC_CAN_Packet_T                   received_packets[2][4];
+static uint16_t                            received_counts[2];
+static EXEC_CAN_Result_T                   receive_results[2];
+static uint32_t                            dropped_counts[2];
+static uint16_t                            configure_counts[2];
+static uint32_t                            configured_bitrates[2];
+static uint16_t                            configured_banks[2];
+static uint32_t                            configured_ids[2];
+static uint32_t                            configured_masks[2];
+static bool                                configured_extended[2];
+static EXEC_CAN_Result_T                   configure_results[2];
+static std::vector<EXEC_CAN_Filter_Rule_T> filter_rules[2];
+static uint16_t                            filter_counts[2];
+static EXEC_CAN_Result_T                   filter_results[2];
+static EXEC_CAN_Filter_Report_T            filter_reports[2];
+static EXEC_CAN_Bus_Stats_T                bus_stats[2];
+static uint16_t                            bus_stats_reset_counts[2];
 
 static size_t ChannelIndex( EXEC_CAN_Channel_T channel )
 {
@@ -79,8 +86,8 @@ extern "C" uint32_t EXEC_CAN_Get_Rx_Dropped_Count( EXEC_CAN_Channel_T channel )
 }
 
 extern "C" EXEC_CAN_Result_T EXEC_CAN_Configure( EXEC_CAN_Channel_T channel, uint32_t bitrate,
-                                                 uint16_t filter_bank, uint16_t filter_id,
-                                                 uint16_t filter_mask )
+                                                 uint16_t filter_bank, uint32_t filter_id,
+                                                 uint32_t filter_mask, bool filter_extended )
 {
     size_t index = ChannelIndex( channel );
     configure_counts[index]++;
@@ -88,9 +95,40 @@ extern "C" EXEC_CAN_Result_T EXEC_CAN_Configure( EXEC_CAN_Channel_T channel, uin
     configured_banks[index]    = filter_bank;
     configured_ids[index]      = filter_id;
     configured_masks[index]    = filter_mask;
+    configured_extended[index] = filter_extended;
     return configure_results[index];
 }
 
+extern "C" EXEC_CAN_Result_T EXEC_CAN_Set_Filters( EXEC_CAN_Channel_T           channel,
+                                                   const EXEC_CAN_Filter_Rule_T rules[],
+                                                   uint16_t                     rule_count )
+{
+    size_t index = ChannelIndex( channel );
+    filter_counts[index]++;
+    filter_rules[index].assign( rules, rules + rule_count );
+    return filter_results[index];
+}
+
+extern "C" EXEC_CAN_Result_T EXEC_CAN_Get_Filter_Report( EXEC_CAN_Channel_T        channel,
+                                                         EXEC_CAN_Filter_Report_T* report )
+{
+    *report = filter_reports[ChannelIndex( channel )];
+    return EXEC_CAN_RESULT_OK;
+}
+
+extern "C" EXEC_CAN_Result_T EXEC_CAN_Get_Bus_Stats( EXEC_CAN_Channel_T    channel,
+                                                     EXEC_CAN_Bus_Stats_T* stats )
+{
+    *stats = bus_stats[ChannelIndex( channel )];
+    return EXEC_CAN_RESULT_OK;
+}
+
+extern "C" EXEC_CAN_Result_T EXEC_CAN_Reset_Bus_Stats( EXEC_CAN_Channel_T channel )
+{
+    bus_stats_reset_counts[ChannelIndex( channel )]++;
+    return EXEC_CAN_RESULT_OK;
+}
+
 class ConsoleCANTest : public ::testing::Test
 {
 protected:
@@ -108,9 +146,17 @@ class ConsoleCANTest : public ::testing::Test
         std::memset( configured_banks, 0, sizeof( configured_banks ) );
         std::memset( configured_ids, 0, sizeof( configured_ids ) );
         std::memset( configured_masks, 0, sizeof( configured_masks ) );
+        std::memset( configured_extended, 0, sizeof( configured_extended ) );
         transmit_results[0] = transmit_results[1] = EXEC_CAN_RESULT_OK;
         receive_results[0] = receive_results[1] = EXEC_CAN_RESULT_OK;
         configure_results[0] = configure_results[1] = EXEC_CAN_RESULT_OK;
+        filter_rules[0].clear();
+        filter_rules[1].clear();
+        std::memset( filter_counts, 0, sizeof( filter_counts ) );
+        std::memset( filter_reports, 0, sizeof( filter_reports ) );
+        filter_results[0] = filter_results[1] = EXEC_CAN_RESULT_OK;
+        bus_stats[0] = bus_stats[1] = {};
+        std::memset( bus_stats_reset_counts, 0, sizeof( bus_stats_reset_counts ) );
     }
 };
 
@@ -184,6 +230,26 @@ TEST_F( ConsoleCANTest, ValidDualChannelConfigurationUsesSeparateBanks )
     EXPECT_NE( console_output.find( "CAN1 and CAN2 configured" ), std::string::npos );
 }
 
+TEST_F( ConsoleCANTest, ExtendedFilterIdSelectsExtendedConfiguration )
+{
+    char  can[]    = "can";
+    char  config[] = "config";
+    char  bank1[]  = "0";
+    char  bank2[]  = "14";
+    char  id[]     = "0x18FEF100x";
+    char  mask[]   = "0x1FFFFF00";
+    char* argv[]   = { can, config, bank1, bank2, id, mask };
+
+    CONSOLE_CAN_Command_Handler( 6U, argv );
+
+    EXPECT_EQ( configure_counts[0], 1U );
+    EXPECT_EQ( configure_counts[1], 1U );
+    EXPECT_EQ( configured_ids[0], 0x18FEF100U );
+    EXPECT_EQ( configured_masks[1], 0x1FFFFF00U );
+    EXPECT_TRUE( configured_extended[0] );
+    EXPECT_TRUE( configured_extended[1] );
+}
+
 TEST_F( ConsoleCANTest, MultiFrameTransmitSetsDeterministicIDsAndDLCs )
 {
     char  can[]      = "can";
@@ -210,6 +276,41 @@ TEST_F( ConsoleCANTest, MultiFrameTransmitSetsDeterministicIDsAndDLCs )
     EXPECT_NE( console_output.find( "Started 2 CAN frame(s) on channel 2" ), std::string::npos );
 }
 
+TEST_F( ConsoleCANTest, ExtendedSuffixTransmitsExtendedFrames )
+{
+    char  can[]      = "can";
+    char  tx[]       = "tx";
+    char  channel[]  = "1";
+    char  id1[]      = "0x18FEF100x";
+    char  payload1[] = "abc";
+    char  id2[]      = "0x123x";
+    char  payload2[] = "Z";
+    char* argv[]     = { can, tx, channel, id1, payload1, id2, payload2 };
+
+    CONSOLE_CAN_Command_Handler( 7U, argv );
+
+    ASSERT_EQ( transmitted_packets[0].size(), 2U );
+    EXPECT_EQ( transmitted_packets[0][0].id, 0x18FEF100U );
+    EXPECT_TRUE( transmitted_packets[0][0].extended );
+    EXPECT_EQ( transmitted_packets[0][1].id, 0x123U );
+    EXPECT_TRUE( transmitted_packets[0][1].extended );
+}
+
+TEST_F( ConsoleCANTest, ExtendedIDAbove29BitsIsRejected )
+{
+    char  can[]     = "can";
+    char  tx[]      = "tx";
+    char  channel[] = "1";
+    char  id[]      = "0x20000000x";
+    char  payload[] = "abc";
+    char* argv[]    = { can, tx, channel, id, payload };
+
+    CONSOLE_CAN_Command_Handler( 5U, argv );
+
+    EXPECT_EQ( transmit_counts[0], 0U );
+    EXPECT_NE( console_output.find( "Invalid CAN ID" ), std::string::npos );
+}
+
 TEST_F( ConsoleCANTest, InvalidTransmitPairDoesNotPartiallyTransmitBatch )
 {
     char  can[]      = "can";
@@ -245,3 +346,137 @@ TEST_F( ConsoleCANTest, ReceivePrintsIDAndDLCBoundedHexPayload )
     EXPECT_NE( console_output.find( "id: 0x7FF, dlc: 3, data: 00 FF 41" ), std::string::npos );
     EXPECT_EQ( console_output.find( "42" ), std::string::npos );
 }
+
+TEST_F( ConsoleCANTest, ReceivePrintsExtendedIDWithMarker )
+{
+    received_packets[1][0].id       = 0x18FEF100U;
+    received_packets[1][0].dlc      = 1U;
+    received_packets[1][0].data[0]  = 0x5AU;
+    received_packets[1][0].extended = true;
+    received_counts[1]              = 1U;
+    char  can[]                     = "can";
+    char  rx[]                      = "rx";
+    char  channel[]                 = "2";
+    char* argv[]                    = { can, rx, channel };
+
+    CONSOLE_CAN_Command_Handler( 3U, argv );
+
+    EXPECT_NE( console_output.find( "id: 0x18FEF100 (ext), dlc: 1, data: 5A" ), std::string::npos );
+}
+
+TEST_F( ConsoleCANTest, FilterCommandParsesIdsAndRangesAndPrintsBothReports )
+{
+    filter_reports[0] = { 0U, 2U, 0x101U, 0U };
+    filter_reports[1] = { 2U, 0U, 0U, 0U };
+    char  can[]      = "can";
+    char  filter[]   = "filter";
+    char  channel[]  = "1";
+    char  single[]   = "0x123";
+    char  range[]    = "0x100-0x1FF";
+    char  extended[] = "0x18FEF100x-0x18FEF1FFx";
+    char* argv[]     = { can, filter, channel, single, range, extended };
+
+    CONSOLE_CAN_Command_Handler( 6U, argv );
+
+    ASSERT_EQ( filter_counts[0], 1U );
+    ASSERT_EQ( filter_rules[0].size(), 3U );
+    EXPECT_EQ( filter_rules[0][0].first_id, 0x123U );
+    EXPECT_EQ( filter_rules[0][0].last_id, 0x123U );
+    EXPECT_FALSE( filter_rules[0][0].extended );
+    EXPECT_EQ( filter_rules[0][1].first_id, 0x100U );
+    EXPECT_EQ( filter_rules[0][1].last_id, 0x1FFU );
+    EXPECT_EQ( filter_rules[0][2].first_id, 0x18FEF100U );
+    EXPECT_EQ( filter_rules[0][2].last_id, 0x18FEF1FFU );
+    EXPECT_TRUE( filter_rules[0][2].extended );
+    EXPECT_NE( console_output.find(
+                   "CAN1 filters: banks 0-1, 257 ID(s) in hardware, 0 ID(s) in software" ),
+               std::string::npos );
+    EXPECT_NE( console_output.find( "CAN2 filters: no banks" ), std::string::npos );
+}
+
+TEST_F( ConsoleCANTest, FilterCommandRejectsMalformedRulesBeforeUpdating )
+{
+    char  can[]      = "can";
+    char  filter[]   = "filter";
+    char  channel[]  = "2";
+    char  mixed[]    = "0x100-0x18FEF100x";
+    char  inverted[] = "0x200-0x100";
+    char  open[]     = "0x100-";
+    char* rules[]    = { mixed, inverted, open };
+
+    for ( char* rule : rules )
+    {
+        char* argv[] = { can, filter, channel, rule };
+        console_output.clear();
+
+        CONSOLE_CAN_Command_Handler( 4U, argv );
+
+        EXPECT_NE( console_output.find( "Invalid CAN filter rule" ), std::string::npos ) << rule;
+    }
+    EXPECT_EQ( filter_counts[0] + filter_counts[1], 0U );
+}
+
+TEST_F( ConsoleCANTest, StatsCommandPrintsLoadErrorsAndArbitrationLosses )
+{
+    bus_stats[1].tx_frames                   = 120U;
+    bus_stats[1].rx_frames                   = 880U;
+    bus_stats[1].frames_per_s                = 1000U;
+    bus_stats[1].bits_per_s                  = 111000U;
+    bus_stats[1].window_us                   = 1000000U;
+    bus_stats[1].bus_load_permille           = 222U;
+    bus_stats[1].bus_load_max_permille       = 268U;
+    bus_stats[1].peak_load_permille          = 301U;
+    bus_stats[1].tec                         = 130U;
+    bus_stats[1].peak_tec                    = 140U;
+    bus_stats[1].error_passive               = true;
+    bus_stats[1].bus_off_count               = 1U;
+    bus_stats[1].max_recovery_us             = 2800U;
+    bus_stats[1].rx_dropped_per_s            = 3U;
+    bus_stats[1].arbitration_lost            = 5U;
+    bus_stats[1].arbitration_id_count        = 2U;
+    bus_stats[1].arbitration_ids[0].id       = 0x123U;
+    bus_stats[1].arbitration_ids[0].count    = 2U;
+    bus_stats[1].arbitration_ids[1].id       = 0x18FEF100U;
+    bus_stats[1].arbitration_ids[1].extended = true;
+    bus_stats[1].arbitration_ids[1].count    = 3U;
+    char  can[]                              = "can";
+    char  stats[]                            = "stats";
+    char  channel[]                          = "2";
+    char* argv[]                             = { can, stats, channel };
+
+    CONSOLE_CAN_Command_Handler( 3U, argv );
+
+    EXPECT_NE( console_output.find( "CAN2 traffic: 120 tx, 880 rx, 1000 frame/s, 111000 bit/s" ),
+               std::string::npos );
+    EXPECT_NE( console_output.find( "CAN2 load: 22.2-26.8%, peak 30.1%" ), std::string::npos );
+    EXPECT_NE( console_output.find( "error passive, TEC 130 (peak 140)" ), std::string::npos );
+    EXPECT_NE( console_output.find( "1 time(s), recovery last 0 us, max 2800 us" ),
+               std::string::npos );
+    EXPECT_NE( console_output.find( "CAN2 rx dropped: 0, 3/s" ), std::string::npos );
+    EXPECT_NE( console_output.find( "id 0x123: 2" ), std::string::npos );
+    EXPECT_NE( console_output.find( "id 0x18FEF100 (ext): 3" ), std::string::npos );
+    EXPECT_EQ( bus_stats_reset_counts[1], 0U );
+}
+
+TEST_F( ConsoleCANTest, StatsResetClearsOnlyTheNamedChannel )
+{
+    char  can[]     = "can";
+    char  stats[]   = "stats";
+    char  channel[] = "1";
+    char  reset[]   = "reset";
+    char  other[]   = "clear";
+    char* argv[]    = { can, stats, channel, reset };
+
+    CONSOLE_CAN_Command_Handler( 4U, argv );
+
+    EXPECT_EQ( bus_stats_reset_counts[0], 1U );
+    EXPECT_EQ( bus_stats_reset_counts[1], 0U );
+    EXPECT_NE( console_output.find( "CAN1 statistics reset" ), std::string::npos );
+
+    argv[3] = other;
+    console_output.clear();
+    CONSOLE_CAN_Command_Handler( 4U, argv );
+
+    EXPECT_EQ( bus_stats_reset_counts[0], 1U );
+    EXPECT_NE( console_output.find( "can stats" ), std::string::npos );
+}
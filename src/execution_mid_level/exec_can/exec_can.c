@@ -27,6 +27,20 @@ _Static_assert( EXEC_CAN_MAX_BATCH_SIZE <= HW_CAN_TX_QUEUE_CAPACITY,
                 "Execution CAN batches must fit the hardware TX queue" );
 _Static_assert( EXEC_CAN_MAX_BATCH_SIZE <= HW_CAN_RX_QUEUE_CAPACITY,
                 "Execution CAN receive storage must cover the hardware RX queue" );
+_Static_assert( EXEC_CAN_STANDARD_ID_MAX == CAN_STANDARD_ID_MAX
+                    && EXEC_CAN_EXTENDED_ID_MAX == CAN_EXTENDED_ID_MAX,
+                "Execution and hardware CAN identifier limits must match" );
+_Static_assert( EXEC_CAN_MAX_FILTER_RULES <= HW_CAN_FILTER_MAX_RULES,
+                "Execution CAN filter sets must fit the hardware filter plan" );
+_Static_assert( EXEC_CAN_MAX_CYCLIC_MESSAGES <= HW_CAN_CYCLIC_MAX_MESSAGES,
+                "Execution CAN cyclic tables must fit the hardware schedule" );
+_Static_assert( EXEC_CAN_MAX_RESPONDER_ENTRIES <= HW_CAN_RESPONDER_MAX_ENTRIES,
+                "Execution CAN responder tables must fit the hardware table" );
+_Static_assert( EXEC_CAN_REPLAY_TIME_SCALE_UNITY == HW_CAN_REPLAY_TIME_SCALE_UNITY,
+                "Execution and hardware CAN replay time scales must match" );
+_Static_assert( EXEC_CAN_MAX_ARBITRATION_IDS == HW_CAN_STATS_MAX_ARBITRATION_IDS
+                    && EXEC_CAN_BUS_LOAD_FULL_SCALE == HW_CAN_STATS_LOAD_FULL_SCALE,
+                "Execution and hardware CAN bus statistics must match" );
 
 /**-----------------------------------------------------------------------------
  *  Private Function Definitions
@@ -38,6 +52,30 @@ static bool EXEC_CAN_Channel_Is_Valid( EXEC_CAN_Channel_T channel )
     return channel == EXEC_CAN_CHANNEL_1 || channel == EXEC_CAN_CHANNEL_2;
 }
 
+static bool EXEC_CAN_Id_Is_Valid( uint32_t id, bool extended )
+{
+    return id <= ( extended ? EXEC_CAN_EXTENDED_ID_MAX : EXEC_CAN_STANDARD_ID_MAX );
+}
+
+static uint8_t* EXEC_CAN_Put_U16( uint8_t* cursor, uint16_t value )
+{
+    cursor[0] = ( uint8_t )value;
+    cursor[1] = ( uint8_t )( value >> 8U );
+    return cursor + 2U;
+}
+
+static uint8_t* EXEC_CAN_Put_U32( uint8_t* cursor, uint32_t value )
+{
+    cursor = EXEC_CAN_Put_U16( cursor, ( uint16_t )value );
+    return EXEC_CAN_Put_U16( cursor, ( uint16_t )( value >> 16U ) );
+}
+
+static uint8_t* EXEC_CAN_Put_U64( uint8_t* cursor, uint64_t value )
+{
+    cursor = EXEC_CAN_Put_U32( cursor, ( uint32_t )value );
+    return EXEC_CAN_Put_U32( cursor, ( uint32_t )( value >> 32U ) );
+}
+
 static EXEC_CAN_Result_T EXEC_CAN_Map_Result( HW_CAN_Result_T result )
 {
     switch ( result )
@@ -93,20 +131,75 @@ static EXEC_CAN_Tx_Status_T EXEC_CAN_Map_Tx_Status( HW_CAN_Tx_Status_T status )
  */
 
 EXEC_CAN_Result_T EXEC_CAN_Configure( EXEC_CAN_Channel_T channel, uint32_t bitrate,
-                                      uint16_t filter_bank, uint16_t filter_id,
-                                      uint16_t filter_mask )
+                                      uint16_t filter_bank, uint32_t filter_id,
+                                      uint32_t filter_mask, bool filter_extended )
 {
     if ( !EXEC_CAN_Channel_Is_Valid( channel ) )
     {
         return EXEC_CAN_RESULT_INVALID_ARGUMENT;
     }
 
-    int result = channel == EXEC_CAN_CHANNEL_1
-                     ? HW_CAN_Configure1( bitrate, filter_bank, filter_id, filter_mask )
-                     : HW_CAN_Configure2( bitrate, filter_bank, filter_id, filter_mask );
+    int result =
+        channel == EXEC_CAN_CHANNEL_1
+            ? HW_CAN_Configure1( bitrate, filter_bank, filter_id, filter_mask, filter_extended )
+            : HW_CAN_Configure2( bitrate, filter_bank, filter_id, filter_mask, filter_extended );
     return EXEC_CAN_Map_Configuration_Result( result );
 }
 
+EXEC_CAN_Result_T EXEC_CAN_Set_Filters( EXEC_CAN_Channel_T           channel,
+                                        const EXEC_CAN_Filter_Rule_T rules[], uint16_t rule_count )
+{
+    if ( !EXEC_CAN_Channel_Is_Valid( channel ) || ( rules == NULL && rule_count > 0U )
+         || rule_count > EXEC_CAN_MAX_FILTER_RULES )
+    {
+        return EXEC_CAN_RESULT_INVALID_ARGUMENT;
+    }
+
+    HW_CAN_Filter_Rule_T hardware_rules[EXEC_CAN_MAX_FILTER_RULES] = { 0 };
+    for ( uint16_t i = 0U; i < rule_count; i++ )
+    {
+        if ( rules[i].first_id > rules[i].last_id
+             || !EXEC_CAN_Id_Is_Valid( rules[i].last_id, rules[i].extended ) )
+        {
+            return EXEC_CAN_RESULT_INVALID_ARGUMENT;
+        }
+
+        hardware_rules[i].first_id = rules[i].first_id;
+        hardware_rules[i].last_id  = rules[i].last_id;
+        hardware_rules[i].extended = rules[i].extended;
+    }
+
+    HW_CAN_Result_T result = channel == EXEC_CAN_CHANNEL_1
+                                 ? HW_CAN_Set_Filters1( hardware_rules, rule_count )
+                                 : HW_CAN_Set_Filters2( hardware_rules, rule_count );
+    return result == HW_CAN_RESULT_OK ? EXEC_CAN_RESULT_OK : EXEC_CAN_RESULT_FILTER_ERROR;
+}
+
+EXEC_CAN_Result_T EXEC_CAN_Get_Filter_Report( EXEC_CAN_Channel_T        channel,
+                                              EXEC_CAN_Filter_Report_T* report )
+{
+    if ( !EXEC_CAN_Channel_Is_Valid( channel ) || report == NULL )
+    {
+        return EXEC_CAN_RESULT_INVALID_ARGUMENT;
+    }
+
+    HW_CAN_Filter_Report_T hardware_report = { 0 };
+    if ( channel == EXEC_CAN_CHANNEL_1 )
+    {
+        HW_CAN_Get_Filter_Report1( &hardware_report );
+    }
+    else
+    {
+        HW_CAN_Get_Filter_Report2( &hardware_report );
+    }
+
+    report->first_bank   = hardware_report.first_bank;
+    report->bank_count   = hardware_report.bank_count;
+    report->hardware_ids = hardware_report.hardware_ids;
+    report->software_ids = hardware_report.software_ids;
+    return EXEC_CAN_RESULT_OK;
+}
+
 EXEC_CAN_Result_T EXEC_CAN_Transmit( EXEC_CAN_Channel_T channel, const EXEC_CAN_Packet_T packets[],
                                      uint16_t packet_count )
 {
@@ -119,14 +212,15 @@ EXEC_CAN_Result_T EXEC_CAN_Transmit( EXEC_CAN_Channel_T channel, const EXEC_CAN_
     CAN_Packet_T hardware_packets[EXEC_CAN_MAX_BATCH_SIZE] = { 0 };
     for ( uint16_t i = 0U; i < packet_count; i++ )
     {
-        if ( packets[i].id > EXEC_CAN_STANDARD_ID_MAX
+        if ( !EXEC_CAN_Id_Is_Valid( packets[i].id, packets[i].extended )
              || packets[i].dlc > EXEC_CAN_MAX_PAYLOAD_SIZE )
         {
             return EXEC_CAN_RESULT_INVALID_ARGUMENT;
         }
 
-        hardware_packets[i].id  = packets[i].id;
-        hardware_packets[i].dlc = packets[i].dlc;
+        hardware_packets[i].id       = packets[i].id;
+        hardware_packets[i].dlc      = packets[i].dlc;
+        hardware_packets[i].extended = packets[i].extended;
         memcpy( hardware_packets[i].data, packets[i].data, packets[i].dlc );
     }
 
@@ -181,14 +275,16 @@ EXEC_CAN_Result_T EXEC_CAN_Receive( EXEC_CAN_Channel_T channel, EXEC_CAN_Packet_
 
     for ( uint16_t i = 0U; i < count; i++ )
     {
-        if ( hardware_packets[i].id > EXEC_CAN_STANDARD_ID_MAX
+        if ( !EXEC_CAN_Id_Is_Valid( hardware_packets[i].id, hardware_packets[i].extended )
              || hardware_packets[i].dlc > EXEC_CAN_MAX_PAYLOAD_SIZE )
         {
             return EXEC_CAN_RESULT_ERROR;
         }
 
-        destination[i].id  = hardware_packets[i].id;
-        destination[i].dlc = hardware_packets[i].dlc;
+        destination[i].id           = hardware_packets[i].id;
+        destination[i].dlc          = hardware_packets[i].dlc;
+        destination[i].extended     = hardware_packets[i].extended;
+        destination[i].timestamp_us = hardware_packets[i].timestamp_us;
         memset( destination[i].data, 0, sizeof( destination[i].data ) );
         memcpy( destination[i].data, hardware_packets[i].data, hardware_packets[i].dlc );
     }
@@ -229,3 +325,384 @@ uint32_t EXEC_CAN_Get_Rx_Dropped_Count( EXEC_CAN_Channel_T channel )
 
     return channel == EXEC_CAN_CHANNEL_1 ? HW_CAN_Rx_Dropped_Count1() : HW_CAN_Rx_Dropped_Count2();
 }
+
+EXEC_CAN_Result_T EXEC_CAN_Get_Tx_Timestamp( EXEC_CAN_Channel_T channel, uint32_t* timestamp_us )
+{
+    if ( !EXEC_CAN_Channel_Is_Valid( channel ) || timestamp_us == NULL )
+    {
+        return EXEC_CAN_RESULT_INVALID_ARGUMENT;
+    }
+
+    bool valid = channel == EXEC_CAN_CHANNEL_1 ? HW_CAN_Tx_Timestamp1( timestamp_us )
+                                               : HW_CAN_Tx_Timestamp2( timestamp_us );
+    return valid ? EXEC_CAN_RESULT_OK : EXEC_CAN_RESULT_EMPTY;
+}
+
+EXEC_CAN_Result_T EXEC_CAN_Cyclic_Start( EXEC_CAN_Channel_T            channel,
+                                         const EXEC_CAN_Cyclic_Entry_T entries[], uint16_t count )
+{
+    if ( !EXEC_CAN_Channel_Is_Valid( channel ) || ( entries == NULL && count > 0U )
+         || count > EXEC_CAN_MAX_CYCLIC_MESSAGES )
+    {
+        return EXEC_CAN_RESULT_INVALID_ARGUMENT;
+    }
+
+    // About 2 KB at the full table size, so it is kept off the caller's stack
+    static HW_CAN_Cyclic_Entry_T table[EXEC_CAN_MAX_CYCLIC_MESSAGES];
+    memset( table, 0, sizeof( table ) );
+    for ( uint16_t i = 0U; i < count; i++ )
+    {
+        const EXEC_CAN_Packet_T* packet = &entries[i].packet;
+        if ( !EXEC_CAN_Id_Is_Valid( packet->id, packet->extended )
+             || packet->dlc > EXEC_CAN_MAX_PAYLOAD_SIZE || entries[i].period_ms == 0U
+             || entries[i].phase_ms >= entries[i].period_ms )
+        {
+            return EXEC_CAN_RESULT_INVALID_ARGUMENT;
+        }
+
+        table[i].id        = packet->id;
+        table[i].payload   = packet->data;
+        table[i].period_ms = entries[i].period_ms;
+        table[i].phase_ms  = entries[i].phase_ms;
+        table[i].dlc       = packet->dlc;
+        table[i].extended  = packet->extended;
+    }
+
+    HW_CAN_Result_T result = channel == EXEC_CAN_CHANNEL_1 ? HW_CAN_Cyclic_Start1( table, count )
+                                                           : HW_CAN_Cyclic_Start2( table, count );
+    return EXEC_CAN_Map_Result( result );
+}
+
+EXEC_CAN_Result_T EXEC_CAN_Cyclic_Stop( EXEC_CAN_Channel_T channel )
+{
+    if ( !EXEC_CAN_Channel_Is_Valid( channel ) )
+    {
+        return EXEC_CAN_RESULT_INVALID_ARGUMENT;
+    }
+
+    if ( channel == EXEC_CAN_CHANNEL_1 )
+    {
+        HW_CAN_Cyclic_Stop1();
+    }
+    else
+    {
+        HW_CAN_Cyclic_Stop2();
+    }
+    return EXEC_CAN_RESULT_OK;
+}
+
+EXEC_CAN_Result_T EXEC_CAN_Cyclic_Update_Payload( EXEC_CAN_Channel_T channel, uint16_t index,
+                                                  const uint8_t data[], uint8_t dlc )
+{
+    if ( !EXEC_CAN_Channel_Is_Valid( channel ) || dlc > EXEC_CAN_MAX_PAYLOAD_SIZE
+         || ( data == NULL && dlc > 0U ) )
+    {
+        return EXEC_CAN_RESULT_INVALID_ARGUMENT;
+    }
+
+    HW_CAN_Result_T result = channel == EXEC_CAN_CHANNEL_1
+                                 ? HW_CAN_Cyclic_Update_Payload1( index, data, dlc )
+                                 : HW_CAN_Cyclic_Update_Payload2( index, data, dlc );
+    return result == HW_CAN_RESULT_OK ? EXEC_CAN_RESULT_OK : EXEC_CAN_RESULT_INVALID_ARGUMENT;
+}
+
+EXEC_CAN_Result_T EXEC_CAN_Cyclic_Get_Stats( EXEC_CAN_Channel_T channel, uint16_t index,
+                                             EXEC_CAN_Cyclic_Stats_T* stats )
+{
+    if ( !EXEC_CAN_Channel_Is_Valid( channel ) || stats == NULL )
+    {
+        return EXEC_CAN_RESULT_INVALID_ARGUMENT;
+    }
+
+    HW_CAN_Cyclic_Stats_T hardware_stats = { 0 };
+    HW_CAN_Result_T       result         = channel == EXEC_CAN_CHANNEL_1
+                                               ? HW_CAN_Cyclic_Get_Stats1( index, &hardware_stats )
+                                               : HW_CAN_Cyclic_Get_Stats2( index, &hardware_stats );
+    if ( result != HW_CAN_RESULT_OK )
+    {
+        return EXEC_CAN_RESULT_INVALID_ARGUMENT;
+    }
+
+    stats->sent                = hardware_stats.sent;
+    stats->missed              = hardware_stats.missed;
+    stats->failed              = hardware_stats.failed;
+    stats->min_latency_us      = hardware_stats.min_latency_us;
+    stats->max_latency_us      = hardware_stats.max_latency_us;
+    stats->max_period_error_us = hardware_stats.max_period_error_us;
+    return EXEC_CAN_RESULT_OK;
+}
+
+EXEC_CAN_Result_T EXEC_CAN_Responder_Start( EXEC_CAN_Channel_T               channel,
+                                            const EXEC_CAN_Responder_Entry_T entries[],
+                                            uint16_t                         count )
+{
+    if ( !EXEC_CAN_Channel_Is_Valid( channel ) || ( entries == NULL && count > 0U )
+         || count > EXEC_CAN_MAX_RESPONDER_ENTRIES )
+    {
+        return EXEC_CAN_RESULT_INVALID_ARGUMENT;
+    }
+
+    HW_CAN_Responder_Entry_T table[EXEC_CAN_MAX_RESPONDER_ENTRIES] = { 0 };
+    for ( uint16_t i = 0U; i < count; i++ )
+    {
+        const EXEC_CAN_Packet_T* response = &entries[i].response;
+        if ( entries[i].request_id > EXEC_CAN_STANDARD_ID_MAX
+             || !EXEC_CAN_Id_Is_Valid( response->id, response->extended )
+             || response->dlc > EXEC_CAN_MAX_PAYLOAD_SIZE )
+        {
+            return EXEC_CAN_RESULT_INVALID_ARGUMENT;
+        }
+
+        table[i].request_id        = ( uint16_t )entries[i].request_id;
+        table[i].response_id       = response->id;
+        table[i].response_dlc      = response->dlc;
+        table[i].response_extended = response->extended;
+        memcpy( table[i].request_data, entries[i].request_data, EXEC_CAN_MAX_PAYLOAD_SIZE );
+        memcpy( table[i].request_mask, entries[i].request_mask, EXEC_CAN_MAX_PAYLOAD_SIZE );
+        memcpy( table[i].response_data, response->data, response->dlc );
+    }
+
+    HW_CAN_Result_T result = channel == EXEC_CAN_CHANNEL_1
+                                 ? HW_CAN_Responder_Start1( table, count )
+                                 : HW_CAN_Responder_Start2( table, count );
+    return EXEC_CAN_Map_Result( result );
+}
+
+EXEC_CAN_Result_T EXEC_CAN_Responder_Stop( EXEC_CAN_Channel_T channel )
+{
+    if ( !EXEC_CAN_Channel_Is_Valid( channel ) )
+    {
+        return EXEC_CAN_RESULT_INVALID_ARGUMENT;
+    }
+
+    if ( channel == EXEC_CAN_CHANNEL_1 )
+    {
+        HW_CAN_Responder_Stop1();
+    }
+    else
+    {
+        HW_CAN_Responder_Stop2();
+    }
+    return EXEC_CAN_RESULT_OK;
+}
+
+EXEC_CAN_Result_T EXEC_CAN_Responder_Get_Stats( EXEC_CAN_Channel_T          channel,
+                                                EXEC_CAN_Responder_Stats_T* stats )
+{
+    if ( !EXEC_CAN_Channel_Is_Valid( channel ) || stats == NULL )
+    {
+        return EXEC_CAN_RESULT_INVALID_ARGUMENT;
+    }
+
+    HW_CAN_Responder_Stats_T hardware_stats = { 0 };
+    HW_CAN_Result_T          result         = channel == EXEC_CAN_CHANNEL_1
+                                                  ? HW_CAN_Responder_Get_Stats1( &hardware_stats )
+                                                  : HW_CAN_Responder_Get_Stats2( &hardware_stats );
+    if ( result != HW_CAN_RESULT_OK )
+    {
+        return EXEC_CAN_RESULT_INVALID_ARGUMENT;
+    }
+
+    stats->matched         = hardware_stats.matched;
+    stats->sent            = hardware_stats.sent;
+    stats->missed          = hardware_stats.missed;
+    stats->failed          = hardware_stats.failed;
+    stats->min_latency_us  = hardware_stats.min_latency_us;
+    stats->max_latency_us  = hardware_stats.max_latency_us;
+    stats->last_latency_us = hardware_stats.last_latency_us;
+    return EXEC_CAN_RESULT_OK;
+}
+
+EXEC_CAN_Result_T EXEC_CAN_Replay_Start( EXEC_CAN_Channel_T channel, const uint8_t log[],
+                                         uint32_t length, uint32_t time_scale, uint32_t passes )
+{
+    if ( !EXEC_CAN_Channel_Is_Valid( channel ) || log == NULL )
+    {
+        return EXEC_CAN_RESULT_INVALID_ARGUMENT;
+    }
+
+    HW_CAN_Result_T result = channel == EXEC_CAN_CHANNEL_1
+                                 ? HW_CAN_Replay_Start1( log, length, time_scale, passes )
+                                 : HW_CAN_Replay_Start2( log, length, time_scale, passes );
+    return result == HW_CAN_RESULT_ERROR ? EXEC_CAN_RESULT_INVALID_ARGUMENT
+                                         : EXEC_CAN_Map_Result( result );
+}
+
+EXEC_CAN_Result_T EXEC_CAN_Replay_Stop( EXEC_CAN_Channel_T channel )
+{
+    if ( !EXEC_CAN_Channel_Is_Valid( channel ) )
+    {
+        return EXEC_CAN_RESULT_INVALID_ARGUMENT;
+    }
+
+    if ( channel == EXEC_CAN_CHANNEL_1 )
+    {
+        HW_CAN_Replay_Stop1();
+    }
+    else
+    {
+        HW_CAN_Replay_Stop2();
+    }
+    return EXEC_CAN_RESULT_OK;
+}
+
+EXEC_CAN_Result_T EXEC_CAN_Replay_Get_Stats( EXEC_CAN_Channel_T       channel,
+                                             EXEC_CAN_Replay_Stats_T* stats )
+{
+    if ( !EXEC_CAN_Channel_Is_Valid( channel ) || stats == NULL )
+    {
+        return EXEC_CAN_RESULT_INVALID_ARGUMENT;
+    }
+
+    HW_CAN_Replay_Stats_T hardware_stats = { 0 };
+    HW_CAN_Result_T       result         = channel == EXEC_CAN_CHANNEL_1
+                                               ? HW_CAN_Replay_Get_Stats1( &hardware_stats )
+                                               : HW_CAN_Replay_Get_Stats2( &hardware_stats );
+    if ( result != HW_CAN_RESULT_OK )
+    {
+        return EXEC_CAN_RESULT_INVALID_ARGUMENT;
+    }
+
+    stats->sent           = hardware_stats.sent;
+    stats->failed         = hardware_stats.failed;
+    stats->starved        = hardware_stats.starved;
+    stats->passes         = hardware_stats.passes;
+    stats->min_error_us   = hardware_stats.min_error_us;
+    stats->max_error_us   = hardware_stats.max_error_us;
+    stats->last_error_us  = hardware_stats.last_error_us;
+    stats->total_error_us = hardware_stats.total_error_us;
+    stats->complete       = hardware_stats.complete;
+    return EXEC_CAN_RESULT_OK;
+}
+
+EXEC_CAN_Result_T EXEC_CAN_Get_Bus_Stats( EXEC_CAN_Channel_T channel, EXEC_CAN_Bus_Stats_T* stats )
+{
+    if ( !EXEC_CAN_Channel_Is_Valid( channel ) || stats == NULL )
+    {
+        return EXEC_CAN_RESULT_INVALID_ARGUMENT;
+    }
+
+    HW_CAN_Bus_Stats_T hardware_stats;
+    memset( &hardware_stats, 0, sizeof( hardware_stats ) );
+    HW_CAN_Result_T result = channel == EXEC_CAN_CHANNEL_1
+                                 ? HW_CAN_Bus_Get_Stats1( &hardware_stats )
+                                 : HW_CAN_Bus_Get_Stats2( &hardware_stats );
+    if ( result != HW_CAN_RESULT_OK )
+    {
+        return EXEC_CAN_RESULT_INVALID_ARGUMENT;
+    }
+
+    stats->tx_frames             = hardware_stats.tx_frames;
+    stats->rx_frames             = hardware_stats.rx_frames;
+    stats->bits                  = hardware_stats.bits;
+    stats->stuff_bits            = hardware_stats.stuff_bits;
+    stats->window_us             = hardware_stats.window_us;
+    stats->frames_per_s          = hardware_stats.frames_per_s;
+    stats->bits_per_s            = hardware_stats.bits_per_s;
+    stats->bus_load_permille     = hardware_stats.bus_load_permille;
+    stats->bus_load_max_permille = hardware_stats.bus_load_max_permille;
+    stats->peak_load_permille    = hardware_stats.peak_load_permille;
+    stats->tec                   = hardware_stats.tec;
+    stats->rec                   = hardware_stats.rec;
+    stats->peak_tec              = hardware_stats.peak_tec;
+    stats->peak_rec              = hardware_stats.peak_rec;
+    stats->error_warning         = hardware_stats.error_warning;
+    stats->error_passive         = hardware_stats.error_passive;
+    stats->bus_off               = hardware_stats.bus_off;
+    stats->last_error_code       = hardware_stats.last_error_code;
+    stats->bus_errors            = hardware_stats.bus_errors;
+    stats->arbitration_lost      = hardware_stats.arbitration_lost;
+    stats->tx_errors             = hardware_stats.tx_errors;
+    stats->arbitration_id_count  = hardware_stats.arbitration_id_count;
+    for ( uint8_t i = 0U; i < EXEC_CAN_MAX_ARBITRATION_IDS; i++ )
+    {
+        stats->arbitration_ids[i].id       = hardware_stats.arbitration_ids[i].id;
+        stats->arbitration_ids[i].extended = hardware_stats.arbitration_ids[i].extended;
+        stats->arbitration_ids[i].count    = hardware_stats.arbitration_ids[i].count;
+    }
+    stats->arbitration_untracked = hardware_stats.arbitration_untracked;
+    stats->bus_off_count         = hardware_stats.bus_off_count;
+    stats->last_recovery_us      = hardware_stats.last_recovery_us;
+    stats->max_recovery_us       = hardware_stats.max_recovery_us;
+    stats->rx_dropped            = hardware_stats.rx_dropped;
+    stats->rx_dropped_per_s      = hardware_stats.rx_dropped_per_s;
+    return EXEC_CAN_RESULT_OK;
+}
+
+EXEC_CAN_Result_T EXEC_CAN_Reset_Bus_Stats( EXEC_CAN_Channel_T channel )
+{
+    if ( !EXEC_CAN_Channel_Is_Valid( channel ) )
+    {
+        return EXEC_CAN_RESULT_INVALID_ARGUMENT;
+    }
+
+    if ( channel == EXEC_CAN_CHANNEL_1 )
+    {
+        HW_CAN_Bus_Reset_Stats1();
+    }
+    else
+    {
+        HW_CAN_Bus_Reset_Stats2();
+    }
+    return EXEC_CAN_RESULT_OK;
+}
+
+EXEC_CAN_Result_T EXEC_CAN_Encode_Bus_Stats( EXEC_CAN_Channel_T          channel,
+                                             const EXEC_CAN_Bus_Stats_T* stats, uint8_t buffer[],
+                                             uint16_t capacity, uint16_t* length )
+{
+    if ( !EXEC_CAN_Channel_Is_Valid( channel ) || stats == NULL || buffer == NULL
+         || length == NULL || stats->arbitration_id_count > EXEC_CAN_MAX_ARBITRATION_IDS )
+    {
+        return EXEC_CAN_RESULT_INVALID_ARGUMENT;
+    }
+
+    uint16_t size = ( uint16_t )( EXEC_CAN_BUS_STATS_WIRE_HEADER_SIZE
+                                  + 8U * ( uint16_t )stats->arbitration_id_count );
+    if ( capacity < size )
+    {
+        return EXEC_CAN_RESULT_INVALID_ARGUMENT;
+    }
+
+    uint8_t* cursor = buffer;
+    *cursor++       = EXEC_CAN_BUS_STATS_WIRE_VERSION;
+    *cursor++       = ( uint8_t )channel;
+    *cursor++       = ( uint8_t )( ( stats->error_warning ? 0x01U : 0U )
+                             | ( stats->error_passive ? 0x02U : 0U )
+                             | ( stats->bus_off ? 0x04U : 0U ) );
+    *cursor++       = stats->last_error_code;
+    cursor          = EXEC_CAN_Put_U32( cursor, stats->tx_frames );
+    cursor          = EXEC_CAN_Put_U32( cursor, stats->rx_frames );
+    cursor          = EXEC_CAN_Put_U64( cursor, stats->bits );
+    cursor          = EXEC_CAN_Put_U64( cursor, stats->stuff_bits );
+    cursor          = EXEC_CAN_Put_U32( cursor, stats->window_us );
+    cursor          = EXEC_CAN_Put_U32( cursor, stats->frames_per_s );
+    cursor          = EXEC_CAN_Put_U32( cursor, stats->bits_per_s );
+    cursor          = EXEC_CAN_Put_U16( cursor, stats->bus_load_permille );
+    cursor          = EXEC_CAN_Put_U16( cursor, stats->bus_load_max_permille );
+    cursor          = EXEC_CAN_Put_U16( cursor, stats->peak_load_permille );
+    *cursor++       = stats->tec;
+    *cursor++       = stats->rec;
+    *cursor++       = stats->peak_tec;
+    *cursor++       = stats->peak_rec;
+    *cursor++       = stats->arbitration_id_count;
+    *cursor++       = 0U;
+    cursor          = EXEC_CAN_Put_U32( cursor, stats->bus_errors );
+    cursor          = EXEC_CAN_Put_U32( cursor, stats->arbitration_lost );
+    cursor          = EXEC_CAN_Put_U32( cursor, stats->tx_errors );
+    cursor          = EXEC_CAN_Put_U32( cursor, stats->arbitration_untracked );
+    cursor          = EXEC_CAN_Put_U32( cursor, stats->bus_off_count );
+    cursor          = EXEC_CAN_Put_U32( cursor, stats->last_recovery_us );
+    cursor          = EXEC_CAN_Put_U32( cursor, stats->max_recovery_us );
+    cursor          = EXEC_CAN_Put_U32( cursor, stats->rx_dropped );
+    cursor          = EXEC_CAN_Put_U32( cursor, stats->rx_dropped_per_s );
+    for ( uint8_t i = 0U; i < stats->arbitration_id_count; i++ )
+    {
+        const EXEC_CAN_Arbitration_Count_T* entry = &stats->arbitration_ids[i];
+        cursor = EXEC_CAN_Put_U32( cursor, entry->id | ( entry->extended ? 0x80000000UL : 0U ) );
+        cursor = EXEC_CAN_Put_U32( cursor, entry->count );
+    }
+
+    *length = size;
+    return EXEC_CAN_RESULT_OK;
+}
@@ -25,6 +25,7 @@ extern "C"
  *------------------------------------------------------------------------------
  */
 
+#include <stdbool.h>
 #include <stdint.h>
 
 /**-----------------------------------------------------------------------------
@@ -36,6 +37,25 @@ extern "C"
 /** Usable hardware queue capacity, compile-time checked in exec_can.c. */
 #define EXEC_CAN_MAX_BATCH_SIZE ( 19U )
 #define EXEC_CAN_STANDARD_ID_MAX ( 0x7FFU )
+#define EXEC_CAN_EXTENDED_ID_MAX ( 0x1FFFFFFFU )
+/** Identifier ranges accepted per channel, compile-time checked in exec_can.c. */
+#define EXEC_CAN_MAX_FILTER_RULES ( 16U )
+/** Periodic frames per channel schedule, compile-time checked in exec_can.c. */
+#define EXEC_CAN_MAX_CYCLIC_MESSAGES ( 128U )
+/** Auto-responder entries per channel, compile-time checked in exec_can.c. */
+#define EXEC_CAN_MAX_RESPONDER_ENTRIES ( 32U )
+/** Log replay time scale that keeps the recorded gaps, compile-time checked in exec_can.c. */
+#define EXEC_CAN_REPLAY_TIME_SCALE_UNITY ( 1000U )
+/** Identifiers whose lost arbitrations are counted, compile-time checked in exec_can.c. */
+#define EXEC_CAN_MAX_ARBITRATION_IDS ( 16U )
+/** Bus load of a fully occupied bus in EXEC_CAN_Bus_Stats_T. */
+#define EXEC_CAN_BUS_LOAD_FULL_SCALE ( 1000U )
+/** Version byte at the start of an encoded bus statistics record. */
+#define EXEC_CAN_BUS_STATS_WIRE_VERSION ( 1U )
+/** Encoded bus statistics record without and with a full arbitration table. */
+#define EXEC_CAN_BUS_STATS_WIRE_HEADER_SIZE ( 88U )
+#define EXEC_CAN_BUS_STATS_WIRE_MAX_SIZE                                                           \
+    ( EXEC_CAN_BUS_STATS_WIRE_HEADER_SIZE + 8U * EXEC_CAN_MAX_ARBITRATION_IDS )
 
 /**-----------------------------------------------------------------------------
  *  Public Typedefs / Enums / Structures
@@ -73,31 +93,222 @@ typedef enum EXEC_CAN_Tx_Status_T
     EXEC_CAN_TX_STATUS_INVALID_CHANNEL,
 } EXEC_CAN_Tx_Status_T;
 
-/** Standard classical CAN data frame. */
+/**
+ * Classical CAN data frame. id is an 11-bit standard identifier when extended
+ * is false and a 29-bit extended identifier when extended is true.
+ * timestamp_us is the received frame's start of frame in microseconds on the
+ * shared hardware time base; transmit ignores it.
+ */
 typedef struct EXEC_CAN_Packet_T
 {
-    uint16_t id;
+    uint32_t id;
     uint8_t  dlc;
     uint8_t  data[EXEC_CAN_MAX_PAYLOAD_SIZE];
+    bool     extended;
+    uint32_t timestamp_us;
 } EXEC_CAN_Packet_T;
 
+/**
+ * Inclusive identifier range accepted by a channel filter set. A single
+ * identifier uses first_id == last_id.
+ */
+typedef struct EXEC_CAN_Filter_Rule_T
+{
+    uint32_t first_id;
+    uint32_t last_id;
+    bool     extended;
+} EXEC_CAN_Filter_Rule_T;
+
+/**
+ * Filter banks assigned to one channel. hardware_ids counts accepted
+ * identifiers matched exactly by the banks; software_ids counts accepted
+ * identifiers behind widened banks that the receive path checks in software.
+ */
+typedef struct EXEC_CAN_Filter_Report_T
+{
+    uint8_t  first_bank;
+    uint8_t  bank_count;
+    uint32_t hardware_ids;
+    uint32_t software_ids;
+} EXEC_CAN_Filter_Report_T;
+
+/**
+ * Periodic frame in a cyclic schedule. The frame is first sent phase_ms after
+ * the schedule starts and then every period_ms; phase_ms must be below
+ * period_ms.
+ */
+typedef struct EXEC_CAN_Cyclic_Entry_T
+{
+    EXEC_CAN_Packet_T packet;
+    uint16_t          period_ms;
+    uint16_t          phase_ms;
+} EXEC_CAN_Cyclic_Entry_T;
+
+/**
+ * Timing statistics of one periodic frame. Latency runs from the scheduled
+ * release to the frame's start on the bus, so max_latency_us - min_latency_us
+ * is the release jitter; max_period_error_us is the worst deviation of the
+ * interval between consecutive sends from the period.
+ */
+typedef struct EXEC_CAN_Cyclic_Stats_T
+{
+    uint32_t sent;
+    uint32_t missed;
+    uint32_t failed;
+    uint32_t min_latency_us;
+    uint32_t max_latency_us;
+    uint32_t max_period_error_us;
+} EXEC_CAN_Cyclic_Stats_T;
+
+/**
+ * Request and prepared response for the auto-responder. A standard frame with
+ * identifier request_id matches when every bit set in request_mask has the
+ * same value in its payload as in request_data; an all-zero mask matches any
+ * payload. The response is sent from the receive interrupt.
+ */
+typedef struct EXEC_CAN_Responder_Entry_T
+{
+    uint32_t          request_id;
+    uint8_t           request_data[EXEC_CAN_MAX_PAYLOAD_SIZE];
+    uint8_t           request_mask[EXEC_CAN_MAX_PAYLOAD_SIZE];
+    EXEC_CAN_Packet_T response;
+} EXEC_CAN_Responder_Entry_T;
+
+/**
+ * Turnaround statistics of one channel's auto-responder. Latency runs from the
+ * request's start of frame to the response's start of frame; missed counts
+ * matches dropped while earlier responses still waited for the mailbox.
+ */
+typedef struct EXEC_CAN_Responder_Stats_T
+{
+    uint32_t matched;
+    uint32_t sent;
+    uint32_t missed;
+    uint32_t failed;
+    uint32_t min_latency_us;
+    uint32_t max_latency_us;
+    uint32_t last_latency_us;
+} EXEC_CAN_Responder_Stats_T;
+
+/**
+ * Progress and timing of one channel's log replay. The schedule error of a
+ * frame is its start of frame minus its due time, so a positive error is a
+ * late frame. starved counts frames that fell due while the replay's mailbox
+ * still held the previous frame. passes counts finished passes through the
+ * log and complete is set once the last frame of the last pass has gone.
+ */
+typedef struct EXEC_CAN_Replay_Stats_T
+{
+    uint32_t sent;
+    uint32_t failed;
+    uint32_t starved;
+    uint32_t passes;
+    int32_t  min_error_us;
+    int32_t  max_error_us;
+    int32_t  last_error_us;
+    int64_t  total_error_us;
+    bool     complete;
+} EXEC_CAN_Replay_Stats_T;
+
+/** Lost arbitrations of one identifier this node transmitted. */
+typedef struct EXEC_CAN_Arbitration_Count_T
+{
+    uint32_t id;
+    bool     extended;
+    uint32_t count;
+} EXEC_CAN_Arbitration_Count_T;
+
+/**
+ * Traffic, bus load, error and arbitration statistics of one channel.
+ *
+ * Frames this channel sent or accepted through its hardware filters are
+ * counted from configuration or the last reset. Rates come from the last
+ * window of about one second, window_us long. Stuff bits are not visible to
+ * software, so bus_load_permille, without them, is a lower bound and
+ * bus_load_max_permille, with the worst case, an upper bound; both are in
+ * thousandths of EXEC_CAN_BUS_LOAD_FULL_SCALE. peak_load_permille is the
+ * highest upper bound of any window.
+ *
+ * tec, rec and the three state flags are read when the statistics are taken.
+ * Lost arbitrations are counted per identifier for the first
+ * EXEC_CAN_MAX_ARBITRATION_IDS identifiers and in arbitration_untracked after
+ * that. Recovery times run from the bus-off interrupt to the first frame or
+ * snapshot after the controller is back on the bus. rx_dropped counts frames
+ * lost to a full receive queue, and FIFO overruns.
+ */
+typedef struct EXEC_CAN_Bus_Stats_T
+{
+    uint32_t                     tx_frames;
+    uint32_t                     rx_frames;
+    uint64_t                     bits;
+    uint64_t                     stuff_bits;
+    uint32_t                     window_us;
+    uint32_t                     frames_per_s;
+    uint32_t                     bits_per_s;
+    uint16_t                     bus_load_permille;
+    uint16_t                     bus_load_max_permille;
+    uint16_t                     peak_load_permille;
+    uint8_t                      tec;
+    uint8_t                      rec;
+    uint8_t                      peak_tec;
+    uint8_t                      peak_rec;
+    bool                         error_warning;
+    bool                         error_passive;
+    bool                         bus_off;
+    uint8_t                      last_error_code;
+    uint32_t                     bus_errors;
+    uint32_t                     arbitration_lost;
+    uint32_t                     tx_errors;
+    uint8_t                      arbitration_id_count;
+    EXEC_CAN_Arbitration_Count_T arbitration_ids[EXEC_CAN_MAX_ARBITRATION_IDS];
+    uint32_t                     arbitration_untracked;
+    uint32_t                     bus_off_count;
+    uint32_t                     last_recovery_us;
+    uint32_t                     max_recovery_us;
+    uint32_t                     rx_dropped;
+    uint32_t                     rx_dropped_per_s;
+} EXEC_CAN_Bus_Stats_T;
+
 /**-----------------------------------------------------------------------------
  *  Public Function Prototypes
  *------------------------------------------------------------------------------
  */
 
-/** Configure one CAN channel using a standard-ID acceptance filter. */
+/**
+ * @brief Configure one CAN channel with a single ID/mask acceptance filter.
+ *
+ * filter_extended selects whether the filter matches 29-bit extended frames or
+ * 11-bit standard frames; filter_id and filter_mask must fit that format.
+ */
 EXEC_CAN_Result_T EXEC_CAN_Configure( EXEC_CAN_Channel_T channel, uint32_t bitrate,
-                                      uint16_t filter_bank, uint16_t filter_id,
-                                      uint16_t filter_mask );
+                                      uint16_t filter_bank, uint32_t filter_id,
+                                      uint32_t filter_mask, bool filter_extended );
+
+/**
+ * @brief Replace one channel's acceptance filters with a set of identifier ranges.
+ *
+ * The 28 shared filter banks are repacked and re-split between both
+ * channels, so the other channel's report may change too. Call after both
+ * channels are configured. An empty set stops the channel receiving frames.
+ * Invalid channels, null rules with a nonzero count, more than
+ * EXEC_CAN_MAX_FILTER_RULES rules, inverted ranges, and identifiers that do
+ * not fit their format return EXEC_CAN_RESULT_INVALID_ARGUMENT.
+ */
+EXEC_CAN_Result_T EXEC_CAN_Set_Filters( EXEC_CAN_Channel_T           channel,
+                                        const EXEC_CAN_Filter_Rule_T rules[], uint16_t rule_count );
+
+/** Copy the current filter bank report for one CAN channel. */
+EXEC_CAN_Result_T EXEC_CAN_Get_Filter_Report( EXEC_CAN_Channel_T        channel,
+                                              EXEC_CAN_Filter_Report_T* report );
 
 /**
  * @brief Load and start one complete CAN transmit batch.
  *
  * The hardware trigger is called exactly once and only after the complete
  * batch has loaded successfully. A trigger failure discards the loaded batch.
- * Null storage, zero or oversized batches, extended identifiers, and DLCs
- * greater than eight return EXEC_CAN_RESULT_INVALID_ARGUMENT.
+ * Null storage, zero or oversized batches, identifiers that do not fit their
+ * standard or extended format, and DLCs greater than eight return
+ * EXEC_CAN_RESULT_INVALID_ARGUMENT.
  */
 EXEC_CAN_Result_T EXEC_CAN_Transmit( EXEC_CAN_Channel_T channel, const EXEC_CAN_Packet_T packets[],
                                      uint16_t packet_count );
@@ -125,6 +336,137 @@ EXEC_CAN_Result_T EXEC_CAN_Recover( EXEC_CAN_Channel_T channel );
 /** Return the sticky software RX dropped-frame count for one CAN channel. */
 uint32_t EXEC_CAN_Get_Rx_Dropped_Count( EXEC_CAN_Channel_T channel );
 
+/**
+ * @brief Copy the start of frame of the last acknowledged batch frame.
+ *
+ * The timestamp shares the time base of received packets' timestamp_us, so a
+ * response's timestamp minus this one is the DUT response latency. Invalid
+ * channels and a null destination return EXEC_CAN_RESULT_INVALID_ARGUMENT; no
+ * batch frame acknowledged since the last configure or recovery returns
+ * EXEC_CAN_RESULT_EMPTY.
+ */
+EXEC_CAN_Result_T EXEC_CAN_Get_Tx_Timestamp( EXEC_CAN_Channel_T channel, uint32_t* timestamp_us );
+
+/**
+ * @brief Start sending a table of periodic frames on one CAN channel.
+ *
+ * The table is copied. While the schedule runs it owns one of the three
+ * hardware transmit mailboxes, so batches and single frames still go out
+ * alongside it. Null entries with a nonzero count, more than
+ * EXEC_CAN_MAX_CYCLIC_MESSAGES entries, invalid identifiers or DLCs, zero
+ * periods, and phases not below their period return
+ * EXEC_CAN_RESULT_INVALID_ARGUMENT. A schedule already running, or whose last
+ * frame is still in flight, returns EXEC_CAN_RESULT_BUSY.
+ *
+ * The entries are converted in a static table, so only one task may start
+ * schedules.
+ */
+EXEC_CAN_Result_T EXEC_CAN_Cyclic_Start( EXEC_CAN_Channel_T            channel,
+                                         const EXEC_CAN_Cyclic_Entry_T entries[], uint16_t count );
+
+/** Stop one channel's cyclic schedule; the frame in flight is allowed to finish. */
+EXEC_CAN_Result_T EXEC_CAN_Cyclic_Stop( EXEC_CAN_Channel_T channel );
+
+/**
+ * @brief Replace the payload of one periodic frame.
+ *
+ * index is the entry's position in the started table. The next release sends
+ * the new payload whole; the transmit interrupts never wait on the update.
+ */
+EXEC_CAN_Result_T EXEC_CAN_Cyclic_Update_Payload( EXEC_CAN_Channel_T channel, uint16_t index,
+                                                  const uint8_t data[], uint8_t dlc );
+
+/** Copy the timing statistics of one periodic frame. */
+EXEC_CAN_Result_T EXEC_CAN_Cyclic_Get_Stats( EXEC_CAN_Channel_T channel, uint16_t index,
+                                             EXEC_CAN_Cyclic_Stats_T* stats );
+
+/**
+ * @brief Start answering requests on one CAN channel from a response table.
+ *
+ * The table is copied. Matching runs in the receive interrupt and the response
+ * goes straight to a transmit mailbox the responder keeps for itself, so the
+ * answer never waits for the execution tick. Requests are still delivered by
+ * EXEC_CAN_Receive. Null entries with a nonzero count, more than
+ * EXEC_CAN_MAX_RESPONDER_ENTRIES entries, request identifiers above
+ * EXEC_CAN_STANDARD_ID_MAX, and invalid response identifiers or DLCs return
+ * EXEC_CAN_RESULT_INVALID_ARGUMENT. A responder already running, or whose last
+ * response is still in flight, returns EXEC_CAN_RESULT_BUSY.
+ */
+EXEC_CAN_Result_T EXEC_CAN_Responder_Start( EXEC_CAN_Channel_T               channel,
+                                            const EXEC_CAN_Responder_Entry_T entries[],
+                                            uint16_t                         count );
+
+/** Stop one channel's responder; queued responses are dropped, one in flight finishes. */
+EXEC_CAN_Result_T EXEC_CAN_Responder_Stop( EXEC_CAN_Channel_T channel );
+
+/** Copy one channel's responder turnaround statistics. */
+EXEC_CAN_Result_T EXEC_CAN_Responder_Get_Stats( EXEC_CAN_Channel_T          channel,
+                                                EXEC_CAN_Responder_Stats_T* stats );
+
+/**
+ * @brief Start replaying a compact timestamped log on one CAN channel.
+ *
+ * The log is read in place, from RAM or memory-mapped flash, and must stay
+ * unchanged until the replay completes or is stopped; its format is described
+ * in hw_can_replay.h. Frames are paced by a hardware timer and use the
+ * cyclic schedule's transmit mailbox, so batches still run alongside.
+ * Recorded gaps are multiplied by time_scale / EXEC_CAN_REPLAY_TIME_SCALE_UNITY;
+ * passes is the number of times through the log, zero to loop until stopped.
+ * A malformed log or an out-of-range time scale returns
+ * EXEC_CAN_RESULT_INVALID_ARGUMENT; a replay or cyclic schedule already
+ * holding the mailbox returns EXEC_CAN_RESULT_BUSY.
+ */
+EXEC_CAN_Result_T EXEC_CAN_Replay_Start( EXEC_CAN_Channel_T channel, const uint8_t log[],
+                                         uint32_t length, uint32_t time_scale, uint32_t passes );
+
+/** Stop one channel's log replay; the frame in flight is allowed to finish. */
+EXEC_CAN_Result_T EXEC_CAN_Replay_Stop( EXEC_CAN_Channel_T channel );
+
+/** Copy one channel's log replay statistics. */
+EXEC_CAN_Result_T EXEC_CAN_Replay_Get_Stats( EXEC_CAN_Channel_T       channel,
+                                             EXEC_CAN_Replay_Stats_T* stats );
+
+/**
+ * @brief Copy one channel's traffic, bus load, error and arbitration statistics.
+ *
+ * Taking the statistics closes the rate window once it is due, so call about
+ * once a second for current rates.
+ */
+EXEC_CAN_Result_T EXEC_CAN_Get_Bus_Stats( EXEC_CAN_Channel_T channel, EXEC_CAN_Bus_Stats_T* stats );
+
+/** Clear one channel's bus statistics; the RX dropped-frame count is kept. */
+EXEC_CAN_Result_T EXEC_CAN_Reset_Bus_Stats( EXEC_CAN_Channel_T channel );
+
+/**
+ * @brief Encode bus statistics as the host protocol's fixed little-endian record.
+ *
+ * Offsets, fields little endian:
+ *
+ *     0   version, EXEC_CAN_BUS_STATS_WIRE_VERSION
+ *     1   channel, 0 or 1
+ *     2   flags: bit 0 error warning, bit 1 error passive, bit 2 bus-off
+ *     3   last_error_code
+ *     4   tx_frames u32, 8 rx_frames u32, 12 bits u64, 20 stuff_bits u64
+ *     28  window_us u32, 32 frames_per_s u32, 36 bits_per_s u32
+ *     40  bus_load_permille u16, 42 bus_load_max_permille u16,
+ *         44 peak_load_permille u16
+ *     46  tec, rec, peak_tec, peak_rec, arbitration_id_count, one zero byte
+ *     52  bus_errors, arbitration_lost, tx_errors, arbitration_untracked,
+ *         bus_off_count, last_recovery_us, max_recovery_us, rx_dropped,
+ *         rx_dropped_per_s, u32 each
+ *     88  arbitration_id_count entries of id u32, bit 31 set for an
+ *         extended identifier, then count u32
+ *
+ * A capacity below the record's length returns
+ * EXEC_CAN_RESULT_INVALID_ARGUMENT; EXEC_CAN_BUS_STATS_WIRE_MAX_SIZE always
+ * fits.
+ *
+ * @param length Receives the number of bytes written.
+ */
+EXEC_CAN_Result_T EXEC_CAN_Encode_Bus_Stats( EXEC_CAN_Channel_T          channel,
+                                             const EXEC_CAN_Bus_Stats_T* stats, uint8_t buffer[],
+                                             uint16_t capacity, uint16_t* length );
+
 #ifdef __cplusplus
 }
 #endif
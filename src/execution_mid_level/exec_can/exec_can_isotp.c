@@ -0,0 +1,617 @@
+/******************************************************************************
+ *  File:       exec_can_isotp.c
+ *  Author:     Timothy Vogelsang
+ *  Created:    18-Oct-2026
+ *
+ *  Description:
+ *      ISO 15765-2 segmentation, reassembly and flow control on top of the
+ *      execution-layer CAN batches.
+ *
+ *  Notes:
+ *      A link has at most one transmit batch in flight, holding either its
+ *      own flow control or data frames, and waits for the channel's status to
+ *      leave active before loading the next. Flow control goes first so a
+ *      message being received is never held up by one being sent.
+ ******************************************************************************/
+
+/**-----------------------------------------------------------------------------
+ *  Includes
+ *------------------------------------------------------------------------------
+ */
+
+#include "exec_can_isotp.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+/**-----------------------------------------------------------------------------
+ *  Defines / Macros
+ *------------------------------------------------------------------------------
+ */
+
+/* Protocol control information, high nibble of the first data byte. */
+#define EXEC_CAN_ISOTP_PCI_SINGLE ( 0x0U )
+#define EXEC_CAN_ISOTP_PCI_FIRST ( 0x1U )
+#define EXEC_CAN_ISOTP_PCI_CONSECUTIVE ( 0x2U )
+#define EXEC_CAN_ISOTP_PCI_FLOW_CONTROL ( 0x3U )
+
+#define EXEC_CAN_ISOTP_FLOW_CONTINUE ( 0x0U )
+#define EXEC_CAN_ISOTP_FLOW_WAIT ( 0x1U )
+#define EXEC_CAN_ISOTP_FLOW_OVERFLOW ( 0x2U )
+#define EXEC_CAN_ISOTP_FLOW_NONE ( 0xFFU )
+
+#define EXEC_CAN_ISOTP_SINGLE_DATA ( 7U )
+#define EXEC_CAN_ISOTP_FIRST_DATA ( 6U )
+#define EXEC_CAN_ISOTP_CONSECUTIVE_DATA ( 7U )
+#define EXEC_CAN_ISOTP_SEQUENCE_MASK ( 0x0FU )
+
+/* Block size zero lets the sender run to the end of the message. */
+#define EXEC_CAN_ISOTP_UNLIMITED_BLOCK ( 0xFFFFU )
+
+#define EXEC_CAN_ISOTP_ST_MIN_MAX_MS ( 0x7FU )
+#define EXEC_CAN_ISOTP_ST_MIN_US_FIRST ( 0xF1U )
+#define EXEC_CAN_ISOTP_ST_MIN_US_LAST ( 0xF9U )
+
+/**-----------------------------------------------------------------------------
+ *  Private Typedefs / Enums / Structures
+ *------------------------------------------------------------------------------
+ */
+
+typedef enum EXEC_CAN_Isotp_In_Flight_T
+{
+    EXEC_CAN_ISOTP_IN_FLIGHT_NONE = 0,
+    EXEC_CAN_ISOTP_IN_FLIGHT_DATA,
+    EXEC_CAN_ISOTP_IN_FLIGHT_FLOW_CONTROL,
+} EXEC_CAN_Isotp_In_Flight_T;
+
+typedef enum EXEC_CAN_Isotp_Tx_Stage_T
+{
+    EXEC_CAN_ISOTP_TX_IDLE = 0,
+    EXEC_CAN_ISOTP_TX_FIRST,
+    EXEC_CAN_ISOTP_TX_WAIT_FLOW_CONTROL,
+    EXEC_CAN_ISOTP_TX_CONSECUTIVE,
+    EXEC_CAN_ISOTP_TX_LAST_IN_FLIGHT,
+} EXEC_CAN_Isotp_Tx_Stage_T;
+
+typedef enum EXEC_CAN_Isotp_Rx_Stage_T
+{
+    EXEC_CAN_ISOTP_RX_IDLE = 0,
+    EXEC_CAN_ISOTP_RX_ARMED,
+    EXEC_CAN_ISOTP_RX_CONSECUTIVE,
+} EXEC_CAN_Isotp_Rx_Stage_T;
+
+/**-----------------------------------------------------------------------------
+ *  Private Function Definitions
+ *------------------------------------------------------------------------------
+ */
+
+static bool EXEC_CAN_Isotp_St_Min_Is_Valid( uint8_t st_min )
+{
+    return st_min <= EXEC_CAN_ISOTP_ST_MIN_MAX_MS
+           || ( st_min >= EXEC_CAN_ISOTP_ST_MIN_US_FIRST
+                && st_min <= EXEC_CAN_ISOTP_ST_MIN_US_LAST );
+}
+
+static uint32_t EXEC_CAN_Isotp_St_Min_Us( uint8_t st_min )
+{
+    if ( st_min <= EXEC_CAN_ISOTP_ST_MIN_MAX_MS )
+    {
+        return ( uint32_t )st_min * 1000U;
+    }
+    if ( st_min >= EXEC_CAN_ISOTP_ST_MIN_US_FIRST && st_min <= EXEC_CAN_ISOTP_ST_MIN_US_LAST )
+    {
+        return ( uint32_t )( st_min - 0xF0U ) * 100U;
+    }
+
+    // reserved values must be read as the longest separation
+    return EXEC_CAN_ISOTP_ST_MIN_MAX_MS * 1000U;
+}
+
+static bool EXEC_CAN_Isotp_Elapsed( uint32_t now_us, uint32_t since_us, uint32_t duration_us )
+{
+    // signed so a time taken just before since_us does not read as a wrap
+    return ( int32_t )( now_us - since_us ) >= ( int32_t )duration_us;
+}
+
+static void EXEC_CAN_Isotp_Build_Frame( const EXEC_CAN_Isotp_Link_T* link,
+                                        EXEC_CAN_Packet_T* packet, const uint8_t header[],
+                                        uint8_t header_length, const uint8_t data[],
+                                        uint8_t data_length )
+{
+    packet->id       = link->config.tx_id;
+    packet->extended = link->config.extended;
+    packet->dlc      = ( uint8_t )( header_length + data_length );
+    memcpy( packet->data, header, header_length );
+    if ( data_length > 0U )
+    {
+        memcpy( &packet->data[header_length], data, data_length );
+    }
+
+    if ( link->config.padding )
+    {
+        memset( &packet->data[packet->dlc], link->config.padding_byte,
+                EXEC_CAN_MAX_PAYLOAD_SIZE - packet->dlc );
+        packet->dlc = EXEC_CAN_MAX_PAYLOAD_SIZE;
+    }
+}
+
+static void EXEC_CAN_Isotp_Tx_Finish( EXEC_CAN_Isotp_Link_T* link, EXEC_CAN_Isotp_Status_T status )
+{
+    link->tx_stage  = EXEC_CAN_ISOTP_TX_IDLE;
+    link->tx_status = status;
+    link->tx_data   = NULL;
+}
+
+static void EXEC_CAN_Isotp_Rx_Finish( EXEC_CAN_Isotp_Link_T* link, EXEC_CAN_Isotp_Status_T status )
+{
+    link->rx_stage  = EXEC_CAN_ISOTP_RX_IDLE;
+    link->rx_status = status;
+}
+
+/* Settles the batch in flight. Returns false while the channel is still sending it. */
+static bool EXEC_CAN_Isotp_Settle_In_Flight( EXEC_CAN_Isotp_Link_T* link, uint32_t now_us )
+{
+    if ( link->in_flight == EXEC_CAN_ISOTP_IN_FLIGHT_NONE )
+    {
+        return true;
+    }
+
+    EXEC_CAN_Tx_Status_T status = EXEC_CAN_Get_Tx_Status( link->config.channel );
+    if ( status == EXEC_CAN_TX_STATUS_ACTIVE )
+    {
+        return false;
+    }
+
+    bool failed = status == EXEC_CAN_TX_STATUS_ERROR;
+    if ( link->in_flight == EXEC_CAN_ISOTP_IN_FLIGHT_DATA )
+    {
+        if ( failed )
+        {
+            EXEC_CAN_Isotp_Tx_Finish( link, EXEC_CAN_ISOTP_STATUS_ERROR );
+        }
+        else if ( link->tx_stage == EXEC_CAN_ISOTP_TX_LAST_IN_FLIGHT )
+        {
+            EXEC_CAN_Isotp_Tx_Finish( link, EXEC_CAN_ISOTP_STATUS_COMPLETE );
+        }
+
+        // STmin runs from the end of the previous frame, which is before now_us
+        link->tx_next_us = now_us + link->tx_st_min_us;
+    }
+    else if ( failed && link->rx_status == EXEC_CAN_ISOTP_STATUS_BUSY )
+    {
+        EXEC_CAN_Isotp_Rx_Finish( link, EXEC_CAN_ISOTP_STATUS_ERROR );
+    }
+
+    link->in_flight = EXEC_CAN_ISOTP_IN_FLIGHT_NONE;
+    return true;
+}
+
+static void EXEC_CAN_Isotp_Expire( EXEC_CAN_Isotp_Link_T* link, uint32_t now_us )
+{
+    if ( link->tx_stage == EXEC_CAN_ISOTP_TX_WAIT_FLOW_CONTROL
+         && EXEC_CAN_Isotp_Elapsed( now_us, link->tx_since_us, link->config.timeout_us ) )
+    {
+        EXEC_CAN_Isotp_Tx_Finish( link, EXEC_CAN_ISOTP_STATUS_TIMEOUT );
+    }
+
+    // the sender's clock only starts once our flow control has gone out
+    if ( link->rx_stage == EXEC_CAN_ISOTP_RX_CONSECUTIVE
+         && link->rx_flow_status == EXEC_CAN_ISOTP_FLOW_NONE
+         && link->in_flight != EXEC_CAN_ISOTP_IN_FLIGHT_FLOW_CONTROL
+         && EXEC_CAN_Isotp_Elapsed( now_us, link->rx_since_us, link->config.timeout_us ) )
+    {
+        EXEC_CAN_Isotp_Rx_Finish( link, EXEC_CAN_ISOTP_STATUS_TIMEOUT );
+    }
+}
+
+static void EXEC_CAN_Isotp_Send_Flow_Control( EXEC_CAN_Isotp_Link_T* link, uint32_t now_us )
+{
+    uint8_t           header[3] = { ( uint8_t )( ( EXEC_CAN_ISOTP_PCI_FLOW_CONTROL << 4 )
+                                                 | link->rx_flow_status ),
+                                    link->config.block_size, link->config.st_min };
+    EXEC_CAN_Packet_T packet    = { 0 };
+    EXEC_CAN_Isotp_Build_Frame( link, &packet, header, sizeof( header ), NULL, 0U );
+
+    EXEC_CAN_Result_T result = EXEC_CAN_Transmit( link->config.channel, &packet, 1U );
+    if ( result == EXEC_CAN_RESULT_BUSY )
+    {
+        return;
+    }
+
+    link->rx_flow_status = EXEC_CAN_ISOTP_FLOW_NONE;
+    if ( result != EXEC_CAN_RESULT_OK )
+    {
+        if ( link->rx_status == EXEC_CAN_ISOTP_STATUS_BUSY )
+        {
+            EXEC_CAN_Isotp_Rx_Finish( link, EXEC_CAN_ISOTP_STATUS_ERROR );
+        }
+        return;
+    }
+
+    link->in_flight   = EXEC_CAN_ISOTP_IN_FLIGHT_FLOW_CONTROL;
+    link->rx_since_us = now_us;
+}
+
+static void EXEC_CAN_Isotp_Send_First( EXEC_CAN_Isotp_Link_T* link, uint32_t now_us )
+{
+    EXEC_CAN_Packet_T packet = { 0 };
+    uint16_t          taken  = 0U;
+
+    if ( link->tx_length <= EXEC_CAN_ISOTP_SINGLE_DATA )
+    {
+        uint8_t header[1] = { ( uint8_t )( ( EXEC_CAN_ISOTP_PCI_SINGLE << 4 ) | link->tx_length ) };
+        taken             = link->tx_length;
+        EXEC_CAN_Isotp_Build_Frame( link, &packet, header, sizeof( header ), link->tx_data,
+                                    ( uint8_t )taken );
+    }
+    else
+    {
+        uint8_t header[2] = {
+            ( uint8_t )( ( EXEC_CAN_ISOTP_PCI_FIRST << 4 ) | ( link->tx_length >> 8 ) ),
+            ( uint8_t )( link->tx_length & 0xFFU ),
+        };
+        taken             = EXEC_CAN_ISOTP_FIRST_DATA;
+        EXEC_CAN_Isotp_Build_Frame( link, &packet, header, sizeof( header ), link->tx_data,
+                                    ( uint8_t )taken );
+    }
+
+    EXEC_CAN_Result_T result = EXEC_CAN_Transmit( link->config.channel, &packet, 1U );
+    if ( result == EXEC_CAN_RESULT_BUSY )
+    {
+        return;
+    }
+    if ( result != EXEC_CAN_RESULT_OK )
+    {
+        EXEC_CAN_Isotp_Tx_Finish( link, EXEC_CAN_ISOTP_STATUS_ERROR );
+        return;
+    }
+
+    link->in_flight   = EXEC_CAN_ISOTP_IN_FLIGHT_DATA;
+    link->tx_offset   = taken;
+    link->tx_sequence = 1U;
+    link->tx_since_us = now_us;
+    link->tx_stage    = taken == link->tx_length ? EXEC_CAN_ISOTP_TX_LAST_IN_FLIGHT
+                                                 : EXEC_CAN_ISOTP_TX_WAIT_FLOW_CONTROL;
+}
+
+static void EXEC_CAN_Isotp_Send_Consecutive( EXEC_CAN_Isotp_Link_T* link, uint32_t now_us )
+{
+    if ( link->tx_st_min_us > 0U && !EXEC_CAN_Isotp_Elapsed( now_us, link->tx_next_us, 0U ) )
+    {
+        return;
+    }
+
+    // a separation time leaves the pacing to this loop, one frame per batch
+    uint16_t remaining = link->tx_length - link->tx_offset;
+    uint16_t frames    = ( uint16_t )( ( remaining + EXEC_CAN_ISOTP_CONSECUTIVE_DATA - 1U )
+                                    / EXEC_CAN_ISOTP_CONSECUTIVE_DATA );
+    uint16_t limit     = link->tx_st_min_us > 0U ? 1U : EXEC_CAN_MAX_BATCH_SIZE;
+    if ( frames > limit )
+    {
+        frames = limit;
+    }
+    if ( frames > link->tx_block_remaining )
+    {
+        frames = link->tx_block_remaining;
+    }
+
+    EXEC_CAN_Packet_T packets[EXEC_CAN_MAX_BATCH_SIZE] = { 0 };
+    uint16_t          offset                           = link->tx_offset;
+    uint8_t           sequence                         = link->tx_sequence;
+    for ( uint16_t i = 0U; i < frames; i++ )
+    {
+        uint16_t left    = link->tx_length - offset;
+        uint8_t  length  = ( uint8_t )( left < EXEC_CAN_ISOTP_CONSECUTIVE_DATA
+                                            ? left
+                                            : EXEC_CAN_ISOTP_CONSECUTIVE_DATA );
+        uint8_t header[1] = { ( uint8_t )( ( EXEC_CAN_ISOTP_PCI_CONSECUTIVE << 4 ) | sequence ) };
+        EXEC_CAN_Isotp_Build_Frame( link, &packets[i], header, sizeof( header ),
+                                    &link->tx_data[offset], length );
+        offset   = ( uint16_t )( offset + length );
+        sequence = ( uint8_t )( ( sequence + 1U ) & EXEC_CAN_ISOTP_SEQUENCE_MASK );
+    }
+
+    EXEC_CAN_Result_T result = EXEC_CAN_Transmit( link->config.channel, packets, frames );
+    if ( result == EXEC_CAN_RESULT_BUSY )
+    {
+        return;
+    }
+    if ( result != EXEC_CAN_RESULT_OK )
+    {
+        EXEC_CAN_Isotp_Tx_Finish( link, EXEC_CAN_ISOTP_STATUS_ERROR );
+        return;
+    }
+
+    link->in_flight   = EXEC_CAN_ISOTP_IN_FLIGHT_DATA;
+    link->tx_offset   = offset;
+    link->tx_sequence = sequence;
+    if ( link->tx_block_remaining != EXEC_CAN_ISOTP_UNLIMITED_BLOCK )
+    {
+        link->tx_block_remaining = ( uint16_t )( link->tx_block_remaining - frames );
+    }
+
+    if ( offset == link->tx_length )
+    {
+        link->tx_stage = EXEC_CAN_ISOTP_TX_LAST_IN_FLIGHT;
+    }
+    else if ( link->tx_block_remaining == 0U )
+    {
+        link->tx_stage    = EXEC_CAN_ISOTP_TX_WAIT_FLOW_CONTROL;
+        link->tx_since_us = now_us;
+    }
+}
+
+static void EXEC_CAN_Isotp_Rx_Single( EXEC_CAN_Isotp_Link_T* link, const EXEC_CAN_Packet_T* packet )
+{
+    uint8_t length = packet->data[0] & 0x0FU;
+    if ( length == 0U || length > EXEC_CAN_ISOTP_SINGLE_DATA || length >= packet->dlc )
+    {
+        return;
+    }
+
+    // a new message replaces one still being reassembled
+    link->rx_flow_status = EXEC_CAN_ISOTP_FLOW_NONE;
+    link->rx_length      = length;
+    if ( length > link->rx_capacity )
+    {
+        EXEC_CAN_Isotp_Rx_Finish( link, EXEC_CAN_ISOTP_STATUS_OVERFLOW );
+        return;
+    }
+
+    memcpy( link->rx_buffer, &packet->data[1], length );
+    link->rx_offset = length;
+    EXEC_CAN_Isotp_Rx_Finish( link, EXEC_CAN_ISOTP_STATUS_COMPLETE );
+}
+
+static void EXEC_CAN_Isotp_Rx_First( EXEC_CAN_Isotp_Link_T* link, const EXEC_CAN_Packet_T* packet )
+{
+    if ( packet->dlc != EXEC_CAN_MAX_PAYLOAD_SIZE )
+    {
+        return;
+    }
+
+    // zero announces a 32-bit length, which is above what this link takes
+    uint16_t length = ( uint16_t )( ( ( packet->data[0] & 0x0FU ) << 8 ) | packet->data[1] );
+    if ( length != 0U && length <= EXEC_CAN_ISOTP_SINGLE_DATA )
+    {
+        return;
+    }
+
+    link->rx_length = length;
+    if ( length == 0U || length > link->rx_capacity )
+    {
+        link->rx_flow_status = EXEC_CAN_ISOTP_FLOW_OVERFLOW;
+        EXEC_CAN_Isotp_Rx_Finish( link, EXEC_CAN_ISOTP_STATUS_OVERFLOW );
+        return;
+    }
+
+    memcpy( link->rx_buffer, &packet->data[2], EXEC_CAN_ISOTP_FIRST_DATA );
+    link->rx_offset      = EXEC_CAN_ISOTP_FIRST_DATA;
+    link->rx_sequence    = 1U;
+    link->rx_block_count = 0U;
+    link->rx_since_us    = packet->timestamp_us;
+    link->rx_flow_status = EXEC_CAN_ISOTP_FLOW_CONTINUE;
+    link->rx_stage       = EXEC_CAN_ISOTP_RX_CONSECUTIVE;
+    link->rx_status      = EXEC_CAN_ISOTP_STATUS_BUSY;
+}
+
+static void EXEC_CAN_Isotp_Rx_Consecutive( EXEC_CAN_Isotp_Link_T*   link,
+                                           const EXEC_CAN_Packet_T* packet )
+{
+    uint16_t left   = link->rx_length - link->rx_offset;
+    uint8_t  length = ( uint8_t )( left < EXEC_CAN_ISOTP_CONSECUTIVE_DATA
+                                       ? left
+                                       : EXEC_CAN_ISOTP_CONSECUTIVE_DATA );
+    if ( ( packet->data[0] & EXEC_CAN_ISOTP_SEQUENCE_MASK ) != link->rx_sequence
+         || packet->dlc <= length )
+    {
+        link->rx_flow_status = EXEC_CAN_ISOTP_FLOW_NONE;
+        EXEC_CAN_Isotp_Rx_Finish( link, EXEC_CAN_ISOTP_STATUS_PROTOCOL_ERROR );
+        return;
+    }
+
+    memcpy( &link->rx_buffer[link->rx_offset], &packet->data[1], length );
+    link->rx_offset   = ( uint16_t )( link->rx_offset + length );
+    link->rx_sequence = ( uint8_t )( ( link->rx_sequence + 1U ) & EXEC_CAN_ISOTP_SEQUENCE_MASK );
+    link->rx_since_us = packet->timestamp_us;
+
+    if ( link->rx_offset == link->rx_length )
+    {
+        EXEC_CAN_Isotp_Rx_Finish( link, EXEC_CAN_ISOTP_STATUS_COMPLETE );
+    }
+    else if ( link->config.block_size > 0U && ++link->rx_block_count == link->config.block_size )
+    {
+        link->rx_block_count = 0U;
+        link->rx_flow_status = EXEC_CAN_ISOTP_FLOW_CONTINUE;
+    }
+}
+
+static void EXEC_CAN_Isotp_Rx_Flow_Control( EXEC_CAN_Isotp_Link_T*   link,
+                                            const EXEC_CAN_Packet_T* packet )
+{
+    if ( link->tx_stage != EXEC_CAN_ISOTP_TX_WAIT_FLOW_CONTROL || packet->dlc < 3U )
+    {
+        return;
+    }
+
+    switch ( packet->data[0] & 0x0FU )
+    {
+        case EXEC_CAN_ISOTP_FLOW_CONTINUE:
+            link->tx_block_remaining =
+                packet->data[1] == 0U ? EXEC_CAN_ISOTP_UNLIMITED_BLOCK : packet->data[1];
+            link->tx_st_min_us = EXEC_CAN_Isotp_St_Min_Us( packet->data[2] );
+            link->tx_next_us   = packet->timestamp_us;
+            link->tx_stage     = EXEC_CAN_ISOTP_TX_CONSECUTIVE;
+            break;
+        case EXEC_CAN_ISOTP_FLOW_WAIT:
+            link->tx_since_us = packet->timestamp_us;
+            break;
+        case EXEC_CAN_ISOTP_FLOW_OVERFLOW:
+            EXEC_CAN_Isotp_Tx_Finish( link, EXEC_CAN_ISOTP_STATUS_OVERFLOW );
+            break;
+        default:
+            EXEC_CAN_Isotp_Tx_Finish( link, EXEC_CAN_ISOTP_STATUS_PROTOCOL_ERROR );
+            break;
+    }
+}
+
+/**-----------------------------------------------------------------------------
+ *  Public Function Definitions
+ *------------------------------------------------------------------------------
+ */
+
+EXEC_CAN_Result_T EXEC_CAN_Isotp_Init( EXEC_CAN_Isotp_Link_T*         link,
+                                       const EXEC_CAN_Isotp_Config_T* config )
+{
+    if ( link == NULL || config == NULL )
+    {
+        return EXEC_CAN_RESULT_INVALID_ARGUMENT;
+    }
+
+    uint32_t id_max = config->extended ? EXEC_CAN_EXTENDED_ID_MAX : EXEC_CAN_STANDARD_ID_MAX;
+    if ( ( config->channel != EXEC_CAN_CHANNEL_1 && config->channel != EXEC_CAN_CHANNEL_2 )
+         || config->tx_id > id_max || config->rx_id > id_max || config->tx_id == config->rx_id
+         || !EXEC_CAN_Isotp_St_Min_Is_Valid( config->st_min ) || config->timeout_us == 0U
+         || config->timeout_us > ( uint32_t )INT32_MAX )
+    {
+        return EXEC_CAN_RESULT_INVALID_ARGUMENT;
+    }
+
+    memset( link, 0, sizeof( *link ) );
+    link->config         = *config;
+    link->rx_flow_status = EXEC_CAN_ISOTP_FLOW_NONE;
+    return EXEC_CAN_RESULT_OK;
+}
+
+EXEC_CAN_Result_T EXEC_CAN_Isotp_Send( EXEC_CAN_Isotp_Link_T* link, const uint8_t data[],
+                                       uint16_t length, uint32_t now_us )
+{
+    if ( link == NULL || data == NULL || length == 0U || length > EXEC_CAN_ISOTP_MAX_MESSAGE_SIZE )
+    {
+        return EXEC_CAN_RESULT_INVALID_ARGUMENT;
+    }
+    if ( link->tx_stage != EXEC_CAN_ISOTP_TX_IDLE )
+    {
+        return EXEC_CAN_RESULT_BUSY;
+    }
+
+    link->tx_data            = data;
+    link->tx_length          = length;
+    link->tx_offset          = 0U;
+    link->tx_block_remaining = EXEC_CAN_ISOTP_UNLIMITED_BLOCK;
+    link->tx_st_min_us       = 0U;
+    link->tx_stage           = EXEC_CAN_ISOTP_TX_FIRST;
+    link->tx_status          = EXEC_CAN_ISOTP_STATUS_BUSY;
+
+    EXEC_CAN_Isotp_Process( link, now_us );
+    return EXEC_CAN_RESULT_OK;
+}
+
+EXEC_CAN_Result_T EXEC_CAN_Isotp_Receive_Start( EXEC_CAN_Isotp_Link_T* link, uint8_t buffer[],
+                                                uint16_t capacity )
+{
+    if ( link == NULL || buffer == NULL || capacity == 0U )
+    {
+        return EXEC_CAN_RESULT_INVALID_ARGUMENT;
+    }
+
+    link->rx_buffer      = buffer;
+    link->rx_capacity    = capacity;
+    link->rx_length      = 0U;
+    link->rx_offset      = 0U;
+    link->rx_flow_status = EXEC_CAN_ISOTP_FLOW_NONE;
+    link->rx_stage       = EXEC_CAN_ISOTP_RX_ARMED;
+    link->rx_status      = EXEC_CAN_ISOTP_STATUS_BUSY;
+    return EXEC_CAN_RESULT_OK;
+}
+
+bool EXEC_CAN_Isotp_Rx_Frame( EXEC_CAN_Isotp_Link_T* link, const EXEC_CAN_Packet_T* packet )
+{
+    if ( link == NULL || packet == NULL || packet->id != link->config.rx_id
+         || packet->extended != link->config.extended )
+    {
+        return false;
+    }
+    if ( packet->dlc == 0U || packet->dlc > EXEC_CAN_MAX_PAYLOAD_SIZE )
+    {
+        return true;
+    }
+
+    uint8_t pci = ( uint8_t )( packet->data[0] >> 4 );
+    if ( pci == EXEC_CAN_ISOTP_PCI_FLOW_CONTROL )
+    {
+        EXEC_CAN_Isotp_Rx_Flow_Control( link, packet );
+    }
+    else if ( pci == EXEC_CAN_ISOTP_PCI_CONSECUTIVE )
+    {
+        if ( link->rx_stage == EXEC_CAN_ISOTP_RX_CONSECUTIVE )
+        {
+            EXEC_CAN_Isotp_Rx_Consecutive( link, packet );
+        }
+    }
+    else if ( link->rx_stage != EXEC_CAN_ISOTP_RX_IDLE )
+    {
+        if ( pci == EXEC_CAN_ISOTP_PCI_SINGLE )
+        {
+            EXEC_CAN_Isotp_Rx_Single( link, packet );
+        }
+        else if ( pci == EXEC_CAN_ISOTP_PCI_FIRST )
+        {
+            EXEC_CAN_Isotp_Rx_First( link, packet );
+        }
+    }
+
+    return true;
+}
+
+void EXEC_CAN_Isotp_Process( EXEC_CAN_Isotp_Link_T* link, uint32_t now_us )
+{
+    if ( link == NULL )
+    {
+        return;
+    }
+
+    bool channel_free = EXEC_CAN_Isotp_Settle_In_Flight( link, now_us );
+    EXEC_CAN_Isotp_Expire( link, now_us );
+    if ( !channel_free )
+    {
+        return;
+    }
+
+    if ( link->rx_flow_status != EXEC_CAN_ISOTP_FLOW_NONE )
+    {
+        EXEC_CAN_Isotp_Send_Flow_Control( link, now_us );
+        return;
+    }
+
+    if ( link->tx_stage == EXEC_CAN_ISOTP_TX_FIRST )
+    {
+        EXEC_CAN_Isotp_Send_First( link, now_us );
+    }
+    else if ( link->tx_stage == EXEC_CAN_ISOTP_TX_CONSECUTIVE )
+    {
+        EXEC_CAN_Isotp_Send_Consecutive( link, now_us );
+    }
+}
+
+EXEC_CAN_Isotp_Status_T EXEC_CAN_Isotp_Tx_Status( const EXEC_CAN_Isotp_Link_T* link )
+{
+    return link == NULL ? EXEC_CAN_ISOTP_STATUS_ERROR : link->tx_status;
+}
+
+EXEC_CAN_Isotp_Status_T EXEC_CAN_Isotp_Rx_Status( const EXEC_CAN_Isotp_Link_T* link,
+                                                  uint16_t*                    length )
+{
+    if ( link == NULL )
+    {
+        return EXEC_CAN_ISOTP_STATUS_ERROR;
+    }
+
+    if ( length != NULL )
+    {
+        *length = link->rx_length;
+    }
+    return link->rx_status;
+}
@@ -0,0 +1,197 @@
+/******************************************************************************
+ *  File:       exec_can_isotp.h
+ *  Author:     Timothy Vogelsang
+ *  Created:    18-Oct-2026
+ *
+ *  Description:
+ *      ISO 15765-2 (ISO-TP) transport for payloads longer than one CAN frame.
+ *
+ *      A link pairs the identifier the rig transmits on with the identifier
+ *      the DUT answers on. Outgoing messages are split into single, first and
+ *      consecutive frames paced by the DUT's flow control; incoming messages
+ *      are reassembled into caller storage while the link answers with its
+ *      own flow control.
+ *
+ *  Notes:
+ *      The link is polled and never blocks. The caller owns the receive loop:
+ *      packets read with EXEC_CAN_Receive() are offered to
+ *      EXEC_CAN_Isotp_Rx_Frame(), then EXEC_CAN_Isotp_Process() moves
+ *      transmission on. With an STmin of zero each call loads as many
+ *      consecutive frames as the block allows into one transmit batch, so
+ *      the bus stays busy as long as the link is processed before a batch
+ *      drains.
+ *
+ *      Both sides use the shared microsecond time base of received packets'
+ *      timestamp_us.
+ ******************************************************************************/
+
+#ifndef EXEC_CAN_ISOTP_H
+#define EXEC_CAN_ISOTP_H
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/**-----------------------------------------------------------------------------
+ *  Includes
+ *------------------------------------------------------------------------------
+ */
+
+#include "exec_can.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/**-----------------------------------------------------------------------------
+ *  Public Defines / Macros
+ *------------------------------------------------------------------------------
+ */
+
+/** Longest message a first frame's 12-bit length field can describe. */
+#define EXEC_CAN_ISOTP_MAX_MESSAGE_SIZE ( 4095U )
+/** Default N_Bs / N_Cr: wait for flow control or the next consecutive frame. */
+#define EXEC_CAN_ISOTP_DEFAULT_TIMEOUT_US ( 1000000U )
+
+/**-----------------------------------------------------------------------------
+ *  Public Typedefs / Enums / Structures
+ *------------------------------------------------------------------------------
+ */
+
+/** State of one direction of an ISO-TP link. */
+typedef enum EXEC_CAN_Isotp_Status_T
+{
+    EXEC_CAN_ISOTP_STATUS_IDLE = 0,
+    EXEC_CAN_ISOTP_STATUS_BUSY,
+    EXEC_CAN_ISOTP_STATUS_COMPLETE,
+    EXEC_CAN_ISOTP_STATUS_TIMEOUT,
+    EXEC_CAN_ISOTP_STATUS_OVERFLOW,
+    EXEC_CAN_ISOTP_STATUS_PROTOCOL_ERROR,
+    EXEC_CAN_ISOTP_STATUS_ERROR,
+} EXEC_CAN_Isotp_Status_T;
+
+/**
+ * Addressing and timing of one ISO-TP link. block_size and st_min are what the
+ * link advertises in its own flow control: block_size is the number of
+ * consecutive frames between flow controls, zero for none, and st_min uses the
+ * protocol encoding (0x00-0x7F ms, 0xF1-0xF9 for 100-900 us). With padding set
+ * every frame is sent with a DLC of eight, filled with padding_byte.
+ */
+typedef struct EXEC_CAN_Isotp_Config_T
+{
+    EXEC_CAN_Channel_T channel;
+    uint32_t           tx_id;
+    uint32_t           rx_id;
+    bool               extended;
+    uint8_t            block_size;
+    uint8_t            st_min;
+    bool               padding;
+    uint8_t            padding_byte;
+    uint32_t           timeout_us;
+} EXEC_CAN_Isotp_Config_T;
+
+/**
+ * One ISO-TP link. Fields other than config are private to exec_can_isotp.c;
+ * use the functions below.
+ */
+typedef struct EXEC_CAN_Isotp_Link_T
+{
+    EXEC_CAN_Isotp_Config_T config;
+    uint8_t                 in_flight;
+
+    const uint8_t*          tx_data;
+    uint16_t                tx_length;
+    uint16_t                tx_offset;
+    uint8_t                 tx_stage;
+    uint8_t                 tx_sequence;
+    uint16_t                tx_block_remaining;
+    uint32_t                tx_st_min_us;
+    uint32_t                tx_since_us;
+    uint32_t                tx_next_us;
+    EXEC_CAN_Isotp_Status_T tx_status;
+
+    uint8_t*                rx_buffer;
+    uint16_t                rx_capacity;
+    uint16_t                rx_length;
+    uint16_t                rx_offset;
+    uint8_t                 rx_stage;
+    uint8_t                 rx_sequence;
+    uint8_t                 rx_block_count;
+    uint8_t                 rx_flow_status;
+    uint32_t                rx_since_us;
+    EXEC_CAN_Isotp_Status_T rx_status;
+} EXEC_CAN_Isotp_Link_T;
+
+/**-----------------------------------------------------------------------------
+ *  Public Function Prototypes
+ *------------------------------------------------------------------------------
+ */
+
+/**
+ * @brief Set up a link and drop any transfer in progress.
+ *
+ * Invalid channels, identifiers that do not fit their format, equal transmit
+ * and receive identifiers, reserved st_min values and a zero timeout return
+ * EXEC_CAN_RESULT_INVALID_ARGUMENT.
+ */
+EXEC_CAN_Result_T EXEC_CAN_Isotp_Init( EXEC_CAN_Isotp_Link_T*         link,
+                                       const EXEC_CAN_Isotp_Config_T* config );
+
+/**
+ * @brief Start sending one message.
+ *
+ * The message is read in place as frames are built, so data must stay
+ * unchanged until the transmit status leaves EXEC_CAN_ISOTP_STATUS_BUSY. The
+ * first frame is loaded straight away if the channel is free. A zero length,
+ * a length above EXEC_CAN_ISOTP_MAX_MESSAGE_SIZE or null data return
+ * EXEC_CAN_RESULT_INVALID_ARGUMENT; a message still in progress returns
+ * EXEC_CAN_RESULT_BUSY.
+ */
+EXEC_CAN_Result_T EXEC_CAN_Isotp_Send( EXEC_CAN_Isotp_Link_T* link, const uint8_t data[],
+                                       uint16_t length, uint32_t now_us );
+
+/**
+ * @brief Arm the link to receive one message into caller storage.
+ *
+ * Frames are copied straight into buffer at their offset in the message. A
+ * first frame announcing more than capacity bytes is refused with an overflow
+ * flow control. The receive status stays EXEC_CAN_ISOTP_STATUS_BUSY until a
+ * message completes or fails; no timeout runs before its first frame arrives.
+ * Re-arming drops a message in progress.
+ */
+EXEC_CAN_Result_T EXEC_CAN_Isotp_Receive_Start( EXEC_CAN_Isotp_Link_T* link, uint8_t buffer[],
+                                                uint16_t capacity );
+
+/**
+ * @brief Offer one received packet to the link.
+ *
+ * @return true if the packet carries the link's receive identifier and was
+ *         consumed, false if it belongs to someone else.
+ */
+bool EXEC_CAN_Isotp_Rx_Frame( EXEC_CAN_Isotp_Link_T* link, const EXEC_CAN_Packet_T* packet );
+
+/**
+ * @brief Send pending flow control and consecutive frames, and expire timeouts.
+ *
+ * Loads at most one transmit batch per call and only when the channel's
+ * previous batch has finished.
+ */
+void EXEC_CAN_Isotp_Process( EXEC_CAN_Isotp_Link_T* link, uint32_t now_us );
+
+/** Return the state of the message being sent. */
+EXEC_CAN_Isotp_Status_T EXEC_CAN_Isotp_Tx_Status( const EXEC_CAN_Isotp_Link_T* link );
+
+/**
+ * @brief Return the state of the message being received.
+ *
+ * @param length Set to the message length once a single or first frame has
+ *               announced it, otherwise zero. May be null.
+ */
+EXEC_CAN_Isotp_Status_T EXEC_CAN_Isotp_Rx_Status( const EXEC_CAN_Isotp_Link_T* link,
+                                                  uint16_t*                    length );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* EXEC_CAN_ISOTP_H */
@@ -24,46 +24,89 @@ struct ConfigureCall
 {
     uint32_t bitrate;
     uint16_t bank;
-    uint16_t id;
-    uint16_t mask;
+    uint32_t id;
+    uint32_t mask;
+    bool     extended;
 };
 
-static ConfigureCall             configure_calls[2];
-static uint16_t                  configure_call_count[2];
-static int                       configure_results[2];
-static HW_CAN_Tx_Status_T        hardware_status[2];
-static uint16_t                  status_call_count[2];
-static HW_CAN_Result_T           recover_results[2];
-static uint16_t                  recover_call_count[2];
-static uint32_t                  dropped_counts[2];
-static uint16_t                  dropped_call_count[2];
-static HW_CAN_Result_T           load_results[2];
-static uint16_t                  load_call_count[2];
-static HW_CAN_Result_T           trigger_results[2];
-static uint16_t                  trigger_call_count[2];
-static uint16_t                  cancel_call_count[2];
-static std::vector<CAN_Packet_T> hardware_tx_queue[2];
-static std::vector<CAN_Packet_T> hardware_rx_queue[2];
-static uint16_t                  receive_call_count[2];
-static uint16_t                  last_receive_capacity[2];
-static const void*               last_hardware_tx_source;
-static const void*               last_hardware_rx_destination;
-
-static int Configure( size_t channel, uint32_t bitrate, uint16_t bank, uint16_t id, uint16_t mask )
+static ConfigureCall                     configure_calls[2];
+static uint16_t                          configure_call_count[2];
+static int                               configure_results[2];
+static HW_CAN_Tx_Status_T                hardware_status[2];
+static uint16_t                          status_call_count[2];
+static HW_CAN_Result_T                   recover_results[2];
+static uint16_t                          recover_call_count[2];
+static uint32_t                          dropped_counts[2];
+static uint16_t                          dropped_call_count[2];
+static uint32_t                          tx_timestamps[2];
+static bool                              tx_timestamp_valid[2];
+static HW_CAN_Result_T                   load_results[2];
+static uint16_t                          load_call_count[2];
+static HW_CAN_Result_T                   trigger_results[2];
+static uint16_t                          trigger_call_count[2];
+static uint16_t                          cancel_call_count[2];
+static std::vector<CAN_Packet_T>         hardware_tx_queue[2];
+static std::vector<CAN_Packet_T>         hardware_rx_queue[2];
+static uint16_t                          receive_call_count[2];
+static uint16_t                          last_receive_capacity[2];
+static const                             void*               last_hardware_tx_source;
+static const                             void*               last_hardware_rx_destination;
+static std::vector<HW_CAN_Filter_Rule_T> filter_rules[2];
+static uint16_t                          filter_call_count[2];
+static HW_CAN_Result_T                   filter_results[2];
+static HW_CAN_Filter_Report_T            filter_reports[2];
+
+/* Cyclic schedule capture. Payload pointers are only valid during the start call. */
+static std::vector<HW_CAN_Cyclic_Entry_T> cyclic_tables[2];
+static std::vector<std::vector<uint8_t>>  cyclic_payloads[2];
+static uint16_t                           cyclic_start_call_count[2];
+static uint16_t                           cyclic_stop_call_count[2];
+static HW_CAN_Result_T                    cyclic_start_results[2];
+static uint16_t                           cyclic_update_index[2];
+static std::vector<uint8_t>               cyclic_update_payload[2];
+static HW_CAN_Result_T                    cyclic_update_results[2];
+static HW_CAN_Cyclic_Stats_T              cyclic_stats[2];
+static uint16_t                           cyclic_stats_index[2];
+
+/* Auto-responder capture. */
+static std::vector<HW_CAN_Responder_Entry_T> responder_tables[2];
+static uint16_t                              responder_start_call_count[2];
+static uint16_t                              responder_stop_call_count[2];
+static HW_CAN_Result_T                       responder_start_results[2];
+static HW_CAN_Responder_Stats_T              responder_stats[2];
+
+/* Log replay capture. */
+static const uint8_t*        replay_logs[2];
+static uint32_t              replay_lengths[2];
+static uint32_t              replay_time_scales[2];
+static uint32_t              replay_passes[2];
+static uint16_t              replay_start_call_count[2];
+static uint16_t              replay_stop_call_count[2];
+static HW_CAN_Result_T       replay_start_results[2];
+static HW_CAN_Replay_Stats_T replay_stats[2];
+
+/* Bus statistics capture. */
+static HW_CAN_Bus_Stats_T bus_stats[2];
+static uint16_t           bus_stats_reset_call_count[2];
+
+static int Configure( size_t channel, uint32_t bitrate, uint16_t bank, uint32_t id, uint32_t mask,
+                      bool extended )
 {
     configure_call_count[channel]++;
-    configure_calls[channel] = { bitrate, bank, id, mask };
+    configure_calls[channel] = { bitrate, bank, id, mask, extended };
     return configure_results[channel];
 }
 
-extern "C" int HW_CAN_Configure1( uint32_t bitrate, uint16_t bank, uint16_t id, uint16_t mask )
+extern "C" int HW_CAN_Configure1( uint32_t bitrate, uint16_t bank, uint32_t id, uint32_t mask,
+                                  bool extended )
 {
-    return Configure( 0U, bitrate, bank, id, mask );
+    return Configure( 0U, bitrate, bank, id, mask, extended );
 }
 
-extern "C" int HW_CAN_Configure2( uint32_t bitrate, uint16_t bank, uint16_t id, uint16_t mask )
+extern "C" int HW_CAN_Configure2( uint32_t bitrate, uint16_t bank, uint32_t id, uint32_t mask,
+                                  bool extended )
 {
-    return Configure( 1U, bitrate, bank, id, mask );
+    return Configure( 1U, bitrate, bank, id, mask, extended );
 }
 
 extern "C" HW_CAN_Tx_Status_T HW_CAN_Tx_Status1( void )
@@ -102,6 +145,233 @@ extern "C" uint32_t HW_CAN_Rx_Dropped_Count2( void )
     return dropped_counts[1];
 }
 
+static bool Tx_Timestamp( size_t channel, uint32_t* timestamp_us )
+{
+    if ( tx_timestamp_valid[channel] )
+    {
+        *timestamp_us = tx_timestamps[channel];
+    }
+    return tx_timestamp_valid[channel];
+}
+
+extern "C" bool HW_CAN_Tx_Timestamp1( uint32_t* timestamp_us )
+{
+    return Tx_Timestamp( 0U, timestamp_us );
+}
+
+extern "C" bool HW_CAN_Tx_Timestamp2( uint32_t* timestamp_us )
+{
+    return Tx_Timestamp( 1U, timestamp_us );
+}
+
+static HW_CAN_Result_T Set_Filters( size_t channel, const HW_CAN_Filter_Rule_T rules[],
+                                    uint16_t count )
+{
+    filter_call_count[channel]++;
+    filter_rules[channel].assign( rules, rules + count );
+    return filter_results[channel];
+}
+
+extern "C" HW_CAN_Result_T HW_CAN_Set_Filters1( const HW_CAN_Filter_Rule_T rules[],
+                                                uint16_t                   rule_count )
+{
+    return Set_Filters( 0U, rules, rule_count );
+}
+
+extern "C" HW_CAN_Result_T HW_CAN_Set_Filters2( const HW_CAN_Filter_Rule_T rules[],
+                                                uint16_t                   rule_count )
+{
+    return Set_Filters( 1U, rules, rule_count );
+}
+
+extern "C" void HW_CAN_Get_Filter_Report1( HW_CAN_Filter_Report_T* report )
+{
+    *report = filter_reports[0];
+}
+
+extern "C" void HW_CAN_Get_Filter_Report2( HW_CAN_Filter_Report_T* report )
+{
+    *report = filter_reports[1];
+}
+
+static HW_CAN_Result_T Cyclic_Start( size_t channel, const HW_CAN_Cyclic_Entry_T table[],
+                                     uint16_t count )
+{
+    cyclic_start_call_count[channel]++;
+    cyclic_tables[channel].assign( table, table + count );
+    cyclic_payloads[channel].clear();
+    for ( uint16_t i = 0U; i < count; i++ )
+    {
+        cyclic_payloads[channel].emplace_back( table[i].payload, table[i].payload + table[i].dlc );
+    }
+    return cyclic_start_results[channel];
+}
+
+extern "C" HW_CAN_Result_T HW_CAN_Cyclic_Start1( const HW_CAN_Cyclic_Entry_T table[],
+                                                 uint16_t                    count )
+{
+    return Cyclic_Start( 0U, table, count );
+}
+
+extern "C" HW_CAN_Result_T HW_CAN_Cyclic_Start2( const HW_CAN_Cyclic_Entry_T table[],
+                                                 uint16_t                    count )
+{
+    return Cyclic_Start( 1U, table, count );
+}
+
+extern "C" void HW_CAN_Cyclic_Stop1( void )
+{
+    cyclic_stop_call_count[0]++;
+}
+
+extern "C" void HW_CAN_Cyclic_Stop2( void )
+{
+    cyclic_stop_call_count[1]++;
+}
+
+static HW_CAN_Result_T Cyclic_Update( size_t channel, uint16_t index, const uint8_t data[],
+                                      uint8_t dlc )
+{
+    cyclic_update_index[channel] = index;
+    cyclic_update_payload[channel].assign( data, data + dlc );
+    return cyclic_update_results[channel];
+}
+
+extern "C" HW_CAN_Result_T HW_CAN_Cyclic_Update_Payload1( uint16_t index, const uint8_t data[],
+                                                          uint8_t dlc )
+{
+    return Cyclic_Update( 0U, index, data, dlc );
+}
+
+extern "C" HW_CAN_Result_T HW_CAN_Cyclic_Update_Payload2( uint16_t index, const uint8_t data[],
+                                                          uint8_t dlc )
+{
+    return Cyclic_Update( 1U, index, data, dlc );
+}
+
+extern "C" HW_CAN_Result_T HW_CAN_Cyclic_Get_Stats1( uint16_t index, HW_CAN_Cyclic_Stats_T* stats )
+{
+    cyclic_stats_index[0] = index;
+    *stats                = cyclic_stats[0];
+    return index < cyclic_tables[0].size() ? HW_CAN_RESULT_OK : HW_CAN_RESULT_ERROR;
+}
+
+extern "C" HW_CAN_Result_T HW_CAN_Cyclic_Get_Stats2( uint16_t index, HW_CAN_Cyclic_Stats_T* stats )
+{
+    cyclic_stats_index[1] = index;
+    *stats                = cyclic_stats[1];
+    return index < cyclic_tables[1].size() ? HW_CAN_RESULT_OK : HW_CAN_RESULT_ERROR;
+}
+
+static HW_CAN_Result_T Responder_Start( size_t channel, const HW_CAN_Responder_Entry_T table[],
+                                        uint16_t count )
+{
+    responder_start_call_count[channel]++;
+    responder_tables[channel].assign( table, table + count );
+    return responder_start_results[channel];
+}
+
+extern "C" HW_CAN_Result_T HW_CAN_Responder_Start1( const HW_CAN_Responder_Entry_T table[],
+                                                    uint16_t                       count )
+{
+    return Responder_Start( 0U, table, count );
+}
+
+extern "C" HW_CAN_Result_T HW_CAN_Responder_Start2( const HW_CAN_Responder_Entry_T table[],
+                                                    uint16_t                       count )
+{
+    return Responder_Start( 1U, table, count );
+}
+
+extern "C" void HW_CAN_Responder_Stop1( void )
+{
+    responder_stop_call_count[0]++;
+}
+
+extern "C" void HW_CAN_Responder_Stop2( void )
+{
+    responder_stop_call_count[1]++;
+}
+
+extern "C" HW_CAN_Result_T HW_CAN_Responder_Get_Stats1( HW_CAN_Responder_Stats_T* stats )
+{
+    *stats = responder_stats[0];
+    return HW_CAN_RESULT_OK;
+}
+
+extern "C" HW_CAN_Result_T HW_CAN_Responder_Get_Stats2( HW_CAN_Responder_Stats_T* stats )
+{
+    *stats = responder_stats[1];
+    return HW_CAN_RESULT_OK;
+}
+
+static HW_CAN_Result_T Replay_Start( size_t channel, const uint8_t log[], uint32_t length,
+                                     uint32_t time_scale, uint32_t passes )
+{
+    replay_start_call_count[channel]++;
+    replay_logs[channel]        = log;
+    replay_lengths[channel]     = length;
+    replay_time_scales[channel] = time_scale;
+    replay_passes[channel]      = passes;
+    return replay_start_results[channel];
+}
+
+extern "C" HW_CAN_Result_T HW_CAN_Replay_Start1( const uint8_t log[], uint32_t length,
+                                                 uint32_t time_scale, uint32_t passes )
+{
+    return Replay_Start( 0U, log, length, time_scale, passes );
+}
+
+extern "C" HW_CAN_Result_T HW_CAN_Replay_Start2( const uint8_t log[], uint32_t length,
+                                                 uint32_t time_scale, uint32_t passes )
+{
+    return Replay_Start( 1U, log, length, time_scale, passes );
+}
+
+extern "C" void HW_CAN_Replay_Stop1( void )
+{
+    replay_stop_call_count[0]++;
+}
+
+extern "C" void HW_CAN_Replay_Stop2( void )
+{
+    replay_stop_call_count[1]++;
+}
+
+extern "C" HW_CAN_Result_T HW_CAN_Replay_Get_Stats1( HW_CAN_Replay_Stats_T* stats )
+{
+    *stats = replay_stats[0];
+    return HW_CAN_RESULT_OK;
+}
+
+extern "C" HW_CAN_Result_T HW_CAN_Replay_Get_Stats2( HW_CAN_Replay_Stats_T* stats )
+{
+    *stats = replay_stats[1];
+    return HW_CAN_RESULT_OK;
+}
+
+extern "C" HW_CAN_Result_T HW_CAN_Bus_Get_Stats1( HW_CAN_Bus_Stats_T* stats )
+{
+    *stats = bus_stats[0];
+    return HW_CAN_RESULT_OK;
+}
+
+extern "C" HW_CAN_Result_T HW_CAN_Bus_Get_Stats2( HW_CAN_Bus_Stats_T* stats )
+{
+    *stats = bus_stats[1];
+    return HW_CAN_RESULT_OK;
+}
+
+extern "C" void HW_CAN_Bus_Reset_Stats1( void )
+{
+    bus_stats_reset_call_count[0]++;
+}
+
+extern "C" void HW_CAN_Bus_Reset_Stats2( void )
+{
+    bus_stats_reset_call_count[1]++;
+}
+
 static HW_CAN_Result_T Load( size_t channel, CAN_Packet_T source[], uint16_t count )
 {
     load_call_count[channel]++;
@@ -182,6 +452,8 @@ class ExecCANTest : public ::testing::Test
         std::memset( recover_call_count, 0, sizeof( recover_call_count ) );
         std::memset( dropped_counts, 0, sizeof( dropped_counts ) );
         std::memset( dropped_call_count, 0, sizeof( dropped_call_count ) );
+        std::memset( tx_timestamps, 0, sizeof( tx_timestamps ) );
+        std::memset( tx_timestamp_valid, 0, sizeof( tx_timestamp_valid ) );
         std::memset( load_call_count, 0, sizeof( load_call_count ) );
         std::memset( trigger_call_count, 0, sizeof( trigger_call_count ) );
         std::memset( cancel_call_count, 0, sizeof( cancel_call_count ) );
@@ -197,6 +469,39 @@ class ExecCANTest : public ::testing::Test
         hardware_rx_queue[1].clear();
         last_hardware_tx_source      = nullptr;
         last_hardware_rx_destination = nullptr;
+        filter_rules[0].clear();
+        filter_rules[1].clear();
+        std::memset( filter_call_count, 0, sizeof( filter_call_count ) );
+        std::memset( filter_reports, 0, sizeof( filter_reports ) );
+        filter_results[0] = filter_results[1] = HW_CAN_RESULT_OK;
+        for ( size_t channel = 0U; channel < 2U; channel++ )
+        {
+            cyclic_tables[channel].clear();
+            cyclic_payloads[channel].clear();
+            cyclic_update_payload[channel].clear();
+            cyclic_start_results[channel]  = HW_CAN_RESULT_OK;
+            cyclic_update_results[channel] = HW_CAN_RESULT_OK;
+            cyclic_update_index[channel]   = 0U;
+            cyclic_stats_index[channel]    = 0U;
+            cyclic_stats[channel]          = {};
+            responder_tables[channel].clear();
+            responder_start_results[channel] = HW_CAN_RESULT_OK;
+            responder_stats[channel]         = {};
+            replay_logs[channel]             = nullptr;
+            replay_lengths[channel]          = 0U;
+            replay_time_scales[channel]      = 0U;
+            replay_passes[channel]           = 0U;
+            replay_start_results[channel]    = HW_CAN_RESULT_OK;
+            replay_stats[channel]            = {};
+            bus_stats[channel]               = {};
+        }
+        std::memset( cyclic_start_call_count, 0, sizeof( cyclic_start_call_count ) );
+        std::memset( cyclic_stop_call_count, 0, sizeof( cyclic_stop_call_count ) );
+        std::memset( responder_start_call_count, 0, sizeof( responder_start_call_count ) );
+        std::memset( responder_stop_call_count, 0, sizeof( responder_stop_call_count ) );
+        std::memset( replay_start_call_count, 0, sizeof( replay_start_call_count ) );
+        std::memset( replay_stop_call_count, 0, sizeof( replay_stop_call_count ) );
+        std::memset( bus_stats_reset_call_count, 0, sizeof( bus_stats_reset_call_count ) );
     }
 };
 
@@ -205,9 +510,10 @@ TEST_F( ExecCANTest, ConfigureRoutesBothChannelsAndMapsResults )
     configure_results[0] = 0;
     configure_results[1] = 2;
 
-    EXPECT_EQ( EXEC_CAN_Configure( EXEC_CAN_CHANNEL_1, 500000U, 13U, 0x123U, 0x7FFU ),
+    EXPECT_EQ( EXEC_CAN_Configure( EXEC_CAN_CHANNEL_1, 500000U, 13U, 0x123U, 0x7FFU, false ),
                EXEC_CAN_RESULT_OK );
-    EXPECT_EQ( EXEC_CAN_Configure( EXEC_CAN_CHANNEL_2, 250000U, 14U, 0x456U, 0x700U ),
+    EXPECT_EQ( EXEC_CAN_Configure( EXEC_CAN_CHANNEL_2, 250000U, 14U, 0x18FEF100U, 0x1FFFFF00U,
+                                   true ),
                EXEC_CAN_RESULT_FILTER_ERROR );
 
     EXPECT_EQ( configure_call_count[0], 1U );
@@ -216,8 +522,12 @@ TEST_F( ExecCANTest, ConfigureRoutesBothChannelsAndMapsResults )
     EXPECT_EQ( configure_calls[0].bank, 13U );
     EXPECT_EQ( configure_calls[0].id, 0x123U );
     EXPECT_EQ( configure_calls[0].mask, 0x7FFU );
+    EXPECT_FALSE( configure_calls[0].extended );
     EXPECT_EQ( configure_calls[1].bitrate, 250000U );
     EXPECT_EQ( configure_calls[1].bank, 14U );
+    EXPECT_EQ( configure_calls[1].id, 0x18FEF100U );
+    EXPECT_EQ( configure_calls[1].mask, 0x1FFFFF00U );
+    EXPECT_TRUE( configure_calls[1].extended );
 }
 
 TEST_F( ExecCANTest, ConfigurationResultMappingCoversEveryHardwareCode )
@@ -229,10 +539,63 @@ TEST_F( ExecCANTest, ConfigurationResultMappingCoversEveryHardwareCode )
     for ( size_t i = 0U; i < expected.size(); i++ )
     {
         configure_results[0] = static_cast<int>( i );
-        EXPECT_EQ( EXEC_CAN_Configure( EXEC_CAN_CHANNEL_1, 500000U, 0U, 0U, 0U ), expected[i] );
+        EXPECT_EQ( EXEC_CAN_Configure( EXEC_CAN_CHANNEL_1, 500000U, 0U, 0U, 0U, false ),
+                   expected[i] );
     }
 }
 
+TEST_F( ExecCANTest, SetFiltersRoutesBothChannelsAndConvertsRules )
+{
+    const EXEC_CAN_Filter_Rule_T rules[] = {
+        { 0x100U, 0x1FFU, false },
+        { 0x18FEF100U, 0x18FEF100U, true },
+    };
+    filter_results[1] = HW_CAN_RESULT_ERROR;
+
+    EXPECT_EQ( EXEC_CAN_Set_Filters( EXEC_CAN_CHANNEL_1, rules, 2U ), EXEC_CAN_RESULT_OK );
+    EXPECT_EQ( EXEC_CAN_Set_Filters( EXEC_CAN_CHANNEL_2, nullptr, 0U ),
+               EXEC_CAN_RESULT_FILTER_ERROR );
+
+    ASSERT_EQ( filter_rules[0].size(), 2U );
+    EXPECT_EQ( filter_rules[0][0].first_id, 0x100U );
+    EXPECT_EQ( filter_rules[0][0].last_id, 0x1FFU );
+    EXPECT_FALSE( filter_rules[0][0].extended );
+    EXPECT_EQ( filter_rules[0][1].first_id, 0x18FEF100U );
+    EXPECT_TRUE( filter_rules[0][1].extended );
+    EXPECT_EQ( filter_call_count[1], 1U );
+    EXPECT_TRUE( filter_rules[1].empty() );
+
+    filter_reports[1] = { 3U, 2U, 0x101U, 0x40U };
+    EXEC_CAN_Filter_Report_T report{};
+    EXPECT_EQ( EXEC_CAN_Get_Filter_Report( EXEC_CAN_CHANNEL_2, &report ), EXEC_CAN_RESULT_OK );
+    EXPECT_EQ( report.first_bank, 3U );
+    EXPECT_EQ( report.bank_count, 2U );
+    EXPECT_EQ( report.hardware_ids, 0x101U );
+    EXPECT_EQ( report.software_ids, 0x40U );
+}
+
+TEST_F( ExecCANTest, SetFiltersRejectsInvalidRulesBeforeHardwareCalls )
+{
+    const EXEC_CAN_Filter_Rule_T inverted[]      = { { 0x200U, 0x100U, false } };
+    const EXEC_CAN_Filter_Rule_T standard_high[] = { { 0x700U, 0x800U, false } };
+    const EXEC_CAN_Filter_Rule_T extended_high[] = { { 0x0U, 0x20000000U, true } };
+    EXEC_CAN_Filter_Rule_T       too_many[EXEC_CAN_MAX_FILTER_RULES + 1U] = {};
+
+    EXPECT_EQ( EXEC_CAN_Set_Filters( EXEC_CAN_CHANNEL_1, inverted, 1U ),
+               EXEC_CAN_RESULT_INVALID_ARGUMENT );
+    EXPECT_EQ( EXEC_CAN_Set_Filters( EXEC_CAN_CHANNEL_1, standard_high, 1U ),
+               EXEC_CAN_RESULT_INVALID_ARGUMENT );
+    EXPECT_EQ( EXEC_CAN_Set_Filters( EXEC_CAN_CHANNEL_1, extended_high, 1U ),
+               EXEC_CAN_RESULT_INVALID_ARGUMENT );
+    EXPECT_EQ( EXEC_CAN_Set_Filters( EXEC_CAN_CHANNEL_1, nullptr, 1U ),
+               EXEC_CAN_RESULT_INVALID_ARGUMENT );
+    EXPECT_EQ( EXEC_CAN_Set_Filters( EXEC_CAN_CHANNEL_1, too_many, EXEC_CAN_MAX_FILTER_RULES + 1U ),
+               EXEC_CAN_RESULT_INVALID_ARGUMENT );
+    EXPECT_EQ( EXEC_CAN_Get_Filter_Report( EXEC_CAN_CHANNEL_1, nullptr ),
+               EXEC_CAN_RESULT_INVALID_ARGUMENT );
+    EXPECT_EQ( filter_call_count[0] + filter_call_count[1], 0U );
+}
+
 TEST_F( ExecCANTest, CombinedTransmitRoutesBothChannelsAndConvertsPackets )
 {
     EXEC_CAN_Packet_T packets[2] = {
@@ -258,6 +621,45 @@ TEST_F( ExecCANTest, CombinedTransmitRoutesBothChannelsAndConvertsPackets )
     EXPECT_EQ( hardware_tx_queue[1][0].id, 0x123U );
 }
 
+TEST_F( ExecCANTest, ExtendedIdentifiersRoundTripThroughTransmitAndReceive )
+{
+    EXEC_CAN_Packet_T packet = { 0x18FEF100U, 2U, { 0x11U, 0x22U }, true };
+
+    EXPECT_EQ( EXEC_CAN_Transmit( EXEC_CAN_CHANNEL_2, &packet, 1U ), EXEC_CAN_RESULT_OK );
+    ASSERT_EQ( hardware_tx_queue[1].size(), 1U );
+    EXPECT_EQ( hardware_tx_queue[1][0].id, 0x18FEF100U );
+    EXPECT_TRUE( hardware_tx_queue[1][0].extended );
+
+    hardware_rx_queue[1] = {
+        { 0x0CF00400U, 1U, { 0x5AU }, true, 1000U },
+        { 0x123U, 0U, {}, false, 1250U },
+    };
+    EXEC_CAN_Packet_T destination[2] = {};
+    uint16_t          read           = 0U;
+
+    EXPECT_EQ( EXEC_CAN_Receive( EXEC_CAN_CHANNEL_2, destination, 2U, &read ), EXEC_CAN_RESULT_OK );
+    ASSERT_EQ( read, 2U );
+    EXPECT_EQ( destination[0].id, 0x0CF00400U );
+    EXPECT_TRUE( destination[0].extended );
+    EXPECT_EQ( destination[1].id, 0x123U );
+    EXPECT_FALSE( destination[1].extended );
+    EXPECT_EQ( destination[0].timestamp_us, 1000U );
+    EXPECT_EQ( destination[1].timestamp_us, 1250U );
+}
+
+TEST_F( ExecCANTest, TxTimestampRoutesBothChannelsAndReportsEmpty )
+{
+    uint32_t timestamp    = 0U;
+    tx_timestamps[1]      = 4786U;
+    tx_timestamp_valid[1] = true;
+
+    EXPECT_EQ( EXEC_CAN_Get_Tx_Timestamp( EXEC_CAN_CHANNEL_1, &timestamp ), EXEC_CAN_RESULT_EMPTY );
+    EXPECT_EQ( EXEC_CAN_Get_Tx_Timestamp( EXEC_CAN_CHANNEL_2, &timestamp ), EXEC_CAN_RESULT_OK );
+    EXPECT_EQ( timestamp, 4786U );
+    EXPECT_EQ( EXEC_CAN_Get_Tx_Timestamp( EXEC_CAN_CHANNEL_2, nullptr ),
+               EXEC_CAN_RESULT_INVALID_ARGUMENT );
+}
+
 TEST_F( ExecCANTest, LoadFailureDoesNotTriggerOrCancel )
 {
     EXEC_CAN_Packet_T packet = { 1U, 0U, {} };
@@ -296,6 +698,9 @@ TEST_F( ExecCANTest, TransmitRejectsInvalidArgumentsBeforeHardwareCalls )
     EXEC_CAN_Packet_T bad_id = { 0x800U, 0U, {} };
     EXPECT_EQ( EXEC_CAN_Transmit( EXEC_CAN_CHANNEL_1, &bad_id, 1U ),
                EXEC_CAN_RESULT_INVALID_ARGUMENT );
+    EXEC_CAN_Packet_T bad_extended_id = { EXEC_CAN_EXTENDED_ID_MAX + 1U, 0U, {}, true };
+    EXPECT_EQ( EXEC_CAN_Transmit( EXEC_CAN_CHANNEL_1, &bad_extended_id, 1U ),
+               EXEC_CAN_RESULT_INVALID_ARGUMENT );
     EXEC_CAN_Packet_T bad_dlc = { 1U, 9U, {} };
     EXPECT_EQ( EXEC_CAN_Transmit( EXEC_CAN_CHANNEL_1, &bad_dlc, 1U ),
                EXEC_CAN_RESULT_INVALID_ARGUMENT );
@@ -322,7 +727,7 @@ TEST_F( ExecCANTest, ReceiveCopiesOnlyUpToCapacityAndConsumesPacketsExactlyOnce
     EXPECT_EQ( destination[0].data[1], 2U );
     EXPECT_EQ( destination[0].data[2], 0U );
     EXPECT_EQ( destination[1].id, 0x400U );
-    EXPECT_EQ( destination[2].id, 0xCCCCU );
+    EXPECT_EQ( destination[2].id, 0xCCCCCCCCU );
     ASSERT_EQ( hardware_rx_queue[0].size(), 1U );
 
     EXPECT_EQ( EXEC_CAN_Receive( EXEC_CAN_CHANNEL_1, destination, 3U, &read ), EXEC_CAN_RESULT_OK );
@@ -434,13 +839,28 @@ TEST_F( ExecCANTest, InvalidChannelNeverCallsHardware )
     EXEC_CAN_Packet_T        packet{};
     uint16_t                 read = 0U;
 
-    EXPECT_EQ( EXEC_CAN_Configure( invalid, 500000U, 0U, 0U, 0U ),
+    EXPECT_EQ( EXEC_CAN_Configure( invalid, 500000U, 0U, 0U, 0U, false ),
                EXEC_CAN_RESULT_INVALID_ARGUMENT );
     EXPECT_EQ( EXEC_CAN_Transmit( invalid, &packet, 1U ), EXEC_CAN_RESULT_INVALID_ARGUMENT );
     EXPECT_EQ( EXEC_CAN_Receive( invalid, &packet, 1U, &read ), EXEC_CAN_RESULT_INVALID_ARGUMENT );
     EXPECT_EQ( EXEC_CAN_Get_Tx_Status( invalid ), EXEC_CAN_TX_STATUS_INVALID_CHANNEL );
     EXPECT_EQ( EXEC_CAN_Recover( invalid ), EXEC_CAN_RESULT_INVALID_ARGUMENT );
     EXPECT_EQ( EXEC_CAN_Get_Rx_Dropped_Count( invalid ), 0U );
+    uint32_t timestamp = 0U;
+    EXPECT_EQ( EXEC_CAN_Get_Tx_Timestamp( invalid, &timestamp ), EXEC_CAN_RESULT_INVALID_ARGUMENT );
+    EXPECT_EQ( EXEC_CAN_Set_Filters( invalid, nullptr, 0U ), EXEC_CAN_RESULT_INVALID_ARGUMENT );
+    EXPECT_EQ( EXEC_CAN_Get_Filter_Report( invalid, nullptr ), EXEC_CAN_RESULT_INVALID_ARGUMENT );
+    EXPECT_EQ( EXEC_CAN_Cyclic_Start( invalid, nullptr, 0U ), EXEC_CAN_RESULT_INVALID_ARGUMENT );
+    EXPECT_EQ( EXEC_CAN_Cyclic_Stop( invalid ), EXEC_CAN_RESULT_INVALID_ARGUMENT );
+    EXPECT_EQ( EXEC_CAN_Responder_Start( invalid, nullptr, 0U ), EXEC_CAN_RESULT_INVALID_ARGUMENT );
+    EXPECT_EQ( EXEC_CAN_Responder_Stop( invalid ), EXEC_CAN_RESULT_INVALID_ARGUMENT );
+    const uint8_t log[1] = {};
+    EXPECT_EQ( EXEC_CAN_Replay_Start( invalid, log, 1U, EXEC_CAN_REPLAY_TIME_SCALE_UNITY, 1U ),
+               EXEC_CAN_RESULT_INVALID_ARGUMENT );
+    EXPECT_EQ( EXEC_CAN_Replay_Stop( invalid ), EXEC_CAN_RESULT_INVALID_ARGUMENT );
+    EXEC_CAN_Bus_Stats_T bus{};
+    EXPECT_EQ( EXEC_CAN_Get_Bus_Stats( invalid, &bus ), EXEC_CAN_RESULT_INVALID_ARGUMENT );
+    EXPECT_EQ( EXEC_CAN_Reset_Bus_Stats( invalid ), EXEC_CAN_RESULT_INVALID_ARGUMENT );
 
     EXPECT_EQ( configure_call_count[0] + configure_call_count[1], 0U );
     EXPECT_EQ( load_call_count[0] + load_call_count[1], 0U );
@@ -448,4 +868,300 @@ TEST_F( ExecCANTest, InvalidChannelNeverCallsHardware )
     EXPECT_EQ( status_call_count[0] + status_call_count[1], 0U );
     EXPECT_EQ( recover_call_count[0] + recover_call_count[1], 0U );
     EXPECT_EQ( dropped_call_count[0] + dropped_call_count[1], 0U );
+    EXPECT_EQ( filter_call_count[0] + filter_call_count[1], 0U );
+    EXPECT_EQ( cyclic_start_call_count[0] + cyclic_start_call_count[1], 0U );
+    EXPECT_EQ( cyclic_stop_call_count[0] + cyclic_stop_call_count[1], 0U );
+    EXPECT_EQ( responder_start_call_count[0] + responder_start_call_count[1], 0U );
+    EXPECT_EQ( responder_stop_call_count[0] + responder_stop_call_count[1], 0U );
+    EXPECT_EQ( replay_start_call_count[0] + replay_start_call_count[1], 0U );
+    EXPECT_EQ( replay_stop_call_count[0] + replay_stop_call_count[1], 0U );
+    EXPECT_EQ( bus_stats_reset_call_count[0] + bus_stats_reset_call_count[1], 0U );
+}
+
+TEST_F( ExecCANTest, CyclicStartRoutesBothChannelsAndConvertsEntries )
+{
+    const EXEC_CAN_Cyclic_Entry_T entries[] = {
+        { { 0x123U, 2U, { 0x11U, 0x22U } }, 10U, 0U },
+        { { 0x18FEF100U, 1U, { 0x33U }, true }, 100U, 25U },
+    };
+    cyclic_start_results[1] = HW_CAN_RESULT_BUSY;
+
+    EXPECT_EQ( EXEC_CAN_Cyclic_Start( EXEC_CAN_CHANNEL_1, entries, 2U ), EXEC_CAN_RESULT_OK );
+    EXPECT_EQ( EXEC_CAN_Cyclic_Start( EXEC_CAN_CHANNEL_2, entries, 1U ), EXEC_CAN_RESULT_BUSY );
+
+    ASSERT_EQ( cyclic_tables[0].size(), 2U );
+    EXPECT_EQ( cyclic_tables[0][0].id, 0x123U );
+    EXPECT_EQ( cyclic_tables[0][0].period_ms, 10U );
+    EXPECT_EQ( cyclic_payloads[0][0], ( std::vector<uint8_t>{ 0x11U, 0x22U } ) );
+    EXPECT_EQ( cyclic_tables[0][1].id, 0x18FEF100U );
+    EXPECT_TRUE( cyclic_tables[0][1].extended );
+    EXPECT_EQ( cyclic_tables[0][1].phase_ms, 25U );
+    EXPECT_EQ( cyclic_payloads[0][1], ( std::vector<uint8_t>{ 0x33U } ) );
+    EXPECT_EQ( cyclic_start_call_count[1], 1U );
+
+    EXPECT_EQ( EXEC_CAN_Cyclic_Stop( EXEC_CAN_CHANNEL_2 ), EXEC_CAN_RESULT_OK );
+    EXPECT_EQ( cyclic_stop_call_count[0], 0U );
+    EXPECT_EQ( cyclic_stop_call_count[1], 1U );
+}
+
+TEST_F( ExecCANTest, CyclicStartRejectsInvalidEntriesBeforeHardwareCalls )
+{
+    const EXEC_CAN_Cyclic_Entry_T zero_period[]  = { { { 0x123U, 0U, {} }, 0U, 0U } };
+    const EXEC_CAN_Cyclic_Entry_T late_phase[]   = { { { 0x123U, 0U, {} }, 10U, 10U } };
+    const EXEC_CAN_Cyclic_Entry_T standard_high[] = { { { 0x800U, 0U, {} }, 10U, 0U } };
+    const EXEC_CAN_Cyclic_Entry_T long_dlc[]     = { { { 0x123U, 9U, {} }, 10U, 0U } };
+    EXEC_CAN_Cyclic_Entry_T       too_many[EXEC_CAN_MAX_CYCLIC_MESSAGES + 1U] = {};
+
+    for ( const EXEC_CAN_Cyclic_Entry_T* entries :
+          { zero_period, late_phase, standard_high, long_dlc } )
+    {
+        EXPECT_EQ( EXEC_CAN_Cyclic_Start( EXEC_CAN_CHANNEL_1, entries, 1U ),
+                   EXEC_CAN_RESULT_INVALID_ARGUMENT );
+    }
+    EXPECT_EQ( EXEC_CAN_Cyclic_Start( EXEC_CAN_CHANNEL_1, nullptr, 1U ),
+               EXEC_CAN_RESULT_INVALID_ARGUMENT );
+    EXPECT_EQ(
+        EXEC_CAN_Cyclic_Start( EXEC_CAN_CHANNEL_1, too_many, EXEC_CAN_MAX_CYCLIC_MESSAGES + 1U ),
+        EXEC_CAN_RESULT_INVALID_ARGUMENT );
+    EXPECT_EQ( cyclic_start_call_count[0], 0U );
+}
+
+TEST_F( ExecCANTest, CyclicPayloadUpdateAndStatsRouteBothChannels )
+{
+    const EXEC_CAN_Cyclic_Entry_T entries[] = { { { 0x123U, 0U, {} }, 10U, 0U } };
+    ASSERT_EQ( EXEC_CAN_Cyclic_Start( EXEC_CAN_CHANNEL_2, entries, 1U ), EXEC_CAN_RESULT_OK );
+
+    const uint8_t data[3] = { 7U, 8U, 9U };
+    EXPECT_EQ( EXEC_CAN_Cyclic_Update_Payload( EXEC_CAN_CHANNEL_2, 0U, data, 3U ),
+               EXEC_CAN_RESULT_OK );
+    EXPECT_EQ( cyclic_update_payload[1], ( std::vector<uint8_t>{ 7U, 8U, 9U } ) );
+    EXPECT_EQ( EXEC_CAN_Cyclic_Update_Payload( EXEC_CAN_CHANNEL_2, 0U, data, 9U ),
+               EXEC_CAN_RESULT_INVALID_ARGUMENT );
+    EXPECT_EQ( EXEC_CAN_Cyclic_Update_Payload( EXEC_CAN_CHANNEL_2, 0U, nullptr, 1U ),
+               EXEC_CAN_RESULT_INVALID_ARGUMENT );
+    cyclic_update_results[1] = HW_CAN_RESULT_ERROR;
+    EXPECT_EQ( EXEC_CAN_Cyclic_Update_Payload( EXEC_CAN_CHANNEL_2, 4U, data, 3U ),
+               EXEC_CAN_RESULT_INVALID_ARGUMENT );
+
+    cyclic_stats[1] = { 10U, 1U, 2U, 120U, 480U, 95U };
+    EXEC_CAN_Cyclic_Stats_T stats{};
+    EXPECT_EQ( EXEC_CAN_Cyclic_Get_Stats( EXEC_CAN_CHANNEL_2, 0U, &stats ), EXEC_CAN_RESULT_OK );
+    EXPECT_EQ( stats.sent, 10U );
+    EXPECT_EQ( stats.missed, 1U );
+    EXPECT_EQ( stats.failed, 2U );
+    EXPECT_EQ( stats.min_latency_us, 120U );
+    EXPECT_EQ( stats.max_latency_us, 480U );
+    EXPECT_EQ( stats.max_period_error_us, 95U );
+    EXPECT_EQ( EXEC_CAN_Cyclic_Get_Stats( EXEC_CAN_CHANNEL_2, 1U, &stats ),
+               EXEC_CAN_RESULT_INVALID_ARGUMENT );
+    EXPECT_EQ( EXEC_CAN_Cyclic_Get_Stats( EXEC_CAN_CHANNEL_1, 0U, nullptr ),
+               EXEC_CAN_RESULT_INVALID_ARGUMENT );
+}
+
+TEST_F( ExecCANTest, ResponderStartRoutesBothChannelsAndConvertsEntries )
+{
+    const EXEC_CAN_Responder_Entry_T entries[] = {
+        { 0x7E0U, { 0x02U, 0x10U }, { 0xFFU, 0xFFU }, { 0x7E8U, 2U, { 0x06U, 0x50U } } },
+        { 0x123U, {}, {}, { 0x18DAF110U, 1U, { 0xAAU }, true } },
+    };
+    responder_start_results[1] = HW_CAN_RESULT_BUSY;
+
+    EXPECT_EQ( EXEC_CAN_Responder_Start( EXEC_CAN_CHANNEL_1, entries, 2U ), EXEC_CAN_RESULT_OK );
+    EXPECT_EQ( EXEC_CAN_Responder_Start( EXEC_CAN_CHANNEL_2, entries, 1U ),
+               EXEC_CAN_RESULT_BUSY );
+
+    ASSERT_EQ( responder_tables[0].size(), 2U );
+    const HW_CAN_Responder_Entry_T& first = responder_tables[0][0];
+    EXPECT_EQ( first.request_id, 0x7E0U );
+    EXPECT_EQ( first.request_data[1], 0x10U );
+    EXPECT_EQ( first.request_mask[1], 0xFFU );
+    EXPECT_EQ( first.request_mask[2], 0x00U );
+    EXPECT_EQ( first.response_id, 0x7E8U );
+    EXPECT_EQ( first.response_dlc, 2U );
+    EXPECT_EQ( first.response_data[1], 0x50U );
+    EXPECT_TRUE( responder_tables[0][1].response_extended );
+    EXPECT_EQ( responder_start_call_count[1], 1U );
+
+    EXPECT_EQ( EXEC_CAN_Responder_Stop( EXEC_CAN_CHANNEL_2 ), EXEC_CAN_RESULT_OK );
+    EXPECT_EQ( responder_stop_call_count[0], 0U );
+    EXPECT_EQ( responder_stop_call_count[1], 1U );
+}
+
+TEST_F( ExecCANTest, ResponderStartRejectsInvalidEntriesBeforeHardwareCalls )
+{
+    const EXEC_CAN_Responder_Entry_T request_high[]  = { { 0x800U, {}, {}, { 0x7E8U, 0U } } };
+    const EXEC_CAN_Responder_Entry_T response_high[] = { { 0x7E0U, {}, {}, { 0x800U, 0U } } };
+    const EXEC_CAN_Responder_Entry_T long_dlc[]      = { { 0x7E0U, {}, {}, { 0x7E8U, 9U } } };
+    EXEC_CAN_Responder_Entry_T       too_many[EXEC_CAN_MAX_RESPONDER_ENTRIES + 1U] = {};
+
+    for ( const EXEC_CAN_Responder_Entry_T* entries : { request_high, response_high, long_dlc } )
+    {
+        EXPECT_EQ( EXEC_CAN_Responder_Start( EXEC_CAN_CHANNEL_1, entries, 1U ),
+                   EXEC_CAN_RESULT_INVALID_ARGUMENT );
+    }
+    EXPECT_EQ( EXEC_CAN_Responder_Start( EXEC_CAN_CHANNEL_1, nullptr, 1U ),
+               EXEC_CAN_RESULT_INVALID_ARGUMENT );
+    EXPECT_EQ( EXEC_CAN_Responder_Start( EXEC_CAN_CHANNEL_1, too_many,
+                                         EXEC_CAN_MAX_RESPONDER_ENTRIES + 1U ),
+               EXEC_CAN_RESULT_INVALID_ARGUMENT );
+    EXPECT_EQ( responder_start_call_count[0], 0U );
+}
+
+TEST_F( ExecCANTest, ResponderStatsRouteBothChannels )
+{
+    responder_stats[1] = { 12U, 11U, 1U, 0U, 140U, 210U, 150U };
+    EXEC_CAN_Responder_Stats_T stats{};
+    EXPECT_EQ( EXEC_CAN_Responder_Get_Stats( EXEC_CAN_CHANNEL_2, &stats ), EXEC_CAN_RESULT_OK );
+    EXPECT_EQ( stats.matched, 12U );
+    EXPECT_EQ( stats.sent, 11U );
+    EXPECT_EQ( stats.missed, 1U );
+    EXPECT_EQ( stats.failed, 0U );
+    EXPECT_EQ( stats.min_latency_us, 140U );
+    EXPECT_EQ( stats.max_latency_us, 210U );
+    EXPECT_EQ( stats.last_latency_us, 150U );
+    EXPECT_EQ( EXEC_CAN_Responder_Get_Stats( EXEC_CAN_CHANNEL_1, nullptr ),
+               EXEC_CAN_RESULT_INVALID_ARGUMENT );
+}
+
+TEST_F( ExecCANTest, ReplayStartRoutesBothChannelsAndMapsResults )
+{
+    const uint8_t log[24]   = {};
+    replay_start_results[0] = HW_CAN_RESULT_OK;
+    replay_start_results[1] = HW_CAN_RESULT_BUSY;
+
+    EXPECT_EQ( EXEC_CAN_Replay_Start( EXEC_CAN_CHANNEL_1, log, sizeof( log ), 500U, 0U ),
+               EXEC_CAN_RESULT_OK );
+    EXPECT_EQ( replay_logs[0], log );
+    EXPECT_EQ( replay_lengths[0], sizeof( log ) );
+    EXPECT_EQ( replay_time_scales[0], 500U );
+    EXPECT_EQ( replay_passes[0], 0U );
+    EXPECT_EQ( EXEC_CAN_Replay_Start( EXEC_CAN_CHANNEL_2, log, sizeof( log ), 1000U, 3U ),
+               EXEC_CAN_RESULT_BUSY );
+    EXPECT_EQ( replay_passes[1], 3U );
+
+    /* The hardware only refuses a start for a malformed log or time scale */
+    replay_start_results[0] = HW_CAN_RESULT_ERROR;
+    EXPECT_EQ( EXEC_CAN_Replay_Start( EXEC_CAN_CHANNEL_1, log, sizeof( log ), 0U, 1U ),
+               EXEC_CAN_RESULT_INVALID_ARGUMENT );
+    EXPECT_EQ( EXEC_CAN_Replay_Start( EXEC_CAN_CHANNEL_1, nullptr, 0U, 1000U, 1U ),
+               EXEC_CAN_RESULT_INVALID_ARGUMENT );
+    EXPECT_EQ( replay_start_call_count[0], 2U );
+
+    EXPECT_EQ( EXEC_CAN_Replay_Stop( EXEC_CAN_CHANNEL_2 ), EXEC_CAN_RESULT_OK );
+    EXPECT_EQ( replay_stop_call_count[0], 0U );
+    EXPECT_EQ( replay_stop_call_count[1], 1U );
+}
+
+TEST_F( ExecCANTest, ReplayStatsRouteBothChannels )
+{
+    replay_stats[1] = { 40U, 1U, 2U, 3U, -12, 85, 7, 610, true };
+    EXEC_CAN_Replay_Stats_T stats{};
+    EXPECT_EQ( EXEC_CAN_Replay_Get_Stats( EXEC_CAN_CHANNEL_2, &stats ), EXEC_CAN_RESULT_OK );
+    EXPECT_EQ( stats.sent, 40U );
+    EXPECT_EQ( stats.failed, 1U );
+    EXPECT_EQ( stats.starved, 2U );
+    EXPECT_EQ( stats.passes, 3U );
+    EXPECT_EQ( stats.min_error_us, -12 );
+    EXPECT_EQ( stats.max_error_us, 85 );
+    EXPECT_EQ( stats.last_error_us, 7 );
+    EXPECT_EQ( stats.total_error_us, 610 );
+    EXPECT_TRUE( stats.complete );
+    EXPECT_EQ( EXEC_CAN_Replay_Get_Stats( EXEC_CAN_CHANNEL_1, nullptr ),
+               EXEC_CAN_RESULT_INVALID_ARGUMENT );
+}
+
+TEST_F( ExecCANTest, BusStatsRouteBothChannelsAndReset )
+{
+    bus_stats[0].tx_frames                   = 11U;
+    bus_stats[1].tx_frames                   = 12U;
+    bus_stats[1].rx_frames                   = 30U;
+    bus_stats[1].bits                        = 5000000000ULL;
+    bus_stats[1].bus_load_permille           = 412U;
+    bus_stats[1].bus_load_max_permille       = 498U;
+    bus_stats[1].tec                         = 128U;
+    bus_stats[1].error_passive               = true;
+    bus_stats[1].arbitration_id_count        = 2U;
+    bus_stats[1].arbitration_ids[1].id       = 0x1234567U;
+    bus_stats[1].arbitration_ids[1].extended = true;
+    bus_stats[1].arbitration_ids[1].count    = 9U;
+    bus_stats[1].max_recovery_us             = 2500U;
+    bus_stats[1].rx_dropped_per_s            = 4U;
+
+    EXEC_CAN_Bus_Stats_T stats{};
+    EXPECT_EQ( EXEC_CAN_Get_Bus_Stats( EXEC_CAN_CHANNEL_1, &stats ), EXEC_CAN_RESULT_OK );
+    EXPECT_EQ( stats.tx_frames, 11U );
+    EXPECT_EQ( EXEC_CAN_Get_Bus_Stats( EXEC_CAN_CHANNEL_2, &stats ), EXEC_CAN_RESULT_OK );
+    EXPECT_EQ( stats.tx_frames, 12U );
+    EXPECT_EQ( stats.rx_frames, 30U );
+    EXPECT_EQ( stats.bits, 5000000000ULL );
+    EXPECT_EQ( stats.bus_load_permille, 412U );
+    EXPECT_EQ( stats.bus_load_max_permille, 498U );
+    EXPECT_EQ( stats.tec, 128U );
+    EXPECT_TRUE( stats.error_passive );
+    EXPECT_EQ( stats.arbitration_id_count, 2U );
+    EXPECT_EQ( stats.arbitration_ids[1].id, 0x1234567U );
+    EXPECT_TRUE( stats.arbitration_ids[1].extended );
+    EXPECT_EQ( stats.arbitration_ids[1].count, 9U );
+    EXPECT_EQ( stats.max_recovery_us, 2500U );
+    EXPECT_EQ( stats.rx_dropped_per_s, 4U );
+    EXPECT_EQ( EXEC_CAN_Get_Bus_Stats( EXEC_CAN_CHANNEL_1, nullptr ),
+               EXEC_CAN_RESULT_INVALID_ARGUMENT );
+
+    EXPECT_EQ( EXEC_CAN_Reset_Bus_Stats( EXEC_CAN_CHANNEL_2 ), EXEC_CAN_RESULT_OK );
+    EXPECT_EQ( bus_stats_reset_call_count[0], 0U );
+    EXPECT_EQ( bus_stats_reset_call_count[1], 1U );
+}
+
+TEST_F( ExecCANTest, EncodeBusStatsWritesLittleEndianRecord )
+{
+    EXEC_CAN_Bus_Stats_T stats{};
+    stats.tx_frames                   = 0x01020304U;
+    stats.bits                        = 0x1122334455667788ULL;
+    stats.bus_load_max_permille       = 0x0305U;
+    stats.tec                         = 0x90U;
+    stats.rec                         = 0x05U;
+    stats.error_warning               = true;
+    stats.bus_off                     = true;
+    stats.last_error_code             = 3U;
+    stats.rx_dropped_per_s            = 0xAABBCCDDU;
+    stats.arbitration_id_count        = 2U;
+    stats.arbitration_ids[0].id       = 0x123U;
+    stats.arbitration_ids[0].count    = 7U;
+    stats.arbitration_ids[1].id       = 0x18DAF110U;
+    stats.arbitration_ids[1].extended = true;
+    stats.arbitration_ids[1].count    = 0x0100U;
+
+    uint8_t  buffer[EXEC_CAN_BUS_STATS_WIRE_MAX_SIZE] = {};
+    uint16_t length                                   = 0U;
+    EXPECT_EQ( EXEC_CAN_Encode_Bus_Stats( EXEC_CAN_CHANNEL_2, &stats, buffer, sizeof( buffer ),
+                                          &length ),
+               EXEC_CAN_RESULT_OK );
+    ASSERT_EQ( length, EXEC_CAN_BUS_STATS_WIRE_HEADER_SIZE + 16U );
+
+    EXPECT_EQ( buffer[0], EXEC_CAN_BUS_STATS_WIRE_VERSION );
+    EXPECT_EQ( buffer[1], 1U );
+    EXPECT_EQ( buffer[2], 0x05U );
+    EXPECT_EQ( buffer[3], 3U );
+    const uint8_t tx_frames[] = { 0x04U, 0x03U, 0x02U, 0x01U };
+    EXPECT_EQ( std::memcmp( &buffer[4], tx_frames, sizeof( tx_frames ) ), 0 );
+    const uint8_t bits[] = { 0x88U, 0x77U, 0x66U, 0x55U, 0x44U, 0x33U, 0x22U, 0x11U };
+    EXPECT_EQ( std::memcmp( &buffer[12], bits, sizeof( bits ) ), 0 );
+    EXPECT_EQ( buffer[42], 0x05U );
+    EXPECT_EQ( buffer[43], 0x03U );
+    EXPECT_EQ( buffer[46], 0x90U );
+    EXPECT_EQ( buffer[47], 0x05U );
+    EXPECT_EQ( buffer[50], 2U );
+    const uint8_t dropped_per_s[] = { 0xDDU, 0xCCU, 0xBBU, 0xAAU };
+    EXPECT_EQ( std::memcmp( &buffer[84], dropped_per_s, sizeof( dropped_per_s ) ), 0 );
+    const uint8_t entries[] = { 0x23U, 0x01U, 0x00U, 0x00U, 0x07U, 0x00U, 0x00U, 0x00U,
+                                0x10U, 0xF1U, 0xDAU, 0x98U, 0x00U, 0x01U, 0x00U, 0x00U };
+    EXPECT_EQ( std::memcmp( &buffer[88], entries, sizeof( entries ) ), 0 );
+
+    EXPECT_EQ( EXEC_CAN_Encode_Bus_Stats( EXEC_CAN_CHANNEL_1, &stats, buffer,
+                                          EXEC_CAN_BUS_STATS_WIRE_HEADER_SIZE + 15U, &length ),
+               EXEC_CAN_RESULT_INVALID_ARGUMENT );
+    stats.arbitration_id_count = EXEC_CAN_MAX_ARBITRATION_IDS + 1U;
+    EXPECT_EQ( EXEC_CAN_Encode_Bus_Stats( EXEC_CAN_CHANNEL_1, &stats, buffer, sizeof( buffer ),
+                                          &length ),
+               EXEC_CAN_RESULT_INVALID_ARGUMENT );
 }
@@ -0,0 +1,574 @@
+/******************************************************************************
+ *  File:       test_exec_can_isotp.cpp
+ *
+ *  Description:
+ *      Unit tests for ISO-TP segmentation, flow control, reassembly and
+ *      timeouts against a stubbed execution-layer transmit queue.
+ ******************************************************************************/
+
+#include <gtest/gtest.h>
+
+extern "C"
+{
+#include "exec_can_isotp.h"
+}
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+static std::vector<std::vector<EXEC_CAN_Packet_T>> batches;
+static EXEC_CAN_Result_T                           transmit_result;
+static EXEC_CAN_Tx_Status_T                        tx_status;
+
+extern "C" EXEC_CAN_Result_T EXEC_CAN_Transmit( EXEC_CAN_Channel_T      channel,
+                                                const EXEC_CAN_Packet_T packets[],
+                                                uint16_t                packet_count )
+{
+    EXPECT_EQ( channel, EXEC_CAN_CHANNEL_2 );
+    EXPECT_LE( packet_count, EXEC_CAN_MAX_BATCH_SIZE );
+    if ( transmit_result == EXEC_CAN_RESULT_OK )
+    {
+        batches.emplace_back( packets, packets + packet_count );
+        tx_status = EXEC_CAN_TX_STATUS_ACTIVE;
+    }
+    return transmit_result;
+}
+
+extern "C" EXEC_CAN_Tx_Status_T EXEC_CAN_Get_Tx_Status( EXEC_CAN_Channel_T channel )
+{
+    EXPECT_EQ( channel, EXEC_CAN_CHANNEL_2 );
+    return tx_status;
+}
+
+static EXEC_CAN_Packet_T Frame( std::vector<uint8_t> bytes, uint32_t timestamp_us = 0U )
+{
+    EXEC_CAN_Packet_T packet = { 0x7E8U, static_cast<uint8_t>( bytes.size() ), {}, false,
+                                 timestamp_us };
+    std::memcpy( packet.data, bytes.data(), bytes.size() );
+    return packet;
+}
+
+class ExecCANIsotpTest : public ::testing::Test
+{
+protected:
+    EXEC_CAN_Isotp_Config_T config = {};
+    EXEC_CAN_Isotp_Link_T   link   = {};
+    std::vector<uint8_t>    message;
+
+    void SetUp() override
+    {
+        batches.clear();
+        transmit_result = EXEC_CAN_RESULT_OK;
+        tx_status       = EXEC_CAN_TX_STATUS_IDLE;
+
+        config.channel      = EXEC_CAN_CHANNEL_2;
+        config.tx_id        = 0x7E0U;
+        config.rx_id        = 0x7E8U;
+        config.extended     = false;
+        config.block_size   = 0U;
+        config.st_min       = 0U;
+        config.padding      = true;
+        config.padding_byte = 0xCCU;
+        config.timeout_us   = EXEC_CAN_ISOTP_DEFAULT_TIMEOUT_US;
+        ASSERT_EQ( EXEC_CAN_Isotp_Init( &link, &config ), EXEC_CAN_RESULT_OK );
+
+        message.resize( 300U );
+        for ( size_t i = 0U; i < message.size(); i++ )
+        {
+            message[i] = static_cast<uint8_t>( i * 7U + 1U );
+        }
+    }
+
+    void Complete( uint32_t now_us )
+    {
+        tx_status = EXEC_CAN_TX_STATUS_COMPLETE;
+        EXEC_CAN_Isotp_Process( &link, now_us );
+    }
+
+    /* Reassembles the data bytes of every transmitted frame, checking the PCI on the way. */
+    std::vector<uint8_t> Payload() const
+    {
+        std::vector<uint8_t> payload;
+        uint8_t              sequence = 1U;
+        for ( const auto& batch : batches )
+        {
+            for ( const auto& packet : batch )
+            {
+                uint8_t pci = packet.data[0] >> 4;
+                if ( pci == 0x1U )
+                {
+                    payload.insert( payload.end(), packet.data + 2, packet.data + 8 );
+                }
+                else if ( pci == 0x2U )
+                {
+                    EXPECT_EQ( packet.data[0] & 0x0FU, sequence );
+                    sequence = ( sequence + 1U ) & 0x0FU;
+                    payload.insert( payload.end(), packet.data + 1, packet.data + 8 );
+                }
+            }
+        }
+        return payload;
+    }
+};
+
+TEST_F( ExecCANIsotpTest, InitRejectsInvalidConfiguration )
+{
+    EXEC_CAN_Isotp_Config_T bad = config;
+    EXPECT_EQ( EXEC_CAN_Isotp_Init( nullptr, &config ), EXEC_CAN_RESULT_INVALID_ARGUMENT );
+    EXPECT_EQ( EXEC_CAN_Isotp_Init( &link, nullptr ), EXEC_CAN_RESULT_INVALID_ARGUMENT );
+
+    bad.channel = EXEC_CAN_CHANNEL_COUNT;
+    EXPECT_EQ( EXEC_CAN_Isotp_Init( &link, &bad ), EXEC_CAN_RESULT_INVALID_ARGUMENT );
+    bad       = config;
+    bad.tx_id = 0x800U;
+    EXPECT_EQ( EXEC_CAN_Isotp_Init( &link, &bad ), EXEC_CAN_RESULT_INVALID_ARGUMENT );
+    bad.extended = true;
+    EXPECT_EQ( EXEC_CAN_Isotp_Init( &link, &bad ), EXEC_CAN_RESULT_OK );
+    bad       = config;
+    bad.rx_id = bad.tx_id;
+    EXPECT_EQ( EXEC_CAN_Isotp_Init( &link, &bad ), EXEC_CAN_RESULT_INVALID_ARGUMENT );
+    bad        = config;
+    bad.st_min = 0x80U;
+    EXPECT_EQ( EXEC_CAN_Isotp_Init( &link, &bad ), EXEC_CAN_RESULT_INVALID_ARGUMENT );
+    bad.st_min = 0xF9U;
+    EXPECT_EQ( EXEC_CAN_Isotp_Init( &link, &bad ), EXEC_CAN_RESULT_OK );
+    bad            = config;
+    bad.timeout_us = 0U;
+    EXPECT_EQ( EXEC_CAN_Isotp_Init( &link, &bad ), EXEC_CAN_RESULT_INVALID_ARGUMENT );
+}
+
+TEST_F( ExecCANIsotpTest, SingleFrameIsPaddedAndCompletesOnConfirmation )
+{
+    const uint8_t request[2] = { 0x10U, 0x03U };
+
+    EXPECT_EQ( EXEC_CAN_Isotp_Send( &link, request, 2U, 0U ), EXEC_CAN_RESULT_OK );
+    ASSERT_EQ( batches.size(), 1U );
+    ASSERT_EQ( batches[0].size(), 1U );
+    const EXEC_CAN_Packet_T& frame = batches[0][0];
+    EXPECT_EQ( frame.id, 0x7E0U );
+    EXPECT_EQ( frame.dlc, 8U );
+    EXPECT_EQ( frame.data[0], 0x02U );
+    EXPECT_EQ( frame.data[1], 0x10U );
+    EXPECT_EQ( frame.data[2], 0x03U );
+    EXPECT_EQ( frame.data[3], 0xCCU );
+    EXPECT_EQ( frame.data[7], 0xCCU );
+    EXPECT_EQ( EXEC_CAN_Isotp_Tx_Status( &link ), EXEC_CAN_ISOTP_STATUS_BUSY );
+    EXPECT_EQ( EXEC_CAN_Isotp_Send( &link, request, 2U, 0U ), EXEC_CAN_RESULT_BUSY );
+
+    EXEC_CAN_Isotp_Process( &link, 100U );
+    EXPECT_EQ( EXEC_CAN_Isotp_Tx_Status( &link ), EXEC_CAN_ISOTP_STATUS_BUSY );
+    Complete( 200U );
+    EXPECT_EQ( EXEC_CAN_Isotp_Tx_Status( &link ), EXEC_CAN_ISOTP_STATUS_COMPLETE );
+
+    link.config.padding = false;
+    EXPECT_EQ( EXEC_CAN_Isotp_Send( &link, request, 2U, 300U ), EXEC_CAN_RESULT_OK );
+    ASSERT_EQ( batches.size(), 2U );
+    EXPECT_EQ( batches[1][0].dlc, 3U );
+    EXPECT_EQ( EXEC_CAN_Isotp_Send( &link, request, 0U, 0U ), EXEC_CAN_RESULT_INVALID_ARGUMENT );
+    EXPECT_EQ( EXEC_CAN_Isotp_Send( &link, nullptr, 2U, 0U ), EXEC_CAN_RESULT_INVALID_ARGUMENT );
+}
+
+TEST_F( ExecCANIsotpTest, ConsecutiveFramesFillWholeBatchesWithoutSeparationTime )
+{
+    EXPECT_EQ( EXEC_CAN_Isotp_Send( &link, message.data(), 300U, 0U ), EXEC_CAN_RESULT_OK );
+    ASSERT_EQ( batches.size(), 1U );
+    EXPECT_EQ( batches[0][0].data[0], 0x11U );
+    EXPECT_EQ( batches[0][0].data[1], 0x2CU );
+
+    // nothing more goes out until the receiver's flow control arrives
+    Complete( 100U );
+    EXPECT_EQ( batches.size(), 1U );
+    EXEC_CAN_Packet_T flow_control = Frame( { 0x30U, 0x00U, 0x00U }, 150U );
+    EXPECT_TRUE( EXEC_CAN_Isotp_Rx_Frame( &link, &flow_control ) );
+
+    EXEC_CAN_Isotp_Process( &link, 200U );
+    ASSERT_EQ( batches.size(), 2U );
+    EXPECT_EQ( batches[1].size(), EXEC_CAN_MAX_BATCH_SIZE );
+    EXEC_CAN_Isotp_Process( &link, 250U );
+    EXPECT_EQ( batches.size(), 2U );
+
+    Complete( 3000U );
+    ASSERT_EQ( batches.size(), 3U );
+    EXPECT_EQ( batches[2].size(), EXEC_CAN_MAX_BATCH_SIZE );
+    Complete( 6000U );
+    ASSERT_EQ( batches.size(), 4U );
+    EXPECT_EQ( batches[3].size(), 4U );
+    EXPECT_EQ( EXEC_CAN_Isotp_Tx_Status( &link ), EXEC_CAN_ISOTP_STATUS_BUSY );
+    Complete( 7000U );
+    EXPECT_EQ( EXEC_CAN_Isotp_Tx_Status( &link ), EXEC_CAN_ISOTP_STATUS_COMPLETE );
+
+    std::vector<uint8_t> payload = Payload();
+    ASSERT_EQ( payload.size(), 300U );
+    EXPECT_TRUE( std::equal( message.begin(), message.end(), payload.begin() ) );
+}
+
+TEST_F( ExecCANIsotpTest, BlockSizeAndSeparationTimePaceConsecutiveFrames )
+{
+    EXEC_CAN_Packet_T flow_control = Frame( { 0x30U, 0x02U, 0xF5U }, 100U );
+
+    EXEC_CAN_Isotp_Send( &link, message.data(), 40U, 0U );
+    Complete( 50U );
+    EXEC_CAN_Isotp_Rx_Frame( &link, &flow_control );
+
+    EXEC_CAN_Isotp_Process( &link, 100U );
+    ASSERT_EQ( batches.size(), 2U );
+    EXPECT_EQ( batches[1].size(), 1U );
+
+    // 500 us must pass after the frame has been confirmed
+    Complete( 400U );
+    EXPECT_EQ( batches.size(), 2U );
+    EXEC_CAN_Isotp_Process( &link, 899U );
+    EXPECT_EQ( batches.size(), 2U );
+    EXEC_CAN_Isotp_Process( &link, 900U );
+    ASSERT_EQ( batches.size(), 3U );
+    EXPECT_EQ( batches[2][0].data[0], 0x22U );
+
+    // the block of two is spent, so the sender waits for the next flow control
+    Complete( 2000U );
+    EXEC_CAN_Isotp_Process( &link, 5000U );
+    EXPECT_EQ( batches.size(), 3U );
+    flow_control = Frame( { 0x30U, 0x00U, 0x00U }, 5100U );
+    EXEC_CAN_Isotp_Rx_Frame( &link, &flow_control );
+    EXEC_CAN_Isotp_Process( &link, 5200U );
+    ASSERT_EQ( batches.size(), 4U );
+    EXPECT_EQ( batches[3].size(), 3U );
+    Complete( 6000U );
+    EXPECT_EQ( EXEC_CAN_Isotp_Tx_Status( &link ), EXEC_CAN_ISOTP_STATUS_COMPLETE );
+
+    std::vector<uint8_t> payload = Payload();
+    EXPECT_TRUE( std::equal( message.begin(), message.begin() + 40, payload.begin() ) );
+}
+
+TEST_F( ExecCANIsotpTest, SenderHandlesWaitOverflowAndMissingFlowControl )
+{
+    EXEC_CAN_Packet_T wait = Frame( { 0x31U, 0x00U, 0x00U }, 900000U );
+
+    EXEC_CAN_Isotp_Send( &link, message.data(), 20U, 0U );
+    Complete( 100U );
+    EXEC_CAN_Isotp_Rx_Frame( &link, &wait );
+    EXEC_CAN_Isotp_Process( &link, 1000000U );
+    EXPECT_EQ( EXEC_CAN_Isotp_Tx_Status( &link ), EXEC_CAN_ISOTP_STATUS_BUSY );
+    EXEC_CAN_Isotp_Process( &link, 1900000U );
+    EXPECT_EQ( EXEC_CAN_Isotp_Tx_Status( &link ), EXEC_CAN_ISOTP_STATUS_TIMEOUT );
+
+    EXEC_CAN_Packet_T overflow = Frame( { 0x32U, 0x00U, 0x00U } );
+    EXEC_CAN_Isotp_Send( &link, message.data(), 20U, 0U );
+    Complete( 100U );
+    EXEC_CAN_Isotp_Rx_Frame( &link, &overflow );
+    EXPECT_EQ( EXEC_CAN_Isotp_Tx_Status( &link ), EXEC_CAN_ISOTP_STATUS_OVERFLOW );
+
+    EXEC_CAN_Packet_T invalid = Frame( { 0x35U, 0x00U, 0x00U } );
+    EXEC_CAN_Isotp_Send( &link, message.data(), 20U, 0U );
+    Complete( 100U );
+    EXEC_CAN_Isotp_Rx_Frame( &link, &invalid );
+    EXPECT_EQ( EXEC_CAN_Isotp_Tx_Status( &link ), EXEC_CAN_ISOTP_STATUS_PROTOCOL_ERROR );
+}
+
+TEST_F( ExecCANIsotpTest, TransmitErrorsEndTheMessage )
+{
+    transmit_result = EXEC_CAN_RESULT_BUSY;
+    EXPECT_EQ( EXEC_CAN_Isotp_Send( &link, message.data(), 20U, 0U ), EXEC_CAN_RESULT_OK );
+    EXPECT_TRUE( batches.empty() );
+
+    // a channel busy with someone else's batch only delays the first frame
+    transmit_result = EXEC_CAN_RESULT_OK;
+    EXEC_CAN_Isotp_Process( &link, 10U );
+    ASSERT_EQ( batches.size(), 1U );
+
+    tx_status = EXEC_CAN_TX_STATUS_ERROR;
+    EXEC_CAN_Isotp_Process( &link, 20U );
+    EXPECT_EQ( EXEC_CAN_Isotp_Tx_Status( &link ), EXEC_CAN_ISOTP_STATUS_ERROR );
+
+    transmit_result = EXEC_CAN_RESULT_ERROR;
+    EXPECT_EQ( EXEC_CAN_Isotp_Send( &link, message.data(), 20U, 30U ), EXEC_CAN_RESULT_OK );
+    EXPECT_EQ( EXEC_CAN_Isotp_Tx_Status( &link ), EXEC_CAN_ISOTP_STATUS_ERROR );
+}
+
+TEST_F( ExecCANIsotpTest, ReceiverReassemblesIntoCallerBufferWithFlowControl )
+{
+    link.config.block_size = 2U;
+    link.config.st_min     = 0x05U;
+    uint8_t  buffer[32]    = {};
+    uint16_t length        = 0U;
+
+    ASSERT_EQ( EXEC_CAN_Isotp_Receive_Start( &link, buffer, sizeof( buffer ) ),
+               EXEC_CAN_RESULT_OK );
+    EXPECT_EQ( EXEC_CAN_Isotp_Rx_Status( &link, &length ), EXEC_CAN_ISOTP_STATUS_BUSY );
+
+    EXEC_CAN_Packet_T first = Frame( { 0x10U, 0x1AU, 1U, 2U, 3U, 4U, 5U, 6U }, 1000U );
+    EXPECT_TRUE( EXEC_CAN_Isotp_Rx_Frame( &link, &first ) );
+    EXPECT_EQ( buffer[5], 6U );
+    EXPECT_EQ( EXEC_CAN_Isotp_Rx_Status( &link, &length ), EXEC_CAN_ISOTP_STATUS_BUSY );
+    EXPECT_EQ( length, 26U );
+
+    EXEC_CAN_Isotp_Process( &link, 1100U );
+    ASSERT_EQ( batches.size(), 1U );
+    EXPECT_EQ( batches[0][0].id, 0x7E0U );
+    EXPECT_EQ( batches[0][0].data[0], 0x30U );
+    EXPECT_EQ( batches[0][0].data[1], 2U );
+    EXPECT_EQ( batches[0][0].data[2], 0x05U );
+    Complete( 1200U );
+
+    uint8_t value = 7U;
+    for ( uint8_t sequence = 1U; sequence <= 3U; sequence++ )
+    {
+        std::vector<uint8_t> bytes = { static_cast<uint8_t>( 0x20U | sequence ) };
+        for ( uint8_t i = 0U; i < 7U; i++ )
+        {
+            bytes.push_back( static_cast<uint8_t>( value + i ) );
+        }
+        EXEC_CAN_Packet_T consecutive = Frame( bytes, 1300U + sequence );
+        value = static_cast<uint8_t>( value + 7U );
+        EXEC_CAN_Isotp_Rx_Frame( &link, &consecutive );
+        if ( sequence == 2U )
+        {
+            // the block of two is spent, so the link asks for the next one
+            EXEC_CAN_Isotp_Process( &link, 1400U );
+            ASSERT_EQ( batches.size(), 2U );
+            EXPECT_EQ( batches[1][0].data[0], 0x30U );
+            Complete( 1500U );
+        }
+    }
+
+    EXPECT_EQ( EXEC_CAN_Isotp_Rx_Status( &link, &length ), EXEC_CAN_ISOTP_STATUS_COMPLETE );
+    EXPECT_EQ( length, 26U );
+    for ( uint8_t i = 0U; i < 26U; i++ )
+    {
+        EXPECT_EQ( buffer[i], i + 1U );
+    }
+    EXPECT_EQ( buffer[26], 0U );
+}
+
+TEST_F( ExecCANIsotpTest, ReceiverRejectsOversizeBadSequenceAndSilence )
+{
+    uint8_t           buffer[16] = {};
+    uint16_t          length     = 0U;
+    EXEC_CAN_Packet_T first      = Frame( { 0x10U, 0x14U, 1U, 2U, 3U, 4U, 5U, 6U }, 1000U );
+
+    EXEC_CAN_Isotp_Receive_Start( &link, buffer, sizeof( buffer ) );
+    EXEC_CAN_Isotp_Rx_Frame( &link, &first );
+    EXPECT_EQ( EXEC_CAN_Isotp_Rx_Status( &link, &length ), EXEC_CAN_ISOTP_STATUS_OVERFLOW );
+    EXPECT_EQ( length, 20U );
+    EXEC_CAN_Isotp_Process( &link, 1100U );
+    ASSERT_EQ( batches.size(), 1U );
+    EXPECT_EQ( batches[0][0].data[0], 0x32U );
+    Complete( 1200U );
+
+    first.data[1] = 0x0AU;
+    EXEC_CAN_Isotp_Receive_Start( &link, buffer, sizeof( buffer ) );
+    EXEC_CAN_Isotp_Rx_Frame( &link, &first );
+    EXEC_CAN_Isotp_Process( &link, 1300U );
+    Complete( 1400U );
+    EXEC_CAN_Packet_T out_of_order = Frame( { 0x22U, 7U, 8U, 9U, 10U }, 1500U );
+    EXEC_CAN_Isotp_Rx_Frame( &link, &out_of_order );
+    EXPECT_EQ( EXEC_CAN_Isotp_Rx_Status( &link, nullptr ), EXEC_CAN_ISOTP_STATUS_PROTOCOL_ERROR );
+
+    EXEC_CAN_Isotp_Receive_Start( &link, buffer, sizeof( buffer ) );
+    EXEC_CAN_Isotp_Rx_Frame( &link, &first );
+    EXEC_CAN_Isotp_Process( &link, 2000U );
+    Complete( 2100U );
+    EXEC_CAN_Isotp_Process( &link, 1001999U );
+    EXPECT_EQ( EXEC_CAN_Isotp_Rx_Status( &link, nullptr ), EXEC_CAN_ISOTP_STATUS_BUSY );
+    EXEC_CAN_Isotp_Process( &link, 1002000U );
+    EXPECT_EQ( EXEC_CAN_Isotp_Rx_Status( &link, nullptr ), EXEC_CAN_ISOTP_STATUS_TIMEOUT );
+}
+
+TEST_F( ExecCANIsotpTest, SingleFramesAndForeignPacketsAreFiltered )
+{
+    uint8_t           buffer[4] = {};
+    uint16_t          length    = 0U;
+    EXEC_CAN_Packet_T single    = Frame( { 0x03U, 0x62U, 0xF1U, 0x90U } );
+
+    // frames are only taken once the link is armed
+    EXPECT_TRUE( EXEC_CAN_Isotp_Rx_Frame( &link, &single ) );
+    EXPECT_EQ( EXEC_CAN_Isotp_Rx_Status( &link, nullptr ), EXEC_CAN_ISOTP_STATUS_IDLE );
+
+    EXEC_CAN_Isotp_Receive_Start( &link, buffer, sizeof( buffer ) );
+    EXEC_CAN_Packet_T foreign = single;
+    foreign.id                = 0x7E9U;
+    EXPECT_FALSE( EXEC_CAN_Isotp_Rx_Frame( &link, &foreign ) );
+    foreign          = single;
+    foreign.extended = true;
+    EXPECT_FALSE( EXEC_CAN_Isotp_Rx_Frame( &link, &foreign ) );
+
+    EXPECT_TRUE( EXEC_CAN_Isotp_Rx_Frame( &link, &single ) );
+    EXPECT_EQ( EXEC_CAN_Isotp_Rx_Status( &link, &length ), EXEC_CAN_ISOTP_STATUS_COMPLETE );
+    EXPECT_EQ( length, 3U );
+    EXPECT_EQ( buffer[0], 0x62U );
+    EXPECT_EQ( buffer[2], 0x90U );
+
+    EXEC_CAN_Packet_T too_long = Frame( { 0x05U, 1U, 2U, 3U, 4U, 5U } );
+    EXEC_CAN_Isotp_Receive_Start( &link, buffer, sizeof( buffer ) );
+    EXEC_CAN_Isotp_Rx_Frame( &link, &too_long );
+    EXPECT_EQ( EXEC_CAN_Isotp_Rx_Status( &link, nullptr ), EXEC_CAN_ISOTP_STATUS_OVERFLOW );
+    EXPECT_TRUE( batches.empty() );
+}
+
+/**-----------------------------------------------------------------------------
+ *  Throughput Benchmark
+ *------------------------------------------------------------------------------
+ */
+
+/* Standard-ID frame with eight data bytes plus interframe space, before stuff bits */
+static constexpr double kBenchFrameBits = 111.0;
+
+struct IsotpBenchResult
+{
+    uint32_t frames;          // every frame on the bus, flow controls included
+    uint32_t blocks;          // flow controls sent by the receiver
+    uint32_t calls;           // link calls made by the sender
+    double   bus_time_us;     // first frame to last confirmation
+    double   host_us;         // host time spent inside the link calls
+};
+
+class ExecCANIsotpBenchmark : public ExecCANIsotpTest
+{
+protected:
+    /**
+     * Send message to a simulated receiver over a modelled bus.
+     *
+     * Each batch occupies the bus for its frames back to back. The receiver
+     * answers the first frame, and every block_size consecutive frames short of
+     * the end, with a flow control one frame time later. The sender processes
+     * the link on the first poll boundary after each confirmation; a zero poll
+     * period processes it as soon as the batch completes.
+     */
+    IsotpBenchResult SimulateSend( uint32_t bitrate, uint8_t block_size, double poll_us )
+    {
+        const double     frame_us = kBenchFrameBits * 1e6 / bitrate;
+        IsotpBenchResult result   = {};
+        double           now      = 0.0;
+        size_t           seen     = 0U;
+        size_t           sent     = 0U;
+        uint32_t         in_block = 0U;
+
+        auto timed = [&result]( auto call ) {
+            auto start = std::chrono::steady_clock::now();
+            call();
+            std::chrono::duration<double, std::micro> elapsed =
+                std::chrono::steady_clock::now() - start;
+            result.host_us += elapsed.count();
+            result.calls++;
+        };
+
+        timed( [this] {
+            EXEC_CAN_Isotp_Send( &link, message.data(), static_cast<uint16_t>( message.size() ),
+                                 0U );
+        } );
+        while ( EXEC_CAN_Isotp_Tx_Status( &link ) == EXEC_CAN_ISOTP_STATUS_BUSY
+                && seen < batches.size() )
+        {
+            bool flow_control = false;
+            for ( const auto& packet : batches[seen] )
+            {
+                uint8_t pci = packet.data[0] >> 4;
+                sent += ( pci == 0x1U ) ? 6U : 7U;
+                in_block++;
+                flow_control = ( pci == 0x1U )
+                               || ( block_size != 0U && in_block == block_size
+                                    && sent < message.size() );
+                if ( flow_control )
+                {
+                    in_block = 0U;
+                }
+            }
+            now += static_cast<double>( batches[seen].size() ) * frame_us;
+            result.frames += static_cast<uint32_t>( batches[seen].size() );
+            seen++;
+            tx_status = EXEC_CAN_TX_STATUS_COMPLETE;
+
+            if ( flow_control )
+            {
+                now += frame_us;
+                result.frames++;
+                result.blocks++;
+                EXEC_CAN_Packet_T fc =
+                    Frame( { 0x30U, block_size, 0x00U }, static_cast<uint32_t>( now ) );
+                timed( [this, &fc] { EXEC_CAN_Isotp_Rx_Frame( &link, &fc ); } );
+            }
+            if ( poll_us > 0.0 )
+            {
+                now = std::ceil( now / poll_us ) * poll_us;
+            }
+            timed( [this, now] { EXEC_CAN_Isotp_Process( &link, static_cast<uint32_t>( now ) ); } );
+        }
+        result.bus_time_us = now;
+        return result;
+    }
+};
+
+/**
+ * Report ISO-TP send throughput for a full-size message at 500 kbit/s and
+ * 1 Mbit/s.
+ *
+ * With STmin zero and the link processed as each batch completes, the bus
+ * carries the message back to back apart from one flow control per block, so
+ * payload throughput approaches the 7 of 8 data bytes a consecutive frame
+ * carries. A caller that only polls every millisecond leaves the bus idle
+ * between batches. Bus time is modelled; the host time is informational only.
+ */
+TEST_F( ExecCANIsotpBenchmark, SendThroughputAt500kAnd1M )
+{
+    struct Case
+    {
+        uint8_t     block_size;
+        double      poll_us;
+        const char* name;
+    };
+    const uint32_t bitrates[] = { 500000U, 1000000U };
+    const Case     cases[]    = { { 0U, 0.0, "BS 0, prompt" },
+                                  { 8U, 0.0, "BS 8, prompt" },
+                                  { 0U, 1000.0, "BS 0, 1 ms poll" } };
+
+    message.resize( EXEC_CAN_ISOTP_MAX_MESSAGE_SIZE );
+    for ( size_t i = 0U; i < message.size(); i++ )
+    {
+        message[i] = static_cast<uint8_t>( i );
+    }
+    const uint32_t consecutive = static_cast<uint32_t>( ( message.size() - 6U + 6U ) / 7U );
+
+    for ( uint32_t bitrate : bitrates )
+    {
+        const double limit_kbps = bitrate * 56.0 / kBenchFrameBits / 1e3;
+        std::printf( "ISO-TP %u-byte send at %u kbit/s, %.0f kbit/s payload bound\n",
+                     static_cast<unsigned>( message.size() ),
+                     static_cast<unsigned>( bitrate / 1000U ), limit_kbps );
+        for ( const Case& run : cases )
+        {
+            batches.clear();
+            tx_status = EXEC_CAN_TX_STATUS_IDLE;
+            ASSERT_EQ( EXEC_CAN_Isotp_Init( &link, &config ), EXEC_CAN_RESULT_OK );
+
+            IsotpBenchResult result = SimulateSend( bitrate, run.block_size, run.poll_us );
+            ASSERT_EQ( EXEC_CAN_Isotp_Tx_Status( &link ), EXEC_CAN_ISOTP_STATUS_COMPLETE );
+            std::vector<uint8_t> payload = Payload();
+            payload.resize( message.size() );   // drop the padding of the last frame
+            EXPECT_EQ( payload, message );
+
+            double kbps = static_cast<double>( message.size() ) * 8.0 / result.bus_time_us * 1e3;
+            std::printf( "  %-16s %4u frames, %3u blocks, %.2f ms per block, %4.0f kbit/s"
+                         " (%3.0f%%), host %.2f us per call\n",
+                         run.name, static_cast<unsigned>( result.frames ),
+                         static_cast<unsigned>( result.blocks ),
+                         result.bus_time_us / 1e3 / result.blocks, kbps,
+                         100.0 * kbps / limit_kbps, result.host_us / result.calls );
+
+            EXPECT_EQ( result.frames, 1U + consecutive + result.blocks );
+            if ( run.poll_us == 0.0 )
+            {
+                EXPECT_GT( kbps / limit_kbps, 0.85 );
+            }
+            if ( &run == &cases[0] )
+            {
+                RecordProperty( "payload_kbps_at_" + std::to_string( bitrate / 1000U ) + "k",
+                                static_cast<int>( kbps ) );
+            }
+        }
+    }
+}
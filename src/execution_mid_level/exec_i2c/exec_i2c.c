@@ -285,6 +285,20 @@ bool EXEC_I2C_Start_Master_Receive_External( HWI2CChannel_T channel, uint16_t de
            == HW_I2C_STATUS_OK;
 }
 
+bool EXEC_I2C_Master_Write_Read_External( HWI2CChannel_T channel, uint16_t device_address_7bit,
+                                          const uint8_t* payload, uint16_t payload_length,
+                                          uint16_t expected_length )
+{
+    if ( !EXEC_I2C_Is_External_Channel( channel ) )
+    {
+        return false;
+    }
+
+    return HW_I2C_Enqueue_Master_Write_Read( channel, device_address_7bit, payload,
+                                             payload_length, expected_length )
+           == HW_I2C_STATUS_OK;
+}
+
 /**
  * @brief Initiate slave receive on an external channel.
  *
@@ -329,6 +343,25 @@ EXECI2CStatus_T EXEC_I2C_Recover_Channel( HWI2CChannel_T channel )
     return EXEC_I2C_From_HW_Status( HW_I2C_Recover_Channel( channel ) );
 }
 
+EXECI2CStatus_T EXEC_I2C_Start_Register_Map( HWI2CChannel_T channel, uint8_t* registers,
+                                             uint16_t size, bool writable )
+{
+    return EXEC_I2C_From_HW_Status(
+        HW_I2C_Start_Register_Map( channel, registers, size, writable ) );
+}
+
+EXECI2CStatus_T EXEC_I2C_Stop_Register_Map( HWI2CChannel_T channel )
+{
+    return EXEC_I2C_From_HW_Status( HW_I2C_Stop_Register_Map( channel ) );
+}
+
+EXECI2CStatus_T EXEC_I2C_Update_Register_Map( HWI2CChannel_T channel, uint8_t first_register,
+                                              const uint8_t* data, uint16_t length )
+{
+    return EXEC_I2C_From_HW_Status(
+        HW_I2C_Update_Register_Map( channel, first_register, data, length ) );
+}
+
 EXECI2CStatus_T EXEC_I2C_Receive_Message_Copy_And_Consume(
     HWI2CChannel_T channel, uint8_t* result_storage, uint16_t result_storage_capacity,
     HWI2CRxMessageDescriptor_T* descriptor, uint16_t* bytes_copied, uint16_t* required_length )
@@ -146,6 +146,24 @@ EXEC_I2C_Receive_Copy_And_Consume().
 bool EXEC_I2C_Start_Master_Receive_External( HWI2CChannel_T channel, uint16_t device_address_7bit,
                                              uint16_t expected_length );
 
+/**
+ * @brief Queue a register read: write, repeated start, then read, with no STOP between.
+ *
+ * The read is retrieved as one complete message, like a master receive.
+ *
+ * @param[in] channel               External I2C channel (HW_I2C_CHANNEL_1 or HW_I2C_CHANNEL_2)
+ * @param[in] device_address_7bit   7-bit slave address
+ * @param[in] payload               Bytes written before the read, usually a register address
+ * @param[in] payload_length        Number of bytes to write
+ * @param[in] expected_length       Number of bytes to read
+ *
+ * @return true if the complete request was accepted into the driver queue
+ * @return false on failure
+ */
+bool EXEC_I2C_Master_Write_Read_External( HWI2CChannel_T channel, uint16_t device_address_7bit,
+                                          const uint8_t* payload, uint16_t payload_length,
+                                          uint16_t expected_length );
+
 /**
  * @brief Initiate slave receive on an external channel.
  *
@@ -188,6 +206,30 @@ EXECI2CStatus_T EXEC_I2C_Get_And_Clear_Transfer_Result( HWI2CChannel_T channel )
  */
 EXECI2CStatus_T EXEC_I2C_Recover_Channel( HWI2CChannel_T channel );
 
+/**
+ * @brief Serve a register array as an emulated register-based slave device.
+ *
+ * The slave channel answers pointer writes and reads from the array without a
+ * trigger per transaction; see HW_I2C_Start_Register_Map(). The array is owned
+ * by the caller and must outlive the map.
+ */
+EXECI2CStatus_T EXEC_I2C_Start_Register_Map( HWI2CChannel_T channel, uint8_t* registers,
+                                             uint16_t size, bool writable );
+
+/**
+ * @brief Stop serving the register map; busy while a master is addressing it.
+ */
+EXECI2CStatus_T EXEC_I2C_Stop_Register_Map( HWI2CChannel_T channel );
+
+/**
+ * @brief Publish new register values, for example from the plant model.
+ *
+ * Returns EXEC_I2C_STATUS_BUSY while a master read is in progress so a burst
+ * read never mixes two updates; retry on the next tick.
+ */
+EXECI2CStatus_T EXEC_I2C_Update_Register_Map( HWI2CChannel_T channel, uint8_t first_register,
+                                              const uint8_t* data, uint16_t length );
+
 /**
  * @brief Copy and consume exactly one complete receive transaction.
  *
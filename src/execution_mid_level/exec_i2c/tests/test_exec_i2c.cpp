@@ -56,6 +56,10 @@ class MockHWI2C
     MOCK_METHOD( HWI2CStatus_T, EnqueueMasterReceive,
                  ( HWI2CChannel_T channel, uint16_t device_address_7bit, uint16_t expected_length ),
                  () );
+    MOCK_METHOD( HWI2CStatus_T, EnqueueMasterWriteRead,
+                 ( HWI2CChannel_T channel, uint16_t device_address_7bit, const uint8_t* payload,
+                   uint16_t payload_length, uint16_t expected_length ),
+                 () );
     MOCK_METHOD( bool, LoadStageBuffer,
                  ( HWI2CChannel_T channel, const uint8_t* data, uint16_t length ), () );
     MOCK_METHOD( bool, TriggerSlaveTransmitExternal, ( HWI2CChannel_T channel ), () );
@@ -65,6 +69,14 @@ class MockHWI2C
     MOCK_METHOD( bool, IsTransactionQueueComplete, ( HWI2CChannel_T channel ), () );
     MOCK_METHOD( HWI2CStatus_T, GetAndClearTransferResult, ( HWI2CChannel_T channel ), () );
     MOCK_METHOD( HWI2CStatus_T, RecoverChannel, ( HWI2CChannel_T channel ), () );
+    MOCK_METHOD( HWI2CStatus_T, StartRegisterMap,
+                 ( HWI2CChannel_T channel, uint8_t* registers, uint16_t size, bool writable ),
+                 () );
+    MOCK_METHOD( HWI2CStatus_T, StopRegisterMap, ( HWI2CChannel_T channel ), () );
+    MOCK_METHOD( HWI2CStatus_T, UpdateRegisterMap,
+                 ( HWI2CChannel_T channel, uint8_t first_register, const uint8_t* data,
+                   uint16_t length ),
+                 () );
     MOCK_METHOD( bool, PeekReceivedMessage,
                  ( HWI2CChannel_T channel, HWI2CRxMessagePeek_T* message ), () );
     MOCK_METHOD( bool, ConsumeReceivedMessage, ( HWI2CChannel_T channel ), () );
@@ -93,6 +105,15 @@ HWI2CStatus_T HW_I2C_Enqueue_Master_Receive( HWI2CChannel_T channel, uint16_t de
     return g_mock_hw_i2c->EnqueueMasterReceive( channel, device_address_7bit, expected_length );
 }
 
+HWI2CStatus_T HW_I2C_Enqueue_Master_Write_Read( HWI2CChannel_T channel,
+                                                uint16_t       device_address_7bit,
+                                                const uint8_t* payload, uint16_t payload_length,
+                                                uint16_t expected_length )
+{
+    return g_mock_hw_i2c->EnqueueMasterWriteRead( channel, device_address_7bit, payload,
+                                                  payload_length, expected_length );
+}
+
 bool HW_I2C_Load_Stage_Buffer( HWI2CChannel_T channel, const uint8_t* data, uint16_t length )
 {
     return g_mock_hw_i2c->LoadStageBuffer( channel, data, length );
@@ -128,6 +149,23 @@ HWI2CStatus_T HW_I2C_Recover_Channel( HWI2CChannel_T channel )
     return g_mock_hw_i2c->RecoverChannel( channel );
 }
 
+HWI2CStatus_T HW_I2C_Start_Register_Map( HWI2CChannel_T channel, uint8_t* registers,
+                                         uint16_t size, bool writable )
+{
+    return g_mock_hw_i2c->StartRegisterMap( channel, registers, size, writable );
+}
+
+HWI2CStatus_T HW_I2C_Stop_Register_Map( HWI2CChannel_T channel )
+{
+    return g_mock_hw_i2c->StopRegisterMap( channel );
+}
+
+HWI2CStatus_T HW_I2C_Update_Register_Map( HWI2CChannel_T channel, uint8_t first_register,
+                                          const uint8_t* data, uint16_t length )
+{
+    return g_mock_hw_i2c->UpdateRegisterMap( channel, first_register, data, length );
+}
+
 bool HW_I2C_Peek_Received_Message( HWI2CChannel_T channel, HWI2CRxMessagePeek_T* message )
 {
     return g_mock_hw_i2c->PeekReceivedMessage( channel, message );
@@ -293,6 +331,22 @@ TEST_F( ExecI2CTest, MasterTransmitExternalRejectsNonExternalChannelWithoutLowLe
                                                      sizeof( payload ) ) );
 }
 
+TEST_F( ExecI2CTest, MasterWriteReadExternalSubmitsOneCombinedRequest )
+{
+    const uint8_t register_address = 0x3BU;
+    EXPECT_CALL( mock_hw_i2c,
+                 EnqueueMasterWriteRead( HW_I2C_CHANNEL_2, 0x68U, &register_address, 1U, 14U ) )
+        .WillOnce( Return( HW_I2C_STATUS_OK ) )
+        .WillOnce( Return( HW_I2C_STATUS_BUSY ) );
+
+    EXPECT_TRUE( EXEC_I2C_Master_Write_Read_External( HW_I2C_CHANNEL_2, 0x68U, &register_address,
+                                                      1U, 14U ) );
+    EXPECT_FALSE( EXEC_I2C_Master_Write_Read_External( HW_I2C_CHANNEL_2, 0x68U, &register_address,
+                                                       1U, 14U ) );
+    EXPECT_FALSE( EXEC_I2C_Master_Write_Read_External( HW_I2C_CHANNEL_FMPI2C1, 0x68U,
+                                                       &register_address, 1U, 14U ) );
+}
+
 TEST_F( ExecI2CTest, SlaveTransmitExternal_ForwardsBothCalls )
 {
     const uint8_t payload[] = { 0x55U };
@@ -354,6 +408,26 @@ TEST_F( ExecI2CTest, RecoveryStatusIsForwarded )
     EXPECT_EQ( EXEC_I2C_Recover_Channel( HW_I2C_CHANNEL_2 ), EXEC_I2C_STATUS_ERROR );
 }
 
+TEST_F( ExecI2CTest, RegisterMapCallsAreForwardedWithMappedStatus )
+{
+    uint8_t       registers[128] = {};
+    const uint8_t sample[6]      = { 1U, 2U, 3U, 4U, 5U, 6U };
+
+    EXPECT_CALL( mock_hw_i2c, StartRegisterMap( HW_I2C_CHANNEL_1, registers, 128U, true ) )
+        .WillOnce( Return( HW_I2C_STATUS_OK ) );
+    EXPECT_EQ( EXEC_I2C_Start_Register_Map( HW_I2C_CHANNEL_1, registers, 128U, true ),
+               EXEC_I2C_STATUS_OK );
+
+    EXPECT_CALL( mock_hw_i2c, UpdateRegisterMap( HW_I2C_CHANNEL_1, 0x3BU, sample, 6U ) )
+        .WillOnce( Return( HW_I2C_STATUS_BUSY ) );
+    EXPECT_EQ( EXEC_I2C_Update_Register_Map( HW_I2C_CHANNEL_1, 0x3BU, sample, 6U ),
+               EXEC_I2C_STATUS_BUSY );
+
+    EXPECT_CALL( mock_hw_i2c, StopRegisterMap( HW_I2C_CHANNEL_1 ) )
+        .WillOnce( Return( HW_I2C_STATUS_NOT_CONFIGURED ) );
+    EXPECT_EQ( EXEC_I2C_Stop_Register_Map( HW_I2C_CHANNEL_1 ), EXEC_I2C_STATUS_INVALID_PARAM );
+}
+
 TEST_F( ExecI2CTest, ReceiveMessageCopiesOneCompleteMessageAndConsumesIt )
 {
     const uint8_t        source[] = { 0x10U, 0x11U, 0x12U };
@@ -19,6 +19,9 @@
  *      - Consume hardware capture flags
  *      - Perform minimal validation of captured data
  *      - Convert validated tick values to frequency and duty cycle
+ *      - Drain edge capture rings and keep per-window period, duty and jitter
+ *        statistics
+ *      - Average N periods into a reciprocal frequency and duty measurement
  *
  *      Non-Responsibilities:
  *      - Timer configuration or hardware register access (handled by hw layer)
@@ -43,6 +46,7 @@
 #include <stdint.h>
 #include <stdbool.h>
 #include <stddef.h>
+#include <string.h>
 #include "exec_pwm_capture.h"
 
 /**-----------------------------------------------------------------------------
@@ -53,11 +57,64 @@
 
 #define EXEC_PWM_CAPTURE_DEFAULT_MODE HW_PWM_CAPTURE_LV_3V3
 
+#define EXEC_PWM_CAPTURE_DUTY_FULL_SCALE_BP 10000U
+#define EXEC_PWM_CAPTURE_DUTY_FULL_SCALE_PPM 1000000ULL
+#define EXEC_PWM_CAPTURE_MHZ_PER_HZ 1000ULL
+
 /**-----------------------------------------------------------------------------
  *  Typedefs / Enums / Structures
  *------------------------------------------------------------------------------
  */
 
+/**
+ * @brief Edge stream state and window accumulators of one channel.
+ *
+ * period_start_ticks is the rising edge that opened the current period and
+ * high_ticks its high time once the falling edge has been seen. The sums
+ * are 64-bit so a window cannot overflow them.
+ */
+typedef struct
+{
+    bool     has_period_start;
+    bool     has_high;
+    bool     has_last_period;
+    uint32_t period_start_ticks;
+    uint32_t high_ticks;
+    uint32_t last_period_ticks;
+
+    uint32_t periods;
+    uint32_t period_min_ticks;
+    uint32_t period_max_ticks;
+    uint64_t period_sum_ticks;
+    uint32_t duty_min_bp;
+    uint32_t duty_max_bp;
+    uint64_t duty_sum_bp;
+    uint32_t jitter_count;
+    uint32_t jitter_max_ticks;
+    uint64_t jitter_sum_ticks;
+    uint32_t gaps;
+} ExecPwmCaptureEdgeState_T;
+
+/**
+ * @brief Reciprocal measurement of one channel.
+ *
+ * The sums of the measurement in progress move to the result sums once
+ * target_periods periods have been added. With at most
+ * EXEC_PWM_CAPTURE_RECIPROCAL_MAX_PERIODS periods of 32 bits each, the sums
+ * stay below 2^42 and can be scaled by a million without overflow.
+ */
+typedef struct
+{
+    uint16_t target_periods;
+    uint16_t periods;
+    uint64_t period_sum_ticks;
+    uint64_t high_sum_ticks;
+    bool     has_result;
+    uint16_t result_periods;
+    uint64_t result_period_sum_ticks;
+    uint64_t result_high_sum_ticks;
+} ExecPwmCaptureReciprocalState_T;
+
 /**-----------------------------------------------------------------------------
  *  Public (global) and Extern Variables
  *------------------------------------------------------------------------------
@@ -70,6 +127,11 @@
 
 static bool exec_pwm_capture_channel_started[EXEC_PWM_CAPTURE_CHANNEL_COUNT];
 
+static ExecPwmCaptureEdgeState_T exec_pwm_capture_edge_state[EXEC_PWM_CAPTURE_CHANNEL_COUNT];
+
+static ExecPwmCaptureReciprocalState_T
+    exec_pwm_capture_reciprocal_state[EXEC_PWM_CAPTURE_CHANNEL_COUNT];
+
 /**-----------------------------------------------------------------------------
  *  Private (static) Function Prototypes
  *------------------------------------------------------------------------------
@@ -110,6 +172,130 @@ static inline bool EXEC_PWM_Capture_Result_Is_Valid( uint32_t period_ticks, uint
     return true;
 }
 
+/**
+ * @brief Add one period to the reciprocal measurement in progress.
+ */
+static void EXEC_PWM_Capture_Reciprocal_Add( HwPWMCaptureChannel_T channel, uint32_t period_ticks,
+                                             uint32_t high_ticks )
+{
+    ExecPwmCaptureReciprocalState_T* state = &exec_pwm_capture_reciprocal_state[channel];
+
+    if ( state->target_periods == 0U )
+    {
+        return;
+    }
+
+    state->period_sum_ticks += period_ticks;
+    state->high_sum_ticks += high_ticks;
+    state->periods++;
+
+    if ( state->periods < state->target_periods )
+    {
+        return;
+    }
+
+    state->result_periods          = state->periods;
+    state->result_period_sum_ticks = state->period_sum_ticks;
+    state->result_high_sum_ticks   = state->high_sum_ticks;
+    state->has_result              = true;
+    state->periods                 = 0U;
+    state->period_sum_ticks        = 0U;
+    state->high_sum_ticks          = 0U;
+}
+
+/**
+ * @brief Add one complete period to the window.
+ */
+static void EXEC_PWM_Capture_Add_Period( ExecPwmCaptureEdgeState_T* state, uint32_t period_ticks,
+                                         uint32_t high_ticks )
+{
+    uint32_t duty_bp =
+        ( uint32_t )( ( ( uint64_t )high_ticks * EXEC_PWM_CAPTURE_DUTY_FULL_SCALE_BP )
+                      / period_ticks );
+
+    if ( state->periods == 0U )
+    {
+        state->period_min_ticks = period_ticks;
+        state->period_max_ticks = period_ticks;
+        state->duty_min_bp      = duty_bp;
+        state->duty_max_bp      = duty_bp;
+    }
+
+    state->period_min_ticks = period_ticks < state->period_min_ticks ? period_ticks
+                                                                     : state->period_min_ticks;
+    state->period_max_ticks = period_ticks > state->period_max_ticks ? period_ticks
+                                                                     : state->period_max_ticks;
+    state->duty_min_bp      = duty_bp < state->duty_min_bp ? duty_bp : state->duty_min_bp;
+    state->duty_max_bp      = duty_bp > state->duty_max_bp ? duty_bp : state->duty_max_bp;
+    state->period_sum_ticks += period_ticks;
+    state->duty_sum_bp += duty_bp;
+    state->periods++;
+
+    if ( state->has_last_period )
+    {
+        uint32_t jitter = period_ticks > state->last_period_ticks
+                              ? period_ticks - state->last_period_ticks
+                              : state->last_period_ticks - period_ticks;
+
+        state->jitter_max_ticks = jitter > state->jitter_max_ticks ? jitter
+                                                                   : state->jitter_max_ticks;
+        state->jitter_sum_ticks += jitter;
+        state->jitter_count++;
+    }
+
+    state->last_period_ticks = period_ticks;
+    state->has_last_period   = true;
+}
+
+/**
+ * @brief Advance the edge stream by one edge.
+ *
+ * A rising edge closes the current period if its falling edge was seen. Two
+ * rising edges without a falling edge between them, or a gap, restart the
+ * stream, so no period or jitter is measured across the missing edge.
+ */
+static void EXEC_PWM_Capture_Add_Edge( HwPWMCaptureChannel_T     channel,
+                                       const HwPWMCaptureEdge_T* edge )
+{
+    ExecPwmCaptureEdgeState_T* state = &exec_pwm_capture_edge_state[channel];
+
+    if ( edge->follows_gap )
+    {
+        state->gaps++;
+        state->has_period_start = false;
+        state->has_last_period  = false;
+    }
+
+    if ( !edge->rising )
+    {
+        if ( state->has_period_start && !state->has_high )
+        {
+            state->high_ticks = edge->timestamp_ticks - state->period_start_ticks;
+            state->has_high   = true;
+        }
+        return;
+    }
+
+    if ( state->has_period_start && state->has_high )
+    {
+        uint32_t period_ticks = edge->timestamp_ticks - state->period_start_ticks;
+
+        if ( EXEC_PWM_Capture_Result_Is_Valid( period_ticks, state->high_ticks ) )
+        {
+            EXEC_PWM_Capture_Add_Period( state, period_ticks, state->high_ticks );
+            EXEC_PWM_Capture_Reciprocal_Add( channel, period_ticks, state->high_ticks );
+        }
+    }
+    else
+    {
+        state->has_last_period = false;
+    }
+
+    state->period_start_ticks = edge->timestamp_ticks;
+    state->has_period_start   = true;
+    state->has_high           = false;
+}
+
 /**-----------------------------------------------------------------------------
  *  Public Function Definitions
  *------------------------------------------------------------------------------
@@ -151,6 +337,10 @@ bool EXEC_PWM_Capture_Start_Channel( HwPWMCaptureChannel_T       channel,
         return false;
     }
 
+    memset( &exec_pwm_capture_edge_state[channel], 0, sizeof( exec_pwm_capture_edge_state[0] ) );
+    /* Restart the reciprocal measurement, keeping the selected period count. */
+    EXEC_PWM_Capture_Set_Reciprocal_Periods(
+        channel, exec_pwm_capture_reciprocal_state[channel].target_periods );
     exec_pwm_capture_channel_started[channel] = true;
 
     return true;
@@ -241,6 +431,8 @@ bool EXEC_PWM_Capture_Consume( HwPWMCaptureChannel_T channel, ExecPwmCaptureResu
     result->high_ticks   = high_ticks;
     result->is_valid     = true;
 
+    EXEC_PWM_Capture_Reciprocal_Add( channel, period_ticks, high_ticks );
+
     return true;
 }
 
@@ -277,3 +469,146 @@ bool EXEC_PWM_Capture_Convert( HwPWMCaptureChannel_T channel, const ExecPwmCaptu
 
     return true;
 }
+
+uint16_t EXEC_PWM_Capture_Drain_Edges( HwPWMCaptureChannel_T channel, HwPWMCaptureEdge_T* edges,
+                                       uint16_t max_edges )
+{
+    uint16_t limit;
+    uint16_t drained = 0U;
+
+    if ( channel >= EXEC_PWM_CAPTURE_CHANNEL_COUNT || !exec_pwm_capture_channel_started[channel] )
+    {
+        return 0U;
+    }
+
+    limit = ( edges != NULL ) ? max_edges : ( uint16_t )HW_PWM_CAPTURE_EDGE_RING_SIZE;
+
+    while ( drained < limit )
+    {
+        const HwPWMCaptureEdge_T* block;
+        uint16_t                  count = HW_PWM_Capture_Peek_Edges( channel, &block );
+
+        if ( count == 0U )
+        {
+            break;
+        }
+
+        if ( count > limit - drained )
+        {
+            count = ( uint16_t )( limit - drained );
+        }
+
+        for ( uint16_t i = 0U; i < count; i++ )
+        {
+            EXEC_PWM_Capture_Add_Edge( channel, &block[i] );
+            if ( edges != NULL )
+            {
+                edges[drained + i] = block[i];
+            }
+        }
+
+        HW_PWM_Capture_Consume_Edges( channel, count );
+        drained = ( uint16_t )( drained + count );
+    }
+
+    return drained;
+}
+
+bool EXEC_PWM_Capture_Take_Edge_Stats( HwPWMCaptureChannel_T      channel,
+                                       ExecPwmCaptureEdgeStats_T* stats )
+{
+    ExecPwmCaptureEdgeState_T* state;
+
+    if ( channel >= EXEC_PWM_CAPTURE_CHANNEL_COUNT || stats == NULL )
+    {
+        return false;
+    }
+
+    state = &exec_pwm_capture_edge_state[channel];
+    memset( stats, 0, sizeof( *stats ) );
+    stats->gaps = state->gaps;
+
+    if ( state->periods > 0U )
+    {
+        stats->periods           = state->periods;
+        stats->period_min_ticks  = state->period_min_ticks;
+        stats->period_max_ticks  = state->period_max_ticks;
+        stats->period_mean_ticks = ( uint32_t )( state->period_sum_ticks / state->periods );
+        stats->duty_min_bp       = state->duty_min_bp;
+        stats->duty_max_bp       = state->duty_max_bp;
+        stats->duty_mean_bp      = ( uint32_t )( state->duty_sum_bp / state->periods );
+    }
+
+    if ( state->jitter_count > 0U )
+    {
+        stats->jitter_max_ticks  = state->jitter_max_ticks;
+        stats->jitter_mean_ticks = ( uint32_t )( state->jitter_sum_ticks / state->jitter_count );
+    }
+
+    state->periods          = 0U;
+    state->period_sum_ticks = 0U;
+    state->duty_sum_bp      = 0U;
+    state->jitter_count     = 0U;
+    state->jitter_max_ticks = 0U;
+    state->jitter_sum_ticks = 0U;
+    state->gaps             = 0U;
+
+    return stats->periods > 0U;
+}
+
+bool EXEC_PWM_Capture_Set_Reciprocal_Periods( HwPWMCaptureChannel_T channel, uint16_t periods )
+{
+    if ( channel >= EXEC_PWM_CAPTURE_CHANNEL_COUNT
+         || periods > EXEC_PWM_CAPTURE_RECIPROCAL_MAX_PERIODS )
+    {
+        return false;
+    }
+
+    memset( &exec_pwm_capture_reciprocal_state[channel], 0,
+            sizeof( exec_pwm_capture_reciprocal_state[0] ) );
+    exec_pwm_capture_reciprocal_state[channel].target_periods = periods;
+
+    return true;
+}
+
+bool EXEC_PWM_Capture_Take_Reciprocal( HwPWMCaptureChannel_T       channel,
+                                       ExecPwmCaptureReciprocal_T* out )
+{
+    ExecPwmCaptureReciprocalState_T* state;
+    uint32_t                         clock_hz;
+    uint64_t                         total_ticks;
+
+    if ( channel >= EXEC_PWM_CAPTURE_CHANNEL_COUNT || out == NULL )
+    {
+        return false;
+    }
+
+    state = &exec_pwm_capture_reciprocal_state[channel];
+
+    if ( !state->has_result )
+    {
+        return false;
+    }
+
+    clock_hz = HW_PWM_Capture_Get_Timer_Clock_Hz( channel );
+
+    if ( clock_hz == 0U )
+    {
+        return false;
+    }
+
+    /* Both quotients are rounded to nearest. */
+    total_ticks  = state->result_period_sum_ticks;
+    out->periods = state->result_periods;
+    out->frequency_mhz =
+        ( ( uint64_t )state->result_periods * clock_hz * EXEC_PWM_CAPTURE_MHZ_PER_HZ
+          + total_ticks / 2U )
+        / total_ticks;
+    out->duty_cycle_ppm = ( uint32_t )( ( state->result_high_sum_ticks
+                                              * EXEC_PWM_CAPTURE_DUTY_FULL_SCALE_PPM
+                                          + total_ticks / 2U )
+                                        / total_ticks );
+    state->has_result = false;
+
+    return true;
+}
@@ -21,6 +21,9 @@
  *      - Consume hardware capture flags
  *      - Perform minimal validation of captured data
  *      - Convert validated tick values to frequency and duty cycle
+ *      - Drain edge capture rings and keep per-window period, duty and jitter
+ *        statistics
+ *      - Average N periods into a reciprocal frequency and duty measurement
  *
  *      Non-Responsibilities:
  *      - Timer configuration or hardware register access (handled by hw layer)
@@ -30,6 +33,11 @@
  *      - Call EXEC_PWM_Capture_Start_Channel() during configuration
  *      - Call EXEC_PWM_Capture_Consume() during execution to retrieve new data
  *      - Call EXEC_PWM_Capture_Stop_Channel() to disable capture when no longer needed
+ *      - For a channel started with capture_edges, call EXEC_PWM_Capture_Drain_Edges()
+ *        every tick and EXEC_PWM_Capture_Take_Edge_Stats() once per window
+ *      - For reciprocal measurement, select N with
+ *        EXEC_PWM_Capture_Set_Reciprocal_Periods() and collect averages with
+ *        EXEC_PWM_Capture_Take_Reciprocal()
  *
  *      Assumptions:
  *      - Channels are configured before use
@@ -59,6 +67,9 @@ extern "C"
  *------------------------------------------------------------------------------
  */
 
+/* Most periods one reciprocal measurement averages. */
+#define EXEC_PWM_CAPTURE_RECIPROCAL_MAX_PERIODS ( 1024U )
+
 /**-----------------------------------------------------------------------------
  *  Public Typedefs / Enums / Structures
  *------------------------------------------------------------------------------
@@ -91,6 +102,46 @@ typedef struct
     uint32_t duty_cycle_bp;  // basis points, 0–10000 (1bp = 0.01%)
 } ExecPwmCapturePhysical_T;
 
+/**
+ * @brief PWM statistics over one window of edge capture.
+ *
+ * A period runs from one rising edge to the next and counts only when a
+ * falling edge lies between them. Periods are in timer ticks and duty cycle
+ * in basis points. Jitter is the cycle-to-cycle change in period: the largest
+ * and the mean absolute difference between consecutive periods.
+ *
+ * gaps counts breaks in the edge stream from lost edges; the period around a
+ * gap and the jitter across it are not measured. All other fields are zero
+ * when periods is zero.
+ */
+typedef struct
+{
+    uint32_t periods;
+    uint32_t period_min_ticks;
+    uint32_t period_max_ticks;
+    uint32_t period_mean_ticks;
+    uint32_t duty_min_bp;
+    uint32_t duty_max_bp;
+    uint32_t duty_mean_bp;
+    uint32_t jitter_max_ticks;
+    uint32_t jitter_mean_ticks;
+    uint32_t gaps;
+} ExecPwmCaptureEdgeStats_T;
+
+/**
+ * @brief Reciprocal measurement averaged over a number of periods.
+ *
+ * frequency_mhz is periods times the timer clock divided by the total time of
+ * those periods, in milli-hertz. duty_cycle_ppm is their total high time over
+ * their total time, in parts per million (0–1000000).
+ */
+typedef struct
+{
+    uint32_t periods;
+    uint64_t frequency_mhz;
+    uint32_t duty_cycle_ppm;
+} ExecPwmCaptureReciprocal_T;
+
 /**-----------------------------------------------------------------------------
  *  Public Function Prototypes
  *------------------------------------------------------------------------------
@@ -189,6 +240,68 @@ bool EXEC_PWM_Capture_Stop_Channel( HwPWMCaptureChannel_T channel );
 bool EXEC_PWM_Capture_Convert( HwPWMCaptureChannel_T channel, const ExecPwmCaptureResult_T* raw,
                                ExecPwmCapturePhysical_T* out );
 
+/**
+ * @brief Drain captured edges into the window statistics.
+ *
+ * Takes edges from the hardware edge ring in capture order and adds them to
+ * the channel's window statistics. When edges is not NULL each drained edge is
+ * also copied there for protocol decoding, and at most max_edges are drained
+ * so none are lost; the rest stay in the ring for the next call. When edges is
+ * NULL at most one ring's worth is drained.
+ *
+ * @param channel   Logical PWM capture channel started with capture_edges.
+ * @param edges     Optional output for the drained edges.
+ * @param max_edges Capacity of edges; ignored when edges is NULL.
+ *
+ * @return Number of edges drained; 0 if the channel is invalid or not started.
+ */
+uint16_t EXEC_PWM_Capture_Drain_Edges( HwPWMCaptureChannel_T channel, HwPWMCaptureEdge_T* edges,
+                                       uint16_t max_edges );
+
+/**
+ * @brief Return the window statistics and start a new window.
+ *
+ * The window covers the edges drained since the previous call or since the
+ * channel started. A period that spans two windows counts in the one its
+ * closing rising edge is drained in.
+ *
+ * @return true if the window holds at least one period.
+ * @return false if the channel is invalid, stats is NULL, or no period was measured.
+ */
+bool EXEC_PWM_Capture_Take_Edge_Stats( HwPWMCaptureChannel_T      channel,
+                                       ExecPwmCaptureEdgeStats_T* stats );
+
+/**
+ * @brief Select how many periods each reciprocal measurement of a channel averages.
+ *
+ * Periods are taken from EXEC_PWM_Capture_Consume() results and, on a channel
+ * started with capture_edges, from EXEC_PWM_Capture_Drain_Edges(). Edge
+ * capture supplies consecutive periods, so the measurement is a true
+ * reciprocal count over N whole periods with a resolution of one timer tick
+ * in their total time. Consumed results average whichever periods were
+ * sampled. Selecting discards the measurement in progress; the selection is
+ * kept when the channel is stopped and started again.
+ *
+ * @param periods Periods per measurement; 0 turns reciprocal measurement off.
+ *
+ * @return false if the channel is invalid or periods exceeds
+ *         EXEC_PWM_CAPTURE_RECIPROCAL_MAX_PERIODS.
+ */
+bool EXEC_PWM_Capture_Set_Reciprocal_Periods( HwPWMCaptureChannel_T channel, uint16_t periods );
+
+/**
+ * @brief Return the latest completed reciprocal measurement.
+ *
+ * Each measurement is returned once. When measurements complete faster than
+ * they are taken, only the latest is kept.
+ *
+ * @return true if a measurement completed since the previous call.
+ * @return false if the channel is invalid, out is NULL, no measurement is
+ *         ready, or the timer clock is unknown.
+ */
+bool EXEC_PWM_Capture_Take_Reciprocal( HwPWMCaptureChannel_T       channel,
+                                       ExecPwmCaptureReciprocal_T* out );
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,265 @@
+/******************************************************************************
+ *  File:       exec_pwm_capture_sent.c
+ *  Author:     Callum Rafferty
+ *  Created:    18-Oct-2026
+ *
+ *  Description:
+ *      Implementation of the SENT fast channel decoder.
+ *
+ *  Notes:
+ *      A nibble of value n lasts 12 + n ticks and the sync pulse 56, each
+ *      measured from one falling edge to the next. A pulse is converted to
+ *      ticks against the sync pulse of its own frame and rounded to the
+ *      nearest tick, so the decoder follows the sensor's clock rather than
+ *      the configured tick time.
+ *
+ *      The CRC is the 4-bit CRC of J2716, polynomial x^4 + x^3 + x^2 + 1 and
+ *      seed 0101, over the data nibbles only. The 2010 issue appends a zero
+ *      nibble before taking the result.
+ ******************************************************************************/
+
+/**-----------------------------------------------------------------------------
+ *  Includes
+ *------------------------------------------------------------------------------
+ */
+
+#include "exec_pwm_capture_sent.h"
+#include <stddef.h>
+#include <string.h>
+
+/**-----------------------------------------------------------------------------
+ *  Defines / Macros
+ *------------------------------------------------------------------------------
+ */
+
+#define EXEC_PWM_CAPTURE_SENT_NS_PER_S ( 1000000000ULL )
+
+#define EXEC_PWM_CAPTURE_SENT_SYNC_TICKS ( 56U )
+#define EXEC_PWM_CAPTURE_SENT_NIBBLE_MIN_TICKS ( 12U )
+#define EXEC_PWM_CAPTURE_SENT_NIBBLE_MAX_TICKS ( 27U )
+
+/* Status and CRC nibbles around the data nibbles. */
+#define EXEC_PWM_CAPTURE_SENT_FRAME_OVERHEAD_NIBBLES ( 2U )
+
+#define EXEC_PWM_CAPTURE_SENT_CRC_SEED ( 0x5U )
+
+/**-----------------------------------------------------------------------------
+ *  Typedefs / Enums / Structures
+ *------------------------------------------------------------------------------
+ */
+
+typedef enum
+{
+    EXEC_PWM_CAPTURE_SENT_STAGE_HUNT = 0,
+    EXEC_PWM_CAPTURE_SENT_STAGE_NIBBLES,
+    EXEC_PWM_CAPTURE_SENT_STAGE_PAUSE,
+} ExecPwmCaptureSentStage_T;
+
+/**-----------------------------------------------------------------------------
+ *  Private (static) Variables
+ *------------------------------------------------------------------------------
+ */
+
+/* CRC of each register value shifted by one nibble. */
+static const uint8_t EXEC_PWM_CAPTURE_SENT_CRC_TABLE[16] = {
+    0U, 13U, 7U, 10U, 14U, 3U, 9U, 4U, 1U, 12U, 6U, 11U, 15U, 2U, 8U, 5U,
+};
+
+/**-----------------------------------------------------------------------------
+ *  Private Function Definitions
+ *------------------------------------------------------------------------------
+ */
+
+static uint8_t EXEC_PWM_Capture_Sent_Crc( const uint8_t data[], uint8_t count, bool legacy )
+{
+    uint8_t crc = EXEC_PWM_CAPTURE_SENT_CRC_SEED;
+
+    for ( uint8_t i = 0U; i < count; i++ )
+    {
+        crc = data[i] ^ EXEC_PWM_CAPTURE_SENT_CRC_TABLE[crc];
+    }
+
+    return legacy ? crc : EXEC_PWM_CAPTURE_SENT_CRC_TABLE[crc];
+}
+
+/** Length of a pulse in sensor ticks, rounded, against the frame's sync pulse. */
+static uint32_t EXEC_PWM_Capture_Sent_Ticks( uint32_t period_ticks, uint32_t sync_ticks )
+{
+    uint64_t scaled = ( uint64_t )period_ticks * EXEC_PWM_CAPTURE_SENT_SYNC_TICKS * 2U + sync_ticks;
+    return ( uint32_t )( scaled / ( 2U * ( uint64_t )sync_ticks ) );
+}
+
+static void EXEC_PWM_Capture_Sent_Finish_Frame( ExecPwmCaptureSentDecoder_T* decoder,
+                                                ExecPwmCaptureSentFrame_T    frames[],
+                                                uint16_t max_frames, uint16_t* written )
+{
+    const ExecPwmCaptureSentConfig_T* config = &decoder->config;
+    const uint8_t*                    data   = &decoder->nibbles[1];
+    uint8_t crc = decoder->nibbles[config->data_nibbles + 1U];
+
+    if ( EXEC_PWM_Capture_Sent_Crc( data, config->data_nibbles, config->legacy_crc ) != crc )
+    {
+        decoder->counters.crc_errors++;
+        return;
+    }
+
+    decoder->counters.frames++;
+    if ( *written >= max_frames )
+    {
+        decoder->counters.dropped++;
+        return;
+    }
+
+    ExecPwmCaptureSentFrame_T* frame = &frames[*written];
+    memset( frame, 0, sizeof( *frame ) );
+    frame->timestamp_ticks           = decoder->sync_start_ticks;
+    frame->tick_ns                   = ( uint32_t )(
+        ( ( uint64_t )decoder->sync_ticks * EXEC_PWM_CAPTURE_SENT_NS_PER_S
+          + ( uint64_t )config->timer_clock_hz * EXEC_PWM_CAPTURE_SENT_SYNC_TICKS / 2U )
+        / ( ( uint64_t )config->timer_clock_hz * EXEC_PWM_CAPTURE_SENT_SYNC_TICKS ) );
+    frame->status       = decoder->nibbles[0];
+    frame->data_nibbles = config->data_nibbles;
+    frame->crc          = crc;
+    memcpy( frame->data, data, config->data_nibbles );
+    ( *written )++;
+}
+
+/**
+ * @brief Decode one pulse, from the falling edge at start_ticks to the next.
+ *
+ * A pulse within the sync window starts a new frame wherever it falls, so a
+ * frame cut short by one is counted as a nibble error and decoding picks up
+ * at the new sync pulse.
+ */
+static void EXEC_PWM_Capture_Sent_Pulse( ExecPwmCaptureSentDecoder_T* decoder,
+                                         uint32_t period_ticks, uint32_t start_ticks,
+                                         ExecPwmCaptureSentFrame_T frames[], uint16_t max_frames,
+                                         uint16_t* written )
+{
+    if ( decoder->stage == EXEC_PWM_CAPTURE_SENT_STAGE_PAUSE )
+    {
+        decoder->stage = EXEC_PWM_CAPTURE_SENT_STAGE_HUNT;
+        return;
+    }
+
+    if ( period_ticks >= decoder->sync_min_ticks && period_ticks <= decoder->sync_max_ticks )
+    {
+        if ( decoder->stage == EXEC_PWM_CAPTURE_SENT_STAGE_NIBBLES )
+        {
+            decoder->counters.nibble_errors++;
+        }
+
+        decoder->stage            = EXEC_PWM_CAPTURE_SENT_STAGE_NIBBLES;
+        decoder->nibble_count     = 0U;
+        decoder->sync_ticks       = period_ticks;
+        decoder->sync_start_ticks = start_ticks;
+        return;
+    }
+
+    if ( decoder->stage != EXEC_PWM_CAPTURE_SENT_STAGE_NIBBLES )
+    {
+        return;
+    }
+
+    uint32_t ticks = EXEC_PWM_Capture_Sent_Ticks( period_ticks, decoder->sync_ticks );
+    if ( ticks < EXEC_PWM_CAPTURE_SENT_NIBBLE_MIN_TICKS
+         || ticks > EXEC_PWM_CAPTURE_SENT_NIBBLE_MAX_TICKS )
+    {
+        decoder->counters.nibble_errors++;
+        decoder->stage = EXEC_PWM_CAPTURE_SENT_STAGE_HUNT;
+        return;
+    }
+
+    decoder->nibbles[decoder->nibble_count++] =
+        ( uint8_t )( ticks - EXEC_PWM_CAPTURE_SENT_NIBBLE_MIN_TICKS );
+    if ( decoder->nibble_count
+         < decoder->config.data_nibbles + EXEC_PWM_CAPTURE_SENT_FRAME_OVERHEAD_NIBBLES )
+    {
+        return;
+    }
+
+    decoder->stage = decoder->config.pause_pulse ? EXEC_PWM_CAPTURE_SENT_STAGE_PAUSE
+                                                 : EXEC_PWM_CAPTURE_SENT_STAGE_HUNT;
+    EXEC_PWM_Capture_Sent_Finish_Frame( decoder, frames, max_frames, written );
+}
+
+/**-----------------------------------------------------------------------------
+ *  Public Function Definitions
+ *------------------------------------------------------------------------------
+ */
+
+bool EXEC_PWM_Capture_Sent_Init( ExecPwmCaptureSentDecoder_T*      decoder,
+                                 const ExecPwmCaptureSentConfig_T* config )
+{
+    if ( decoder == NULL || config == NULL || config->tick_ns == 0U
+         || config->timer_clock_hz == 0U || config->data_nibbles == 0U
+         || config->data_nibbles > EXEC_PWM_CAPTURE_SENT_MAX_DATA_NIBBLES )
+    {
+        return false;
+    }
+
+    uint64_t tick_timer_ticks =
+        ( ( uint64_t )config->tick_ns * config->timer_clock_hz ) / EXEC_PWM_CAPTURE_SENT_NS_PER_S;
+    uint64_t sync_ticks = tick_timer_ticks * EXEC_PWM_CAPTURE_SENT_SYNC_TICKS;
+    uint64_t sync_min_ticks =
+        sync_ticks * ( 100U - EXEC_PWM_CAPTURE_SENT_SYNC_TOLERANCE_PERCENT ) / 100U;
+    uint64_t sync_max_ticks =
+        sync_ticks * ( 100U + EXEC_PWM_CAPTURE_SENT_SYNC_TOLERANCE_PERCENT ) / 100U;
+
+    if ( tick_timer_ticks == 0U || sync_max_ticks > UINT32_MAX )
+    {
+        return false;
+    }
+
+    memset( decoder, 0, sizeof( *decoder ) );
+    decoder->config         = *config;
+    decoder->sync_min_ticks = ( uint32_t )sync_min_ticks;
+    decoder->sync_max_ticks = ( uint32_t )sync_max_ticks;
+    decoder->stage          = EXEC_PWM_CAPTURE_SENT_STAGE_HUNT;
+
+    return true;
+}
+
+uint16_t EXEC_PWM_Capture_Sent_Decode( ExecPwmCaptureSentDecoder_T* decoder,
+                                       const HwPWMCaptureEdge_T edges[], uint16_t edge_count,
+                                       ExecPwmCaptureSentFrame_T frames[], uint16_t max_frames )
+{
+    uint16_t written = 0U;
+
+    if ( decoder == NULL || edges == NULL || ( frames == NULL && max_frames > 0U ) )
+    {
+        return 0U;
+    }
+
+    for ( uint16_t i = 0U; i < edge_count; i++ )
+    {
+        const HwPWMCaptureEdge_T* edge = &edges[i];
+
+        if ( edge->follows_gap )
+        {
+            decoder->counters.gaps++;
+            decoder->gap_pending = true;
+        }
+
+        if ( edge->rising )
+        {
+            continue;
+        }
+
+        if ( decoder->gap_pending || !decoder->has_last_fall )
+        {
+            decoder->gap_pending     = false;
+            decoder->has_last_fall   = true;
+            decoder->last_fall_ticks = edge->timestamp_ticks;
+            decoder->stage           = EXEC_PWM_CAPTURE_SENT_STAGE_HUNT;
+            continue;
+        }
+
+        uint32_t start_ticks     = decoder->last_fall_ticks;
+        decoder->last_fall_ticks = edge->timestamp_ticks;
+        EXEC_PWM_Capture_Sent_Pulse( decoder, edge->timestamp_ticks - start_ticks, start_ticks,
+                                     frames, max_frames, &written );
+    }
+
+    return written;
+}
@@ -0,0 +1,168 @@
+/******************************************************************************
+ *  File:       exec_pwm_capture_sent.h
+ *  Author:     Callum Rafferty
+ *  Created:    18-Oct-2026
+ *
+ *  Description:
+ *      SAE J2716 SENT fast channel decoder fed from the edge capture stream.
+ *
+ *      Measures the time between falling edges, finds the 56-tick
+ *      calibration (sync) pulse, derives the tick time from it and decodes the
+ *      status nibble, the data nibbles and the CRC nibble of each frame.
+ *      Frames that pass the CRC check are written to caller storage with the
+ *      timer timestamp of their sync pulse.
+ *
+ *  Notes:
+ *      Pure logic. The caller drains edges with EXEC_PWM_Capture_Drain_Edges()
+ *      and passes each block to EXEC_PWM_Capture_Sent_Decode(); the decoder
+ *      keeps its state between blocks, so a frame may span any number of
+ *      them.
+ *
+ *      The input is expected non-inverted: each nibble starts with the
+ *      falling edge of the sensor's low pulse. Only falling edges are timed.
+ *
+ *      Every frame is calibrated from its own sync pulse, so sensors whose
+ *      clock is anywhere within EXEC_PWM_CAPTURE_SENT_SYNC_TOLERANCE_PERCENT
+ *      of the configured tick time decode correctly. Slow and enhanced
+ *      serial messages carried in the status nibble are left to the caller.
+ ******************************************************************************/
+
+#ifndef EXEC_PWM_CAPTURE_SENT_H
+#define EXEC_PWM_CAPTURE_SENT_H
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/**-----------------------------------------------------------------------------
+ *  Includes
+ *------------------------------------------------------------------------------
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "hw_pwm_capture.h"
+
+/**-----------------------------------------------------------------------------
+ *  Public Defines / Macros
+ *------------------------------------------------------------------------------
+ */
+
+/* Most data nibbles a SENT fast channel frame carries. */
+#define EXEC_PWM_CAPTURE_SENT_MAX_DATA_NIBBLES ( 6U )
+
+/* Sync pulses up to this far from the configured length are accepted. */
+#define EXEC_PWM_CAPTURE_SENT_SYNC_TOLERANCE_PERCENT ( 20U )
+
+/**-----------------------------------------------------------------------------
+ *  Public Typedefs / Enums / Structures
+ *------------------------------------------------------------------------------
+ */
+
+/**
+ * @brief Fixed properties of the SENT sensor on a channel.
+ *
+ * tick_ns is the sensor's nominal clock tick, 3000 ns for most sensors.
+ * timer_clock_hz is the clock of the capture timer, from
+ * HW_PWM_Capture_Get_Timer_Clock_Hz(). With pause_pulse set the pulse after
+ * each CRC nibble is skipped as a pause pulse. legacy_crc selects the CRC of
+ * the 2008 issue of J2716, which leaves out the trailing zero nibble.
+ */
+typedef struct
+{
+    uint32_t tick_ns;
+    uint32_t timer_clock_hz;
+    uint8_t  data_nibbles;
+    bool     pause_pulse;
+    bool     legacy_crc;
+} ExecPwmCaptureSentConfig_T;
+
+/**
+ * @brief One decoded SENT frame.
+ *
+ * timestamp_ticks is the capture timer value at the falling edge that starts
+ * the sync pulse. tick_ns is the tick time measured from that sync pulse.
+ */
+typedef struct
+{
+    uint32_t timestamp_ticks;
+    uint32_t tick_ns;
+    uint8_t  status;
+    uint8_t  data[EXEC_PWM_CAPTURE_SENT_MAX_DATA_NIBBLES];
+    uint8_t  data_nibbles;
+    uint8_t  crc;
+} ExecPwmCaptureSentFrame_T;
+
+/**
+ * @brief Decoder counters, from the last EXEC_PWM_Capture_Sent_Init().
+ *
+ * frames counts frames that passed the CRC check, including those dropped
+ * because the output was full. nibble_errors counts frames ended by a pulse
+ * that is neither a nibble nor a sync pulse, or cut short by a sync pulse.
+ * gaps counts breaks in the edge stream; the frame in progress is abandoned.
+ */
+typedef struct
+{
+    uint32_t frames;
+    uint32_t crc_errors;
+    uint32_t nibble_errors;
+    uint32_t dropped;
+    uint32_t gaps;
+} ExecPwmCaptureSentCounters_T;
+
+/**
+ * @brief Decoder of one channel. Fields other than counters are private to
+ *        exec_pwm_capture_sent.c.
+ */
+typedef struct
+{
+    ExecPwmCaptureSentConfig_T   config;
+    uint32_t                     sync_min_ticks;
+    uint32_t                     sync_max_ticks;
+
+    bool                         has_last_fall;
+    bool                         gap_pending;
+    uint32_t                     last_fall_ticks;
+    uint8_t                      stage;
+    uint8_t                      nibble_count;
+    uint8_t                      nibbles[EXEC_PWM_CAPTURE_SENT_MAX_DATA_NIBBLES + 2U];
+    uint32_t                     sync_ticks;
+    uint32_t                     sync_start_ticks;
+
+    ExecPwmCaptureSentCounters_T counters;
+} ExecPwmCaptureSentDecoder_T;
+
+/**-----------------------------------------------------------------------------
+ *  Public Function Prototypes
+ *------------------------------------------------------------------------------
+ */
+
+/**
+ * @brief Set up a decoder and clear its counters.
+ *
+ * @return false if an argument is null, tick_ns or timer_clock_hz is zero,
+ *         data_nibbles is zero or above EXEC_PWM_CAPTURE_SENT_MAX_DATA_NIBBLES,
+ *         or a tick is shorter than one timer tick.
+ */
+bool EXEC_PWM_Capture_Sent_Init( ExecPwmCaptureSentDecoder_T*      decoder,
+                                 const ExecPwmCaptureSentConfig_T* config );
+
+/**
+ * @brief Decode one block of captured edges.
+ *
+ * Edges must be passed in capture order, each exactly once. Frames completed
+ * in the block are written to frames; once max_frames have been written,
+ * further frames are counted as dropped.
+ *
+ * @return Number of frames written.
+ */
+uint16_t EXEC_PWM_Capture_Sent_Decode( ExecPwmCaptureSentDecoder_T* decoder,
+                                       const HwPWMCaptureEdge_T edges[], uint16_t edge_count,
+                                       ExecPwmCaptureSentFrame_T frames[], uint16_t max_frames );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* EXEC_PWM_CAPTURE_SENT_H */
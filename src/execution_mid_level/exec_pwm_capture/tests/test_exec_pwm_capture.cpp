@@ -18,6 +18,8 @@
 
 #include <gtest/gtest.h>
 #include <gmock/gmock.h>
+#include <cmath>
+#include <vector>
 #include "exec_pwm_capture.c"
 
 extern "C"
@@ -38,6 +40,8 @@ using ::testing::Return;
  *------------------------------------------------------------------------------
  */
 
+static constexpr uint32_t TIMER_CLOCK_HZ = 90000000U;
+
 /**-----------------------------------------------------------------------------
  *  Test Doubles / Mocks
  *------------------------------------------------------------------------------
@@ -54,12 +58,19 @@ class MockHwPwmCapture
 
 static MockHwPwmCapture* g_mock_hw = nullptr;
 
+/* Edge ring fake: Peek hands out at most g_fake_edge_block edges to mimic the ring wrap. */
+static std::vector<HwPWMCaptureEdge_T> g_fake_edges;
+static size_t                          g_fake_edge_tail;
+static uint16_t                        g_fake_edge_block;
+
 static void Reset_Exec_PWM_Capture_State( void )
 {
     for ( uint32_t i = 0U; i < EXEC_PWM_CAPTURE_CHANNEL_COUNT; i++ )
     {
         exec_pwm_capture_channel_started[i] = false;
     }
+    memset( exec_pwm_capture_edge_state, 0, sizeof( exec_pwm_capture_edge_state ) );
+    memset( exec_pwm_capture_reciprocal_state, 0, sizeof( exec_pwm_capture_reciprocal_state ) );
 }
 
 extern "C"
@@ -84,6 +95,27 @@ uint32_t HW_PWM_Capture_Get_Timer_Clock_Hz( HwPWMCaptureChannel_T channel )
 {
     return g_mock_hw->Get_Timer_Clock_Hz( channel );
 }
+
+uint16_t HW_PWM_Capture_Peek_Edges( HwPWMCaptureChannel_T      channel,
+                                   const HwPWMCaptureEdge_T** edges )
+{
+    ( void )channel;
+    size_t available = g_fake_edges.size() - g_fake_edge_tail;
+    *edges           = g_fake_edges.data() + g_fake_edge_tail;
+    return static_cast<uint16_t>( available < g_fake_edge_block ? available : g_fake_edge_block );
+}
+
+void HW_PWM_Capture_Consume_Edges( HwPWMCaptureChannel_T channel, uint16_t count )
+{
+    ( void )channel;
+    g_fake_edge_tail += count;
+}
+
+uint32_t HW_PWM_Capture_Get_Lost_Edges( HwPWMCaptureChannel_T channel )
+{
+    ( void )channel;
+    return 0U;
+}
 }
 
 /**-----------------------------------------------------------------------------
@@ -104,6 +136,10 @@ class ExecPWMCaptureTest : public ::testing::Test
         period_ticks = 0U;
         high_ticks   = 0U;
         Reset_Exec_PWM_Capture_State();
+
+        g_fake_edges.clear();
+        g_fake_edge_tail  = 0U;
+        g_fake_edge_block = HW_PWM_CAPTURE_EDGE_RING_SIZE;
     }
 
     void TearDown( void ) override
@@ -119,6 +155,25 @@ class ExecPWMCaptureTest : public ::testing::Test
         hw_result.high_ticks           = high;
         return hw_result;
     }
+
+    void StartEdgeChannel( void )
+    {
+        HwPWMCaptureConfig_T config = {};
+        config.mode                 = HW_PWM_CAPTURE_LV_3V3;
+        config.is_enabled           = true;
+        config.capture_edges        = true;
+
+        EXPECT_CALL( mock_hw, Configure_Channel( HW_PWM_CAPTURE_CHANNEL_1, _ ) )
+            .WillOnce( Return( true ) );
+        ASSERT_TRUE( EXEC_PWM_Capture_Start_Channel( HW_PWM_CAPTURE_CHANNEL_1, &config ) );
+    }
+
+    /* Queue one PWM cycle: rising edge at start, falling edge high ticks later. */
+    static void QueueCycle( uint32_t start, uint32_t high, bool follows_gap = false )
+    {
+        g_fake_edges.push_back( HwPWMCaptureEdge_T{ start, true, follows_gap } );
+        g_fake_edges.push_back( HwPWMCaptureEdge_T{ start + high, false, false } );
+    }
 };
 
 /**-----------------------------------------------------------------------------
@@ -431,4 +486,215 @@ TEST_F( ExecPWMCaptureTest, ConvertProducesFullDutyCycleForHundredPercent )
 
     EXPECT_TRUE( EXEC_PWM_Capture_Convert( HW_PWM_CAPTURE_CHANNEL_1, &raw, &out ) );
     EXPECT_EQ( out.duty_cycle_bp, 10000U );
-}
\ No newline at end of file
+}
+
+TEST_F( ExecPWMCaptureTest, DrainEdgesReturnsZeroWhenChannelNotStarted )
+{
+    QueueCycle( 0U, 500U );
+
+    EXPECT_EQ( EXEC_PWM_Capture_Drain_Edges( HW_PWM_CAPTURE_CHANNEL_1, nullptr, 0U ), 0U );
+    EXPECT_EQ( g_fake_edge_tail, 0U );
+}
+
+TEST_F( ExecPWMCaptureTest, DrainEdgesCopiesEdgesAcrossRingWrapUpToCapacity )
+{
+    HwPWMCaptureEdge_T edges[5] = {};
+    StartEdgeChannel();
+    QueueCycle( 0U, 500U );
+    QueueCycle( 1000U, 500U );
+    QueueCycle( 2000U, 500U );
+    g_fake_edge_block = 3U;
+
+    EXPECT_EQ( EXEC_PWM_Capture_Drain_Edges( HW_PWM_CAPTURE_CHANNEL_1, edges, 5U ), 5U );
+    EXPECT_EQ( g_fake_edge_tail, 5U );
+    EXPECT_EQ( edges[3].timestamp_ticks, 1500U );
+    EXPECT_FALSE( edges[3].rising );
+    EXPECT_EQ( edges[4].timestamp_ticks, 2000U );
+    EXPECT_TRUE( edges[4].rising );
+
+    EXPECT_EQ( EXEC_PWM_Capture_Drain_Edges( HW_PWM_CAPTURE_CHANNEL_1, edges, 5U ), 1U );
+    EXPECT_EQ( edges[0].timestamp_ticks, 2500U );
+}
+
+TEST_F( ExecPWMCaptureTest, TakeEdgeStatsReportsPeriodDutyAndJitter )
+{
+    ExecPwmCaptureEdgeStats_T stats = {};
+    StartEdgeChannel();
+    QueueCycle( 0U, 250U );
+    QueueCycle( 1000U, 500U );
+    QueueCycle( 2010U, 400U );
+    QueueCycle( 3000U, 600U );
+    g_fake_edges.push_back( HwPWMCaptureEdge_T{ 4000U, true, false } );
+
+    EXPECT_EQ( EXEC_PWM_Capture_Drain_Edges( HW_PWM_CAPTURE_CHANNEL_1, nullptr, 0U ), 9U );
+    EXPECT_TRUE( EXEC_PWM_Capture_Take_Edge_Stats( HW_PWM_CAPTURE_CHANNEL_1, &stats ) );
+
+    EXPECT_EQ( stats.periods, 4U );
+    EXPECT_EQ( stats.period_min_ticks, 990U );
+    EXPECT_EQ( stats.period_max_ticks, 1010U );
+    EXPECT_EQ( stats.period_mean_ticks, 1000U );
+    EXPECT_EQ( stats.duty_min_bp, 2500U );
+    EXPECT_EQ( stats.duty_max_bp, 6000U );
+    EXPECT_EQ( stats.duty_mean_bp, ( 2500U + 4950U + 4040U + 6000U ) / 4U );
+    EXPECT_EQ( stats.jitter_max_ticks, 20U );
+    EXPECT_EQ( stats.jitter_mean_ticks, ( 10U + 20U + 10U ) / 3U );
+    EXPECT_EQ( stats.gaps, 0U );
+}
+
+TEST_F( ExecPWMCaptureTest, TakeEdgeStatsStartsNewWindowAndKeepsOpenPeriod )
+{
+    ExecPwmCaptureEdgeStats_T stats = {};
+    StartEdgeChannel();
+    QueueCycle( 0U, 500U );
+    QueueCycle( 1000U, 500U );
+
+    EXPECT_EQ( EXEC_PWM_Capture_Drain_Edges( HW_PWM_CAPTURE_CHANNEL_1, nullptr, 0U ), 4U );
+    EXPECT_TRUE( EXEC_PWM_Capture_Take_Edge_Stats( HW_PWM_CAPTURE_CHANNEL_1, &stats ) );
+    EXPECT_EQ( stats.periods, 1U );
+
+    EXPECT_FALSE( EXEC_PWM_Capture_Take_Edge_Stats( HW_PWM_CAPTURE_CHANNEL_1, &stats ) );
+    EXPECT_EQ( stats.periods, 0U );
+
+    g_fake_edges.push_back( HwPWMCaptureEdge_T{ 2100U, true, false } );
+    EXPECT_EQ( EXEC_PWM_Capture_Drain_Edges( HW_PWM_CAPTURE_CHANNEL_1, nullptr, 0U ), 1U );
+    EXPECT_TRUE( EXEC_PWM_Capture_Take_Edge_Stats( HW_PWM_CAPTURE_CHANNEL_1, &stats ) );
+    EXPECT_EQ( stats.periods, 1U );
+    EXPECT_EQ( stats.period_min_ticks, 1100U );
+    EXPECT_EQ( stats.jitter_max_ticks, 100U );
+}
+
+TEST_F( ExecPWMCaptureTest, TakeEdgeStatsSkipsPeriodsAcrossGapsAndMissingFallingEdges )
+{
+    ExecPwmCaptureEdgeStats_T stats = {};
+    StartEdgeChannel();
+    QueueCycle( 0U, 500U );
+    QueueCycle( 1000U, 500U );
+    QueueCycle( 5000U, 500U, true );
+    QueueCycle( 6000U, 500U );
+    g_fake_edges.push_back( HwPWMCaptureEdge_T{ 7000U, true, false } );
+    g_fake_edges.push_back( HwPWMCaptureEdge_T{ 8500U, true, false } );
+
+    EXPECT_EQ( EXEC_PWM_Capture_Drain_Edges( HW_PWM_CAPTURE_CHANNEL_1, nullptr, 0U ), 10U );
+    EXPECT_TRUE( EXEC_PWM_Capture_Take_Edge_Stats( HW_PWM_CAPTURE_CHANNEL_1, &stats ) );
+
+    EXPECT_EQ( stats.periods, 3U );
+    EXPECT_EQ( stats.period_max_ticks, 1000U );
+    EXPECT_EQ( stats.jitter_max_ticks, 0U );
+    EXPECT_EQ( stats.gaps, 1U );
+}
+
+TEST_F( ExecPWMCaptureTest, TakeEdgeStatsReturnsFalseForInvalidArguments )
+{
+    ExecPwmCaptureEdgeStats_T stats = {};
+
+    EXPECT_FALSE( EXEC_PWM_Capture_Take_Edge_Stats( HW_PWM_CAPTURE_CHANNEL_1, nullptr ) );
+    EXPECT_FALSE(
+        EXEC_PWM_Capture_Take_Edge_Stats( static_cast<HwPWMCaptureChannel_T>( 2U ), &stats ) );
+}
+
+TEST_F( ExecPWMCaptureTest, SetReciprocalPeriodsRejectsInvalidArguments )
+{
+    EXPECT_FALSE( EXEC_PWM_Capture_Set_Reciprocal_Periods(
+        HW_PWM_CAPTURE_CHANNEL_1, EXEC_PWM_CAPTURE_RECIPROCAL_MAX_PERIODS + 1U ) );
+    EXPECT_FALSE( EXEC_PWM_Capture_Set_Reciprocal_Periods(
+        static_cast<HwPWMCaptureChannel_T>( 2U ), 8U ) );
+    EXPECT_TRUE( EXEC_PWM_Capture_Set_Reciprocal_Periods(
+        HW_PWM_CAPTURE_CHANNEL_1, EXEC_PWM_CAPTURE_RECIPROCAL_MAX_PERIODS ) );
+}
+
+TEST_F( ExecPWMCaptureTest, ReciprocalAveragesConsumedPeriods )
+{
+    ExecPwmCaptureResult_T     result     = {};
+    ExecPwmCaptureReciprocal_T out        = {};
+    const uint32_t             periods[4] = { 81U, 82U, 82U, 82U };
+    uint32_t                   high       = 41U;
+
+    ASSERT_TRUE( EXEC_PWM_Capture_Set_Reciprocal_Periods( HW_PWM_CAPTURE_CHANNEL_1, 4U ) );
+    EXPECT_CALL( mock_hw, Consume_Result( _ ) ).Times( 4 );
+    EXPECT_CALL( mock_hw, Get_Timer_Clock_Hz( HW_PWM_CAPTURE_CHANNEL_1 ) )
+        .WillOnce( Return( TIMER_CLOCK_HZ ) );
+
+    for ( uint32_t period : periods )
+    {
+        period_ticks = period;
+        EXPECT_FALSE( EXEC_PWM_Capture_Take_Reciprocal( HW_PWM_CAPTURE_CHANNEL_1, &out ) );
+        EXPECT_CALL( mock_hw, Peek_Result( _ ) )
+            .WillOnce( Return( MakeHwResult( &period_ticks, &high ) ) );
+        EXPECT_TRUE( EXEC_PWM_Capture_Consume( HW_PWM_CAPTURE_CHANNEL_1, &result ) );
+    }
+
+    ASSERT_TRUE( EXEC_PWM_Capture_Take_Reciprocal( HW_PWM_CAPTURE_CHANNEL_1, &out ) );
+    EXPECT_EQ( out.periods, 4U );
+    EXPECT_EQ( out.frequency_mhz, ( 4ULL * TIMER_CLOCK_HZ * 1000ULL + 327ULL / 2U ) / 327ULL );
+    EXPECT_EQ( out.duty_cycle_ppm, ( 164ULL * 1000000ULL + 327ULL / 2U ) / 327ULL );
+    EXPECT_FALSE( EXEC_PWM_Capture_Take_Reciprocal( HW_PWM_CAPTURE_CHANNEL_1, &out ) );
+}
+
+TEST_F( ExecPWMCaptureTest, ReciprocalFromEdgesIsAccurateFrom1HzTo1MHz )
+{
+    const double   frequencies_hz[] = { 1.0,    1.5,     7.3,      50.0,     333.3,
+                                        1000.0, 12345.6, 100000.0, 456789.0, 1000000.0 };
+    const uint16_t n                = 64U;
+
+    EXPECT_CALL( mock_hw, Get_Timer_Clock_Hz( _ ) ).WillRepeatedly( Return( TIMER_CLOCK_HZ ) );
+
+    for ( double frequency_hz : frequencies_hz )
+    {
+        SCOPED_TRACE( frequency_hz );
+        ExecPwmCaptureReciprocal_T out          = {};
+        double                     signal_ticks = TIMER_CLOCK_HZ / frequency_hz;
+
+        Reset_Exec_PWM_Capture_State();
+        g_fake_edges.clear();
+        g_fake_edge_tail = 0U;
+        StartEdgeChannel();
+        ASSERT_TRUE( EXEC_PWM_Capture_Set_Reciprocal_Periods( HW_PWM_CAPTURE_CHANNEL_1, n ) );
+
+        for ( uint32_t k = 0U; k <= n; k++ )
+        {
+            double rise = 12345.0 + k * signal_ticks;
+            g_fake_edges.push_back( HwPWMCaptureEdge_T{
+                static_cast<uint32_t>( std::llround( rise ) ), true, false } );
+            g_fake_edges.push_back( HwPWMCaptureEdge_T{
+                static_cast<uint32_t>( std::llround( rise + 0.25 * signal_ticks ) ), false,
+                false } );
+        }
+        g_fake_edges.pop_back();
+
+        EXEC_PWM_Capture_Drain_Edges( HW_PWM_CAPTURE_CHANNEL_1, nullptr, 0U );
+        ASSERT_TRUE( EXEC_PWM_Capture_Take_Reciprocal( HW_PWM_CAPTURE_CHANNEL_1, &out ) );
+
+        /* One timer tick of quantisation over the n-period gate, plus rounding. */
+        double gate_ticks = n * signal_ticks;
+        EXPECT_EQ( out.periods, n );
+        EXPECT_NEAR( static_cast<double>( out.frequency_mhz ), frequency_hz * 1000.0,
+                     frequency_hz * 1000.0 / gate_ticks + 1.0 );
+        EXPECT_NEAR( static_cast<double>( out.duty_cycle_ppm ), 250000.0,
+                     1000000.0 / signal_ticks + 1.0 );
+    }
+}
+
+TEST_F( ExecPWMCaptureTest, ReciprocalKeepsSelectionAcrossRestart )
+{
+    ExecPwmCaptureReciprocal_T out = {};
+
+    ASSERT_TRUE( EXEC_PWM_Capture_Set_Reciprocal_Periods( HW_PWM_CAPTURE_CHANNEL_1, 2U ) );
+    StartEdgeChannel();
+    QueueCycle( 0U, 500U );
+    QueueCycle( 1000U, 500U );
+    EXEC_PWM_Capture_Drain_Edges( HW_PWM_CAPTURE_CHANNEL_1, nullptr, 0U );
+
+    EXPECT_CALL( mock_hw, Configure_Channel( _, _ ) ).WillOnce( Return( true ) );
+    ASSERT_TRUE( EXEC_PWM_Capture_Stop_Channel( HW_PWM_CAPTURE_CHANNEL_1 ) );
+    StartEdgeChannel();
+    QueueCycle( 5000U, 250U );
+    QueueCycle( 6000U, 250U );
+    g_fake_edges.push_back( HwPWMCaptureEdge_T{ 7000U, true, false } );
+    EXEC_PWM_Capture_Drain_Edges( HW_PWM_CAPTURE_CHANNEL_1, nullptr, 0U );
+
+    EXPECT_CALL( mock_hw, Get_Timer_Clock_Hz( _ ) ).WillOnce( Return( TIMER_CLOCK_HZ ) );
+    ASSERT_TRUE( EXEC_PWM_Capture_Take_Reciprocal( HW_PWM_CAPTURE_CHANNEL_1, &out ) );
+    EXPECT_EQ( out.periods, 2U );
+    EXPECT_EQ( out.frequency_mhz, 90000000ULL );
+    EXPECT_EQ( out.duty_cycle_ppm, 250000U );
+}
@@ -0,0 +1,315 @@
+/******************************************************************************
+ *  File:       test_exec_pwm_capture_sent.cpp
+ *  Author:     Callum Rafferty
+ *  Created:    18-Oct-2026
+ *
+ *  Description:
+ *      Unit tests for the SENT fast channel decoder.
+ *
+ *  Notes:
+ *      Edge streams are synthesised from nibble values at a chosen sensor
+ *      tick, with the CRC computed bit by bit as a check on the decoder's
+ *      table.
+ ******************************************************************************/
+
+/**-----------------------------------------------------------------------------
+ *  Includes
+ *------------------------------------------------------------------------------
+ */
+
+#include <gtest/gtest.h>
+
+extern "C"
+{
+#include "exec_pwm_capture_sent.h"
+}
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+/**-----------------------------------------------------------------------------
+ *  Test Constants / Macros
+ *------------------------------------------------------------------------------
+ */
+
+static constexpr uint32_t TIMER_CLOCK_HZ = 90000000U;
+static constexpr uint32_t TICK_NS        = 3000U;
+static constexpr uint32_t LOW_TICKS      = 5U;
+
+/**-----------------------------------------------------------------------------
+ *  Test Helpers
+ *------------------------------------------------------------------------------
+ */
+
+/* J2716 CRC by polynomial division, with the trailing zero nibble unless legacy. */
+static uint8_t ReferenceCrc( std::vector<uint8_t> data, bool legacy )
+{
+    uint8_t reg = 0x5U;
+
+    if ( !legacy )
+    {
+        data.push_back( 0U );
+    }
+
+    for ( uint8_t nibble : data )
+    {
+        for ( int bit = 3; bit >= 0; bit-- )
+        {
+            reg = static_cast<uint8_t>( ( reg << 1 ) | ( ( nibble >> bit ) & 1U ) );
+            if ( reg & 0x10U )
+            {
+                reg ^= 0x1DU;
+            }
+        }
+    }
+
+    return reg;
+}
+
+/**-----------------------------------------------------------------------------
+ *  Test Fixture
+ *------------------------------------------------------------------------------
+ */
+
+class ExecPWMCaptureSentTest : public ::testing::Test
+{
+protected:
+    ExecPwmCaptureSentConfig_T             config  = {};
+    ExecPwmCaptureSentDecoder_T            decoder = {};
+    std::vector<HwPWMCaptureEdge_T>        edges;
+    std::vector<ExecPwmCaptureSentFrame_T> frames;
+    double                                 now_ticks  = 1000.0;
+    double                                 tick_ticks = 270.0;
+
+    void SetUp( void ) override
+    {
+        config.tick_ns        = TICK_NS;
+        config.timer_clock_hz = TIMER_CLOCK_HZ;
+        config.data_nibbles   = 6U;
+        config.pause_pulse    = false;
+        config.legacy_crc     = false;
+        ASSERT_TRUE( EXEC_PWM_Capture_Sent_Init( &decoder, &config ) );
+        frames.resize( 8U );
+    }
+
+    /* One pulse of the given length: a falling edge now, the rising edge after the low time. */
+    void Pulse( uint32_t ticks )
+    {
+        uint32_t fall = static_cast<uint32_t>( std::llround( now_ticks ) );
+        uint32_t rise = static_cast<uint32_t>( std::llround( now_ticks + LOW_TICKS * tick_ticks ) );
+
+        edges.push_back( HwPWMCaptureEdge_T{ fall, false, false } );
+        edges.push_back( HwPWMCaptureEdge_T{ rise, true, false } );
+        now_ticks += ticks * tick_ticks;
+    }
+
+    void Frame( uint8_t status, const std::vector<uint8_t>& data, bool legacy = false )
+    {
+        Pulse( 56U );
+        Pulse( 12U + status );
+        for ( uint8_t nibble : data )
+        {
+            Pulse( 12U + nibble );
+        }
+        Pulse( 12U + ReferenceCrc( data, legacy ) );
+    }
+
+    /* Falling edge that ends the last nibble. */
+    void Close( void )
+    {
+        uint32_t fall = static_cast<uint32_t>( std::llround( now_ticks ) );
+        edges.push_back( HwPWMCaptureEdge_T{ fall, false, false } );
+    }
+
+    uint16_t Decode( void )
+    {
+        return EXEC_PWM_Capture_Sent_Decode( &decoder, edges.data(),
+                                             static_cast<uint16_t>( edges.size() ), frames.data(),
+                                             static_cast<uint16_t>( frames.size() ) );
+    }
+};
+
+/**-----------------------------------------------------------------------------
+ *  Test Cases
+ *------------------------------------------------------------------------------
+ */
+
+TEST_F( ExecPWMCaptureSentTest, DecodesFrameWithSyncTimestampAndTickTime )
+{
+    Frame( 0x3U, { 0x1U, 0x2U, 0x3U, 0xAU, 0xBU, 0xFU } );
+    Close();
+
+    ASSERT_EQ( Decode(), 1U );
+    EXPECT_EQ( frames[0].timestamp_ticks, 1000U );
+    EXPECT_EQ( frames[0].tick_ns, 3000U );
+    EXPECT_EQ( frames[0].status, 0x3U );
+    EXPECT_EQ( frames[0].data_nibbles, 6U );
+    EXPECT_EQ( frames[0].data[0], 0x1U );
+    EXPECT_EQ( frames[0].data[3], 0xAU );
+    EXPECT_EQ( frames[0].data[5], 0xFU );
+    EXPECT_EQ( frames[0].crc, ReferenceCrc( { 0x1U, 0x2U, 0x3U, 0xAU, 0xBU, 0xFU }, false ) );
+    EXPECT_EQ( decoder.counters.frames, 1U );
+    EXPECT_EQ( decoder.counters.crc_errors, 0U );
+}
+
+TEST_F( ExecPWMCaptureSentTest, CalibratesTickFromSyncPulseOfSlowAndFastSensors )
+{
+    tick_ticks = 270.0 * 1.18;
+    Frame( 0x0U, { 0xFU, 0x0U, 0xFU, 0x0U, 0xFU, 0x0U } );
+    tick_ticks = 270.0 * 0.82;
+    Frame( 0xCU, { 0x7U, 0x8U, 0x9U, 0x6U, 0x5U, 0x4U } );
+    Close();
+
+    ASSERT_EQ( Decode(), 2U );
+    EXPECT_EQ( frames[0].data[0], 0xFU );
+    EXPECT_EQ( frames[0].data[5], 0x0U );
+    EXPECT_EQ( frames[0].tick_ns, 3540U );
+    EXPECT_EQ( frames[1].status, 0xCU );
+    EXPECT_EQ( frames[1].data[2], 0x9U );
+    EXPECT_EQ( frames[1].tick_ns, 2460U );
+}
+
+TEST_F( ExecPWMCaptureSentTest, DecodesFramesSplitAcrossBlocks )
+{
+    uint16_t decoded = 0U;
+    Frame( 0x1U, { 0x2U, 0x4U, 0x6U, 0x8U, 0xAU, 0xCU } );
+    Frame( 0x2U, { 0xDU, 0xBU, 0x9U, 0x7U, 0x5U, 0x3U } );
+    Close();
+
+    for ( size_t start = 0U; start < edges.size(); start += 3U )
+    {
+        uint16_t count = static_cast<uint16_t>( std::min<size_t>( 3U, edges.size() - start ) );
+        decoded += EXEC_PWM_Capture_Sent_Decode( &decoder, &edges[start], count, &frames[decoded],
+                                                 static_cast<uint16_t>( frames.size() - decoded ) );
+    }
+
+    ASSERT_EQ( decoded, 2U );
+    EXPECT_EQ( frames[0].data[5], 0xCU );
+    EXPECT_EQ( frames[1].status, 0x2U );
+    EXPECT_EQ( frames[1].data[0], 0xDU );
+}
+
+TEST_F( ExecPWMCaptureSentTest, RejectsFrameWithBadCrc )
+{
+    Pulse( 56U );
+    Pulse( 12U );
+    for ( int i = 0; i < 6; i++ )
+    {
+        Pulse( 12U + 1U );
+    }
+    Pulse( 12U + static_cast<uint8_t>( ReferenceCrc( { 1U, 1U, 1U, 1U, 1U, 1U }, false ) ^ 1U ) );
+    Frame( 0x0U, { 0x1U, 0x1U, 0x1U, 0x1U, 0x1U, 0x1U } );
+    Close();
+
+    ASSERT_EQ( Decode(), 1U );
+    EXPECT_EQ( decoder.counters.crc_errors, 1U );
+    EXPECT_EQ( decoder.counters.frames, 1U );
+}
+
+TEST_F( ExecPWMCaptureSentTest, ChecksLegacyCrcWhenConfigured )
+{
+    config.legacy_crc   = true;
+    config.data_nibbles = 3U;
+    ASSERT_TRUE( EXEC_PWM_Capture_Sent_Init( &decoder, &config ) );
+    Frame( 0x0U, { 0x4U, 0x5U, 0x6U }, true );
+    Close();
+
+    ASSERT_EQ( Decode(), 1U );
+    EXPECT_EQ( frames[0].data_nibbles, 3U );
+    EXPECT_EQ( frames[0].crc, ReferenceCrc( { 0x4U, 0x5U, 0x6U }, true ) );
+}
+
+TEST_F( ExecPWMCaptureSentTest, SkipsPausePulseEvenWhenItMatchesSyncLength )
+{
+    config.pause_pulse = true;
+    ASSERT_TRUE( EXEC_PWM_Capture_Sent_Init( &decoder, &config ) );
+    Frame( 0x1U, { 0x1U, 0x2U, 0x3U, 0x4U, 0x5U, 0x6U } );
+    Pulse( 56U );
+    Frame( 0x2U, { 0x6U, 0x5U, 0x4U, 0x3U, 0x2U, 0x1U } );
+    Pulse( 200U );
+    Close();
+
+    ASSERT_EQ( Decode(), 2U );
+    EXPECT_EQ( frames[1].status, 0x2U );
+    EXPECT_EQ( decoder.counters.nibble_errors, 0U );
+}
+
+TEST_F( ExecPWMCaptureSentTest, ResynchronisesAfterNibbleOutOfRange )
+{
+    Pulse( 56U );
+    Pulse( 12U );
+    Pulse( 40U );
+    Frame( 0x5U, { 0x0U, 0x0U, 0x0U, 0x0U, 0x0U, 0x0U } );
+    Close();
+
+    ASSERT_EQ( Decode(), 1U );
+    EXPECT_EQ( frames[0].status, 0x5U );
+    EXPECT_EQ( decoder.counters.nibble_errors, 1U );
+}
+
+TEST_F( ExecPWMCaptureSentTest, AbandonsFrameInProgressAtGap )
+{
+    Pulse( 56U );
+    Pulse( 12U );
+    Pulse( 13U );
+    edges.back().follows_gap = true;
+    Pulse( 14U );
+    Pulse( 15U );
+    Frame( 0x0U, { 0x9U, 0x9U, 0x9U, 0x9U, 0x9U, 0x9U } );
+    Close();
+
+    ASSERT_EQ( Decode(), 1U );
+    EXPECT_EQ( frames[0].data[0], 0x9U );
+    EXPECT_EQ( decoder.counters.gaps, 1U );
+    EXPECT_EQ( decoder.counters.crc_errors, 0U );
+    EXPECT_EQ( decoder.counters.nibble_errors, 0U );
+}
+
+TEST_F( ExecPWMCaptureSentTest, DecodesAcrossTimerWrap )
+{
+    now_ticks = 4294967296.0 - 56.0 * tick_ticks - 100.0;
+    Frame( 0x0U, { 0x1U, 0x2U, 0x3U, 0x4U, 0x5U, 0x6U } );
+    now_ticks -= 4294967296.0;
+    Close();
+
+    ASSERT_EQ( Decode(), 1U );
+    EXPECT_EQ( frames[0].timestamp_ticks, static_cast<uint32_t>( 4294967296.0 - 56.0 * 270.0
+                                                                 - 100.0 ) );
+    EXPECT_EQ( frames[0].data[5], 0x6U );
+}
+
+TEST_F( ExecPWMCaptureSentTest, CountsFramesDroppedWhenOutputIsFull )
+{
+    Frame( 0x0U, { 0x1U, 0x1U, 0x1U, 0x1U, 0x1U, 0x1U } );
+    Frame( 0x0U, { 0x2U, 0x2U, 0x2U, 0x2U, 0x2U, 0x2U } );
+    Close();
+    frames.resize( 1U );
+
+    ASSERT_EQ( Decode(), 1U );
+    EXPECT_EQ( frames[0].data[0], 0x1U );
+    EXPECT_EQ( decoder.counters.frames, 2U );
+    EXPECT_EQ( decoder.counters.dropped, 1U );
+}
+
+TEST_F( ExecPWMCaptureSentTest, InitRejectsInvalidConfiguration )
+{
+    ExecPwmCaptureSentConfig_T bad = config;
+
+    EXPECT_FALSE( EXEC_PWM_Capture_Sent_Init( nullptr, &config ) );
+    EXPECT_FALSE( EXEC_PWM_Capture_Sent_Init( &decoder, nullptr ) );
+
+    bad.data_nibbles = 0U;
+    EXPECT_FALSE( EXEC_PWM_Capture_Sent_Init( &decoder, &bad ) );
+    bad.data_nibbles = EXEC_PWM_CAPTURE_SENT_MAX_DATA_NIBBLES + 1U;
+    EXPECT_FALSE( EXEC_PWM_Capture_Sent_Init( &decoder, &bad ) );
+
+    bad         = config;
+    bad.tick_ns = 5U;
+    EXPECT_FALSE( EXEC_PWM_Capture_Sent_Init( &decoder, &bad ) );
+
+    bad                = config;
+    bad.timer_clock_hz = 0U;
+    EXPECT_FALSE( EXEC_PWM_Capture_Sent_Init( &decoder, &bad ) );
+}
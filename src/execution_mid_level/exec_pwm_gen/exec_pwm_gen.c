@@ -96,3 +96,15 @@ void Exec_PWM_GEN_Config( PwmGenChannel_T channel, PwmGenVoltageLevel_T volt_lvl
 {
     HW_PWM_GEN_Config( channel, volt_lvl );
 }
+
+/**
+ * @brief Locks or frees the PWM period from the execution manager tick.
+ *
+ * @param channel   The channel you want to synchronise
+ * @param enable    true to restart the PWM period on every execution tick
+ *
+ */
+void EXEC_PWM_GEN_Set_Tick_Sync( PwmGenChannel_T channel, bool enable )
+{
+    HW_PWM_GEN_Set_Tick_Sync( channel, enable );
+}
@@ -75,6 +75,16 @@ void EXEC_PWM_GEN_Set_PWM_HV( uint16_t arr, uint16_t ccr, uint16_t psc );
  */
 void Exec_PWM_GEN_Config( PwmGenChannel_T channel, PwmGenVoltageLevel_T volt_lvl );
 
+/**
+ * @brief Locks or frees the PWM period from the execution manager tick.
+ *
+ * @param channel   The channel you want to synchronise
+ * @param enable    true to restart the PWM period on every execution tick
+ *
+ * See HW_PWM_GEN_Set_Tick_Sync. The PWM period must divide the execution tick period.
+ */
+void EXEC_PWM_GEN_Set_Tick_Sync( PwmGenChannel_T channel, bool enable );
+
 #ifdef __cplusplus
 }
 #endif
@@ -25,7 +25,8 @@
  *        requested transfer sizes, configured SPI mode, frame alignment, buffer
  *        sizes, and protocol-level correctness before calling this module.
  *      - RX data is copied from the low-level driver's DMA-backed circular RX
- *        stream into caller-owned storage.
+ *        stream into caller-owned storage. Slave channels configured with
+ *        rx_nss_framing deliver whole NSS-delimited transactions instead.
  *      - TX data is copied into the low-level driver's internal TX queue and
  *        then transmission is triggered.
  *      - In 16-bit SPI mode, callers must ensure TX and RX byte counts are
@@ -124,6 +125,30 @@ static EXECSPIState_T spi_dac_state       = { 0 };
  */
 static inline EXECSPIState_T* EXEC_SPI_Get_State( SPIChannel_T peripheral );
 
+/**
+ * @brief Copy one set of RX spans into caller-owned storage.
+ *
+ * @param data_dst
+ *     Destination with room for at least @p data_spans total length.
+ *
+ * @param data_spans
+ *     One or two low-level RX spans to copy in order.
+ */
+static inline void EXEC_SPI_Copy_Spans( uint8_t* data_dst, const HWSPIRxSpans_T* data_spans );
+
+/**
+ * @brief Copy as many whole NSS-framed transactions as fit into caller storage.
+ *
+ * Implements EXEC_SPI_Receive() for channels configured with rx_nss_framing.
+ * A transaction is never split: bytes of a transaction that is still in
+ * progress, or that does not fit in the remaining capacity, stay unread.
+ *
+ * @return
+ *     false only if the oldest queued transaction alone exceeds the capacity.
+ */
+static bool EXEC_SPI_Receive_Framed( SPIChannel_T peripheral, uint8_t* data_dst,
+                                     uint32_t* size_bytes );
+
 /**-----------------------------------------------------------------------------
  *  Private Function Definitions
  *------------------------------------------------------------------------------
@@ -149,6 +174,44 @@ static inline EXECSPIState_T* EXEC_SPI_Get_State( SPIChannel_T peripheral )
     }
 }
 
+static inline void EXEC_SPI_Copy_Spans( uint8_t* data_dst, const HWSPIRxSpans_T* data_spans )
+{
+    memcpy( data_dst, data_spans->first_span.data, data_spans->first_span.length_bytes );
+
+    memcpy( data_dst + data_spans->first_span.length_bytes, data_spans->second_span.data,
+            data_spans->second_span.length_bytes );
+}
+
+static bool EXEC_SPI_Receive_Framed( SPIChannel_T peripheral, uint8_t* data_dst,
+                                     uint32_t* size_bytes )
+{
+    HWSPIRxTransaction_T transaction;
+    uint32_t             copied_bytes = 0U;
+    bool                 consumed_any = false;
+
+    while ( HW_SPI_Rx_Peek_Transaction( peripheral, &transaction ) )
+    {
+        if ( transaction.data.total_length_bytes > *size_bytes - copied_bytes )
+        {
+            // Never split a transaction. Only report failure when nothing could
+            // be delivered, matching the unframed overflow behaviour.
+            if ( consumed_any == false )
+            {
+                return false;
+            }
+            break;
+        }
+
+        EXEC_SPI_Copy_Spans( &data_dst[copied_bytes], &transaction.data );
+        copied_bytes += transaction.data.total_length_bytes;
+        consumed_any = true;
+        HW_SPI_Rx_Consume_Transaction( peripheral );
+    }
+
+    *size_bytes = copied_bytes;
+    return true;
+}
+
 /**-----------------------------------------------------------------------------
  *  Public Function Definitions
  *------------------------------------------------------------------------------
@@ -331,9 +394,16 @@ bool EXEC_SPI_Transmit( SPIChannel_T peripheral, const uint8_t* data_src,
  * On success, @p size_bytes is updated to the number of bytes copied into
  * @p data_dst.
  *
- * This function does not define message boundaries or validate protocol-level
- * framing. It simply copies the raw unread RX bytes that are currently available
- * from the low-level SPI RX stream.
+ * This function does not validate protocol-level framing. On unframed channels
+ * it simply copies the raw unread RX bytes that are currently available from
+ * the low-level SPI RX stream.
+ *
+ * On slave channels configured with rx_nss_framing, only whole NSS-delimited
+ * transactions are copied, back-to-back in arrival order. A transaction still
+ * in progress, or one that no longer fits in the remaining capacity, is left
+ * for the next call. false is returned only if the oldest completed transaction
+ * alone exceeds the capacity. Use EXEC_SPI_Receive_Transaction() when the
+ * individual boundaries or edge timestamps are needed.
  *
  * @param peripheral
  *     The SPI peripheral/channel whose RX data should be copied.
@@ -353,6 +423,12 @@ bool EXEC_SPI_Transmit( SPIChannel_T peripheral, const uint8_t* data_src,
  */
 bool EXEC_SPI_Receive( SPIChannel_T peripheral, uint8_t* data_dst, uint32_t* size_bytes )
 {
+    EXECSPIState_T* state = EXEC_SPI_Get_State( peripheral );
+    if ( state != NULL && state->configuration.rx_nss_framing )
+    {
+        return EXEC_SPI_Receive_Framed( peripheral, data_dst, size_bytes );
+    }
+
     HWSPIRxSpans_T data_spans = HW_SPI_Rx_Peek( peripheral );
     if ( data_spans.total_length_bytes > *size_bytes )
     {
@@ -361,10 +437,7 @@ bool EXEC_SPI_Receive( SPIChannel_T peripheral, uint8_t* data_dst, uint32_t* siz
         return false;
     }
 
-    memcpy( data_dst, data_spans.first_span.data, data_spans.first_span.length_bytes );
-
-    memcpy( data_dst + data_spans.first_span.length_bytes, data_spans.second_span.data,
-            data_spans.second_span.length_bytes );
+    EXEC_SPI_Copy_Spans( data_dst, &data_spans );
 
     *size_bytes = data_spans.total_length_bytes;
 
@@ -374,6 +447,57 @@ bool EXEC_SPI_Receive( SPIChannel_T peripheral, uint8_t* data_dst, uint32_t* siz
     return true;
 }
 
+/**
+ * @brief Copy the oldest whole NSS-framed RX transaction from a SPI channel.
+ *
+ * Copies one completed transaction from a slave channel configured with
+ * rx_nss_framing into caller-owned storage, reports its NSS edge timestamps,
+ * and releases it from the low-level transaction queue.
+ *
+ * If the transaction is larger than the capacity given in @p size_bytes, no
+ * bytes are copied, the transaction is left queued, and false is returned.
+ *
+ * @param peripheral
+ *     The SPI peripheral/channel whose RX transaction should be copied.
+ *
+ * @param data_dst
+ *     Pointer to caller-owned storage for the transaction bytes.
+ *
+ * @param size_bytes
+ *     On entry, the capacity of @p data_dst in bytes.
+ *     On success, updated to the transaction length.
+ *
+ * @param transaction_info
+ *     Optional; if non-NULL, receives the edge timestamps and drop count. Its
+ *     spans refer to driver storage and are only valid until the next receive.
+ *
+ * @return
+ *     true if a transaction was copied and released.
+ *     false if no completed transaction is queued or it does not fit.
+ */
+bool EXEC_SPI_Receive_Transaction( SPIChannel_T peripheral, uint8_t* data_dst,
+                                   uint32_t* size_bytes, HWSPIRxTransaction_T* transaction_info )
+{
+    HWSPIRxTransaction_T transaction;
+
+    if ( !HW_SPI_Rx_Peek_Transaction( peripheral, &transaction )
+         || transaction.data.total_length_bytes > *size_bytes )
+    {
+        return false;
+    }
+
+    EXEC_SPI_Copy_Spans( data_dst, &transaction.data );
+    *size_bytes = transaction.data.total_length_bytes;
+
+    if ( transaction_info != NULL )
+    {
+        *transaction_info = transaction;
+    }
+
+    HW_SPI_Rx_Consume_Transaction( peripheral );
+    return true;
+}
+
 /**
  * @brief Check whether the SPI transmit path has completed.
  *
@@ -25,7 +25,8 @@
  *        requested transfer sizes, configured SPI mode, frame alignment, buffer
  *        sizes, and protocol-level correctness before calling this module.
  *      - RX data is copied from the low-level driver's DMA-backed circular RX
- *        stream into caller-owned storage.
+ *        stream into caller-owned storage. Slave channels configured with
+ *        rx_nss_framing deliver whole NSS-delimited transactions instead.
  *      - TX data is copied into the low-level driver's internal TX queue and
  *        then transmission is triggered.
  *      - In 16-bit SPI mode, callers must ensure TX and RX byte counts are
@@ -179,9 +180,16 @@ bool EXEC_SPI_Transmit( SPIChannel_T peripheral, const uint8_t* data_src,
  * On success, @p size_bytes is updated to the number of bytes copied into
  * @p data_dst.
  *
- * This function does not define message boundaries or validate protocol-level
- * framing. It simply copies the raw unread RX bytes that are currently available
- * from the low-level SPI RX stream.
+ * This function does not validate protocol-level framing. On unframed channels
+ * it simply copies the raw unread RX bytes that are currently available from
+ * the low-level SPI RX stream.
+ *
+ * On slave channels configured with rx_nss_framing, only whole NSS-delimited
+ * transactions are copied, back-to-back in arrival order. A transaction still
+ * in progress, or one that no longer fits in the remaining capacity, is left
+ * for the next call. false is returned only if the oldest completed transaction
+ * alone exceeds the capacity. Use EXEC_SPI_Receive_Transaction() when the
+ * individual boundaries or edge timestamps are needed.
  *
  * @param peripheral
  *     The SPI peripheral/channel whose RX data should be copied.
@@ -201,6 +209,37 @@ bool EXEC_SPI_Transmit( SPIChannel_T peripheral, const uint8_t* data_src,
  */
 bool EXEC_SPI_Receive( SPIChannel_T peripheral, uint8_t* data_dst, uint32_t* size_bytes );
 
+/**
+ * @brief Copy the oldest whole NSS-framed RX transaction from a SPI channel.
+ *
+ * Copies one completed transaction from a slave channel configured with
+ * rx_nss_framing into caller-owned storage, reports its NSS edge timestamps,
+ * and releases it from the low-level transaction queue.
+ *
+ * If the transaction is larger than the capacity given in @p size_bytes, no
+ * bytes are copied, the transaction is left queued, and false is returned.
+ *
+ * @param peripheral
+ *     The SPI peripheral/channel whose RX transaction should be copied.
+ *
+ * @param data_dst
+ *     Pointer to caller-owned storage for the transaction bytes.
+ *
+ * @param size_bytes
+ *     On entry, the capacity of @p data_dst in bytes.
+ *     On success, updated to the transaction length.
+ *
+ * @param transaction_info
+ *     Optional; if non-NULL, receives the edge timestamps and drop count. Its
+ *     spans refer to driver storage and are only valid until the next receive.
+ *
+ * @return
+ *     true if a transaction was copied and released.
+ *     false if no completed transaction is queued or it does not fit.
+ */
+bool EXEC_SPI_Receive_Transaction( SPIChannel_T peripheral, uint8_t* data_dst,
+                                   uint32_t* size_bytes, HWSPIRxTransaction_T* transaction_info );
+
 /**
  * @brief Check whether the SPI transmit path has completed.
  *
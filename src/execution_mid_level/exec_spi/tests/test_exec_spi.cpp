@@ -69,6 +69,11 @@ class MockHWSPI
     MOCK_METHOD( void, RxConsume, ( SPIChannel_T peripheral, uint32_t bytes_to_consume ), () );
 
     MOCK_METHOD( bool, TxBufferEmpty, ( SPIChannel_T peripheral ), () );
+
+    MOCK_METHOD( bool, RxPeekTransaction,
+                 ( SPIChannel_T peripheral, HWSPIRxTransaction_T* transaction ), () );
+
+    MOCK_METHOD( void, RxConsumeTransaction, ( SPIChannel_T peripheral ), () );
 };
 
 static MockHWSPI* g_mock_hw_spi = nullptr;
@@ -115,6 +120,16 @@ bool HW_SPI_Tx_Is_Complete( SPIChannel_T peripheral )
 {
     return g_mock_hw_spi->TxBufferEmpty( peripheral );
 }
+
+bool HW_SPI_Rx_Peek_Transaction( SPIChannel_T peripheral, HWSPIRxTransaction_T* transaction )
+{
+    return g_mock_hw_spi->RxPeekTransaction( peripheral, transaction );
+}
+
+void HW_SPI_Rx_Consume_Transaction( SPIChannel_T peripheral )
+{
+    g_mock_hw_spi->RxConsumeTransaction( peripheral );
+}
 }
 
 /**-----------------------------------------------------------------------------
@@ -179,6 +194,37 @@ class ExecSPITest : public ::testing::Test
         ::testing::Mock::VerifyAndClearExpectations( &mock_hw_spi );
     }
 
+    void ConfigureFramedSlaveChannel( SPIChannel_T peripheral )
+    {
+        using ::testing::_;
+        using ::testing::Return;
+
+        HWSPIConfig_T framed_config  = default_config;
+        framed_config.spi_mode       = SPI_SLAVE_MODE;
+        framed_config.rx_nss_framing = true;
+
+        EXPECT_CALL( mock_hw_spi, ConfigureChannel( peripheral, _ ) ).WillOnce( Return( true ) );
+        EXPECT_CALL( mock_hw_spi, StartChannel( peripheral ) ).WillOnce( Return( true ) );
+
+        ASSERT_TRUE( EXEC_SPI_Configure_Channel( peripheral, framed_config ) );
+
+        ::testing::Mock::VerifyAndClearExpectations( &mock_hw_spi );
+    }
+
+    static HWSPIRxTransaction_T MakeTransaction( const uint8_t* data, uint32_t size_bytes,
+                                                 uint32_t assert_cycles )
+    {
+        HWSPIRxTransaction_T transaction = {};
+
+        transaction.data.first_span.data         = data;
+        transaction.data.first_span.length_bytes = size_bytes;
+        transaction.data.total_length_bytes      = size_bytes;
+        transaction.assert_timestamp_cycles      = assert_cycles;
+        transaction.deassert_timestamp_cycles    = assert_cycles + 100U;
+
+        return transaction;
+    }
+
     void ForceAllChannelsUnconfigured( void )
     {
         ForceChannelUnconfigured( SPI_CHANNEL_0 );
@@ -535,6 +581,107 @@ TEST_F( ExecSPITest, Receive_DestinationBufferTooSmall_ReturnsFalseAndDoesNotCon
     EXPECT_EQ( TEST_SMALL_RX_BUFFER_SIZE, rx_buffer_size_bytes );
 }
 
+TEST_F( ExecSPITest, Receive_NssFramed_CopiesWholeTransactionsAndLeavesOversizedOneQueued )
+{
+    using ::testing::_;
+    using ::testing::DoAll;
+    using ::testing::Return;
+    using ::testing::SetArgPointee;
+
+    const uint8_t first_transaction[]  = { 0x01U, 0x02U, 0x03U };
+    const uint8_t second_transaction[] = { 0x04U };
+    const uint8_t third_transaction[]  = { 0x05U, 0x06U, 0x07U, 0x08U };
+
+    const uint8_t expected_data[] = { 0x01U, 0x02U, 0x03U, 0x04U };
+
+    ConfigureFramedSlaveChannel( SPI_CHANNEL_1 );
+
+    EXPECT_CALL( mock_hw_spi, RxPeekTransaction( SPI_CHANNEL_1, _ ) )
+        .WillOnce( DoAll( SetArgPointee<1>( MakeTransaction(
+                              first_transaction, sizeof( first_transaction ), 10U ) ),
+                          Return( true ) ) )
+        .WillOnce( DoAll( SetArgPointee<1>( MakeTransaction(
+                              second_transaction, sizeof( second_transaction ), 20U ) ),
+                          Return( true ) ) )
+        .WillOnce( DoAll( SetArgPointee<1>( MakeTransaction(
+                              third_transaction, sizeof( third_transaction ), 30U ) ),
+                          Return( true ) ) );
+
+    EXPECT_CALL( mock_hw_spi, RxConsumeTransaction( SPI_CHANNEL_1 ) ).Times( 2 );
+    EXPECT_CALL( mock_hw_spi, RxPeek( _ ) ).Times( 0 );
+
+    // Room for the first two transactions plus part of the third.
+    uint8_t  rx_buffer[TEST_RX_BUFFER_SIZE] = { 0 };
+    uint32_t rx_buffer_size_bytes           = 6U;
+
+    bool result = EXEC_SPI_Receive( SPI_CHANNEL_1, rx_buffer, &rx_buffer_size_bytes );
+
+    EXPECT_TRUE( result );
+    EXPECT_EQ( sizeof( expected_data ), rx_buffer_size_bytes );
+    EXPECT_EQ( 0, std::memcmp( rx_buffer, expected_data, sizeof( expected_data ) ) );
+}
+
+TEST_F( ExecSPITest, Receive_NssFramedFirstTransactionTooLarge_ReturnsFalseAndDoesNotConsume )
+{
+    using ::testing::_;
+    using ::testing::DoAll;
+    using ::testing::Return;
+    using ::testing::SetArgPointee;
+
+    const uint8_t transaction_data[] = { 'H', 'e', 'l', 'l', 'o' };
+
+    ConfigureFramedSlaveChannel( SPI_CHANNEL_0 );
+
+    EXPECT_CALL( mock_hw_spi, RxPeekTransaction( SPI_CHANNEL_0, _ ) )
+        .WillOnce( DoAll( SetArgPointee<1>( MakeTransaction(
+                              transaction_data, sizeof( transaction_data ), 0U ) ),
+                          Return( true ) ) );
+
+    EXPECT_CALL( mock_hw_spi, RxConsumeTransaction( _ ) ).Times( 0 );
+
+    uint8_t  rx_buffer[TEST_SMALL_RX_BUFFER_SIZE] = { 0 };
+    uint32_t rx_buffer_size_bytes                 = sizeof( rx_buffer );
+
+    bool result = EXEC_SPI_Receive( SPI_CHANNEL_0, rx_buffer, &rx_buffer_size_bytes );
+
+    EXPECT_FALSE( result );
+    EXPECT_EQ( TEST_SMALL_RX_BUFFER_SIZE, rx_buffer_size_bytes );
+}
+
+TEST_F( ExecSPITest, ReceiveTransaction_CopiesOneTransactionAndReportsTimestamps )
+{
+    using ::testing::_;
+    using ::testing::DoAll;
+    using ::testing::Return;
+    using ::testing::SetArgPointee;
+
+    const uint8_t transaction_data[] = { 0xA5U, 0x5AU };
+
+    EXPECT_CALL( mock_hw_spi, RxPeekTransaction( SPI_CHANNEL_0, _ ) )
+        .WillOnce( DoAll( SetArgPointee<1>( MakeTransaction(
+                              transaction_data, sizeof( transaction_data ), 1000U ) ),
+                          Return( true ) ) )
+        .WillOnce( Return( false ) );
+
+    EXPECT_CALL( mock_hw_spi, RxConsumeTransaction( SPI_CHANNEL_0 ) ).Times( 1 );
+
+    uint8_t              rx_buffer[TEST_RX_BUFFER_SIZE] = { 0 };
+    uint32_t             rx_buffer_size_bytes           = sizeof( rx_buffer );
+    HWSPIRxTransaction_T transaction_info               = {};
+
+    ASSERT_TRUE( EXEC_SPI_Receive_Transaction( SPI_CHANNEL_0, rx_buffer, &rx_buffer_size_bytes,
+                                               &transaction_info ) );
+
+    EXPECT_EQ( sizeof( transaction_data ), rx_buffer_size_bytes );
+    EXPECT_EQ( 0, std::memcmp( rx_buffer, transaction_data, sizeof( transaction_data ) ) );
+    EXPECT_EQ( 1000U, transaction_info.assert_timestamp_cycles );
+    EXPECT_EQ( 1100U, transaction_info.deassert_timestamp_cycles );
+
+    rx_buffer_size_bytes = sizeof( rx_buffer );
+    EXPECT_FALSE(
+        EXEC_SPI_Receive_Transaction( SPI_CHANNEL_0, rx_buffer, &rx_buffer_size_bytes, nullptr ) );
+}
+
 TEST_F( ExecSPITest, IsTransmissionComplete_LowLevelReturnsTrue_ReturnsTrue )
 {
     EXPECT_CALL( mock_hw_spi, TxBufferEmpty( SPI_CHANNEL_0 ) )
@@ -12,7 +12,8 @@
  *      - sequences configuration and deconfiguration operations,
  *      - bridges execution-level TX requests to the low-level TX ring buffer
  *        and DMA pump,
- *      - copies low-level RX spans into caller-owned storage.
+ *      - copies low-level RX spans into caller-owned storage, optionally one
+ *        boundary-delimited frame at a time.
  *
  *  Notes:
  *      - Hardware access, DMA ownership, and buffer ownership remain in the
@@ -79,6 +80,8 @@ static ExecUartChannelState_T exec_uart_channel_states[HW_UART_CHANNEL_COUNT];
 
 static HwUartConfig_T EXEC_UART_Get_Disabled_Config( void );
 static inline bool    EXEC_UART_Is_Valid_Channel( HwUartChannel_T channel );
+static void           EXEC_UART_Copy_From_Spans( const HwUartRxSpans_T* spans, uint8_t* dest,
+                                                 uint32_t length_bytes );
 
 /**-----------------------------------------------------------------------------
  *  Private Function Definitions
@@ -100,13 +103,14 @@ static HwUartConfig_T EXEC_UART_Get_Disabled_Config( void )
 {
     HwUartConfig_T config;
 
-    config.interface_mode = HW_UART_MODE_DISABLED;
-    config.baud_rate      = 0U;
-    config.word_length    = HW_UART_WORD_LENGTH_8_BITS;
-    config.stop_bits      = HW_UART_STOP_BITS_1;
-    config.parity         = HW_UART_PARITY_NONE;
-    config.rx_enabled     = false;
-    config.tx_enabled     = false;
+    config.interface_mode  = HW_UART_MODE_DISABLED;
+    config.baud_rate       = 0U;
+    config.word_length     = HW_UART_WORD_LENGTH_8_BITS;
+    config.stop_bits       = HW_UART_STOP_BITS_1;
+    config.parity          = HW_UART_PARITY_NONE;
+    config.rx_enabled      = false;
+    config.tx_enabled      = false;
+    config.rx_timeout_bits = 0U;
 
     return config;
 }
@@ -123,6 +127,32 @@ static inline bool EXEC_UART_Is_Valid_Channel( HwUartChannel_T channel )
     return ( ( uint32_t )channel < HW_UART_CHANNEL_COUNT );
 }
 
+/**
+ * @brief  Copies the first length_bytes of a low-level RX span pair into dest.
+ *
+ * @note   The caller guarantees length_bytes does not exceed the total span length.
+ */
+static void EXEC_UART_Copy_From_Spans( const HwUartRxSpans_T* spans, uint8_t* dest,
+                                       uint32_t length_bytes )
+{
+    uint32_t first_copy = spans->first_span.length_bytes;
+
+    if ( first_copy > length_bytes )
+    {
+        first_copy = length_bytes;
+    }
+
+    if ( first_copy > 0U )
+    {
+        memcpy( dest, spans->first_span.data, first_copy );
+    }
+
+    if ( length_bytes > first_copy )
+    {
+        memcpy( &dest[first_copy], spans->second_span.data, length_bytes - first_copy );
+    }
+}
+
 /**-----------------------------------------------------------------------------
  *  Public Function Definitions
  *------------------------------------------------------------------------------
@@ -215,6 +245,22 @@ bool EXEC_UART_Transmit( HwUartChannel_T channel, const uint8_t* data, uint32_t
     return HW_UART_Tx_Trigger( channel );
 }
 
+bool EXEC_UART_Transmit_Zero_Copy( HwUartChannel_T channel, const HwUartTxSegment_T* segments,
+                                   uint32_t count )
+{
+    if ( segments == NULL || count == 0U )
+    {
+        return false;
+    }
+
+    if ( !HW_UART_Tx_Submit_Zero_Copy( channel, segments, count ) )
+    {
+        return false;
+    }
+
+    return HW_UART_Tx_Trigger( channel );
+}
+
 bool EXEC_UART_Read( HwUartChannel_T channel, uint8_t* dest, uint32_t dest_size,
                      uint32_t* bytes_read )
 {
@@ -287,6 +333,87 @@ bool EXEC_UART_Read( HwUartChannel_T channel, uint8_t* dest, uint32_t dest_size,
     return true;
 }
 
+bool EXEC_UART_Read_Frame( HwUartChannel_T channel, uint8_t* dest, uint32_t dest_size,
+                           uint32_t* bytes_read, bool* frame_complete )
+{
+    HwUartRxFrame_T frame;
+    HwUartRxSpans_T spans;
+
+    if ( dest == NULL || bytes_read == NULL )
+    {
+        return false;
+    }
+
+    *bytes_read = 0U;
+
+    if ( !HW_UART_Rx_Peek_Frame( channel, &frame ) )
+    {
+        return true;
+    }
+
+    /* Leave an oversized frame queued so the caller can fall back to EXEC_UART_Read() */
+    if ( frame.length_bytes > dest_size )
+    {
+        return false;
+    }
+
+    spans = HW_UART_Rx_Peek( channel );
+
+    EXEC_UART_Copy_From_Spans( &spans, dest, frame.length_bytes );
+    HW_UART_Rx_Consume( channel, frame.length_bytes );
+
+    *bytes_read = frame.length_bytes;
+
+    if ( frame_complete != NULL )
+    {
+        *frame_complete = frame.ended_by_idle;
+    }
+
+    return true;
+}
+
+bool EXEC_UART_Read_Timeout_Frame( HwUartChannel_T channel, uint8_t* dest, uint32_t dest_size,
+                                   uint32_t* bytes_read, HwUartRxFrameDescriptor_T* descriptor )
+{
+    HwUartRxFrameDescriptor_T frame;
+    HwUartRxSpans_T           spans;
+
+    if ( dest == NULL || bytes_read == NULL )
+    {
+        return false;
+    }
+
+    *bytes_read = 0U;
+
+    if ( !HW_UART_Rx_Peek_Timeout_Frame( channel, &frame, &spans ) )
+    {
+        return true;
+    }
+
+    /* Leave an oversized frame queued; the caller may retry with a larger buffer */
+    if ( frame.length_bytes > dest_size )
+    {
+        return false;
+    }
+
+    EXEC_UART_Copy_From_Spans( &spans, dest, frame.length_bytes );
+    HW_UART_Rx_Release_Timeout_Frame( channel );
+
+    *bytes_read = frame.length_bytes;
+
+    if ( descriptor != NULL )
+    {
+        *descriptor = frame;
+    }
+
+    return true;
+}
+
+bool EXEC_UART_Set_Rx_Notify( HwUartChannel_T channel, HwUartRxNotify_T notify )
+{
+    return HW_UART_Rx_Set_Notify( channel, notify );
+}
+
 bool EXEC_UART_Is_Tx_Complete( HwUartChannel_T channel )
 {
     return HW_UART_Is_Tx_Complete( channel );
@@ -9,9 +9,11 @@
  *
  *      This module exposes:
  *      - UART channel configuration and deconfiguration sequencing,
- *      - execution-facing transmit operations,
+ *      - execution-facing transmit operations, copied or zero copy,
  *      - execution-facing receive operations that copy unread low-level RX data
- *        into caller-provided storage.
+ *        into caller-provided storage, either as raw bytes or one frame at a time
+ *        using the low-level line idle boundary markers or silence timeout
+ *        frame descriptors.
  *
  *  Notes:
  *      - This layer does not directly access UART hardware registers or DMA
@@ -123,6 +125,26 @@ bool EXEC_UART_Deconfigure( HwUartChannel_T channel );
  */
 bool EXEC_UART_Transmit( HwUartChannel_T channel, const uint8_t* data, uint32_t length_bytes );
 
+/**
+ * @brief  Queues caller owned segments for zero copy TX and starts the DMA pump.
+ *
+ * @param  channel  UART channel to transmit on.
+ * @param  segments Segments to transmit, in order.
+ * @param  count    Number of segments.
+ *
+ * @return true if every segment was queued and the TX DMA pump is running.
+ * @return false if segments is null, count is zero, the low-level segment queue
+ *         lacks count free slots, or the low-level trigger fails.
+ *
+ * @note   Intended for bursts larger than EXEC_UART_MAX_CHUNK_SIZE, such as a
+ *         firmware image held in flash. The DMA reads the segment memory directly.
+ *
+ * @note   Segment memory must stay unchanged until HW_UART_Tx_Segments_Retired()
+ *         shows the segment has been released.
+ */
+bool EXEC_UART_Transmit_Zero_Copy( HwUartChannel_T channel, const HwUartTxSegment_T* segments,
+                                   uint32_t count );
+
 /**
  * @brief  Copies unread UART RX data into caller-provided storage.
  *
@@ -148,6 +170,66 @@ bool EXEC_UART_Transmit( HwUartChannel_T channel, const uint8_t* data, uint32_t
 bool EXEC_UART_Read( HwUartChannel_T channel, uint8_t* dest, uint32_t dest_size,
                      uint32_t* bytes_read );
 
+/**
+ * @brief  Copies the oldest boundary-delimited UART RX frame into caller-provided storage.
+ *
+ * @param  channel        UART channel to read from.
+ * @param  dest           Destination buffer provided by the caller.
+ * @param  dest_size      Maximum number of bytes that may be written to @p dest.
+ * @param  bytes_read     Output pointer receiving the number of bytes copied.
+ * @param  frame_complete Optional output set to true if the frame ended on a line
+ *                        idle gap, or false if it was cut at a DMA half or full
+ *                        transfer marker during a long burst. May be NULL.
+ *
+ * @return true if a frame was copied or no frame boundary is pending.
+ * @return false if @p dest or @p bytes_read is null, or if the pending frame is
+ *         larger than @p dest_size. Nothing is consumed in that case.
+ *
+ * @note   If no boundary is pending, this function returns true and sets
+ *         @p *bytes_read to 0. Bytes received after the last boundary stay queued.
+ *
+ * @note   Intended to be called when the hook installed by
+ *         EXEC_UART_Set_Rx_Notify() fires, so responses are seen about one
+ *         character time after the DUT stops sending.
+ */
+bool EXEC_UART_Read_Frame( HwUartChannel_T channel, uint8_t* dest, uint32_t dest_size,
+                           uint32_t* bytes_read, bool* frame_complete );
+
+/**
+ * @brief  Copies the oldest silence timeout delimited UART RX frame into caller-provided storage.
+ *
+ * @param  channel    UART channel to read from.
+ * @param  dest       Destination buffer provided by the caller.
+ * @param  dest_size  Maximum number of bytes that may be written to @p dest.
+ * @param  bytes_read Output pointer receiving the number of bytes copied.
+ * @param  descriptor Optional output receiving the frame offset, length, timestamp
+ *                    and error flags. May be NULL.
+ *
+ * @return true if a frame was copied or no frame is pending.
+ * @return false if @p dest or @p bytes_read is null, or if the pending frame is
+ *         larger than @p dest_size. Nothing is released in that case.
+ *
+ * @note   The channel must be configured with a non-zero rx_timeout_bits. Frames
+ *         are located by the low-level descriptor queue and copied straight from
+ *         the DMA buffer spans, so the RX data is never rescanned for gaps.
+ *
+ * @note   Do not mix with EXEC_UART_Read() or EXEC_UART_Read_Frame() on the same
+ *         channel, as those consume RX data outside the descriptor queue.
+ */
+bool EXEC_UART_Read_Timeout_Frame( HwUartChannel_T channel, uint8_t* dest, uint32_t dest_size,
+                                   uint32_t* bytes_read, HwUartRxFrameDescriptor_T* descriptor );
+
+/**
+ * @brief  Installs or clears the RX boundary wakeup hook for a UART channel.
+ *
+ * @param  channel UART channel to update.
+ * @param  notify  ISR-safe hook invoked on each RX frame boundary, or NULL.
+ *
+ * @return true if the hook was stored.
+ * @return false if the channel is invalid.
+ */
+bool EXEC_UART_Set_Rx_Notify( HwUartChannel_T channel, HwUartRxNotify_T notify );
+
 /**
  * @brief Reports whether UART TX is fully complete.
  *
@@ -50,6 +50,7 @@ using ::testing::NiceMock;
 using ::testing::Pointee;
 using ::testing::Return;
 using ::testing::SaveArg;
+using ::testing::SetArgPointee;
 
 /**-----------------------------------------------------------------------------
  *  Test Doubles / Mocks
@@ -65,9 +66,16 @@ class MockHwUart
     MOCK_METHOD( bool, Rx_Start, ( HwUartChannel_T ) );
     MOCK_METHOD( bool, Tx_Load_Buffer, ( HwUartChannel_T, const uint8_t*, uint32_t ) );
     MOCK_METHOD( bool, Tx_Trigger, ( HwUartChannel_T ) );
+    MOCK_METHOD( bool, Tx_Submit_Zero_Copy,
+                 ( HwUartChannel_T, const HwUartTxSegment_T*, uint32_t ) );
     MOCK_METHOD( HwUartRxSpans_T, Rx_Peek, ( HwUartChannel_T ) );
     MOCK_METHOD( void, Rx_Consume, ( HwUartChannel_T, uint32_t ) );
     MOCK_METHOD( bool, Is_Tx_Complete, ( HwUartChannel_T ) );
+    MOCK_METHOD( bool, Rx_Peek_Frame, ( HwUartChannel_T, HwUartRxFrame_T* ));
+    MOCK_METHOD( bool, Rx_Set_Notify, ( HwUartChannel_T, HwUartRxNotify_T ) );
+    MOCK_METHOD( bool, Rx_Peek_Timeout_Frame,
+                 ( HwUartChannel_T, HwUartRxFrameDescriptor_T*, HwUartRxSpans_T* ));
+    MOCK_METHOD( void, Rx_Release_Timeout_Frame, ( HwUartChannel_T ) );
 };
 
 static MockHwUart* g_mock_hw = nullptr;
@@ -169,6 +177,12 @@ extern "C" bool HW_UART_Tx_Trigger( HwUartChannel_T channel )
     return g_mock_hw->Tx_Trigger( channel );
 }
 
+extern "C" bool HW_UART_Tx_Submit_Zero_Copy( HwUartChannel_T          channel,
+                                             const HwUartTxSegment_T* segments, uint32_t count )
+{
+    return g_mock_hw->Tx_Submit_Zero_Copy( channel, segments, count );
+}
+
 extern "C" HwUartRxSpans_T HW_UART_Rx_Peek( HwUartChannel_T channel )
 {
     return g_mock_hw->Rx_Peek( channel );
@@ -184,6 +198,28 @@ extern "C" bool HW_UART_Is_Tx_Complete( HwUartChannel_T channel )
     return g_mock_hw->Is_Tx_Complete( channel );
 }
 
+extern "C" bool HW_UART_Rx_Peek_Frame( HwUartChannel_T channel, HwUartRxFrame_T* frame )
+{
+    return g_mock_hw->Rx_Peek_Frame( channel, frame );
+}
+
+extern "C" bool HW_UART_Rx_Set_Notify( HwUartChannel_T channel, HwUartRxNotify_T notify )
+{
+    return g_mock_hw->Rx_Set_Notify( channel, notify );
+}
+
+extern "C" bool HW_UART_Rx_Peek_Timeout_Frame( HwUartChannel_T            channel,
+                                               HwUartRxFrameDescriptor_T* descriptor,
+                                               HwUartRxSpans_T*           spans )
+{
+    return g_mock_hw->Rx_Peek_Timeout_Frame( channel, descriptor, spans );
+}
+
+extern "C" void HW_UART_Rx_Release_Timeout_Frame( HwUartChannel_T channel )
+{
+    g_mock_hw->Rx_Release_Timeout_Frame( channel );
+}
+
 // NOLINTEND
 
 /**-----------------------------------------------------------------------------
@@ -219,9 +255,12 @@ class ExecUARTTest : public ::testing::Test
         ON_CALL( mock_hw, Rx_Start( _ ) ).WillByDefault( Return( true ) );
         ON_CALL( mock_hw, Tx_Load_Buffer( _, _, _ ) ).WillByDefault( Return( true ) );
         ON_CALL( mock_hw, Tx_Trigger( _ ) ).WillByDefault( Return( true ) );
+        ON_CALL( mock_hw, Tx_Submit_Zero_Copy( _, _, _ ) ).WillByDefault( Return( true ) );
         ON_CALL( mock_hw, Rx_Peek( _ ) )
             .WillByDefault( Return( TEST_EXEC_UART_Make_Spans( nullptr, 0U, nullptr, 0U ) ) );
         ON_CALL( mock_hw, Is_Tx_Complete( _ ) ).WillByDefault( Return( true ) );
+        ON_CALL( mock_hw, Rx_Peek_Frame( _, _ ) ).WillByDefault( Return( false ) );
+        ON_CALL( mock_hw, Rx_Peek_Timeout_Frame( _, _, _ ) ).WillByDefault( Return( false ) );
 
         memset( s_first_span_data, 0, sizeof( s_first_span_data ) );
         memset( s_second_span_data, 0, sizeof( s_second_span_data ) );
@@ -472,6 +511,42 @@ TEST_F( ExecUARTTest, TransmitReturnsFalseWhenTriggerFails )
     EXPECT_FALSE( EXEC_UART_Transmit( HW_UART_CHANNEL_1, payload, sizeof( payload ) ) );
 }
 
+TEST_F( ExecUARTTest, TransmitZeroCopySubmitsSegmentsThenTriggersPump )
+{
+    static const uint8_t    image[1024] = {};
+    const HwUartTxSegment_T segments[2] = { { image, 512U }, { &image[512], 512U } };
+
+    {
+        InSequence seq;
+        EXPECT_CALL( mock_hw, Tx_Submit_Zero_Copy( HW_UART_CHANNEL_2, segments, 2U ) );
+        EXPECT_CALL( mock_hw, Tx_Trigger( HW_UART_CHANNEL_2 ) );
+    }
+
+    EXPECT_TRUE( EXEC_UART_Transmit_Zero_Copy( HW_UART_CHANNEL_2, segments, 2U ) );
+}
+
+TEST_F( ExecUARTTest, TransmitZeroCopyRejectsEmptySubmission )
+{
+    static const uint8_t    image[4] = {};
+    const HwUartTxSegment_T segment  = { image, sizeof( image ) };
+
+    EXPECT_CALL( mock_hw, Tx_Submit_Zero_Copy( _, _, _ ) ).Times( 0 );
+
+    EXPECT_FALSE( EXEC_UART_Transmit_Zero_Copy( HW_UART_CHANNEL_1, nullptr, 1U ) );
+    EXPECT_FALSE( EXEC_UART_Transmit_Zero_Copy( HW_UART_CHANNEL_1, &segment, 0U ) );
+}
+
+TEST_F( ExecUARTTest, TransmitZeroCopyDoesNotTriggerWhenQueueIsFull )
+{
+    static const uint8_t    image[4] = {};
+    const HwUartTxSegment_T segment  = { image, sizeof( image ) };
+
+    EXPECT_CALL( mock_hw, Tx_Submit_Zero_Copy( _, _, _ ) ).WillOnce( Return( false ) );
+    EXPECT_CALL( mock_hw, Tx_Trigger( _ ) ).Times( 0 );
+
+    EXPECT_FALSE( EXEC_UART_Transmit_Zero_Copy( HW_UART_CHANNEL_1, &segment, 1U ) );
+}
+
 TEST_F( ExecUARTTest, ReadRejectsNullDestination )
 {
     EXPECT_CALL( mock_hw, Rx_Peek( _ ) ).Times( 0 );
@@ -620,3 +695,118 @@ TEST_F( ExecUARTTest, IsTxCompleteReturnsFalseWhenLowLevelDriverReportsIncomplet
 
     EXPECT_FALSE( EXEC_UART_Is_Tx_Complete( HW_UART_CHANNEL_1 ) );
 }
+
+TEST_F( ExecUARTTest, ReadFrameReturnsZeroWhenNoBoundaryPending )
+{
+    EXPECT_CALL( mock_hw, Rx_Peek_Frame( HW_UART_CHANNEL_1, _ ) ).WillOnce( Return( false ) );
+    EXPECT_CALL( mock_hw, Rx_Peek( _ ) ).Times( 0 );
+    EXPECT_CALL( mock_hw, Rx_Consume( _, _ ) ).Times( 0 );
+
+    uint8_t  dest[4]    = {};
+    uint32_t bytes_read = 99U;
+
+    ASSERT_TRUE(
+        EXEC_UART_Read_Frame( HW_UART_CHANNEL_1, dest, sizeof( dest ), &bytes_read, nullptr ) );
+
+    EXPECT_EQ( bytes_read, 0U );
+}
+
+TEST_F( ExecUARTTest, ReadFrameCopiesWrappedFrameAndLeavesLaterBytesQueued )
+{
+    HwUartRxFrame_T frame = { 3U, true };
+
+    s_first_span_data[0]  = 1U;
+    s_first_span_data[1]  = 2U;
+    s_second_span_data[0] = 3U;
+    s_second_span_data[1] = 4U;
+
+    EXPECT_CALL( mock_hw, Rx_Peek_Frame( HW_UART_CHANNEL_2, _ ) )
+        .WillOnce( DoAll( SetArgPointee<1>( frame ), Return( true ) ) );
+    EXPECT_CALL( mock_hw, Rx_Peek( HW_UART_CHANNEL_2 ) )
+        .WillOnce(
+            Return( TEST_EXEC_UART_Make_Spans( s_first_span_data, 2U, s_second_span_data, 2U ) ) );
+    EXPECT_CALL( mock_hw, Rx_Consume( HW_UART_CHANNEL_2, 3U ) ).Times( 1 );
+
+    uint8_t  dest[8]        = {};
+    uint32_t bytes_read     = 0U;
+    bool     frame_complete = false;
+
+    ASSERT_TRUE( EXEC_UART_Read_Frame( HW_UART_CHANNEL_2, dest, sizeof( dest ), &bytes_read,
+                                       &frame_complete ) );
+
+    EXPECT_EQ( bytes_read, 3U );
+    EXPECT_TRUE( frame_complete );
+    EXPECT_EQ( dest[0], 1U );
+    EXPECT_EQ( dest[1], 2U );
+    EXPECT_EQ( dest[2], 3U );
+    EXPECT_EQ( dest[3], 0U );
+}
+
+TEST_F( ExecUARTTest, ReadFrameRejectsFrameLargerThanDestinationWithoutConsuming )
+{
+    HwUartRxFrame_T frame = { 5U, true };
+
+    EXPECT_CALL( mock_hw, Rx_Peek_Frame( _, _ ) )
+        .WillOnce( DoAll( SetArgPointee<1>( frame ), Return( true ) ) );
+    EXPECT_CALL( mock_hw, Rx_Consume( _, _ ) ).Times( 0 );
+
+    uint8_t  dest[4]    = {};
+    uint32_t bytes_read = 0U;
+
+    EXPECT_FALSE(
+        EXEC_UART_Read_Frame( HW_UART_CHANNEL_1, dest, sizeof( dest ), &bytes_read, nullptr ) );
+    EXPECT_EQ( bytes_read, 0U );
+}
+
+TEST_F( ExecUARTTest, ReadTimeoutFrameCopiesFrameAndReleasesDescriptor )
+{
+    HwUartRxFrameDescriptor_T frame = { 4094U, 3U, 1234U, HW_UART_RX_FRAME_ERROR_PARITY };
+    HwUartRxSpans_T           spans =
+        TEST_EXEC_UART_Make_Spans( s_first_span_data, 2U, s_second_span_data, 1U );
+
+    s_first_span_data[0]  = 7U;
+    s_first_span_data[1]  = 8U;
+    s_second_span_data[0] = 9U;
+
+    EXPECT_CALL( mock_hw, Rx_Peek_Timeout_Frame( HW_UART_CHANNEL_2, _, _ ) )
+        .WillOnce( DoAll( SetArgPointee<1>( frame ), SetArgPointee<2>( spans ), Return( true ) ) );
+    EXPECT_CALL( mock_hw, Rx_Release_Timeout_Frame( HW_UART_CHANNEL_2 ) ).Times( 1 );
+    EXPECT_CALL( mock_hw, Rx_Consume( _, _ ) ).Times( 0 );
+
+    uint8_t                   dest[8]    = {};
+    uint32_t                  bytes_read = 0U;
+    HwUartRxFrameDescriptor_T reported   = {};
+
+    ASSERT_TRUE( EXEC_UART_Read_Timeout_Frame( HW_UART_CHANNEL_2, dest, sizeof( dest ),
+                                               &bytes_read, &reported ) );
+
+    EXPECT_EQ( bytes_read, 3U );
+    EXPECT_EQ( dest[0], 7U );
+    EXPECT_EQ( dest[1], 8U );
+    EXPECT_EQ( dest[2], 9U );
+    EXPECT_EQ( reported.timestamp_cycles, 1234U );
+    EXPECT_EQ( reported.error_flags, ( uint32_t )HW_UART_RX_FRAME_ERROR_PARITY );
+}
+
+TEST_F( ExecUARTTest, ReadTimeoutFrameRejectsFrameLargerThanDestinationWithoutReleasing )
+{
+    HwUartRxFrameDescriptor_T frame = { 0U, 5U, 0U, HW_UART_RX_FRAME_ERROR_NONE };
+
+    EXPECT_CALL( mock_hw, Rx_Peek_Timeout_Frame( _, _, _ ) )
+        .WillOnce( DoAll( SetArgPointee<1>( frame ), Return( true ) ) );
+    EXPECT_CALL( mock_hw, Rx_Release_Timeout_Frame( _ ) ).Times( 0 );
+
+    uint8_t  dest[4]    = {};
+    uint32_t bytes_read = 0U;
+
+    EXPECT_FALSE( EXEC_UART_Read_Timeout_Frame( HW_UART_CHANNEL_1, dest, sizeof( dest ),
+                                                &bytes_read, nullptr ) );
+    EXPECT_EQ( bytes_read, 0U );
+}
+
+TEST_F( ExecUARTTest, SetRxNotifyDelegatesToLowLevelDriver )
+{
+    EXPECT_CALL( mock_hw, Rx_Set_Notify( HW_UART_CHANNEL_1, nullptr ) ).WillOnce( Return( true ) );
+
+    EXPECT_TRUE( EXEC_UART_Set_Rx_Notify( HW_UART_CHANNEL_1, nullptr ) );
+}
@@ -28,6 +28,7 @@ CAN_TypeDef              ← "Hardware registers (memory mapped)"
 #include "tests/hw_can_mocks.h"
 #endif
 #include "hw_can.h"
+#include "hw_timer.h"
 #include <stdint.h>
 #include <stdbool.h>
 
@@ -40,27 +41,148 @@ CAN_TypeDef              ← "Hardware registers (memory mapped)"
 #define TOTAL_TQ ( uint32_t )15
 #define MBPS_SAMPLE_POINT ( uint32_t )800
 
-#define RECEIVE_BUFFER_WIDTH ( HW_CAN_RX_QUEUE_CAPACITY + 1U )
+#define RECEIVE_BUFFER_WIDTH1 ( HW_CAN_CH1_RX_QUEUE_CAPACITY + 1U )
+#define RECEIVE_BUFFER_WIDTH2 ( HW_CAN_CH2_RX_QUEUE_CAPACITY + 1U )
 #define TRANSMIT_BUFFER_WIDTH ( HW_CAN_TX_QUEUE_CAPACITY + 1U )
 #define CAN_RX_FIFO_DEPTH 3U
+/* One RX vector drains until its FIFO is empty; at most a frame or two can land while it runs. */
+#define CAN_RX_DRAIN_LIMIT ( 2U * CAN_RX_FIFO_DEPTH )
 
 #define HW_CAN_CH1_TX_IRQ_HANDLER CAN1_TX_IRQHandler
-#define HW_CAN_CH1_RX_IRQ_HANDLER CAN1_RX0_IRQHandler
+#define HW_CAN_CH1_RX0_IRQ_HANDLER CAN1_RX0_IRQHandler
+#define HW_CAN_CH1_RX1_IRQ_HANDLER CAN1_RX1_IRQHandler
 #define HW_CAN_CH2_TX_IRQ_HANDLER CAN2_TX_IRQHandler
-#define HW_CAN_CH2_RX_IRQ_HANDLER CAN2_RX0_IRQHandler
+#define HW_CAN_CH2_RX0_IRQ_HANDLER CAN2_RX0_IRQHandler
+#define HW_CAN_CH2_RX1_IRQ_HANDLER CAN2_RX1_IRQHandler
 #define HW_CAN_CH1_ERROR_IRQ_HANDLER CAN1_SCE_IRQHandler
 #define HW_CAN_CH2_ERROR_IRQ_HANDLER CAN2_SCE_IRQHandler
 
-#define HW_CAN_RX_INTERRUPT_MASK ( CAN_IER_FMPIE0 | CAN_IER_FFIE0 | CAN_IER_FOVIE0 )
+#define HW_CAN_RX_INTERRUPT_MASK                                                                   \
+    ( CAN_IER_FMPIE0 | CAN_IER_FFIE0 | CAN_IER_FOVIE0 | CAN_IER_FMPIE1 | CAN_IER_FFIE1            \
+      | CAN_IER_FOVIE1 )
 #define HW_CAN_ERROR_INTERRUPT_MASK                                                                \
     ( CAN_IER_EWGIE | CAN_IER_EPVIE | CAN_IER_BOFIE | CAN_IER_LECIE | CAN_IER_ERRIE )
 #define HW_CAN_TX_MAILBOX_EMPTY_MASK ( CAN_TSR_TME0 | CAN_TSR_TME1 | CAN_TSR_TME2 )
 
+/* TX mailbox a running cyclic schedule owns; batches and direct sends use the other two. */
+#define HW_CAN_CYCLIC_MAILBOX ( 2U )
+#define HW_CAN_CYCLIC_MAILBOX_EMPTY CAN_TSR_TME2
+
+/* TX mailbox a running auto-responder owns, so the RX interrupt never races a batch for it. */
+#define HW_CAN_RESPONDER_MAILBOX ( 0U )
+#define HW_CAN_RESPONDER_MAILBOX_EMPTY CAN_TSR_TME0
+
+/* A running log replay takes the cyclic schedule's mailbox, so the two never share a channel. */
+#define HW_CAN_REPLAY_MAILBOX HW_CAN_CYCLIC_MAILBOX
+#define HW_CAN_REPLAY_MAILBOX_EMPTY HW_CAN_CYCLIC_MAILBOX_EMPTY
+
+/* Vector of CAN_CYCLIC_TIMER (TIM13, see hw_timer.c); its tick also updates the schedules. */
+#define HW_CAN_CYCLIC_TICK_IRQ TIM8_UP_TIM13_IRQn
+
+/* Vector of CAN_REPLAY_TIMER (TIM1 compare, see hw_timer.c); its shot also updates replays. */
+#define HW_CAN_REPLAY_TIMER_IRQ TIM1_CC_IRQn
+
+/* Longest single shot of the 16-bit replay timer at one count per microsecond. */
+#define HW_CAN_REPLAY_TIMER_MAX_US ( 0x10000U )
+/* Shortest shot; a timer with an auto-reload of zero does not count. */
+#define HW_CAN_REPLAY_TIMER_MIN_US ( 2U )
+
+/* RF1R uses the RF0R bit layout, so the FIFO helpers use the FIFO0 masks for both FIFOs. */
+#if CAN_RF1R_FMP1 != CAN_RF0R_FMP0 || CAN_RF1R_FULL1 != CAN_RF0R_FULL0 \
+    || CAN_RF1R_FOVR1 != CAN_RF0R_FOVR0 || CAN_RF1R_RFOM1 != CAN_RF0R_RFOM0
+#error "bxCAN RF0R and RF1R bit layouts differ"
+#endif
+
+/* Identifier positions shared by the TIxR/RIxR mailbox and FxRy filter registers. */
+#define HW_CAN_STANDARD_ID_SHIFT ( 21U )
+#define HW_CAN_EXTENDED_ID_SHIFT ( 3U )
+
+/* First CAN2 bank of the fixed split used while either channel holds a single-bank filter. */
+#define HW_CAN_FILTER_FIXED_CAN2_FIRST_BANK ( 14U )
+
+/* FIFO0 and FIFO1 vectors of both channels, masked together while filters change. */
+#define HW_CAN_RX_IRQ_COUNT ( 4U )
+
+/* Most vectors one critical section masks: a channel's four, or both channels' RX. */
+#define HW_CAN_IRQ_MASK_MAX ( 4U )
+
+/* ESR last error code value that no bus error produces. */
+#define HW_CAN_LEC_SET_BY_SOFTWARE ( 7U )
+
 /**-----------------------------------------------------------------------------
  *  Typedefs / Enums / Structures
  *------------------------------------------------------------------------------
  */
 
+/**
+ * Cyclic schedule of one channel. mailbox_reserved is set while the schedule
+ * runs and stays set after a stop until its last frame leaves the mailbox.
+ */
+typedef struct HW_CAN_Cyclic_Channel_T
+{
+    HW_CAN_Cyclic_Schedule_T schedule;
+    volatile bool            running;
+    volatile bool            mailbox_reserved;
+
+} HW_CAN_Cyclic_Channel_T;
+
+/**
+ * Timestamp state of one channel. last_tx_us holds the start of frame of the
+ * last acknowledged batch frame and is valid once last_tx_valid is set.
+ */
+typedef struct HW_CAN_Time_Channel_T
+{
+    HW_CAN_Time_Base_T base;
+    volatile uint32_t  last_tx_us;
+    volatile bool      last_tx_valid;
+
+} HW_CAN_Time_Channel_T;
+
+/**
+ * Auto-responder of one channel. mailbox_reserved is set while the responder
+ * runs and stays set after a stop until its last response leaves the mailbox.
+ */
+typedef struct HW_CAN_Responder_Channel_T
+{
+    HW_CAN_Responder_T responder;
+    volatile bool      running;
+    volatile bool      mailbox_reserved;
+
+} HW_CAN_Responder_Channel_T;
+
+/**
+ * Log replay of one channel. mailbox_reserved is set while the replay runs
+ * and stays set after it stops or ends until its last frame leaves the mailbox.
+ */
+typedef struct HW_CAN_Replay_Channel_T
+{
+    HW_CAN_Replay_T replay;
+    volatile bool   running;
+    volatile bool   mailbox_reserved;
+
+} HW_CAN_Replay_Channel_T;
+
+/**
+ * Single-bank filter installed by HW_CAN_Configure1/2. It is kept while a
+ * filter set on the other channel reprograms the shared banks.
+ */
+typedef struct HW_CAN_Single_Filter_T
+{
+    HW_CAN_Filter_Bank_T image;
+    uint8_t              bank;
+    bool                 active;
+
+} HW_CAN_Single_Filter_T;
+
+/** NVIC vectors masked around a critical section, with the enable state each had before. */
+typedef struct HW_CAN_Irq_Mask_T
+{
+    IRQn_Type irqs[HW_CAN_IRQ_MASK_MAX];
+    uint32_t  was_enabled[HW_CAN_IRQ_MASK_MAX];
+    uint8_t   count;
+
+} HW_CAN_Irq_Mask_T;
+
 /**-----------------------------------------------------------------------------
  *  Public (global) and Extern Variables
  *------------------------------------------------------------------------------
@@ -92,8 +214,38 @@ static volatile uint32_t           can_tx_pending_mailbox2 = 0;
 static volatile HW_CAN_Tx_Status_T can_tx_status1          = HW_CAN_TX_STATUS_IDLE;
 static volatile HW_CAN_Tx_Status_T can_tx_status2          = HW_CAN_TX_STATUS_IDLE;
 
+/* Filter sets; software_ids is non-zero when the RX ISR must re-check widened entries. */
+static HW_CAN_Filter_Plan_T   can_filter_plan1;
+static HW_CAN_Filter_Plan_T   can_filter_plan2;
+static uint8_t                can_filter_can2_first_bank = HW_CAN_FILTER_FIXED_CAN2_FIRST_BANK;
+static HW_CAN_Single_Filter_T can_filter_single1;
+static HW_CAN_Single_Filter_T can_filter_single2;
+static const IRQn_Type        can_rx_irqs[HW_CAN_RX_IRQ_COUNT] = { CAN1_RX0_IRQn, CAN1_RX1_IRQn,
+                                                                   CAN2_RX0_IRQn, CAN2_RX1_IRQn };
+
+/* Periodic frame schedules, ticked by CAN_CYCLIC_TIMER. */
+static HW_CAN_Cyclic_Channel_T can_cyclic1;
+static HW_CAN_Cyclic_Channel_T can_cyclic2;
+
+/* Time-triggered mode timestamps, extended onto the shared time base */
+static HW_CAN_Time_Channel_T can_time1;
+static HW_CAN_Time_Channel_T can_time2;
+
+/* Request/response tables matched in the RX interrupts */
+static HW_CAN_Responder_Channel_T can_responder1;
+static HW_CAN_Responder_Channel_T can_responder2;
+
+/* Log replays, paced by CAN_REPLAY_TIMER. */
+static HW_CAN_Replay_Channel_T can_replay1;
+static HW_CAN_Replay_Channel_T can_replay2;
+static uint32_t                can_replay_prescaler = 0U;
+
+/* Traffic, error and arbitration statistics, fed by the TX, RX and error interrupts */
+static HW_CAN_Stats_T can_stats1;
+static HW_CAN_Stats_T can_stats2;
+
 /* Buffer for rx channel 1 */
-static CAN_Packet_T      can_rx_buffer1[RECEIVE_BUFFER_WIDTH];
+static CAN_Packet_T      can_rx_buffer1[RECEIVE_BUFFER_WIDTH1];
 static volatile uint16_t can_rx_wp1 = 0;
 static volatile uint16_t can_rx_rp1 = 0;
 /* Buffer for tx channel 1 */
@@ -101,7 +253,7 @@ static CAN_Packet_T      can_tx_buffer1[TRANSMIT_BUFFER_WIDTH];
 static volatile uint16_t can_tx_wp1 = 0;
 static volatile uint16_t can_tx_rp1 = 0;
 /* Buffer for rx channel 2 */
-static CAN_Packet_T      can_rx_buffer2[RECEIVE_BUFFER_WIDTH];
+static CAN_Packet_T      can_rx_buffer2[RECEIVE_BUFFER_WIDTH2];
 static volatile uint16_t can_rx_wp2 = 0;
 static volatile uint16_t can_rx_rp2 = 0;
 /* Buffer for tx channel 2 */
@@ -122,51 +274,114 @@ static volatile uint16_t can_tx_rp2 = 0;
 
 // IRQ Re-Definitions
 void HW_CAN_CH1_TX_IRQ_HANDLER( void );
-void HW_CAN_CH1_RX_IRQ_HANDLER( void );
+void HW_CAN_CH1_RX0_IRQ_HANDLER( void );
+void HW_CAN_CH1_RX1_IRQ_HANDLER( void );
 void HW_CAN_CH2_TX_IRQ_HANDLER( void );
-void HW_CAN_CH2_RX_IRQ_HANDLER( void );
+void HW_CAN_CH2_RX0_IRQ_HANDLER( void );
+void HW_CAN_CH2_RX1_IRQ_HANDLER( void );
 void HW_CAN_CH1_ERROR_IRQ_HANDLER( void );
 void HW_CAN_CH2_ERROR_IRQ_HANDLER( void );
 
 static bool            HW_CAN_Packet_Is_Valid( const CAN_Packet_T* packet );
 static HW_CAN_Result_T HW_CAN_Transmit_To_Mailbox( CAN_HandleTypeDef* hcan, uint8_t* txData,
-                                                   uint16_t id, uint8_t size,
+                                                   uint32_t id, bool extended, uint8_t size,
+                                                   uint32_t  allowed_mailboxes,
                                                    uint32_t* request_complete_flag );
 static HW_CAN_Result_T HW_CAN_Tx_Service( CAN_HandleTypeDef* hcan, CAN_Packet_T buffer[],
                                           volatile uint16_t* w_p, volatile uint16_t* r_p,
                                           uint16_t buffer_width, volatile bool* active,
                                           volatile bool*               completed,
                                           volatile uint32_t*           pending_mailbox,
-                                          volatile HW_CAN_Tx_Status_T* status );
+                                          volatile HW_CAN_Tx_Status_T* status,
+                                          HW_CAN_Cyclic_Channel_T*     cyclic );
 static HW_CAN_Result_T HW_CAN_Tx_Trigger( CAN_HandleTypeDef* hcan, CAN_Packet_T buffer[],
                                           volatile uint16_t* w_p, volatile uint16_t* r_p,
                                           uint16_t buffer_width, volatile bool* active,
                                           volatile bool*               completed,
                                           volatile uint32_t*           pending_mailbox,
-                                          volatile HW_CAN_Tx_Status_T* status );
+                                          volatile HW_CAN_Tx_Status_T* status,
+                                          HW_CAN_Cyclic_Channel_T*     cyclic );
 static void HW_CAN_Tx_IRQ( CAN_HandleTypeDef* hcan, CAN_Packet_T buffer[], volatile uint16_t* w_p,
                            volatile uint16_t* r_p, uint16_t buffer_width, volatile bool* active,
                            volatile bool* completed, volatile uint32_t* pending_mailbox,
-                           volatile HW_CAN_Tx_Status_T* status );
-static void HW_CAN_Rx_IRQ( CAN_HandleTypeDef* hcan, CAN_Packet_T buffer[], volatile uint16_t* w_p,
-                           volatile uint16_t* r_p, volatile uint32_t* dropped_count );
+                           volatile HW_CAN_Tx_Status_T* status, HW_CAN_Cyclic_Channel_T* cyclic );
+static int  HW_CAN_Receive_FIFO( CAN_HandleTypeDef* hcan, uint8_t fifo, CAN_Packet_T* rxPacket );
+static void HW_CAN_Rx_IRQ( CAN_HandleTypeDef* hcan, uint8_t fifo, CAN_Packet_T buffer[],
+                           volatile uint16_t* w_p, volatile uint16_t* r_p, uint16_t buffer_width,
+                           volatile uint32_t*          dropped_count,
+                           const HW_CAN_Filter_Plan_T* filter_plan );
 static void HW_CAN_Error_IRQ( CAN_HandleTypeDef* hcan, volatile bool* active,
                               volatile bool* completed, volatile uint32_t* pending_mailbox,
                               volatile HW_CAN_Tx_Status_T* status );
-static void HW_CAN_Reset_Channel( CAN_TypeDef* can, IRQn_Type tx_irq, IRQn_Type rx_irq,
-                                  IRQn_Type error_irq, volatile uint16_t* tx_wp,
+static void HW_CAN_Reset_Channel( CAN_TypeDef* can, IRQn_Type tx_irq, IRQn_Type rx0_irq,
+                                  IRQn_Type rx1_irq, IRQn_Type error_irq, volatile uint16_t* tx_wp,
                                   volatile uint16_t* tx_rp, volatile uint16_t* rx_wp,
                                   volatile uint16_t* rx_rp, volatile bool* active,
                                   volatile bool* completed, volatile uint32_t* dropped_count,
                                   volatile uint32_t*           pending_mailbox,
-                                  volatile HW_CAN_Tx_Status_T* status );
-static HW_CAN_Result_T HW_CAN_Recover( CAN_HandleTypeDef* hcan, IRQn_Type tx_irq, IRQn_Type rx_irq,
-                                       IRQn_Type error_irq, volatile uint16_t* tx_wp,
-                                       volatile uint16_t* tx_rp, volatile bool* active,
-                                       volatile bool* completed, volatile uint32_t* pending_mailbox,
-                                       volatile HW_CAN_Tx_Status_T* status );
+                                  volatile HW_CAN_Tx_Status_T* status,
+                                  HW_CAN_Cyclic_Channel_T*     cyclic );
+static HW_CAN_Result_T HW_CAN_Recover( CAN_HandleTypeDef* hcan, IRQn_Type tx_irq, IRQn_Type rx0_irq,
+                                       IRQn_Type rx1_irq, IRQn_Type error_irq,
+                                       volatile uint16_t* tx_wp, volatile uint16_t* tx_rp,
+                                       volatile bool* active, volatile bool* completed,
+                                       volatile uint32_t*           pending_mailbox,
+                                       volatile HW_CAN_Tx_Status_T* status,
+                                       HW_CAN_Cyclic_Channel_T*     cyclic );
 static void            HW_CAN_Tx_Buffer_Cancel( IRQn_Type tx_irq, volatile uint16_t* w_p,
                                                 volatile uint16_t* r_p );
+static HAL_StatusTypeDef HW_CAN_Apply_Filter_Banks( uint8_t can2_first_bank );
+static HAL_StatusTypeDef HW_CAN_Pack_Filter_Banks( void );
+static void HW_CAN_Mask_Irqs( HW_CAN_Irq_Mask_T* mask, const IRQn_Type irqs[], uint8_t count );
+static void HW_CAN_Unmask_Irqs( const HW_CAN_Irq_Mask_T* mask );
+static int HW_CAN_Keep_Single_Filter( HW_CAN_Single_Filter_T* single, uint16_t filter_bank,
+                                      uint32_t filter_id, uint32_t filter_mask,
+                                      bool filter_extended, bool repack );
+static HW_CAN_Result_T   HW_CAN_Set_Filters( HW_CAN_Filter_Plan_T*       plan,
+                                             HW_CAN_Single_Filter_T*     single,
+                                             const HW_CAN_Filter_Rule_T rules[],
+                                             uint16_t                   rule_count );
+static void HW_CAN_Get_Filter_Report( const HW_CAN_Filter_Plan_T* plan, uint8_t first_bank,
+                                      HW_CAN_Filter_Report_T* report );
+static HW_CAN_Result_T HW_CAN_Cyclic_Start( CAN_HandleTypeDef* hcan, IRQn_Type tx_irq,
+                                            HW_CAN_Cyclic_Channel_T*    cyclic,
+                                            const HW_CAN_Cyclic_Entry_T table[], uint16_t count );
+static void            HW_CAN_Cyclic_Stop( IRQn_Type tx_irq, HW_CAN_Cyclic_Channel_T* cyclic );
+static void HW_CAN_Cyclic_Load_Mailbox( CAN_HandleTypeDef* hcan, HW_CAN_Cyclic_Channel_T* cyclic );
+static HW_CAN_Result_T HW_CAN_Cyclic_Copy_Stats( IRQn_Type tx_irq, HW_CAN_Cyclic_Channel_T* cyclic,
+                                                 uint16_t index, HW_CAN_Cyclic_Stats_T* stats );
+static bool HW_CAN_Copy_Tx_Timestamp( IRQn_Type tx_irq, HW_CAN_Time_Channel_T* time,
+                                      uint32_t* timestamp_us );
+static HW_CAN_Result_T HW_CAN_Responder_Start( CAN_HandleTypeDef* hcan, IRQn_Type tx_irq,
+                                               IRQn_Type rx0_irq, IRQn_Type rx1_irq,
+                                               HW_CAN_Responder_Channel_T*     channel,
+                                               const HW_CAN_Responder_Entry_T table[],
+                                               uint16_t                        count );
+static void HW_CAN_Responder_Stop( IRQn_Type tx_irq, IRQn_Type rx0_irq, IRQn_Type rx1_irq,
+                                   HW_CAN_Responder_Channel_T* channel );
+static void HW_CAN_Responder_Load_Mailbox( CAN_HandleTypeDef*          hcan,
+                                           HW_CAN_Responder_Channel_T* channel );
+static HW_CAN_Result_T HW_CAN_Responder_Copy_Stats( IRQn_Type tx_irq, IRQn_Type rx0_irq,
+                                                    IRQn_Type                   rx1_irq,
+                                                    HW_CAN_Responder_Channel_T* channel,
+                                                    HW_CAN_Responder_Stats_T*   stats );
+static HW_CAN_Result_T HW_CAN_Replay_Start( CAN_HandleTypeDef* hcan, IRQn_Type tx_irq,
+                                            HW_CAN_Replay_Channel_T*       channel,
+                                            const HW_CAN_Cyclic_Channel_T* cyclic,
+                                            const uint8_t log[], uint32_t length,
+                                            uint32_t time_scale, uint32_t passes );
+static void HW_CAN_Replay_Stop( IRQn_Type tx_irq, HW_CAN_Replay_Channel_T* channel );
+static bool HW_CAN_Replay_Service( CAN_HandleTypeDef* hcan, HW_CAN_Replay_Channel_T* channel,
+                                   uint32_t now_us );
+static void HW_CAN_Replay_Arm_Timer( uint32_t now_us );
+static void HW_CAN_Replay_Kick_Timer( void );
+static HW_CAN_Result_T HW_CAN_Bus_Copy_Stats( CAN_TypeDef* can, IRQn_Type tx_irq, IRQn_Type rx0_irq,
+                                              IRQn_Type rx1_irq, IRQn_Type error_irq,
+                                              HW_CAN_Bus_Stats_T* stats );
+static void            HW_CAN_Bus_Reset_Stats( CAN_TypeDef* can, IRQn_Type tx_irq, IRQn_Type rx0_irq,
+                                               IRQn_Type rx1_irq, IRQn_Type error_irq );
+static HW_CAN_Result_T HW_CAN_Replay_Copy_Stats( IRQn_Type tx_irq, HW_CAN_Replay_Channel_T* channel,
+                                                 HW_CAN_Replay_Stats_T* stats );
 
 /**-----------------------------------------------------------------------------
  *  Private (static) Function Prototypes
@@ -323,11 +538,13 @@ void HW_CAN_Buffer_consume( volatile uint16_t* pointer, uint16_t update, uint16_
 
     Typical CAN TIR is broken up into sections:
 
-    31                          21 20-19 18-17 16.............0
+    31              21 20                      3   2     1     0
+    +-----------------+------------------------+-----+-----+------+
+    | STID[10:0]      | EXID[17:0]             | IDE | RTR | TXRQ |
+    +-----------------+------------------------+-----+-----+------+
 
-    +--------------------------------+--+--+-------------------+
-    | Standard ID (11 bits)         |RTR|IDE| Reserved        |
-    +--------------------------------+--+--+-------------------+
+    A standard frame places its 11-bit ID in STID with IDE clear. An extended
+    frame places its 29-bit ID across STID:EXID (bits 31:3) with IDE set.
 
     Typical CAN TDTR is broken up into sections:
 
@@ -340,24 +557,27 @@ void HW_CAN_Buffer_consume( volatile uint16_t* pointer, uint16_t update, uint16_
  * Writes the bxCAN mailbox registers directly.
  */
 static HW_CAN_Result_T HW_CAN_Transmit_To_Mailbox( CAN_HandleTypeDef* hcan, uint8_t* txData,
-                                                   uint16_t id, uint8_t size,
+                                                   uint32_t id, bool extended, uint8_t size,
+                                                   uint32_t  allowed_mailboxes,
                                                    uint32_t* request_complete_flag )
 {
-    if ( id > CAN_STANDARD_ID_MAX || size > CAN_PACKET_SIZE || ( size > 0U && txData == NULL ) )
+    uint32_t id_max = extended ? CAN_EXTENDED_ID_MAX : CAN_STANDARD_ID_MAX;
+    if ( id > id_max || size > CAN_PACKET_SIZE || ( size > 0U && txData == NULL ) )
     {
-        // The address is larger than 11 bits or the size is larger than 8 bytes
+        // The address does not fit its identifier format or the size is larger than 8 bytes
         return HW_CAN_RESULT_ERROR;
     }
 
     CAN_TypeDef* can     = hcan->Instance;
+    uint32_t     empty   = can->TSR & allowed_mailboxes;
     uint8_t      mailbox = 0;
 
     // Check mailbox available
-    if ( can->TSR & CAN_TSR_TME0 )
+    if ( empty & CAN_TSR_TME0 )
         mailbox = 0;
-    else if ( can->TSR & CAN_TSR_TME1 )
+    else if ( empty & CAN_TSR_TME1 )
         mailbox = 1;
-    else if ( can->TSR & CAN_TSR_TME2 )
+    else if ( empty & CAN_TSR_TME2 )
         mailbox = 2;
     else
         return HW_CAN_RESULT_BUSY;
@@ -372,8 +592,15 @@ static HW_CAN_Result_T HW_CAN_Transmit_To_Mailbox( CAN_HandleTypeDef* hcan, uint
         *request_complete_flag = request_complete_flags[mailbox];
     }
 
-    // Standard ID is 11 bits and has to be shifted to the top 11 bits of the register
-    can->sTxMailBox[mailbox].TIR = ( ( uint32_t )id << 21U );
+    // Standard IDs occupy the top 11 bits; extended IDs occupy the top 29 bits with IDE set
+    if ( extended )
+    {
+        can->sTxMailBox[mailbox].TIR = ( id << HW_CAN_EXTENDED_ID_SHIFT ) | CAN_TI0R_IDE;
+    }
+    else
+    {
+        can->sTxMailBox[mailbox].TIR = id << HW_CAN_STANDARD_ID_SHIFT;
+    }
 
     // DLC = 8, (sending 8 bytes)
     can->sTxMailBox[mailbox].TDTR = size;
@@ -431,33 +658,150 @@ static inline void HW_CAN_Clear_Tx_Request_Complete( CAN_TypeDef* can,
 #endif
 }
 
-/** Release one bxCAN FIFO0 output entry using its write-one command bit. */
-static inline void HW_CAN_Release_Rx_FIFO0( CAN_TypeDef* can )
+/** Auto-responder of the channel that owns a bxCAN instance. */
+static inline HW_CAN_Responder_Channel_T* HW_CAN_Responder_Channel( const CAN_TypeDef* can )
+{
+    return can == CAN2 ? &can_responder2 : &can_responder1;
+}
+
+/** Log replay of the channel that owns a bxCAN instance. */
+static inline HW_CAN_Replay_Channel_T* HW_CAN_Replay_Channel( const CAN_TypeDef* can )
+{
+    return can == CAN2 ? &can_replay2 : &can_replay1;
+}
+
+/** Statistics of the channel that owns a bxCAN instance. */
+static inline HW_CAN_Stats_T* HW_CAN_Stats_Channel( const CAN_TypeDef* can )
+{
+    return can == CAN2 ? &can_stats2 : &can_stats1;
+}
+
+/** TX mailboxes left to batches and direct sends on a channel. */
+static inline uint32_t HW_CAN_Batch_Mailboxes( const CAN_TypeDef*             can,
+                                               const HW_CAN_Cyclic_Channel_T* cyclic )
+{
+    uint32_t mailboxes = HW_CAN_TX_MAILBOX_EMPTY_MASK;
+    if ( cyclic->mailbox_reserved || HW_CAN_Replay_Channel( can )->mailbox_reserved )
+    {
+        mailboxes &= ~HW_CAN_CYCLIC_MAILBOX_EMPTY;
+    }
+    if ( HW_CAN_Responder_Channel( can )->mailbox_reserved )
+    {
+        mailboxes &= ~HW_CAN_RESPONDER_MAILBOX_EMPTY;
+    }
+    return mailboxes;
+}
+
+/** Mask the TX completion interrupt unless a cyclic schedule, responder or replay needs it. */
+static inline void HW_CAN_Release_Tx_Interrupt( CAN_TypeDef*                   can,
+                                                const HW_CAN_Cyclic_Channel_T* cyclic )
+{
+    if ( !cyclic->mailbox_reserved && !HW_CAN_Responder_Channel( can )->mailbox_reserved
+         && !HW_CAN_Replay_Channel( can )->mailbox_reserved )
+    {
+        CLEAR_BIT( can->IER, CAN_IER_TMEIE );
+    }
+}
+
+/** Timestamp state of the channel that owns a bxCAN instance. */
+static inline HW_CAN_Time_Channel_T* HW_CAN_Time_Channel( const CAN_TypeDef* can )
+{
+    return can == CAN2 ? &can_time2 : &can_time1;
+}
+
+/** Start of frame of a frame just sent from a TX mailbox, on the shared time base. */
+static inline uint32_t HW_CAN_Tx_Mailbox_Timestamp( CAN_TypeDef* can, uint8_t mailbox,
+                                                    uint32_t now_us )
+{
+    const CAN_TxMailBox_TypeDef* tx   = &can->sTxMailBox[mailbox];
+    uint32_t                     tdtr = tx->TDTR;
+
+    return HW_CAN_Time_Extend(
+        &HW_CAN_Time_Channel( can )->base, ( uint16_t )( tdtr >> CAN_TDT0R_TIME_Pos ),
+        HW_CAN_Time_Frame_Bits( ( tx->TIR & CAN_TI0R_IDE ) != 0U,
+                                ( uint8_t )( tdtr & CAN_TDT0R_DLC ) ),
+        now_us );
+}
+
+/** Count a completed TX mailbox request, identified from the mailbox registers. */
+static inline void HW_CAN_Stats_Tx_Mailbox( CAN_TypeDef* can, uint8_t mailbox, bool sent,
+                                            bool arbitration_lost, bool transmit_error,
+                                            uint32_t now_us )
+{
+    const CAN_TxMailBox_TypeDef* tx       = &can->sTxMailBox[mailbox];
+    uint32_t                     tir      = tx->TIR;
+    bool                         extended = ( tir & CAN_TI0R_IDE ) != 0U;
+    uint32_t id = extended ? ( tir >> HW_CAN_EXTENDED_ID_SHIFT ) & CAN_EXTENDED_ID_MAX
+                           : ( tir >> HW_CAN_STANDARD_ID_SHIFT ) & CAN_STANDARD_ID_MAX;
+
+    HW_CAN_Stats_Tx( HW_CAN_Stats_Channel( can ), id, extended,
+                     ( uint8_t )( tx->TDTR & CAN_TDT0R_DLC ), sent, arbitration_lost,
+                     transmit_error, now_us );
+}
+
+/** Decode a bxCAN error status register for the statistics. */
+static inline void HW_CAN_Read_Error_State( uint32_t esr, HW_CAN_Stats_Error_State_T* state )
+{
+    uint8_t last_error = ( uint8_t )( ( esr & CAN_ESR_LEC ) >> CAN_ESR_LEC_Pos );
+
+    state->tec     = ( uint8_t )( ( esr & CAN_ESR_TEC ) >> CAN_ESR_TEC_Pos );
+    state->rec     = ( uint8_t )( ( esr & CAN_ESR_REC ) >> CAN_ESR_REC_Pos );
+    state->warning = ( esr & CAN_ESR_EWGF ) != 0U;
+    state->passive = ( esr & CAN_ESR_EPVF ) != 0U;
+    state->bus_off = ( esr & CAN_ESR_BOFF ) != 0U;
+    // Code 7 is only ever written by software
+    state->last_error = last_error != HW_CAN_LEC_SET_BY_SOFTWARE ? last_error : 0U;
+}
+
+/** Return the RF0R or RF1R status register of one bxCAN receive FIFO. */
+static inline volatile uint32_t* HW_CAN_Rx_FIFO_Status( CAN_TypeDef* can, uint8_t fifo )
+{
+    return fifo == 0U ? &can->RF0R : &can->RF1R;
+}
+
+/** Release one bxCAN FIFO output entry using its write-one command bit. */
+static inline void HW_CAN_Release_Rx_FIFO( CAN_TypeDef* can, uint8_t fifo )
 {
+    volatile uint32_t* rfr = HW_CAN_Rx_FIFO_Status( can, fifo );
 #ifdef TEST_BUILD
-    uint32_t pending = can->RF0R & CAN_RF0R_FMP0;
+    uint32_t pending = *rfr & CAN_RF0R_FMP0;
     if ( pending > 0U )
     {
         pending--;
     }
-    can->RF0R = ( can->RF0R & ~( CAN_RF0R_FMP0 | CAN_RF0R_FULL0 ) ) | pending | CAN_RF0R_RFOM0;
+    *rfr = ( *rfr & ~( CAN_RF0R_FMP0 | CAN_RF0R_FULL0 ) ) | pending | CAN_RF0R_RFOM0;
 #else
-    can->RF0R = CAN_RF0R_RFOM0;
+    *rfr = CAN_RF0R_RFOM0;
 #endif
 }
 
-/** Clear selected bxCAN FIFO0 write-one-to-clear status flags. */
-static inline void HW_CAN_Clear_Rx_FIFO0_Flags( CAN_TypeDef* can, uint32_t flags )
+/** Clear selected bxCAN FIFO write-one-to-clear status flags. */
+static inline void HW_CAN_Clear_Rx_FIFO_Flags( CAN_TypeDef* can, uint8_t fifo, uint32_t flags )
 {
+    volatile uint32_t* rfr = HW_CAN_Rx_FIFO_Status( can, fifo );
 #ifdef TEST_BUILD
-    can->RF0R &= ~flags;
+    *rfr &= ~flags;
 #else
-    can->RF0R = flags;
+    *rfr = flags;
 #endif
 }
 
+/** FR1 of a single 32-bit mask filter: the identifier in the RIR layout, IDE set if extended. */
+static inline uint32_t HW_CAN_Single_Filter_Id( uint32_t filter_id, bool filter_extended )
+{
+    uint32_t id_shift = filter_extended ? HW_CAN_EXTENDED_ID_SHIFT : HW_CAN_STANDARD_ID_SHIFT;
+    return ( filter_id << id_shift ) | ( filter_extended ? CAN_RI0R_IDE : 0U );
+}
+
+/** FR2 of a single 32-bit mask filter; IDE and RTR are always compared. */
+static inline uint32_t HW_CAN_Single_Filter_Mask( uint32_t filter_mask, bool filter_extended )
+{
+    uint32_t id_shift = filter_extended ? HW_CAN_EXTENDED_ID_SHIFT : HW_CAN_STANDARD_ID_SHIFT;
+    return ( filter_mask << id_shift ) | CAN_RI0R_IDE | CAN_RI0R_RTR;
+}
+
 /**
- * @brief Receives data from the selected bxCAN FIFO0 mailbox.
+ * @brief Receives data from the bxCAN FIFO0 mailbox, or FIFO1 when FIFO0 is empty.
  *
  * @param hcan the pointer to the handle for the can peripheral
  * @param rxPacket Destination for the received packet.
@@ -465,36 +809,62 @@ static inline void HW_CAN_Clear_Rx_FIFO0_Flags( CAN_TypeDef* can, uint32_t flags
  * Reads the bxCAN FIFO registers directly.
  */
 int HW_CAN_Receive( CAN_HandleTypeDef* hcan, CAN_Packet_T* rxPacket )
+{
+    if ( HW_CAN_Receive_FIFO( hcan, 0U, rxPacket ) == 0 )
+    {
+        return 0;
+    }
+
+    return HW_CAN_Receive_FIFO( hcan, 1U, rxPacket );
+}
+
+/**
+ * @brief Receives data from one bxCAN receive FIFO mailbox.
+ *
+ * @param hcan the pointer to the handle for the can peripheral
+ * @param fifo 0 or 1
+ * @param rxPacket Destination for the received packet.
+ */
+static int HW_CAN_Receive_FIFO( CAN_HandleTypeDef* hcan, uint8_t fifo, CAN_Packet_T* rxPacket )
 {
     if ( rxPacket == NULL )
     {
         return 1;
     }
 
-    CAN_TypeDef* can = hcan->Instance;
+    CAN_TypeDef*                   can     = hcan->Instance;
+    const CAN_FIFOMailBox_TypeDef* mailbox = &can->sFIFOMailBox[fifo];
 
-    /* Check FIFO0 has pending message */
-    if ( ( can->RF0R & CAN_RF0R_FMP0 ) == 0 )
+    /* Check the FIFO has a pending message */
+    if ( ( *HW_CAN_Rx_FIFO_Status( can, fifo ) & CAN_RF0R_FMP0 ) == 0 )
     {
         return 1;
     }
 
     /*
-     * Standard CAN ID is stored in bits 31:21 of RIR.
-     *
-     * The current driver uses standard 11-bit CAN identifiers.
+     * Standard CAN ID is stored in bits 31:21 of RIR. When IDE is set the
+     * extended 29-bit ID is stored in bits 31:3.
      */
-    rxPacket->id  = ( uint16_t )( ( can->sFIFOMailBox[0].RIR >> 21 ) & CAN_STANDARD_ID_MAX );
-    rxPacket->dlc = ( uint8_t )( can->sFIFOMailBox[0].RDTR & CAN_RDT0R_DLC );
+    uint32_t rir       = mailbox->RIR;
+    rxPacket->extended = ( rir & CAN_RI0R_IDE ) != 0U;
+    rxPacket->id       = rxPacket->extended
+                             ? ( rir >> HW_CAN_EXTENDED_ID_SHIFT ) & CAN_EXTENDED_ID_MAX
+                             : ( rir >> HW_CAN_STANDARD_ID_SHIFT ) & CAN_STANDARD_ID_MAX;
+    rxPacket->dlc      = ( uint8_t )( mailbox->RDTR & CAN_RDT0R_DLC );
 
     if ( rxPacket->dlc > CAN_PACKET_SIZE )
     {
-        HW_CAN_Release_Rx_FIFO0( can );
+        HW_CAN_Release_Rx_FIFO( can, fifo );
         return 1;
     }
 
-    uint32_t low  = can->sFIFOMailBox[0].RDLR;
-    uint32_t high = can->sFIFOMailBox[0].RDHR;
+    /* Time-triggered mode captures the start of frame in RDTR bits 31:16 */
+    rxPacket->timestamp_us = HW_CAN_Time_Extend(
+        &HW_CAN_Time_Channel( can )->base, ( uint16_t )( mailbox->RDTR >> CAN_RDT0R_TIME_Pos ),
+        HW_CAN_Time_Frame_Bits( rxPacket->extended, rxPacket->dlc ), HW_TIMER_Get_Time_Us() );
+
+    uint32_t low  = mailbox->RDLR;
+    uint32_t high = mailbox->RDHR;
 
     memset( rxPacket->data, 0, sizeof( rxPacket->data ) );
     for ( uint8_t i = 0; i < rxPacket->dlc; i++ )
@@ -505,7 +875,7 @@ int HW_CAN_Receive( CAN_HandleTypeDef* hcan, CAN_Packet_T* rxPacket )
     }
 
     /* Release FIFO */
-    HW_CAN_Release_Rx_FIFO0( can );
+    HW_CAN_Release_Rx_FIFO( can, fifo );
 
     return 0;
 }
@@ -657,7 +1027,7 @@ HAL_StatusTypeDef HW_CAN_Apply_Timing_HAL( CAN_HandleTypeDef* hcan, CanPropertie
     }
 
     // Other required settings
-    hcan->Init.TimeTriggeredMode    = DISABLE;
+    hcan->Init.TimeTriggeredMode    = ENABLE;
     hcan->Init.AutoBusOff           = DISABLE;
     hcan->Init.AutoWakeUp           = DISABLE;
     hcan->Init.AutoRetransmission   = ENABLE;
@@ -672,6 +1042,7 @@ HAL_StatusTypeDef HW_CAN_Apply_Timing_HAL( CAN_HandleTypeDef* hcan, CanPropertie
  *
  * @param filter The filter struct associated with hcan (that we are writing to)
  * @param hcan the pointer to the handle for the can peripheral
+ * @param filter_extended true to match 29-bit extended IDs, false for 11-bit standard IDs
  *
  * This function applies the desired can filter properties using the HAL library
     Can filtering works as follows:
@@ -703,8 +1074,8 @@ HAL_StatusTypeDef HW_CAN_Apply_Timing_HAL( CAN_HandleTypeDef* hcan, CanPropertie
  *
  */
 HAL_StatusTypeDef HW_CAN_Apply_Filter_HAL( CAN_FilterTypeDef* filter, CAN_HandleTypeDef* hcan,
-                                           uint16_t filter_bank, uint16_t filter_id,
-                                           uint16_t filter_mask )
+                                           uint16_t filter_bank, uint32_t filter_id,
+                                           uint32_t filter_mask, bool filter_extended )
 {
     // Either CAN_FILTERMODE_IDMASK, or CAN_FILTERMODE_IDLIST
     // CAN_FILTERMODE_IDMASK accepts a range of ID's based on the filter ID and the mask
@@ -713,19 +1084,24 @@ HAL_StatusTypeDef HW_CAN_Apply_Filter_HAL( CAN_FilterTypeDef* filter, CAN_Handle
     // Use one 32-bit filter entry per filter bank.
     ( *filter ).FilterScale = CAN_FILTERSCALE_32BIT;
 
-    if ( filter_id > CAN_STANDARD_ID_MAX || filter_mask > CAN_STANDARD_ID_MAX )
+    uint32_t id_max = filter_extended ? CAN_EXTENDED_ID_MAX : CAN_STANDARD_ID_MAX;
+    if ( filter_id > id_max || filter_mask > id_max )
     {
         return HAL_ERROR;
     }
 
-    // Standard CAN ID's are 11 bits long and only use the High bits 15-5
-    ( *filter ).FilterIdHigh     = filter_id << 5;    // the upper 16 bits of the filter ID value
-    ( *filter ).FilterIdLow      = 0U;                // standard data frame: IDE = 0, RTR = 0
-    ( *filter ).FilterMaskIdHigh = filter_mask << 5;  // the upper 16 bits of the filter mask value
-    ( *filter ).FilterMaskIdLow  = CAN_RI0R_IDE | CAN_RI0R_RTR;
+    // The 32-bit filter registers mirror RIR, so IDs use the same shift as the RX mailbox.
+    // IDE is always compared so a standard filter never matches extended frames and vice versa.
+    uint32_t id_register   = HW_CAN_Single_Filter_Id( filter_id, filter_extended );
+    uint32_t mask_register = HW_CAN_Single_Filter_Mask( filter_mask, filter_extended );
 
-    ( *filter ).SlaveStartFilterBank =
-        14;  // divides the two filter banks (CAN1 & CAN2) 0----------------13 |14----------------27
+    ( *filter ).FilterIdHigh     = id_register >> 16;      // the upper 16 bits of the filter ID
+    ( *filter ).FilterIdLow      = id_register & 0xFFFFU;  // the lower 16 bits, data frame: RTR = 0
+    ( *filter ).FilterMaskIdHigh = mask_register >> 16;    // the upper 16 bits of the filter mask
+    ( *filter ).FilterMaskIdLow  = mask_register & 0xFFFFU;
+
+    // divides the two filter banks (CAN1 & CAN2) 0----------------13 |14----------------27
+    ( *filter ).SlaveStartFilterBank = HW_CAN_FILTER_FIXED_CAN2_FIRST_BANK;
 
     if ( hcan->Instance == CAN1 )
     {
@@ -782,7 +1158,7 @@ HAL_StatusTypeDef HW_CAN_Apply_Filter_HAL( CAN_FilterTypeDef* filter, CAN_Handle
  *
  */
 int HW_CAN_Configure( CAN_HandleTypeDef* hcan, uint32_t bitrate, uint16_t filter_bank,
-                      uint16_t filter_id, uint16_t filter_mask )
+                      uint32_t filter_id, uint32_t filter_mask, bool filter_extended )
 {
     CAN_FilterTypeDef filter    = { 0 };
     CanProperties_T   can_props = HW_CAN_Compute_Properties( bitrate, TOTAL_TQ, MBPS_SAMPLE_POINT );
@@ -790,7 +1166,9 @@ int HW_CAN_Configure( CAN_HandleTypeDef* hcan, uint32_t bitrate, uint16_t filter
     {
         return 1;
     }
-    if ( HW_CAN_Apply_Filter_HAL( &filter, hcan, filter_bank, filter_id, filter_mask ) != HAL_OK )
+    if ( HW_CAN_Apply_Filter_HAL( &filter, hcan, filter_bank, filter_id, filter_mask,
+                                  filter_extended )
+         != HAL_OK )
     {
         return 2;
     }
@@ -885,15 +1263,32 @@ CanProperties_T HW_CAN_Compute_Properties( uint32_t bitrate, uint32_t total_TQ,
  *          FIFO assignment for accepted frames
  *
  */
-int HW_CAN_Configure1( uint32_t bitrate, uint16_t filter_bank, uint16_t filter_id,
-                       uint16_t filter_mask )
+int HW_CAN_Configure1( uint32_t bitrate, uint16_t filter_bank, uint32_t filter_id,
+                       uint32_t filter_mask, bool filter_extended )
 {
     // __HAL_RCC_CAN1_FORCE_RESET();
     // __HAL_RCC_CAN1_RELEASE_RESET();
     __HAL_RCC_CAN1_CLK_ENABLE();
-    int result = HW_CAN_Configure( &hcan1, bitrate, filter_bank, filter_id, filter_mask );
+    /* Banks a filter set programmed, or its split, must be rewritten around the new filter */
+    bool repack = can_filter_plan1.bank_count > 0U || can_filter_plan2.bank_count > 0U;
+    ( void )HW_CAN_Filter_Set_Rules( &can_filter_plan1, NULL, 0U );
+    can_filter_single1.active = false;
+    int result = HW_CAN_Configure( &hcan1, bitrate, filter_bank, filter_id, filter_mask,
+                                   filter_extended );
+    if ( result == 0 )
+    {
+        result = HW_CAN_Keep_Single_Filter( &can_filter_single1, filter_bank, filter_id,
+                                            filter_mask, filter_extended, repack );
+    }
+    HW_TIMER_Start_Cycle_Counter();
+    HW_CAN_Time_Reset( &can_time1.base, result == 0 ? bitrate : 0U );
     if ( result == 0 )
     {
+        /* FIFO1 shares the RX ring with FIFO0, so its vector must not preempt FIFO0's */
+        NVIC_SetPriority( CAN1_RX1_IRQn, NVIC_GetPriority( CAN1_RX0_IRQn ) );
+        /* The error vector shares the channel statistics with the TX and RX vectors */
+        NVIC_SetPriority( CAN1_SCE_IRQn, NVIC_GetPriority( CAN1_RX0_IRQn ) );
+        NVIC_EnableIRQ( CAN1_RX1_IRQn );
         NVIC_EnableIRQ( CAN1_SCE_IRQn );
     }
     HW_CAN_Reset1();
@@ -926,49 +1321,261 @@ int HW_CAN_Configure1( uint32_t bitrate, uint16_t filter_bank, uint16_t filter_i
  *          FIFO assignment for accepted frames
  *
  */
-int HW_CAN_Configure2( uint32_t bitrate, uint16_t filter_bank, uint16_t filter_id,
-                       uint16_t filter_mask )
+int HW_CAN_Configure2( uint32_t bitrate, uint16_t filter_bank, uint32_t filter_id,
+                       uint32_t filter_mask, bool filter_extended )
 {
     // __HAL_RCC_CAN2_FORCE_RESET();
     // __HAL_RCC_CAN2_RELEASE_RESET();
     __HAL_RCC_CAN2_CLK_ENABLE();
-    int result = HW_CAN_Configure( &hcan2, bitrate, filter_bank, filter_id, filter_mask );
+    /* Banks a filter set programmed, or its split, must be rewritten around the new filter */
+    bool repack = can_filter_plan1.bank_count > 0U || can_filter_plan2.bank_count > 0U;
+    ( void )HW_CAN_Filter_Set_Rules( &can_filter_plan2, NULL, 0U );
+    can_filter_single2.active = false;
+    int result = HW_CAN_Configure( &hcan2, bitrate, filter_bank, filter_id, filter_mask,
+                                   filter_extended );
     if ( result == 0 )
     {
+        result = HW_CAN_Keep_Single_Filter( &can_filter_single2, filter_bank, filter_id,
+                                            filter_mask, filter_extended, repack );
+    }
+    HW_TIMER_Start_Cycle_Counter();
+    HW_CAN_Time_Reset( &can_time2.base, result == 0 ? bitrate : 0U );
+    if ( result == 0 )
+    {
+        /* FIFO1 shares the RX ring with FIFO0, so its vector must not preempt FIFO0's */
+        NVIC_SetPriority( CAN2_RX1_IRQn, NVIC_GetPriority( CAN2_RX0_IRQn ) );
+        /* The error vector shares the channel statistics with the TX and RX vectors */
+        NVIC_SetPriority( CAN2_SCE_IRQn, NVIC_GetPriority( CAN2_RX0_IRQn ) );
+        NVIC_EnableIRQ( CAN2_RX1_IRQn );
         NVIC_EnableIRQ( CAN2_SCE_IRQn );
     }
     HW_CAN_Reset2();
     return result;
 }
 
+/** Install the channel 1 filter set and reprogram all shared filter banks. */
+HW_CAN_Result_T HW_CAN_Set_Filters1( const HW_CAN_Filter_Rule_T rules[], uint16_t rule_count )
+{
+    return HW_CAN_Set_Filters( &can_filter_plan1, &can_filter_single1, rules, rule_count );
+}
+
+/** Install the channel 2 filter set and reprogram all shared filter banks. */
+HW_CAN_Result_T HW_CAN_Set_Filters2( const HW_CAN_Filter_Rule_T rules[], uint16_t rule_count )
+{
+    return HW_CAN_Set_Filters( &can_filter_plan2, &can_filter_single2, rules, rule_count );
+}
+
+void HW_CAN_Get_Filter_Report1( HW_CAN_Filter_Report_T* report )
+{
+    HW_CAN_Get_Filter_Report( &can_filter_plan1, 0U, report );
+}
+
+void HW_CAN_Get_Filter_Report2( HW_CAN_Filter_Report_T* report )
+{
+    HW_CAN_Get_Filter_Report( &can_filter_plan2, can_filter_can2_first_bank, report );
+}
+
 /** Reset channel 1 software state while its CAN interrupts are masked. */
 void HW_CAN_Reset1( void )
 {
-    HW_CAN_Reset_Channel( CAN1, CAN1_TX_IRQn, CAN1_RX0_IRQn, CAN1_SCE_IRQn, &can_tx_wp1,
-                          &can_tx_rp1, &can_rx_wp1, &can_rx_rp1, &can_tx_active1, &can_sent_flag1,
-                          &can_rx_dropped_count1, &can_tx_pending_mailbox1, &can_tx_status1 );
+    HW_CAN_Reset_Channel( CAN1, CAN1_TX_IRQn, CAN1_RX0_IRQn, CAN1_RX1_IRQn, CAN1_SCE_IRQn,
+                          &can_tx_wp1, &can_tx_rp1, &can_rx_wp1, &can_rx_rp1, &can_tx_active1,
+                          &can_sent_flag1, &can_rx_dropped_count1, &can_tx_pending_mailbox1,
+                          &can_tx_status1, &can_cyclic1 );
 }
 
 /** Reset channel 2 software state while its CAN interrupts are masked. */
 void HW_CAN_Reset2( void )
 {
-    HW_CAN_Reset_Channel( CAN2, CAN2_TX_IRQn, CAN2_RX0_IRQn, CAN2_SCE_IRQn, &can_tx_wp2,
-                          &can_tx_rp2, &can_rx_wp2, &can_rx_rp2, &can_tx_active2, &can_sent_flag2,
-                          &can_rx_dropped_count2, &can_tx_pending_mailbox2, &can_tx_status2 );
+    HW_CAN_Reset_Channel( CAN2, CAN2_TX_IRQn, CAN2_RX0_IRQn, CAN2_RX1_IRQn, CAN2_SCE_IRQn,
+                          &can_tx_wp2, &can_tx_rp2, &can_rx_wp2, &can_rx_rp2, &can_tx_active2,
+                          &can_sent_flag2, &can_rx_dropped_count2, &can_tx_pending_mailbox2,
+                          &can_tx_status2, &can_cyclic2 );
 }
 
 HW_CAN_Result_T HW_CAN_Recover1( void )
 {
-    return HW_CAN_Recover( &hcan1, CAN1_TX_IRQn, CAN1_RX0_IRQn, CAN1_SCE_IRQn, &can_tx_wp1,
-                           &can_tx_rp1, &can_tx_active1, &can_sent_flag1, &can_tx_pending_mailbox1,
-                           &can_tx_status1 );
+    return HW_CAN_Recover( &hcan1, CAN1_TX_IRQn, CAN1_RX0_IRQn, CAN1_RX1_IRQn, CAN1_SCE_IRQn,
+                           &can_tx_wp1, &can_tx_rp1, &can_tx_active1, &can_sent_flag1,
+                           &can_tx_pending_mailbox1, &can_tx_status1, &can_cyclic1 );
 }
 
 HW_CAN_Result_T HW_CAN_Recover2( void )
 {
-    return HW_CAN_Recover( &hcan2, CAN2_TX_IRQn, CAN2_RX0_IRQn, CAN2_SCE_IRQn, &can_tx_wp2,
-                           &can_tx_rp2, &can_tx_active2, &can_sent_flag2, &can_tx_pending_mailbox2,
-                           &can_tx_status2 );
+    return HW_CAN_Recover( &hcan2, CAN2_TX_IRQn, CAN2_RX0_IRQn, CAN2_RX1_IRQn, CAN2_SCE_IRQn,
+                           &can_tx_wp2, &can_tx_rp2, &can_tx_active2, &can_sent_flag2,
+                           &can_tx_pending_mailbox2, &can_tx_status2, &can_cyclic2 );
+}
+
+HW_CAN_Result_T HW_CAN_Cyclic_Start1( const HW_CAN_Cyclic_Entry_T table[], uint16_t count )
+{
+    return HW_CAN_Cyclic_Start( &hcan1, CAN1_TX_IRQn, &can_cyclic1, table, count );
+}
+
+HW_CAN_Result_T HW_CAN_Cyclic_Start2( const HW_CAN_Cyclic_Entry_T table[], uint16_t count )
+{
+    return HW_CAN_Cyclic_Start( &hcan2, CAN2_TX_IRQn, &can_cyclic2, table, count );
+}
+
+void HW_CAN_Cyclic_Stop1( void )
+{
+    HW_CAN_Cyclic_Stop( CAN1_TX_IRQn, &can_cyclic1 );
+}
+
+void HW_CAN_Cyclic_Stop2( void )
+{
+    HW_CAN_Cyclic_Stop( CAN2_TX_IRQn, &can_cyclic2 );
+}
+
+HW_CAN_Result_T HW_CAN_Cyclic_Update_Payload1( uint16_t index, const uint8_t data[], uint8_t dlc )
+{
+    return HW_CAN_Cyclic_Update_Payload( &can_cyclic1.schedule, index, data, dlc )
+               ? HW_CAN_RESULT_OK
+               : HW_CAN_RESULT_ERROR;
+}
+
+HW_CAN_Result_T HW_CAN_Cyclic_Update_Payload2( uint16_t index, const uint8_t data[], uint8_t dlc )
+{
+    return HW_CAN_Cyclic_Update_Payload( &can_cyclic2.schedule, index, data, dlc )
+               ? HW_CAN_RESULT_OK
+               : HW_CAN_RESULT_ERROR;
+}
+
+HW_CAN_Result_T HW_CAN_Cyclic_Get_Stats1( uint16_t index, HW_CAN_Cyclic_Stats_T* stats )
+{
+    return HW_CAN_Cyclic_Copy_Stats( CAN1_TX_IRQn, &can_cyclic1, index, stats );
+}
+
+HW_CAN_Result_T HW_CAN_Cyclic_Get_Stats2( uint16_t index, HW_CAN_Cyclic_Stats_T* stats )
+{
+    return HW_CAN_Cyclic_Copy_Stats( CAN2_TX_IRQn, &can_cyclic2, index, stats );
+}
+
+HW_CAN_Result_T HW_CAN_Responder_Start1( const HW_CAN_Responder_Entry_T table[], uint16_t count )
+{
+    return HW_CAN_Responder_Start( &hcan1, CAN1_TX_IRQn, CAN1_RX0_IRQn, CAN1_RX1_IRQn,
+                                   &can_responder1, table, count );
+}
+
+HW_CAN_Result_T HW_CAN_Responder_Start2( const HW_CAN_Responder_Entry_T table[], uint16_t count )
+{
+    return HW_CAN_Responder_Start( &hcan2, CAN2_TX_IRQn, CAN2_RX0_IRQn, CAN2_RX1_IRQn,
+                                   &can_responder2, table, count );
+}
+
+void HW_CAN_Responder_Stop1( void )
+{
+    HW_CAN_Responder_Stop( CAN1_TX_IRQn, CAN1_RX0_IRQn, CAN1_RX1_IRQn, &can_responder1 );
+}
+
+void HW_CAN_Responder_Stop2( void )
+{
+    HW_CAN_Responder_Stop( CAN2_TX_IRQn, CAN2_RX0_IRQn, CAN2_RX1_IRQn, &can_responder2 );
+}
+
+HW_CAN_Result_T HW_CAN_Responder_Get_Stats1( HW_CAN_Responder_Stats_T* stats )
+{
+    return HW_CAN_Responder_Copy_Stats( CAN1_TX_IRQn, CAN1_RX0_IRQn, CAN1_RX1_IRQn,
+                                        &can_responder1, stats );
+}
+
+HW_CAN_Result_T HW_CAN_Responder_Get_Stats2( HW_CAN_Responder_Stats_T* stats )
+{
+    return HW_CAN_Responder_Copy_Stats( CAN2_TX_IRQn, CAN2_RX0_IRQn, CAN2_RX1_IRQn,
+                                        &can_responder2, stats );
+}
+
+HW_CAN_Result_T HW_CAN_Replay_Start1( const uint8_t log[], uint32_t length, uint32_t time_scale,
+                                      uint32_t passes )
+{
+    return HW_CAN_Replay_Start( &hcan1, CAN1_TX_IRQn, &can_replay1, &can_cyclic1, log, length,
+                                time_scale, passes );
+}
+
+HW_CAN_Result_T HW_CAN_Replay_Start2( const uint8_t log[], uint32_t length, uint32_t time_scale,
+                                      uint32_t passes )
+{
+    return HW_CAN_Replay_Start( &hcan2, CAN2_TX_IRQn, &can_replay2, &can_cyclic2, log, length,
+                                time_scale, passes );
+}
+
+void HW_CAN_Replay_Stop1( void )
+{
+    HW_CAN_Replay_Stop( CAN1_TX_IRQn, &can_replay1 );
+}
+
+void HW_CAN_Replay_Stop2( void )
+{
+    HW_CAN_Replay_Stop( CAN2_TX_IRQn, &can_replay2 );
+}
+
+HW_CAN_Result_T HW_CAN_Replay_Get_Stats1( HW_CAN_Replay_Stats_T* stats )
+{
+    return HW_CAN_Replay_Copy_Stats( CAN1_TX_IRQn, &can_replay1, stats );
+}
+
+HW_CAN_Result_T HW_CAN_Replay_Get_Stats2( HW_CAN_Replay_Stats_T* stats )
+{
+    return HW_CAN_Replay_Copy_Stats( CAN2_TX_IRQn, &can_replay2, stats );
+}
+
+HW_CAN_Result_T HW_CAN_Bus_Get_Stats1( HW_CAN_Bus_Stats_T* stats )
+{
+    return HW_CAN_Bus_Copy_Stats( CAN1, CAN1_TX_IRQn, CAN1_RX0_IRQn, CAN1_RX1_IRQn, CAN1_SCE_IRQn,
+                                  stats );
+}
+
+HW_CAN_Result_T HW_CAN_Bus_Get_Stats2( HW_CAN_Bus_Stats_T* stats )
+{
+    return HW_CAN_Bus_Copy_Stats( CAN2, CAN2_TX_IRQn, CAN2_RX0_IRQn, CAN2_RX1_IRQn, CAN2_SCE_IRQn,
+                                  stats );
+}
+
+void HW_CAN_Bus_Reset_Stats1( void )
+{
+    HW_CAN_Bus_Reset_Stats( CAN1, CAN1_TX_IRQn, CAN1_RX0_IRQn, CAN1_RX1_IRQn, CAN1_SCE_IRQn );
+}
+
+void HW_CAN_Bus_Reset_Stats2( void )
+{
+    HW_CAN_Bus_Reset_Stats( CAN2, CAN2_TX_IRQn, CAN2_RX0_IRQn, CAN2_RX1_IRQn, CAN2_SCE_IRQn );
+}
+
+/**
+ * @brief  Releases due cyclic frames on both channels and refills idle mailboxes.
+ *
+ * @note   Runs at the CAN TX vectors' priority, so it never preempts a TX
+ *         completion while both touch a schedule.
+ */
+void HW_CAN_Cyclic_Tick_From_ISR( void )
+{
+    uint32_t now = HW_TIMER_Get_Time_Us();
+
+    if ( can_cyclic1.running )
+    {
+        HW_CAN_Cyclic_Tick( &can_cyclic1.schedule, now );
+        HW_CAN_Cyclic_Load_Mailbox( &hcan1, &can_cyclic1 );
+    }
+    if ( can_cyclic2.running )
+    {
+        HW_CAN_Cyclic_Tick( &can_cyclic2.schedule, now );
+        HW_CAN_Cyclic_Load_Mailbox( &hcan2, &can_cyclic2 );
+    }
+}
+
+/**
+ * @brief  Loads due replay frames on both channels and re-arms the replay timer.
+ *
+ * @note   Runs at the CAN TX vectors' priority, so it never preempts a TX
+ *         completion while both touch a replay.
+ */
+void HW_CAN_Replay_Tick_From_ISR( void )
+{
+    uint32_t now = HW_TIMER_Get_Time_Us();
+
+    ( void )HW_CAN_Replay_Service( &hcan1, &can_replay1, now );
+    ( void )HW_CAN_Replay_Service( &hcan2, &can_replay2, now );
+    HW_CAN_Replay_Arm_Timer( now );
 }
 
 /**-----------------------------------------------------------------------------
@@ -1022,6 +1629,18 @@ uint32_t HW_CAN_Rx_Dropped_Count2( void )
     return can_rx_dropped_count2;
 }
 
+/** Copy channel 1's last batch frame start of frame. */
+bool HW_CAN_Tx_Timestamp1( uint32_t* timestamp_us )
+{
+    return HW_CAN_Copy_Tx_Timestamp( CAN1_TX_IRQn, &can_time1, timestamp_us );
+}
+
+/** Copy channel 2's last batch frame start of frame. */
+bool HW_CAN_Tx_Timestamp2( uint32_t* timestamp_us )
+{
+    return HW_CAN_Copy_Tx_Timestamp( CAN2_TX_IRQn, &can_time2, timestamp_us );
+}
+
 /**
  * @brief transmits the txData (8 bytes) over CAN channel 1
  *
@@ -1029,7 +1648,7 @@ uint32_t HW_CAN_Rx_Dropped_Count2( void )
  *
  * Writes the bxCAN mailbox registers directly.
  */
-HW_CAN_Result_T HW_CAN_Transmit1( uint8_t* txData, uint16_t id, uint8_t dlc )
+HW_CAN_Result_T HW_CAN_Transmit1( uint8_t* txData, uint32_t id, bool extended, uint8_t dlc )
 {
     if ( dlc > 0U && txData == NULL )
     {
@@ -1043,7 +1662,8 @@ HW_CAN_Result_T HW_CAN_Transmit1( uint8_t* txData, uint16_t id, uint8_t dlc )
     {
         return HW_CAN_RESULT_ERROR;
     }
-    return HW_CAN_Transmit_To_Mailbox( &hcan1, txData, id, dlc, NULL );
+    return HW_CAN_Transmit_To_Mailbox( &hcan1, txData, id, extended, dlc,
+                                       HW_CAN_Batch_Mailboxes( CAN1, &can_cyclic1 ), NULL );
 }
 
 /**
@@ -1065,7 +1685,7 @@ int HW_CAN_Receive1( CAN_Packet_T* rxPacket )
  *
  * Writes the bxCAN mailbox registers directly.
  */
-HW_CAN_Result_T HW_CAN_Transmit2( uint8_t* txData, uint16_t id, uint8_t dlc )
+HW_CAN_Result_T HW_CAN_Transmit2( uint8_t* txData, uint32_t id, bool extended, uint8_t dlc )
 {
     if ( dlc > 0U && txData == NULL )
     {
@@ -1079,7 +1699,8 @@ HW_CAN_Result_T HW_CAN_Transmit2( uint8_t* txData, uint16_t id, uint8_t dlc )
     {
         return HW_CAN_RESULT_ERROR;
     }
-    return HW_CAN_Transmit_To_Mailbox( &hcan2, txData, id, dlc, NULL );
+    return HW_CAN_Transmit_To_Mailbox( &hcan2, txData, id, extended, dlc,
+                                       HW_CAN_Batch_Mailboxes( CAN2, &can_cyclic2 ), NULL );
 }
 
 /**
@@ -1144,7 +1765,7 @@ uint8_t can_rx_buffer1[X][CAN_PACKET_SIZE];
  */
 uint16_t HW_CAN_Rx_Buffer_Write1( CAN_Packet_T source[], uint16_t length )
 {
-    return HW_CAN_Buffer_Write( can_rx_buffer1, &can_rx_wp1, &can_rx_rp1, RECEIVE_BUFFER_WIDTH,
+    return HW_CAN_Buffer_Write( can_rx_buffer1, &can_rx_wp1, &can_rx_rp1, RECEIVE_BUFFER_WIDTH1,
                                 source, length );
 }
 
@@ -1198,7 +1819,7 @@ uint8_t can_rx_buffer1[X][CAN_PACKET_SIZE];
  */
 uint16_t HW_CAN_Rx_Buffer_Write2( CAN_Packet_T source[], uint16_t length )
 {
-    return HW_CAN_Buffer_Write( can_rx_buffer2, &can_rx_wp2, &can_rx_rp2, RECEIVE_BUFFER_WIDTH,
+    return HW_CAN_Buffer_Write( can_rx_buffer2, &can_rx_wp2, &can_rx_rp2, RECEIVE_BUFFER_WIDTH2,
                                 source, length );
 }
 
@@ -1212,7 +1833,7 @@ uint16_t HW_CAN_Rx_Buffer_Write2( CAN_Packet_T source[], uint16_t length )
 uint16_t HW_CAN_Rx_Buffer_Read1( CAN_Packet_T dest[], uint16_t capacity )
 {
     uint16_t count = HW_CAN_Buffer_Read( can_rx_buffer1, &can_rx_wp1, &can_rx_rp1,
-                                         RECEIVE_BUFFER_WIDTH, dest, capacity );
+                                         RECEIVE_BUFFER_WIDTH1, dest, capacity );
     HW_CAN_Rx_Buffer_consume1( count );
     return count;
 }
@@ -1225,7 +1846,7 @@ uint16_t HW_CAN_Rx_Buffer_Read1( CAN_Packet_T dest[], uint16_t capacity )
  */
 void HW_CAN_Rx_Buffer_consume1( uint16_t update )
 {
-    HW_CAN_Buffer_consume( &can_rx_rp1, update, RECEIVE_BUFFER_WIDTH );
+    HW_CAN_Buffer_consume( &can_rx_rp1, update, RECEIVE_BUFFER_WIDTH1 );
 }
 
 /**
@@ -1238,7 +1859,7 @@ void HW_CAN_Rx_Buffer_consume1( uint16_t update )
 uint16_t HW_CAN_Rx_Buffer_Read2( CAN_Packet_T dest[], uint16_t capacity )
 {
     uint16_t count = HW_CAN_Buffer_Read( can_rx_buffer2, &can_rx_wp2, &can_rx_rp2,
-                                         RECEIVE_BUFFER_WIDTH, dest, capacity );
+                                         RECEIVE_BUFFER_WIDTH2, dest, capacity );
     HW_CAN_Rx_Buffer_consume2( count );
     return count;
 }
@@ -1251,7 +1872,7 @@ uint16_t HW_CAN_Rx_Buffer_Read2( CAN_Packet_T dest[], uint16_t capacity )
  */
 void HW_CAN_Rx_Buffer_consume2( uint16_t update )
 {
-    HW_CAN_Buffer_consume( &can_rx_rp2, update, RECEIVE_BUFFER_WIDTH );
+    HW_CAN_Buffer_consume( &can_rx_rp2, update, RECEIVE_BUFFER_WIDTH2 );
 }
 
 /**
@@ -1283,14 +1904,14 @@ uint16_t HW_CAN_Tx_Buffer_Read2( CAN_Packet_T dest[] )
 /** Remove one packet from the channel 1 receive buffer. */
 uint16_t HW_CAN_Rx_Buffer_Pop1( CAN_Packet_T* dest )
 {
-    return HW_CAN_Buffer_Pop( can_rx_buffer1, &can_rx_wp1, &can_rx_rp1, RECEIVE_BUFFER_WIDTH,
+    return HW_CAN_Buffer_Pop( can_rx_buffer1, &can_rx_wp1, &can_rx_rp1, RECEIVE_BUFFER_WIDTH1,
                               dest );
 }
 
 /** Remove one packet from the channel 2 receive buffer. */
 uint16_t HW_CAN_Rx_Buffer_Pop2( CAN_Packet_T* dest )
 {
-    return HW_CAN_Buffer_Pop( can_rx_buffer2, &can_rx_wp2, &can_rx_rp2, RECEIVE_BUFFER_WIDTH,
+    return HW_CAN_Buffer_Pop( can_rx_buffer2, &can_rx_wp2, &can_rx_rp2, RECEIVE_BUFFER_WIDTH2,
                               dest );
 }
 
@@ -1304,7 +1925,7 @@ HW_CAN_Result_T HW_CAN_Tx_Trigger1( void )
 {
     return HW_CAN_Tx_Trigger( &hcan1, can_tx_buffer1, &can_tx_wp1, &can_tx_rp1,
                               TRANSMIT_BUFFER_WIDTH, &can_tx_active1, &can_sent_flag1,
-                              &can_tx_pending_mailbox1, &can_tx_status1 );
+                              &can_tx_pending_mailbox1, &can_tx_status1, &can_cyclic1 );
 }
 
 /**
@@ -1317,7 +1938,7 @@ HW_CAN_Result_T HW_CAN_Tx_Trigger2( void )
 {
     return HW_CAN_Tx_Trigger( &hcan2, can_tx_buffer2, &can_tx_wp2, &can_tx_rp2,
                               TRANSMIT_BUFFER_WIDTH, &can_tx_active2, &can_sent_flag2,
-                              &can_tx_pending_mailbox2, &can_tx_status2 );
+                              &can_tx_pending_mailbox2, &can_tx_status2, &can_cyclic2 );
 }
 
 /**
@@ -1330,7 +1951,8 @@ HW_CAN_Result_T HW_CAN_Tx_Trigger2( void )
 void HW_CAN_CH1_TX_IRQ_HANDLER( void )
 {
     HW_CAN_Tx_IRQ( &hcan1, can_tx_buffer1, &can_tx_wp1, &can_tx_rp1, TRANSMIT_BUFFER_WIDTH,
-                   &can_tx_active1, &can_sent_flag1, &can_tx_pending_mailbox1, &can_tx_status1 );
+                   &can_tx_active1, &can_sent_flag1, &can_tx_pending_mailbox1, &can_tx_status1,
+                   &can_cyclic1 );
 }
 
 /**
@@ -1340,9 +1962,22 @@ void HW_CAN_CH1_TX_IRQ_HANDLER( void )
  * @note   This handler must remain minimal and deterministic. No blocking or
  *         heavy processing should be introduced here.
  */
-void HW_CAN_CH1_RX_IRQ_HANDLER( void )
+void HW_CAN_CH1_RX0_IRQ_HANDLER( void )
+{
+    HW_CAN_Rx_IRQ( &hcan1, 0U, can_rx_buffer1, &can_rx_wp1, &can_rx_rp1, RECEIVE_BUFFER_WIDTH1,
+                   &can_rx_dropped_count1, &can_filter_plan1 );
+}
+
+/**
+ * @brief  Drains CAN1 FIFO1 into the same RX ring as FIFO0.
+ *
+ * @note   Runs at the FIFO0 vector's priority, so the two never preempt each
+ *         other while writing the ring.
+ */
+void HW_CAN_CH1_RX1_IRQ_HANDLER( void )
 {
-    HW_CAN_Rx_IRQ( &hcan1, can_rx_buffer1, &can_rx_wp1, &can_rx_rp1, &can_rx_dropped_count1 );
+    HW_CAN_Rx_IRQ( &hcan1, 1U, can_rx_buffer1, &can_rx_wp1, &can_rx_rp1, RECEIVE_BUFFER_WIDTH1,
+                   &can_rx_dropped_count1, &can_filter_plan1 );
 }
 
 /**
@@ -1355,7 +1990,8 @@ void HW_CAN_CH1_RX_IRQ_HANDLER( void )
 void HW_CAN_CH2_TX_IRQ_HANDLER( void )
 {
     HW_CAN_Tx_IRQ( &hcan2, can_tx_buffer2, &can_tx_wp2, &can_tx_rp2, TRANSMIT_BUFFER_WIDTH,
-                   &can_tx_active2, &can_sent_flag2, &can_tx_pending_mailbox2, &can_tx_status2 );
+                   &can_tx_active2, &can_sent_flag2, &can_tx_pending_mailbox2, &can_tx_status2,
+                   &can_cyclic2 );
 }
 
 /**
@@ -1365,9 +2001,22 @@ void HW_CAN_CH2_TX_IRQ_HANDLER( void )
  * @note   This handler must remain minimal and deterministic. No blocking or
  *         heavy processing should be introduced here.
  */
-void HW_CAN_CH2_RX_IRQ_HANDLER( void )
+void HW_CAN_CH2_RX0_IRQ_HANDLER( void )
+{
+    HW_CAN_Rx_IRQ( &hcan2, 0U, can_rx_buffer2, &can_rx_wp2, &can_rx_rp2, RECEIVE_BUFFER_WIDTH2,
+                   &can_rx_dropped_count2, &can_filter_plan2 );
+}
+
+/**
+ * @brief  Drains CAN2 FIFO1 into the same RX ring as FIFO0.
+ *
+ * @note   Runs at the FIFO0 vector's priority, so the two never preempt each
+ *         other while writing the ring.
+ */
+void HW_CAN_CH2_RX1_IRQ_HANDLER( void )
 {
-    HW_CAN_Rx_IRQ( &hcan2, can_rx_buffer2, &can_rx_wp2, &can_rx_rp2, &can_rx_dropped_count2 );
+    HW_CAN_Rx_IRQ( &hcan2, 1U, can_rx_buffer2, &can_rx_wp2, &can_rx_rp2, RECEIVE_BUFFER_WIDTH2,
+                   &can_rx_dropped_count2, &can_filter_plan2 );
 }
 
 /** Direct CAN1 status/error interrupt vector. */
@@ -1384,12 +2033,23 @@ void HW_CAN_CH2_ERROR_IRQ_HANDLER( void )
                       &can_tx_status2 );
 }
 
-/** Directly service bxCAN transmit completion flags for one channel. */
+/**
+ * Directly service bxCAN transmit completion flags for one channel.
+ *
+ * While the cyclic schedule owns mailbox 2 its completions are reported to the
+ * schedule with their start-of-frame timestamp, and the next released frame is
+ * loaded; they never count towards a batch. A response in flight in mailbox 0
+ * is reported to the auto-responder the same way, as is a replayed frame in
+ * mailbox 2, after which the next due frame of the replay is loaded. Every
+ * acknowledged frame's timestamp feeds the channel's time base.
+ */
 static void HW_CAN_Tx_IRQ( CAN_HandleTypeDef* hcan, CAN_Packet_T buffer[], volatile uint16_t* w_p,
                            volatile uint16_t* r_p, uint16_t buffer_width, volatile bool* active,
                            volatile bool* completed, volatile uint32_t* pending_mailbox,
-                           volatile HW_CAN_Tx_Status_T* status )
+                           volatile HW_CAN_Tx_Status_T* status, HW_CAN_Cyclic_Channel_T* cyclic )
 {
+    uint32_t now = HW_TIMER_Get_Time_Us();
+
     static const uint32_t request_complete_flags[3] = {
         CAN_TSR_RQCP0,
         CAN_TSR_RQCP1,
@@ -1411,11 +2071,21 @@ static void HW_CAN_Tx_IRQ( CAN_HandleTypeDef* hcan, CAN_Packet_T buffer[], volat
         CAN_TSR_TERR2,
     };
 
-    CAN_TypeDef* can                        = hcan->Instance;
-    uint32_t     tsr                        = can->TSR;
-    bool         batch_completion_seen      = false;
-    bool         batch_completion_succeeded = false;
-    bool         waiting_for_mailbox        = *active && *pending_mailbox == 0U;
+    CAN_TypeDef*                can                        = hcan->Instance;
+    HW_CAN_Time_Channel_T*      time                       = HW_CAN_Time_Channel( can );
+    HW_CAN_Responder_Channel_T* responder                  = HW_CAN_Responder_Channel( can );
+    HW_CAN_Replay_Channel_T*    replay                     = HW_CAN_Replay_Channel( can );
+    uint32_t                    tsr                        = can->TSR;
+    bool                        batch_completion_seen      = false;
+    bool                        batch_completion_succeeded = false;
+    bool                        waiting_for_mailbox        = *active && *pending_mailbox == 0U;
+    bool                        cyclic_owns_mailbox        = cyclic->mailbox_reserved;
+    bool                        cyclic_completion_seen     = false;
+    bool                        cyclic_completion_sent     = false;
+    uint32_t                    cyclic_completion_time     = now;
+    // A batch frame left in mailbox 0 from before the responder started is still the batch's
+    bool responder_in_flight = responder->responder.in_flight != HW_CAN_RESPONDER_NONE;
+    bool replay_in_flight    = replay->replay.in_flight;
 
     for ( uint8_t mailbox = 0U; mailbox < 3U; mailbox++ )
     {
@@ -1427,24 +2097,82 @@ static void HW_CAN_Tx_IRQ( CAN_HandleTypeDef* hcan, CAN_Packet_T buffer[], volat
 
         uint32_t mailbox_status = success_flags[mailbox] | arbitration_lost_flags[mailbox]
                                   | transmit_error_flags[mailbox];
-        bool belongs_to_batch = ( *pending_mailbox & request_complete ) != 0U;
-        if ( !batch_completion_seen && ( belongs_to_batch || waiting_for_mailbox ) )
+        bool succeeded =
+            ( tsr & success_flags[mailbox] ) != 0U
+            && ( tsr & ( arbitration_lost_flags[mailbox] | transmit_error_flags[mailbox] ) ) == 0U;
+        bool     belongs_to_batch = ( *pending_mailbox & request_complete ) != 0U;
+        uint32_t sent_at = succeeded ? HW_CAN_Tx_Mailbox_Timestamp( can, mailbox, now ) : now;
+        HW_CAN_Stats_Tx_Mailbox( can, mailbox, ( tsr & success_flags[mailbox] ) != 0U,
+                                 ( tsr & arbitration_lost_flags[mailbox] ) != 0U,
+                                 ( tsr & transmit_error_flags[mailbox] ) != 0U, now );
+        if ( cyclic_owns_mailbox && mailbox == HW_CAN_CYCLIC_MAILBOX )
+        {
+            cyclic_completion_seen = true;
+            cyclic_completion_sent = succeeded;
+            cyclic_completion_time = sent_at;
+        }
+        else if ( responder_in_flight && mailbox == HW_CAN_RESPONDER_MAILBOX )
         {
-            batch_completion_seen = true;
-            batch_completion_succeeded =
-                ( tsr & success_flags[mailbox] ) != 0U
-                && ( tsr & ( arbitration_lost_flags[mailbox] | transmit_error_flags[mailbox] ) )
-                       == 0U;
+            HW_CAN_Responder_Complete( &responder->responder, sent_at, succeeded );
+        }
+        else if ( replay_in_flight && mailbox == HW_CAN_REPLAY_MAILBOX )
+        {
+            HW_CAN_Replay_Complete( &replay->replay, sent_at, succeeded );
+        }
+        else if ( !batch_completion_seen && ( belongs_to_batch || waiting_for_mailbox ) )
+        {
+            batch_completion_seen      = true;
+            batch_completion_succeeded = succeeded;
+            if ( succeeded )
+            {
+                time->last_tx_us    = sent_at;
+                time->last_tx_valid = true;
+            }
         }
 
         HW_CAN_Clear_Tx_Request_Complete( can, request_complete, mailbox_status );
     }
 
-    if ( !*active )
+    if ( cyclic_completion_seen )
     {
-        CLEAR_BIT( can->IER, CAN_IER_TMEIE );
-        return;
-    }
+        HW_CAN_Cyclic_Complete( &cyclic->schedule, cyclic_completion_time, cyclic_completion_sent );
+        if ( cyclic->running )
+        {
+            HW_CAN_Cyclic_Load_Mailbox( hcan, cyclic );
+        }
+        else
+        {
+            // The schedule was stopped while this frame was in flight
+            cyclic->mailbox_reserved = false;
+        }
+    }
+
+    if ( responder->running )
+    {
+        HW_CAN_Responder_Load_Mailbox( hcan, responder );
+    }
+    else if ( responder->responder.in_flight == HW_CAN_RESPONDER_NONE )
+    {
+        responder->mailbox_reserved = false;
+    }
+
+    if ( replay->running )
+    {
+        if ( HW_CAN_Replay_Service( hcan, replay, now ) )
+        {
+            HW_CAN_Replay_Arm_Timer( now );
+        }
+    }
+    else if ( !replay->replay.in_flight )
+    {
+        replay->mailbox_reserved = false;
+    }
+
+    if ( !*active )
+    {
+        HW_CAN_Release_Tx_Interrupt( can, cyclic );
+        return;
+    }
     if ( !batch_completion_seen )
     {
         return;
@@ -1453,7 +2181,7 @@ static void HW_CAN_Tx_IRQ( CAN_HandleTypeDef* hcan, CAN_Packet_T buffer[], volat
     *pending_mailbox = 0U;
     if ( !batch_completion_succeeded )
     {
-        CLEAR_BIT( can->IER, CAN_IER_TMEIE );
+        HW_CAN_Release_Tx_Interrupt( can, cyclic );
         *active    = false;
         *completed = false;
         *status    = HW_CAN_TX_STATUS_ERROR;
@@ -1461,44 +2189,95 @@ static void HW_CAN_Tx_IRQ( CAN_HandleTypeDef* hcan, CAN_Packet_T buffer[], volat
     }
 
     ( void )HW_CAN_Tx_Service( hcan, buffer, w_p, r_p, buffer_width, active, completed,
-                               pending_mailbox, status );
+                               pending_mailbox, status, cyclic );
 }
 
-/** Directly drain at most the hardware FIFO0 depth into one software RX queue. */
-static void HW_CAN_Rx_IRQ( CAN_HandleTypeDef* hcan, CAN_Packet_T buffer[], volatile uint16_t* w_p,
-                           volatile uint16_t* r_p, volatile uint32_t* dropped_count )
-{
-    CAN_TypeDef* can     = hcan->Instance;
-    bool         overrun = ( can->RF0R & CAN_RF0R_FOVR0 ) != 0U;
-
-    for ( uint8_t read_count = 0U; read_count < CAN_RX_FIFO_DEPTH; read_count++ )
-    {
-        if ( ( can->RF0R & CAN_RF0R_FMP0 ) == 0U )
+/**
+ * Drain one hardware receive FIFO into a channel's software RX queue.
+ *
+ * Keeps reading until the FIFO reports empty, so frames that land while the
+ * vector runs are taken in the same entry. Each frame is decoded straight into
+ * the next free ring slot. Frames that only passed a widened filter entry are
+ * dropped here unless they match the channel's filter set. A frame that matches
+ * the running auto-responder has its response queued and, if mailbox 0 is
+ * free, loaded before the frame is stored, so a full ring delays no answer.
+ */
+static void HW_CAN_Rx_IRQ( CAN_HandleTypeDef* hcan, uint8_t fifo, CAN_Packet_T buffer[],
+                           volatile uint16_t* w_p, volatile uint16_t* r_p, uint16_t buffer_width,
+                           volatile uint32_t*          dropped_count,
+                           const HW_CAN_Filter_Plan_T* filter_plan )
+{
+    CAN_TypeDef*                can       = hcan->Instance;
+    HW_CAN_Responder_Channel_T* responder = HW_CAN_Responder_Channel( can );
+    volatile uint32_t*          rfr       = HW_CAN_Rx_FIFO_Status( can, fifo );
+    bool                        overrun   = ( *rfr & CAN_RF0R_FOVR0 ) != 0U;
+    uint16_t                    write     = *w_p;
+    HW_CAN_Stats_Tally_T        received  = { 0U, 0U, 0U };
+    uint32_t                    dropped   = 0U;
+
+    for ( uint8_t read_count = 0U; read_count < CAN_RX_DRAIN_LIMIT; read_count++ )
+    {
+        if ( ( *rfr & CAN_RF0R_FMP0 ) == 0U )
         {
             break;
         }
 
-        CAN_Packet_T packet;
-        if ( HW_CAN_Receive( hcan, &packet ) != 0 )
+        uint16_t      next = ( uint16_t )( ( write + 1U ) % buffer_width );
+        bool          full = next == *r_p;
+        CAN_Packet_T  scratch;
+        CAN_Packet_T* packet = full ? &scratch : &buffer[write];
+
+        if ( HW_CAN_Receive_FIFO( hcan, fifo, packet ) != 0 )
         {
-            break;
+            continue;
+        }
+        HW_CAN_Stats_Tally_Frame( &received, packet->extended, packet->dlc );
+        if ( filter_plan->software_ids > 0U
+             && !HW_CAN_Filter_Accepts( filter_plan, packet->id, packet->extended ) )
+        {
+            continue;
         }
-        if ( HW_CAN_Buffer_Write( buffer, w_p, r_p, RECEIVE_BUFFER_WIDTH, &packet, 1U ) != 0U
-             && *dropped_count != UINT32_MAX )
+        if ( responder->running )
         {
-            ( *dropped_count )++;
+            uint8_t index = HW_CAN_Responder_Match( &responder->responder, packet->id,
+                                                    packet->extended, packet->data, packet->dlc );
+            if ( index != HW_CAN_RESPONDER_NONE
+                 && HW_CAN_Responder_Queue( &responder->responder, index, packet->timestamp_us ) )
+            {
+                HW_CAN_Responder_Load_Mailbox( hcan, responder );
+            }
         }
+        if ( full )
+        {
+            if ( *dropped_count != UINT32_MAX )
+            {
+                ( *dropped_count )++;
+            }
+            dropped++;
+            continue;
+        }
+
+        write = next;
+        *w_p  = write;
     }
 
     if ( overrun && *dropped_count != UINT32_MAX )
     {
         ( *dropped_count )++;
     }
+    if ( overrun )
+    {
+        dropped++;
+    }
+    if ( received.frames > 0U || dropped > 0U )
+    {
+        HW_CAN_Stats_Rx( HW_CAN_Stats_Channel( can ), &received, dropped, HW_TIMER_Get_Time_Us() );
+    }
 
-    uint32_t flags = can->RF0R & ( CAN_RF0R_FULL0 | CAN_RF0R_FOVR0 );
+    uint32_t flags = *rfr & ( CAN_RF0R_FULL0 | CAN_RF0R_FOVR0 );
     if ( flags != 0U )
     {
-        HW_CAN_Clear_Rx_FIFO0_Flags( can, flags );
+        HW_CAN_Clear_Rx_FIFO_Flags( can, fifo, flags );
     }
 }
 
@@ -1512,7 +2291,12 @@ static void HW_CAN_Clear_Error_Interrupt( CAN_TypeDef* can )
 #endif
 }
 
-/** Directly service a bxCAN status/error interrupt for one channel. */
+/**
+ * Directly service a bxCAN status/error interrupt for one channel.
+ *
+ * The error counters, the bus error and a new bus-off are recorded in the
+ * channel's statistics before the last error code is cleared.
+ */
 static void HW_CAN_Error_IRQ( CAN_HandleTypeDef* hcan, volatile bool* active,
                               volatile bool* completed, volatile uint32_t* pending_mailbox,
                               volatile HW_CAN_Tx_Status_T* status )
@@ -1523,6 +2307,10 @@ static void HW_CAN_Error_IRQ( CAN_HandleTypeDef* hcan, volatile bool* active,
 
     if ( ( msr & CAN_MSR_ERRI ) != 0U )
     {
+        HW_CAN_Stats_Error_State_T state;
+        HW_CAN_Read_Error_State( esr, &state );
+        HW_CAN_Stats_Error( HW_CAN_Stats_Channel( can ), &state, HW_TIMER_Get_Time_Us() );
+
         uint32_t last_error = esr & CAN_ESR_LEC;
         bool     bus_off    = ( esr & CAN_ESR_BOFF ) != 0U;
         if ( bus_off )
@@ -1544,21 +2332,18 @@ static void HW_CAN_Error_IRQ( CAN_HandleTypeDef* hcan, volatile bool* active,
 }
 
 /** Reset one channel's software state while preserving its NVIC enable state. */
-static void HW_CAN_Reset_Channel( CAN_TypeDef* can, IRQn_Type tx_irq, IRQn_Type rx_irq,
-                                  IRQn_Type error_irq, volatile uint16_t* tx_wp,
+static void HW_CAN_Reset_Channel( CAN_TypeDef* can, IRQn_Type tx_irq, IRQn_Type rx0_irq,
+                                  IRQn_Type rx1_irq, IRQn_Type error_irq, volatile uint16_t* tx_wp,
                                   volatile uint16_t* tx_rp, volatile uint16_t* rx_wp,
                                   volatile uint16_t* rx_rp, volatile bool* active,
                                   volatile bool* completed, volatile uint32_t* dropped_count,
                                   volatile uint32_t*           pending_mailbox,
-                                  volatile HW_CAN_Tx_Status_T* status )
+                                  volatile HW_CAN_Tx_Status_T* status,
+                                  HW_CAN_Cyclic_Channel_T*     cyclic )
 {
-    uint32_t tx_irq_was_enabled    = NVIC_GetEnableIRQ( tx_irq );
-    uint32_t rx_irq_was_enabled    = NVIC_GetEnableIRQ( rx_irq );
-    uint32_t error_irq_was_enabled = NVIC_GetEnableIRQ( error_irq );
-
-    NVIC_DisableIRQ( tx_irq );
-    NVIC_DisableIRQ( rx_irq );
-    NVIC_DisableIRQ( error_irq );
+    const IRQn_Type   irqs[] = { tx_irq, rx0_irq, rx1_irq, error_irq };
+    HW_CAN_Irq_Mask_T mask;
+    HW_CAN_Mask_Irqs( &mask, irqs, 4U );
 
     CLEAR_BIT( can->IER, CAN_IER_TMEIE );
     *tx_wp           = 0;
@@ -1571,18 +2356,30 @@ static void HW_CAN_Reset_Channel( CAN_TypeDef* can, IRQn_Type tx_irq, IRQn_Type
     *pending_mailbox = 0U;
     *status          = HW_CAN_TX_STATUS_IDLE;
 
-    if ( error_irq_was_enabled != 0U )
+    cyclic->running          = false;
+    cyclic->mailbox_reserved = false;
+    HW_CAN_Cyclic_Clear( &cyclic->schedule );
+    HW_CAN_Responder_Channel_T* responder = HW_CAN_Responder_Channel( can );
+    responder->running                    = false;
+    responder->mailbox_reserved           = false;
+    HW_CAN_Responder_Clear( &responder->responder );
+    HW_CAN_Replay_Channel_T* replay = HW_CAN_Replay_Channel( can );
+    replay->running                 = false;
+    replay->mailbox_reserved        = false;
+    HW_CAN_Replay_Clear( &replay->replay );
+    HW_CAN_Time_Channel( can )->last_tx_valid = false;
+    HW_CAN_Stats_Reset( HW_CAN_Stats_Channel( can ), HW_CAN_Time_Channel( can )->base.bitrate,
+                        HW_TIMER_Get_Time_Us() );
+    if ( !can_cyclic1.running && !can_cyclic2.running )
     {
-        NVIC_EnableIRQ( error_irq );
+        HW_TIMER_Stop_Timer( CAN_CYCLIC_TIMER );
     }
-    if ( rx_irq_was_enabled != 0U )
+    if ( !can_replay1.running && !can_replay2.running )
     {
-        NVIC_EnableIRQ( rx_irq );
-    }
-    if ( tx_irq_was_enabled != 0U )
-    {
-        NVIC_EnableIRQ( tx_irq );
+        HW_TIMER_Stop_Timer( CAN_REPLAY_TIMER );
     }
+
+    HW_CAN_Unmask_Irqs( &mask );
 }
 
 /**
@@ -1598,17 +2395,18 @@ static HW_CAN_Result_T HW_CAN_Tx_Service( CAN_HandleTypeDef* hcan, CAN_Packet_T
                                           uint16_t buffer_width, volatile bool* active,
                                           volatile bool*               completed,
                                           volatile uint32_t*           pending_mailbox,
-                                          volatile HW_CAN_Tx_Status_T* status )
+                                          volatile HW_CAN_Tx_Status_T* status,
+                                          HW_CAN_Cyclic_Channel_T*     cyclic )
 {
     if ( !*active )
     {
-        CLEAR_BIT( hcan->Instance->IER, CAN_IER_TMEIE );
+        HW_CAN_Release_Tx_Interrupt( hcan->Instance, cyclic );
         return HW_CAN_RESULT_ERROR;
     }
 
     if ( *w_p == *r_p )
     {
-        CLEAR_BIT( hcan->Instance->IER, CAN_IER_TMEIE );
+        HW_CAN_Release_Tx_Interrupt( hcan->Instance, cyclic );
         *active    = false;
         *completed = true;
         *status    = HW_CAN_TX_STATUS_COMPLETE;
@@ -1617,8 +2415,10 @@ static HW_CAN_Result_T HW_CAN_Tx_Service( CAN_HandleTypeDef* hcan, CAN_Packet_T
 
     CAN_Packet_T    packet       = buffer[*r_p];
     uint32_t        mailbox_flag = 0U;
-    HW_CAN_Result_T result =
-        HW_CAN_Transmit_To_Mailbox( hcan, packet.data, packet.id, packet.dlc, &mailbox_flag );
+    uint32_t        mailboxes    = HW_CAN_Batch_Mailboxes( hcan->Instance, cyclic );
+    HW_CAN_Result_T result = HW_CAN_Transmit_To_Mailbox( hcan, packet.data, packet.id,
+                                                         packet.extended, packet.dlc, mailboxes,
+                                                         &mailbox_flag );
 
     if ( result == HW_CAN_RESULT_OK )
     {
@@ -1627,7 +2427,7 @@ static HW_CAN_Result_T HW_CAN_Tx_Service( CAN_HandleTypeDef* hcan, CAN_Packet_T
     }
     else if ( result == HW_CAN_RESULT_ERROR )
     {
-        CLEAR_BIT( hcan->Instance->IER, CAN_IER_TMEIE );
+        HW_CAN_Release_Tx_Interrupt( hcan->Instance, cyclic );
         *active    = false;
         *completed = false;
         *status    = HW_CAN_TX_STATUS_ERROR;
@@ -1644,7 +2444,8 @@ static HW_CAN_Result_T HW_CAN_Tx_Trigger( CAN_HandleTypeDef* hcan, CAN_Packet_T
                                           uint16_t buffer_width, volatile bool* active,
                                           volatile bool*               completed,
                                           volatile uint32_t*           pending_mailbox,
-                                          volatile HW_CAN_Tx_Status_T* status )
+                                          volatile HW_CAN_Tx_Status_T* status,
+                                          HW_CAN_Cyclic_Channel_T*     cyclic )
 {
     if ( *active )
     {
@@ -1658,11 +2459,21 @@ static HW_CAN_Result_T HW_CAN_Tx_Trigger( CAN_HandleTypeDef* hcan, CAN_Packet_T
     {
         return HW_CAN_RESULT_ERROR;
     }
-    if ( ( hcan->Instance->sTxMailBox[0].TIR & CAN_TI0R_TXRQ ) != 0U
-         || ( hcan->Instance->sTxMailBox[1].TIR & CAN_TI0R_TXRQ ) != 0U
-         || ( hcan->Instance->sTxMailBox[2].TIR & CAN_TI0R_TXRQ ) != 0U )
+
+    static const uint32_t mailbox_empty_flags[3] = {
+        CAN_TSR_TME0,
+        CAN_TSR_TME1,
+        CAN_TSR_TME2,
+    };
+    // The cyclic schedule and responder keep their mailboxes busy; only batch mailboxes must idle
+    uint32_t batch_mailboxes = HW_CAN_Batch_Mailboxes( hcan->Instance, cyclic );
+    for ( uint8_t mailbox = 0U; mailbox < 3U; mailbox++ )
     {
-        return HW_CAN_RESULT_BUSY;
+        if ( ( batch_mailboxes & mailbox_empty_flags[mailbox] ) != 0U
+             && ( hcan->Instance->sTxMailBox[mailbox].TIR & CAN_TI0R_TXRQ ) != 0U )
+        {
+            return HW_CAN_RESULT_BUSY;
+        }
     }
 
     static const uint32_t request_complete_flags[3] = {
@@ -1678,7 +2489,8 @@ static HW_CAN_Result_T HW_CAN_Tx_Trigger( CAN_HandleTypeDef* hcan, CAN_Packet_T
     uint32_t stale_status = hcan->Instance->TSR;
     for ( uint8_t mailbox = 0U; mailbox < 3U; mailbox++ )
     {
-        if ( ( stale_status & request_complete_flags[mailbox] ) != 0U )
+        if ( ( batch_mailboxes & mailbox_empty_flags[mailbox] ) != 0U
+             && ( stale_status & request_complete_flags[mailbox] ) != 0U )
         {
             HW_CAN_Clear_Tx_Request_Complete( hcan->Instance, request_complete_flags[mailbox],
                                               mailbox_status_flags[mailbox] );
@@ -1692,7 +2504,7 @@ static HW_CAN_Result_T HW_CAN_Tx_Trigger( CAN_HandleTypeDef* hcan, CAN_Packet_T
     SET_BIT( hcan->Instance->IER, CAN_IER_TMEIE );
 
     HW_CAN_Result_T result = HW_CAN_Tx_Service( hcan, buffer, w_p, r_p, buffer_width, active,
-                                                completed, pending_mailbox, status );
+                                                completed, pending_mailbox, status, cyclic );
 
     return result == HW_CAN_RESULT_ERROR ? HW_CAN_RESULT_ERROR : HW_CAN_RESULT_OK;
 }
@@ -1715,16 +2527,19 @@ static void HW_CAN_Abort_Tx_Mailboxes( CAN_TypeDef* can )
 }
 
 /** Recover one CAN channel in task context after a terminal transmit error. */
-static HW_CAN_Result_T HW_CAN_Recover( CAN_HandleTypeDef* hcan, IRQn_Type tx_irq, IRQn_Type rx_irq,
-                                       IRQn_Type error_irq, volatile uint16_t* tx_wp,
-                                       volatile uint16_t* tx_rp, volatile bool* active,
-                                       volatile bool* completed, volatile uint32_t* pending_mailbox,
-                                       volatile HW_CAN_Tx_Status_T* status )
+static HW_CAN_Result_T HW_CAN_Recover( CAN_HandleTypeDef* hcan, IRQn_Type tx_irq, IRQn_Type rx0_irq,
+                                       IRQn_Type rx1_irq, IRQn_Type error_irq,
+                                       volatile uint16_t* tx_wp, volatile uint16_t* tx_rp,
+                                       volatile bool* active, volatile bool* completed,
+                                       volatile uint32_t*           pending_mailbox,
+                                       volatile HW_CAN_Tx_Status_T* status,
+                                       HW_CAN_Cyclic_Channel_T*     cyclic )
 {
     CAN_TypeDef* can = hcan->Instance;
 
     NVIC_DisableIRQ( tx_irq );
-    NVIC_DisableIRQ( rx_irq );
+    NVIC_DisableIRQ( rx0_irq );
+    NVIC_DisableIRQ( rx1_irq );
     NVIC_DisableIRQ( error_irq );
     CLEAR_BIT( can->IER, CAN_IER_TMEIE | HW_CAN_RX_INTERRUPT_MASK | HW_CAN_ERROR_INTERRUPT_MASK );
 
@@ -1739,6 +2554,29 @@ static HW_CAN_Result_T HW_CAN_Recover( CAN_HandleTypeDef* hcan, IRQn_Type tx_irq
     CLEAR_BIT( can->ESR, CAN_ESR_LEC );
     HW_CAN_Clear_Error_Interrupt( can );
 
+    // The aborted cyclic frame fails; a running schedule resumes on its next tick
+    if ( cyclic->mailbox_reserved )
+    {
+        HW_CAN_Cyclic_Complete( &cyclic->schedule, HW_TIMER_Get_Time_Us(), false );
+        cyclic->mailbox_reserved = cyclic->running;
+    }
+
+    // The aborted response fails and requests that matched before the error are not answered
+    HW_CAN_Responder_Channel_T* responder = HW_CAN_Responder_Channel( can );
+    HW_CAN_Responder_Complete( &responder->responder, HW_TIMER_Get_Time_Us(), false );
+    HW_CAN_Responder_Flush( &responder->responder );
+    responder->mailbox_reserved = responder->running;
+
+    // The aborted replay frame fails; the replay carries on with its next frame
+    HW_CAN_Replay_Channel_T* replay = HW_CAN_Replay_Channel( can );
+    HW_CAN_Replay_Complete( &replay->replay, HW_TIMER_Get_Time_Us(), false );
+    replay->mailbox_reserved = replay->running;
+
+    // Leaving initialization mode may restart the time-triggered counter
+    HW_CAN_Time_Channel_T* time = HW_CAN_Time_Channel( can );
+    HW_CAN_Time_Reset( &time->base, time->base.bitrate );
+    time->last_tx_valid = false;
+
     HAL_StatusTypeDef start_result = stop_result == HAL_OK ? HAL_CAN_Start( hcan ) : HAL_ERROR;
     if ( stop_result == HAL_OK && start_result == HAL_OK )
     {
@@ -1750,10 +2588,21 @@ static HW_CAN_Result_T HW_CAN_Recover( CAN_HandleTypeDef* hcan, IRQn_Type tx_irq
     }
 
     SET_BIT( can->IER, HW_CAN_RX_INTERRUPT_MASK | HW_CAN_ERROR_INTERRUPT_MASK );
+    if ( cyclic->running || responder->running || replay->running )
+    {
+        SET_BIT( can->IER, CAN_IER_TMEIE );
+    }
     NVIC_EnableIRQ( error_irq );
-    NVIC_EnableIRQ( rx_irq );
+    NVIC_EnableIRQ( rx1_irq );
+    NVIC_EnableIRQ( rx0_irq );
     NVIC_EnableIRQ( tx_irq );
 
+    // A frame that fell due while the mailbox was aborted has no completion left to load it
+    if ( replay->running )
+    {
+        HW_CAN_Replay_Kick_Timer();
+    }
+
     return *status == HW_CAN_TX_STATUS_IDLE ? HW_CAN_RESULT_OK : HW_CAN_RESULT_ERROR;
 }
 
@@ -1761,25 +2610,698 @@ static HW_CAN_Result_T HW_CAN_Recover( CAN_HandleTypeDef* hcan, IRQn_Type tx_irq
 static void HW_CAN_Tx_Buffer_Cancel( IRQn_Type tx_irq, volatile uint16_t* w_p,
                                      volatile uint16_t* r_p )
 {
-    uint32_t tx_irq_was_enabled = NVIC_GetEnableIRQ( tx_irq );
-    NVIC_DisableIRQ( tx_irq );
+    HW_CAN_Irq_Mask_T mask;
+    HW_CAN_Mask_Irqs( &mask, &tx_irq, 1U );
 
     *w_p = *r_p;
 
-    if ( tx_irq_was_enabled != 0U )
+    HW_CAN_Unmask_Irqs( &mask );
+}
+
+/**
+ * @brief Programs all 28 shared filter banks from the two channel plans.
+ *
+ * Banks below can2_first_bank belong to CAN1 and the rest to CAN2. Banks a
+ * plan does not use are deactivated, except a channel's single-bank filter,
+ * which is rewritten at its own bank and FIFO0. Each channel's even banks feed
+ * FIFO0 and its odd banks FIFO1; a given ID always lands in the same FIFO, so
+ * per-ID order is kept.
+ */
+static HAL_StatusTypeDef HW_CAN_Apply_Filter_Banks( uint8_t can2_first_bank )
+{
+    HW_CAN_Filter_Bank_T banks[HW_CAN_FILTER_BANK_COUNT];
+    memset( banks, 0, sizeof( banks ) );
+    uint8_t can1_banks = HW_CAN_Filter_Build_Banks( &can_filter_plan1, banks );
+    uint8_t can2_banks = HW_CAN_Filter_Build_Banks( &can_filter_plan2, &banks[can2_first_bank] );
+
+    for ( uint8_t bank = 0U; bank < HW_CAN_FILTER_BANK_COUNT; bank++ )
+    {
+        bool                          can1   = bank < can2_first_bank;
+        const HW_CAN_Single_Filter_T* single = can1 ? &can_filter_single1 : &can_filter_single2;
+        bool                          single_bank = single->active && single->bank == bank;
+        const HW_CAN_Filter_Bank_T*   image       = single_bank ? &single->image : &banks[bank];
+        CAN_FilterTypeDef             filter;
+        memset( &filter, 0, sizeof( filter ) );
+
+        filter.FilterBank           = bank;
+        filter.SlaveStartFilterBank = can2_first_bank;
+        /* Alternate a channel's banks between FIFOs so bursts fill both */
+        uint8_t channel_bank        = can1 ? bank : ( uint8_t )( bank - can2_first_bank );
+        filter.FilterFIFOAssignment =
+            !single_bank && ( channel_bank & 1U ) != 0U ? CAN_FILTER_FIFO1 : CAN_FILTER_FIFO0;
+        filter.FilterMode  = image->list_mode ? CAN_FILTERMODE_IDLIST : CAN_FILTERMODE_IDMASK;
+        filter.FilterScale = image->scale_32bit ? CAN_FILTERSCALE_32BIT : CAN_FILTERSCALE_16BIT;
+
+        if ( image->scale_32bit )
+        {
+            filter.FilterIdHigh     = image->fr1 >> 16;
+            filter.FilterIdLow      = image->fr1 & 0xFFFFU;
+            filter.FilterMaskIdHigh = image->fr2 >> 16;
+            filter.FilterMaskIdLow  = image->fr2 & 0xFFFFU;
+        }
+        else
+        {
+            // In 16-bit scale HAL writes FR1 = MaskIdLow:IdLow and FR2 = MaskIdHigh:IdHigh
+            filter.FilterIdLow      = image->fr1 & 0xFFFFU;
+            filter.FilterMaskIdLow  = image->fr1 >> 16;
+            filter.FilterIdHigh     = image->fr2 & 0xFFFFU;
+            filter.FilterMaskIdHigh = image->fr2 >> 16;
+        }
+
+        bool in_use = can1 ? bank < can1_banks : bank - can2_first_bank < can2_banks;
+        filter.FilterActivation = in_use || single_bank ? ENABLE : DISABLE;
+
+        if ( HAL_CAN_ConfigFilter( can1 ? &hcan1 : &hcan2, &filter ) != HAL_OK )
+        {
+            return HAL_ERROR;
+        }
+    }
+
+    return HAL_OK;
+}
+
+/**
+ * @brief Splits the shared banks between the two plans and programs them.
+ *
+ * A single-bank filter on either channel pins the split at bank 14, where
+ * HW_CAN_Apply_Filter_HAL() placed it, and each plan is packed into its half.
+ * Otherwise the banks are shared in proportion to each plan's need.
+ */
+static HAL_StatusTypeDef HW_CAN_Pack_Filter_Banks( void )
+{
+    if ( can_filter_single1.active || can_filter_single2.active )
+    {
+        uint8_t can2_budget = HW_CAN_FILTER_BANK_COUNT - HW_CAN_FILTER_FIXED_CAN2_FIRST_BANK;
+        if ( !HW_CAN_Filter_Pack( &can_filter_plan1, HW_CAN_FILTER_FIXED_CAN2_FIRST_BANK )
+             || !HW_CAN_Filter_Pack( &can_filter_plan2, can2_budget ) )
+        {
+            return HAL_ERROR;
+        }
+        can_filter_can2_first_bank = HW_CAN_FILTER_FIXED_CAN2_FIRST_BANK;
+    }
+    else
+    {
+        can_filter_can2_first_bank = HW_CAN_Filter_Allocate( &can_filter_plan1, &can_filter_plan2 );
+    }
+
+    return HW_CAN_Apply_Filter_Banks( can_filter_can2_first_bank );
+}
+
+/**
+ * @brief Masks up to HW_CAN_IRQ_MASK_MAX vectors, saving which were enabled.
+ *
+ * Every enable state is read before any vector is masked, so a vector listed
+ * twice is still restored. Pair each call with HW_CAN_Unmask_Irqs().
+ */
+static void HW_CAN_Mask_Irqs( HW_CAN_Irq_Mask_T* mask, const IRQn_Type irqs[], uint8_t count )
+{
+    mask->count = count;
+    for ( uint8_t i = 0U; i < count; i++ )
+    {
+        mask->irqs[i]        = irqs[i];
+        mask->was_enabled[i] = NVIC_GetEnableIRQ( irqs[i] );
+    }
+    for ( uint8_t i = 0U; i < count; i++ )
+    {
+        NVIC_DisableIRQ( irqs[i] );
+    }
+}
+
+/** Re-enable, last first, the vectors HW_CAN_Mask_Irqs() found enabled. */
+static void HW_CAN_Unmask_Irqs( const HW_CAN_Irq_Mask_T* mask )
+{
+    for ( uint8_t i = mask->count; i > 0U; i-- )
+    {
+        if ( mask->was_enabled[i - 1U] != 0U )
+        {
+            NVIC_EnableIRQ( mask->irqs[i - 1U] );
+        }
+    }
+}
+
+/**
+ * @brief Records the bank HW_CAN_Configure() just programmed for one channel.
+ *
+ * The filter is kept as a bank image so a later filter set on the other
+ * channel rewrites it instead of deactivating it. When a filter set already
+ * owns banks, all banks are reprogrammed at the fixed split so stale banks of
+ * this channel are dropped and the other channel's set moves into its half.
+ *
+ * @return 0 when the filter is recorded, or 2 when reprogramming the banks failed
+ */
+static int HW_CAN_Keep_Single_Filter( HW_CAN_Single_Filter_T* single, uint16_t filter_bank,
+                                      uint32_t filter_id, uint32_t filter_mask,
+                                      bool filter_extended, bool repack )
+{
+    HW_CAN_Irq_Mask_T mask;
+    HW_CAN_Mask_Irqs( &mask, can_rx_irqs, HW_CAN_RX_IRQ_COUNT );
+
+    single->image.fr1         = HW_CAN_Single_Filter_Id( filter_id, filter_extended );
+    single->image.fr2         = HW_CAN_Single_Filter_Mask( filter_mask, filter_extended );
+    single->image.list_mode   = false;
+    single->image.scale_32bit = true;
+    single->bank              = ( uint8_t )filter_bank;
+    single->active            = true;
+
+    int result                 = 0;
+    can_filter_can2_first_bank = HW_CAN_FILTER_FIXED_CAN2_FIRST_BANK;
+    if ( repack && HW_CAN_Pack_Filter_Banks() != HAL_OK )
+    {
+        result = 2;
+    }
+
+    HW_CAN_Unmask_Irqs( &mask );
+    return result;
+}
+
+/**
+ * @brief Installs one channel's filter set and re-packs both channels' banks.
+ *
+ * The set replaces the channel's single-bank filter. A single-bank filter on
+ * the other channel is kept and pins the split at bank 14. All four RX
+ * interrupts are masked while the plans and banks change, so no RX ISR checks
+ * frames against a half-updated plan.
+ */
+static HW_CAN_Result_T HW_CAN_Set_Filters( HW_CAN_Filter_Plan_T*       plan,
+                                           HW_CAN_Single_Filter_T*     single,
+                                           const HW_CAN_Filter_Rule_T rules[],
+                                           uint16_t                   rule_count )
+{
+    HW_CAN_Irq_Mask_T mask;
+    HW_CAN_Mask_Irqs( &mask, can_rx_irqs, HW_CAN_RX_IRQ_COUNT );
+
+    HW_CAN_Result_T result = HW_CAN_RESULT_ERROR;
+    if ( HW_CAN_Filter_Set_Rules( plan, rules, rule_count ) )
+    {
+        single->active = false;
+        if ( HW_CAN_Pack_Filter_Banks() == HAL_OK )
+        {
+            result = HW_CAN_RESULT_OK;
+        }
+    }
+
+    HW_CAN_Unmask_Irqs( &mask );
+    return result;
+}
+
+/** Copy one channel's filter allocation into a report. */
+static void HW_CAN_Get_Filter_Report( const HW_CAN_Filter_Plan_T* plan, uint8_t first_bank,
+                                      HW_CAN_Filter_Report_T* report )
+{
+    if ( report == NULL )
+    {
+        return;
+    }
+
+    report->first_bank   = first_bank;
+    report->bank_count   = plan->bank_count;
+    report->hardware_ids = plan->hardware_ids;
+    report->software_ids = plan->software_ids;
+}
+
+/**
+ * @brief Loads a table into one channel's schedule and hands it mailbox 2.
+ *
+ * The shared tick timer is started with the first running schedule. Frames
+ * already queued in mailbox 2 by a direct send are left to finish; the first
+ * cyclic frame is loaded once the mailbox is empty. A log replay holding
+ * mailbox 2 returns HW_CAN_RESULT_BUSY.
+ */
+static HW_CAN_Result_T HW_CAN_Cyclic_Start( CAN_HandleTypeDef* hcan, IRQn_Type tx_irq,
+                                            HW_CAN_Cyclic_Channel_T*    cyclic,
+                                            const HW_CAN_Cyclic_Entry_T table[], uint16_t count )
+{
+    if ( cyclic->mailbox_reserved || HW_CAN_Replay_Channel( hcan->Instance )->mailbox_reserved )
+    {
+        return HW_CAN_RESULT_BUSY;
+    }
+
+    // Releases and completions are both stamped on the microsecond time base
+    if ( !HW_CAN_Cyclic_Load( &cyclic->schedule, table, count, 1U ) )
+    {
+        return HW_CAN_RESULT_ERROR;
+    }
+    HW_TIMER_Start_Cycle_Counter();
+
+    bool tick_running = can_cyclic1.running || can_cyclic2.running;
+
+    HW_CAN_Irq_Mask_T mask;
+    HW_CAN_Mask_Irqs( &mask, &tx_irq, 1U );
+    cyclic->mailbox_reserved = true;
+    cyclic->running          = true;
+    SET_BIT( hcan->Instance->IER, CAN_IER_TMEIE );
+    HW_CAN_Unmask_Irqs( &mask );
+
+    if ( !tick_running )
+    {
+        uint32_t prescaler = HW_TIMER_Get_Clock_Hz( CAN_CYCLIC_TIMER ) / 1000000U;
+        HW_TIMER_Configure_Timer( CAN_CYCLIC_TIMER, prescaler == 0U ? 0U : prescaler - 1U,
+                                  HW_CAN_CYCLIC_TICK_US - 1U );
+        HW_TIMER_Start_Timer( CAN_CYCLIC_TIMER );
+    }
+
+    return HW_CAN_RESULT_OK;
+}
+
+/**
+ * @brief Stops releasing frames on one channel.
+ *
+ * A frame already in mailbox 2 is allowed to finish; its completion hands the
+ * mailbox back to batches. The tick timer stops with the last running schedule.
+ */
+static void HW_CAN_Cyclic_Stop( IRQn_Type tx_irq, HW_CAN_Cyclic_Channel_T* cyclic )
+{
+    HW_CAN_Irq_Mask_T mask;
+    HW_CAN_Mask_Irqs( &mask, &tx_irq, 1U );
+    cyclic->running = false;
+    if ( cyclic->schedule.in_flight == HW_CAN_CYCLIC_NONE )
+    {
+        cyclic->mailbox_reserved = false;
+    }
+    HW_CAN_Unmask_Irqs( &mask );
+
+    if ( !can_cyclic1.running && !can_cyclic2.running )
     {
-        NVIC_EnableIRQ( tx_irq );
+        HW_TIMER_Stop_Timer( CAN_CYCLIC_TIMER );
     }
 }
 
+/** Move the oldest released frame into mailbox 2 when the mailbox is free. */
+static void HW_CAN_Cyclic_Load_Mailbox( CAN_HandleTypeDef* hcan, HW_CAN_Cyclic_Channel_T* cyclic )
+{
+    if ( ( hcan->Instance->TSR & HW_CAN_CYCLIC_MAILBOX_EMPTY ) == 0U )
+    {
+        return;
+    }
+
+    uint16_t index = HW_CAN_Cyclic_Pop_Ready( &cyclic->schedule );
+    if ( index == HW_CAN_CYCLIC_NONE )
+    {
+        return;
+    }
+
+    const HW_CAN_Cyclic_Message_T* message = &cyclic->schedule.messages[index];
+    uint8_t                        data[HW_CAN_CYCLIC_PAYLOAD_SIZE];
+    uint8_t dlc = HW_CAN_Cyclic_Read_Payload( &cyclic->schedule, index, data );
+
+    if ( HW_CAN_Transmit_To_Mailbox( hcan, data, message->id, message->extended, dlc,
+                                     HW_CAN_CYCLIC_MAILBOX_EMPTY, NULL )
+         != HW_CAN_RESULT_OK )
+    {
+        HW_CAN_Cyclic_Complete( &cyclic->schedule, HW_TIMER_Get_Time_Us(), false );
+    }
+}
+
+/**
+ * Copy one frame's statistics without tearing. The TX completion and the
+ * schedule tick both update them, so both vectors are masked.
+ */
+static HW_CAN_Result_T HW_CAN_Cyclic_Copy_Stats( IRQn_Type tx_irq, HW_CAN_Cyclic_Channel_T* cyclic,
+                                                 uint16_t index, HW_CAN_Cyclic_Stats_T* stats )
+{
+    const IRQn_Type   irqs[] = { tx_irq, HW_CAN_CYCLIC_TICK_IRQ };
+    HW_CAN_Irq_Mask_T mask;
+    HW_CAN_Mask_Irqs( &mask, irqs, 2U );
+    bool copied = HW_CAN_Cyclic_Get_Stats( &cyclic->schedule, index, stats );
+    HW_CAN_Unmask_Irqs( &mask );
+
+    return copied ? HW_CAN_RESULT_OK : HW_CAN_RESULT_ERROR;
+}
+
+/** Copy a channel's last batch frame timestamp without tearing against the TX interrupt. */
+static bool HW_CAN_Copy_Tx_Timestamp( IRQn_Type tx_irq, HW_CAN_Time_Channel_T* time,
+                                      uint32_t* timestamp_us )
+{
+    if ( timestamp_us == NULL )
+    {
+        return false;
+    }
+
+    HW_CAN_Irq_Mask_T mask;
+    HW_CAN_Mask_Irqs( &mask, &tx_irq, 1U );
+    bool valid = time->last_tx_valid;
+    if ( valid )
+    {
+        *timestamp_us = time->last_tx_us;
+    }
+    HW_CAN_Unmask_Irqs( &mask );
+
+    return valid;
+}
+
+/**
+ * @brief Loads a table into one channel's auto-responder and hands it mailbox 0.
+ *
+ * Both RX vectors and the TX vector are masked while the table is swapped, as
+ * either may be using the old one. A frame already queued in mailbox 0 by a
+ * batch or direct send is left to finish; the first response is loaded once
+ * the mailbox is empty.
+ */
+static HW_CAN_Result_T HW_CAN_Responder_Start( CAN_HandleTypeDef* hcan, IRQn_Type tx_irq,
+                                               IRQn_Type rx0_irq, IRQn_Type rx1_irq,
+                                               HW_CAN_Responder_Channel_T*     channel,
+                                               const HW_CAN_Responder_Entry_T table[],
+                                               uint16_t                        count )
+{
+    if ( channel->mailbox_reserved )
+    {
+        return HW_CAN_RESULT_BUSY;
+    }
+
+    const IRQn_Type   irqs[] = { tx_irq, rx0_irq, rx1_irq };
+    HW_CAN_Irq_Mask_T mask;
+    HW_CAN_Mask_Irqs( &mask, irqs, 3U );
+
+    bool loaded = HW_CAN_Responder_Load( &channel->responder, table, count );
+    if ( loaded )
+    {
+        channel->mailbox_reserved = true;
+        channel->running          = true;
+        SET_BIT( hcan->Instance->IER, CAN_IER_TMEIE );
+    }
+
+    HW_CAN_Unmask_Irqs( &mask );
+
+    return loaded ? HW_CAN_RESULT_OK : HW_CAN_RESULT_ERROR;
+}
+
+/**
+ * @brief Stops answering requests on one channel.
+ *
+ * Queued responses are dropped. One already in mailbox 0 is allowed to finish;
+ * its completion hands the mailbox back to batches.
+ */
+static void HW_CAN_Responder_Stop( IRQn_Type tx_irq, IRQn_Type rx0_irq, IRQn_Type rx1_irq,
+                                   HW_CAN_Responder_Channel_T* channel )
+{
+    const IRQn_Type   irqs[] = { tx_irq, rx0_irq, rx1_irq };
+    HW_CAN_Irq_Mask_T mask;
+    HW_CAN_Mask_Irqs( &mask, irqs, 3U );
+
+    channel->running = false;
+    HW_CAN_Responder_Flush( &channel->responder );
+    if ( channel->responder.in_flight == HW_CAN_RESPONDER_NONE )
+    {
+        channel->mailbox_reserved = false;
+    }
+
+    HW_CAN_Unmask_Irqs( &mask );
+}
+
+/** Move the oldest queued response into mailbox 0 when the mailbox is free. */
+static void HW_CAN_Responder_Load_Mailbox( CAN_HandleTypeDef*          hcan,
+                                           HW_CAN_Responder_Channel_T* channel )
+{
+    if ( ( hcan->Instance->TSR & HW_CAN_RESPONDER_MAILBOX_EMPTY ) == 0U )
+    {
+        return;
+    }
+
+    uint8_t index = HW_CAN_Responder_Pop( &channel->responder );
+    if ( index == HW_CAN_RESPONDER_NONE )
+    {
+        return;
+    }
+
+    HW_CAN_Responder_Entry_T* entry = &channel->responder.entries[index];
+    if ( HW_CAN_Transmit_To_Mailbox( hcan, entry->response_data, entry->response_id,
+                                     entry->response_extended, entry->response_dlc,
+                                     HW_CAN_RESPONDER_MAILBOX_EMPTY, NULL )
+         != HW_CAN_RESULT_OK )
+    {
+        HW_CAN_Responder_Complete( &channel->responder, HW_TIMER_Get_Time_Us(), false );
+    }
+}
+
+/** Copy one channel's responder statistics without tearing against the CAN interrupts. */
+static HW_CAN_Result_T HW_CAN_Responder_Copy_Stats( IRQn_Type tx_irq, IRQn_Type rx0_irq,
+                                                    IRQn_Type                   rx1_irq,
+                                                    HW_CAN_Responder_Channel_T* channel,
+                                                    HW_CAN_Responder_Stats_T*   stats )
+{
+    if ( stats == NULL )
+    {
+        return HW_CAN_RESULT_ERROR;
+    }
+
+    const IRQn_Type   irqs[] = { tx_irq, rx0_irq, rx1_irq };
+    HW_CAN_Irq_Mask_T mask;
+    HW_CAN_Mask_Irqs( &mask, irqs, 3U );
+
+    *stats = channel->responder.stats;
+
+    HW_CAN_Unmask_Irqs( &mask );
+
+    return HW_CAN_RESULT_OK;
+}
+
+/**
+ * @brief Loads a log into one channel's replay and hands it mailbox 2.
+ *
+ * The replay starts from the current time base reading. Its first frame is
+ * loaded from the replay timer interrupt, which paces the rest. A cyclic
+ * schedule or an earlier replay still holding mailbox 2 returns
+ * HW_CAN_RESULT_BUSY.
+ */
+static HW_CAN_Result_T HW_CAN_Replay_Start( CAN_HandleTypeDef* hcan, IRQn_Type tx_irq,
+                                            HW_CAN_Replay_Channel_T*       channel,
+                                            const HW_CAN_Cyclic_Channel_T* cyclic,
+                                            const uint8_t log[], uint32_t length,
+                                            uint32_t time_scale, uint32_t passes )
+{
+    if ( channel->mailbox_reserved || cyclic->mailbox_reserved )
+    {
+        return HW_CAN_RESULT_BUSY;
+    }
+
+    // Due times and start-of-frame timestamps share the microsecond time base
+    HW_TIMER_Start_Cycle_Counter();
+    if ( !HW_CAN_Replay_Load( &channel->replay, log, length, time_scale, passes,
+                              HW_TIMER_Get_Time_Us() ) )
+    {
+        return HW_CAN_RESULT_ERROR;
+    }
+
+    uint32_t prescaler   = HW_TIMER_Get_Clock_Hz( CAN_REPLAY_TIMER ) / 1000000U;
+    can_replay_prescaler = prescaler == 0U ? 0U : prescaler - 1U;
+
+    HW_CAN_Irq_Mask_T mask;
+    HW_CAN_Mask_Irqs( &mask, &tx_irq, 1U );
+    channel->mailbox_reserved = true;
+    channel->running          = true;
+    SET_BIT( hcan->Instance->IER, CAN_IER_TMEIE );
+    HW_CAN_Unmask_Irqs( &mask );
+
+    HW_CAN_Replay_Kick_Timer();
+    return HW_CAN_RESULT_OK;
+}
+
+/**
+ * @brief Stops a replay on one channel.
+ *
+ * A frame already in mailbox 2 is allowed to finish; its completion hands the
+ * mailbox back to batches. The replay timer stops itself once no replay has a
+ * frame waiting.
+ */
+static void HW_CAN_Replay_Stop( IRQn_Type tx_irq, HW_CAN_Replay_Channel_T* channel )
+{
+    HW_CAN_Irq_Mask_T mask;
+    HW_CAN_Mask_Irqs( &mask, &tx_irq, 1U );
+    channel->running = false;
+    if ( !channel->replay.in_flight )
+    {
+        channel->mailbox_reserved = false;
+    }
+    HW_CAN_Unmask_Irqs( &mask );
+}
+
+/**
+ * @brief Loads the waiting frame into mailbox 2 once it is due.
+ *
+ * A due frame that finds the mailbox busy is counted as starved and is loaded
+ * by the completion that frees the mailbox. A replay whose last frame has
+ * completed stops and releases the mailbox.
+ *
+ * @return true when a frame was loaded, so the next one needs the timer.
+ */
+static bool HW_CAN_Replay_Service( CAN_HandleTypeDef* hcan, HW_CAN_Replay_Channel_T* channel,
+                                   uint32_t now_us )
+{
+    if ( !channel->running )
+    {
+        return false;
+    }
+
+    bool loaded = false;
+    if ( HW_CAN_Replay_Due( &channel->replay, now_us ) )
+    {
+        if ( ( hcan->Instance->TSR & HW_CAN_REPLAY_MAILBOX_EMPTY ) != 0U
+             && !channel->replay.in_flight )
+        {
+            const HW_CAN_Replay_Frame_T* frame = HW_CAN_Replay_Take( &channel->replay );
+            uint8_t                      data[CAN_PACKET_SIZE];
+            memcpy( data, frame->data, sizeof( data ) );
+            if ( HW_CAN_Transmit_To_Mailbox( hcan, data, frame->id, frame->extended, frame->dlc,
+                                             HW_CAN_REPLAY_MAILBOX_EMPTY, NULL )
+                 != HW_CAN_RESULT_OK )
+            {
+                HW_CAN_Replay_Complete( &channel->replay, now_us, false );
+            }
+            loaded = true;
+        }
+        else
+        {
+            HW_CAN_Replay_Starved( &channel->replay );
+        }
+    }
+
+    if ( HW_CAN_Replay_Finished( &channel->replay ) )
+    {
+        channel->running          = false;
+        channel->mailbox_reserved = false;
+    }
+    return loaded;
+}
+
+/**
+ * @brief Arms the replay timer for the earliest frame the timer has to release.
+ *
+ * Frames waiting on a busy mailbox are left to its completion. The timer is
+ * stopped when no running replay has a frame for it; gaps longer than one
+ * shot take several.
+ */
+static void HW_CAN_Replay_Arm_Timer( uint32_t now_us )
+{
+    static const struct
+    {
+        CAN_HandleTypeDef*       hcan;
+        HW_CAN_Replay_Channel_T* channel;
+    } channels[] = {
+        { &hcan1, &can_replay1 },
+        { &hcan2, &can_replay2 },
+    };
+
+    bool     armed   = false;
+    uint32_t wait_us = HW_CAN_REPLAY_TIMER_MAX_US;
+    for ( uint8_t i = 0U; i < 2U; i++ )
+    {
+        const HW_CAN_Replay_Channel_T* channel = channels[i].channel;
+        if ( !channel->running || !channel->replay.has_next )
+        {
+            continue;
+        }
+
+        uint32_t until_us = 0U;
+        if ( !HW_CAN_Replay_Due( &channel->replay, now_us ) )
+        {
+            until_us = channel->replay.next.due_us - now_us;
+        }
+        else if ( ( channels[i].hcan->Instance->TSR & HW_CAN_REPLAY_MAILBOX_EMPTY ) == 0U )
+        {
+            continue;
+        }
+
+        armed   = true;
+        wait_us = until_us < wait_us ? until_us : wait_us;
+    }
+
+    if ( !armed )
+    {
+        HW_TIMER_Stop_Timer( CAN_REPLAY_TIMER );
+        return;
+    }
+
+    wait_us = wait_us < HW_CAN_REPLAY_TIMER_MIN_US ? HW_CAN_REPLAY_TIMER_MIN_US : wait_us;
+    HW_TIMER_Configure_Timer( CAN_REPLAY_TIMER, can_replay_prescaler, wait_us - 1U );
+    HW_TIMER_Start_Timer( CAN_REPLAY_TIMER );
+}
+
+/**
+ * @brief Fires the replay timer as soon as possible from task context.
+ *
+ * The interrupt then re-arms the timer for whatever is due on both channels,
+ * so a shot the interrupt sets while this runs is recomputed rather than lost.
+ */
+static void HW_CAN_Replay_Kick_Timer( void )
+{
+    HW_TIMER_Configure_Timer( CAN_REPLAY_TIMER, can_replay_prescaler,
+                              HW_CAN_REPLAY_TIMER_MIN_US - 1U );
+    HW_TIMER_Start_Timer( CAN_REPLAY_TIMER );
+}
+
+/**
+ * Copy one channel's replay statistics without tearing. The TX completion and
+ * the replay timer both update them, so both vectors are masked.
+ */
+static HW_CAN_Result_T HW_CAN_Replay_Copy_Stats( IRQn_Type tx_irq, HW_CAN_Replay_Channel_T* channel,
+                                                 HW_CAN_Replay_Stats_T* stats )
+{
+    if ( stats == NULL )
+    {
+        return HW_CAN_RESULT_ERROR;
+    }
+
+    const IRQn_Type   irqs[] = { tx_irq, HW_CAN_REPLAY_TIMER_IRQ };
+    HW_CAN_Irq_Mask_T mask;
+    HW_CAN_Mask_Irqs( &mask, irqs, 2U );
+    *stats = channel->replay.stats;
+    HW_CAN_Unmask_Irqs( &mask );
+
+    return HW_CAN_RESULT_OK;
+}
+
+/**
+ * Snapshot one channel's bus statistics with its error register.
+ *
+ * All four of the channel's vectors feed the statistics, so all are masked
+ * while the window is closed and the statistics are copied.
+ */
+static HW_CAN_Result_T HW_CAN_Bus_Copy_Stats( CAN_TypeDef* can, IRQn_Type tx_irq, IRQn_Type rx0_irq,
+                                              IRQn_Type rx1_irq, IRQn_Type error_irq,
+                                              HW_CAN_Bus_Stats_T* stats )
+{
+    if ( stats == NULL )
+    {
+        return HW_CAN_RESULT_ERROR;
+    }
+
+    const IRQn_Type   irqs[] = { tx_irq, rx0_irq, rx1_irq, error_irq };
+    HW_CAN_Irq_Mask_T mask;
+    HW_CAN_Mask_Irqs( &mask, irqs, 4U );
+
+    HW_CAN_Stats_Error_State_T state;
+    HW_CAN_Read_Error_State( can->ESR, &state );
+    HW_CAN_Stats_Snapshot( HW_CAN_Stats_Channel( can ), &state, HW_TIMER_Get_Time_Us(), stats );
+
+    HW_CAN_Unmask_Irqs( &mask );
+
+    return HW_CAN_RESULT_OK;
+}
+
+/** Clear one channel's bus statistics, keeping its bitrate. */
+static void HW_CAN_Bus_Reset_Stats( CAN_TypeDef* can, IRQn_Type tx_irq, IRQn_Type rx0_irq,
+                                    IRQn_Type rx1_irq, IRQn_Type error_irq )
+{
+    const IRQn_Type   irqs[] = { tx_irq, rx0_irq, rx1_irq, error_irq };
+    HW_CAN_Irq_Mask_T mask;
+    HW_CAN_Mask_Irqs( &mask, irqs, 4U );
+
+    HW_CAN_Stats_T* stats = HW_CAN_Stats_Channel( can );
+    HW_CAN_Stats_Reset( stats, stats->bitrate, HW_TIMER_Get_Time_Us() );
+
+    HW_CAN_Unmask_Irqs( &mask );
+}
+
 /**
  * @brief Checks whether a packet fits the supported classical CAN data-frame contract.
  *
  * @param packet Packet to validate.
  *
- * @return true for a standard identifier and DLC from 0 through 8.
+ * @return true for an identifier that fits its standard or extended format and
+ *         a DLC from 0 through 8.
  */
 static bool HW_CAN_Packet_Is_Valid( const CAN_Packet_T* packet )
 {
-    return packet->id <= CAN_STANDARD_ID_MAX && packet->dlc <= CAN_PACKET_SIZE;
+    uint32_t id_max = packet->extended ? CAN_EXTENDED_ID_MAX : CAN_STANDARD_ID_MAX;
+    return packet->id <= id_max && packet->dlc <= CAN_PACKET_SIZE;
 }
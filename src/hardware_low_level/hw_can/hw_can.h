@@ -7,11 +7,12 @@
  *      Hardware abstraction layer for the CAN peripherals.
  *
  *      Provides CAN configuration, transmission, reception, buffering,
- *      filtering, and transmit triggering for CAN channels 1 and 2.
+ *      filtering, transmit triggering, cyclic transmit schedules, automatic
+ *      responses and timed log replay for CAN channels 1 and 2.
  *
  *  Notes:
- *      CAN packets use standard 11-bit CAN identifiers and contain up to
- *      CAN_PACKET_SIZE bytes of data.
+ *      CAN packets use standard 11-bit or extended 29-bit CAN identifiers
+ *      and contain up to CAN_PACKET_SIZE bytes of data.
  ******************************************************************************/
 
 #ifndef HW_CAN_H
@@ -29,6 +30,12 @@ extern "C"
 
 #include <stdint.h>
 #include <stdbool.h>
+#include "hw_can_filter.h"
+#include "hw_can_cyclic.h"
+#include "hw_can_time.h"
+#include "hw_can_responder.h"
+#include "hw_can_replay.h"
+#include "hw_can_stats.h"
 
 /**-----------------------------------------------------------------------------
  *  Public Defines / Macros
@@ -37,8 +44,31 @@ extern "C"
 
 #define CAN_PACKET_SIZE ( 8U )
 #define CAN_STANDARD_ID_MAX ( 0x7FFU )
+#define CAN_EXTENDED_ID_MAX ( 0x1FFFFFFFU )
 #define HW_CAN_TX_QUEUE_CAPACITY ( 19U )
-#define HW_CAN_RX_QUEUE_CAPACITY ( 19U )
+
+/*
+ * Software RX ring depth per channel, in frames. Each slot costs
+ * sizeof( CAN_Packet_T ) bytes of RAM; override with a compile definition
+ * to size a channel for its expected bursts.
+ */
+#ifndef HW_CAN_CH1_RX_QUEUE_CAPACITY
+#define HW_CAN_CH1_RX_QUEUE_CAPACITY ( 64U )
+#endif
+#ifndef HW_CAN_CH2_RX_QUEUE_CAPACITY
+#define HW_CAN_CH2_RX_QUEUE_CAPACITY ( 64U )
+#endif
+
+/** RX ring depth guaranteed on both channels. */
+#define HW_CAN_RX_QUEUE_CAPACITY                                                                   \
+    ( HW_CAN_CH1_RX_QUEUE_CAPACITY < HW_CAN_CH2_RX_QUEUE_CAPACITY ? HW_CAN_CH1_RX_QUEUE_CAPACITY  \
+                                                                  : HW_CAN_CH2_RX_QUEUE_CAPACITY )
+
+// The ring keeps one slot free and uses uint16_t indices.
+#if HW_CAN_CH1_RX_QUEUE_CAPACITY < 1U || HW_CAN_CH2_RX_QUEUE_CAPACITY < 1U \
+    || HW_CAN_CH1_RX_QUEUE_CAPACITY > 65534U || HW_CAN_CH2_RX_QUEUE_CAPACITY > 65534U
+#error "CAN RX ring depth must be 1 to 65534 frames"
+#endif
 
 /**-----------------------------------------------------------------------------
  *  Public Typedefs / Enums / Structures
@@ -60,20 +90,34 @@ typedef struct CanProperties_T
 /**
  * @brief CAN packet containing an identifier and CAN data payload.
  *
- * The CAN identifier is a standard 11-bit CAN identifier stored in the
- * lower 11 bits of id.
+ * When extended is false, id is a standard 11-bit CAN identifier from 0
+ * through CAN_STANDARD_ID_MAX. When extended is true, id is a 29-bit
+ * extended identifier from 0 through CAN_EXTENDED_ID_MAX.
  *
  * dlc contains the number of valid payload bytes, from 0 through
  * CAN_PACKET_SIZE. Only data[0] through data[dlc - 1] are valid.
+ *
+ * timestamp_us is the frame's start of frame on the HW_TIMER_Get_Time_Us()
+ * time base, filled in on receive and ignored on transmit.
+ *
+ * The layout is kept at 20 bytes so both software rings stay compact.
  */
 typedef struct CAN_Packet_T
 {
-    uint16_t id;
+    uint32_t id;
     uint8_t  dlc;
     uint8_t  data[CAN_PACKET_SIZE];
+    bool     extended;
+    uint32_t timestamp_us;
 
 } CAN_Packet_T;
 
+#if defined( __cplusplus )
+static_assert( sizeof( CAN_Packet_T ) == 20U, "CAN packets must stay compact in the rings" );
+#else
+_Static_assert( sizeof( CAN_Packet_T ) == 20U, "CAN packets must stay compact in the rings" );
+#endif
+
 /**
  * @brief Result codes returned by buffered CAN load and trigger operations.
  */
@@ -139,6 +183,8 @@ HW_CAN_Tx_Status_T HW_CAN_Tx_Status2( void );
 /**
  * @brief Returns the number of channel 1 frames dropped because the software RX buffer was full.
  *
+ * Frames lost to a hardware FIFO0 or FIFO1 overrun are counted too.
+ *
  * @return Sticky dropped-frame count since the last channel 1 reset.
  */
 uint32_t HW_CAN_Rx_Dropped_Count1( void );
@@ -146,10 +192,40 @@ uint32_t HW_CAN_Rx_Dropped_Count1( void );
 /**
  * @brief Returns the number of channel 2 frames dropped because the software RX buffer was full.
  *
+ * Frames lost to a hardware FIFO0 or FIFO1 overrun are counted too.
+ *
  * @return Sticky dropped-frame count since the last channel 2 reset.
  */
 uint32_t HW_CAN_Rx_Dropped_Count2( void );
 
+/**
+ * @brief Returns the start of frame of the last acknowledged channel 1 batch frame.
+ *
+ * Taken from the mailbox timestamp and reported on the HW_TIMER_Get_Time_Us()
+ * time base. Direct sends raise no completion and are not reported; cyclic
+ * frames are reported through their statistics.
+ *
+ * @param timestamp_us  Destination for the timestamp.
+ *
+ * @return false, leaving timestamp_us unchanged, when no batch frame has been
+ *         acknowledged since the last channel 1 reset or recovery.
+ */
+bool HW_CAN_Tx_Timestamp1( uint32_t* timestamp_us );
+
+/**
+ * @brief Returns the start of frame of the last acknowledged channel 2 batch frame.
+ *
+ * Taken from the mailbox timestamp and reported on the HW_TIMER_Get_Time_Us()
+ * time base. Direct sends raise no completion and are not reported; cyclic
+ * frames are reported through their statistics.
+ *
+ * @param timestamp_us  Destination for the timestamp.
+ *
+ * @return false, leaving timestamp_us unchanged, when no batch frame has been
+ *         acknowledged since the last channel 2 reset or recovery.
+ */
+bool HW_CAN_Tx_Timestamp2( uint32_t* timestamp_us );
+
 /**
  * @brief Calculates the required CAN timing properties.
  *
@@ -168,10 +244,12 @@ CanProperties_T HW_CAN_Compute_Properties( uint32_t bitrate, uint32_t total_TQ,
 /**
  * @brief Configures CAN channel 1.
  *
- * @param bitrate       Desired bitrate in bits per second.
- * @param filter_bank  CAN filter bank to configure.
- * @param filter_id    CAN standard identifier used by the filter.
- * @param filter_mask  CAN standard identifier filter mask.
+ * @param bitrate          Desired bitrate in bits per second.
+ * @param filter_bank      CAN filter bank to configure.
+ * @param filter_id        CAN identifier used by the filter.
+ * @param filter_mask      CAN identifier filter mask.
+ * @param filter_extended  true to match 29-bit extended frames, false to
+ *                         match standard 11-bit frames.
  *
  * @return Error code:
  *      0: no error, configuration complete
@@ -184,21 +262,27 @@ CanProperties_T HW_CAN_Compute_Properties( uint32_t bitrate, uint32_t total_TQ,
  *      - Time quanta in Bit Segment 1
  *      - Time quanta in Bit Segment 2
  *      - ReSynchronization Jump Width
- *      - Operating mode
+ *      - Operating mode, with time-triggered mode timestamps
  *      - Acceptance filter and mask
  *      - FIFO assignment
  *      - CAN interrupts
+ *
+ * The single filter uses the fixed 14/14 bank split and discards any channel
+ * 1 filter set. Install filter sets with HW_CAN_Set_Filters1/2 after both
+ * channels are configured.
  */
-int HW_CAN_Configure1( uint32_t bitrate, uint16_t filter_bank, uint16_t filter_id,
-                       uint16_t filter_mask );
+int HW_CAN_Configure1( uint32_t bitrate, uint16_t filter_bank, uint32_t filter_id,
+                       uint32_t filter_mask, bool filter_extended );
 
 /**
  * @brief Configures CAN channel 2.
  *
- * @param bitrate       Desired bitrate in bits per second.
- * @param filter_bank  CAN filter bank to configure.
- * @param filter_id    CAN standard identifier used by the filter.
- * @param filter_mask  CAN standard identifier filter mask.
+ * @param bitrate          Desired bitrate in bits per second.
+ * @param filter_bank      CAN filter bank to configure.
+ * @param filter_id        CAN identifier used by the filter.
+ * @param filter_mask      CAN identifier filter mask.
+ * @param filter_extended  true to match 29-bit extended frames, false to
+ *                         match standard 11-bit frames.
  *
  * @return Error code:
  *      0: no error, configuration complete
@@ -211,19 +295,65 @@ int HW_CAN_Configure1( uint32_t bitrate, uint16_t filter_bank, uint16_t filter_i
  *      - Time quanta in Bit Segment 1
  *      - Time quanta in Bit Segment 2
  *      - ReSynchronization Jump Width
- *      - Operating mode
+ *      - Operating mode, with time-triggered mode timestamps
  *      - Acceptance filter and mask
  *      - FIFO assignment
  *      - CAN interrupts
+ *
+ * The single filter uses the fixed 14/14 bank split and discards any channel
+ * 2 filter set. Install filter sets with HW_CAN_Set_Filters1/2 after both
+ * channels are configured.
+ */
+int HW_CAN_Configure2( uint32_t bitrate, uint16_t filter_bank, uint32_t filter_id,
+                       uint32_t filter_mask, bool filter_extended );
+
+/**
+ * @brief Installs the channel 1 filter set and re-packs the shared filter banks.
+ *
+ * All 28 filter banks are reprogrammed. Each channel gets the banks its filter
+ * set needs when both fit; otherwise the banks are split in proportion to
+ * need and entries are widened to fit. Frames that only pass a widened entry
+ * are checked against the filter set in the RX interrupt and discarded when
+ * they do not match. A channel with an empty filter set receives no frames.
+ *
+ * @param rules       Identifier ranges to accept. May be null when rule_count
+ *                    is zero.
+ * @param rule_count  Number of rules. Overlapping and adjacent ranges are
+ *                    merged and must leave at most HW_CAN_FILTER_MAX_RULES.
+ *
+ * @return HW_CAN_RESULT_OK when the banks were programmed, or
+ *         HW_CAN_RESULT_ERROR for an invalid rule set, which leaves the
+ *         previous filters in place, or a HAL filter failure.
+ */
+HW_CAN_Result_T HW_CAN_Set_Filters1( const HW_CAN_Filter_Rule_T rules[], uint16_t rule_count );
+
+/**
+ * @brief Installs the channel 2 filter set and re-packs the shared filter banks.
+ *
+ * See HW_CAN_Set_Filters1().
+ */
+HW_CAN_Result_T HW_CAN_Set_Filters2( const HW_CAN_Filter_Rule_T rules[], uint16_t rule_count );
+
+/**
+ * @brief Reports channel 1's filter banks and hardware/software filtered identifier counts.
+ *
+ * @param report  Destination for the report. Ignored when null.
  */
-int HW_CAN_Configure2( uint32_t bitrate, uint16_t filter_bank, uint16_t filter_id,
-                       uint16_t filter_mask );
+void HW_CAN_Get_Filter_Report1( HW_CAN_Filter_Report_T* report );
+
+/**
+ * @brief Reports channel 2's filter banks and hardware/software filtered identifier counts.
+ *
+ * @param report  Destination for the report. Ignored when null.
+ */
+void HW_CAN_Get_Filter_Report2( HW_CAN_Filter_Report_T* report );
 
 /**
  * @brief Clears all channel 1 software queue, transmission, and RX diagnostic state.
  *
  * The channel 1 TX and RX interrupts are masked while the state is reset and
- * restored to their previous enable state before this function returns.
+ * restored to their previous enable state before this function returns. A
+ * running cyclic schedule, auto-responder or log replay is stopped and emptied.
  */
 void HW_CAN_Reset1( void );
 
@@ -231,7 +361,8 @@ void HW_CAN_Reset1( void );
  * @brief Clears all channel 2 software queue, transmission, and RX diagnostic state.
  *
  * The channel 2 TX and RX interrupts are masked while the state is reset and
- * restored to their previous enable state before this function returns.
+ * restored to their previous enable state before this function returns. A
+ * running cyclic schedule, auto-responder or log replay is stopped and emptied.
  */
 void HW_CAN_Reset2( void );
 
@@ -239,7 +370,11 @@ void HW_CAN_Reset2( void );
  * @brief Recovers channel 1 from a transmit or bus error in task context.
  *
  * Outstanding hardware requests and queued software packets are discarded.
- * Successful recovery leaves the channel idle and ready for a new batch.
+ * Successful recovery leaves the channel idle and ready for a new batch. The
+ * aborted cyclic frame, response and replayed frame count as failed and queued
+ * responses are dropped; a running schedule carries on from its next tick, a
+ * running responder answers the next matching request and a running replay
+ * sends its next frame.
  */
 HW_CAN_Result_T HW_CAN_Recover1( void );
 
@@ -247,13 +382,19 @@ HW_CAN_Result_T HW_CAN_Recover1( void );
  * @brief Recovers channel 2 from a transmit or bus error in task context.
  *
  * Outstanding hardware requests and queued software packets are discarded.
- * Successful recovery leaves the channel idle and ready for a new batch.
+ * Successful recovery leaves the channel idle and ready for a new batch. The
+ * aborted cyclic frame, response and replayed frame count as failed and queued
+ * responses are dropped; a running schedule carries on from its next tick, a
+ * running responder answers the next matching request and a running replay
+ * sends its next frame.
  */
 HW_CAN_Result_T HW_CAN_Recover2( void );
 
 /**
  * @brief Receives a CAN packet on channel 1.
  *
+ * Polls FIFO0 first, then FIFO1.
+ *
  * @param rxPacket Pointer to the CAN packet where the received identifier
  *                 and data will be stored.
  *
@@ -266,18 +407,21 @@ int HW_CAN_Receive1( CAN_Packet_T* rxPacket );
 /**
  * @brief Transmits a CAN packet on channel 1.
  *
- * @param txData Pointer to payload data. May be null only when dlc is zero.
- * @param id     Standard 11-bit CAN identifier.
- * @param dlc    Number of valid payload bytes, from 0 through 8.
+ * @param txData    Pointer to payload data. May be null only when dlc is zero.
+ * @param id        Standard 11-bit or extended 29-bit CAN identifier.
+ * @param extended  true when id is a 29-bit extended identifier.
+ * @param dlc       Number of valid payload bytes, from 0 through 8.
  *
  * @return HW_CAN_RESULT_OK if loaded, HW_CAN_RESULT_BUSY while a buffered
  *         batch is active, or HW_CAN_RESULT_ERROR for invalid input/state.
  */
-HW_CAN_Result_T HW_CAN_Transmit1( uint8_t* txData, uint16_t id, uint8_t dlc );
+HW_CAN_Result_T HW_CAN_Transmit1( uint8_t* txData, uint32_t id, bool extended, uint8_t dlc );
 
 /**
  * @brief Receives a CAN packet on channel 2.
  *
+ * Polls FIFO0 first, then FIFO1.
+ *
  * @param rxPacket Pointer to the CAN packet where the received identifier
  *                 and data will be stored.
  *
@@ -290,14 +434,15 @@ int HW_CAN_Receive2( CAN_Packet_T* rxPacket );
 /**
  * @brief Transmits a CAN packet on channel 2.
  *
- * @param txData Pointer to payload data. May be null only when dlc is zero.
- * @param id     Standard 11-bit CAN identifier.
- * @param dlc    Number of valid payload bytes, from 0 through 8.
+ * @param txData    Pointer to payload data. May be null only when dlc is zero.
+ * @param id        Standard 11-bit or extended 29-bit CAN identifier.
+ * @param extended  true when id is a 29-bit extended identifier.
+ * @param dlc       Number of valid payload bytes, from 0 through 8.
  *
  * @return HW_CAN_RESULT_OK if loaded, HW_CAN_RESULT_BUSY while a buffered
  *         batch is active, or HW_CAN_RESULT_ERROR for invalid input/state.
  */
-HW_CAN_Result_T HW_CAN_Transmit2( uint8_t* txData, uint16_t id, uint8_t dlc );
+HW_CAN_Result_T HW_CAN_Transmit2( uint8_t* txData, uint32_t id, bool extended, uint8_t dlc );
 
 /**-----------------------------------------------------------------------------
  *  Channel 1 Buffer Functions
@@ -495,6 +640,245 @@ HW_CAN_Result_T HW_CAN_Tx_Trigger1( void );
  */
 HW_CAN_Result_T HW_CAN_Tx_Trigger2( void );
 
+/**-----------------------------------------------------------------------------
+ *  Cyclic Schedule Functions
+ *------------------------------------------------------------------------------
+ */
+
+/**
+ * @brief Starts transmitting a table of periodic frames on channel 1.
+ *
+ * The table is copied, so it need not outlive the call. While the schedule
+ * runs it owns TX mailbox 2; direct sends and batches use the other mailboxes.
+ * Frames are released from a shared 1 ms timer tick (TIM13) and sent in
+ * release order.
+ *
+ * @return HW_CAN_RESULT_OK once running,
+ *         HW_CAN_RESULT_BUSY while a schedule or log replay is running or its
+ *         last frame is still in flight, or
+ *         HW_CAN_RESULT_ERROR for a table rejected by HW_CAN_Cyclic_Load().
+ */
+HW_CAN_Result_T HW_CAN_Cyclic_Start1( const HW_CAN_Cyclic_Entry_T table[], uint16_t count );
+
+/**
+ * @brief Starts transmitting a table of periodic frames on channel 2.
+ *
+ * See HW_CAN_Cyclic_Start1().
+ */
+HW_CAN_Result_T HW_CAN_Cyclic_Start2( const HW_CAN_Cyclic_Entry_T table[], uint16_t count );
+
+/**
+ * @brief Stops releasing channel 1 cyclic frames.
+ *
+ * A frame already in the mailbox is allowed to finish, after which mailbox 2
+ * returns to batches. Statistics remain readable until the next start.
+ */
+void HW_CAN_Cyclic_Stop1( void );
+
+/** @brief Stops releasing channel 2 cyclic frames. See HW_CAN_Cyclic_Stop1(). */
+void HW_CAN_Cyclic_Stop2( void );
+
+/**
+ * @brief Replaces the payload of one channel 1 cyclic frame.
+ *
+ * The next release sends the new payload; the transmit path never waits on
+ * the update. Only one context may update channel 1 payloads.
+ *
+ * @param index  Position of the frame in the table passed to the start call.
+ *
+ * @return HW_CAN_RESULT_OK, or HW_CAN_RESULT_ERROR for an index outside the
+ *         table, a DLC above eight, or a null payload with a non-zero DLC.
+ */
+HW_CAN_Result_T HW_CAN_Cyclic_Update_Payload1( uint16_t index, const uint8_t data[], uint8_t dlc );
+
+/**
+ * @brief Replaces the payload of one channel 2 cyclic frame.
+ *
+ * See HW_CAN_Cyclic_Update_Payload1().
+ */
+HW_CAN_Result_T HW_CAN_Cyclic_Update_Payload2( uint16_t index, const uint8_t data[], uint8_t dlc );
+
+/**
+ * @brief Copies the timing statistics of one channel 1 cyclic frame.
+ *
+ * @return HW_CAN_RESULT_OK, or HW_CAN_RESULT_ERROR for an index outside the
+ *         table or a null destination.
+ */
+HW_CAN_Result_T HW_CAN_Cyclic_Get_Stats1( uint16_t index, HW_CAN_Cyclic_Stats_T* stats );
+
+/**
+ * @brief Copies the timing statistics of one channel 2 cyclic frame.
+ *
+ * See HW_CAN_Cyclic_Get_Stats1().
+ */
+HW_CAN_Result_T HW_CAN_Cyclic_Get_Stats2( uint16_t index, HW_CAN_Cyclic_Stats_T* stats );
+
+/**
+ * @brief Advances both channels' cyclic schedules by one tick.
+ *
+ * Called from the cyclic tick timer interrupt.
+ */
+void HW_CAN_Cyclic_Tick_From_ISR( void );
+
+/**-----------------------------------------------------------------------------
+ *  Auto-Responder Functions
+ *------------------------------------------------------------------------------
+ */
+
+/**
+ * @brief Starts answering requests on channel 1 from a response table.
+ *
+ * The table is copied, so it need not outlive the call. Each frame accepted by
+ * the channel's filters is looked up in the RX interrupt and a matching
+ * entry's response is loaded into TX mailbox 0 straight away, without passing
+ * through the RX queue or the execution tick. While the responder runs it owns
+ * mailbox 0; direct sends and batches use the other mailboxes. Matched frames
+ * are still stored in the RX queue as usual.
+ *
+ * @return HW_CAN_RESULT_OK once running,
+ *         HW_CAN_RESULT_BUSY while a responder is running or its last response
+ *         is still in flight, or
+ *         HW_CAN_RESULT_ERROR for a table rejected by HW_CAN_Responder_Load().
+ */
+HW_CAN_Result_T HW_CAN_Responder_Start1( const HW_CAN_Responder_Entry_T table[], uint16_t count );
+
+/**
+ * @brief Starts answering requests on channel 2 from a response table.
+ *
+ * See HW_CAN_Responder_Start1().
+ */
+HW_CAN_Result_T HW_CAN_Responder_Start2( const HW_CAN_Responder_Entry_T table[], uint16_t count );
+
+/**
+ * @brief Stops answering requests on channel 1.
+ *
+ * Queued responses are dropped. One already in the mailbox is allowed to
+ * finish, after which mailbox 0 returns to batches. Statistics remain
+ * readable until the next start.
+ */
+void HW_CAN_Responder_Stop1( void );
+
+/** @brief Stops answering requests on channel 2. See HW_CAN_Responder_Stop1(). */
+void HW_CAN_Responder_Stop2( void );
+
+/**
+ * @brief Copies the channel 1 responder's turnaround statistics.
+ *
+ * @return HW_CAN_RESULT_OK, or HW_CAN_RESULT_ERROR for a null destination.
+ */
+HW_CAN_Result_T HW_CAN_Responder_Get_Stats1( HW_CAN_Responder_Stats_T* stats );
+
+/**
+ * @brief Copies the channel 2 responder's turnaround statistics.
+ *
+ * See HW_CAN_Responder_Get_Stats1().
+ */
+HW_CAN_Result_T HW_CAN_Responder_Get_Stats2( HW_CAN_Responder_Stats_T* stats );
+
+/**-----------------------------------------------------------------------------
+ *  Log Replay Functions
+ *------------------------------------------------------------------------------
+ */
+
+/**
+ * @brief Starts replaying a compact CAN log on channel 1.
+ *
+ * The log is read in place and must stay unchanged until the replay ends or is
+ * stopped; it may be in RAM or in memory-mapped external flash. Each frame is
+ * loaded into TX mailbox 2 at its recorded offset from the start, scaled by
+ * time_scale, paced by a one-shot hardware timer (TIM1) rather than the
+ * execution tick. While the replay runs it owns mailbox 2 in the same way as a
+ * cyclic schedule, so the two cannot run together on one channel.
+ *
+ * @param time_scale  Gap multiplier in thousandths; see HW_CAN_Replay_Load().
+ * @param passes      Passes through the log, zero to loop until stopped.
+ *
+ * @return HW_CAN_RESULT_OK once running,
+ *         HW_CAN_RESULT_BUSY while a cyclic schedule or replay is running or
+ *         its last frame is still in flight, or
+ *         HW_CAN_RESULT_ERROR for a log or time scale rejected by
+ *         HW_CAN_Replay_Load().
+ */
+HW_CAN_Result_T HW_CAN_Replay_Start1( const uint8_t log[], uint32_t length, uint32_t time_scale,
+                                      uint32_t passes );
+
+/**
+ * @brief Starts replaying a compact CAN log on channel 2.
+ *
+ * See HW_CAN_Replay_Start1().
+ */
+HW_CAN_Result_T HW_CAN_Replay_Start2( const uint8_t log[], uint32_t length, uint32_t time_scale,
+                                      uint32_t passes );
+
+/**
+ * @brief Stops the channel 1 log replay.
+ *
+ * A frame already in the mailbox is allowed to finish, after which mailbox 2
+ * returns to batches. A replay that reaches the end of its last pass stops by
+ * itself. Statistics remain readable until the next start.
+ */
+void HW_CAN_Replay_Stop1( void );
+
+/** @brief Stops the channel 2 log replay. See HW_CAN_Replay_Stop1(). */
+void HW_CAN_Replay_Stop2( void );
+
+/**
+ * @brief Copies the channel 1 replay's progress and schedule error statistics.
+ *
+ * @return HW_CAN_RESULT_OK, or HW_CAN_RESULT_ERROR for a null destination.
+ */
+HW_CAN_Result_T HW_CAN_Replay_Get_Stats1( HW_CAN_Replay_Stats_T* stats );
+
+/**
+ * @brief Copies the channel 2 replay's progress and schedule error statistics.
+ *
+ * See HW_CAN_Replay_Get_Stats1().
+ */
+HW_CAN_Result_T HW_CAN_Replay_Get_Stats2( HW_CAN_Replay_Stats_T* stats );
+
+/**
+ * @brief Loads due replay frames on both channels and re-arms the replay timer.
+ *
+ * Called from the replay timer interrupt.
+ */
+void HW_CAN_Replay_Tick_From_ISR( void );
+
+/**-----------------------------------------------------------------------------
+ *  Bus Statistics Functions
+ *------------------------------------------------------------------------------
+ */
+
+/**
+ * @brief Copies channel 1's traffic, bus load, error and arbitration statistics.
+ *
+ * Counting starts when the channel is configured and runs with every feature,
+ * batches and direct sends included. The error counters are read from the
+ * controller at the call, and the call closes the rate window when it is due,
+ * so calling about once a second keeps the rates current. See
+ * HW_CAN_Bus_Stats_T for what each figure covers.
+ *
+ * @return HW_CAN_RESULT_OK, or HW_CAN_RESULT_ERROR for a null destination.
+ */
+HW_CAN_Result_T HW_CAN_Bus_Get_Stats1( HW_CAN_Bus_Stats_T* stats );
+
+/**
+ * @brief Copies channel 2's traffic, bus load, error and arbitration statistics.
+ *
+ * See HW_CAN_Bus_Get_Stats1().
+ */
+HW_CAN_Result_T HW_CAN_Bus_Get_Stats2( HW_CAN_Bus_Stats_T* stats );
+
+/**
+ * @brief Clears channel 1's bus statistics and starts a new rate window.
+ *
+ * The RX dropped-frame count returned by HW_CAN_Rx_Dropped_Count1() is not
+ * affected.
+ */
+void HW_CAN_Bus_Reset_Stats1( void );
+
+/** @brief Clears channel 2's bus statistics. See HW_CAN_Bus_Reset_Stats1(). */
+void HW_CAN_Bus_Reset_Stats2( void );
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,335 @@
+/******************************************************************************
+ *  File:       hw_can_cyclic.c
+ *  Author:     Timothy Vogelsang
+ *  Created:    18-Oct-2026
+ *
+ *  Description:
+ *      Implementation of the periodic CAN frame scheduler.
+ *
+ *  Notes:
+    The calendar is a timing wheel with one slot per tick. A frame due on tick
+    t sits in slot t % HW_CAN_CYCLIC_CALENDAR_SLOTS, so each tick only walks
+    the frames that can fall due on it instead of the whole table:
+
+        slot   0   1   2   3  ...  10  ...  20  ...
+               |           |        |        |
+               A           C        A        A
+               |                    |        |
+               B                    B        B
+
+    A frame whose period is longer than the calendar stays in its slot and is
+    skipped on the laps where its due tick has not come round yet.
+
+    A slot's list is not kept in table order. Frames due on a tick are marked
+    in a bitmap indexed by table position while the slot is walked, and the
+    bitmap is then scanned low bit first into the ready ring. Table order among
+    same-tick frames therefore costs one word per 32 table entries per tick,
+    with no sorting in the ISR.
+ ******************************************************************************/
+
+/**-----------------------------------------------------------------------------
+ *  Includes
+ *------------------------------------------------------------------------------
+ */
+
+#include "hw_can_cyclic.h"
+#include "hw_can.h"
+#include <stddef.h>
+#include <string.h>
+
+/**-----------------------------------------------------------------------------
+ *  Defines / Macros
+ *------------------------------------------------------------------------------
+ */
+
+#if HW_CAN_CYCLIC_PAYLOAD_SIZE != CAN_PACKET_SIZE
+#error "CAN cyclic payloads must match CAN_PACKET_SIZE"
+#endif
+
+#define HW_CAN_CYCLIC_SLOT_MASK ( HW_CAN_CYCLIC_CALENDAR_SLOTS - 1U )
+
+/* Words of the per-tick release bitmap, one bit per table entry. */
+#define HW_CAN_CYCLIC_RELEASE_WORDS ( ( HW_CAN_CYCLIC_MAX_MESSAGES + 31U ) / 32U )
+
+/* Keeps payload stores on the right side of the index flip and generation bump. */
+#define HW_CAN_CYCLIC_COMPILER_BARRIER() __asm volatile( "" ::: "memory" )
+
+/**-----------------------------------------------------------------------------
+ *  Private Function Definitions
+ *------------------------------------------------------------------------------
+ */
+
+static bool HW_CAN_Cyclic_Entry_Is_Valid( const HW_CAN_Cyclic_Entry_T* entry )
+{
+    uint32_t id_max = entry->extended ? CAN_EXTENDED_ID_MAX : CAN_STANDARD_ID_MAX;
+    return entry->id <= id_max && entry->dlc <= HW_CAN_CYCLIC_PAYLOAD_SIZE
+           && ( entry->dlc == 0U || entry->payload != NULL ) && entry->period_ms > 0U
+           && entry->phase_ms < entry->period_ms;
+}
+
+/** Push a frame onto the head of the calendar slot for its due tick. */
+static void HW_CAN_Cyclic_Schedule_Message( HW_CAN_Cyclic_Schedule_T* schedule, uint16_t index )
+{
+    uint16_t* slot = &schedule->calendar[schedule->messages[index].due_tick
+                                         & HW_CAN_CYCLIC_SLOT_MASK];
+
+    schedule->messages[index].next = *slot;
+    *slot                          = index;
+}
+
+/** Ring slot of the ready entry at a position counted from the head. */
+static uint16_t HW_CAN_Cyclic_Ready_Slot( const HW_CAN_Cyclic_Schedule_T* schedule,
+                                          uint16_t                        position )
+{
+    return ( uint16_t )( ( schedule->ready_head + position ) % HW_CAN_CYCLIC_MAX_MESSAGES );
+}
+
+/**
+ * Append the frames marked in a tick's release bitmap to the ready ring,
+ * lowest table index first, so the table order sets their send order.
+ */
+static void HW_CAN_Cyclic_Release( HW_CAN_Cyclic_Schedule_T* schedule,
+                                   const uint32_t            released[] )
+{
+    for ( uint16_t word = 0U; word < HW_CAN_CYCLIC_RELEASE_WORDS; word++ )
+    {
+        uint32_t bits = released[word];
+        while ( bits != 0U )
+        {
+            uint16_t index = ( uint16_t )( word * 32U + ( uint32_t )__builtin_ctz( bits ) );
+            bits &= bits - 1U;
+
+            schedule->ready[HW_CAN_Cyclic_Ready_Slot( schedule, schedule->ready_count )] = index;
+            schedule->ready_count++;
+        }
+    }
+}
+
+static uint32_t HW_CAN_Cyclic_To_Us( const HW_CAN_Cyclic_Schedule_T* schedule, uint32_t counts )
+{
+    return counts / schedule->counts_per_us;
+}
+
+/**-----------------------------------------------------------------------------
+ *  Public Function Definitions
+ *------------------------------------------------------------------------------
+ */
+
+bool HW_CAN_Cyclic_Load( HW_CAN_Cyclic_Schedule_T* schedule, const HW_CAN_Cyclic_Entry_T table[],
+                         uint16_t count, uint32_t counts_per_us )
+{
+    if ( schedule == NULL || ( table == NULL && count > 0U ) || count > HW_CAN_CYCLIC_MAX_MESSAGES )
+    {
+        return false;
+    }
+    for ( uint16_t i = 0U; i < count; i++ )
+    {
+        if ( !HW_CAN_Cyclic_Entry_Is_Valid( &table[i] ) )
+        {
+            return false;
+        }
+    }
+
+    HW_CAN_Cyclic_Clear( schedule );
+    schedule->counts_per_us = counts_per_us == 0U ? 1U : counts_per_us;
+    schedule->message_count = count;
+
+    for ( uint16_t i = 0U; i < count; i++ )
+    {
+        HW_CAN_Cyclic_Message_T* message = &schedule->messages[i];
+
+        message->id             = table[i].id;
+        message->extended       = table[i].extended;
+        message->period_ms      = table[i].period_ms;
+        message->due_tick       = table[i].phase_ms;
+        message->payload[0].dlc = table[i].dlc;
+        if ( table[i].dlc > 0U )
+        {
+            memcpy( message->payload[0].data, table[i].payload, table[i].dlc );
+        }
+
+        HW_CAN_Cyclic_Schedule_Message( schedule, i );
+    }
+
+    return true;
+}
+
+void HW_CAN_Cyclic_Clear( HW_CAN_Cyclic_Schedule_T* schedule )
+{
+    if ( schedule == NULL )
+    {
+        return;
+    }
+
+    memset( schedule->messages, 0, sizeof( schedule->messages ) );
+    memset( schedule->calendar, 0xFF, sizeof( schedule->calendar ) );
+    schedule->ready_head    = 0U;
+    schedule->ready_count   = 0U;
+    schedule->message_count = 0U;
+    schedule->in_flight     = HW_CAN_CYCLIC_NONE;
+    schedule->tick          = 0U;
+    schedule->counts_per_us = 1U;
+}
+
+void HW_CAN_Cyclic_Tick( HW_CAN_Cyclic_Schedule_T* schedule, uint32_t now )
+{
+    uint32_t  tick  = schedule->tick;
+    uint16_t* slot  = &schedule->calendar[tick & HW_CAN_CYCLIC_SLOT_MASK];
+    uint16_t  index = *slot;
+
+    uint32_t released[HW_CAN_CYCLIC_RELEASE_WORDS] = { 0U };
+
+    // Detach the slot so frames rescheduled onto it this tick are not walked again
+    *slot = HW_CAN_CYCLIC_NONE;
+
+    while ( index != HW_CAN_CYCLIC_NONE )
+    {
+        HW_CAN_Cyclic_Message_T* message = &schedule->messages[index];
+        uint16_t                 next    = message->next;
+
+        if ( message->due_tick == tick )
+        {
+            if ( message->queued )
+            {
+                // The previous instance is still waiting; never queue a frame twice
+                message->stats.missed++;
+                message->last_sent_valid = false;
+            }
+            else
+            {
+                released[index / 32U] |= 1U << ( index % 32U );
+                message->queued       = true;
+                message->release_time = now;
+            }
+            message->due_tick = tick + message->period_ms;
+        }
+
+        HW_CAN_Cyclic_Schedule_Message( schedule, index );
+        index = next;
+    }
+
+    HW_CAN_Cyclic_Release( schedule, released );
+    schedule->tick = tick + 1U;
+}
+
+uint16_t HW_CAN_Cyclic_Pop_Ready( HW_CAN_Cyclic_Schedule_T* schedule )
+{
+    if ( schedule->in_flight != HW_CAN_CYCLIC_NONE || schedule->ready_count == 0U )
+    {
+        return HW_CAN_CYCLIC_NONE;
+    }
+
+    uint16_t index       = schedule->ready[schedule->ready_head];
+    schedule->ready_head = HW_CAN_Cyclic_Ready_Slot( schedule, 1U );
+    schedule->ready_count--;
+    schedule->in_flight = index;
+    return index;
+}
+
+void HW_CAN_Cyclic_Complete( HW_CAN_Cyclic_Schedule_T* schedule, uint32_t now, bool sent )
+{
+    uint16_t index = schedule->in_flight;
+    if ( index == HW_CAN_CYCLIC_NONE )
+    {
+        return;
+    }
+
+    HW_CAN_Cyclic_Message_T* message = &schedule->messages[index];
+    HW_CAN_Cyclic_Stats_T*   stats   = &message->stats;
+
+    schedule->in_flight = HW_CAN_CYCLIC_NONE;
+    message->queued     = false;
+
+    if ( !sent )
+    {
+        stats->failed++;
+        message->last_sent_valid = false;
+        return;
+    }
+
+    uint32_t latency_us = HW_CAN_Cyclic_To_Us( schedule, now - message->release_time );
+    stats->sent++;
+    if ( stats->sent == 1U || latency_us < stats->min_latency_us )
+    {
+        stats->min_latency_us = latency_us;
+    }
+    if ( latency_us > stats->max_latency_us )
+    {
+        stats->max_latency_us = latency_us;
+    }
+
+    if ( message->last_sent_valid )
+    {
+        uint32_t interval_us = HW_CAN_Cyclic_To_Us( schedule, now - message->last_sent_time );
+        uint32_t period_us   = ( uint32_t )message->period_ms * HW_CAN_CYCLIC_TICK_US;
+        uint32_t error_us =
+            interval_us > period_us ? interval_us - period_us : period_us - interval_us;
+        if ( error_us > stats->max_period_error_us )
+        {
+            stats->max_period_error_us = error_us;
+        }
+    }
+
+    message->last_sent_time  = now;
+    message->last_sent_valid = true;
+}
+
+uint8_t HW_CAN_Cyclic_Read_Payload( const HW_CAN_Cyclic_Schedule_T* schedule, uint16_t index,
+                                    uint8_t data[] )
+{
+    const HW_CAN_Cyclic_Message_T* message = &schedule->messages[index];
+    uint32_t                       generation;
+    uint8_t                        dlc;
+
+    // An update that lands mid-copy bumps the generation; copy again from the new buffer
+    do
+    {
+        generation = message->payload_generation;
+        HW_CAN_CYCLIC_COMPILER_BARRIER();
+        const HW_CAN_Cyclic_Payload_T* payload = &message->payload[message->active_payload];
+        dlc                                    = payload->dlc;
+        memcpy( data, payload->data, HW_CAN_CYCLIC_PAYLOAD_SIZE );
+        HW_CAN_CYCLIC_COMPILER_BARRIER();
+    } while ( generation != message->payload_generation );
+
+    return dlc;
+}
+
+bool HW_CAN_Cyclic_Update_Payload( HW_CAN_Cyclic_Schedule_T* schedule, uint16_t index,
+                                   const uint8_t data[], uint8_t dlc )
+{
+    if ( schedule == NULL || index >= schedule->message_count || dlc > HW_CAN_CYCLIC_PAYLOAD_SIZE
+         || ( dlc > 0U && data == NULL ) )
+    {
+        return false;
+    }
+
+    HW_CAN_Cyclic_Message_T* message  = &schedule->messages[index];
+    uint8_t                  inactive = ( uint8_t )( message->active_payload ^ 1U );
+    HW_CAN_Cyclic_Payload_T* payload  = &message->payload[inactive];
+
+    memset( payload->data, 0, sizeof( payload->data ) );
+    if ( dlc > 0U )
+    {
+        memcpy( payload->data, data, dlc );
+    }
+    payload->dlc = dlc;
+
+    HW_CAN_CYCLIC_COMPILER_BARRIER();
+    message->active_payload = inactive;
+    HW_CAN_CYCLIC_COMPILER_BARRIER();
+    message->payload_generation++;
+    return true;
+}
+
+bool HW_CAN_Cyclic_Get_Stats( const HW_CAN_Cyclic_Schedule_T* schedule, uint16_t index,
+                              HW_CAN_Cyclic_Stats_T* stats )
+{
+    if ( schedule == NULL || stats == NULL || index >= schedule->message_count )
+    {
+        return false;
+    }
+
+    *stats = schedule->messages[index].stats;
+    return true;
+}
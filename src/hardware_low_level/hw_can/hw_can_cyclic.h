@@ -0,0 +1,280 @@
+/******************************************************************************
+ *  File:       hw_can_cyclic.h
+ *  Author:     Timothy Vogelsang
+ *  Created:    18-Oct-2026
+ *
+ *  Description:
+ *      Calendar-queue scheduler for periodic CAN frames.
+ *
+ *      Holds a table of periodic frames, releases each one on its period and
+ *      phase from a fixed tick, and keeps per-frame timing statistics. Frame
+ *      payloads are double buffered so a task can replace them while the
+ *      interrupts that transmit them keep running.
+ *
+ *  Notes:
+ *      The scheduler is pure logic and does not touch the peripheral. hw_can.c
+ *      drives the tick, loads released frames into the reserved transmit
+ *      mailbox and reports completions back with their timestamps.
+ ******************************************************************************/
+
+#ifndef HW_CAN_CYCLIC_H
+#define HW_CAN_CYCLIC_H
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/**-----------------------------------------------------------------------------
+ *  Includes
+ *------------------------------------------------------------------------------
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/**-----------------------------------------------------------------------------
+ *  Public Defines / Macros
+ *------------------------------------------------------------------------------
+ */
+
+/** Scheduler tick, in microseconds. Periods and phases are whole ticks. */
+#define HW_CAN_CYCLIC_TICK_US ( 1000U )
+
+/*
+ * Periodic frames held per channel; 128 per channel covers a few hundred IDs
+ * across both. Each frame costs about 80 bytes of RAM, about 10 KB per
+ * channel at the default; override with a compile definition to trade table
+ * size for memory.
+ */
+#ifndef HW_CAN_CYCLIC_MAX_MESSAGES
+#define HW_CAN_CYCLIC_MAX_MESSAGES ( 128U )
+#endif
+
+/*
+ * Calendar slots, one per tick. Periods longer than the calendar stay in
+ * their slot and are skipped on the laps where they are not due.
+ */
+#ifndef HW_CAN_CYCLIC_CALENDAR_SLOTS
+#define HW_CAN_CYCLIC_CALENDAR_SLOTS ( 128U )
+#endif
+
+/** Payload bytes held per frame; matches CAN_PACKET_SIZE. */
+#define HW_CAN_CYCLIC_PAYLOAD_SIZE ( 8U )
+
+/** Index value meaning "no frame". */
+#define HW_CAN_CYCLIC_NONE ( 0xFFFFU )
+
+// Frame indices are uint16_t with HW_CAN_CYCLIC_NONE reserved.
+#if HW_CAN_CYCLIC_MAX_MESSAGES < 1U || HW_CAN_CYCLIC_MAX_MESSAGES > 65534U
+#error "CAN cyclic table must hold 1 to 65534 frames"
+#endif
+
+#if HW_CAN_CYCLIC_CALENDAR_SLOTS < 1U                                                              \
+    || ( HW_CAN_CYCLIC_CALENDAR_SLOTS & ( HW_CAN_CYCLIC_CALENDAR_SLOTS - 1U ) ) != 0U
+#error "CAN cyclic calendar slot count must be a power of two"
+#endif
+
+/**-----------------------------------------------------------------------------
+ *  Public Typedefs / Enums / Structures
+ *------------------------------------------------------------------------------
+ */
+
+/**
+ * @brief One periodic frame in a cyclic schedule table.
+ *
+ * The frame is first released phase_ms ticks after the schedule starts and
+ * then every period_ms ticks. payload holds dlc bytes and is copied when the
+ * table is loaded; it may be null only when dlc is zero.
+ */
+typedef struct HW_CAN_Cyclic_Entry_T
+{
+    uint32_t       id;
+    const uint8_t* payload;
+    uint16_t       period_ms;
+    uint16_t       phase_ms;
+    uint8_t        dlc;
+    bool           extended;
+
+} HW_CAN_Cyclic_Entry_T;
+
+/**
+ * @brief Timing statistics for one periodic frame.
+ *
+ * Latency runs from the tick that released a frame to the completion time
+ * reported for it, so max_latency_us - min_latency_us is the release jitter.
+ * hw_can.c reports the frame's start of frame on the bus. max_period_error_us
+ * is the largest difference between the interval of two consecutive
+ * completions and the frame's period; intervals spanning a missed or failed
+ * release are not counted.
+ *
+ * missed counts releases skipped because the previous instance had not been
+ * sent yet. failed counts instances that completed without being
+ * acknowledged. The latency fields are zero until the first frame is sent.
+ */
+typedef struct HW_CAN_Cyclic_Stats_T
+{
+    uint32_t sent;
+    uint32_t missed;
+    uint32_t failed;
+    uint32_t min_latency_us;
+    uint32_t max_latency_us;
+    uint32_t max_period_error_us;
+
+} HW_CAN_Cyclic_Stats_T;
+
+/**
+ * @brief One payload buffer of a double-buffered frame.
+ */
+typedef struct HW_CAN_Cyclic_Payload_T
+{
+    uint8_t data[HW_CAN_CYCLIC_PAYLOAD_SIZE];
+    uint8_t dlc;
+
+} HW_CAN_Cyclic_Payload_T;
+
+/**
+ * @brief Scheduler state of one periodic frame.
+ *
+ * payload[active_payload] is the payload transmitted next. An update writes
+ * the other buffer, flips active_payload and then bumps payload_generation,
+ * so a reader that sees the generation unchanged across its copy has read one
+ * complete payload.
+ *
+ * queued is set from release until the transmit completes, so a frame is never
+ * waiting twice.
+ */
+typedef struct HW_CAN_Cyclic_Message_T
+{
+    uint32_t                id;
+    uint32_t                due_tick;
+    uint32_t                release_time;
+    uint32_t                last_sent_time;
+    HW_CAN_Cyclic_Payload_T payload[2];
+    volatile uint32_t       payload_generation;
+    volatile uint8_t        active_payload;
+    uint16_t                period_ms;
+    uint16_t                next;
+    bool                    extended;
+    bool                    queued;
+    bool                    last_sent_valid;
+    HW_CAN_Cyclic_Stats_T   stats;
+
+} HW_CAN_Cyclic_Message_T;
+
+/**
+ * @brief Cyclic schedule for one channel.
+ *
+ * calendar[tick % HW_CAN_CYCLIC_CALENDAR_SLOTS] heads a list, linked through
+ * next, of the frames that may fall due on that tick. Released frames wait in
+ * the ready ring until the mailbox is free; in_flight is the frame currently
+ * in the mailbox.
+ *
+ * Timestamps are raw counts of a free-running counter at counts_per_us.
+ */
+typedef struct HW_CAN_Cyclic_Schedule_T
+{
+    HW_CAN_Cyclic_Message_T messages[HW_CAN_CYCLIC_MAX_MESSAGES];
+    uint16_t                calendar[HW_CAN_CYCLIC_CALENDAR_SLOTS];
+    uint16_t                ready[HW_CAN_CYCLIC_MAX_MESSAGES];
+    uint16_t                ready_head;
+    uint16_t                ready_count;
+    uint16_t                message_count;
+    uint16_t                in_flight;
+    uint32_t                tick;
+    uint32_t                counts_per_us;
+
+} HW_CAN_Cyclic_Schedule_T;
+
+/**-----------------------------------------------------------------------------
+ *  Public Function Prototypes
+ *------------------------------------------------------------------------------
+ */
+
+/**
+ * @brief Validates a table and loads it into the schedule at tick zero.
+ *
+ * Statistics are cleared and nothing is ready or in flight afterwards.
+ *
+ * @param counts_per_us  Rate of the timestamps later passed to
+ *                       HW_CAN_Cyclic_Tick() and HW_CAN_Cyclic_Complete().
+ *                       Zero is treated as one.
+ *
+ * @return false, leaving the schedule unchanged, for a null table with a
+ *         non-zero count, more than HW_CAN_CYCLIC_MAX_MESSAGES entries, an
+ *         identifier that does not fit its format, a DLC above eight, a null
+ *         payload with a non-zero DLC, a zero period, or a phase not below
+ *         its period.
+ */
+bool HW_CAN_Cyclic_Load( HW_CAN_Cyclic_Schedule_T* schedule, const HW_CAN_Cyclic_Entry_T table[],
+                         uint16_t count, uint32_t counts_per_us );
+
+/** Empties the schedule, forgetting any frame in flight. */
+void HW_CAN_Cyclic_Clear( HW_CAN_Cyclic_Schedule_T* schedule );
+
+/**
+ * @brief Releases every frame due on the current tick, then advances the tick.
+ *
+ * Released frames join the ready ring, in table order among those released on
+ * this tick, and are rescheduled one period on. A frame still queued from an
+ * earlier release counts a miss instead.
+ *
+ * @param now  Timestamp of the tick, recorded as the release time.
+ */
+void HW_CAN_Cyclic_Tick( HW_CAN_Cyclic_Schedule_T* schedule, uint32_t now );
+
+/**
+ * @brief Takes the oldest released frame and marks it in flight.
+ *
+ * @return Frame index, or HW_CAN_CYCLIC_NONE when nothing is ready or a frame
+ *         is already in flight.
+ */
+uint16_t HW_CAN_Cyclic_Pop_Ready( HW_CAN_Cyclic_Schedule_T* schedule );
+
+/**
+ * @brief Records the completion of the frame in flight.
+ *
+ * Does nothing when no frame is in flight.
+ *
+ * @param now   Timestamp of the completion.
+ * @param sent  true when the frame was acknowledged on the bus.
+ */
+void HW_CAN_Cyclic_Complete( HW_CAN_Cyclic_Schedule_T* schedule, uint32_t now, bool sent );
+
+/**
+ * @brief Copies one frame's current payload.
+ *
+ * Safe against a concurrent HW_CAN_Cyclic_Update_Payload() at either higher
+ * or lower priority.
+ *
+ * @param data  Destination for HW_CAN_CYCLIC_PAYLOAD_SIZE bytes.
+ *
+ * @return The payload's DLC.
+ */
+uint8_t HW_CAN_Cyclic_Read_Payload( const HW_CAN_Cyclic_Schedule_T* schedule, uint16_t index,
+                                    uint8_t data[] );
+
+/**
+ * @brief Replaces one frame's payload without blocking the transmit path.
+ *
+ * Only one context may update a given schedule's payloads.
+ *
+ * @return false for an index outside the table, a DLC above eight, or a null
+ *         payload with a non-zero DLC.
+ */
+bool HW_CAN_Cyclic_Update_Payload( HW_CAN_Cyclic_Schedule_T* schedule, uint16_t index,
+                                   const uint8_t data[], uint8_t dlc );
+
+/**
+ * @brief Copies one frame's timing statistics.
+ *
+ * @return false for an index outside the table or a null destination.
+ */
+bool HW_CAN_Cyclic_Get_Stats( const HW_CAN_Cyclic_Schedule_T* schedule, uint16_t index,
+                              HW_CAN_Cyclic_Stats_T* stats );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HW_CAN_CYCLIC_H */
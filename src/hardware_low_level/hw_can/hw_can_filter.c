@@ -0,0 +1,729 @@
+/******************************************************************************
+ *  File:       hw_can_filter.c
+ *  Author:     Timothy Vogelsang
+ *  Created:    18-Oct-2026
+ *
+ *  Description:
+ *      Implementation of the bxCAN acceptance filter bank planner.
+ *
+ *  Notes:
+    Each bank holds one of four entry layouts:
+
+        16-bit list   4 identifiers     standard identifiers
+        16-bit mask   2 id/mask pairs   standard blocks, extended blocks of
+                                        2^15 or more identifiers
+        32-bit list   2 identifiers     extended identifiers
+        32-bit mask   1 id/mask pair    smaller extended blocks
+
+    Rules are split into the fewest aligned power-of-two blocks, so every
+    block is a single list entry or a single mask entry, and the blocks are
+    then packed into the cheapest mix of the four layouts.
+ ******************************************************************************/
+
+/**-----------------------------------------------------------------------------
+ *  Includes
+ *------------------------------------------------------------------------------
+ */
+
+#include "hw_can_filter.h"
+#include "hw_can.h"
+#include <stddef.h>
+#include <string.h>
+
+/**-----------------------------------------------------------------------------
+ *  Defines / Macros
+ *------------------------------------------------------------------------------
+ */
+
+/* 32-bit filter registers mirror RIR: STID at bit 21, STID:EXID at bit 3, then IDE and RTR. */
+#define HW_CAN_FILTER_STANDARD_SHIFT ( 21U )
+#define HW_CAN_FILTER_EXTENDED_SHIFT ( 3U )
+#define HW_CAN_FILTER_IDE ( 1U << 2 )
+#define HW_CAN_FILTER_RTR ( 1U << 1 )
+
+/* 16-bit filter halves hold STID[10:0] at bit 5, then RTR, IDE, and EXID[17:15]. */
+#define HW_CAN_FILTER_HALF_STID_SHIFT ( 5U )
+#define HW_CAN_FILTER_HALF_RTR ( 1U << 4 )
+#define HW_CAN_FILTER_HALF_IDE ( 1U << 3 )
+#define HW_CAN_FILTER_HALF_EXID_MASK ( 0x7U )
+#define HW_CAN_FILTER_EXTENDED_STID_SHIFT ( 18U )
+#define HW_CAN_FILTER_EXTENDED_EXID_SHIFT ( 15U )
+
+/* Extended blocks this wide only differ in the identifier bits a 16-bit half holds. */
+#define HW_CAN_FILTER_WIDE_EXTENDED_LOG2 ( 15U )
+
+#define HW_CAN_FILTER_STANDARD_ID_BITS ( 11U )
+#define HW_CAN_FILTER_EXTENDED_ID_BITS ( 29U )
+
+#define HW_CAN_FILTER_LIST16_SLOTS ( 4U )
+#define HW_CAN_FILTER_MASK16_SLOTS ( 2U )
+#define HW_CAN_FILTER_LIST32_SLOTS ( 2U )
+
+/**-----------------------------------------------------------------------------
+ *  Typedefs / Enums / Structures
+ *------------------------------------------------------------------------------
+ */
+
+/**
+ * Entries per bank layout, and how many standard identifiers were moved out
+ * of 16-bit list slots to fill spare slots in other banks.
+ */
+typedef struct HW_CAN_Filter_Layout_T
+{
+    uint16_t list16;
+    uint16_t mask16;
+    uint16_t list32;
+    uint16_t mask32;
+    uint16_t standard_to_mask16;
+    uint16_t standard_to_list32;
+    uint16_t bank_count;
+
+} HW_CAN_Filter_Layout_T;
+
+/** Slot kinds in bank order. */
+typedef enum HW_CAN_Filter_Slot_Kind_T
+{
+    HW_CAN_FILTER_SLOT_LIST16 = 0,
+    HW_CAN_FILTER_SLOT_MASK16,
+    HW_CAN_FILTER_SLOT_LIST32,
+    HW_CAN_FILTER_SLOT_MASK32,
+    HW_CAN_FILTER_SLOT_KIND_COUNT,
+} HW_CAN_Filter_Slot_Kind_T;
+
+/**-----------------------------------------------------------------------------
+ *  Private (static) Function Definitions
+ *------------------------------------------------------------------------------
+ */
+
+static uint32_t HW_CAN_Filter_Id_Max( bool extended )
+{
+    return extended ? CAN_EXTENDED_ID_MAX : CAN_STANDARD_ID_MAX;
+}
+
+static uint32_t HW_CAN_Filter_Entry_Size( const HW_CAN_Filter_Entry_T* entry )
+{
+    return ( uint32_t )1U << entry->size_log2;
+}
+
+static uint32_t HW_CAN_Filter_Entry_Last( const HW_CAN_Filter_Entry_T* entry )
+{
+    return entry->base + ( HW_CAN_Filter_Entry_Size( entry ) - 1U );
+}
+
+static bool HW_CAN_Filter_Entry_Contains( const HW_CAN_Filter_Entry_T* outer,
+                                          const HW_CAN_Filter_Entry_T* inner )
+{
+    return outer->extended == inner->extended && inner->base >= outer->base
+           && HW_CAN_Filter_Entry_Last( inner ) <= HW_CAN_Filter_Entry_Last( outer );
+}
+
+static bool HW_CAN_Filter_Is_Wide_Block( const HW_CAN_Filter_Entry_T* entry )
+{
+    return entry->size_log2 > 0U
+           && ( !entry->extended || entry->size_log2 >= HW_CAN_FILTER_WIDE_EXTENDED_LOG2 );
+}
+
+static uint16_t HW_CAN_Filter_Banks_For( uint16_t entries, uint16_t slots_per_bank )
+{
+    return ( uint16_t )( ( entries + slots_per_bank - 1U ) / slots_per_bank );
+}
+
+/**
+ * @brief Chooses the cheapest bank layout for the plan's entries.
+ *
+ * Standard identifiers normally share 16-bit list banks. Up to three may
+ * instead fill spare 16-bit mask slots, and one may fill a spare 32-bit list
+ * slot. Moving more never helps: four identifiers always fit one list bank.
+ */
+static HW_CAN_Filter_Layout_T HW_CAN_Filter_Layout( const HW_CAN_Filter_Plan_T* plan )
+{
+    uint16_t standard_ids    = 0U;
+    uint16_t extended_ids    = 0U;
+    uint16_t wide_blocks     = 0U;
+    uint16_t extended_blocks = 0U;
+
+    for ( uint16_t i = 0U; i < plan->entry_count; i++ )
+    {
+        const HW_CAN_Filter_Entry_T* entry = &plan->entries[i];
+        if ( HW_CAN_Filter_Is_Wide_Block( entry ) )
+        {
+            wide_blocks++;
+        }
+        else if ( entry->size_log2 > 0U )
+        {
+            extended_blocks++;
+        }
+        else if ( entry->extended )
+        {
+            extended_ids++;
+        }
+        else
+        {
+            standard_ids++;
+        }
+    }
+
+    HW_CAN_Filter_Layout_T best = { 0 };
+    best.bank_count             = UINT16_MAX;
+    for ( uint16_t to_list32 = 0U; to_list32 <= 1U && to_list32 <= standard_ids; to_list32++ )
+    {
+        for ( uint16_t to_mask16 = 0U; to_mask16 <= 3U && to_list32 + to_mask16 <= standard_ids;
+              to_mask16++ )
+        {
+            HW_CAN_Filter_Layout_T layout = {
+                .list16             = ( uint16_t )( standard_ids - to_list32 - to_mask16 ),
+                .mask16             = ( uint16_t )( wide_blocks + to_mask16 ),
+                .list32             = ( uint16_t )( extended_ids + to_list32 ),
+                .mask32             = extended_blocks,
+                .standard_to_mask16 = to_mask16,
+                .standard_to_list32 = to_list32,
+            };
+            layout.bank_count =
+                ( uint16_t )( HW_CAN_Filter_Banks_For( layout.list16, HW_CAN_FILTER_LIST16_SLOTS )
+                              + HW_CAN_Filter_Banks_For( layout.mask16, HW_CAN_FILTER_MASK16_SLOTS )
+                              + HW_CAN_Filter_Banks_For( layout.list32, HW_CAN_FILTER_LIST32_SLOTS )
+                              + layout.mask32 );
+            if ( layout.bank_count < best.bank_count )
+            {
+                best = layout;
+            }
+        }
+    }
+
+    return best;
+}
+
+/**
+ * @brief Widens the neighbouring same-format entries that add the fewest identifiers.
+ *
+ * The two entries are replaced by the smallest aligned block holding both,
+ * which also absorbs any other entries inside that block.
+ *
+ * @return false if no two neighbouring entries share a format.
+ */
+static bool HW_CAN_Filter_Widen_Cheapest( HW_CAN_Filter_Plan_T* plan )
+{
+    bool                  found      = false;
+    uint32_t              best_waste = 0U;
+    uint16_t              best_first = 0U;
+    uint16_t              best_last  = 0U;
+    HW_CAN_Filter_Entry_T best_block = { 0 };
+
+    for ( uint16_t i = 0U; i + 1U < plan->entry_count; i++ )
+    {
+        const HW_CAN_Filter_Entry_T* low  = &plan->entries[i];
+        const HW_CAN_Filter_Entry_T* high = &plan->entries[i + 1U];
+        if ( low->extended != high->extended )
+        {
+            continue;
+        }
+
+        uint32_t first_id  = low->base;
+        uint32_t last_id   = HW_CAN_Filter_Entry_Last( high );
+        uint8_t  size_log2 = 0U;
+        while ( ( first_id >> size_log2 ) != ( last_id >> size_log2 ) )
+        {
+            size_log2++;
+        }
+
+        HW_CAN_Filter_Entry_T block = {
+            .base      = first_id & ~( ( ( uint32_t )1U << size_log2 ) - 1U ),
+            .size_log2 = size_log2,
+            .extended  = low->extended,
+        };
+
+        uint16_t first = i;
+        uint16_t last  = ( uint16_t )( i + 1U );
+        while ( first > 0U && HW_CAN_Filter_Entry_Contains( &block, &plan->entries[first - 1U] ) )
+        {
+            first--;
+        }
+        while ( last + 1U < plan->entry_count
+                && HW_CAN_Filter_Entry_Contains( &block, &plan->entries[last + 1U] ) )
+        {
+            last++;
+        }
+
+        uint32_t covered = 0U;
+        for ( uint16_t j = first; j <= last; j++ )
+        {
+            covered += HW_CAN_Filter_Entry_Size( &plan->entries[j] );
+        }
+
+        uint32_t waste = HW_CAN_Filter_Entry_Size( &block ) - covered;
+        if ( !found || waste < best_waste )
+        {
+            found      = true;
+            best_waste = waste;
+            best_first = first;
+            best_last  = last;
+            best_block = block;
+        }
+    }
+
+    if ( !found )
+    {
+        return false;
+    }
+
+    plan->entries[best_first] = best_block;
+    memmove( &plan->entries[best_first + 1U], &plan->entries[best_last + 1U],
+             ( size_t )( plan->entry_count - best_last - 1U ) * sizeof( plan->entries[0] ) );
+    plan->entry_count = ( uint16_t )( plan->entry_count - ( best_last - best_first ) );
+    return true;
+}
+
+/**
+ * @brief Appends one block after the entries already decomposed.
+ *
+ * When the entry table is full the cheapest neighbours are widened first. A
+ * block already inside the last (widened) entry is absorbed.
+ */
+static bool HW_CAN_Filter_Append( HW_CAN_Filter_Plan_T* plan, HW_CAN_Filter_Entry_T entry )
+{
+    for ( ;; )
+    {
+        if ( plan->entry_count > 0U
+             && HW_CAN_Filter_Entry_Contains( &plan->entries[plan->entry_count - 1U], &entry ) )
+        {
+            return true;
+        }
+        if ( plan->entry_count < HW_CAN_FILTER_MAX_ENTRIES )
+        {
+            break;
+        }
+        if ( !HW_CAN_Filter_Widen_Cheapest( plan ) )
+        {
+            return false;
+        }
+    }
+
+    plan->entries[plan->entry_count] = entry;
+    plan->entry_count++;
+    return true;
+}
+
+/** Splits every rule into the fewest aligned power-of-two blocks. */
+static bool HW_CAN_Filter_Decompose( HW_CAN_Filter_Plan_T* plan )
+{
+    plan->entry_count = 0U;
+
+    for ( uint16_t i = 0U; i < plan->rule_count; i++ )
+    {
+        const HW_CAN_Filter_Rule_T* rule = &plan->rules[i];
+        uint8_t                     id_bits =
+            rule->extended ? HW_CAN_FILTER_EXTENDED_ID_BITS : HW_CAN_FILTER_STANDARD_ID_BITS;
+        uint32_t id = rule->first_id;
+
+        for ( ;; )
+        {
+            uint8_t size_log2 = 0U;
+            while ( size_log2 < id_bits )
+            {
+                uint32_t next_size = ( uint32_t )1U << ( size_log2 + 1U );
+                if ( ( id & ( next_size - 1U ) ) != 0U || rule->last_id - id < next_size - 1U )
+                {
+                    break;
+                }
+                size_log2++;
+            }
+
+            HW_CAN_Filter_Entry_T entry = {
+                .base      = id,
+                .size_log2 = size_log2,
+                .extended  = rule->extended,
+            };
+            if ( !HW_CAN_Filter_Append( plan, entry ) )
+            {
+                return false;
+            }
+
+            uint32_t block_last = HW_CAN_Filter_Entry_Last( &entry );
+            if ( block_last >= rule->last_id )
+            {
+                break;
+            }
+            id = block_last + 1U;
+        }
+    }
+
+    return true;
+}
+
+/** Counts accepted identifiers behind exact entries and behind widened entries. */
+static void HW_CAN_Filter_Count_Ids( HW_CAN_Filter_Plan_T* plan )
+{
+    plan->hardware_ids = 0U;
+    plan->software_ids = 0U;
+
+    for ( uint16_t i = 0U; i < plan->entry_count; i++ )
+    {
+        const HW_CAN_Filter_Entry_T* entry      = &plan->entries[i];
+        uint32_t                     entry_last = HW_CAN_Filter_Entry_Last( entry );
+        uint32_t                     covered    = 0U;
+
+        for ( uint16_t j = 0U; j < plan->rule_count; j++ )
+        {
+            const HW_CAN_Filter_Rule_T* rule = &plan->rules[j];
+            if ( rule->extended != entry->extended )
+            {
+                continue;
+            }
+
+            uint32_t first = rule->first_id > entry->base ? rule->first_id : entry->base;
+            uint32_t last  = rule->last_id < entry_last ? rule->last_id : entry_last;
+            if ( first <= last )
+            {
+                covered += last - first + 1U;
+            }
+        }
+
+        if ( covered == HW_CAN_Filter_Entry_Size( entry ) )
+        {
+            plan->hardware_ids += covered;
+        }
+        else
+        {
+            plan->software_ids += covered;
+        }
+    }
+}
+
+/** One bank per identifier format in use is always enough once entries are widened. */
+static uint8_t HW_CAN_Filter_Min_Banks( const HW_CAN_Filter_Plan_T* plan )
+{
+    bool standard = false;
+    bool extended = false;
+
+    for ( uint16_t i = 0U; i < plan->rule_count; i++ )
+    {
+        if ( plan->rules[i].extended )
+        {
+            extended = true;
+        }
+        else
+        {
+            standard = true;
+        }
+    }
+
+    return ( uint8_t )( ( standard ? 1U : 0U ) + ( extended ? 1U : 0U ) );
+}
+
+/**
+ * @brief Inserts one rule in (format, first_id) order.
+ *
+ * Stored ranges that overlap or touch the new rule are merged into it first.
+ */
+static bool HW_CAN_Filter_Insert_Rule( HW_CAN_Filter_Rule_T rules[], uint16_t* rule_count,
+                                       HW_CAN_Filter_Rule_T rule )
+{
+    uint16_t index = 0U;
+    while ( index < *rule_count )
+    {
+        const HW_CAN_Filter_Rule_T* stored = &rules[index];
+        if ( stored->extended == rule.extended && stored->first_id <= rule.last_id + 1U
+             && rule.first_id <= stored->last_id + 1U )
+        {
+            rule.first_id = stored->first_id < rule.first_id ? stored->first_id : rule.first_id;
+            rule.last_id  = stored->last_id > rule.last_id ? stored->last_id : rule.last_id;
+            memmove( &rules[index], &rules[index + 1U],
+                     ( size_t )( *rule_count - index - 1U ) * sizeof( rules[0] ) );
+            ( *rule_count )--;
+        }
+        else
+        {
+            index++;
+        }
+    }
+
+    if ( *rule_count >= HW_CAN_FILTER_MAX_RULES )
+    {
+        return false;
+    }
+
+    index = 0U;
+    while ( index < *rule_count
+            && ( ( !rules[index].extended && rule.extended )
+                 || ( rules[index].extended == rule.extended
+                      && rules[index].first_id < rule.first_id ) ) )
+    {
+        index++;
+    }
+
+    memmove( &rules[index + 1U], &rules[index],
+             ( size_t )( *rule_count - index ) * sizeof( rules[0] ) );
+    rules[index] = rule;
+    ( *rule_count )++;
+    return true;
+}
+
+/** 16-bit half holding an identifier and its IDE bit, with RTR clear. */
+static uint16_t HW_CAN_Filter_Half( uint32_t id, bool extended )
+{
+    if ( !extended )
+    {
+        return ( uint16_t )( id << HW_CAN_FILTER_HALF_STID_SHIFT );
+    }
+
+    uint32_t stid = id >> HW_CAN_FILTER_EXTENDED_STID_SHIFT;
+    uint32_t exid = ( id >> HW_CAN_FILTER_EXTENDED_EXID_SHIFT ) & HW_CAN_FILTER_HALF_EXID_MASK;
+    return ( uint16_t )( ( stid << HW_CAN_FILTER_HALF_STID_SHIFT ) | HW_CAN_FILTER_HALF_IDE
+                         | exid );
+}
+
+/** 16-bit mask half comparing the entry's fixed identifier bits, IDE, and RTR. */
+static uint16_t HW_CAN_Filter_Mask_Half( const HW_CAN_Filter_Entry_T* entry )
+{
+    uint32_t id_mask = ~( HW_CAN_Filter_Entry_Size( entry ) - 1U )
+                       & HW_CAN_Filter_Id_Max( entry->extended );
+
+    /* Standard frames have no EXID bits, so those stay don't-care. */
+    return ( uint16_t )( HW_CAN_Filter_Half( id_mask, entry->extended ) | HW_CAN_FILTER_HALF_RTR
+                         | HW_CAN_FILTER_HALF_IDE );
+}
+
+/** 32-bit word holding an identifier and its IDE bit, with RTR clear. */
+static uint32_t HW_CAN_Filter_Word( uint32_t id, bool extended )
+{
+    return extended ? ( id << HW_CAN_FILTER_EXTENDED_SHIFT ) | HW_CAN_FILTER_IDE
+                    : id << HW_CAN_FILTER_STANDARD_SHIFT;
+}
+
+/** 32-bit mask word comparing the entry's fixed identifier bits, IDE, and RTR. */
+static uint32_t HW_CAN_Filter_Mask_Word( const HW_CAN_Filter_Entry_T* entry )
+{
+    uint32_t id_mask = ~( HW_CAN_Filter_Entry_Size( entry ) - 1U )
+                       & HW_CAN_Filter_Id_Max( entry->extended );
+
+    return HW_CAN_Filter_Word( id_mask, entry->extended ) | HW_CAN_FILTER_IDE | HW_CAN_FILTER_RTR;
+}
+
+/**
+ * @brief Writes one slot of a bank.
+ *
+ * The first slot written to a bank is copied into every slot, so unused slots
+ * repeat an accepted entry instead of accepting identifier zero.
+ */
+static void HW_CAN_Filter_Put_Slot( HW_CAN_Filter_Bank_T* bank, uint16_t slot, uint32_t value,
+                                    uint16_t slots_per_bank )
+{
+    if ( slot == 0U )
+    {
+        uint32_t repeated = slots_per_bank == HW_CAN_FILTER_LIST16_SLOTS ? ( value << 16 ) | value
+                                                                          : value;
+        bank->fr1 = repeated;
+        bank->fr2 = repeated;
+        return;
+    }
+
+    if ( slots_per_bank == HW_CAN_FILTER_LIST16_SLOTS )
+    {
+        uint32_t* reg   = slot < 2U ? &bank->fr1 : &bank->fr2;
+        uint32_t  shift = ( slot & 1U ) != 0U ? 16U : 0U;
+        *reg = ( *reg & ~( 0xFFFFU << shift ) ) | ( value << shift );
+    }
+    else
+    {
+        bank->fr2 = value;
+    }
+}
+
+/**-----------------------------------------------------------------------------
+ *  Public Function Definitions
+ *------------------------------------------------------------------------------
+ */
+
+bool HW_CAN_Filter_Set_Rules( HW_CAN_Filter_Plan_T* plan, const HW_CAN_Filter_Rule_T rules[],
+                              uint16_t rule_count )
+{
+    if ( plan == NULL || ( rules == NULL && rule_count > 0U ) )
+    {
+        return false;
+    }
+
+    HW_CAN_Filter_Rule_T normalised[HW_CAN_FILTER_MAX_RULES];
+    uint16_t             normalised_count = 0U;
+    for ( uint16_t i = 0U; i < rule_count; i++ )
+    {
+        if ( rules[i].first_id > rules[i].last_id
+             || rules[i].last_id > HW_CAN_Filter_Id_Max( rules[i].extended )
+             || !HW_CAN_Filter_Insert_Rule( normalised, &normalised_count, rules[i] ) )
+        {
+            return false;
+        }
+    }
+
+    memcpy( plan->rules, normalised, ( size_t )normalised_count * sizeof( normalised[0] ) );
+    plan->rule_count   = normalised_count;
+    plan->entry_count  = 0U;
+    plan->bank_count   = 0U;
+    plan->hardware_ids = 0U;
+    plan->software_ids = 0U;
+    return true;
+}
+
+bool HW_CAN_Filter_Pack( HW_CAN_Filter_Plan_T* plan, uint8_t bank_budget )
+{
+    if ( plan == NULL || bank_budget < HW_CAN_Filter_Min_Banks( plan )
+         || !HW_CAN_Filter_Decompose( plan ) )
+    {
+        return false;
+    }
+
+    HW_CAN_Filter_Layout_T layout = HW_CAN_Filter_Layout( plan );
+    while ( layout.bank_count > bank_budget )
+    {
+        if ( !HW_CAN_Filter_Widen_Cheapest( plan ) )
+        {
+            return false;
+        }
+        layout = HW_CAN_Filter_Layout( plan );
+    }
+
+    plan->bank_count = ( uint8_t )layout.bank_count;
+    HW_CAN_Filter_Count_Ids( plan );
+    return true;
+}
+
+uint8_t HW_CAN_Filter_Allocate( HW_CAN_Filter_Plan_T* can1_plan, HW_CAN_Filter_Plan_T* can2_plan )
+{
+    ( void )HW_CAN_Filter_Pack( can1_plan, HW_CAN_FILTER_UNLIMITED_BANKS );
+    ( void )HW_CAN_Filter_Pack( can2_plan, HW_CAN_FILTER_UNLIMITED_BANKS );
+
+    uint16_t can1_need  = can1_plan->bank_count;
+    uint16_t can2_need  = can2_plan->bank_count;
+    uint16_t can1_banks = can1_need;
+
+    if ( can1_need + can2_need > HW_CAN_FILTER_BANK_COUNT )
+    {
+        uint16_t can1_min = HW_CAN_Filter_Min_Banks( can1_plan );
+        uint16_t can2_min = HW_CAN_Filter_Min_Banks( can2_plan );
+        uint16_t total    = ( uint16_t )( can1_need + can2_need );
+
+        can1_banks = ( uint16_t )( ( HW_CAN_FILTER_BANK_COUNT * can1_need + total / 2U ) / total );
+        if ( can1_banks < can1_min )
+        {
+            can1_banks = can1_min;
+        }
+        if ( can1_banks > HW_CAN_FILTER_BANK_COUNT - can2_min )
+        {
+            can1_banks = ( uint16_t )( HW_CAN_FILTER_BANK_COUNT - can2_min );
+        }
+    }
+
+    /* The CAN2 start bank must stay below 28, so CAN2 always owns the last bank. */
+    if ( can1_banks > HW_CAN_FILTER_BANK_COUNT - 1U )
+    {
+        can1_banks = HW_CAN_FILTER_BANK_COUNT - 1U;
+    }
+
+    ( void )HW_CAN_Filter_Pack( can1_plan, ( uint8_t )can1_banks );
+    ( void )HW_CAN_Filter_Pack( can2_plan, ( uint8_t )( HW_CAN_FILTER_BANK_COUNT - can1_banks ) );
+    return ( uint8_t )can1_banks;
+}
+
+uint8_t HW_CAN_Filter_Build_Banks( const HW_CAN_Filter_Plan_T* plan, HW_CAN_Filter_Bank_T banks[] )
+{
+    HW_CAN_Filter_Layout_T layout = HW_CAN_Filter_Layout( plan );
+
+    /* Banks are laid out as 16-bit list, 16-bit mask, 32-bit list, then 32-bit mask. */
+    uint16_t mask16_first = HW_CAN_Filter_Banks_For( layout.list16, HW_CAN_FILTER_LIST16_SLOTS );
+    uint16_t list32_first =
+        ( uint16_t )( mask16_first
+                      + HW_CAN_Filter_Banks_For( layout.mask16, HW_CAN_FILTER_MASK16_SLOTS ) );
+    uint16_t mask32_first =
+        ( uint16_t )( list32_first
+                      + HW_CAN_Filter_Banks_For( layout.list32, HW_CAN_FILTER_LIST32_SLOTS ) );
+
+    for ( uint16_t i = 0U; i < layout.bank_count; i++ )
+    {
+        banks[i].list_mode   = i < mask16_first || ( i >= list32_first && i < mask32_first );
+        banks[i].scale_32bit = i >= list32_first;
+    }
+
+    uint16_t used[HW_CAN_FILTER_SLOT_KIND_COUNT] = { 0U };
+    uint16_t standard_to_mask16                  = 0U;
+    uint16_t standard_to_list32                  = 0U;
+
+    for ( uint16_t i = 0U; i < plan->entry_count; i++ )
+    {
+        const HW_CAN_Filter_Entry_T* entry = &plan->entries[i];
+        HW_CAN_Filter_Slot_Kind_T    kind  = HW_CAN_FILTER_SLOT_MASK32;
+
+        if ( !entry->extended && entry->size_log2 == 0U )
+        {
+            if ( standard_to_list32 < layout.standard_to_list32 )
+            {
+                standard_to_list32++;
+                kind = HW_CAN_FILTER_SLOT_LIST32;
+            }
+            else if ( standard_to_mask16 < layout.standard_to_mask16 )
+            {
+                standard_to_mask16++;
+                kind = HW_CAN_FILTER_SLOT_MASK16;
+            }
+            else
+            {
+                kind = HW_CAN_FILTER_SLOT_LIST16;
+            }
+        }
+        else if ( entry->size_log2 == 0U )
+        {
+            kind = HW_CAN_FILTER_SLOT_LIST32;
+        }
+        else if ( HW_CAN_Filter_Is_Wide_Block( entry ) )
+        {
+            kind = HW_CAN_FILTER_SLOT_MASK16;
+        }
+
+        uint16_t slot = used[kind];
+        used[kind]++;
+
+        switch ( kind )
+        {
+            case HW_CAN_FILTER_SLOT_LIST16:
+                HW_CAN_Filter_Put_Slot( &banks[slot / HW_CAN_FILTER_LIST16_SLOTS],
+                                        slot % HW_CAN_FILTER_LIST16_SLOTS,
+                                        HW_CAN_Filter_Half( entry->base, entry->extended ),
+                                        HW_CAN_FILTER_LIST16_SLOTS );
+                break;
+            case HW_CAN_FILTER_SLOT_MASK16:
+                HW_CAN_Filter_Put_Slot(
+                    &banks[mask16_first + slot / HW_CAN_FILTER_MASK16_SLOTS],
+                    slot % HW_CAN_FILTER_MASK16_SLOTS,
+                    ( ( uint32_t )HW_CAN_Filter_Mask_Half( entry ) << 16 )
+                        | HW_CAN_Filter_Half( entry->base, entry->extended ),
+                    HW_CAN_FILTER_MASK16_SLOTS );
+                break;
+            case HW_CAN_FILTER_SLOT_LIST32:
+                HW_CAN_Filter_Put_Slot( &banks[list32_first + slot / HW_CAN_FILTER_LIST32_SLOTS],
+                                        slot % HW_CAN_FILTER_LIST32_SLOTS,
+                                        HW_CAN_Filter_Word( entry->base, entry->extended ),
+                                        HW_CAN_FILTER_LIST32_SLOTS );
+                break;
+            case HW_CAN_FILTER_SLOT_MASK32:
+            case HW_CAN_FILTER_SLOT_KIND_COUNT:
+            default:
+                banks[mask32_first + slot].fr1 = HW_CAN_Filter_Word( entry->base, entry->extended );
+                banks[mask32_first + slot].fr2 = HW_CAN_Filter_Mask_Word( entry );
+                break;
+        }
+    }
+
+    return ( uint8_t )layout.bank_count;
+}
+
+bool HW_CAN_Filter_Accepts( const HW_CAN_Filter_Plan_T* plan, uint32_t id, bool extended )
+{
+    for ( uint16_t i = 0U; i < plan->rule_count; i++ )
+    {
+        const HW_CAN_Filter_Rule_T* rule = &plan->rules[i];
+        if ( rule->extended == extended && id >= rule->first_id && id <= rule->last_id )
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
@@ -0,0 +1,197 @@
+/******************************************************************************
+ *  File:       hw_can_filter.h
+ *  Author:     Timothy Vogelsang
+ *  Created:    18-Oct-2026
+ *
+ *  Description:
+ *      bxCAN acceptance filter bank planner.
+ *
+ *      Packs per-channel sets of identifiers and identifier ranges into the
+ *      28 filter banks shared by CAN1 and CAN2, using 16-bit and 32-bit list
+ *      and mask entries, and splits the banks between the two channels.
+ *
+ *  Notes:
+ *      The planner is pure logic and does not touch the peripheral. hw_can.c
+ *      programs the banks it produces and applies the software check for
+ *      entries that had to be widened to fit the available banks.
+ ******************************************************************************/
+
+#ifndef HW_CAN_FILTER_H
+#define HW_CAN_FILTER_H
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/**-----------------------------------------------------------------------------
+ *  Includes
+ *------------------------------------------------------------------------------
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/**-----------------------------------------------------------------------------
+ *  Public Defines / Macros
+ *------------------------------------------------------------------------------
+ */
+
+/** Filter banks shared by CAN1 and CAN2. */
+#define HW_CAN_FILTER_BANK_COUNT ( 28U )
+/** Identifier ranges held per channel after overlapping ranges are merged. */
+#define HW_CAN_FILTER_MAX_RULES ( 16U )
+/** Hardware entries held per channel: four 16-bit list entries in every bank. */
+#define HW_CAN_FILTER_MAX_ENTRIES ( 4U * HW_CAN_FILTER_BANK_COUNT )
+/** Bank budget that never forces a plan to widen its entries. */
+#define HW_CAN_FILTER_UNLIMITED_BANKS ( 0xFFU )
+
+/**-----------------------------------------------------------------------------
+ *  Public Typedefs / Enums / Structures
+ *------------------------------------------------------------------------------
+ */
+
+/**
+ * @brief Inclusive range of identifiers accepted by one channel.
+ *
+ * A single identifier uses first_id == last_id. Both ends must fit the
+ * standard 11-bit or extended 29-bit format selected by extended.
+ */
+typedef struct HW_CAN_Filter_Rule_T
+{
+    uint32_t first_id;
+    uint32_t last_id;
+    bool     extended;
+
+} HW_CAN_Filter_Rule_T;
+
+/**
+ * @brief One hardware filter entry: an aligned block of 2^size_log2 identifiers.
+ *
+ * A size_log2 of zero is a single identifier and is placed in a list slot.
+ * Larger blocks are placed in mask slots.
+ */
+typedef struct HW_CAN_Filter_Entry_T
+{
+    uint32_t base;
+    uint8_t  size_log2;
+    bool     extended;
+
+} HW_CAN_Filter_Entry_T;
+
+/**
+ * @brief Register image of one filter bank.
+ *
+ * fr1 and fr2 hold the FxR1/FxR2 values in the reference-manual layout. In
+ * 16-bit scale each register holds two halves: list mode stores four
+ * identifiers, mask mode stores an identifier in the low half and its mask
+ * in the high half.
+ */
+typedef struct HW_CAN_Filter_Bank_T
+{
+    uint32_t fr1;
+    uint32_t fr2;
+    bool     list_mode;
+    bool     scale_32bit;
+
+} HW_CAN_Filter_Bank_T;
+
+/**
+ * @brief Filter plan for one channel.
+ *
+ * rules holds the normalised rule set, sorted with standard ranges first and
+ * with overlapping or adjacent ranges merged. entries holds the packed
+ * hardware entries.
+ *
+ * hardware_ids counts accepted identifiers covered by exact entries.
+ * software_ids counts accepted identifiers covered by entries that were
+ * widened to fit the bank budget; frames passing those entries must be
+ * checked against rules in software.
+ */
+typedef struct HW_CAN_Filter_Plan_T
+{
+    HW_CAN_Filter_Rule_T  rules[HW_CAN_FILTER_MAX_RULES];
+    uint16_t              rule_count;
+    HW_CAN_Filter_Entry_T entries[HW_CAN_FILTER_MAX_ENTRIES];
+    uint16_t              entry_count;
+    uint8_t               bank_count;
+    uint32_t              hardware_ids;
+    uint32_t              software_ids;
+
+} HW_CAN_Filter_Plan_T;
+
+/**
+ * @brief Filter bank allocation reported for one channel.
+ */
+typedef struct HW_CAN_Filter_Report_T
+{
+    uint8_t  first_bank;
+    uint8_t  bank_count;
+    uint32_t hardware_ids;
+    uint32_t software_ids;
+
+} HW_CAN_Filter_Report_T;
+
+/**-----------------------------------------------------------------------------
+ *  Public Function Prototypes
+ *------------------------------------------------------------------------------
+ */
+
+/**
+ * @brief Validates and normalises a channel's rule set into a plan.
+ *
+ * Any previous packing result is cleared. A null rule array is accepted only
+ * with a zero count, which leaves the channel without filter entries.
+ *
+ * @return false, leaving the plan unchanged, when a rule is inverted or does
+ *         not fit its identifier format, or when the merged set has more than
+ *         HW_CAN_FILTER_MAX_RULES ranges.
+ */
+bool HW_CAN_Filter_Set_Rules( HW_CAN_Filter_Plan_T* plan, const HW_CAN_Filter_Rule_T rules[],
+                              uint16_t rule_count );
+
+/**
+ * @brief Packs the plan's rules into at most bank_budget banks.
+ *
+ * Rules are decomposed into the fewest aligned blocks and packed into the
+ * cheapest mix of list and mask banks. When that needs more than
+ * bank_budget banks, neighbouring entries of the same format are widened,
+ * least added identifiers first, until the plan fits.
+ *
+ * @return false if the budget is below one bank per identifier format in use.
+ */
+bool HW_CAN_Filter_Pack( HW_CAN_Filter_Plan_T* plan, uint8_t bank_budget );
+
+/**
+ * @brief Packs both channel plans into the shared filter banks.
+ *
+ * Each channel is given the banks it needs when both fit. Otherwise the banks
+ * are split in proportion to need, keeping at least one bank per identifier
+ * format in use on each channel.
+ *
+ * @return First bank assigned to CAN2. CAN1 uses the banks below it. The
+ *         result never exceeds HW_CAN_FILTER_BANK_COUNT - 1.
+ */
+uint8_t HW_CAN_Filter_Allocate( HW_CAN_Filter_Plan_T* can1_plan, HW_CAN_Filter_Plan_T* can2_plan );
+
+/**
+ * @brief Writes the plan's bank register images.
+ *
+ * @param banks  Destination for plan->bank_count banks.
+ *
+ * @return Number of banks written.
+ */
+uint8_t HW_CAN_Filter_Build_Banks( const HW_CAN_Filter_Plan_T* plan, HW_CAN_Filter_Bank_T banks[] );
+
+/**
+ * @brief Software acceptance check against the plan's rules.
+ *
+ * @return true if the identifier lies in one of the plan's ranges.
+ */
+bool HW_CAN_Filter_Accepts( const HW_CAN_Filter_Plan_T* plan, uint32_t id, bool extended );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HW_CAN_FILTER_H */
@@ -0,0 +1,300 @@
+/******************************************************************************
+ *  File:       hw_can_replay.c
+ *  Author:     Timothy Vogelsang
+ *  Created:    18-Oct-2026
+ *
+ *  Description:
+ *      Implementation of the compact CAN log reader and scheduler.
+ *
+ *  Notes:
+    Due times are worked out from the unscaled time since the start of the
+    replay rather than by adding scaled gaps, so rounding never accumulates:
+
+        pass 0:  | d0 | d1 |  d2  |          pass_us           |
+        pass 1:                                  | d0 | d1 |  d2  | ...
+        due    = start_us + log_time_us * time_scale / 1000
+ ******************************************************************************/
+
+/**-----------------------------------------------------------------------------
+ *  Includes
+ *------------------------------------------------------------------------------
+ */
+
+#include "hw_can_replay.h"
+#include "hw_can.h"
+#include <stddef.h>
+#include <string.h>
+
+/**-----------------------------------------------------------------------------
+ *  Defines / Macros
+ *------------------------------------------------------------------------------
+ */
+
+#if HW_CAN_REPLAY_PAYLOAD_SIZE != CAN_PACKET_SIZE
+#error "CAN replay payloads must match CAN_PACKET_SIZE"
+#endif
+
+#define HW_CAN_REPLAY_VERSION_OFFSET ( 4U )
+#define HW_CAN_REPLAY_FRAME_COUNT_OFFSET ( 8U )
+#define HW_CAN_REPLAY_PASS_US_OFFSET ( 12U )
+
+/**-----------------------------------------------------------------------------
+ *  Private Function Definitions
+ *------------------------------------------------------------------------------
+ */
+
+/** Read a little-endian field of one to four bytes. */
+static uint32_t HW_CAN_Replay_Read_Le( const uint8_t bytes[], uint8_t count )
+{
+    uint32_t value = 0U;
+    for ( uint8_t i = 0U; i < count; i++ )
+    {
+        value |= ( uint32_t )bytes[i] << ( i * 8U );
+    }
+    return value;
+}
+
+/**
+ * Decode the record at offset. due_us is left for the caller.
+ *
+ * @return false when the record is malformed or runs past the end of the log.
+ */
+static bool HW_CAN_Replay_Read_Record( const uint8_t log[], uint32_t length, uint32_t offset,
+                                       HW_CAN_Replay_Frame_T* frame, uint32_t* delta_us,
+                                       uint32_t* size )
+{
+    if ( offset >= length )
+    {
+        return false;
+    }
+
+    uint8_t tag         = log[offset];
+    uint8_t dlc         = ( uint8_t )( tag & HW_CAN_REPLAY_TAG_DLC_MASK );
+    bool    extended    = ( tag & HW_CAN_REPLAY_TAG_EXTENDED ) != 0U;
+    uint8_t delta_bytes = ( uint8_t )(
+        ( ( tag & HW_CAN_REPLAY_TAG_DELTA_MASK ) >> HW_CAN_REPLAY_TAG_DELTA_SHIFT ) + 1U );
+    uint8_t id_bytes = extended ? 4U : 2U;
+
+    if ( ( tag & HW_CAN_REPLAY_TAG_RESERVED ) != 0U || dlc > HW_CAN_REPLAY_PAYLOAD_SIZE )
+    {
+        return false;
+    }
+
+    uint32_t record_size = 1U + delta_bytes + id_bytes + dlc;
+    if ( record_size > length - offset )
+    {
+        return false;
+    }
+
+    const uint8_t* field = &log[offset + 1U];
+    uint32_t       id    = HW_CAN_Replay_Read_Le( &field[delta_bytes], id_bytes );
+    if ( id > ( extended ? CAN_EXTENDED_ID_MAX : CAN_STANDARD_ID_MAX ) )
+    {
+        return false;
+    }
+
+    *delta_us       = HW_CAN_Replay_Read_Le( field, delta_bytes );
+    *size           = record_size;
+    frame->id       = id;
+    frame->extended = extended;
+    frame->dlc      = dlc;
+    memset( frame->data, 0, sizeof( frame->data ) );
+    memcpy( frame->data, &field[delta_bytes + id_bytes], dlc );
+    return true;
+}
+
+/**
+ * Decode the record after the one just taken, starting the next pass or
+ * ending the replay when the current pass is used up.
+ */
+static void HW_CAN_Replay_Schedule_Next( HW_CAN_Replay_T* replay )
+{
+    if ( replay->frames_left == 0U )
+    {
+        replay->stats.passes++;
+        if ( replay->pass_limit != 0U && replay->passes_started == replay->pass_limit )
+        {
+            replay->has_next = false;
+            return;
+        }
+
+        replay->passes_started++;
+        replay->pass_start_us += replay->pass_us;
+        replay->log_time_us = replay->pass_start_us;
+        replay->offset      = HW_CAN_REPLAY_HEADER_SIZE;
+        replay->frames_left = replay->frame_count;
+    }
+
+    uint32_t delta_us = 0U;
+    uint32_t size     = 0U;
+    if ( !HW_CAN_Replay_Read_Record( replay->log, replay->length, replay->offset, &replay->next,
+                                     &delta_us, &size ) )
+    {
+        // Only reachable if the log changed after it was validated
+        replay->has_next = false;
+        return;
+    }
+
+    replay->offset += size;
+    replay->frames_left--;
+    replay->log_time_us += delta_us;
+
+    uint64_t scaled_us   = replay->log_time_us * replay->time_scale;
+    replay->next.due_us  = replay->start_us
+                          + ( uint32_t )( scaled_us / HW_CAN_REPLAY_TIME_SCALE_UNITY );
+    replay->has_next     = true;
+    replay->next_starved = false;
+}
+
+/**-----------------------------------------------------------------------------
+ *  Public Function Definitions
+ *------------------------------------------------------------------------------
+ */
+
+bool HW_CAN_Replay_Validate( const uint8_t log[], uint32_t length, uint32_t* frame_count )
+{
+    if ( log == NULL || length < HW_CAN_REPLAY_HEADER_SIZE
+         || memcmp( log, HW_CAN_REPLAY_MAGIC, HW_CAN_REPLAY_MAGIC_SIZE ) != 0
+         || log[HW_CAN_REPLAY_VERSION_OFFSET] != HW_CAN_REPLAY_VERSION )
+    {
+        return false;
+    }
+    for ( uint8_t i = HW_CAN_REPLAY_VERSION_OFFSET + 1U; i < HW_CAN_REPLAY_FRAME_COUNT_OFFSET; i++ )
+    {
+        if ( log[i] != 0U )
+        {
+            return false;
+        }
+    }
+
+    uint32_t count   = HW_CAN_Replay_Read_Le( &log[HW_CAN_REPLAY_FRAME_COUNT_OFFSET], 4U );
+    uint32_t pass_us = HW_CAN_Replay_Read_Le( &log[HW_CAN_REPLAY_PASS_US_OFFSET], 4U );
+    if ( count == 0U )
+    {
+        return false;
+    }
+
+    uint32_t offset   = HW_CAN_REPLAY_HEADER_SIZE;
+    uint64_t total_us = 0U;
+    for ( uint32_t i = 0U; i < count; i++ )
+    {
+        HW_CAN_Replay_Frame_T frame;
+        uint32_t              delta_us = 0U;
+        uint32_t              size     = 0U;
+        if ( !HW_CAN_Replay_Read_Record( log, length, offset, &frame, &delta_us, &size ) )
+        {
+            return false;
+        }
+        offset += size;
+        total_us += delta_us;
+    }
+    if ( total_us > pass_us )
+    {
+        return false;
+    }
+
+    if ( frame_count != NULL )
+    {
+        *frame_count = count;
+    }
+    return true;
+}
+
+bool HW_CAN_Replay_Load( HW_CAN_Replay_T* replay, const uint8_t log[], uint32_t length,
+                         uint32_t time_scale, uint32_t passes, uint32_t start_us )
+{
+    uint32_t frame_count = 0U;
+    if ( replay == NULL || time_scale == 0U || time_scale > HW_CAN_REPLAY_TIME_SCALE_MAX
+         || !HW_CAN_Replay_Validate( log, length, &frame_count ) )
+    {
+        return false;
+    }
+
+    HW_CAN_Replay_Clear( replay );
+    replay->log            = log;
+    replay->length         = length;
+    replay->frame_count    = frame_count;
+    replay->pass_us        = HW_CAN_Replay_Read_Le( &log[HW_CAN_REPLAY_PASS_US_OFFSET], 4U );
+    replay->time_scale     = time_scale;
+    replay->pass_limit     = passes;
+    replay->start_us       = start_us;
+    replay->offset         = HW_CAN_REPLAY_HEADER_SIZE;
+    replay->frames_left    = frame_count;
+    replay->passes_started = 1U;
+
+    HW_CAN_Replay_Schedule_Next( replay );
+    return true;
+}
+
+void HW_CAN_Replay_Clear( HW_CAN_Replay_T* replay )
+{
+    if ( replay == NULL )
+    {
+        return;
+    }
+
+    memset( replay, 0, sizeof( *replay ) );
+}
+
+bool HW_CAN_Replay_Due( const HW_CAN_Replay_T* replay, uint32_t now_us )
+{
+    // Signed difference so the comparison holds across a time base wrap
+    return replay->has_next && ( int32_t )( now_us - replay->next.due_us ) >= 0;
+}
+
+void HW_CAN_Replay_Starved( HW_CAN_Replay_T* replay )
+{
+    if ( replay->has_next && !replay->next_starved )
+    {
+        replay->next_starved = true;
+        replay->stats.starved++;
+    }
+}
+
+const HW_CAN_Replay_Frame_T* HW_CAN_Replay_Take( HW_CAN_Replay_T* replay )
+{
+    if ( !replay->has_next || replay->in_flight )
+    {
+        return NULL;
+    }
+
+    replay->current   = replay->next;
+    replay->in_flight = true;
+    HW_CAN_Replay_Schedule_Next( replay );
+    return &replay->current;
+}
+
+void HW_CAN_Replay_Complete( HW_CAN_Replay_T* replay, uint32_t sent_us, bool sent )
+{
+    if ( !replay->in_flight )
+    {
+        return;
+    }
+
+    HW_CAN_Replay_Stats_T* stats = &replay->stats;
+    replay->in_flight            = false;
+    stats->complete              = !replay->has_next;
+    if ( !sent )
+    {
+        stats->failed++;
+        return;
+    }
+
+    int32_t error = ( int32_t )( sent_us - replay->current.due_us );
+    if ( stats->sent == 0U || error < stats->min_error_us )
+    {
+        stats->min_error_us = error;
+    }
+    if ( stats->sent == 0U || error > stats->max_error_us )
+    {
+        stats->max_error_us = error;
+    }
+    stats->last_error_us = error;
+    stats->total_error_us += error;
+    stats->sent++;
+}
+
+bool HW_CAN_Replay_Finished( const HW_CAN_Replay_T* replay )
+{
+    return !replay->has_next && !replay->in_flight;
+}
@@ -0,0 +1,243 @@
+/******************************************************************************
+ *  File:       hw_can_replay.h
+ *  Author:     Timothy Vogelsang
+ *  Created:    18-Oct-2026
+ *
+ *  Description:
+ *      Reader and scheduler for compact timestamped CAN logs.
+ *
+ *      A log is a short header followed by variable-length frame records,
+ *      each carrying the time since the previous frame. The reader walks the
+ *      log in place, turns every record into a frame with an absolute due
+ *      time on the shared microsecond base, and stretches or compresses the
+ *      recorded gaps by a time scale. A log may be played once, a fixed
+ *      number of times or until stopped. Each frame's start of frame is
+ *      compared with its due time to give its schedule error.
+ *
+ *  Notes:
+ *      The reader is pure logic and does not touch the peripheral. hw_can.c
+ *      paces it from a one-shot hardware timer, loads due frames into the
+ *      reserved transmit mailbox and reports completions back with their
+ *      start-of-frame timestamps.
+ *
+ *      The log is only read, never copied, so it may sit in memory-mapped
+ *      external flash as well as in RAM. The host converter in
+ *      tools/can_log_convert writes logs in this format from candump and
+ *      Vector ASC traces.
+ *
+ *      Log layout, all fields little endian:
+ *
+ *          Header, 16 bytes
+ *              0   'C' 'A' 'N' 'R'
+ *              4   version, HW_CAN_REPLAY_VERSION
+ *              5   three reserved bytes, zero
+ *              8   frame_count, u32, one or more records per pass
+ *              12  pass_us, u32, time from the start of one pass to the
+ *                  start of the next; at least the sum of the pass's deltas
+ *
+ *          Record, 4 to 17 bytes
+ *              0   tag: bits 0-3 DLC, bits 4-5 delta bytes - 1,
+ *                  bit 6 reserved zero, bit 7 extended identifier
+ *              1   delta_us, 1 to 4 bytes, time since the previous record
+ *                  or, for the first record, since the start of the pass
+ *              .   identifier, 2 bytes standard or 4 bytes extended
+ *              .   DLC payload bytes
+ *
+ *      Bytes after the last record are ignored, so a log may be padded to a
+ *      flash sector.
+ ******************************************************************************/
+
+#ifndef HW_CAN_REPLAY_H
+#define HW_CAN_REPLAY_H
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/**-----------------------------------------------------------------------------
+ *  Includes
+ *------------------------------------------------------------------------------
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/**-----------------------------------------------------------------------------
+ *  Public Defines / Macros
+ *------------------------------------------------------------------------------
+ */
+
+#define HW_CAN_REPLAY_MAGIC "CANR"
+#define HW_CAN_REPLAY_MAGIC_SIZE ( 4U )
+#define HW_CAN_REPLAY_VERSION ( 1U )
+#define HW_CAN_REPLAY_HEADER_SIZE ( 16U )
+
+#define HW_CAN_REPLAY_TAG_DLC_MASK ( 0x0FU )
+#define HW_CAN_REPLAY_TAG_DELTA_SHIFT ( 4U )
+#define HW_CAN_REPLAY_TAG_DELTA_MASK ( 0x30U )
+#define HW_CAN_REPLAY_TAG_RESERVED ( 0x40U )
+#define HW_CAN_REPLAY_TAG_EXTENDED ( 0x80U )
+
+/** Longest record: tag, four delta bytes, extended identifier and eight bytes. */
+#define HW_CAN_REPLAY_RECORD_MAX_SIZE ( 17U )
+
+/** Payload bytes held per frame; matches CAN_PACKET_SIZE. */
+#define HW_CAN_REPLAY_PAYLOAD_SIZE ( 8U )
+
+/** Time scale that plays a log at its recorded speed. */
+#define HW_CAN_REPLAY_TIME_SCALE_UNITY ( 1000U )
+
+/** Slowest allowed time scale, one hundred times the recorded gaps. */
+#define HW_CAN_REPLAY_TIME_SCALE_MAX ( 100U * HW_CAN_REPLAY_TIME_SCALE_UNITY )
+
+/**-----------------------------------------------------------------------------
+ *  Public Typedefs / Enums / Structures
+ *------------------------------------------------------------------------------
+ */
+
+/** One decoded frame and the time it is due on the shared microsecond base. */
+typedef struct HW_CAN_Replay_Frame_T
+{
+    uint32_t id;
+    uint32_t due_us;
+    uint8_t  data[HW_CAN_REPLAY_PAYLOAD_SIZE];
+    uint8_t  dlc;
+    bool     extended;
+
+} HW_CAN_Replay_Frame_T;
+
+/**
+ * @brief Progress and timing statistics of one replay.
+ *
+ * The schedule error of a frame is its start of frame minus its due time, so
+ * a positive error is a late frame. starved counts frames that fell due while
+ * the transmit mailbox still held an earlier frame; each of those waits for
+ * the mailbox and shows the wait in its error. failed counts frames that
+ * completed without being acknowledged and are not part of the error figures.
+ * passes counts passes through the log whose last frame has been taken;
+ * complete is set once the final frame of the final pass has completed. The
+ * error fields are zero until the first frame is sent.
+ */
+typedef struct HW_CAN_Replay_Stats_T
+{
+    uint32_t sent;
+    uint32_t failed;
+    uint32_t starved;
+    uint32_t passes;
+    int32_t  min_error_us;
+    int32_t  max_error_us;
+    int32_t  last_error_us;
+    int64_t  total_error_us;
+    bool     complete;
+
+} HW_CAN_Replay_Stats_T;
+
+/**
+ * @brief Replay of one log on one channel.
+ *
+ * next is the frame waiting for its due time while has_next is set;
+ * next_starved is set once it has been counted as starved. current is the
+ * frame most recently handed to the mailbox and in_flight is set until its
+ * completion is reported. log_time_us is the unscaled time of next from the
+ * start of the replay.
+ */
+typedef struct HW_CAN_Replay_T
+{
+    const uint8_t*        log;
+    uint32_t              length;
+    uint32_t              frame_count;
+    uint32_t              pass_us;
+    uint32_t              time_scale;
+    uint32_t              pass_limit;
+    uint32_t              start_us;
+    uint32_t              offset;
+    uint32_t              frames_left;
+    uint32_t              passes_started;
+    uint64_t              pass_start_us;
+    uint64_t              log_time_us;
+    HW_CAN_Replay_Frame_T next;
+    HW_CAN_Replay_Frame_T current;
+    bool                  has_next;
+    bool                  next_starved;
+    bool                  in_flight;
+    HW_CAN_Replay_Stats_T stats;
+
+} HW_CAN_Replay_T;
+
+/**-----------------------------------------------------------------------------
+ *  Public Function Prototypes
+ *------------------------------------------------------------------------------
+ */
+
+/**
+ * @brief Checks that a byte region holds a complete, well-formed log.
+ *
+ * Every record is walked once, so a log that validates cannot fail part way
+ * through a replay.
+ *
+ * @param frame_count  Set to the number of records per pass. May be null.
+ *
+ * @return false for a null or short region, a bad magic or version, non-zero
+ *         reserved bits, a zero frame count, a record that runs past the end
+ *         of the region, a DLC above eight, an identifier that does not fit
+ *         its format, or deltas that add up to more than pass_us.
+ */
+bool HW_CAN_Replay_Validate( const uint8_t log[], uint32_t length, uint32_t* frame_count );
+
+/**
+ * @brief Validates a log and schedules its first frame.
+ *
+ * Statistics are cleared. Recorded gaps are multiplied by
+ * time_scale / HW_CAN_REPLAY_TIME_SCALE_UNITY, so 500 plays twice as fast and
+ * 2000 half as fast.
+ *
+ * @param passes    Passes through the log, zero to loop until stopped.
+ * @param start_us  Time base reading the replay starts from.
+ *
+ * @return false, leaving the replay unchanged, for a log that does not
+ *         validate or a time scale of zero or above
+ *         HW_CAN_REPLAY_TIME_SCALE_MAX.
+ */
+bool HW_CAN_Replay_Load( HW_CAN_Replay_T* replay, const uint8_t log[], uint32_t length,
+                         uint32_t time_scale, uint32_t passes, uint32_t start_us );
+
+/** Forgets the log, any frame in flight and the statistics. */
+void HW_CAN_Replay_Clear( HW_CAN_Replay_T* replay );
+
+/** Returns true when a frame is waiting and its due time has been reached. */
+bool HW_CAN_Replay_Due( const HW_CAN_Replay_T* replay, uint32_t now_us );
+
+/**
+ * @brief Counts the waiting frame as starved of a mailbox.
+ *
+ * Counts each frame at most once however often it is called.
+ */
+void HW_CAN_Replay_Starved( HW_CAN_Replay_T* replay );
+
+/**
+ * @brief Hands the waiting frame to the mailbox and schedules the one after it.
+ *
+ * @return The frame to transmit, or null when no frame is waiting or one is
+ *         already in flight.
+ */
+const HW_CAN_Replay_Frame_T* HW_CAN_Replay_Take( HW_CAN_Replay_T* replay );
+
+/**
+ * @brief Records the completion of the frame in flight.
+ *
+ * Does nothing when no frame is in flight.
+ *
+ * @param sent_us  Start of frame of the frame.
+ * @param sent     true when the frame was acknowledged on the bus.
+ */
+void HW_CAN_Replay_Complete( HW_CAN_Replay_T* replay, uint32_t sent_us, bool sent );
+
+/** Returns true once no frame is waiting or in flight. */
+bool HW_CAN_Replay_Finished( const HW_CAN_Replay_T* replay );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HW_CAN_REPLAY_H */
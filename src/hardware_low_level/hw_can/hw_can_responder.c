@@ -0,0 +1,228 @@
+/******************************************************************************
+ *  File:       hw_can_responder.c
+ *  Author:     Timothy Vogelsang
+ *  Created:    18-Oct-2026
+ *
+ *  Description:
+ *      Implementation of the CAN request/response table.
+ *
+ *  Notes:
+    The index trades 2 KB per channel for a lookup that is one array read
+    whatever the table size:
+
+        first[0x7DF] --> entry 3 --> entry 7 --> NONE
+        first[0x7E0] --> entry 0 --> NONE
+        first[other] --> NONE
+
+    Entries sharing an identifier are chained in table order and differ only
+    in their payload masks, so the chain is normally one or two long.
+ ******************************************************************************/
+
+/**-----------------------------------------------------------------------------
+ *  Includes
+ *------------------------------------------------------------------------------
+ */
+
+#include "hw_can_responder.h"
+#include "hw_can.h"
+#include <stddef.h>
+#include <string.h>
+
+/**-----------------------------------------------------------------------------
+ *  Defines / Macros
+ *------------------------------------------------------------------------------
+ */
+
+#if HW_CAN_RESPONDER_PAYLOAD_SIZE != CAN_PACKET_SIZE
+#error "CAN responder payloads must match CAN_PACKET_SIZE"
+#endif
+
+#if HW_CAN_RESPONDER_ID_COUNT != CAN_STANDARD_ID_MAX + 1U
+#error "CAN responder index must cover every standard identifier"
+#endif
+
+/**-----------------------------------------------------------------------------
+ *  Private Function Definitions
+ *------------------------------------------------------------------------------
+ */
+
+static bool HW_CAN_Responder_Entry_Is_Valid( const HW_CAN_Responder_Entry_T* entry )
+{
+    uint32_t id_max = entry->response_extended ? CAN_EXTENDED_ID_MAX : CAN_STANDARD_ID_MAX;
+    return entry->request_id <= CAN_STANDARD_ID_MAX && entry->response_id <= id_max
+           && entry->response_dlc <= HW_CAN_RESPONDER_PAYLOAD_SIZE;
+}
+
+/** Pack up to eight bytes into one word, byte 0 lowest; missing bytes read as zero. */
+static uint64_t HW_CAN_Responder_Pack( const uint8_t data[], uint8_t length )
+{
+    uint64_t word = 0U;
+    for ( uint8_t i = 0U; i < length; i++ )
+    {
+        word |= ( uint64_t )data[i] << ( i * 8U );
+    }
+    return word;
+}
+
+/**-----------------------------------------------------------------------------
+ *  Public Function Definitions
+ *------------------------------------------------------------------------------
+ */
+
+bool HW_CAN_Responder_Load( HW_CAN_Responder_T* responder, const HW_CAN_Responder_Entry_T table[],
+                            uint16_t count )
+{
+    if ( responder == NULL || ( count > 0U && table == NULL )
+         || count > HW_CAN_RESPONDER_MAX_ENTRIES )
+    {
+        return false;
+    }
+    for ( uint16_t i = 0U; i < count; i++ )
+    {
+        if ( !HW_CAN_Responder_Entry_Is_Valid( &table[i] ) )
+        {
+            return false;
+        }
+    }
+
+    HW_CAN_Responder_Clear( responder );
+
+    // Walk backwards so pushing onto each chain head leaves the chain in table order
+    for ( uint16_t i = count; i > 0U; i-- )
+    {
+        uint8_t                         index = ( uint8_t )( i - 1U );
+        const HW_CAN_Responder_Entry_T* entry = &table[index];
+
+        responder->entries[index] = *entry;
+        responder->mask[index] =
+            HW_CAN_Responder_Pack( entry->request_mask, HW_CAN_RESPONDER_PAYLOAD_SIZE );
+        responder->value[index] =
+            HW_CAN_Responder_Pack( entry->request_data, HW_CAN_RESPONDER_PAYLOAD_SIZE )
+            & responder->mask[index];
+
+        uint8_t min_dlc = 0U;
+        for ( uint8_t byte = 0U; byte < HW_CAN_RESPONDER_PAYLOAD_SIZE; byte++ )
+        {
+            if ( entry->request_mask[byte] != 0U )
+            {
+                min_dlc = ( uint8_t )( byte + 1U );
+            }
+        }
+        responder->min_dlc[index] = min_dlc;
+
+        responder->next[index]              = responder->first[entry->request_id];
+        responder->first[entry->request_id] = index;
+    }
+
+    responder->entry_count = ( uint8_t )count;
+    return true;
+}
+
+void HW_CAN_Responder_Clear( HW_CAN_Responder_T* responder )
+{
+    if ( responder == NULL )
+    {
+        return;
+    }
+
+    memset( responder->first, HW_CAN_RESPONDER_NONE, sizeof( responder->first ) );
+    memset( &responder->stats, 0, sizeof( responder->stats ) );
+    responder->entry_count = 0U;
+    responder->queue_head  = 0U;
+    responder->queue_count = 0U;
+    responder->in_flight   = HW_CAN_RESPONDER_NONE;
+}
+
+uint8_t HW_CAN_Responder_Match( const HW_CAN_Responder_T* responder, uint32_t id, bool extended,
+                                const uint8_t data[], uint8_t dlc )
+{
+    if ( extended || id > CAN_STANDARD_ID_MAX )
+    {
+        return HW_CAN_RESPONDER_NONE;
+    }
+
+    uint8_t index = responder->first[id];
+    if ( index == HW_CAN_RESPONDER_NONE )
+    {
+        return HW_CAN_RESPONDER_NONE;
+    }
+
+    uint8_t  length  = dlc < HW_CAN_RESPONDER_PAYLOAD_SIZE ? dlc : HW_CAN_RESPONDER_PAYLOAD_SIZE;
+    uint64_t payload = HW_CAN_Responder_Pack( data, length );
+    for ( ; index != HW_CAN_RESPONDER_NONE; index = responder->next[index] )
+    {
+        if ( dlc >= responder->min_dlc[index]
+             && ( payload & responder->mask[index] ) == responder->value[index] )
+        {
+            return index;
+        }
+    }
+
+    return HW_CAN_RESPONDER_NONE;
+}
+
+bool HW_CAN_Responder_Queue( HW_CAN_Responder_T* responder, uint8_t index, uint32_t request_us )
+{
+    responder->stats.matched++;
+    if ( responder->queue_count == HW_CAN_RESPONDER_QUEUE_DEPTH )
+    {
+        responder->stats.missed++;
+        return false;
+    }
+
+    uint8_t slot = ( uint8_t )( ( responder->queue_head + responder->queue_count )
+                                % HW_CAN_RESPONDER_QUEUE_DEPTH );
+    responder->queue[slot]            = index;
+    responder->queue_request_us[slot] = request_us;
+    responder->queue_count++;
+    return true;
+}
+
+void HW_CAN_Responder_Flush( HW_CAN_Responder_T* responder )
+{
+    responder->queue_head  = 0U;
+    responder->queue_count = 0U;
+}
+
+uint8_t HW_CAN_Responder_Pop( HW_CAN_Responder_T* responder )
+{
+    if ( responder->in_flight != HW_CAN_RESPONDER_NONE || responder->queue_count == 0U )
+    {
+        return HW_CAN_RESPONDER_NONE;
+    }
+
+    uint8_t slot                    = responder->queue_head;
+    responder->in_flight            = responder->queue[slot];
+    responder->in_flight_request_us = responder->queue_request_us[slot];
+    responder->queue_head = ( uint8_t )( ( slot + 1U ) % HW_CAN_RESPONDER_QUEUE_DEPTH );
+    responder->queue_count--;
+    return responder->in_flight;
+}
+
+void HW_CAN_Responder_Complete( HW_CAN_Responder_T* responder, uint32_t sent_us, bool sent )
+{
+    if ( responder->in_flight == HW_CAN_RESPONDER_NONE )
+    {
+        return;
+    }
+
+    responder->in_flight = HW_CAN_RESPONDER_NONE;
+    if ( !sent )
+    {
+        responder->stats.failed++;
+        return;
+    }
+
+    HW_CAN_Responder_Stats_T* stats   = &responder->stats;
+    uint32_t                  latency = sent_us - responder->in_flight_request_us;
+    if ( stats->sent == 0U || latency < stats->min_latency_us )
+    {
+        stats->min_latency_us = latency;
+    }
+    if ( latency > stats->max_latency_us )
+    {
+        stats->max_latency_us = latency;
+    }
+    stats->last_latency_us = latency;
+    stats->sent++;
+}
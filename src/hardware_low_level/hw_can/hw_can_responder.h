@@ -0,0 +1,215 @@
+/******************************************************************************
+ *  File:       hw_can_responder.h
+ *  Author:     Timothy Vogelsang
+ *  Created:    18-Oct-2026
+ *
+ *  Description:
+ *      Request/response table for emulating ECUs that answer CAN requests.
+ *
+ *      Each entry pairs a standard request identifier, optionally narrowed
+ *      by a payload mask, with a prepared response frame. A received frame
+ *      is looked up through a direct table indexed by its 11-bit identifier,
+ *      so the cost of a match does not grow with the table. Matched responses
+ *      wait in a short queue for the transmit mailbox and their turnaround is
+ *      recorded when they complete.
+ *
+ *  Notes:
+ *      The table is pure logic and does not touch the peripheral. hw_can.c
+ *      matches frames in its receive interrupts, loads queued responses into
+ *      the reserved transmit mailbox and reports completions back with their
+ *      start-of-frame timestamps.
+ ******************************************************************************/
+
+#ifndef HW_CAN_RESPONDER_H
+#define HW_CAN_RESPONDER_H
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/**-----------------------------------------------------------------------------
+ *  Includes
+ *------------------------------------------------------------------------------
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/**-----------------------------------------------------------------------------
+ *  Public Defines / Macros
+ *------------------------------------------------------------------------------
+ */
+
+/*
+ * Responses held per channel. Each entry costs about 50 bytes of RAM on top of
+ * the 2 KB identifier index; override with a compile definition.
+ */
+#ifndef HW_CAN_RESPONDER_MAX_ENTRIES
+#define HW_CAN_RESPONDER_MAX_ENTRIES ( 32U )
+#endif
+
+/* Matched responses that may wait while the mailbox is busy. */
+#ifndef HW_CAN_RESPONDER_QUEUE_DEPTH
+#define HW_CAN_RESPONDER_QUEUE_DEPTH ( 4U )
+#endif
+
+/** Payload bytes held per frame; matches CAN_PACKET_SIZE. */
+#define HW_CAN_RESPONDER_PAYLOAD_SIZE ( 8U )
+
+/** One index slot per standard identifier. */
+#define HW_CAN_RESPONDER_ID_COUNT ( 2048U )
+
+/** Index value meaning "no entry". */
+#define HW_CAN_RESPONDER_NONE ( 0xFFU )
+
+// Entry indices are uint8_t with HW_CAN_RESPONDER_NONE reserved.
+#if HW_CAN_RESPONDER_MAX_ENTRIES < 1U || HW_CAN_RESPONDER_MAX_ENTRIES > 254U
+#error "CAN responder table must hold 1 to 254 entries"
+#endif
+
+#if HW_CAN_RESPONDER_QUEUE_DEPTH < 1U || HW_CAN_RESPONDER_QUEUE_DEPTH > 255U
+#error "CAN responder queue must hold 1 to 255 responses"
+#endif
+
+/**-----------------------------------------------------------------------------
+ *  Public Typedefs / Enums / Structures
+ *------------------------------------------------------------------------------
+ */
+
+/**
+ * @brief One request and its prepared response.
+ *
+ * A standard frame with identifier request_id matches when every bit set in
+ * request_mask has the same value in its payload as in request_data. An all
+ * zero mask matches any payload; a frame too short to hold every masked byte
+ * never matches. Extended frames never match.
+ */
+typedef struct HW_CAN_Responder_Entry_T
+{
+    uint16_t request_id;
+    uint8_t  request_data[HW_CAN_RESPONDER_PAYLOAD_SIZE];
+    uint8_t  request_mask[HW_CAN_RESPONDER_PAYLOAD_SIZE];
+    uint32_t response_id;
+    uint8_t  response_data[HW_CAN_RESPONDER_PAYLOAD_SIZE];
+    uint8_t  response_dlc;
+    bool     response_extended;
+
+} HW_CAN_Responder_Entry_T;
+
+/**
+ * @brief Turnaround statistics of one channel's responder.
+ *
+ * Latency runs from the request's start of frame to the response's start of
+ * frame. matched counts requests that found an entry; missed counts those
+ * dropped because the queue was full and failed counts responses that
+ * completed without being acknowledged. The latency fields are zero until the
+ * first response is sent.
+ */
+typedef struct HW_CAN_Responder_Stats_T
+{
+    uint32_t matched;
+    uint32_t sent;
+    uint32_t missed;
+    uint32_t failed;
+    uint32_t min_latency_us;
+    uint32_t max_latency_us;
+    uint32_t last_latency_us;
+
+} HW_CAN_Responder_Stats_T;
+
+/**
+ * @brief Responder table of one channel.
+ *
+ * first[id] heads a list, linked through next in table order, of the entries
+ * for that request identifier. Each entry's mask and expected payload are
+ * packed into one 64-bit word so a candidate is checked in a single compare.
+ * Matched entries wait in the queue ring; in_flight is the response
+ * currently in the mailbox.
+ */
+typedef struct HW_CAN_Responder_T
+{
+    HW_CAN_Responder_Entry_T entries[HW_CAN_RESPONDER_MAX_ENTRIES];
+    uint64_t                 mask[HW_CAN_RESPONDER_MAX_ENTRIES];
+    uint64_t                 value[HW_CAN_RESPONDER_MAX_ENTRIES];
+    uint8_t                  min_dlc[HW_CAN_RESPONDER_MAX_ENTRIES];
+    uint8_t                  next[HW_CAN_RESPONDER_MAX_ENTRIES];
+    uint8_t                  first[HW_CAN_RESPONDER_ID_COUNT];
+    uint8_t                  queue[HW_CAN_RESPONDER_QUEUE_DEPTH];
+    uint32_t                 queue_request_us[HW_CAN_RESPONDER_QUEUE_DEPTH];
+    uint8_t                  queue_head;
+    uint8_t                  queue_count;
+    uint8_t                  entry_count;
+    uint8_t                  in_flight;
+    uint32_t                 in_flight_request_us;
+    HW_CAN_Responder_Stats_T stats;
+
+} HW_CAN_Responder_T;
+
+/**-----------------------------------------------------------------------------
+ *  Public Function Prototypes
+ *------------------------------------------------------------------------------
+ */
+
+/**
+ * @brief Validates a table and builds the identifier index.
+ *
+ * Statistics are cleared and nothing is queued or in flight afterwards. Where
+ * several entries match the same frame the first in the table wins.
+ *
+ * @return false, leaving the responder unchanged, for a null table with a
+ *         non-zero count, more than HW_CAN_RESPONDER_MAX_ENTRIES entries, a
+ *         request identifier above 0x7FF, a response identifier that does not
+ *         fit its format, or a response DLC above eight.
+ */
+bool HW_CAN_Responder_Load( HW_CAN_Responder_T* responder, const HW_CAN_Responder_Entry_T table[],
+                            uint16_t count );
+
+/** Empties the table and queue, forgetting any response in flight. */
+void HW_CAN_Responder_Clear( HW_CAN_Responder_T* responder );
+
+/**
+ * @brief Finds the entry that answers a received frame.
+ *
+ * @param data  The frame's payload; bytes from dlc on are not read.
+ *
+ * @return Entry index, or HW_CAN_RESPONDER_NONE.
+ */
+uint8_t HW_CAN_Responder_Match( const HW_CAN_Responder_T* responder, uint32_t id, bool extended,
+                                const uint8_t data[], uint8_t dlc );
+
+/**
+ * @brief Queues a matched entry's response.
+ *
+ * @param request_us  Start of frame of the request.
+ *
+ * @return false, counting a miss, when the queue is full.
+ */
+bool HW_CAN_Responder_Queue( HW_CAN_Responder_T* responder, uint8_t index, uint32_t request_us );
+
+/** Drops queued responses that have not reached the mailbox. */
+void HW_CAN_Responder_Flush( HW_CAN_Responder_T* responder );
+
+/**
+ * @brief Takes the oldest queued response and marks it in flight.
+ *
+ * @return Entry index, or HW_CAN_RESPONDER_NONE when nothing is queued or a
+ *         response is already in flight.
+ */
+uint8_t HW_CAN_Responder_Pop( HW_CAN_Responder_T* responder );
+
+/**
+ * @brief Records the completion of the response in flight.
+ *
+ * Does nothing when no response is in flight.
+ *
+ * @param sent_us  Start of frame of the response.
+ * @param sent     true when the response was acknowledged on the bus.
+ */
+void HW_CAN_Responder_Complete( HW_CAN_Responder_T* responder, uint32_t sent_us, bool sent );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HW_CAN_RESPONDER_H */
@@ -0,0 +1,303 @@
+/******************************************************************************
+ *  File:       hw_can_stats.c
+ *  Author:     Timothy Vogelsang
+ *  Created:    18-Oct-2026
+ *
+ *  Description:
+ *      Implementation of the CAN channel statistics.
+ *
+ *  Notes:
+ *      Stuff bits are inserted from the start of frame to the end of the CRC
+ *      sequence, after every five equal bits. The first stuff bit needs five
+ *      bits and each further one only four more, as the stuff bit starts the
+ *      next run, so g stuffed bits carry at most (g - 1) / 4 stuff bits.
+ ******************************************************************************/
+
+/**-----------------------------------------------------------------------------
+ *  Includes
+ *------------------------------------------------------------------------------
+ */
+
+#include "hw_can_stats.h"
+#include <stddef.h>
+#include <string.h>
+
+/**-----------------------------------------------------------------------------
+ *  Defines / Macros
+ *------------------------------------------------------------------------------
+ */
+
+/* Frame from SOF to the end of intermission with no data: 44 or 64 bits plus three of IFS. */
+#define HW_CAN_STATS_STANDARD_FRAME_BITS ( 47U )
+#define HW_CAN_STATS_EXTENDED_FRAME_BITS ( 67U )
+
+/* Bits from SOF to the end of the CRC sequence with no data. */
+#define HW_CAN_STATS_STANDARD_STUFFED_BITS ( 34U )
+#define HW_CAN_STATS_EXTENDED_STUFFED_BITS ( 54U )
+
+#define HW_CAN_STATS_MAX_DLC ( 8U )
+#define HW_CAN_STATS_US_PER_S ( 1000000U )
+
+/**-----------------------------------------------------------------------------
+ *  Private Function Definitions
+ *------------------------------------------------------------------------------
+ */
+
+static uint8_t HW_CAN_Stats_Data_Bytes( uint8_t dlc )
+{
+    return dlc <= HW_CAN_STATS_MAX_DLC ? dlc : HW_CAN_STATS_MAX_DLC;
+}
+
+static void HW_CAN_Stats_Add( uint32_t* counter, uint32_t amount )
+{
+    *counter = amount <= UINT32_MAX - *counter ? *counter + amount : UINT32_MAX;
+}
+
+static uint32_t HW_CAN_Stats_Rate( uint64_t count, uint32_t elapsed_us )
+{
+    uint64_t rate = ( count * HW_CAN_STATS_US_PER_S ) / elapsed_us;
+    return rate <= UINT32_MAX ? ( uint32_t )rate : UINT32_MAX;
+}
+
+static uint16_t HW_CAN_Stats_Load( uint32_t bits_per_s, uint32_t bitrate )
+{
+    if ( bitrate == 0U )
+    {
+        return 0U;
+    }
+
+    uint64_t load = ( ( uint64_t )bits_per_s * HW_CAN_STATS_LOAD_FULL_SCALE ) / bitrate;
+    return load <= HW_CAN_STATS_LOAD_FULL_SCALE ? ( uint16_t )load
+                                                : ( uint16_t )HW_CAN_STATS_LOAD_FULL_SCALE;
+}
+
+/** Close the window once it is at least HW_CAN_STATS_WINDOW_US long. */
+static void HW_CAN_Stats_Roll( HW_CAN_Stats_T* stats, uint32_t now_us )
+{
+    uint32_t elapsed = now_us - stats->window_start_us;
+    if ( elapsed < HW_CAN_STATS_WINDOW_US )
+    {
+        return;
+    }
+
+    HW_CAN_Bus_Stats_T* totals       = &stats->stats;
+    uint64_t            stuffed_bits = ( uint64_t )stats->window_bits + stats->window_stuff_bits;
+
+    totals->window_us             = elapsed;
+    totals->frames_per_s          = HW_CAN_Stats_Rate( stats->window_frames, elapsed );
+    totals->bits_per_s            = HW_CAN_Stats_Rate( stats->window_bits, elapsed );
+    totals->rx_dropped_per_s      = HW_CAN_Stats_Rate( stats->window_dropped, elapsed );
+    totals->bus_load_permille     = HW_CAN_Stats_Load( totals->bits_per_s, stats->bitrate );
+    totals->bus_load_max_permille = HW_CAN_Stats_Load( HW_CAN_Stats_Rate( stuffed_bits, elapsed ),
+                                                       stats->bitrate );
+    if ( totals->bus_load_max_permille > totals->peak_load_permille )
+    {
+        totals->peak_load_permille = totals->bus_load_max_permille;
+    }
+
+    stats->window_start_us   = now_us;
+    stats->window_frames     = 0U;
+    stats->window_bits       = 0U;
+    stats->window_stuff_bits = 0U;
+    stats->window_dropped    = 0U;
+}
+
+static void HW_CAN_Stats_Count( HW_CAN_Stats_T* stats, uint32_t frames, uint32_t bits,
+                                uint32_t stuff_bits )
+{
+    HW_CAN_Stats_Add( &stats->window_frames, frames );
+    HW_CAN_Stats_Add( &stats->window_bits, bits );
+    HW_CAN_Stats_Add( &stats->window_stuff_bits, stuff_bits );
+    stats->stats.bits += bits;
+    stats->stats.stuff_bits += stuff_bits;
+}
+
+static void HW_CAN_Stats_Bus_On( HW_CAN_Stats_T* stats, uint32_t now_us )
+{
+    if ( !stats->bus_off_pending )
+    {
+        return;
+    }
+
+    uint32_t recovery_us          = now_us - stats->bus_off_us;
+    stats->bus_off_pending        = false;
+    stats->stats.last_recovery_us = recovery_us;
+    if ( recovery_us > stats->stats.max_recovery_us )
+    {
+        stats->stats.max_recovery_us = recovery_us;
+    }
+}
+
+static void HW_CAN_Stats_Lost_Arbitration( HW_CAN_Bus_Stats_T* totals, uint32_t id,
+                                           bool extended )
+{
+    HW_CAN_Stats_Add( &totals->arbitration_lost, 1U );
+
+    for ( uint8_t i = 0U; i < totals->arbitration_id_count; i++ )
+    {
+        HW_CAN_Stats_Id_Count_T* entry = &totals->arbitration_ids[i];
+        if ( entry->id == id && entry->extended == extended )
+        {
+            HW_CAN_Stats_Add( &entry->count, 1U );
+            return;
+        }
+    }
+
+    if ( totals->arbitration_id_count < HW_CAN_STATS_MAX_ARBITRATION_IDS )
+    {
+        HW_CAN_Stats_Id_Count_T* entry = &totals->arbitration_ids[totals->arbitration_id_count++];
+        entry->id                      = id;
+        entry->extended                = extended;
+        entry->count                   = 1U;
+        return;
+    }
+
+    HW_CAN_Stats_Add( &totals->arbitration_untracked, 1U );
+}
+
+static void HW_CAN_Stats_Set_Error_State( HW_CAN_Bus_Stats_T*               totals,
+                                          const HW_CAN_Stats_Error_State_T* state )
+{
+    totals->tec           = state->tec;
+    totals->rec           = state->rec;
+    totals->error_warning = state->warning;
+    totals->error_passive = state->passive;
+    totals->bus_off       = state->bus_off;
+    if ( state->tec > totals->peak_tec )
+    {
+        totals->peak_tec = state->tec;
+    }
+    if ( state->rec > totals->peak_rec )
+    {
+        totals->peak_rec = state->rec;
+    }
+}
+
+/**-----------------------------------------------------------------------------
+ *  Public Function Definitions
+ *------------------------------------------------------------------------------
+ */
+
+void HW_CAN_Stats_Reset( HW_CAN_Stats_T* stats, uint32_t bitrate, uint32_t now_us )
+{
+    if ( stats == NULL )
+    {
+        return;
+    }
+
+    memset( stats, 0, sizeof( *stats ) );
+    stats->bitrate         = bitrate;
+    stats->window_start_us = now_us;
+}
+
+uint32_t HW_CAN_Stats_Frame_Bits( bool extended, uint8_t dlc )
+{
+    uint32_t header =
+        extended ? HW_CAN_STATS_EXTENDED_FRAME_BITS : HW_CAN_STATS_STANDARD_FRAME_BITS;
+    return header + 8U * ( uint32_t )HW_CAN_Stats_Data_Bytes( dlc );
+}
+
+uint32_t HW_CAN_Stats_Stuff_Bits( bool extended, uint8_t dlc )
+{
+    uint32_t stuffed =
+        ( extended ? HW_CAN_STATS_EXTENDED_STUFFED_BITS : HW_CAN_STATS_STANDARD_STUFFED_BITS )
+        + 8U * ( uint32_t )HW_CAN_Stats_Data_Bytes( dlc );
+    return ( stuffed - 1U ) / 4U;
+}
+
+void HW_CAN_Stats_Tally_Frame( HW_CAN_Stats_Tally_T* tally, bool extended, uint8_t dlc )
+{
+    if ( tally == NULL )
+    {
+        return;
+    }
+
+    tally->frames++;
+    tally->bits += HW_CAN_Stats_Frame_Bits( extended, dlc );
+    tally->stuff_bits += HW_CAN_Stats_Stuff_Bits( extended, dlc );
+}
+
+void HW_CAN_Stats_Rx( HW_CAN_Stats_T* stats, const HW_CAN_Stats_Tally_T* tally,
+                      uint32_t dropped, uint32_t now_us )
+{
+    if ( stats == NULL || tally == NULL )
+    {
+        return;
+    }
+
+    HW_CAN_Stats_Roll( stats, now_us );
+    HW_CAN_Stats_Count( stats, tally->frames, tally->bits, tally->stuff_bits );
+    HW_CAN_Stats_Add( &stats->stats.rx_frames, tally->frames );
+    HW_CAN_Stats_Add( &stats->window_dropped, dropped );
+    HW_CAN_Stats_Add( &stats->stats.rx_dropped, dropped );
+    if ( tally->frames > 0U )
+    {
+        HW_CAN_Stats_Bus_On( stats, now_us );
+    }
+}
+
+void HW_CAN_Stats_Tx( HW_CAN_Stats_T* stats, uint32_t id, bool extended, uint8_t dlc, bool sent,
+                      bool arbitration_lost, bool transmit_error, uint32_t now_us )
+{
+    if ( stats == NULL )
+    {
+        return;
+    }
+
+    HW_CAN_Stats_Roll( stats, now_us );
+    if ( arbitration_lost )
+    {
+        HW_CAN_Stats_Lost_Arbitration( &stats->stats, id, extended );
+    }
+    if ( transmit_error )
+    {
+        HW_CAN_Stats_Add( &stats->stats.tx_errors, 1U );
+    }
+    if ( sent )
+    {
+        HW_CAN_Stats_Count( stats, 1U, HW_CAN_Stats_Frame_Bits( extended, dlc ),
+                            HW_CAN_Stats_Stuff_Bits( extended, dlc ) );
+        HW_CAN_Stats_Add( &stats->stats.tx_frames, 1U );
+        HW_CAN_Stats_Bus_On( stats, now_us );
+    }
+}
+
+void HW_CAN_Stats_Error( HW_CAN_Stats_T* stats, const HW_CAN_Stats_Error_State_T* state,
+                         uint32_t now_us )
+{
+    if ( stats == NULL || state == NULL )
+    {
+        return;
+    }
+
+    HW_CAN_Stats_Set_Error_State( &stats->stats, state );
+    if ( state->last_error != 0U )
+    {
+        HW_CAN_Stats_Add( &stats->stats.bus_errors, 1U );
+        stats->stats.last_error_code = state->last_error;
+    }
+    if ( state->bus_off && !stats->bus_off_pending )
+    {
+        HW_CAN_Stats_Add( &stats->stats.bus_off_count, 1U );
+        stats->bus_off_pending = true;
+        stats->bus_off_us      = now_us;
+    }
+}
+
+void HW_CAN_Stats_Snapshot( HW_CAN_Stats_T* stats, const HW_CAN_Stats_Error_State_T* state,
+                            uint32_t now_us, HW_CAN_Bus_Stats_T* snapshot )
+{
+    if ( stats == NULL || state == NULL || snapshot == NULL )
+    {
+        return;
+    }
+
+    HW_CAN_Stats_Roll( stats, now_us );
+    HW_CAN_Stats_Set_Error_State( &stats->stats, state );
+    if ( !state->bus_off )
+    {
+        HW_CAN_Stats_Bus_On( stats, now_us );
+    }
+
+    *snapshot = stats->stats;
+}
@@ -0,0 +1,265 @@
+/******************************************************************************
+ *  File:       hw_can_stats.h
+ *  Author:     Timothy Vogelsang
+ *  Created:    18-Oct-2026
+ *
+ *  Description:
+ *      Per-channel CAN traffic, error-counter and arbitration statistics.
+ *
+ *      Counts the frames a channel transmits and receives, converts them to
+ *      bits on the wire and keeps frame, bit and drop rates over a rolling
+ *      window of about one second. The bit rate of the window against the
+ *      configured bitrate gives the bus load. Alongside the traffic figures
+ *      it keeps the error counters, lost arbitrations by identifier and
+ *      bus-off events with the time each took to recover.
+ *
+ *  Notes:
+ *      Pure logic; hw_can.c feeds it from the transmit, receive and error
+ *      interrupts and reads the error register when a snapshot is taken.
+ *
+ *      Only frames this node sends or that pass its hardware filters are
+ *      counted, so a channel whose filters reject traffic reports less load
+ *      than the bus carries. Error frames and overload frames are not
+ *      counted. Stuff bits depend on the frame's content and are not visible
+ *      to software, so the load is given twice: without stuff bits, a lower
+ *      bound, and with the worst-case number of stuff bits, an upper bound.
+ *
+ *      The window closes on the first event or snapshot a full window after
+ *      it opened and its rates are taken over its actual length. A burst
+ *      followed by silence is therefore averaged over the silence until the
+ *      next snapshot; read the statistics at least once a window for a
+ *      steady picture.
+ ******************************************************************************/
+
+#ifndef HW_CAN_STATS_H
+#define HW_CAN_STATS_H
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/**-----------------------------------------------------------------------------
+ *  Includes
+ *------------------------------------------------------------------------------
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/**-----------------------------------------------------------------------------
+ *  Public Defines / Macros
+ *------------------------------------------------------------------------------
+ */
+
+/* Shortest window the rates are taken over. */
+#define HW_CAN_STATS_WINDOW_US ( 1000000U )
+
+/* Identifiers whose lost arbitrations are counted individually. */
+#define HW_CAN_STATS_MAX_ARBITRATION_IDS ( 16U )
+
+/* Bus load of a fully occupied bus. */
+#define HW_CAN_STATS_LOAD_FULL_SCALE ( 1000U )
+
+/**-----------------------------------------------------------------------------
+ *  Public Typedefs / Enums / Structures
+ *------------------------------------------------------------------------------
+ */
+
+/** @brief Lost arbitrations of one transmitted identifier. */
+typedef struct HW_CAN_Stats_Id_Count_T
+{
+    uint32_t id;
+    bool     extended;
+    uint32_t count;
+
+} HW_CAN_Stats_Id_Count_T;
+
+/**
+ * @brief Error state of a controller, decoded from its error status register.
+ *
+ * last_error is the bxCAN last error code, 1 to 6 for a bus error and zero
+ * when none was recorded.
+ */
+typedef struct HW_CAN_Stats_Error_State_T
+{
+    uint8_t tec;
+    uint8_t rec;
+    uint8_t last_error;
+    bool    warning;
+    bool    passive;
+    bool    bus_off;
+
+} HW_CAN_Stats_Error_State_T;
+
+/**
+ * @brief Frames received in one interrupt, totalled before they are counted.
+ */
+typedef struct HW_CAN_Stats_Tally_T
+{
+    uint32_t frames;
+    uint32_t bits;
+    uint32_t stuff_bits;
+
+} HW_CAN_Stats_Tally_T;
+
+/**
+ * @brief Statistics of one channel.
+ *
+ * Totals count from the last reset. rx_frames includes frames a software
+ * filter later discards. bits counts frames without stuff bits and
+ * stuff_bits the worst-case stuff bits of the same frames.
+ *
+ * The rates and loads come from the last closed window, which was window_us
+ * long, and are zero until the first window closes. bus_load_permille
+ * leaves out stuff bits and bus_load_max_permille assumes the worst case, so
+ * the true load lies between the two. peak_load_permille is the highest
+ * bus_load_max_permille of any window.
+ *
+ * tec, rec, error_warning, error_passive and bus_off are the error state when
+ * the snapshot was taken; peak_tec and peak_rec are the highest counters seen
+ * at an error interrupt or a snapshot. bus_errors counts error interrupts
+ * that recorded a bus error and last_error_code is the most recent one.
+ *
+ * arbitration_lost and tx_errors count transmissions that completed with the
+ * arbitration-lost or transmit-error flag set. bxCAN keeps only the outcome
+ * of a frame's last attempt, so a frame that lost arbitration and was
+ * retransmitted counts once at most. The first HW_CAN_STATS_MAX_ARBITRATION_IDS
+ * identifiers to lose arbitration are counted individually in
+ * arbitration_ids; losses of later identifiers go to arbitration_untracked.
+ *
+ * bus_off_count counts entries to bus-off. A bus-off has recovered at the
+ * first frame sent or received after it, or at a snapshot that finds the
+ * controller back on the bus; last_recovery_us and max_recovery_us are
+ * measured from the bus-off interrupt to that point.
+ *
+ * rx_dropped counts received frames lost to a full receive queue or a FIFO
+ * overrun; an overrun counts once however many frames it lost.
+ */
+typedef struct HW_CAN_Bus_Stats_T
+{
+    uint32_t                tx_frames;
+    uint32_t                rx_frames;
+    uint64_t                bits;
+    uint64_t                stuff_bits;
+    uint32_t                window_us;
+    uint32_t                frames_per_s;
+    uint32_t                bits_per_s;
+    uint16_t                bus_load_permille;
+    uint16_t                bus_load_max_permille;
+    uint16_t                peak_load_permille;
+    uint8_t                 tec;
+    uint8_t                 rec;
+    uint8_t                 peak_tec;
+    uint8_t                 peak_rec;
+    bool                    error_warning;
+    bool                    error_passive;
+    bool                    bus_off;
+    uint8_t                 last_error_code;
+    uint32_t                bus_errors;
+    uint32_t                arbitration_lost;
+    uint32_t                tx_errors;
+    uint8_t                 arbitration_id_count;
+    HW_CAN_Stats_Id_Count_T arbitration_ids[HW_CAN_STATS_MAX_ARBITRATION_IDS];
+    uint32_t                arbitration_untracked;
+    uint32_t                bus_off_count;
+    uint32_t                last_recovery_us;
+    uint32_t                max_recovery_us;
+    uint32_t                rx_dropped;
+    uint32_t                rx_dropped_per_s;
+
+} HW_CAN_Bus_Stats_T;
+
+/**
+ * @brief Statistics collector of one channel.
+ *
+ * The window fields total the events since window_start_us. bus_off_us is
+ * the time of the bus-off interrupt while bus_off_pending is set.
+ */
+typedef struct HW_CAN_Stats_T
+{
+    uint32_t           bitrate;
+    uint32_t           window_start_us;
+    uint32_t           window_frames;
+    uint32_t           window_bits;
+    uint32_t           window_stuff_bits;
+    uint32_t           window_dropped;
+    uint32_t           bus_off_us;
+    bool               bus_off_pending;
+    HW_CAN_Bus_Stats_T stats;
+
+} HW_CAN_Stats_T;
+
+/**-----------------------------------------------------------------------------
+ *  Public Function Prototypes
+ *------------------------------------------------------------------------------
+ */
+
+/**
+ * @brief Clears all statistics and opens a new window at now_us.
+ *
+ * @param bitrate Bitrate the channel runs at; zero leaves the loads at zero.
+ */
+void HW_CAN_Stats_Reset( HW_CAN_Stats_T* stats, uint32_t bitrate, uint32_t now_us );
+
+/**
+ * @brief Bits of a data frame on the wire, without stuff bits, from its start
+ *        of frame to the end of the following intermission.
+ */
+uint32_t HW_CAN_Stats_Frame_Bits( bool extended, uint8_t dlc );
+
+/**
+ * @brief Largest number of stuff bits a data frame can carry.
+ */
+uint32_t HW_CAN_Stats_Stuff_Bits( bool extended, uint8_t dlc );
+
+/**
+ * @brief Adds one frame to a tally.
+ */
+void HW_CAN_Stats_Tally_Frame( HW_CAN_Stats_Tally_T* tally, bool extended, uint8_t dlc );
+
+/**
+ * @brief Counts the frames received and dropped by one receive interrupt.
+ *
+ * A received frame ends a pending bus-off.
+ *
+ * @param tally   Frames accepted, including any dropped for a full queue.
+ * @param dropped Frames and overruns lost.
+ */
+void HW_CAN_Stats_Rx( HW_CAN_Stats_T* stats, const HW_CAN_Stats_Tally_T* tally,
+                      uint32_t dropped, uint32_t now_us );
+
+/**
+ * @brief Counts one completed transmit request.
+ *
+ * A frame counts towards the traffic when sent is set, which also ends a
+ * pending bus-off. arbitration_lost and transmit_error are the completion's
+ * flags. A request that completed with none of the three set was aborted and
+ * is not counted.
+ */
+void HW_CAN_Stats_Tx( HW_CAN_Stats_T* stats, uint32_t id, bool extended, uint8_t dlc, bool sent,
+                      bool arbitration_lost, bool transmit_error, uint32_t now_us );
+
+/**
+ * @brief Records the error state read by an error interrupt.
+ *
+ * Counts a bus error when one was recorded, and starts a bus-off when the
+ * controller has newly gone bus-off.
+ */
+void HW_CAN_Stats_Error( HW_CAN_Stats_T* stats, const HW_CAN_Stats_Error_State_T* state,
+                         uint32_t now_us );
+
+/**
+ * @brief Closes the window if due and copies the statistics.
+ *
+ * state is the controller's current error state; it ends a pending bus-off
+ * once the controller is back on the bus.
+ */
+void HW_CAN_Stats_Snapshot( HW_CAN_Stats_T* stats, const HW_CAN_Stats_Error_State_T* state,
+                            uint32_t now_us, HW_CAN_Bus_Stats_T* snapshot );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HW_CAN_STATS_H */
@@ -0,0 +1,115 @@
+/******************************************************************************
+ *  File:       hw_can_time.c
+ *  Author:     Timothy Vogelsang
+ *  Created:    18-Oct-2026
+ *
+ *  Description:
+ *      Implementation of the CAN timestamp extension.
+ *
+ *  Notes:
+    A frame stamped at s and serviced at now_us puts the counter at no less
+    than s + frame_bits at now_us:
+
+        counter   s                 s + frame_bits       predicted
+                  |---- frame ------|----- latency -----|
+        time      SOF                                    now_us
+
+    The anchor predicts the counter at now_us. A bound ahead of the prediction
+    means the anchor was taken with more latency than this frame, so the frame
+    becomes the new anchor. The frame's age is then predicted - s bit times,
+    taken modulo the 16-bit counter.
+ ******************************************************************************/
+
+/**-----------------------------------------------------------------------------
+ *  Includes
+ *------------------------------------------------------------------------------
+ */
+
+#include "hw_can_time.h"
+#include <stddef.h>
+
+/**-----------------------------------------------------------------------------
+ *  Defines / Macros
+ *------------------------------------------------------------------------------
+ */
+
+/* SOF, identifier, control field, CRC, ACK and the six EOF bits before a frame is accepted. */
+#define HW_CAN_TIME_STANDARD_FRAME_BITS ( 43U )
+#define HW_CAN_TIME_EXTENDED_FRAME_BITS ( 63U )
+
+#define HW_CAN_TIME_US_PER_S ( 1000000U )
+
+/* Counter differences at or above this are behind, not ahead. */
+#define HW_CAN_TIME_HALF_RANGE ( 0x8000U )
+
+/**-----------------------------------------------------------------------------
+ *  Private Function Definitions
+ *------------------------------------------------------------------------------
+ */
+
+static void HW_CAN_Time_Anchor( HW_CAN_Time_Base_T* base, uint16_t bits, uint32_t now_us )
+{
+    base->anchor_bits = bits;
+    base->anchor_us   = now_us;
+    base->synced      = true;
+}
+
+/**-----------------------------------------------------------------------------
+ *  Public Function Definitions
+ *------------------------------------------------------------------------------
+ */
+
+void HW_CAN_Time_Reset( HW_CAN_Time_Base_T* base, uint32_t bitrate )
+{
+    if ( base == NULL )
+    {
+        return;
+    }
+
+    base->bitrate     = bitrate;
+    base->anchor_us   = 0U;
+    base->anchor_bits = 0U;
+    base->synced      = false;
+}
+
+uint32_t HW_CAN_Time_Frame_Bits( bool extended, uint8_t dlc )
+{
+    uint32_t header = extended ? HW_CAN_TIME_EXTENDED_FRAME_BITS : HW_CAN_TIME_STANDARD_FRAME_BITS;
+    return header + 8U * ( uint32_t )dlc;
+}
+
+uint32_t HW_CAN_Time_Extend( HW_CAN_Time_Base_T* base, uint16_t stamp, uint32_t frame_bits,
+                             uint32_t now_us )
+{
+    if ( base->bitrate == 0U )
+    {
+        return now_us;
+    }
+
+    uint16_t bound      = ( uint16_t )( stamp + frame_bits );
+    uint32_t elapsed_us = now_us - base->anchor_us;
+
+    if ( !base->synced || elapsed_us >= HW_CAN_TIME_ANCHOR_MAX_AGE_US )
+    {
+        HW_CAN_Time_Anchor( base, bound, now_us );
+    }
+    else
+    {
+        uint64_t elapsed_bits = ( uint64_t )elapsed_us * base->bitrate / HW_CAN_TIME_US_PER_S;
+        uint16_t predicted    = ( uint16_t )( base->anchor_bits + elapsed_bits );
+        uint16_t lead         = ( uint16_t )( bound - predicted );
+
+        if ( lead != 0U && lead < HW_CAN_TIME_HALF_RANGE )
+        {
+            HW_CAN_Time_Anchor( base, bound, now_us );
+        }
+        else
+        {
+            bound = predicted;
+        }
+    }
+
+    // bound is now the counter's best estimate at now_us
+    uint16_t age_bits = ( uint16_t )( bound - stamp );
+    return now_us - ( uint32_t )( ( uint64_t )age_bits * HW_CAN_TIME_US_PER_S / base->bitrate );
+}
@@ -0,0 +1,113 @@
+/******************************************************************************
+ *  File:       hw_can_time.h
+ *  Author:     Timothy Vogelsang
+ *  Created:    18-Oct-2026
+ *
+ *  Description:
+ *      Extends bxCAN time-triggered mode timestamps onto the shared 32-bit
+ *      microsecond time base.
+ *
+ *      In time-triggered mode each mailbox captures a 16-bit counter, clocked
+ *      once per CAN bit, at the start of frame. The counter wraps every 65536
+ *      bit times and has no readable live value, so it is tied to the time
+ *      base by frames as they complete.
+ *
+ *  Notes:
+ *      Pure logic; hw_can.c reads the TIME fields and the time base and
+ *      passes them in. A frame cannot complete before its shortest possible
+ *      length in bits has passed since its start, so each completion bounds
+ *      the counter's value at the moment it is serviced. The anchor keeps the
+ *      tightest bound seen, which filters out interrupt latency. The CAN
+ *      kernel and the core run from the same PLL, so the anchor does not
+ *      drift between frames.
+ ******************************************************************************/
+
+#ifndef HW_CAN_TIME_H
+#define HW_CAN_TIME_H
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/**-----------------------------------------------------------------------------
+ *  Includes
+ *------------------------------------------------------------------------------
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/**-----------------------------------------------------------------------------
+ *  Public Defines / Macros
+ *------------------------------------------------------------------------------
+ */
+
+/*
+ * Age after which the anchor is taken again from the next frame rather than
+ * projected forward. Keeps the projection well inside the 32-bit time base.
+ */
+#define HW_CAN_TIME_ANCHOR_MAX_AGE_US ( 60000000U )
+
+/**-----------------------------------------------------------------------------
+ *  Public Typedefs / Enums / Structures
+ *------------------------------------------------------------------------------
+ */
+
+/**
+ * @brief Relation between one channel's bit-time counter and the time base.
+ *
+ * When synced, the counter read anchor_bits at or slightly before anchor_us.
+ * bitrate is zero until the channel is configured.
+ */
+typedef struct HW_CAN_Time_Base_T
+{
+    uint32_t bitrate;
+    uint32_t anchor_us;
+    uint16_t anchor_bits;
+    bool     synced;
+
+} HW_CAN_Time_Base_T;
+
+/**-----------------------------------------------------------------------------
+ *  Public Function Prototypes
+ *------------------------------------------------------------------------------
+ */
+
+/**
+ * @brief Forgets the anchor and sets the bit rate the counter runs at.
+ *
+ * Call whenever the controller is configured or restarted.
+ */
+void HW_CAN_Time_Reset( HW_CAN_Time_Base_T* base, uint32_t bitrate );
+
+/**
+ * @brief Shortest length of a data frame, in bits, from its start of frame to
+ *        the point where it is accepted.
+ *
+ * Stuff bits only lengthen a frame, so the unstuffed length is a lower bound.
+ */
+uint32_t HW_CAN_Time_Frame_Bits( bool extended, uint8_t dlc );
+
+/**
+ * @brief Converts a captured start-of-frame stamp to the time base.
+ *
+ * Must be called for a frame that has completed, with the time it was
+ * serviced. Completions feed the anchor, so call it for every completed frame
+ * in the order they are serviced.
+ *
+ * @param stamp       TIME field of the frame's mailbox.
+ * @param frame_bits  HW_CAN_Time_Frame_Bits() for the frame.
+ * @param now_us      Time base reading taken after the frame completed.
+ *
+ * @return Start of frame on the time base, or now_us before the channel has a
+ *         bit rate.
+ */
+uint32_t HW_CAN_Time_Extend( HW_CAN_Time_Base_T* base, uint16_t stamp, uint32_t frame_bits,
+                             uint32_t now_us );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HW_CAN_TIME_H */
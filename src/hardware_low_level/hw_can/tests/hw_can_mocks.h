@@ -74,8 +74,11 @@ extern "C"
 
 /* Filters */
 #define CAN_FILTERMODE_IDMASK ( 0U )
-#define CAN_FILTERSCALE_32BIT ( 0U )
+#define CAN_FILTERMODE_IDLIST ( 1U )
+#define CAN_FILTERSCALE_16BIT ( 0U )
+#define CAN_FILTERSCALE_32BIT ( 1U )
 #define CAN_FILTER_FIFO0 ( 0U )
+#define CAN_FILTER_FIFO1 ( 1U )
 
 /* Register bits */
 #define CAN_TSR_RQCP0 ( 1U << 0 )
@@ -98,17 +101,28 @@ extern "C"
 #define CAN_TSR_TME2 ( 1U << 28 )
 #define CAN_TSR_TME ( CAN_TSR_TME0 | CAN_TSR_TME1 | CAN_TSR_TME2 )
 #define CAN_TI0R_TXRQ ( 1U << 0 )
+#define CAN_TDT0R_DLC ( 0xFU )
+#define CAN_TDT0R_TIME_Pos ( 16U )
+#define CAN_TI0R_IDE ( 1U << 2 )
 #define CAN_RI0R_RTR ( 1U << 1 )
 #define CAN_RI0R_IDE ( 1U << 2 )
 #define CAN_RDT0R_DLC ( 0xFU )
+#define CAN_RDT0R_TIME_Pos ( 16U )
 #define CAN_RF0R_FMP0 ( 0x3U )
 #define CAN_RF0R_FULL0 ( 1U << 3 )
 #define CAN_RF0R_FOVR0 ( 1U << 4 )
 #define CAN_RF0R_RFOM0 ( 1U << 5 )
+#define CAN_RF1R_FMP1 ( 0x3U )
+#define CAN_RF1R_FULL1 ( 1U << 3 )
+#define CAN_RF1R_FOVR1 ( 1U << 4 )
+#define CAN_RF1R_RFOM1 ( 1U << 5 )
 #define CAN_IER_TMEIE ( 1U << 0 )
 #define CAN_IER_FMPIE0 ( 1U << 1 )
 #define CAN_IER_FFIE0 ( 1U << 2 )
 #define CAN_IER_FOVIE0 ( 1U << 3 )
+#define CAN_IER_FMPIE1 ( 1U << 4 )
+#define CAN_IER_FFIE1 ( 1U << 5 )
+#define CAN_IER_FOVIE1 ( 1U << 6 )
 #define CAN_IER_EWGIE ( 1U << 8 )
 #define CAN_IER_EPVIE ( 1U << 9 )
 #define CAN_IER_BOFIE ( 1U << 10 )
@@ -122,6 +136,11 @@ extern "C"
 #define CAN_ESR_LEC_0 ( 1U << 4 )
 #define CAN_ESR_LEC_1 ( 1U << 5 )
 #define CAN_ESR_LEC_2 ( 1U << 6 )
+#define CAN_ESR_LEC_Pos ( 4U )
+#define CAN_ESR_TEC_Pos ( 16U )
+#define CAN_ESR_TEC ( 0xFFU << CAN_ESR_TEC_Pos )
+#define CAN_ESR_REC_Pos ( 24U )
+#define CAN_ESR_REC ( 0xFFU << CAN_ESR_REC_Pos )
 
 /* Helpers */
 #define SET_BIT( REG, BIT ) ( ( REG ) |= ( BIT ) )
@@ -151,6 +170,10 @@ enum
     CAN2_RX0_IRQn,
     CAN1_SCE_IRQn,
     CAN2_SCE_IRQn,
+    CAN1_RX1_IRQn,
+    CAN2_RX1_IRQn,
+    TIM8_UP_TIM13_IRQn,
+    TIM1_CC_IRQn,
 };
 
 typedef struct
@@ -258,6 +281,10 @@ void NVIC_DisableIRQ( IRQn_Type irq );
 
 void NVIC_EnableIRQ( IRQn_Type irq );
 
+uint32_t NVIC_GetPriority( IRQn_Type irq );
+
+void NVIC_SetPriority( IRQn_Type irq, uint32_t priority );
+
 // NOLINTEND
 
 #ifdef __cplusplus
@@ -21,7 +21,15 @@ extern "C"
 #include <string.h>
 }
 
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
 #include <cstring>
+#include <limits>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
 
 extern "C"
 {
@@ -30,6 +38,7 @@ extern "C"
 
 using ::testing::_;
 using ::testing::DoAll;
+using ::testing::Invoke;
 using ::testing::Return;
 using ::testing::SaveArg;
 
@@ -48,7 +57,34 @@ CAN_HandleTypeDef hcan1{};
 /* HAL CAN handle associated with the fake CAN2 peripheral instance. */
 CAN_HandleTypeDef hcan2{};
 
-static bool nvic_irq_enabled[6] = {};
+static bool     nvic_irq_enabled[TIM1_CC_IRQn + 1]   = {};
+static uint32_t nvic_priority[TIM1_CC_IRQn + 1]      = {};
+static uint32_t nvic_disable_count[TIM1_CC_IRQn + 1] = {};
+
+/* Cyclic tick timer and shared time base capture. */
+#define TEST_HW_CAN_CYCLE_CLOCK_HZ 180000000U
+#define TEST_HW_CAN_TIMER_CLOCK_HZ 90000000U
+
+static uint32_t mock_timer_configure_count = 0U;
+static uint32_t mock_timer_start_count     = 0U;
+static uint32_t mock_timer_stop_count      = 0U;
+static uint32_t mock_timer_psc             = 0U;
+static uint32_t mock_timer_arr             = 0U;
+static uint32_t mock_time_us               = 0U;
+
+/* Replay one-shot timer capture. */
+static uint32_t mock_replay_timer_start_count = 0U;
+static uint32_t mock_replay_timer_stop_count  = 0U;
+static uint32_t mock_replay_timer_arr         = 0U;
+
+/* Scratch schedule for the scheduler-only tests; too large for the stack. */
+static HW_CAN_Cyclic_Schedule_T test_schedule;
+
+/* Scratch table for the responder-only tests. */
+static HW_CAN_Responder_T test_responder;
+
+/* Scratch replay for the reader-only tests. */
+static HW_CAN_Replay_T test_replay;
 
 /**-----------------------------------------------------------------------------
  *  Test Helpers
@@ -94,6 +130,376 @@ static void ResetCANBuffers()
     can_tx_pending_mailbox2 = 0;
     can_tx_status1          = HW_CAN_TX_STATUS_IDLE;
     can_tx_status2          = HW_CAN_TX_STATUS_IDLE;
+
+    memset( &can_filter_plan1, 0, sizeof( can_filter_plan1 ) );
+    memset( &can_filter_plan2, 0, sizeof( can_filter_plan2 ) );
+    can_filter_can2_first_bank = 14U;
+    memset( &can_filter_single1, 0, sizeof( can_filter_single1 ) );
+    memset( &can_filter_single2, 0, sizeof( can_filter_single2 ) );
+
+    can_cyclic1.running          = false;
+    can_cyclic1.mailbox_reserved = false;
+    can_cyclic2.running          = false;
+    can_cyclic2.mailbox_reserved = false;
+    HW_CAN_Cyclic_Clear( &can_cyclic1.schedule );
+    HW_CAN_Cyclic_Clear( &can_cyclic2.schedule );
+    HW_CAN_Cyclic_Clear( &test_schedule );
+
+    can_responder1.running          = false;
+    can_responder1.mailbox_reserved = false;
+    can_responder2.running          = false;
+    can_responder2.mailbox_reserved = false;
+    HW_CAN_Responder_Clear( &can_responder1.responder );
+    HW_CAN_Responder_Clear( &can_responder2.responder );
+    HW_CAN_Responder_Clear( &test_responder );
+
+    can_replay1.running          = false;
+    can_replay1.mailbox_reserved = false;
+    can_replay2.running          = false;
+    can_replay2.mailbox_reserved = false;
+    HW_CAN_Replay_Clear( &can_replay1.replay );
+    HW_CAN_Replay_Clear( &can_replay2.replay );
+    HW_CAN_Replay_Clear( &test_replay );
+    mock_replay_timer_start_count = 0U;
+    mock_replay_timer_stop_count  = 0U;
+    mock_replay_timer_arr         = 0U;
+
+    mock_timer_configure_count = 0U;
+    mock_timer_start_count     = 0U;
+    mock_timer_stop_count      = 0U;
+    mock_timer_psc             = 0U;
+    mock_timer_arr             = 0U;
+    mock_time_us               = 0U;
+
+    memset( &can_time1, 0, sizeof( can_time1 ) );
+    memset( &can_time2, 0, sizeof( can_time2 ) );
+    HW_CAN_Stats_Reset( &can_stats1, 0U, 0U );
+    HW_CAN_Stats_Reset( &can_stats2, 0U, 0U );
+}
+
+/** Complete the frame in one mailbox as acknowledged and run the channel 1 TX vector. */
+static void CompleteMailbox1( uint8_t mailbox )
+{
+    static const uint32_t complete_flags[3] = {
+        CAN_TSR_RQCP0 | CAN_TSR_TXOK0 | CAN_TSR_TME0,
+        CAN_TSR_RQCP1 | CAN_TSR_TXOK1 | CAN_TSR_TME1,
+        CAN_TSR_RQCP2 | CAN_TSR_TXOK2 | CAN_TSR_TME2,
+    };
+    mock_can1_regs.TSR |= complete_flags[mailbox];
+    CAN1_TX_IRQHandler();
+}
+
+/** Deliver one standard data frame through the channel 1 FIFO0 vector. */
+static void ReceiveFrame1( uint32_t id, const uint8_t data[], uint8_t dlc )
+{
+    uint8_t payload[CAN_PACKET_SIZE] = {};
+    memcpy( payload, data, dlc );
+
+    mock_can1_regs.RF0R                 = 1U;
+    mock_can1_regs.sFIFOMailBox[0].RIR  = id << 21;
+    mock_can1_regs.sFIFOMailBox[0].RDTR = dlc;
+    mock_can1_regs.sFIFOMailBox[0].RDLR = payload[0] | ( payload[1] << 8 ) | ( payload[2] << 16 )
+                                          | ( static_cast<uint32_t>( payload[3] ) << 24 );
+    mock_can1_regs.sFIFOMailBox[0].RDHR = payload[4] | ( payload[5] << 8 ) | ( payload[6] << 16 )
+                                          | ( static_cast<uint32_t>( payload[7] ) << 24 );
+    CAN1_RX0_IRQHandler();
+}
+
+/** Append a little-endian field of count bytes. */
+static void AppendLe( std::vector<uint8_t>& bytes, uint32_t value, uint8_t count )
+{
+    for ( uint8_t i = 0U; i < count; i++ )
+    {
+        bytes.push_back( static_cast<uint8_t>( value >> ( i * 8U ) ) );
+    }
+}
+
+/** Start a compact replay log with the given header fields. */
+static std::vector<uint8_t> ReplayLogHeader( uint32_t frame_count, uint32_t pass_us )
+{
+    std::vector<uint8_t> log = { 'C', 'A', 'N', 'R', HW_CAN_REPLAY_VERSION, 0, 0, 0 };
+    AppendLe( log, frame_count, 4U );
+    AppendLe( log, pass_us, 4U );
+    return log;
+}
+
+/** Append one replay record using the narrowest delta field. */
+static void AppendReplayRecord( std::vector<uint8_t>& log, uint32_t delta_us, uint32_t id,
+                                bool extended, std::vector<uint8_t> data )
+{
+    uint8_t delta_bytes = delta_us > 0xFFFFFFU ? 4U
+                          : delta_us > 0xFFFFU ? 3U
+                          : delta_us > 0xFFU   ? 2U
+                                               : 1U;
+    log.push_back( static_cast<uint8_t>(
+        data.size() | ( ( delta_bytes - 1U ) << HW_CAN_REPLAY_TAG_DELTA_SHIFT )
+        | ( extended ? HW_CAN_REPLAY_TAG_EXTENDED : 0U ) ) );
+    AppendLe( log, delta_us, delta_bytes );
+    AppendLe( log, id, extended ? 4U : 2U );
+    log.insert( log.end(), data.begin(), data.end() );
+}
+
+/** Three-frame trace: 0x100 at 0 us, 0x18DAF110 at 300 us, 0x200 at 70300 us. */
+static std::vector<uint8_t> ReplayTestLog()
+{
+    std::vector<uint8_t> log = ReplayLogHeader( 3U, 100000U );
+    AppendReplayRecord( log, 0U, 0x100, false, { 0x11, 0x22 } );
+    AppendReplayRecord( log, 300U, 0x18DAF110, true, { 0x33 } );
+    AppendReplayRecord( log, 70000U, 0x200, false, {} );
+    return log;
+}
+
+/** Identifiers released by one scheduler tick, in ready order. */
+static std::vector<uint32_t> TickAndDrain( HW_CAN_Cyclic_Schedule_T* schedule, uint32_t now )
+{
+    std::vector<uint32_t> released;
+
+    HW_CAN_Cyclic_Tick( schedule, now );
+    for ( uint16_t index = HW_CAN_Cyclic_Pop_Ready( schedule ); index != HW_CAN_CYCLIC_NONE;
+          index          = HW_CAN_Cyclic_Pop_Ready( schedule ) )
+    {
+        released.push_back( schedule->messages[index].id );
+        HW_CAN_Cyclic_Complete( schedule, now, true );
+    }
+    return released;
+}
+
+/** Build the RIR-layout word of a data frame, as compared by 32-bit filters. */
+static uint32_t FrameWord( uint32_t id, bool extended )
+{
+    return extended ? ( id << 3U ) | CAN_RI0R_IDE : id << 21U;
+}
+
+/** Build the STID, RTR, IDE, EXID[17:15] half of a data frame, as compared by 16-bit filters. */
+static uint16_t FrameHalf( uint32_t id, bool extended )
+{
+    uint32_t stid = extended ? id >> 18U : id;
+    uint32_t exid = extended ? ( id >> 15U ) & 0x7U : 0U;
+    return static_cast<uint16_t>( ( stid << 5U ) | ( extended ? 0x8U : 0U ) | exid );
+}
+
+/** Reference bxCAN acceptance check for one bank register image. */
+static bool BankAccepts( const HW_CAN_Filter_Bank_T& bank, uint32_t id, bool extended )
+{
+    if ( bank.scale_32bit )
+    {
+        /* Bit 0 of the 32-bit filter registers is reserved. */
+        uint32_t word = FrameWord( id, extended );
+        if ( bank.list_mode )
+        {
+            return ( ( word ^ bank.fr1 ) & ~1U ) == 0U || ( ( word ^ bank.fr2 ) & ~1U ) == 0U;
+        }
+        return ( ( word ^ bank.fr1 ) & bank.fr2 & ~1U ) == 0U;
+    }
+
+    uint16_t half     = FrameHalf( id, extended );
+    uint16_t slots[4] = {
+        static_cast<uint16_t>( bank.fr1 & 0xFFFFU ),
+        static_cast<uint16_t>( bank.fr1 >> 16U ),
+        static_cast<uint16_t>( bank.fr2 & 0xFFFFU ),
+        static_cast<uint16_t>( bank.fr2 >> 16U ),
+    };
+    if ( bank.list_mode )
+    {
+        return half == slots[0] || half == slots[1] || half == slots[2] || half == slots[3];
+    }
+    return ( ( half ^ slots[0] ) & slots[1] ) == 0U || ( ( half ^ slots[2] ) & slots[3] ) == 0U;
+}
+
+/** Rebuild a bank register image from the fields handed to HAL_CAN_ConfigFilter(). */
+static HW_CAN_Filter_Bank_T BankFromHAL( const CAN_FilterTypeDef& filter )
+{
+    HW_CAN_Filter_Bank_T bank = {};
+    bank.list_mode            = filter.FilterMode == CAN_FILTERMODE_IDLIST;
+    bank.scale_32bit          = filter.FilterScale == CAN_FILTERSCALE_32BIT;
+    if ( bank.scale_32bit )
+    {
+        bank.fr1 = ( filter.FilterIdHigh << 16U ) | filter.FilterIdLow;
+        bank.fr2 = ( filter.FilterMaskIdHigh << 16U ) | filter.FilterMaskIdLow;
+    }
+    else
+    {
+        bank.fr1 = ( filter.FilterMaskIdLow << 16U ) | filter.FilterIdLow;
+        bank.fr2 = ( filter.FilterMaskIdHigh << 16U ) | filter.FilterIdHigh;
+    }
+    return bank;
+}
+
+/** Reference rule matcher over the caller's original, unnormalised rules. */
+static bool RulesAccept( const std::vector<HW_CAN_Filter_Rule_T>& rules, uint32_t id,
+                         bool extended )
+{
+    for ( const HW_CAN_Filter_Rule_T& rule : rules )
+    {
+        if ( rule.extended == extended && id >= rule.first_id && id <= rule.last_id )
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+/** Count the distinct identifiers accepted by a rule set. */
+static uint64_t RuleIdCount( const std::vector<HW_CAN_Filter_Rule_T>& rules )
+{
+    std::vector<std::pair<uint64_t, uint64_t>> spans;
+    for ( const HW_CAN_Filter_Rule_T& rule : rules )
+    {
+        uint64_t offset = rule.extended ? ( 1ULL << 32U ) : 0U;
+        spans.emplace_back( offset + rule.first_id, offset + rule.last_id );
+    }
+    std::sort( spans.begin(), spans.end() );
+
+    uint64_t count = 0U;
+    uint64_t next  = 0U;
+    for ( const auto& span : spans )
+    {
+        uint64_t first = std::max( span.first, next );
+        if ( first <= span.second )
+        {
+            count += span.second - first + 1U;
+            next = span.second + 1U;
+        }
+    }
+    return count;
+}
+
+/**
+ * Check a plan's banks and software check against the reference matchers.
+ *
+ * Every standard identifier is checked. Extended identifiers are checked at
+ * and around every rule edge and at random points near the rules and across
+ * the whole 29-bit space.
+ */
+static ::testing::AssertionResult
+PlanMatchesRules( const HW_CAN_Filter_Plan_T& plan, const HW_CAN_Filter_Bank_T* banks,
+                  uint8_t bank_count, const std::vector<HW_CAN_Filter_Rule_T>& rules )
+{
+    std::vector<std::pair<uint32_t, bool>> ids;
+    for ( uint32_t id = 0U; id <= CAN_STANDARD_ID_MAX; id++ )
+    {
+        ids.emplace_back( id, false );
+    }
+
+    std::mt19937 rng( 1234U );
+    for ( const HW_CAN_Filter_Rule_T& rule : rules )
+    {
+        if ( !rule.extended )
+        {
+            continue;
+        }
+        for ( uint32_t edge : { rule.first_id, rule.last_id } )
+        {
+            for ( int64_t delta = -2; delta <= 2; delta++ )
+            {
+                int64_t id = static_cast<int64_t>( edge ) + delta;
+                if ( id >= 0 && id <= static_cast<int64_t>( CAN_EXTENDED_ID_MAX ) )
+                {
+                    ids.emplace_back( static_cast<uint32_t>( id ), true );
+                }
+            }
+        }
+        std::uniform_int_distribution<uint32_t> near(
+            rule.first_id > 4096U ? rule.first_id - 4096U : 0U,
+            std::min<uint32_t>( rule.last_id + 4096U, CAN_EXTENDED_ID_MAX ) );
+        for ( int i = 0; i < 256; i++ )
+        {
+            ids.emplace_back( near( rng ), true );
+        }
+    }
+    std::uniform_int_distribution<uint32_t> anywhere( 0U, CAN_EXTENDED_ID_MAX );
+    for ( int i = 0; i < 1024; i++ )
+    {
+        ids.emplace_back( anywhere( rng ), true );
+    }
+
+    for ( const auto& [id, extended] : ids )
+    {
+        bool expected = RulesAccept( rules, id, extended );
+        bool hardware = false;
+        for ( uint8_t bank = 0U; bank < bank_count; bank++ )
+        {
+            hardware = hardware || BankAccepts( banks[bank], id, extended );
+        }
+        bool software = plan.software_ids == 0U || HW_CAN_Filter_Accepts( &plan, id, extended );
+
+        if ( expected && !hardware )
+        {
+            return ::testing::AssertionFailure() << "hardware rejects accepted id 0x" << std::hex
+                                                 << id << ( extended ? "x" : "" );
+        }
+        if ( ( hardware && software ) != expected )
+        {
+            return ::testing::AssertionFailure()
+                   << "filter accepts unlisted id 0x" << std::hex << id << ( extended ? "x" : "" );
+        }
+    }
+
+    if ( static_cast<uint64_t>( plan.hardware_ids ) + plan.software_ids != RuleIdCount( rules ) )
+    {
+        return ::testing::AssertionFailure()
+               << "hardware_ids " << plan.hardware_ids << " + software_ids " << plan.software_ids
+               << " != " << RuleIdCount( rules );
+    }
+
+    return ::testing::AssertionSuccess();
+}
+
+/** Pack one plan within a budget and check it against the reference matchers. */
+static ::testing::AssertionResult PackMatchesRules( HW_CAN_Filter_Plan_T&                    plan,
+                                                    const std::vector<HW_CAN_Filter_Rule_T>& rules,
+                                                    uint8_t budget )
+{
+    if ( !HW_CAN_Filter_Set_Rules( &plan, rules.data(), static_cast<uint16_t>( rules.size() ) ) )
+    {
+        return ::testing::AssertionFailure() << "rules rejected";
+    }
+    if ( !HW_CAN_Filter_Pack( &plan, budget ) )
+    {
+        return ::testing::AssertionFailure() << "pack failed";
+    }
+    if ( plan.bank_count > budget )
+    {
+        return ::testing::AssertionFailure() << "used " << +plan.bank_count << " banks";
+    }
+
+    HW_CAN_Filter_Bank_T banks[HW_CAN_FILTER_BANK_COUNT] = {};
+    uint8_t              count = HW_CAN_Filter_Build_Banks( &plan, banks );
+    if ( count != plan.bank_count )
+    {
+        return ::testing::AssertionFailure() << "built " << +count << " banks";
+    }
+    return PlanMatchesRules( plan, banks, count, rules );
+}
+
+/** Draw a random rule set mixing single identifiers, short ranges, and wide ranges. */
+static std::vector<HW_CAN_Filter_Rule_T> RandomRules( std::mt19937& rng, size_t count )
+{
+    std::vector<HW_CAN_Filter_Rule_T> rules;
+    for ( size_t i = 0U; i < count; i++ )
+    {
+        bool     extended = ( rng() & 1U ) != 0U;
+        uint32_t max      = extended ? CAN_EXTENDED_ID_MAX : CAN_STANDARD_ID_MAX;
+        uint32_t first    = std::uniform_int_distribution<uint32_t>( 0U, max )( rng );
+        uint32_t length   = 1U;
+        switch ( rng() % 3U )
+        {
+            case 1U:
+                length = std::uniform_int_distribution<uint32_t>( 2U, 64U )( rng );
+                break;
+            case 2U:
+            {
+                uint32_t longest = extended ? 1U << 20U : 0x200U;
+                length           = std::uniform_int_distribution<uint32_t>( 2U, longest )( rng );
+                break;
+            }
+            default:
+                break;
+        }
+        uint32_t last = max - first < length - 1U ? max : first + length - 1U;
+        rules.push_back( { first, last, extended } );
+    }
+    return rules;
 }
 
 /**-----------------------------------------------------------------------------
@@ -152,6 +558,7 @@ extern "C" uint32_t NVIC_GetEnableIRQ( IRQn_Type irq )
 extern "C" void NVIC_DisableIRQ( IRQn_Type irq )
 {
     nvic_irq_enabled[irq] = false;
+    nvic_disable_count[irq]++;
 }
 
 extern "C" void NVIC_EnableIRQ( IRQn_Type irq )
@@ -159,6 +566,77 @@ extern "C" void NVIC_EnableIRQ( IRQn_Type irq )
     nvic_irq_enabled[irq] = true;
 }
 
+extern "C" uint32_t NVIC_GetPriority( IRQn_Type irq )
+{
+    return nvic_priority[irq];
+}
+
+extern "C" void NVIC_SetPriority( IRQn_Type irq, uint32_t priority )
+{
+    nvic_priority[irq] = priority;
+}
+
+extern "C" void HW_TIMER_Configure_Timer( Timer_T timer, uint32_t psc, uint32_t arr )
+{
+    if ( timer == CAN_REPLAY_TIMER )
+    {
+        EXPECT_EQ( psc + 1U, TEST_HW_CAN_TIMER_CLOCK_HZ / 1000000U );
+        mock_replay_timer_arr = arr;
+        return;
+    }
+    EXPECT_EQ( timer, CAN_CYCLIC_TIMER );
+    mock_timer_configure_count++;
+    mock_timer_psc = psc;
+    mock_timer_arr = arr;
+}
+
+extern "C" void HW_TIMER_Start_Timer( Timer_T timer )
+{
+    if ( timer == CAN_REPLAY_TIMER )
+    {
+        mock_replay_timer_start_count++;
+        return;
+    }
+    EXPECT_EQ( timer, CAN_CYCLIC_TIMER );
+    mock_timer_start_count++;
+}
+
+extern "C" void HW_TIMER_Stop_Timer( Timer_T timer )
+{
+    if ( timer == CAN_REPLAY_TIMER )
+    {
+        mock_replay_timer_stop_count++;
+        return;
+    }
+    EXPECT_EQ( timer, CAN_CYCLIC_TIMER );
+    mock_timer_stop_count++;
+}
+
+extern "C" uint32_t HW_TIMER_Get_Clock_Hz( Timer_T timer )
+{
+    ( void )timer;
+    return TEST_HW_CAN_TIMER_CLOCK_HZ;
+}
+
+extern "C" void HW_TIMER_Start_Cycle_Counter( void )
+{
+}
+
+extern "C" uint32_t HW_TIMER_Get_Cycle_Count( void )
+{
+    return 0U;
+}
+
+extern "C" uint32_t HW_TIMER_Get_Cycle_Clock_Hz( void )
+{
+    return TEST_HW_CAN_CYCLE_CLOCK_HZ;
+}
+
+extern "C" uint32_t HW_TIMER_Get_Time_Us( void )
+{
+    return mock_time_us;
+}
+
 /**-----------------------------------------------------------------------------
  *  Test Fixture
  *------------------------------------------------------------------------------
@@ -190,6 +668,8 @@ class HWCANTest : public ::testing::Test
         {
             enabled = true;
         }
+        memset( nvic_priority, 0, sizeof( nvic_priority ) );
+        memset( nvic_disable_count, 0, sizeof( nvic_disable_count ) );
 
         hcan1.Instance = &mock_can1_regs;
         hcan2.Instance = &mock_can2_regs;
@@ -274,7 +754,7 @@ TEST_F( HWCANTest, TransmitFailsWhenMailboxBusy )
 
     uint8_t data[8] = { 1, 2, 3, 4, 5, 6, 7, 8 };
 
-    int result = HW_CAN_Transmit1( data, 0x123, 8 );
+    int result = HW_CAN_Transmit1( data, 0x123, false, 8 );
 
     EXPECT_EQ( result, HW_CAN_RESULT_BUSY );
 }
@@ -289,7 +769,7 @@ TEST_F( HWCANTest, TransmitLoadsMailboxCorrectly )
 
     uint16_t id = 0x123;
 
-    int result = HW_CAN_Transmit1( data, id, 8 );
+    int result = HW_CAN_Transmit1( data, id, false, 8 );
 
     EXPECT_EQ( result, 0 );
 
@@ -314,7 +794,7 @@ TEST_F( HWCANTest, TransmitSupportsClassicalCANPayloadLengths )
         memset( &mock_can1_regs.sTxMailBox[0], 0xFF, sizeof( mock_can1_regs.sTxMailBox[0] ) );
         mock_can1_regs.TSR = CAN_TSR_TME0;
 
-        ASSERT_EQ( HW_CAN_Transmit1( data, 0x123, dlc ), 0 );
+        ASSERT_EQ( HW_CAN_Transmit1( data, 0x123, false, dlc ), 0 );
         EXPECT_EQ( mock_can1_regs.sTxMailBox[0].TDTR, dlc );
 
         uint32_t expected_low  = 0;
@@ -341,7 +821,7 @@ TEST_F( HWCANTest, TransmitRejectsDLCAboveEight )
     mock_can1_regs.TSR = CAN_TSR_TME0;
     uint8_t data[8]    = {};
 
-    EXPECT_EQ( HW_CAN_Transmit1( data, 0x123, 9 ), 1 );
+    EXPECT_EQ( HW_CAN_Transmit1( data, 0x123, false, 9 ), 1 );
     EXPECT_EQ( mock_can1_regs.sTxMailBox[0].TIR, 0U );
 }
 
@@ -353,7 +833,7 @@ TEST_F( HWCANTest, TransmitClearsReusedMailboxForShortPayload )
     mock_can1_regs.sTxMailBox[0].TDHR = 0xFFFFFFFF;
     uint8_t data[3]                   = { 0x00, 0x10, 0x80 };
 
-    ASSERT_EQ( HW_CAN_Transmit1( data, 0x123, 3 ), 0 );
+    ASSERT_EQ( HW_CAN_Transmit1( data, 0x123, false, 3 ), 0 );
 
     EXPECT_EQ( mock_can1_regs.sTxMailBox[0].TDLR, 0x00801000 );
     EXPECT_EQ( mock_can1_regs.sTxMailBox[0].TDHR, 0x00000000 );
@@ -367,7 +847,7 @@ TEST_F( HWCANTest, TransmitClearsReusedMailboxForLongPayload )
     mock_can1_regs.sTxMailBox[0].TDHR = 0xFFFFFFFF;
     uint8_t data[6]                   = { 0x00, 0x01, 0x02, 0x03, 0x04, 0x00 };
 
-    ASSERT_EQ( HW_CAN_Transmit1( data, 0x123, 6 ), 0 );
+    ASSERT_EQ( HW_CAN_Transmit1( data, 0x123, false, 6 ), 0 );
 
     EXPECT_EQ( mock_can1_regs.sTxMailBox[0].TDLR, 0x03020100 );
     EXPECT_EQ( mock_can1_regs.sTxMailBox[0].TDHR, 0x00000004 );
@@ -380,7 +860,7 @@ TEST_F( HWCANTest, TransmitRejectsIDAbove11Bits )
 
     uint8_t data[8] = { 1, 2, 3, 4, 5, 6, 7, 8 };
 
-    int result = HW_CAN_Transmit1( data, 0x800, 8 );
+    int result = HW_CAN_Transmit1( data, 0x800, false, 8 );
 
     EXPECT_EQ( result, 1 );
 }
@@ -394,7 +874,7 @@ TEST_F( HWCANTest, TransmitAcceptsMaximum11BitID )
 
     uint16_t id = 0x7FF;
 
-    int result = HW_CAN_Transmit1( data, id, 8 );
+    int result = HW_CAN_Transmit1( data, id, false, 8 );
 
     EXPECT_EQ( result, 0 );
 
@@ -410,7 +890,7 @@ TEST_F( HWCANTest, TransmitEncodesHighStandardIdentifiersWithUnsignedShift )
     for ( uint16_t id : ids )
     {
         mock_can1_regs.TSR = CAN_TSR_TME0;
-        ASSERT_EQ( HW_CAN_Transmit1( data, id, 1U ), HW_CAN_RESULT_OK );
+        ASSERT_EQ( HW_CAN_Transmit1( data, id, false, 1U ), HW_CAN_RESULT_OK );
         EXPECT_EQ( mock_can1_regs.sTxMailBox[0].TIR,
                    ( static_cast<uint32_t>( id ) << 21U ) | CAN_TI0R_TXRQ );
     }
@@ -422,7 +902,7 @@ TEST_F( HWCANTest, TransmitAcceptsZeroID )
     mock_can1_regs.TSR = CAN_TSR_TME0;
     uint8_t data[1]    = { 0xAA };
 
-    ASSERT_EQ( HW_CAN_Transmit1( data, 0x000, 1 ), 0 );
+    ASSERT_EQ( HW_CAN_Transmit1( data, 0x000, false, 1 ), 0 );
     EXPECT_EQ( mock_can1_regs.sTxMailBox[0].TIR, CAN_TI0R_TXRQ );
 }
 
@@ -435,7 +915,7 @@ TEST_F( HWCANTest, TransmitRejectsNullPayloadForNonzeroDLCWithoutSideEffects )
     uint32_t              original_tsr     = mock_can1_regs.TSR;
     can_tx_status1                         = HW_CAN_TX_STATUS_COMPLETE;
 
-    EXPECT_EQ( HW_CAN_Transmit1( NULL, 0x123U, 1U ), HW_CAN_RESULT_ERROR );
+    EXPECT_EQ( HW_CAN_Transmit1( NULL, 0x123U, false, 1U ), HW_CAN_RESULT_ERROR );
     EXPECT_EQ(
         memcmp( &mock_can1_regs.sTxMailBox[0], &original_mailbox, sizeof( original_mailbox ) ), 0 );
     EXPECT_EQ( mock_can1_regs.TSR, original_tsr );
@@ -449,7 +929,7 @@ TEST_F( HWCANTest, TransmitAllowsNullPayloadForZeroDLC )
     mock_can2_regs.sTxMailBox[0].TDLR = 0xFFFFFFFFU;
     mock_can2_regs.sTxMailBox[0].TDHR = 0xFFFFFFFFU;
 
-    ASSERT_EQ( HW_CAN_Transmit2( NULL, 0x321U, 0U ), HW_CAN_RESULT_OK );
+    ASSERT_EQ( HW_CAN_Transmit2( NULL, 0x321U, false, 0U ), HW_CAN_RESULT_OK );
     EXPECT_EQ( mock_can2_regs.sTxMailBox[0].TIR,
                ( static_cast<uint32_t>( 0x321U ) << 21 ) | CAN_TI0R_TXRQ );
     EXPECT_EQ( mock_can2_regs.sTxMailBox[0].TDTR, 0U );
@@ -458,6 +938,32 @@ TEST_F( HWCANTest, TransmitAllowsNullPayloadForZeroDLC )
     EXPECT_EQ( HW_CAN_Tx_Status2(), HW_CAN_TX_STATUS_IDLE );
 }
 
+/** Verify that an extended frame places its 29-bit ID in STID:EXID and sets IDE. */
+TEST_F( HWCANTest, TransmitLoadsExtendedIdentifierWithIDE )
+{
+    uint8_t        data[2] = { 0x11U, 0x22U };
+    const uint32_t ids[]   = { 0x18FEF100U, CAN_EXTENDED_ID_MAX, 0x00000123U };
+    for ( uint32_t id : ids )
+    {
+        mock_can1_regs.TSR = CAN_TSR_TME0;
+        ASSERT_EQ( HW_CAN_Transmit1( data, id, true, 2U ), HW_CAN_RESULT_OK );
+        EXPECT_EQ( mock_can1_regs.sTxMailBox[0].TIR, ( id << 3U ) | CAN_TI0R_IDE | CAN_TI0R_TXRQ );
+        EXPECT_EQ( mock_can1_regs.sTxMailBox[0].TDTR, 2U );
+        EXPECT_EQ( mock_can1_regs.sTxMailBox[0].TDLR, 0x2211U );
+    }
+}
+
+/** Verify that an identifier outside the extended 29-bit CAN ID range is rejected. */
+TEST_F( HWCANTest, TransmitRejectsIDAbove29Bits )
+{
+    mock_can1_regs.TSR = CAN_TSR_TME0;
+    uint8_t data[1]    = { 0xAAU };
+
+    EXPECT_EQ( HW_CAN_Transmit1( data, CAN_EXTENDED_ID_MAX + 1U, true, 1U ), HW_CAN_RESULT_ERROR );
+    EXPECT_EQ( mock_can1_regs.sTxMailBox[0].TIR, 0U );
+    EXPECT_EQ( mock_can1_regs.TSR, CAN_TSR_TME0 );
+}
+
 /**-----------------------------------------------------------------------------
  *  Receive Tests
  *------------------------------------------------------------------------------
@@ -499,6 +1005,8 @@ TEST_F( HWCANTest, ReceiveReadsIDAndDataCorrectly )
 
     EXPECT_EQ( packet.id, id );
 
+    EXPECT_FALSE( packet.extended );
+
     EXPECT_EQ( packet.data[0], 1 );
 
     EXPECT_EQ( packet.data[1], 2 );
@@ -538,6 +1046,22 @@ TEST_F( HWCANTest, ReceiveExtractsDLCAndOnlyCopiesValidBytes )
     EXPECT_EQ( packet.data[7], 0 );
 }
 
+/** Verify that an IDE frame is decoded from RIR bits 31:3 and marked as extended. */
+TEST_F( HWCANTest, ReceiveDecodesExtendedIdentifier )
+{
+    mock_can1_regs.RF0R                 = 1U;
+    mock_can1_regs.sFIFOMailBox[0].RIR  = ( 0x18FEF100U << 3U ) | CAN_RI0R_IDE;
+    mock_can1_regs.sFIFOMailBox[0].RDTR = 1U;
+    mock_can1_regs.sFIFOMailBox[0].RDLR = 0x5AU;
+    CAN_Packet_T packet                 = {};
+
+    ASSERT_EQ( HW_CAN_Receive( &hcan1, &packet ), 0 );
+    EXPECT_TRUE( packet.extended );
+    EXPECT_EQ( packet.id, 0x18FEF100U );
+    EXPECT_EQ( packet.dlc, 1U );
+    EXPECT_EQ( packet.data[0], 0x5AU );
+}
+
 /** Verify a null RX destination cannot consume or alter a pending FIFO entry. */
 TEST_F( HWCANTest, ReceiveRejectsNullDestinationWithoutReleasingFIFO )
 {
@@ -635,7 +1159,8 @@ TEST_F( HWCANTest, TxBufferRejectsInvalidDLCBatchAtomically )
     EXPECT_EQ( HW_CAN_Tx_Buffer_Read1( out ), 0 );
 }
 
-/** Verify that a batch containing an extended-range ID is rejected without changing the queue. */
+/** Verify that a standard packet with an ID above 11 bits is rejected without changing the queue.
+ */
 TEST_F( HWCANTest, TxBufferRejectsInvalidIDBatchAtomically )
 {
     CAN_Packet_T packets[2] = {
@@ -650,6 +1175,21 @@ TEST_F( HWCANTest, TxBufferRejectsInvalidIDBatchAtomically )
     EXPECT_EQ( HW_CAN_Tx_Buffer_Read2( out ), 0 );
 }
 
+/** Verify that extended packets pass through the TX ring and only 29-bit IDs are accepted. */
+TEST_F( HWCANTest, TxBufferAcceptsExtendedIDsAndRejectsIDsAbove29Bits )
+{
+    CAN_Packet_T valid[1]   = { { .id = CAN_EXTENDED_ID_MAX, .dlc = 1, .extended = true } };
+    CAN_Packet_T invalid[1] = { { .id = CAN_EXTENDED_ID_MAX + 1U, .dlc = 1, .extended = true } };
+
+    EXPECT_EQ( HW_CAN_Tx_Buffer_Write1( invalid, 1 ), HW_CAN_RESULT_ERROR );
+    ASSERT_EQ( HW_CAN_Tx_Buffer_Write1( valid, 1 ), HW_CAN_RESULT_OK );
+
+    CAN_Packet_T out[1] = {};
+    ASSERT_EQ( HW_CAN_Tx_Buffer_Read1( out ), 1 );
+    EXPECT_EQ( out[0].id, CAN_EXTENDED_ID_MAX );
+    EXPECT_TRUE( out[0].extended );
+}
+
 /**-----------------------------------------------------------------------------
  *  TX ISR Tests
  *------------------------------------------------------------------------------
@@ -705,6 +1245,23 @@ TEST_F( HWCANTest, TxIRQUsesBufferedPacketDLC )
     EXPECT_EQ( mock_can1_regs.sTxMailBox[0].TDHR, 0U );
 }
 
+/** Verify that buffered transmission keeps the extended flag when loading the mailbox. */
+TEST_F( HWCANTest, TxTriggerLoadsBufferedExtendedPacket )
+{
+    mock_can2_regs.TSR = CAN_TSR_TME0;
+
+    CAN_Packet_T packet[1] = {
+        { .id = 0x0CF00400U, .dlc = 1, .data = { 0x42U }, .extended = true },
+    };
+
+    ASSERT_EQ( HW_CAN_Tx_Buffer_Write2( packet, 1 ), 0 );
+    ASSERT_EQ( HW_CAN_Tx_Trigger2(), HW_CAN_RESULT_OK );
+
+    EXPECT_EQ( mock_can2_regs.sTxMailBox[0].TIR,
+               ( 0x0CF00400U << 3U ) | CAN_TI0R_IDE | CAN_TI0R_TXRQ );
+    EXPECT_EQ( mock_can2_regs.sTxMailBox[0].TDLR, 0x42U );
+}
+
 /**-----------------------------------------------------------------------------
  *  RX ISR Tests
  *------------------------------------------------------------------------------
@@ -859,13 +1416,13 @@ TEST_F( HWCANTest, TXVectorDoesNotCompleteBatchAfterHardwareError )
 /** Verify that an RX vector records a frame dropped by a full software buffer. */
 TEST_F( HWCANTest, RxOverflowRecordsDroppedFrame )
 {
-    CAN_Packet_T buffered[RECEIVE_BUFFER_WIDTH - 1] = {};
+    CAN_Packet_T buffered[RECEIVE_BUFFER_WIDTH1 - 1] = {};
     for ( CAN_Packet_T& packet : buffered )
     {
         packet.id  = 0x123;
         packet.dlc = 1;
     }
-    ASSERT_EQ( HW_CAN_Rx_Buffer_Write1( buffered, RECEIVE_BUFFER_WIDTH - 1 ), 0 );
+    ASSERT_EQ( HW_CAN_Rx_Buffer_Write1( buffered, RECEIVE_BUFFER_WIDTH1 - 1 ), 0 );
 
     mock_can1_regs.RF0R                 = 1U;
     mock_can1_regs.sFIFOMailBox[0].RIR  = static_cast<uint32_t>( 0x321 ) << 21;
@@ -875,7 +1432,7 @@ TEST_F( HWCANTest, RxOverflowRecordsDroppedFrame )
     CAN1_RX0_IRQHandler();
 
     EXPECT_EQ( HW_CAN_Rx_Dropped_Count1(), 1U );
-    EXPECT_EQ( can_rx_wp1, RECEIVE_BUFFER_WIDTH - 1 );
+    EXPECT_EQ( can_rx_wp1, RECEIVE_BUFFER_WIDTH1 - 1 );
 }
 
 /** Verify that an RX0 vector releases FIFO entries and clears a latched hardware overrun. */
@@ -899,6 +1456,90 @@ TEST_F( HWCANTest, RX0VectorReleasesFIFOAndClearsHardwareOverrun )
     EXPECT_EQ( packet.data[0], 0x5AU );
 }
 
+/** Verify that the FIFO1 vector drains into the channel ring and clears its own overrun. */
+TEST_F( HWCANTest, RX1VectorDrainsFIFO1IntoChannelRing )
+{
+    mock_can2_regs.RF0R                 = 1U;
+    mock_can2_regs.RF1R                 = 2U | CAN_RF1R_FOVR1;
+    mock_can2_regs.sFIFOMailBox[1].RIR  = static_cast<uint32_t>( 0x2A1 ) << 21;
+    mock_can2_regs.sFIFOMailBox[1].RDTR = 1U;
+    mock_can2_regs.sFIFOMailBox[1].RDLR = 0x77U;
+
+    CAN2_RX1_IRQHandler();
+
+    EXPECT_EQ( mock_can2_regs.RF1R & ( CAN_RF1R_FMP1 | CAN_RF1R_FOVR1 ), 0U );
+    EXPECT_EQ( mock_can2_regs.RF0R, 1U );
+    EXPECT_EQ( HW_CAN_Rx_Dropped_Count2(), 1U );
+
+    CAN_Packet_T packets[2] = {};
+    ASSERT_EQ( HW_CAN_Rx_Buffer_Read2( packets, 2U ), 2U );
+    EXPECT_EQ( packets[0].id, 0x2A1U );
+    EXPECT_EQ( packets[1].data[0], 0x77U );
+}
+
+/** Verify that one RX vector entry drains a full hardware FIFO. */
+TEST_F( HWCANTest, RxVectorDrainsAllPendingEntriesInOneEntry )
+{
+    mock_can1_regs.RF0R                 = CAN_RX_FIFO_DEPTH | CAN_RF0R_FULL0;
+    mock_can1_regs.sFIFOMailBox[0].RIR  = static_cast<uint32_t>( 0x101 ) << 21;
+    mock_can1_regs.sFIFOMailBox[0].RDTR = 0U;
+
+    CAN1_RX0_IRQHandler();
+
+    EXPECT_EQ( mock_can1_regs.RF0R & ( CAN_RF0R_FMP0 | CAN_RF0R_FULL0 ), 0U );
+    EXPECT_EQ( can_rx_wp1, CAN_RX_FIFO_DEPTH );
+    EXPECT_EQ( HW_CAN_Rx_Dropped_Count1(), 0U );
+}
+
+/** Verify that a full ring still empties the hardware FIFO and counts every lost frame. */
+TEST_F( HWCANTest, RxVectorEmptiesFIFOWhenRingIsFull )
+{
+    can_rx_wp1                          = RECEIVE_BUFFER_WIDTH1 - 1U;
+    mock_can1_regs.RF1R                 = 2U;
+    mock_can1_regs.sFIFOMailBox[1].RIR  = static_cast<uint32_t>( 0x102 ) << 21;
+    mock_can1_regs.sFIFOMailBox[1].RDTR = 1U;
+
+    CAN1_RX1_IRQHandler();
+
+    EXPECT_EQ( mock_can1_regs.RF1R & CAN_RF1R_FMP1, 0U );
+    EXPECT_EQ( can_rx_wp1, RECEIVE_BUFFER_WIDTH1 - 1U );
+    EXPECT_EQ( HW_CAN_Rx_Dropped_Count1(), 2U );
+}
+
+/** Verify that polled receive falls back to FIFO1 when FIFO0 is empty. */
+TEST_F( HWCANTest, ReceivePollsFIFO1AfterFIFO0 )
+{
+    mock_can1_regs.RF0R                 = 1U;
+    mock_can1_regs.RF1R                 = 1U;
+    mock_can1_regs.sFIFOMailBox[0].RIR  = static_cast<uint32_t>( 0x100 ) << 21;
+    mock_can1_regs.sFIFOMailBox[1].RIR  = static_cast<uint32_t>( 0x200 ) << 21;
+    mock_can1_regs.sFIFOMailBox[0].RDTR = 0U;
+    mock_can1_regs.sFIFOMailBox[1].RDTR = 0U;
+
+    CAN_Packet_T packet = {};
+    ASSERT_EQ( HW_CAN_Receive1( &packet ), 0 );
+    EXPECT_EQ( packet.id, 0x100U );
+    ASSERT_EQ( HW_CAN_Receive1( &packet ), 0 );
+    EXPECT_EQ( packet.id, 0x200U );
+    EXPECT_EQ( HW_CAN_Receive1( &packet ), 1 );
+}
+
+/** Verify that each channel's ring holds its own configured depth. */
+TEST_F( HWCANTest, RxRingDepthIsPerChannel )
+{
+    std::vector<CAN_Packet_T> packets( HW_CAN_CH2_RX_QUEUE_CAPACITY + 1U );
+
+    EXPECT_EQ( HW_CAN_Rx_Buffer_Write1( packets.data(), HW_CAN_CH1_RX_QUEUE_CAPACITY ), 0 );
+    EXPECT_EQ( HW_CAN_Rx_Buffer_Write1( packets.data(), 1U ), 1 );
+    EXPECT_EQ( HW_CAN_Rx_Buffer_Write2( packets.data(), HW_CAN_CH2_RX_QUEUE_CAPACITY ), 0 );
+    EXPECT_EQ( HW_CAN_Rx_Buffer_Write2( packets.data(), 1U ), 1 );
+
+    EXPECT_EQ( HW_CAN_Rx_Buffer_Read1( packets.data(), HW_CAN_CH1_RX_QUEUE_CAPACITY + 1U ),
+               HW_CAN_CH1_RX_QUEUE_CAPACITY );
+    EXPECT_EQ( HW_CAN_Rx_Buffer_Read2( packets.data(), HW_CAN_CH2_RX_QUEUE_CAPACITY + 1U ),
+               HW_CAN_CH2_RX_QUEUE_CAPACITY );
+}
+
 /** Verify that resetting channel 1 clears only channel 1 queue and status state. */
 TEST_F( HWCANTest, ChannelResetClearsSelectedChannelOnly )
 {
@@ -998,7 +1639,7 @@ TEST_F( HWCANTest, RxBufferWriteFailsWhenFull )
 {
     CAN_Packet_T packet[1] = { { .id = 0x456, .dlc = 8, .data = { 9, 8, 7, 6, 5, 4, 3, 2 } } };
 
-    for ( int i = 0; i < RECEIVE_BUFFER_WIDTH - 1; i++ )
+    for ( int i = 0; i < RECEIVE_BUFFER_WIDTH1 - 1; i++ )
     {
         EXPECT_EQ( HW_CAN_Rx_Buffer_Write1( packet, 1 ), 0 );
     }
@@ -1009,6 +1650,10 @@ TEST_F( HWCANTest, RxBufferWriteFailsWhenFull )
 /** Verify that bounded RX reads preserve order across partial reads and ring wraparound. */
 TEST_F( HWCANTest, RxBufferBoundedReadsPreserveRemainingPacketsAcrossWraparound )
 {
+    /* Start near the end of the ring so the writes below wrap at any configured depth */
+    can_rx_wp1 = RECEIVE_BUFFER_WIDTH1 - 5U;
+    can_rx_rp1 = RECEIVE_BUFFER_WIDTH1 - 5U;
+
     CAN_Packet_T packets[15] = {};
     for ( uint16_t i = 0; i < 15U; i++ )
     {
@@ -1168,7 +1813,7 @@ TEST_F( HWCANTest, FilterConfiguresStandardIDMaskCorrectly )
     uint16_t filter_mask = 0x7FF;
 
     HAL_StatusTypeDef result =
-        HW_CAN_Apply_Filter_HAL( &filter, &hcan1, 0, filter_id, filter_mask );
+        HW_CAN_Apply_Filter_HAL( &filter, &hcan1, 0, filter_id, filter_mask, false );
 
     EXPECT_EQ( result, HAL_OK );
 
@@ -1200,7 +1845,7 @@ TEST_F( HWCANTest, FilterRejectsIDAbove11Bits )
 
     EXPECT_CALL( mock, CANConfigFilter( _, _ ) ).Times( 0 );
 
-    EXPECT_EQ( HW_CAN_Apply_Filter_HAL( &filter, &hcan1, 0, 0x800, 0x7FF ), HAL_ERROR );
+    EXPECT_EQ( HW_CAN_Apply_Filter_HAL( &filter, &hcan1, 0, 0x800, 0x7FF, false ), HAL_ERROR );
 }
 
 /** Verify that an out-of-range filter mask is rejected without calling HAL_CAN_ConfigFilter(). */
@@ -1210,47 +1855,653 @@ TEST_F( HWCANTest, FilterRejectsMaskAbove11Bits )
 
     EXPECT_CALL( mock, CANConfigFilter( _, _ ) ).Times( 0 );
 
-    EXPECT_EQ( HW_CAN_Apply_Filter_HAL( &filter, &hcan1, 0, 0x123, 0x800 ), HAL_ERROR );
+    EXPECT_EQ( HW_CAN_Apply_Filter_HAL( &filter, &hcan1, 0, 0x123, 0x800, false ), HAL_ERROR );
 }
 
-/** Verify that CAN1 may use filter bank 13. */
-TEST_F( HWCANTest, CAN1FilterBank13IsAccepted )
+/** Verify that an extended ID and mask span both filter halves and require IDE. */
+TEST_F( HWCANTest, FilterConfiguresExtendedIDMaskCorrectly )
 {
     CAN_FilterTypeDef filter = {};
 
     EXPECT_CALL( mock, CANConfigFilter( _, _ ) ).WillOnce( Return( HAL_OK ) );
 
-    EXPECT_EQ( HW_CAN_Apply_Filter_HAL( &filter, &hcan1, 13, 0x123, 0x7FF ), HAL_OK );
+    uint32_t filter_id   = 0x18FEF100U;
+    uint32_t filter_mask = 0x1FFFFF00U;
+
+    HAL_StatusTypeDef result =
+        HW_CAN_Apply_Filter_HAL( &filter, &hcan1, 0, filter_id, filter_mask, true );
+
+    ASSERT_EQ( result, HAL_OK );
+
+    uint32_t id_register   = ( filter_id << 3U ) | CAN_RI0R_IDE;
+    uint32_t mask_register = ( filter_mask << 3U ) | CAN_RI0R_IDE | CAN_RI0R_RTR;
+    EXPECT_EQ( filter.FilterIdHigh, id_register >> 16U );
+    EXPECT_EQ( filter.FilterIdLow, id_register & 0xFFFFU );
+    EXPECT_EQ( filter.FilterMaskIdHigh, mask_register >> 16U );
+    EXPECT_EQ( filter.FilterMaskIdLow, mask_register & 0xFFFFU );
+    EXPECT_EQ( filter.FilterMode, CAN_FILTERMODE_IDMASK );
 }
 
-/** Verify that CAN1 may not use filter bank 14. */
-TEST_F( HWCANTest, CAN1FilterBank14IsRejected )
+/** Verify that an extended filter ID outside the 29-bit range is rejected. */
+TEST_F( HWCANTest, FilterRejectsExtendedIDAbove29Bits )
 {
     CAN_FilterTypeDef filter = {};
 
     EXPECT_CALL( mock, CANConfigFilter( _, _ ) ).Times( 0 );
 
-    EXPECT_EQ( HW_CAN_Apply_Filter_HAL( &filter, &hcan1, 14, 0x123, 0x7FF ), HAL_ERROR );
+    EXPECT_EQ(
+        HW_CAN_Apply_Filter_HAL( &filter, &hcan1, 0, CAN_EXTENDED_ID_MAX + 1U, 0x1FFFFFFFU, true ),
+        HAL_ERROR );
 }
 
-/** Verify that CAN2 may use filter bank 14. */
-TEST_F( HWCANTest, CAN2FilterBank14IsAccepted )
+/** Verify that CAN1 may use filter bank 13. */
+TEST_F( HWCANTest, CAN1FilterBank13IsAccepted )
 {
     CAN_FilterTypeDef filter = {};
 
     EXPECT_CALL( mock, CANConfigFilter( _, _ ) ).WillOnce( Return( HAL_OK ) );
 
-    EXPECT_EQ( HW_CAN_Apply_Filter_HAL( &filter, &hcan2, 14, 0x123, 0x7FF ), HAL_OK );
+    EXPECT_EQ( HW_CAN_Apply_Filter_HAL( &filter, &hcan1, 13, 0x123, 0x7FF, false ), HAL_OK );
 }
 
-/** Verify that CAN2 may use filter bank 27. */
+/** Verify that CAN1 may not use filter bank 14. */
+TEST_F( HWCANTest, CAN1FilterBank14IsRejected )
+{
+    CAN_FilterTypeDef filter = {};
+
+    EXPECT_CALL( mock, CANConfigFilter( _, _ ) ).Times( 0 );
+
+    EXPECT_EQ( HW_CAN_Apply_Filter_HAL( &filter, &hcan1, 14, 0x123, 0x7FF, false ), HAL_ERROR );
+}
+
+/** Verify that CAN2 may use filter bank 14. */
+TEST_F( HWCANTest, CAN2FilterBank14IsAccepted )
+{
+    CAN_FilterTypeDef filter = {};
+
+    EXPECT_CALL( mock, CANConfigFilter( _, _ ) ).WillOnce( Return( HAL_OK ) );
+
+    EXPECT_EQ( HW_CAN_Apply_Filter_HAL( &filter, &hcan2, 14, 0x123, 0x7FF, false ), HAL_OK );
+}
+
+/** Verify that CAN2 may use filter bank 27. */
 TEST_F( HWCANTest, CAN2FilterBank27IsAccepted )
 {
     CAN_FilterTypeDef filter = {};
 
     EXPECT_CALL( mock, CANConfigFilter( _, _ ) ).WillOnce( Return( HAL_OK ) );
 
-    EXPECT_EQ( HW_CAN_Apply_Filter_HAL( &filter, &hcan2, 27, 0x123, 0x7FF ), HAL_OK );
+    EXPECT_EQ( HW_CAN_Apply_Filter_HAL( &filter, &hcan2, 27, 0x123, 0x7FF, false ), HAL_OK );
+}
+
+/**-----------------------------------------------------------------------------
+ *  Filter Bank Allocation Tests
+ *------------------------------------------------------------------------------
+ */
+
+/** Verify that standard identifiers are packed four to a 16-bit list bank. */
+TEST_F( HWCANTest, FilterPlanPacksStandardIdsFourPerListBank )
+{
+    std::vector<HW_CAN_Filter_Rule_T> rules;
+    for ( uint32_t id : { 0x100U, 0x123U, 0x200U, 0x321U, 0x456U, 0x500U, 0x6AAU, 0x7FFU } )
+    {
+        rules.push_back( { id, id, false } );
+    }
+    HW_CAN_Filter_Plan_T plan = {};
+
+    ASSERT_TRUE( PackMatchesRules( plan, rules, HW_CAN_FILTER_UNLIMITED_BANKS ) );
+
+    EXPECT_EQ( plan.bank_count, 2U );
+    EXPECT_EQ( plan.hardware_ids, 8U );
+    EXPECT_EQ( plan.software_ids, 0U );
+
+    HW_CAN_Filter_Bank_T banks[2] = {};
+    ASSERT_EQ( HW_CAN_Filter_Build_Banks( &plan, banks ), 2U );
+    EXPECT_TRUE( banks[0].list_mode );
+    EXPECT_FALSE( banks[0].scale_32bit );
+    EXPECT_EQ( banks[0].fr1, ( 0x123U << 21U ) | ( 0x100U << 5U ) );
+}
+
+/** Verify that extended identifiers use 32-bit list pairs and unused slots repeat an entry. */
+TEST_F( HWCANTest, FilterPlanUsesThirtyTwoBitListPairsForExtendedIds )
+{
+    std::vector<HW_CAN_Filter_Rule_T> rules = {
+        { 0x18FEF100U, 0x18FEF100U, true },
+        { 0x0CF00400U, 0x0CF00400U, true },
+        { 0x1FFFFFFFU, 0x1FFFFFFFU, true },
+    };
+    HW_CAN_Filter_Plan_T plan = {};
+
+    ASSERT_TRUE( PackMatchesRules( plan, rules, HW_CAN_FILTER_UNLIMITED_BANKS ) );
+
+    HW_CAN_Filter_Bank_T banks[2] = {};
+    ASSERT_EQ( HW_CAN_Filter_Build_Banks( &plan, banks ), 2U );
+    EXPECT_TRUE( banks[1].list_mode );
+    EXPECT_TRUE( banks[1].scale_32bit );
+    EXPECT_EQ( banks[1].fr1, ( 0x1FFFFFFFU << 3U ) | CAN_RI0R_IDE );
+    EXPECT_EQ( banks[1].fr2, banks[1].fr1 );
+}
+
+/** Verify that aligned ranges become single mask entries of the matching scale. */
+TEST_F( HWCANTest, FilterPlanTurnsAlignedRangesIntoMaskEntries )
+{
+    std::vector<HW_CAN_Filter_Rule_T> rules = {
+        { 0x100U, 0x1FFU, false },
+        { 0x18FEF100U, 0x18FEF1FFU, true },
+    };
+    HW_CAN_Filter_Plan_T plan = {};
+
+    ASSERT_TRUE( PackMatchesRules( plan, rules, HW_CAN_FILTER_UNLIMITED_BANKS ) );
+
+    EXPECT_EQ( plan.entry_count, 2U );
+    EXPECT_EQ( plan.bank_count, 2U );
+    EXPECT_EQ( plan.hardware_ids, 0x200U );
+
+    HW_CAN_Filter_Bank_T banks[2] = {};
+    ASSERT_EQ( HW_CAN_Filter_Build_Banks( &plan, banks ), 2U );
+    EXPECT_FALSE( banks[0].list_mode );
+    EXPECT_FALSE( banks[0].scale_32bit );
+    EXPECT_FALSE( banks[1].list_mode );
+    EXPECT_TRUE( banks[1].scale_32bit );
+    EXPECT_EQ( banks[1].fr2, ( 0x1FFFFF00U << 3U ) | CAN_RI0R_IDE | CAN_RI0R_RTR );
+}
+
+/** Verify that spare mask and 32-bit list slots absorb standard identifiers. */
+TEST_F( HWCANTest, FilterPlanFillsSpareSlotsWithStandardIds )
+{
+    std::vector<HW_CAN_Filter_Rule_T> rules = {
+        { 0x001U, 0x001U, false }, { 0x003U, 0x003U, false }, { 0x005U, 0x005U, false },
+        { 0x007U, 0x007U, false }, { 0x009U, 0x009U, false }, { 0x400U, 0x43FU, false },
+    };
+    HW_CAN_Filter_Plan_T plan = {};
+
+    ASSERT_TRUE( PackMatchesRules( plan, rules, HW_CAN_FILTER_UNLIMITED_BANKS ) );
+    EXPECT_EQ( plan.bank_count, 2U );
+
+    rules.back() = { 0x1234567U, 0x1234567U, true };
+    ASSERT_TRUE( PackMatchesRules( plan, rules, HW_CAN_FILTER_UNLIMITED_BANKS ) );
+    EXPECT_EQ( plan.bank_count, 2U );
+}
+
+/** Verify that an extended block of at least 2^15 IDs shares a 16-bit mask bank. */
+TEST_F( HWCANTest, FilterPlanSharesSixteenBitMaskBankWithWideExtendedBlock )
+{
+    std::vector<HW_CAN_Filter_Rule_T> rules = {
+        { 0x000U, 0x0FFU, false },
+        { 0x10000000U, 0x10FFFFFFU, true },
+    };
+    HW_CAN_Filter_Plan_T plan = {};
+
+    ASSERT_TRUE( PackMatchesRules( plan, rules, HW_CAN_FILTER_UNLIMITED_BANKS ) );
+
+    EXPECT_EQ( plan.bank_count, 1U );
+    EXPECT_EQ( plan.software_ids, 0U );
+}
+
+/** Verify that rule sets are normalised and invalid sets leave the plan unchanged. */
+TEST_F( HWCANTest, FilterPlanMergesRulesAndRejectsInvalidSets )
+{
+    HW_CAN_Filter_Plan_T              plan  = {};
+    std::vector<HW_CAN_Filter_Rule_T> rules = {
+        { 0x300U, 0x37FU, false },
+        { 0x200U, 0x2FFU, false },
+        { 0x200U, 0x200U, true },
+        { 0x380U, 0x3FFU, false },
+    };
+
+    ASSERT_TRUE( HW_CAN_Filter_Set_Rules( &plan, rules.data(), 4U ) );
+    ASSERT_EQ( plan.rule_count, 2U );
+    EXPECT_FALSE( plan.rules[0].extended );
+    EXPECT_EQ( plan.rules[0].first_id, 0x200U );
+    EXPECT_EQ( plan.rules[0].last_id, 0x3FFU );
+    EXPECT_TRUE( plan.rules[1].extended );
+
+    HW_CAN_Filter_Rule_T inverted[]      = { { 0x20U, 0x10U, false } };
+    HW_CAN_Filter_Rule_T standard_high[] = { { 0x7FFU, 0x800U, false } };
+    HW_CAN_Filter_Rule_T extended_high[] = { { 0x0U, CAN_EXTENDED_ID_MAX + 1U, true } };
+    EXPECT_FALSE( HW_CAN_Filter_Set_Rules( &plan, inverted, 1U ) );
+    EXPECT_FALSE( HW_CAN_Filter_Set_Rules( &plan, standard_high, 1U ) );
+    EXPECT_FALSE( HW_CAN_Filter_Set_Rules( &plan, extended_high, 1U ) );
+    EXPECT_FALSE( HW_CAN_Filter_Set_Rules( &plan, nullptr, 1U ) );
+
+    std::vector<HW_CAN_Filter_Rule_T> too_many;
+    for ( uint32_t i = 0U; i <= HW_CAN_FILTER_MAX_RULES; i++ )
+    {
+        too_many.push_back( { i * 4U, i * 4U, false } );
+    }
+    EXPECT_FALSE( HW_CAN_Filter_Set_Rules( &plan, too_many.data(),
+                                           static_cast<uint16_t>( too_many.size() ) ) );
+    EXPECT_EQ( plan.rule_count, 2U );
+    EXPECT_EQ( plan.rules[0].first_id, 0x200U );
+}
+
+/** Verify that an over-budget plan is widened into software-checked entries. */
+TEST_F( HWCANTest, FilterPlanWidensEntriesToFitBudget )
+{
+    std::vector<HW_CAN_Filter_Rule_T> rules;
+    for ( uint32_t i = 0U; i < HW_CAN_FILTER_MAX_RULES; i++ )
+    {
+        uint32_t id = 0x40U * i + 3U;
+        rules.push_back( { id, id, false } );
+    }
+    HW_CAN_Filter_Plan_T plan = {};
+
+    ASSERT_TRUE( PackMatchesRules( plan, rules, HW_CAN_FILTER_UNLIMITED_BANKS ) );
+    EXPECT_EQ( plan.bank_count, 4U );
+    EXPECT_EQ( plan.software_ids, 0U );
+
+    ASSERT_TRUE( PackMatchesRules( plan, rules, 2U ) );
+    EXPECT_LE( plan.bank_count, 2U );
+    EXPECT_GT( plan.software_ids, 0U );
+    EXPECT_EQ( plan.hardware_ids + plan.software_ids, HW_CAN_FILTER_MAX_RULES );
+
+    ASSERT_TRUE( PackMatchesRules( plan, rules, 1U ) );
+    EXPECT_EQ( plan.bank_count, 1U );
+}
+
+/** Verify that a budget below one bank per identifier format is refused. */
+TEST_F( HWCANTest, FilterPlanRefusesBudgetBelowOneBankPerFormat )
+{
+    HW_CAN_Filter_Rule_T rules[] = {
+        { 0x123U, 0x123U, false },
+        { 0x1234567U, 0x1234567U, true },
+    };
+    HW_CAN_Filter_Plan_T plan = {};
+
+    ASSERT_TRUE( HW_CAN_Filter_Set_Rules( &plan, rules, 2U ) );
+    EXPECT_FALSE( HW_CAN_Filter_Pack( &plan, 1U ) );
+    EXPECT_TRUE( HW_CAN_Filter_Pack( &plan, 2U ) );
+}
+
+/** Verify that channels that fit together each get exactly the banks they need. */
+TEST_F( HWCANTest, FilterAllocationGivesEachChannelTheBanksItNeeds )
+{
+    HW_CAN_Filter_Rule_T can1_rules[] = {
+        { 0x100U, 0x104U, false },
+        { 0x18FEF100U, 0x18FEF103U, true },
+    };
+    HW_CAN_Filter_Rule_T can2_rules[] = { { 0x000U, 0x7FFU, false } };
+    HW_CAN_Filter_Plan_T can1         = {};
+    HW_CAN_Filter_Plan_T can2         = {};
+    ASSERT_TRUE( HW_CAN_Filter_Set_Rules( &can1, can1_rules, 2U ) );
+    ASSERT_TRUE( HW_CAN_Filter_Set_Rules( &can2, can2_rules, 1U ) );
+
+    uint8_t can2_first_bank = HW_CAN_Filter_Allocate( &can1, &can2 );
+
+    EXPECT_EQ( can2_first_bank, can1.bank_count );
+    EXPECT_EQ( can1.bank_count, 2U );
+    EXPECT_EQ( can2.bank_count, 1U );
+    EXPECT_EQ( can1.software_ids, 0U );
+    EXPECT_EQ( can2.software_ids, 0U );
+    EXPECT_EQ( can2.hardware_ids, 0x800U );
+}
+
+/** Verify that oversubscribed channels split the 28 banks and stay correct. */
+TEST_F( HWCANTest, FilterAllocationSplitsOversubscribedBanks )
+{
+    std::vector<HW_CAN_Filter_Rule_T> can1_rules;
+    std::vector<HW_CAN_Filter_Rule_T> can2_rules;
+    for ( uint32_t i = 0U; i < HW_CAN_FILTER_MAX_RULES; i++ )
+    {
+        can1_rules.push_back( { i * 0x100000U + 1U, i * 0x100000U + 0x7FFEU, true } );
+        can2_rules.push_back( { 0x10000000U + i * 0x100000U + 3U,
+                                0x10000000U + i * 0x100000U + 0x5FFU, true } );
+    }
+    HW_CAN_Filter_Plan_T can1 = {};
+    HW_CAN_Filter_Plan_T can2 = {};
+    ASSERT_TRUE( HW_CAN_Filter_Set_Rules( &can1, can1_rules.data(), HW_CAN_FILTER_MAX_RULES ) );
+    ASSERT_TRUE( HW_CAN_Filter_Set_Rules( &can2, can2_rules.data(), HW_CAN_FILTER_MAX_RULES ) );
+    ASSERT_TRUE( HW_CAN_Filter_Pack( &can1, HW_CAN_FILTER_UNLIMITED_BANKS ) );
+    ASSERT_TRUE( HW_CAN_Filter_Pack( &can2, HW_CAN_FILTER_UNLIMITED_BANKS ) );
+    uint32_t can1_need = can1.bank_count;
+    uint32_t can2_need = can2.bank_count;
+    ASSERT_GT( can1_need + can2_need, HW_CAN_FILTER_BANK_COUNT );
+
+    uint8_t can2_first_bank = HW_CAN_Filter_Allocate( &can1, &can2 );
+
+    uint32_t share = ( HW_CAN_FILTER_BANK_COUNT * can1_need + ( can1_need + can2_need ) / 2U )
+                     / ( can1_need + can2_need );
+    EXPECT_EQ( can2_first_bank, share );
+    EXPECT_LE( can1.bank_count, can2_first_bank );
+    EXPECT_LE( can2.bank_count, HW_CAN_FILTER_BANK_COUNT - can2_first_bank );
+    EXPECT_GT( can1.software_ids, 0U );
+    EXPECT_GT( can2.software_ids, 0U );
+
+    HW_CAN_Filter_Bank_T banks[HW_CAN_FILTER_BANK_COUNT] = {};
+    HW_CAN_Filter_Build_Banks( &can1, banks );
+    HW_CAN_Filter_Build_Banks( &can2, &banks[can2_first_bank] );
+    EXPECT_TRUE( PlanMatchesRules( can1, banks, can1.bank_count, can1_rules ) );
+    EXPECT_TRUE( PlanMatchesRules( can2, &banks[can2_first_bank], can2.bank_count, can2_rules ) );
+}
+
+/** Verify allocation of random rule sets against the reference matchers. */
+TEST_F( HWCANTest, FilterAllocationMatchesReferenceForRandomRuleSets )
+{
+    std::mt19937 rng( 20261018U );
+
+    for ( int round = 0; round < 60; round++ )
+    {
+        std::vector<HW_CAN_Filter_Rule_T> can1_rules = RandomRules( rng, 1U + rng() % 16U );
+        std::vector<HW_CAN_Filter_Rule_T> can2_rules = RandomRules( rng, rng() % 17U );
+        HW_CAN_Filter_Plan_T              can1       = {};
+        HW_CAN_Filter_Plan_T              can2       = {};
+        ASSERT_TRUE( HW_CAN_Filter_Set_Rules( &can1, can1_rules.data(),
+                                              static_cast<uint16_t>( can1_rules.size() ) ) );
+        ASSERT_TRUE( HW_CAN_Filter_Set_Rules( &can2, can2_rules.data(),
+                                              static_cast<uint16_t>( can2_rules.size() ) ) );
+
+        uint8_t can2_first_bank = HW_CAN_Filter_Allocate( &can1, &can2 );
+
+        ASSERT_LE( can2_first_bank, HW_CAN_FILTER_BANK_COUNT - 1U ) << "round " << round;
+        ASSERT_LE( can1.bank_count, can2_first_bank ) << "round " << round;
+        ASSERT_LE( can2.bank_count, HW_CAN_FILTER_BANK_COUNT - can2_first_bank )
+            << "round " << round;
+
+        HW_CAN_Filter_Bank_T banks[HW_CAN_FILTER_BANK_COUNT] = {};
+        HW_CAN_Filter_Build_Banks( &can1, banks );
+        HW_CAN_Filter_Build_Banks( &can2, &banks[can2_first_bank] );
+        EXPECT_TRUE( PlanMatchesRules( can1, banks, can1.bank_count, can1_rules ) )
+            << "round " << round;
+        EXPECT_TRUE(
+            PlanMatchesRules( can2, &banks[can2_first_bank], can2.bank_count, can2_rules ) )
+            << "round " << round;
+    }
+}
+
+/** Verify that installing a filter set programs all 28 shared banks through HAL. */
+TEST_F( HWCANTest, SetFiltersProgramsAllSharedBanksThroughHAL )
+{
+    std::vector<std::pair<CAN_HandleTypeDef*, CAN_FilterTypeDef>> filters;
+    EXPECT_CALL( mock, CANConfigFilter( _, _ ) )
+        .Times( static_cast<int>( HW_CAN_FILTER_BANK_COUNT ) * 2 )
+        .WillRepeatedly( Invoke( [&filters]( CAN_HandleTypeDef* hcan, CAN_FilterTypeDef* filter ) {
+            filters.emplace_back( hcan, *filter );
+            return HAL_OK;
+        } ) );
+
+    std::vector<HW_CAN_Filter_Rule_T> can1_rules = {
+        { 0x100U, 0x100U, false }, { 0x1F0U, 0x1FFU, false }, { 0x18FEF100U, 0x18FEF1FFU, true } };
+    std::vector<HW_CAN_Filter_Rule_T> can2_rules = { { 0x0CF00400U, 0x0CF00400U, true } };
+
+    ASSERT_EQ( HW_CAN_Set_Filters1( can1_rules.data(), 3U ), HW_CAN_RESULT_OK );
+    ASSERT_EQ( HW_CAN_Set_Filters2( can2_rules.data(), 1U ), HW_CAN_RESULT_OK );
+    ASSERT_EQ( filters.size(), HW_CAN_FILTER_BANK_COUNT * 2U );
+
+    HW_CAN_Filter_Report_T can1_report = {};
+    HW_CAN_Filter_Report_T can2_report = {};
+    HW_CAN_Get_Filter_Report1( &can1_report );
+    HW_CAN_Get_Filter_Report2( &can2_report );
+    EXPECT_EQ( can1_report.first_bank, 0U );
+    EXPECT_EQ( can1_report.bank_count, 2U );
+    EXPECT_EQ( can1_report.hardware_ids, 0x111U );
+    EXPECT_EQ( can1_report.software_ids, 0U );
+    EXPECT_EQ( can2_report.first_bank, 2U );
+    EXPECT_EQ( can2_report.bank_count, 1U );
+    EXPECT_EQ( can2_report.hardware_ids, 1U );
+
+    std::vector<HW_CAN_Filter_Bank_T> can1_banks;
+    std::vector<HW_CAN_Filter_Bank_T> can2_banks;
+    for ( size_t i = HW_CAN_FILTER_BANK_COUNT; i < filters.size(); i++ )
+    {
+        const auto& [hcan, filter] = filters[i];
+        uint32_t bank              = static_cast<uint32_t>( i - HW_CAN_FILTER_BANK_COUNT );
+        EXPECT_EQ( filter.FilterBank, bank );
+        EXPECT_EQ( filter.SlaveStartFilterBank, can2_report.first_bank );
+        EXPECT_EQ( hcan, bank < can2_report.first_bank ? &hcan1 : &hcan2 );
+
+        /* Each channel's banks alternate FIFO0, FIFO1, ... from its first bank */
+        uint32_t channel_bank =
+            bank < can2_report.first_bank ? bank : bank - can2_report.first_bank;
+        EXPECT_EQ( filter.FilterFIFOAssignment,
+                   ( channel_bank & 1U ) != 0U ? CAN_FILTER_FIFO1 : CAN_FILTER_FIFO0 );
+
+        bool can1_bank = bank < can1_report.bank_count;
+        bool can2_bank = bank >= can2_report.first_bank
+                         && bank < can2_report.first_bank + can2_report.bank_count;
+        EXPECT_EQ( filter.FilterActivation, can1_bank || can2_bank ? ENABLE : DISABLE );
+        if ( can1_bank )
+        {
+            can1_banks.push_back( BankFromHAL( filter ) );
+        }
+        if ( can2_bank )
+        {
+            can2_banks.push_back( BankFromHAL( filter ) );
+        }
+    }
+
+    EXPECT_TRUE( PlanMatchesRules( can_filter_plan1, can1_banks.data(),
+                                   static_cast<uint8_t>( can1_banks.size() ), can1_rules ) );
+    EXPECT_TRUE( PlanMatchesRules( can_filter_plan2, can2_banks.data(),
+                                   static_cast<uint8_t>( can2_banks.size() ), can2_rules ) );
+}
+
+/** Verify that an invalid filter set is rejected before HAL or the RX interrupts are touched. */
+TEST_F( HWCANTest, SetFiltersRejectsInvalidRulesWithoutTouchingHAL )
+{
+    EXPECT_CALL( mock, CANConfigFilter( _, _ ) ).Times( 0 );
+    HW_CAN_Filter_Rule_T rules[] = { { 0x123U, 0x800U, false } };
+
+    EXPECT_EQ( HW_CAN_Set_Filters1( rules, 1U ), HW_CAN_RESULT_ERROR );
+    EXPECT_TRUE( nvic_irq_enabled[CAN1_RX0_IRQn] );
+    EXPECT_TRUE( nvic_irq_enabled[CAN2_RX0_IRQn] );
+}
+
+/** Verify that a HAL failure while programming banks is reported. */
+TEST_F( HWCANTest, SetFiltersReportsHALFailure )
+{
+    EXPECT_CALL( mock, CANConfigFilter( _, _ ) ).WillOnce( Return( HAL_ERROR ) );
+    HW_CAN_Filter_Rule_T rules[] = { { 0x123U, 0x123U, false } };
+
+    EXPECT_EQ( HW_CAN_Set_Filters2( rules, 1U ), HW_CAN_RESULT_ERROR );
+}
+
+/** Verify that the RX ISR drops frames that only pass a widened hardware entry. */
+TEST_F( HWCANTest, RxIRQDropsFramesOutsideWidenedFilterSet )
+{
+    EXPECT_CALL( mock, CANConfigFilter( _, _ ) ).WillRepeatedly( Return( HAL_OK ) );
+
+    /* Two oversubscribed channels force CAN1's 16 ranges to be widened. */
+    std::vector<HW_CAN_Filter_Rule_T> rules;
+    for ( uint32_t i = 0U; i < HW_CAN_FILTER_MAX_RULES; i++ )
+    {
+        rules.push_back( { i * 0x100000U + 1U, i * 0x100000U + 0xFFFFEU, true } );
+    }
+    ASSERT_EQ( HW_CAN_Set_Filters2( rules.data(), HW_CAN_FILTER_MAX_RULES ), HW_CAN_RESULT_OK );
+    ASSERT_EQ( HW_CAN_Set_Filters1( rules.data(), HW_CAN_FILTER_MAX_RULES ), HW_CAN_RESULT_OK );
+
+    HW_CAN_Filter_Report_T report = {};
+    HW_CAN_Get_Filter_Report1( &report );
+    ASSERT_GT( report.software_ids, 0U );
+
+    for ( uint32_t id : { 0x00100000U, 0x00100001U } )
+    {
+        mock_can1_regs.RF0R                 = 1U;
+        mock_can1_regs.sFIFOMailBox[0].RIR  = ( id << 3U ) | CAN_RI0R_IDE;
+        mock_can1_regs.sFIFOMailBox[0].RDTR = 0U;
+        CAN1_RX0_IRQHandler();
+    }
+
+    CAN_Packet_T out[2] = {};
+    ASSERT_EQ( HW_CAN_Rx_Buffer_Read1( out, 2U ), 1U );
+    EXPECT_EQ( out[0].id, 0x00100001U );
+    EXPECT_TRUE( out[0].extended );
+    EXPECT_EQ( HW_CAN_Rx_Dropped_Count1(), 0U );
+}
+
+/** Verify that configuring a channel discards its filter set and software check. */
+TEST_F( HWCANTest, ConfigureDiscardsChannelFilterSet )
+{
+    EXPECT_CALL( mock, CANConfigFilter( _, _ ) ).WillRepeatedly( Return( HAL_OK ) );
+    EXPECT_CALL( mock, CANInit( _ ) ).WillOnce( Return( HAL_OK ) );
+    EXPECT_CALL( mock, CANStart( _ ) ).WillOnce( Return( HAL_OK ) );
+    HW_CAN_Filter_Rule_T rules[] = { { 0x123U, 0x123U, false } };
+    ASSERT_EQ( HW_CAN_Set_Filters1( rules, 1U ), HW_CAN_RESULT_OK );
+
+    ASSERT_EQ( HW_CAN_Configure1( 1000000, 0, 0x123, 0x7FF, false ), 0 );
+
+    HW_CAN_Filter_Report_T report = {};
+    HW_CAN_Get_Filter_Report1( &report );
+    EXPECT_EQ( report.bank_count, 0U );
+    EXPECT_EQ( report.hardware_ids, 0U );
+    EXPECT_EQ( can_filter_plan1.rule_count, 0U );
+}
+
+/** Sixteen wide extended ranges whose exact entries need more than half the banks. */
+static std::vector<HW_CAN_Filter_Rule_T> WideExtendedRules()
+{
+    std::vector<HW_CAN_Filter_Rule_T> rules;
+    for ( uint32_t i = 0U; i < HW_CAN_FILTER_MAX_RULES; i++ )
+    {
+        rules.push_back( { i * 0x100000U + 1U, i * 0x100000U + 0xFFFFEU, true } );
+    }
+    return rules;
+}
+
+/**
+ * Verify that a filter set on one channel keeps the other channel's single-bank filter active
+ * at the bank 14 split that filter was programmed with.
+ */
+TEST_F( HWCANTest, SetFiltersKeepsOtherChannelSingleBankFilter )
+{
+    std::vector<std::pair<CAN_HandleTypeDef*, CAN_FilterTypeDef>> filters;
+    EXPECT_CALL( mock, CANInit( &hcan2 ) ).WillOnce( Return( HAL_OK ) );
+    EXPECT_CALL( mock, CANStart( &hcan2 ) ).WillOnce( Return( HAL_OK ) );
+    EXPECT_CALL( mock, CANConfigFilter( _, _ ) )
+        .Times( 1 + static_cast<int>( HW_CAN_FILTER_BANK_COUNT ) )
+        .WillRepeatedly( Invoke( [&filters]( CAN_HandleTypeDef* hcan, CAN_FilterTypeDef* filter ) {
+            filters.emplace_back( hcan, *filter );
+            return HAL_OK;
+        } ) );
+
+    ASSERT_EQ( HW_CAN_Configure2( 1000000, 20, 0x123, 0x7FF, false ), 0 );
+    std::vector<HW_CAN_Filter_Rule_T> rules = WideExtendedRules();
+    ASSERT_EQ( HW_CAN_Set_Filters1( rules.data(), HW_CAN_FILTER_MAX_RULES ), HW_CAN_RESULT_OK );
+    ASSERT_EQ( filters.size(), 1U + HW_CAN_FILTER_BANK_COUNT );
+
+    HW_CAN_Filter_Report_T can1_report = {};
+    HW_CAN_Filter_Report_T can2_report = {};
+    HW_CAN_Get_Filter_Report1( &can1_report );
+    HW_CAN_Get_Filter_Report2( &can2_report );
+    EXPECT_EQ( can2_report.first_bank, 14U );
+    EXPECT_EQ( can2_report.bank_count, 0U );
+    EXPECT_LE( can1_report.bank_count, 14U );
+
+    const CAN_FilterTypeDef&          single = filters[0].second;
+    std::vector<HW_CAN_Filter_Bank_T> can1_banks;
+    for ( size_t i = 1U; i < filters.size(); i++ )
+    {
+        const auto& [hcan, filter] = filters[i];
+        uint32_t bank              = static_cast<uint32_t>( i - 1U );
+        EXPECT_EQ( filter.FilterBank, bank );
+        EXPECT_EQ( filter.SlaveStartFilterBank, 14U );
+        EXPECT_EQ( hcan, bank < 14U ? &hcan1 : &hcan2 );
+
+        if ( bank == 20U )
+        {
+            EXPECT_EQ( filter.FilterActivation, ENABLE );
+            EXPECT_EQ( filter.FilterFIFOAssignment, CAN_FILTER_FIFO0 );
+            EXPECT_EQ( filter.FilterMode, single.FilterMode );
+            EXPECT_EQ( filter.FilterScale, single.FilterScale );
+            EXPECT_EQ( filter.FilterIdHigh, single.FilterIdHigh );
+            EXPECT_EQ( filter.FilterIdLow, single.FilterIdLow );
+            EXPECT_EQ( filter.FilterMaskIdHigh, single.FilterMaskIdHigh );
+            EXPECT_EQ( filter.FilterMaskIdLow, single.FilterMaskIdLow );
+        }
+        else if ( bank < can1_report.bank_count )
+        {
+            EXPECT_EQ( filter.FilterActivation, ENABLE );
+            can1_banks.push_back( BankFromHAL( filter ) );
+        }
+        else
+        {
+            EXPECT_EQ( filter.FilterActivation, DISABLE );
+        }
+    }
+
+    EXPECT_TRUE( PlanMatchesRules( can_filter_plan1, can1_banks.data(),
+                                   static_cast<uint8_t>( can1_banks.size() ), rules ) );
+}
+
+/**
+ * Verify that configuring a single-bank filter moves the other channel's filter set into its
+ * half of the bank 14 split and drops the stale banks it shared with the old split.
+ */
+TEST_F( HWCANTest, ConfigureMovesOtherChannelFilterSetToFixedSplit )
+{
+    std::vector<std::pair<CAN_HandleTypeDef*, CAN_FilterTypeDef>> filters;
+    EXPECT_CALL( mock, CANInit( &hcan1 ) ).WillOnce( Return( HAL_OK ) );
+    EXPECT_CALL( mock, CANStart( &hcan1 ) ).WillOnce( Return( HAL_OK ) );
+    EXPECT_CALL( mock, CANConfigFilter( _, _ ) )
+        .Times( 1 + 2 * static_cast<int>( HW_CAN_FILTER_BANK_COUNT ) )
+        .WillRepeatedly( Invoke( [&filters]( CAN_HandleTypeDef* hcan, CAN_FilterTypeDef* filter ) {
+            filters.emplace_back( hcan, *filter );
+            return HAL_OK;
+        } ) );
+
+    std::vector<HW_CAN_Filter_Rule_T> rules = WideExtendedRules();
+    ASSERT_EQ( HW_CAN_Set_Filters2( rules.data(), HW_CAN_FILTER_MAX_RULES ), HW_CAN_RESULT_OK );
+    HW_CAN_Filter_Report_T can2_report = {};
+    HW_CAN_Get_Filter_Report2( &can2_report );
+    ASSERT_EQ( can2_report.first_bank, 0U );
+    ASSERT_GT( can2_report.bank_count, 14U );
+
+    ASSERT_EQ( HW_CAN_Configure1( 1000000, 3, 0x123, 0x7FF, false ), 0 );
+    ASSERT_EQ( filters.size(), 1U + 2U * HW_CAN_FILTER_BANK_COUNT );
+
+    HW_CAN_Get_Filter_Report2( &can2_report );
+    EXPECT_EQ( can2_report.first_bank, 14U );
+    EXPECT_LE( can2_report.bank_count, 14U );
+
+    const CAN_FilterTypeDef&          single = filters[HW_CAN_FILTER_BANK_COUNT].second;
+    std::vector<HW_CAN_Filter_Bank_T> can2_banks;
+    for ( size_t i = HW_CAN_FILTER_BANK_COUNT + 1U; i < filters.size(); i++ )
+    {
+        const auto& [hcan, filter] = filters[i];
+        uint32_t bank              = static_cast<uint32_t>( i - HW_CAN_FILTER_BANK_COUNT - 1U );
+        EXPECT_EQ( filter.FilterBank, bank );
+        EXPECT_EQ( filter.SlaveStartFilterBank, 14U );
+        EXPECT_EQ( hcan, bank < 14U ? &hcan1 : &hcan2 );
+
+        if ( bank == 3U )
+        {
+            EXPECT_EQ( filter.FilterActivation, ENABLE );
+            EXPECT_EQ( filter.FilterFIFOAssignment, CAN_FILTER_FIFO0 );
+            EXPECT_EQ( filter.FilterIdHigh, single.FilterIdHigh );
+            EXPECT_EQ( filter.FilterMaskIdHigh, single.FilterMaskIdHigh );
+        }
+        else if ( bank >= 14U && bank < 14U + can2_report.bank_count )
+        {
+            EXPECT_EQ( filter.FilterActivation, ENABLE );
+            can2_banks.push_back( BankFromHAL( filter ) );
+        }
+        else
+        {
+            EXPECT_EQ( filter.FilterActivation, DISABLE );
+        }
+    }
+
+    EXPECT_TRUE( PlanMatchesRules( can_filter_plan2, can2_banks.data(),
+                                   static_cast<uint8_t>( can2_banks.size() ), rules ) );
+}
+
+/**
+ * Verify that configuring a channel enables its FIFO1 vector at the FIFO0 vector's priority,
+ * with the error vector at the same priority.
+ */
+TEST_F( HWCANTest, ConfigureEnablesRX1VectorAtRX0Priority )
+{
+    EXPECT_CALL( mock, CANInit( &hcan2 ) ).WillOnce( Return( HAL_OK ) );
+    EXPECT_CALL( mock, CANConfigFilter( &hcan2, _ ) ).WillOnce( Return( HAL_OK ) );
+    EXPECT_CALL( mock, CANStart( &hcan2 ) ).WillOnce( Return( HAL_OK ) );
+    nvic_priority[CAN2_RX0_IRQn]    = 6U;
+    nvic_irq_enabled[CAN2_RX1_IRQn] = false;
+
+    ASSERT_EQ( HW_CAN_Configure2( 1000000, 14, 0x123, 0x7FF, false ), 0 );
+
+    EXPECT_EQ( nvic_priority[CAN2_RX1_IRQn], 6U );
+    EXPECT_EQ( nvic_priority[CAN2_SCE_IRQn], 6U );
+    EXPECT_TRUE( nvic_irq_enabled[CAN2_RX1_IRQn] );
+    EXPECT_EQ( mock_can2_regs.IER & HW_CAN_RX_INTERRUPT_MASK, HW_CAN_RX_INTERRUPT_MASK );
 }
 
 /**-----------------------------------------------------------------------------
@@ -1265,7 +2516,7 @@ TEST_F( HWCANTest, ConfigureReturns1WhenInitFails )
 
     EXPECT_CALL( mock, CANConfigFilter( _, _ ) ).Times( 0 );
 
-    int result = HW_CAN_Configure( &hcan1, 1000000, 0, 0x123, 0x7FF );
+    int result = HW_CAN_Configure( &hcan1, 1000000, 0, 0x123, 0x7FF, false );
 
     EXPECT_EQ( result, 1 );
 }
@@ -1279,7 +2530,7 @@ TEST_F( HWCANTest, ConfigureRejectsInexactTimingWithoutHardwareOrStateChanges )
     EXPECT_CALL( mock, CANConfigFilter( _, _ ) ).Times( 0 );
     EXPECT_CALL( mock, CANStart( _ ) ).Times( 0 );
 
-    EXPECT_EQ( HW_CAN_Configure( &hcan1, 800000U, 0U, 0x123U, 0x7FFU ), 1 );
+    EXPECT_EQ( HW_CAN_Configure( &hcan1, 800000U, 0U, 0x123U, 0x7FFU, false ), 1 );
     EXPECT_EQ( mock_can1_regs.IER, 0xA5A5U );
     EXPECT_EQ( HW_CAN_Tx_Status1(), HW_CAN_TX_STATUS_COMPLETE );
     EXPECT_EQ( can_tx_wp1, 0U );
@@ -1293,7 +2544,7 @@ TEST_F( HWCANTest, ConfigureReturns2WhenFilterFails )
 
     EXPECT_CALL( mock, CANConfigFilter( _, _ ) ).WillOnce( Return( HAL_ERROR ) );
 
-    int result = HW_CAN_Configure( &hcan1, 1000000, 0, 0x123, 0x7FF );
+    int result = HW_CAN_Configure( &hcan1, 1000000, 0, 0x123, 0x7FF, false );
 
     EXPECT_EQ( result, 2 );
 }
@@ -1307,7 +2558,7 @@ TEST_F( HWCANTest, ConfigureReturns3WhenStartFails )
 
     EXPECT_CALL( mock, CANStart( _ ) ).WillOnce( Return( HAL_ERROR ) );
 
-    int result = HW_CAN_Configure( &hcan1, 1000000, 0, 0x123, 0x7FF );
+    int result = HW_CAN_Configure( &hcan1, 1000000, 0, 0x123, 0x7FF, false );
 
     EXPECT_EQ( result, 3 );
 }
@@ -1322,7 +2573,7 @@ TEST_F( HWCANTest, ConfigureSucceedsWithValidConfiguration )
 
     EXPECT_CALL( mock, CANStart( _ ) ).WillOnce( Return( HAL_OK ) );
 
-    int result = HW_CAN_Configure( &hcan1, 1000000, 0, 0x123, 0x7FF );
+    int result = HW_CAN_Configure( &hcan1, 1000000, 0, 0x123, 0x7FF, false );
 
     EXPECT_EQ( result, 0 );
     EXPECT_EQ( mock_can1_regs.IER & ( CAN_IER_FMPIE0 | CAN_IER_FFIE0 | CAN_IER_FOVIE0 ),
@@ -1345,7 +2596,7 @@ TEST_F( HWCANTest, ChannelConfigurationResetsSoftwareState )
     EXPECT_CALL( mock, CANInit( &hcan1 ) ).WillOnce( Return( HAL_OK ) );
     EXPECT_CALL( mock, CANConfigFilter( &hcan1, _ ) ).WillOnce( Return( HAL_OK ) );
     EXPECT_CALL( mock, CANStart( &hcan1 ) ).WillOnce( Return( HAL_OK ) );
-    ASSERT_EQ( HW_CAN_Configure1( 1000000, 0, 0x123, 0x7FF ), 0 );
+    ASSERT_EQ( HW_CAN_Configure1( 1000000, 0, 0x123, 0x7FF, false ), 0 );
 
     EXPECT_EQ( can_tx_wp1, 0 );
     EXPECT_EQ( can_tx_rp1, 0 );
@@ -1437,6 +2688,7 @@ TEST_F( HWCANTest, RecoveryClearsFailedWorkAndAllowsSubsequentTransmission )
     EXPECT_EQ( mock_can1_regs.IER & HW_CAN_ERROR_INTERRUPT_MASK, HW_CAN_ERROR_INTERRUPT_MASK );
     EXPECT_TRUE( nvic_irq_enabled[CAN1_TX_IRQn] );
     EXPECT_TRUE( nvic_irq_enabled[CAN1_RX0_IRQn] );
+    EXPECT_TRUE( nvic_irq_enabled[CAN1_RX1_IRQn] );
     EXPECT_TRUE( nvic_irq_enabled[CAN1_SCE_IRQn] );
 
     CAN_Packet_T retry[1] = { { .id = 0x321, .dlc = 1, .data = { 0x5A } } };
@@ -1471,7 +2723,7 @@ TEST_F( HWCANTest, DirectTransmitReturnsBusyDuringBufferedBatch )
     uint32_t mailbox_id = mock_can1_regs.sTxMailBox[0].TIR;
     uint8_t  direct[1]  = { 0x55 };
 
-    EXPECT_EQ( HW_CAN_Transmit1( direct, 0x456, 1 ), HW_CAN_RESULT_BUSY );
+    EXPECT_EQ( HW_CAN_Transmit1( direct, 0x456, false, 1 ), HW_CAN_RESULT_BUSY );
     EXPECT_EQ( mock_can1_regs.sTxMailBox[0].TIR, mailbox_id );
     EXPECT_EQ( HW_CAN_Tx_Status1(), HW_CAN_TX_STATUS_ACTIVE );
 }
@@ -1481,7 +2733,7 @@ TEST_F( HWCANTest, BufferedTriggerRetainsQueueWhileDirectTransmitIsPending )
 {
     mock_can2_regs.TSR = CAN_TSR_TME;
     uint8_t direct[1]  = { 0x55 };
-    ASSERT_EQ( HW_CAN_Transmit2( direct, 0x456, 1 ), HW_CAN_RESULT_OK );
+    ASSERT_EQ( HW_CAN_Transmit2( direct, 0x456, false, 1 ), HW_CAN_RESULT_OK );
 
     CAN_Packet_T packet[1] = { { .id = 0x222, .dlc = 1, .data = { 0xAA } } };
     ASSERT_EQ( HW_CAN_Tx_Buffer_Write2( packet, 1 ), HW_CAN_RESULT_OK );
@@ -1501,7 +2753,7 @@ TEST_F( HWCANTest, BufferedTriggerClearsStaleDirectCompletionStatus )
 {
     mock_can2_regs.TSR = CAN_TSR_TME;
     uint8_t direct[1]  = { 0x55 };
-    ASSERT_EQ( HW_CAN_Transmit2( direct, 0x456, 1 ), HW_CAN_RESULT_OK );
+    ASSERT_EQ( HW_CAN_Transmit2( direct, 0x456, false, 1 ), HW_CAN_RESULT_OK );
 
     CLEAR_BIT( mock_can2_regs.sTxMailBox[0].TIR, CAN_TI0R_TXRQ );
     mock_can2_regs.TSR = CAN_TSR_RQCP0 | CAN_TSR_TXOK0 | CAN_TSR_TME;
@@ -1669,3 +2921,1466 @@ TEST_F( HWCANTest, MultiFrameBatchCompletesOnlyAfterFinalHardwareEvent )
     EXPECT_FALSE( can_tx_active1 );
     EXPECT_TRUE( HW_CAN_Channel1_Sent() );
 }
+
+/**-----------------------------------------------------------------------------
+ *  RX Throughput Benchmark
+ *------------------------------------------------------------------------------
+ */
+
+/* Shortest frame at 1 Mbit/s: 44-bit standard remote/zero-length frame plus 3-bit intermission */
+static constexpr double   kBenchBitTimeUs      = 1.0;
+static constexpr double   kBenchMinFrameBits   = 47.0;
+static constexpr uint32_t kBenchBusMaxFps      = static_cast<uint32_t>( 1e6 / kBenchMinFrameBits );
+static constexpr double   kBenchDurationUs     = 1e6;
+static constexpr double   kBenchConsumerPeriod = 1000.0;
+
+/** Outcome of one simulated second of back-to-back CAN1 traffic. */
+struct RxBenchResult
+{
+    uint32_t arrived;
+    uint32_t delivered;
+};
+
+/**
+ * Simulate one second of evenly spaced frames arriving on CAN1.
+ *
+ * Each frame lands in FIFO0, or alternately FIFO0 and FIFO1 when dual_fifo is
+ * set. A FIFO going non-empty raises its vector isr_latency_us later, and the
+ * vector runs the real driver ISR. A task drains the ring every
+ * consumer_period_us. Frames that find a hardware FIFO full are lost exactly as
+ * on bxCAN.
+ */
+static RxBenchResult SimulateRxStream( uint32_t frames_per_second, double consumer_period_us,
+                                       double isr_latency_us, bool dual_fifo )
+{
+    ResetCANBuffers();
+    memset( &mock_can1_regs, 0, sizeof( mock_can1_regs ) );
+    for ( CAN_FIFOMailBox_TypeDef& mailbox : mock_can1_regs.sFIFOMailBox )
+    {
+        mailbox.RIR  = static_cast<uint32_t>( 0x100 ) << 21;
+        mailbox.RDTR = 8U;
+    }
+
+    const double              never    = std::numeric_limits<double>::infinity();
+    const double              interval = 1e6 / frames_per_second;
+    std::vector<CAN_Packet_T> sink( HW_CAN_CH1_RX_QUEUE_CAPACITY );
+    RxBenchResult             result        = {};
+    double                    next_consumer = consumer_period_us;
+    double                    isr_due[2]    = { never, never };
+
+    auto drain_ring = [&]() {
+        result.delivered +=
+            HW_CAN_Rx_Buffer_Read1( sink.data(), static_cast<uint16_t>( sink.size() ) );
+    };
+    auto run_isr = [&]( uint8_t fifo ) {
+        isr_due[fifo] = never;
+        fifo == 0U ? CAN1_RX0_IRQHandler() : CAN1_RX1_IRQHandler();
+    };
+
+    for ( ;; )
+    {
+        double next_arrival = result.arrived * interval;
+        double now          = std::min( { next_arrival, next_consumer, isr_due[0], isr_due[1] } );
+        if ( now >= kBenchDurationUs )
+        {
+            break;
+        }
+
+        if ( now == next_consumer )
+        {
+            drain_ring();
+            next_consumer += consumer_period_us;
+        }
+        else if ( now == next_arrival )
+        {
+            uint8_t   fifo    = dual_fifo ? static_cast<uint8_t>( result.arrived & 1U ) : 0U;
+            uint32_t& rfr     = fifo == 0U ? mock_can1_regs.RF0R : mock_can1_regs.RF1R;
+            uint32_t  pending = rfr & CAN_RF0R_FMP0;
+            if ( pending == CAN_RX_FIFO_DEPTH )
+            {
+                rfr |= CAN_RF0R_FOVR0;
+            }
+            else
+            {
+                rfr = ( rfr & ~CAN_RF0R_FMP0 ) | ( pending + 1U );
+                if ( pending == 0U )
+                {
+                    isr_due[fifo] = now + isr_latency_us;
+                }
+            }
+            result.arrived++;
+        }
+        else
+        {
+            run_isr( now == isr_due[0] ? 0U : 1U );
+        }
+    }
+
+    run_isr( 0U );
+    run_isr( 1U );
+    drain_ring();
+    return result;
+}
+
+/** Binary-search the highest frame rate that one simulated second carries without a loss. */
+static uint32_t MaxSustainedFps( double consumer_period_us, double isr_latency_us, bool dual_fifo )
+{
+    uint32_t low  = 1U;
+    uint32_t high = kBenchBusMaxFps;
+    while ( low < high )
+    {
+        uint32_t      rate = low + ( high - low + 1U ) / 2U;
+        RxBenchResult run =
+            SimulateRxStream( rate, consumer_period_us, isr_latency_us, dual_fifo );
+        if ( run.delivered == run.arrived )
+        {
+            low = rate;
+        }
+        else
+        {
+            high = rate - 1U;
+        }
+    }
+    return low;
+}
+
+/** Verify the simulation is lossless at a trivially low rate and lossy past the ring depth. */
+TEST_F( HWCANTest, RxBenchmarkSimulationCountsEveryFrame )
+{
+    RxBenchResult slow = SimulateRxStream( 1000U, kBenchConsumerPeriod, 0.0, true );
+    EXPECT_EQ( slow.arrived, 1000U );
+    EXPECT_EQ( slow.delivered, 1000U );
+
+    /* A 100 ms consumer period cannot keep up with a full bus at any supported depth */
+    RxBenchResult starved = SimulateRxStream( kBenchBusMaxFps, 100000.0, 0.0, true );
+    EXPECT_LT( starved.delivered, starved.arrived );
+    EXPECT_EQ( starved.arrived - starved.delivered, HW_CAN_Rx_Dropped_Count1() );
+}
+
+/**
+ * Report the maximum sustained CAN1 receive rate before drops.
+ *
+ * With the vectors serviced promptly the ring bounds the rate at about one
+ * ring depth per consumer period. With a vector held off by a long critical
+ * section, splitting frames over both FIFOs doubles the hardware headroom.
+ */
+TEST_F( HWCANTest, RxBenchmarkMaxSustainedFramesPerSecond )
+{
+    const double held_off_us = 4.0 * kBenchMinFrameBits * kBenchBitTimeUs;
+
+    uint32_t prompt        = MaxSustainedFps( kBenchConsumerPeriod, 0.0, true );
+    uint32_t single_held   = MaxSustainedFps( kBenchConsumerPeriod, held_off_us, false );
+    uint32_t dual_held     = MaxSustainedFps( kBenchConsumerPeriod, held_off_us, true );
+    uint32_t ring_bound    = static_cast<uint32_t>( HW_CAN_CH1_RX_QUEUE_CAPACITY * 1e6
+                                                    / kBenchConsumerPeriod );
+    uint32_t expect_prompt = std::min( kBenchBusMaxFps, ring_bound );
+
+    std::printf( "CAN1 RX, %u-frame ring, 1 ms consumer, bus max %u frames/s\n",
+                 static_cast<unsigned>( HW_CAN_CH1_RX_QUEUE_CAPACITY ),
+                 static_cast<unsigned>( kBenchBusMaxFps ) );
+    std::printf( "  prompt ISR:          %u frames/s\n", static_cast<unsigned>( prompt ) );
+    std::printf( "  ISR held %.0f us, FIFO0 only: %u frames/s\n", held_off_us,
+                 static_cast<unsigned>( single_held ) );
+    std::printf( "  ISR held %.0f us, FIFO0+1:    %u frames/s\n", held_off_us,
+                 static_cast<unsigned>( dual_held ) );
+    RecordProperty( "prompt_fps", static_cast<int>( prompt ) );
+    RecordProperty( "held_single_fifo_fps", static_cast<int>( single_held ) );
+    RecordProperty( "held_dual_fifo_fps", static_cast<int>( dual_held ) );
+
+    /* Between two consumer passes at most one ring depth can be stored */
+    EXPECT_LE( prompt, ring_bound + HW_CAN_CH1_RX_QUEUE_CAPACITY );
+    EXPECT_GE( prompt + expect_prompt / 50U, expect_prompt );
+    EXPECT_GT( dual_held, single_held );
+}
+
+/** Report the host-side cost of the drain path; informational only. */
+TEST_F( HWCANTest, RxBenchmarkHostDrainThroughput )
+{
+    constexpr uint32_t kFrames = 300000U;
+    CAN_Packet_T       packets[CAN_RX_FIFO_DEPTH * 2U];
+    uint32_t           delivered = 0U;
+
+    mock_can1_regs.sFIFOMailBox[0].RIR  = static_cast<uint32_t>( 0x100 ) << 21;
+    mock_can1_regs.sFIFOMailBox[0].RDTR = 8U;
+    mock_can1_regs.sFIFOMailBox[1]      = mock_can1_regs.sFIFOMailBox[0];
+
+    auto start = std::chrono::steady_clock::now();
+    for ( uint32_t sent = 0U; sent < kFrames; sent += CAN_RX_FIFO_DEPTH * 2U )
+    {
+        mock_can1_regs.RF0R = CAN_RX_FIFO_DEPTH;
+        mock_can1_regs.RF1R = CAN_RX_FIFO_DEPTH;
+        CAN1_RX0_IRQHandler();
+        CAN1_RX1_IRQHandler();
+        delivered += HW_CAN_Rx_Buffer_Read1( packets, CAN_RX_FIFO_DEPTH * 2U );
+    }
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+    std::printf( "host drain path: %.0f frames/s\n", delivered / elapsed.count() );
+    EXPECT_EQ( delivered, kFrames );
+    EXPECT_EQ( HW_CAN_Rx_Dropped_Count1(), 0U );
+}
+
+/**-----------------------------------------------------------------------------
+ *  Cyclic Schedule Tests
+ *------------------------------------------------------------------------------
+ */
+
+/** Verify that frames are first released on their phase and then once per period. */
+TEST_F( HWCANTest, CyclicScheduleReleasesFramesOnPhaseAndPeriod )
+{
+    const HW_CAN_Cyclic_Entry_T table[] = {
+        { .id = 0x100, .payload = nullptr, .period_ms = 10, .phase_ms = 0 },
+        { .id = 0x200, .payload = nullptr, .period_ms = 5, .phase_ms = 3 },
+        { .id = 0x300, .payload = nullptr, .period_ms = 20, .phase_ms = 10 },
+    };
+    ASSERT_TRUE( HW_CAN_Cyclic_Load( &test_schedule, table, 3U, 1U ) );
+
+    std::vector<std::pair<uint32_t, uint32_t>> releases;
+    for ( uint32_t tick = 0U; tick < 40U; tick++ )
+    {
+        for ( uint32_t id : TickAndDrain( &test_schedule, tick ) )
+        {
+            releases.emplace_back( tick, id );
+        }
+    }
+
+    std::vector<std::pair<uint32_t, uint32_t>> expected;
+    for ( uint32_t tick = 0U; tick < 40U; tick++ )
+    {
+        std::vector<uint32_t> due;
+        if ( tick % 10U == 0U )
+            due.push_back( 0x100 );
+        if ( tick % 5U == 3U )
+            due.push_back( 0x200 );
+        if ( tick % 20U == 10U )
+            due.push_back( 0x300 );
+        std::sort( due.begin(), due.end() );
+        for ( uint32_t id : due )
+        {
+            expected.emplace_back( tick, id );
+        }
+    }
+
+    std::sort( releases.begin(), releases.end() );
+    EXPECT_EQ( releases, expected );
+}
+
+/**
+ * Verify that a full table releases frames due on the same tick in table order, however the
+ * calendar slot lists were reordered by earlier reschedules.
+ */
+TEST_F( HWCANTest, CyclicScheduleReleasesSameTickFramesInTableOrder )
+{
+    std::vector<HW_CAN_Cyclic_Entry_T> table( HW_CAN_CYCLIC_MAX_MESSAGES );
+    for ( uint16_t i = 0U; i < HW_CAN_CYCLIC_MAX_MESSAGES; i++ )
+    {
+        table[i].id        = i;
+        table[i].period_ms = static_cast<uint16_t>( 1U + ( i * 7U ) % 5U );
+        table[i].phase_ms  = static_cast<uint16_t>( i % table[i].period_ms );
+    }
+    ASSERT_TRUE( HW_CAN_Cyclic_Load( &test_schedule, table.data(), HW_CAN_CYCLIC_MAX_MESSAGES,
+                                     1U ) );
+
+    for ( uint32_t tick = 0U; tick < 60U; tick++ )
+    {
+        std::vector<uint32_t> expected;
+        for ( const HW_CAN_Cyclic_Entry_T& entry : table )
+        {
+            if ( tick % entry.period_ms == entry.phase_ms )
+            {
+                expected.push_back( entry.id );
+            }
+        }
+        EXPECT_EQ( TickAndDrain( &test_schedule, tick ), expected ) << "tick " << tick;
+    }
+}
+
+/** Verify that a period longer than the calendar is only released on its own lap. */
+TEST_F( HWCANTest, CyclicScheduleHandlesPeriodLongerThanCalendar )
+{
+    const uint16_t              period  = HW_CAN_CYCLIC_CALENDAR_SLOTS * 2U + 7U;
+    const HW_CAN_Cyclic_Entry_T table[] = {
+        { .id = 0x123, .payload = nullptr, .period_ms = period, .phase_ms = 5 },
+    };
+    ASSERT_TRUE( HW_CAN_Cyclic_Load( &test_schedule, table, 1U, 1U ) );
+
+    std::vector<uint32_t> release_ticks;
+    for ( uint32_t tick = 0U; tick < 3U * period; tick++ )
+    {
+        if ( !TickAndDrain( &test_schedule, tick ).empty() )
+        {
+            release_ticks.push_back( tick );
+        }
+    }
+
+    const uint32_t first = 5U;
+    EXPECT_EQ( release_ticks,
+               ( std::vector<uint32_t>{ first, first + period, first + 2U * period } ) );
+}
+
+/** Verify that a release while the previous instance waits is counted as missed. */
+TEST_F( HWCANTest, CyclicScheduleCountsMissedReleaseWhileQueued )
+{
+    const HW_CAN_Cyclic_Entry_T table[] = {
+        { .id = 0x10, .payload = nullptr, .period_ms = 1, .phase_ms = 0 },
+        { .id = 0x20, .payload = nullptr, .period_ms = 1, .phase_ms = 0 },
+    };
+    ASSERT_TRUE( HW_CAN_Cyclic_Load( &test_schedule, table, 2U, 1U ) );
+
+    /* Nothing is drained, so from the second tick on both frames are still queued */
+    for ( uint32_t tick = 0U; tick < 4U; tick++ )
+    {
+        HW_CAN_Cyclic_Tick( &test_schedule, tick );
+    }
+
+    HW_CAN_Cyclic_Stats_T stats{};
+    ASSERT_TRUE( HW_CAN_Cyclic_Get_Stats( &test_schedule, 0U, &stats ) );
+    EXPECT_EQ( stats.missed, 3U );
+    EXPECT_EQ( stats.sent, 0U );
+    EXPECT_EQ( test_schedule.ready_count, 2U );
+}
+
+/** Verify release latency and period error statistics from completion timestamps. */
+TEST_F( HWCANTest, CyclicScheduleRecordsLatencyAndPeriodError )
+{
+    const HW_CAN_Cyclic_Entry_T table[] = {
+        { .id = 0x55, .payload = nullptr, .period_ms = 2, .phase_ms = 0 },
+    };
+    ASSERT_TRUE( HW_CAN_Cyclic_Load( &test_schedule, table, 1U, 10U ) );
+
+    /* Completions 40 us, 100 us and 70 us after release, in 10 counts per us */
+    const uint32_t latency_us[] = { 40U, 100U, 70U };
+    for ( uint32_t release = 0U; release < 3U; release++ )
+    {
+        uint32_t release_time = release * 2000U * 10U;
+        HW_CAN_Cyclic_Tick( &test_schedule, release_time );
+        HW_CAN_Cyclic_Tick( &test_schedule, release_time + 10000U );
+        ASSERT_EQ( HW_CAN_Cyclic_Pop_Ready( &test_schedule ), 0U );
+        HW_CAN_Cyclic_Complete( &test_schedule, release_time + latency_us[release] * 10U, true );
+    }
+
+    HW_CAN_Cyclic_Stats_T stats{};
+    ASSERT_TRUE( HW_CAN_Cyclic_Get_Stats( &test_schedule, 0U, &stats ) );
+    EXPECT_EQ( stats.sent, 3U );
+    EXPECT_EQ( stats.min_latency_us, 40U );
+    EXPECT_EQ( stats.max_latency_us, 100U );
+    EXPECT_EQ( stats.max_period_error_us, 60U );
+}
+
+/** Verify that a failed completion is counted and breaks the period error chain. */
+TEST_F( HWCANTest, CyclicScheduleFailedCompletionSkipsPeriodError )
+{
+    const HW_CAN_Cyclic_Entry_T table[] = {
+        { .id = 0x55, .payload = nullptr, .period_ms = 1, .phase_ms = 0 },
+    };
+    ASSERT_TRUE( HW_CAN_Cyclic_Load( &test_schedule, table, 1U, 1U ) );
+
+    HW_CAN_Cyclic_Tick( &test_schedule, 0U );
+    ASSERT_EQ( HW_CAN_Cyclic_Pop_Ready( &test_schedule ), 0U );
+    HW_CAN_Cyclic_Complete( &test_schedule, 10U, true );
+
+    HW_CAN_Cyclic_Tick( &test_schedule, 1000U );
+    ASSERT_EQ( HW_CAN_Cyclic_Pop_Ready( &test_schedule ), 0U );
+    HW_CAN_Cyclic_Complete( &test_schedule, 1010U, false );
+
+    HW_CAN_Cyclic_Tick( &test_schedule, 2000U );
+    ASSERT_EQ( HW_CAN_Cyclic_Pop_Ready( &test_schedule ), 0U );
+    HW_CAN_Cyclic_Complete( &test_schedule, 2010U, true );
+
+    HW_CAN_Cyclic_Stats_T stats{};
+    ASSERT_TRUE( HW_CAN_Cyclic_Get_Stats( &test_schedule, 0U, &stats ) );
+    EXPECT_EQ( stats.sent, 2U );
+    EXPECT_EQ( stats.failed, 1U );
+    EXPECT_EQ( stats.max_period_error_us, 0U );
+}
+
+/** Verify that invalid tables are rejected and leave the loaded schedule intact. */
+TEST_F( HWCANTest, CyclicLoadRejectsInvalidEntries )
+{
+    const uint8_t               payload[8] = {};
+    const HW_CAN_Cyclic_Entry_T valid[]    = {
+        { .id = 0x7FF, .payload = payload, .period_ms = 10, .phase_ms = 9, .dlc = 8 },
+    };
+    ASSERT_TRUE( HW_CAN_Cyclic_Load( &test_schedule, valid, 1U, 1U ) );
+
+    const HW_CAN_Cyclic_Entry_T invalid[] = {
+        { .id = 0x800, .payload = payload, .period_ms = 10, .phase_ms = 0, .dlc = 1 },
+        { .id = 0x20000000, .payload = payload, .period_ms = 10, .phase_ms = 0, .dlc = 1,
+          .extended = true },
+        { .id = 0x100, .payload = payload, .period_ms = 10, .phase_ms = 0, .dlc = 9 },
+        { .id = 0x100, .payload = nullptr, .period_ms = 10, .phase_ms = 0, .dlc = 1 },
+        { .id = 0x100, .payload = payload, .period_ms = 0, .phase_ms = 0, .dlc = 1 },
+        { .id = 0x100, .payload = payload, .period_ms = 10, .phase_ms = 10, .dlc = 1 },
+    };
+    for ( const HW_CAN_Cyclic_Entry_T& entry : invalid )
+    {
+        EXPECT_FALSE( HW_CAN_Cyclic_Load( &test_schedule, &entry, 1U, 1U ) );
+    }
+    EXPECT_FALSE( HW_CAN_Cyclic_Load( &test_schedule, nullptr, 1U, 1U ) );
+    EXPECT_FALSE(
+        HW_CAN_Cyclic_Load( &test_schedule, valid, HW_CAN_CYCLIC_MAX_MESSAGES + 1U, 1U ) );
+
+    EXPECT_EQ( test_schedule.message_count, 1U );
+    EXPECT_EQ( test_schedule.messages[0].id, 0x7FFU );
+}
+
+/** Verify that a payload update is published whole through the inactive buffer. */
+TEST_F( HWCANTest, CyclicPayloadUpdateSwapsBuffers )
+{
+    const uint8_t               initial[3] = { 1, 2, 3 };
+    const HW_CAN_Cyclic_Entry_T table[]    = {
+        { .id = 0x1, .payload = initial, .period_ms = 1, .phase_ms = 0, .dlc = 3 },
+    };
+    ASSERT_TRUE( HW_CAN_Cyclic_Load( &test_schedule, table, 1U, 1U ) );
+
+    uint8_t data[8];
+    ASSERT_EQ( HW_CAN_Cyclic_Read_Payload( &test_schedule, 0U, data ), 3U );
+    EXPECT_EQ( data[2], 3U );
+
+    const uint8_t update[8] = { 9, 8, 7, 6, 5, 4, 3, 2 };
+    uint8_t       active    = test_schedule.messages[0].active_payload;
+    ASSERT_TRUE( HW_CAN_Cyclic_Update_Payload( &test_schedule, 0U, update, 8U ) );
+    EXPECT_NE( test_schedule.messages[0].active_payload, active );
+    EXPECT_EQ( test_schedule.messages[0].payload_generation, 1U );
+
+    ASSERT_EQ( HW_CAN_Cyclic_Read_Payload( &test_schedule, 0U, data ), 8U );
+    EXPECT_EQ( memcmp( data, update, 8U ), 0 );
+
+    /* The previous payload is untouched until the next update writes over it */
+    EXPECT_EQ( test_schedule.messages[0].payload[active].dlc, 3U );
+
+    EXPECT_FALSE( HW_CAN_Cyclic_Update_Payload( &test_schedule, 1U, update, 8U ) );
+    EXPECT_FALSE( HW_CAN_Cyclic_Update_Payload( &test_schedule, 0U, update, 9U ) );
+    EXPECT_FALSE( HW_CAN_Cyclic_Update_Payload( &test_schedule, 0U, nullptr, 1U ) );
+}
+
+/** Verify that starting a schedule reserves mailbox 2 and starts a 1 ms tick. */
+TEST_F( HWCANTest, CyclicStartReservesMailboxTwoAndStartsTick )
+{
+    const HW_CAN_Cyclic_Entry_T table[] = {
+        { .id = 0x321, .payload = nullptr, .period_ms = 10, .phase_ms = 0 },
+    };
+    ASSERT_EQ( HW_CAN_Cyclic_Start1( table, 1U ), HW_CAN_RESULT_OK );
+
+    EXPECT_EQ( mock_timer_configure_count, 1U );
+    EXPECT_EQ( mock_timer_start_count, 1U );
+    EXPECT_EQ( ( mock_timer_psc + 1U ) * ( mock_timer_arr + 1U ),
+               TEST_HW_CAN_TIMER_CLOCK_HZ / 1000U );
+    EXPECT_NE( mock_can1_regs.IER & CAN_IER_TMEIE, 0U );
+    EXPECT_EQ( HW_CAN_Cyclic_Start1( table, 1U ), HW_CAN_RESULT_BUSY );
+
+    /* A second channel shares the running tick */
+    ASSERT_EQ( HW_CAN_Cyclic_Start2( table, 1U ), HW_CAN_RESULT_OK );
+    EXPECT_EQ( mock_timer_start_count, 1U );
+
+    /* Direct sends only see mailboxes 0 and 1 */
+    mock_can1_regs.TSR = CAN_TSR_TME;
+    uint8_t data[1]    = { 0xAA };
+    EXPECT_EQ( HW_CAN_Transmit1( data, 0x10, false, 1U ), HW_CAN_RESULT_OK );
+    EXPECT_EQ( HW_CAN_Transmit1( data, 0x11, false, 1U ), HW_CAN_RESULT_OK );
+    EXPECT_EQ( HW_CAN_Transmit1( data, 0x12, false, 1U ), HW_CAN_RESULT_BUSY );
+    EXPECT_EQ( mock_can1_regs.sTxMailBox[2].TIR, 0U );
+}
+
+/** Verify that a start with an invalid table changes nothing. */
+TEST_F( HWCANTest, CyclicStartRejectsInvalidTable )
+{
+    const HW_CAN_Cyclic_Entry_T table[] = {
+        { .id = 0x321, .payload = nullptr, .period_ms = 0, .phase_ms = 0 },
+    };
+    EXPECT_EQ( HW_CAN_Cyclic_Start1( table, 1U ), HW_CAN_RESULT_ERROR );
+    EXPECT_FALSE( can_cyclic1.running );
+    EXPECT_FALSE( can_cyclic1.mailbox_reserved );
+    EXPECT_EQ( mock_timer_start_count, 0U );
+}
+
+/** Verify that ticks load mailbox 2 and each completion loads the next released frame. */
+TEST_F( HWCANTest, CyclicTickLoadsMailboxTwoAndCompletionLoadsNext )
+{
+    const uint8_t               payload_a[2] = { 0x11, 0x22 };
+    const uint8_t               payload_b[1] = { 0x33 };
+    const HW_CAN_Cyclic_Entry_T table[]      = {
+        { .id = 0x100, .payload = payload_a, .period_ms = 2, .phase_ms = 0, .dlc = 2 },
+        { .id = 0x1ABCDE, .payload = payload_b, .period_ms = 2, .phase_ms = 0, .dlc = 1,
+               .extended = true },
+    };
+    mock_can1_regs.TSR = CAN_TSR_TME;
+    ASSERT_EQ( HW_CAN_Cyclic_Start1( table, 2U ), HW_CAN_RESULT_OK );
+
+    mock_time_us = 1000U;
+    HW_CAN_Cyclic_Tick_From_ISR();
+
+    EXPECT_EQ( mock_can1_regs.sTxMailBox[2].TIR,
+               ( static_cast<uint32_t>( 0x100 ) << 21 ) | CAN_TI0R_TXRQ );
+    EXPECT_EQ( mock_can1_regs.sTxMailBox[2].TDTR, 2U );
+    EXPECT_EQ( mock_can1_regs.sTxMailBox[2].TDLR, 0x2211U );
+    EXPECT_EQ( mock_can1_regs.sTxMailBox[0].TIR, 0U );
+
+    mock_time_us += 50U;
+    CompleteMailbox1( 2U );
+
+    EXPECT_EQ( mock_can1_regs.sTxMailBox[2].TIR,
+               ( static_cast<uint32_t>( 0x1ABCDE ) << 3 ) | CAN_TI0R_IDE | CAN_TI0R_TXRQ );
+    EXPECT_EQ( mock_can1_regs.TSR & CAN_TSR_RQCP2, 0U );
+    EXPECT_NE( mock_can1_regs.IER & CAN_IER_TMEIE, 0U );
+
+    mock_time_us += 30U;
+    CompleteMailbox1( 2U );
+
+    HW_CAN_Cyclic_Stats_T stats{};
+    ASSERT_EQ( HW_CAN_Cyclic_Get_Stats1( 0U, &stats ), HW_CAN_RESULT_OK );
+    EXPECT_EQ( stats.sent, 1U );
+    EXPECT_EQ( stats.min_latency_us, 50U );
+    ASSERT_EQ( HW_CAN_Cyclic_Get_Stats1( 1U, &stats ), HW_CAN_RESULT_OK );
+    EXPECT_EQ( stats.sent, 1U );
+    EXPECT_EQ( stats.max_latency_us, 80U );
+    EXPECT_EQ( HW_CAN_Cyclic_Get_Stats1( 2U, &stats ), HW_CAN_RESULT_ERROR );
+}
+
+/** Verify that reading cyclic statistics masks both the TX vector and the schedule tick vector. */
+TEST_F( HWCANTest, CyclicGetStatsMasksTxAndTickVectors )
+{
+    const HW_CAN_Cyclic_Entry_T table[] = { { .id = 0x100, .period_ms = 1 } };
+    ASSERT_EQ( HW_CAN_Cyclic_Start1( table, 1U ), HW_CAN_RESULT_OK );
+    memset( nvic_disable_count, 0, sizeof( nvic_disable_count ) );
+    nvic_irq_enabled[TIM8_UP_TIM13_IRQn] = false;
+
+    HW_CAN_Cyclic_Stats_T stats{};
+    ASSERT_EQ( HW_CAN_Cyclic_Get_Stats1( 0U, &stats ), HW_CAN_RESULT_OK );
+
+    EXPECT_EQ( nvic_disable_count[CAN1_TX_IRQn], 1U );
+    EXPECT_EQ( nvic_disable_count[TIM8_UP_TIM13_IRQn], 1U );
+    EXPECT_TRUE( nvic_irq_enabled[CAN1_TX_IRQn] );
+    EXPECT_FALSE( nvic_irq_enabled[TIM8_UP_TIM13_IRQn] );
+}
+
+/** Verify that an updated payload is sent on the next release. */
+TEST_F( HWCANTest, CyclicUpdatedPayloadIsSentOnNextRelease )
+{
+    const uint8_t               initial[1] = { 0x01 };
+    const HW_CAN_Cyclic_Entry_T table[]    = {
+        { .id = 0x100, .payload = initial, .period_ms = 1, .phase_ms = 0, .dlc = 1 },
+    };
+    mock_can1_regs.TSR = CAN_TSR_TME;
+    ASSERT_EQ( HW_CAN_Cyclic_Start1( table, 1U ), HW_CAN_RESULT_OK );
+
+    HW_CAN_Cyclic_Tick_From_ISR();
+    EXPECT_EQ( mock_can1_regs.sTxMailBox[2].TDLR, 0x01U );
+    CompleteMailbox1( 2U );
+
+    const uint8_t update[2] = { 0xBE, 0xEF };
+    ASSERT_EQ( HW_CAN_Cyclic_Update_Payload1( 0U, update, 2U ), HW_CAN_RESULT_OK );
+    EXPECT_EQ( HW_CAN_Cyclic_Update_Payload1( 1U, update, 2U ), HW_CAN_RESULT_ERROR );
+
+    HW_CAN_Cyclic_Tick_From_ISR();
+    EXPECT_EQ( mock_can1_regs.sTxMailBox[2].TDTR, 2U );
+    EXPECT_EQ( mock_can1_regs.sTxMailBox[2].TDLR, 0xEFBEU );
+}
+
+/** Verify that stopping lets the in-flight frame finish before mailbox 2 is released. */
+TEST_F( HWCANTest, CyclicStopReleasesMailboxAfterInFlightFrame )
+{
+    const HW_CAN_Cyclic_Entry_T table[] = {
+        { .id = 0x100, .payload = nullptr, .period_ms = 1, .phase_ms = 0 },
+    };
+    mock_can1_regs.TSR = CAN_TSR_TME;
+    ASSERT_EQ( HW_CAN_Cyclic_Start1( table, 1U ), HW_CAN_RESULT_OK );
+    HW_CAN_Cyclic_Tick_From_ISR();
+    ASSERT_EQ( mock_can1_regs.TSR & CAN_TSR_TME2, 0U );
+
+    HW_CAN_Cyclic_Stop1();
+    EXPECT_EQ( mock_timer_stop_count, 1U );
+    EXPECT_TRUE( can_cyclic1.mailbox_reserved );
+    EXPECT_EQ( HW_CAN_Cyclic_Start1( table, 1U ), HW_CAN_RESULT_BUSY );
+
+    /* Further ticks release nothing */
+    HW_CAN_Cyclic_Tick_From_ISR();
+    EXPECT_EQ( can_cyclic1.schedule.ready_count, 0U );
+
+    CompleteMailbox1( 2U );
+    EXPECT_FALSE( can_cyclic1.mailbox_reserved );
+    EXPECT_EQ( mock_can1_regs.IER & CAN_IER_TMEIE, 0U );
+
+    HW_CAN_Cyclic_Stats_T stats{};
+    ASSERT_EQ( HW_CAN_Cyclic_Get_Stats1( 0U, &stats ), HW_CAN_RESULT_OK );
+    EXPECT_EQ( stats.sent, 1U );
+
+    EXPECT_EQ( HW_CAN_Cyclic_Start1( table, 1U ), HW_CAN_RESULT_OK );
+}
+
+/** Verify that a batch runs alongside a schedule without waiting on mailbox 2. */
+TEST_F( HWCANTest, CyclicScheduleCoexistsWithBufferedBatch )
+{
+    const HW_CAN_Cyclic_Entry_T table[] = {
+        { .id = 0x100, .payload = nullptr, .period_ms = 1, .phase_ms = 0 },
+    };
+    mock_can1_regs.TSR = CAN_TSR_TME;
+    ASSERT_EQ( HW_CAN_Cyclic_Start1( table, 1U ), HW_CAN_RESULT_OK );
+    HW_CAN_Cyclic_Tick_From_ISR();
+    ASSERT_NE( mock_can1_regs.sTxMailBox[2].TIR & CAN_TI0R_TXRQ, 0U );
+
+    CAN_Packet_T packets[2] = {
+        { .id = 0x201, .dlc = 1, .data = { 0xAA } },
+        { .id = 0x202, .dlc = 1, .data = { 0xBB } },
+    };
+    ASSERT_EQ( HW_CAN_Tx_Buffer_Write1( packets, 2 ), HW_CAN_RESULT_OK );
+    ASSERT_EQ( HW_CAN_Tx_Trigger1(), HW_CAN_RESULT_OK );
+    EXPECT_EQ( mock_can1_regs.sTxMailBox[0].TIR,
+               ( static_cast<uint32_t>( 0x201 ) << 21 ) | CAN_TI0R_TXRQ );
+
+    /* The cyclic completion does not advance the batch */
+    CompleteMailbox1( 2U );
+    EXPECT_EQ( mock_can1_regs.sTxMailBox[0].TIR,
+               ( static_cast<uint32_t>( 0x201 ) << 21 ) | CAN_TI0R_TXRQ );
+    EXPECT_TRUE( can_tx_active1 );
+
+    CompleteMailbox1( 0U );
+    EXPECT_EQ( mock_can1_regs.sTxMailBox[0].TIR,
+               ( static_cast<uint32_t>( 0x202 ) << 21 ) | CAN_TI0R_TXRQ );
+    CompleteMailbox1( 0U );
+    EXPECT_TRUE( HW_CAN_Channel1_Sent() );
+
+    /* The finished batch leaves the TX interrupt to the schedule */
+    EXPECT_NE( mock_can1_regs.IER & CAN_IER_TMEIE, 0U );
+}
+
+/** Verify that a reset stops and empties a running schedule. */
+TEST_F( HWCANTest, CyclicResetStopsSchedule )
+{
+    const HW_CAN_Cyclic_Entry_T table[] = {
+        { .id = 0x100, .payload = nullptr, .period_ms = 1, .phase_ms = 0 },
+    };
+    mock_can1_regs.TSR = CAN_TSR_TME;
+    ASSERT_EQ( HW_CAN_Cyclic_Start1( table, 1U ), HW_CAN_RESULT_OK );
+
+    HW_CAN_Reset1();
+
+    EXPECT_FALSE( can_cyclic1.running );
+    EXPECT_FALSE( can_cyclic1.mailbox_reserved );
+    EXPECT_EQ( can_cyclic1.schedule.message_count, 0U );
+    EXPECT_EQ( mock_timer_stop_count, 1U );
+}
+
+/**-----------------------------------------------------------------------------
+ *  Auto-Responder Tests
+ *------------------------------------------------------------------------------
+ */
+
+/* Diagnostic-style table: two answers to 0x7E0 told apart by payload, one masked nibble. */
+static const HW_CAN_Responder_Entry_T kResponderTable[] = {
+    { .request_id        = 0x7E0,
+      .request_data      = { 0x02, 0x10 },
+      .request_mask      = { 0xFF, 0xFF },
+      .response_id       = 0x7E8,
+      .response_data     = { 0x06, 0x50 },
+      .response_dlc      = 2 },
+    { .request_id        = 0x7E0,
+      .request_data      = {},
+      .request_mask      = {},
+      .response_id       = 0x7E8,
+      .response_data     = { 0x7F },
+      .response_dlc      = 1 },
+    { .request_id        = 0x123,
+      .request_data      = { 0x00, 0x00, 0x50 },
+      .request_mask      = { 0x00, 0x00, 0xF0 },
+      .response_id       = 0x18DAF110,
+      .response_data     = { 0xAA },
+      .response_dlc      = 1,
+      .response_extended = true },
+};
+
+/** Verify identifier lookup, masked payload compare, table order, and short frames. */
+TEST_F( HWCANTest, ResponderMatchesIdentifierAndMaskedPayload )
+{
+    ASSERT_TRUE( HW_CAN_Responder_Load( &test_responder, kResponderTable, 3U ) );
+
+    const uint8_t session[2] = { 0x02, 0x10 };
+    const uint8_t other[2]   = { 0x02, 0x11 };
+    const uint8_t nibble[3]  = { 0xFF, 0xFF, 0x5A };
+    EXPECT_EQ( HW_CAN_Responder_Match( &test_responder, 0x7E0, false, session, 2U ), 0U );
+    EXPECT_EQ( HW_CAN_Responder_Match( &test_responder, 0x7E0, false, other, 2U ), 1U );
+    EXPECT_EQ( HW_CAN_Responder_Match( &test_responder, 0x123, false, nibble, 3U ), 2U );
+
+    /* Bytes past the DLC are neither read nor enough to satisfy a mask */
+    EXPECT_EQ( HW_CAN_Responder_Match( &test_responder, 0x7E0, false, session, 1U ), 1U );
+    EXPECT_EQ( HW_CAN_Responder_Match( &test_responder, 0x123, false, nibble, 2U ),
+               HW_CAN_RESPONDER_NONE );
+
+    EXPECT_EQ( HW_CAN_Responder_Match( &test_responder, 0x7E0, true, session, 2U ),
+               HW_CAN_RESPONDER_NONE );
+    EXPECT_EQ( HW_CAN_Responder_Match( &test_responder, 0x7E1, false, session, 2U ),
+               HW_CAN_RESPONDER_NONE );
+    EXPECT_EQ( HW_CAN_Responder_Match( &test_responder, 0x1FFFFFFF, false, session, 2U ),
+               HW_CAN_RESPONDER_NONE );
+}
+
+/** Verify that invalid tables are rejected without disturbing the loaded one. */
+TEST_F( HWCANTest, ResponderLoadRejectsInvalidEntries )
+{
+    ASSERT_TRUE( HW_CAN_Responder_Load( &test_responder, kResponderTable, 3U ) );
+
+    HW_CAN_Responder_Entry_T entry = kResponderTable[0];
+    entry.request_id               = 0x800;
+    EXPECT_FALSE( HW_CAN_Responder_Load( &test_responder, &entry, 1U ) );
+    entry             = kResponderTable[0];
+    entry.response_id = 0x800;
+    EXPECT_FALSE( HW_CAN_Responder_Load( &test_responder, &entry, 1U ) );
+    entry              = kResponderTable[0];
+    entry.response_dlc = 9U;
+    EXPECT_FALSE( HW_CAN_Responder_Load( &test_responder, &entry, 1U ) );
+    EXPECT_FALSE( HW_CAN_Responder_Load( &test_responder, nullptr, 1U ) );
+    EXPECT_FALSE( HW_CAN_Responder_Load( &test_responder, kResponderTable,
+                                         HW_CAN_RESPONDER_MAX_ENTRIES + 1U ) );
+
+    const uint8_t session[2] = { 0x02, 0x10 };
+    EXPECT_EQ( test_responder.entry_count, 3U );
+    EXPECT_EQ( HW_CAN_Responder_Match( &test_responder, 0x7E0, false, session, 2U ), 0U );
+
+    EXPECT_TRUE( HW_CAN_Responder_Load( &test_responder, nullptr, 0U ) );
+    EXPECT_EQ( HW_CAN_Responder_Match( &test_responder, 0x7E0, false, session, 2U ),
+               HW_CAN_RESPONDER_NONE );
+}
+
+/** Verify queue order, the full-queue miss, and latency of sent and failed responses. */
+TEST_F( HWCANTest, ResponderQueueCountsMissesAndLatency )
+{
+    ASSERT_TRUE( HW_CAN_Responder_Load( &test_responder, kResponderTable, 3U ) );
+
+    for ( uint8_t i = 0U; i < HW_CAN_RESPONDER_QUEUE_DEPTH; i++ )
+    {
+        EXPECT_TRUE( HW_CAN_Responder_Queue( &test_responder, i % 3U, 100U * i ) );
+    }
+    EXPECT_FALSE( HW_CAN_Responder_Queue( &test_responder, 0U, 0U ) );
+
+    EXPECT_EQ( HW_CAN_Responder_Pop( &test_responder ), 0U );
+    EXPECT_EQ( HW_CAN_Responder_Pop( &test_responder ), HW_CAN_RESPONDER_NONE );
+    HW_CAN_Responder_Complete( &test_responder, 250U, true );
+
+    EXPECT_EQ( HW_CAN_Responder_Pop( &test_responder ), 1U );
+    HW_CAN_Responder_Complete( &test_responder, 190U, true );
+
+    EXPECT_EQ( HW_CAN_Responder_Pop( &test_responder ), 2U );
+    HW_CAN_Responder_Complete( &test_responder, 900U, false );
+    HW_CAN_Responder_Complete( &test_responder, 900U, true );
+
+    const HW_CAN_Responder_Stats_T& stats = test_responder.stats;
+    EXPECT_EQ( stats.matched, HW_CAN_RESPONDER_QUEUE_DEPTH + 1U );
+    EXPECT_EQ( stats.missed, 1U );
+    EXPECT_EQ( stats.sent, 2U );
+    EXPECT_EQ( stats.failed, 1U );
+    EXPECT_EQ( stats.min_latency_us, 90U );
+    EXPECT_EQ( stats.max_latency_us, 250U );
+    EXPECT_EQ( stats.last_latency_us, 90U );
+
+    HW_CAN_Responder_Flush( &test_responder );
+    EXPECT_EQ( HW_CAN_Responder_Pop( &test_responder ), HW_CAN_RESPONDER_NONE );
+}
+
+/** Verify that the RX vector loads a matching response into mailbox 0 and times it. */
+TEST_F( HWCANTest, ResponderRxMatchLoadsMailboxZero )
+{
+    mock_can1_regs.TSR = CAN_TSR_TME;
+    ASSERT_EQ( HW_CAN_Responder_Start1( kResponderTable, 3U ), HW_CAN_RESULT_OK );
+    EXPECT_NE( mock_can1_regs.IER & CAN_IER_TMEIE, 0U );
+    EXPECT_EQ( HW_CAN_Responder_Start1( kResponderTable, 3U ), HW_CAN_RESULT_BUSY );
+
+    const uint8_t request[2] = { 0x02, 0x10 };
+    mock_time_us             = 1000U;
+    ReceiveFrame1( 0x7E0, request, 2U );
+
+    EXPECT_EQ( mock_can1_regs.sTxMailBox[0].TIR,
+               ( static_cast<uint32_t>( 0x7E8 ) << 21 ) | CAN_TI0R_TXRQ );
+    EXPECT_EQ( mock_can1_regs.sTxMailBox[0].TDTR, 2U );
+    EXPECT_EQ( mock_can1_regs.sTxMailBox[0].TDLR, 0x5006U );
+
+    /* The request still reaches the RX queue */
+    CAN_Packet_T out[1] = {};
+    ASSERT_EQ( HW_CAN_Rx_Buffer_Read1( out, 1U ), 1U );
+    EXPECT_EQ( out[0].id, 0x7E0U );
+
+    /* A non-matching frame leaves the mailbox alone */
+    mock_time_us = 1180U;
+    CompleteMailbox1( 0U );
+    ReceiveFrame1( 0x7E1, request, 2U );
+    EXPECT_NE( mock_can1_regs.TSR & CAN_TSR_TME0, 0U );
+
+    HW_CAN_Responder_Stats_T stats{};
+    ASSERT_EQ( HW_CAN_Responder_Get_Stats1( &stats ), HW_CAN_RESULT_OK );
+    EXPECT_EQ( stats.matched, 1U );
+    EXPECT_EQ( stats.sent, 1U );
+    EXPECT_EQ( stats.min_latency_us, 180U );
+    EXPECT_EQ( stats.last_latency_us, 180U );
+    EXPECT_EQ( HW_CAN_Responder_Get_Stats1( nullptr ), HW_CAN_RESULT_ERROR );
+    EXPECT_TRUE( can_responder1.mailbox_reserved );
+    EXPECT_NE( mock_can1_regs.IER & CAN_IER_TMEIE, 0U );
+}
+
+/** Verify that responses queue behind a busy mailbox 0 and direct sends stay off it. */
+TEST_F( HWCANTest, ResponderQueuesWhileMailboxBusyAndBatchesAvoidMailboxZero )
+{
+    mock_can1_regs.TSR = CAN_TSR_TME;
+    ASSERT_EQ( HW_CAN_Responder_Start1( kResponderTable, 3U ), HW_CAN_RESULT_OK );
+
+    const uint8_t session[2] = { 0x02, 0x10 };
+    const uint8_t other[1]   = { 0x01 };
+    ReceiveFrame1( 0x7E0, session, 2U );
+    ReceiveFrame1( 0x7E0, other, 1U );
+    EXPECT_EQ( can_responder1.responder.queue_count, 1U );
+
+    uint8_t data[1] = { 0xAA };
+    EXPECT_EQ( HW_CAN_Transmit1( data, 0x10, false, 1U ), HW_CAN_RESULT_OK );
+    EXPECT_EQ( HW_CAN_Transmit1( data, 0x11, false, 1U ), HW_CAN_RESULT_OK );
+    EXPECT_EQ( HW_CAN_Transmit1( data, 0x12, false, 1U ), HW_CAN_RESULT_BUSY );
+    EXPECT_EQ( mock_can1_regs.sTxMailBox[0].TDLR, 0x5006U );
+
+    CompleteMailbox1( 0U );
+    EXPECT_EQ( mock_can1_regs.sTxMailBox[0].TDTR, 1U );
+    EXPECT_EQ( mock_can1_regs.sTxMailBox[0].TDLR, 0x7FU );
+    EXPECT_EQ( can_responder1.responder.queue_count, 0U );
+
+    HW_CAN_Responder_Stats_T stats{};
+    ASSERT_EQ( HW_CAN_Responder_Get_Stats1( &stats ), HW_CAN_RESULT_OK );
+    EXPECT_EQ( stats.matched, 2U );
+    EXPECT_EQ( stats.sent, 1U );
+    EXPECT_EQ( stats.missed, 0U );
+}
+
+/** Verify that stopping lets the in-flight response finish and that reset clears the table. */
+TEST_F( HWCANTest, ResponderStopReleasesMailboxAfterInFlightResponse )
+{
+    mock_can1_regs.TSR = CAN_TSR_TME;
+    ASSERT_EQ( HW_CAN_Responder_Start1( kResponderTable, 3U ), HW_CAN_RESULT_OK );
+
+    const uint8_t session[2] = { 0x02, 0x10 };
+    ReceiveFrame1( 0x7E0, session, 2U );
+    ReceiveFrame1( 0x7E0, session, 2U );
+
+    HW_CAN_Responder_Stop1();
+    EXPECT_TRUE( can_responder1.mailbox_reserved );
+    EXPECT_EQ( can_responder1.responder.queue_count, 0U );
+    EXPECT_EQ( HW_CAN_Responder_Start1( kResponderTable, 3U ), HW_CAN_RESULT_BUSY );
+
+    /* Requests after the stop are ignored */
+    ReceiveFrame1( 0x7E0, session, 2U );
+    EXPECT_EQ( can_responder1.responder.stats.matched, 2U );
+
+    CompleteMailbox1( 0U );
+    EXPECT_FALSE( can_responder1.mailbox_reserved );
+    EXPECT_EQ( mock_can1_regs.IER & CAN_IER_TMEIE, 0U );
+    EXPECT_EQ( can_responder1.responder.stats.sent, 1U );
+
+    ASSERT_EQ( HW_CAN_Responder_Start1( kResponderTable, 3U ), HW_CAN_RESULT_OK );
+    HW_CAN_Reset1();
+    EXPECT_FALSE( can_responder1.running );
+    EXPECT_FALSE( can_responder1.mailbox_reserved );
+    EXPECT_EQ( can_responder1.responder.entry_count, 0U );
+}
+
+/** Verify that an invalid table leaves the responder stopped. */
+TEST_F( HWCANTest, ResponderStartRejectsInvalidTable )
+{
+    HW_CAN_Responder_Entry_T entry = kResponderTable[0];
+    entry.response_dlc             = 9U;
+    EXPECT_EQ( HW_CAN_Responder_Start2( &entry, 1U ), HW_CAN_RESULT_ERROR );
+    EXPECT_FALSE( can_responder2.running );
+    EXPECT_FALSE( can_responder2.mailbox_reserved );
+    EXPECT_EQ( mock_can2_regs.IER & CAN_IER_TMEIE, 0U );
+}
+
+/**-----------------------------------------------------------------------------
+ *  Log Replay Tests
+ *------------------------------------------------------------------------------
+ */
+
+/** Verify that validation walks every record and rejects each kind of malformed log. */
+TEST_F( HWCANTest, ReplayValidateRejectsMalformedLogs )
+{
+    std::vector<uint8_t> log         = ReplayTestLog();
+    uint32_t             frame_count = 0U;
+    ASSERT_TRUE( HW_CAN_Replay_Validate( log.data(), static_cast<uint32_t>( log.size() ),
+                                         &frame_count ) );
+    EXPECT_EQ( frame_count, 3U );
+
+    /* Erased-flash padding after the last record is ignored */
+    std::vector<uint8_t> padded = log;
+    padded.resize( padded.size() + 32U, 0xFF );
+    EXPECT_TRUE(
+        HW_CAN_Replay_Validate( padded.data(), static_cast<uint32_t>( padded.size() ), nullptr ) );
+
+    auto rejects = [&]( size_t index, uint8_t value ) {
+        std::vector<uint8_t> bad = log;
+        bad[index]               = value;
+        return !HW_CAN_Replay_Validate( bad.data(), static_cast<uint32_t>( bad.size() ), nullptr );
+    };
+    EXPECT_TRUE( rejects( 0U, 'X' ) );           /* magic */
+    EXPECT_TRUE( rejects( 4U, 2U ) );            /* version */
+    EXPECT_TRUE( rejects( 6U, 1U ) );            /* reserved header byte */
+    EXPECT_TRUE( rejects( 8U, 0U ) );            /* zero frames */
+    EXPECT_TRUE( rejects( 8U, 4U ) );            /* more frames than records */
+    EXPECT_TRUE( rejects( 14U, 0x00U ) );        /* deltas exceed pass_us */
+    EXPECT_TRUE( rejects( 16U, 0x09U ) );        /* DLC above eight */
+    EXPECT_TRUE( rejects( 16U, 0x42U ) );        /* reserved tag bit */
+    EXPECT_TRUE( rejects( 19U, 0x08U ) );        /* standard identifier 0x800 */
+    EXPECT_FALSE( HW_CAN_Replay_Validate( log.data(), static_cast<uint32_t>( log.size() - 1U ),
+                                          nullptr ) );
+    EXPECT_FALSE( HW_CAN_Replay_Validate( nullptr, 0U, nullptr ) );
+}
+
+/** Verify due times across time scaling and looped passes, and the end of the last pass. */
+TEST_F( HWCANTest, ReplayScalesGapsAndLoopsPasses )
+{
+    std::vector<uint8_t> log    = ReplayTestLog();
+    uint32_t             length = static_cast<uint32_t>( log.size() );
+    EXPECT_FALSE( HW_CAN_Replay_Load( &test_replay, log.data(), length, 0U, 1U, 0U ) );
+    EXPECT_FALSE( HW_CAN_Replay_Load( &test_replay, log.data(), length,
+                                      HW_CAN_REPLAY_TIME_SCALE_MAX + 1U, 1U, 0U ) );
+
+    /* Half speed, two passes, started just before the time base wraps */
+    uint32_t start = 0xFFFFFF00U;
+    ASSERT_TRUE( HW_CAN_Replay_Load( &test_replay, log.data(), length, 2000U, 2U, start ) );
+
+    const uint32_t expected_due[] = { 0U, 600U, 140600U, 200000U, 200600U, 340600U };
+    const uint32_t expected_id[]  = { 0x100, 0x18DAF110, 0x200, 0x100, 0x18DAF110, 0x200 };
+    for ( size_t i = 0U; i < 6U; i++ )
+    {
+        uint32_t due = start + expected_due[i];
+        EXPECT_FALSE( HW_CAN_Replay_Due( &test_replay, due - 1U ) ) << i;
+        ASSERT_TRUE( HW_CAN_Replay_Due( &test_replay, due ) ) << i;
+
+        const HW_CAN_Replay_Frame_T* frame = HW_CAN_Replay_Take( &test_replay );
+        ASSERT_NE( frame, nullptr );
+        EXPECT_EQ( frame->id, expected_id[i] );
+        EXPECT_EQ( frame->due_us, due );
+        EXPECT_EQ( HW_CAN_Replay_Take( &test_replay ), nullptr ) << "one frame in flight at a time";
+        HW_CAN_Replay_Complete( &test_replay, due, true );
+    }
+
+    EXPECT_TRUE( HW_CAN_Replay_Finished( &test_replay ) );
+    EXPECT_EQ( test_replay.stats.passes, 2U );
+    EXPECT_EQ( test_replay.stats.sent, 6U );
+    EXPECT_TRUE( test_replay.stats.complete );
+    EXPECT_EQ( test_replay.current.dlc, 0U );
+}
+
+/** Verify signed schedule error, failed frames and one starvation count per frame. */
+TEST_F( HWCANTest, ReplayRecordsScheduleErrorAndStarvation )
+{
+    std::vector<uint8_t> log = ReplayTestLog();
+    ASSERT_TRUE( HW_CAN_Replay_Load( &test_replay, log.data(), static_cast<uint32_t>( log.size() ),
+                                     HW_CAN_REPLAY_TIME_SCALE_UNITY, 0U, 1000U ) );
+
+    ASSERT_NE( HW_CAN_Replay_Take( &test_replay ), nullptr );
+    HW_CAN_Replay_Starved( &test_replay );
+    HW_CAN_Replay_Starved( &test_replay );
+    HW_CAN_Replay_Complete( &test_replay, 1040U, true );
+
+    ASSERT_NE( HW_CAN_Replay_Take( &test_replay ), nullptr );
+    HW_CAN_Replay_Complete( &test_replay, 1290U, true );
+
+    ASSERT_NE( HW_CAN_Replay_Take( &test_replay ), nullptr );
+    HW_CAN_Replay_Complete( &test_replay, 90000U, false );
+
+    const HW_CAN_Replay_Stats_T& stats = test_replay.stats;
+    EXPECT_EQ( stats.sent, 2U );
+    EXPECT_EQ( stats.failed, 1U );
+    EXPECT_EQ( stats.starved, 1U );
+    EXPECT_EQ( stats.min_error_us, -10 );
+    EXPECT_EQ( stats.max_error_us, 40 );
+    EXPECT_EQ( stats.last_error_us, -10 );
+    EXPECT_EQ( stats.total_error_us, 30 );
+
+    /* Looping until stopped: the fourth frame is the first of pass two */
+    EXPECT_EQ( stats.passes, 1U );
+    EXPECT_FALSE( stats.complete );
+    ASSERT_TRUE( test_replay.has_next );
+    EXPECT_EQ( test_replay.next.due_us, 101000U );
+}
+
+/** Verify that the timer paces frames into mailbox 2 and each gap re-arms it. */
+TEST_F( HWCANTest, ReplayTimerLoadsMailboxTwoAtDueTime )
+{
+    std::vector<uint8_t> log = ReplayTestLog();
+    mock_can1_regs.TSR       = CAN_TSR_TME;
+    mock_time_us             = 5000U;
+    ASSERT_EQ( HW_CAN_Replay_Start1( log.data(), static_cast<uint32_t>( log.size() ),
+                                     HW_CAN_REPLAY_TIME_SCALE_UNITY, 1U ),
+               HW_CAN_RESULT_OK );
+
+    /* Start only kicks the timer; the interrupt loads the first frame */
+    EXPECT_EQ( mock_replay_timer_start_count, 1U );
+    EXPECT_EQ( mock_replay_timer_arr, HW_CAN_REPLAY_TIMER_MIN_US - 1U );
+    EXPECT_NE( mock_can1_regs.IER & CAN_IER_TMEIE, 0U );
+    EXPECT_EQ( mock_can1_regs.sTxMailBox[2].TIR, 0U );
+
+    mock_time_us = 5002U;
+    HW_CAN_Replay_Tick_From_ISR();
+    EXPECT_EQ( mock_can1_regs.sTxMailBox[2].TIR,
+               ( static_cast<uint32_t>( 0x100 ) << 21 ) | CAN_TI0R_TXRQ );
+    EXPECT_EQ( mock_can1_regs.sTxMailBox[2].TDLR, 0x2211U );
+    EXPECT_EQ( mock_replay_timer_arr, 298U - 1U );
+
+    mock_time_us = 5060U;
+    CompleteMailbox1( 2U );
+
+    mock_time_us = 5300U;
+    HW_CAN_Replay_Tick_From_ISR();
+    EXPECT_EQ( mock_can1_regs.sTxMailBox[2].TIR,
+               ( static_cast<uint32_t>( 0x18DAF110 ) << 3 ) | CAN_TI0R_IDE | CAN_TI0R_TXRQ );
+
+    /* A 70 ms gap is longer than one 16-bit shot, so the completion arms the longest one */
+    mock_time_us = 5310U;
+    CompleteMailbox1( 2U );
+    EXPECT_EQ( mock_replay_timer_arr, HW_CAN_REPLAY_TIMER_MAX_US - 1U );
+    mock_time_us += HW_CAN_REPLAY_TIMER_MAX_US;
+    HW_CAN_Replay_Tick_From_ISR();
+    EXPECT_EQ( mock_can1_regs.TSR & CAN_TSR_TME2, CAN_TSR_TME2 );
+    EXPECT_EQ( mock_replay_timer_arr, 75300U - mock_time_us - 1U );
+
+    mock_time_us = 75300U;
+    HW_CAN_Replay_Tick_From_ISR();
+    EXPECT_EQ( mock_can1_regs.sTxMailBox[2].TIR,
+               ( static_cast<uint32_t>( 0x200 ) << 21 ) | CAN_TI0R_TXRQ );
+    EXPECT_EQ( mock_replay_timer_stop_count, 1U );
+
+    mock_time_us = 75305U;
+    CompleteMailbox1( 2U );
+
+    HW_CAN_Replay_Stats_T stats{};
+    ASSERT_EQ( HW_CAN_Replay_Get_Stats1( &stats ), HW_CAN_RESULT_OK );
+    EXPECT_EQ( stats.sent, 3U );
+    EXPECT_EQ( stats.min_error_us, 5 );
+    EXPECT_EQ( stats.max_error_us, 60 );
+    EXPECT_EQ( stats.passes, 1U );
+    EXPECT_TRUE( stats.complete );
+    EXPECT_EQ( stats.starved, 0U );
+    EXPECT_EQ( HW_CAN_Replay_Get_Stats1( nullptr ), HW_CAN_RESULT_ERROR );
+
+    /* The finished replay hands mailbox 2 and the TX interrupt back */
+    EXPECT_FALSE( can_replay1.running );
+    EXPECT_FALSE( can_replay1.mailbox_reserved );
+    EXPECT_EQ( mock_can1_regs.IER & CAN_IER_TMEIE, 0U );
+}
+
+/** Verify that reading replay statistics masks both the TX vector and the replay timer vector. */
+TEST_F( HWCANTest, ReplayGetStatsMasksTxAndTimerVectors )
+{
+    std::vector<uint8_t> log = ReplayTestLog();
+    ASSERT_EQ( HW_CAN_Replay_Start1( log.data(), static_cast<uint32_t>( log.size() ),
+                                     HW_CAN_REPLAY_TIME_SCALE_UNITY, 1U ),
+               HW_CAN_RESULT_OK );
+    memset( nvic_disable_count, 0, sizeof( nvic_disable_count ) );
+    nvic_irq_enabled[TIM1_CC_IRQn] = true;
+
+    HW_CAN_Replay_Stats_T stats{};
+    ASSERT_EQ( HW_CAN_Replay_Get_Stats1( &stats ), HW_CAN_RESULT_OK );
+
+    EXPECT_EQ( nvic_disable_count[CAN1_TX_IRQn], 1U );
+    EXPECT_EQ( nvic_disable_count[TIM1_CC_IRQn], 1U );
+    EXPECT_TRUE( nvic_irq_enabled[CAN1_TX_IRQn] );
+    EXPECT_TRUE( nvic_irq_enabled[TIM1_CC_IRQn] );
+}
+
+/** Verify that a frame due while mailbox 2 is busy is counted and sent on its completion. */
+TEST_F( HWCANTest, ReplayStarvedFrameLoadsOnCompletion )
+{
+    std::vector<uint8_t> log = ReplayLogHeader( 2U, 1000U );
+    AppendReplayRecord( log, 0U, 0x100, false, { 0x01 } );
+    AppendReplayRecord( log, 50U, 0x101, false, { 0x02 } );
+    mock_can1_regs.TSR = CAN_TSR_TME;
+    ASSERT_EQ( HW_CAN_Replay_Start1( log.data(), static_cast<uint32_t>( log.size() ),
+                                     HW_CAN_REPLAY_TIME_SCALE_UNITY, 1U ),
+               HW_CAN_RESULT_OK );
+
+    HW_CAN_Replay_Tick_From_ISR();
+    mock_time_us = 50U;
+    HW_CAN_Replay_Tick_From_ISR();
+    EXPECT_EQ( mock_can1_regs.sTxMailBox[2].TIR,
+               ( static_cast<uint32_t>( 0x100 ) << 21 ) | CAN_TI0R_TXRQ );
+
+    /* Nothing left for the timer while the due frame waits on the mailbox */
+    EXPECT_EQ( mock_replay_timer_stop_count, 1U );
+
+    mock_time_us = 120U;
+    CompleteMailbox1( 2U );
+    EXPECT_EQ( mock_can1_regs.sTxMailBox[2].TIR,
+               ( static_cast<uint32_t>( 0x101 ) << 21 ) | CAN_TI0R_TXRQ );
+    mock_time_us = 230U;
+    CompleteMailbox1( 2U );
+
+    HW_CAN_Replay_Stats_T stats{};
+    ASSERT_EQ( HW_CAN_Replay_Get_Stats1( &stats ), HW_CAN_RESULT_OK );
+    EXPECT_EQ( stats.starved, 1U );
+    EXPECT_EQ( stats.max_error_us, 180 );
+}
+
+/** Verify that replay and cyclic schedules exclude each other and batches avoid mailbox 2. */
+TEST_F( HWCANTest, ReplaySharesMailboxTwoWithCyclicSchedule )
+{
+    std::vector<uint8_t>        log     = ReplayTestLog();
+    uint32_t                    length  = static_cast<uint32_t>( log.size() );
+    const HW_CAN_Cyclic_Entry_T table[] = {
+        { .id = 0x321, .payload = nullptr, .period_ms = 10, .phase_ms = 0 },
+    };
+    mock_can1_regs.TSR = CAN_TSR_TME;
+
+    ASSERT_EQ( HW_CAN_Cyclic_Start1( table, 1U ), HW_CAN_RESULT_OK );
+    EXPECT_EQ( HW_CAN_Replay_Start1( log.data(), length, 1000U, 1U ), HW_CAN_RESULT_BUSY );
+    HW_CAN_Cyclic_Stop1();
+
+    ASSERT_EQ( HW_CAN_Replay_Start1( log.data(), length, 1000U, 0U ), HW_CAN_RESULT_OK );
+    EXPECT_EQ( HW_CAN_Cyclic_Start1( table, 1U ), HW_CAN_RESULT_BUSY );
+    EXPECT_EQ( HW_CAN_Replay_Start1( log.data(), length, 1000U, 0U ), HW_CAN_RESULT_BUSY );
+
+    uint8_t data[1] = { 0xAA };
+    EXPECT_EQ( HW_CAN_Transmit1( data, 0x10, false, 1U ), HW_CAN_RESULT_OK );
+    EXPECT_EQ( HW_CAN_Transmit1( data, 0x11, false, 1U ), HW_CAN_RESULT_OK );
+    EXPECT_EQ( HW_CAN_Transmit1( data, 0x12, false, 1U ), HW_CAN_RESULT_BUSY );
+
+    /* Stopping with a frame in flight keeps mailbox 2 until it completes */
+    HW_CAN_Replay_Tick_From_ISR();
+    HW_CAN_Replay_Stop1();
+    EXPECT_TRUE( can_replay1.mailbox_reserved );
+    HW_CAN_Replay_Tick_From_ISR();
+    EXPECT_EQ( can_replay1.replay.stats.starved, 0U );
+    CompleteMailbox1( 2U );
+    EXPECT_FALSE( can_replay1.mailbox_reserved );
+    EXPECT_EQ( HW_CAN_Replay_Start2( log.data(), length, 0U, 1U ), HW_CAN_RESULT_ERROR );
+    EXPECT_FALSE( can_replay2.mailbox_reserved );
+}
+
+/** Verify that a reset empties a running replay and stops its timer. */
+TEST_F( HWCANTest, ReplayResetStopsReplay )
+{
+    std::vector<uint8_t> log = ReplayTestLog();
+    mock_can1_regs.TSR       = CAN_TSR_TME;
+    ASSERT_EQ( HW_CAN_Replay_Start1( log.data(), static_cast<uint32_t>( log.size() ), 1000U, 0U ),
+               HW_CAN_RESULT_OK );
+
+    HW_CAN_Reset1();
+
+    EXPECT_FALSE( can_replay1.running );
+    EXPECT_FALSE( can_replay1.mailbox_reserved );
+    EXPECT_EQ( can_replay1.replay.log, nullptr );
+    EXPECT_EQ( mock_replay_timer_stop_count, 1U );
+}
+
+/**-----------------------------------------------------------------------------
+ *  Timestamp Tests
+ *------------------------------------------------------------------------------
+ */
+
+/** Verify the shortest frame lengths and the fallback before a bit rate is set. */
+TEST_F( HWCANTest, TimeFrameBitsAndUnconfiguredFallback )
+{
+    EXPECT_EQ( HW_CAN_Time_Frame_Bits( false, 0U ), 43U );
+    EXPECT_EQ( HW_CAN_Time_Frame_Bits( false, 8U ), 107U );
+    EXPECT_EQ( HW_CAN_Time_Frame_Bits( true, 8U ), 127U );
+
+    HW_CAN_Time_Base_T base;
+    HW_CAN_Time_Reset( &base, 0U );
+    EXPECT_EQ( HW_CAN_Time_Extend( &base, 1234U, 107U, 5000U ), 5000U );
+    EXPECT_FALSE( base.synced );
+}
+
+/**
+ * Verify that the anchor keeps the tightest completion bound and that stamps
+ * are extended across the 16-bit counter wrap. The counter runs at 500 kbit/s
+ * and reads t / 2 at time t; every frame is a standard frame with eight bytes.
+ */
+TEST_F( HWCANTest, TimeExtendTracksTightestBoundAcrossCounterWrap )
+{
+    HW_CAN_Time_Base_T base;
+    HW_CAN_Time_Reset( &base, 500000U );
+
+    /* Serviced 40 us late; the first frame anchors with that latency */
+    EXPECT_EQ( HW_CAN_Time_Extend( &base, 5000U, 107U, 10000U + 214U + 40U ), 10040U );
+
+    /* Serviced as it completes; its tighter bound replaces the anchor */
+    EXPECT_EQ( HW_CAN_Time_Extend( &base, 10000U, 107U, 20000U + 214U ), 20000U );
+    EXPECT_EQ( base.anchor_us, 20214U );
+
+    /* After the counter wraps at 131072 us, a late frame keeps the anchor */
+    EXPECT_EQ( HW_CAN_Time_Extend( &base, ( uint16_t )( 70000U ), 107U, 140000U + 214U + 100U ),
+               140000U );
+    EXPECT_EQ( base.anchor_us, 20214U );
+}
+
+/** Verify that configuring a channel enables time-triggered mode at the channel bit rate. */
+TEST_F( HWCANTest, ConfigureEnablesTimeTriggeredMode )
+{
+    EXPECT_CALL( mock, CANInit( &hcan1 ) ).WillOnce( Return( HAL_OK ) );
+    EXPECT_CALL( mock, CANConfigFilter( &hcan1, _ ) ).WillOnce( Return( HAL_OK ) );
+    EXPECT_CALL( mock, CANStart( &hcan1 ) ).WillOnce( Return( HAL_OK ) );
+
+    ASSERT_EQ( HW_CAN_Configure1( 500000, 0, 0x123, 0x7FF, false ), 0 );
+
+    EXPECT_EQ( hcan1.Init.TimeTriggeredMode, ENABLE );
+    EXPECT_EQ( can_time1.base.bitrate, 500000U );
+    EXPECT_FALSE( can_time1.base.synced );
+}
+
+/** Verify that received frames carry their start of frame on the shared time base. */
+TEST_F( HWCANTest, RxIRQStampsStartOfFrame )
+{
+    HW_CAN_Time_Reset( &can_time1.base, 1000000U );
+
+    mock_can1_regs.RF0R                 = 1U;
+    mock_can1_regs.sFIFOMailBox[0].RIR  = static_cast<uint32_t>( 0x123 ) << 21;
+    mock_can1_regs.sFIFOMailBox[0].RDTR = ( 5000U << CAN_RDT0R_TIME_Pos ) | 8U;
+    mock_time_us                        = 20000U;
+    CAN1_RX0_IRQHandler();
+
+    /* 1000 bit times later on the counter, serviced 3 us after it completes */
+    mock_can1_regs.RF0R                 = 1U;
+    mock_can1_regs.sFIFOMailBox[0].RDTR = ( 6000U << CAN_RDT0R_TIME_Pos ) | 8U;
+    mock_time_us                        = 20893U + 107U + 3U;
+    CAN1_RX0_IRQHandler();
+
+    CAN_Packet_T out[2] = {};
+    ASSERT_EQ( HW_CAN_Rx_Buffer_Read1( out, 2U ), 2U );
+    EXPECT_EQ( out[0].timestamp_us, 20000U - 107U );
+    EXPECT_EQ( out[1].timestamp_us, 20893U );
+}
+
+/** Verify that an acknowledged batch frame reports its start of frame until reset. */
+TEST_F( HWCANTest, TxBatchCompletionReportsStartOfFrame )
+{
+    HW_CAN_Time_Reset( &can_time1.base, 500000U );
+    mock_can1_regs.TSR     = CAN_TSR_TME0;
+    CAN_Packet_T packet[1] = { { .id = 0x321, .dlc = 8, .data = { 1 } } };
+    uint32_t     timestamp = 0U;
+
+    EXPECT_FALSE( HW_CAN_Tx_Timestamp1( &timestamp ) );
+    ASSERT_EQ( HW_CAN_Tx_Buffer_Write1( packet, 1 ), 0 );
+    ASSERT_EQ( HW_CAN_Tx_Trigger1(), HW_CAN_RESULT_OK );
+
+    mock_can1_regs.sTxMailBox[0].TDTR |= 1000U << CAN_TDT0R_TIME_Pos;
+    mock_time_us = 5000U;
+    CompleteMailbox1( 0U );
+
+    ASSERT_TRUE( HW_CAN_Tx_Timestamp1( &timestamp ) );
+    EXPECT_EQ( timestamp, 5000U - 107U * 2U );
+    EXPECT_FALSE( HW_CAN_Tx_Timestamp1( nullptr ) );
+    EXPECT_FALSE( HW_CAN_Tx_Timestamp2( &timestamp ) );
+
+    HW_CAN_Reset1();
+    EXPECT_FALSE( HW_CAN_Tx_Timestamp1( &timestamp ) );
+}
+
+/**-----------------------------------------------------------------------------
+ *  Bus Statistics Tests
+ *------------------------------------------------------------------------------
+ */
+
+/** Complete the request in one channel 1 mailbox with the given TSR flags. */
+static void CompleteMailboxWithFlags1( uint8_t mailbox, uint32_t id, bool extended,
+                                       uint32_t flags )
+{
+    mock_can1_regs.sTxMailBox[mailbox].TIR =
+        extended ? ( id << 3 ) | CAN_TI0R_IDE : id << 21;
+    mock_can1_regs.sTxMailBox[mailbox].TDTR = 8U;
+    mock_can1_regs.TSR |= flags;
+    CAN1_TX_IRQHandler();
+}
+
+/** Verify the nominal frame lengths and the worst-case stuff bit counts. */
+TEST_F( HWCANTest, BusStatsFrameAndStuffBits )
+{
+    EXPECT_EQ( HW_CAN_Stats_Frame_Bits( false, 0U ), 47U );
+    EXPECT_EQ( HW_CAN_Stats_Frame_Bits( false, 8U ), 111U );
+    EXPECT_EQ( HW_CAN_Stats_Frame_Bits( true, 8U ), 131U );
+    EXPECT_EQ( HW_CAN_Stats_Frame_Bits( false, 15U ), 111U );
+
+    EXPECT_EQ( HW_CAN_Stats_Stuff_Bits( false, 0U ), 8U );
+    EXPECT_EQ( HW_CAN_Stats_Stuff_Bits( false, 8U ), 24U );
+    EXPECT_EQ( HW_CAN_Stats_Stuff_Bits( true, 8U ), 29U );
+}
+
+/** Verify that configuring a channel starts its statistics at the channel bit rate. */
+TEST_F( HWCANTest, ConfigureResetsBusStatsAtBitrate )
+{
+    EXPECT_CALL( mock, CANInit( &hcan1 ) ).WillOnce( Return( HAL_OK ) );
+    EXPECT_CALL( mock, CANConfigFilter( &hcan1, _ ) ).WillOnce( Return( HAL_OK ) );
+    EXPECT_CALL( mock, CANStart( &hcan1 ) ).WillOnce( Return( HAL_OK ) );
+    can_stats1.stats.rx_frames = 5U;
+    mock_time_us               = 700U;
+
+    ASSERT_EQ( HW_CAN_Configure1( 250000, 0, 0x123, 0x7FF, false ), 0 );
+
+    EXPECT_EQ( can_stats1.bitrate, 250000U );
+    EXPECT_EQ( can_stats1.window_start_us, 700U );
+    EXPECT_EQ( can_stats1.stats.rx_frames, 0U );
+}
+
+/**
+ * Verify frame, bit and load rates over one window of mixed traffic. 21
+ * standard frames with eight bytes are 2331 bits, or 2835 with worst-case
+ * stuffing, against a 125 kbit/s bus.
+ */
+TEST_F( HWCANTest, BusStatsRatesAndLoadOverWindow )
+{
+    HW_CAN_Stats_Reset( &can_stats1, 125000U, 0U );
+    const uint8_t data[8] = { 1, 2, 3, 4, 5, 6, 7, 8 };
+    CAN_Packet_T  out[1]  = {};
+
+    mock_time_us = 1000U;
+    for ( uint8_t i = 0U; i < 20U; i++ )
+    {
+        ReceiveFrame1( 0x100U + i, data, 8U );
+        ASSERT_EQ( HW_CAN_Rx_Buffer_Read1( out, 1U ), 1U );
+        HW_CAN_Rx_Buffer_consume1( 1U );
+    }
+    CompleteMailboxWithFlags1( 1U, 0x321U, false, CAN_TSR_RQCP1 | CAN_TSR_TXOK1 | CAN_TSR_TME1 );
+
+    HW_CAN_Bus_Stats_T stats = {};
+    mock_time_us             = 999999U;
+    ASSERT_EQ( HW_CAN_Bus_Get_Stats1( &stats ), HW_CAN_RESULT_OK );
+    EXPECT_EQ( stats.rx_frames, 20U );
+    EXPECT_EQ( stats.tx_frames, 1U );
+    EXPECT_EQ( stats.bits, 2331U );
+    EXPECT_EQ( stats.stuff_bits, 504U );
+    EXPECT_EQ( stats.frames_per_s, 0U );
+
+    mock_time_us = 1000000U;
+    ASSERT_EQ( HW_CAN_Bus_Get_Stats1( &stats ), HW_CAN_RESULT_OK );
+    EXPECT_EQ( stats.window_us, 1000000U );
+    EXPECT_EQ( stats.frames_per_s, 21U );
+    EXPECT_EQ( stats.bits_per_s, 2331U );
+    EXPECT_EQ( stats.bus_load_permille, 18U );
+    EXPECT_EQ( stats.bus_load_max_permille, 22U );
+    EXPECT_EQ( stats.peak_load_permille, 22U );
+
+    /* A quiet window that runs long is averaged over its length; the peak stays */
+    mock_time_us = 3000000U;
+    ASSERT_EQ( HW_CAN_Bus_Get_Stats1( &stats ), HW_CAN_RESULT_OK );
+    EXPECT_EQ( stats.window_us, 2000000U );
+    EXPECT_EQ( stats.bits_per_s, 0U );
+    EXPECT_EQ( stats.bus_load_max_permille, 0U );
+    EXPECT_EQ( stats.peak_load_permille, 22U );
+    EXPECT_EQ( HW_CAN_Bus_Get_Stats1( nullptr ), HW_CAN_RESULT_ERROR );
+}
+
+/** Verify that lost arbitrations are counted per identifier and transmit errors in total. */
+TEST_F( HWCANTest, BusStatsCountsArbitrationLossPerId )
+{
+    CompleteMailboxWithFlags1( 0U, 0x123U, false, CAN_TSR_RQCP0 | CAN_TSR_ALST0 );
+    CompleteMailboxWithFlags1( 0U, 0x123U, false, CAN_TSR_RQCP0 | CAN_TSR_ALST0 );
+    CompleteMailboxWithFlags1( 1U, 0x123U, true, CAN_TSR_RQCP1 | CAN_TSR_ALST1 );
+    CompleteMailboxWithFlags1( 2U, 0x456U, false, CAN_TSR_RQCP2 | CAN_TSR_TERR2 );
+    for ( uint32_t id = 0x600U; id < 0x600U + HW_CAN_STATS_MAX_ARBITRATION_IDS; id++ )
+    {
+        CompleteMailboxWithFlags1( 0U, id, false, CAN_TSR_RQCP0 | CAN_TSR_ALST0 );
+    }
+
+    HW_CAN_Bus_Stats_T stats = {};
+    ASSERT_EQ( HW_CAN_Bus_Get_Stats1( &stats ), HW_CAN_RESULT_OK );
+    EXPECT_EQ( stats.tx_frames, 0U );
+    EXPECT_EQ( stats.tx_errors, 1U );
+    EXPECT_EQ( stats.arbitration_lost, 3U + HW_CAN_STATS_MAX_ARBITRATION_IDS );
+    ASSERT_EQ( stats.arbitration_id_count, HW_CAN_STATS_MAX_ARBITRATION_IDS );
+    EXPECT_EQ( stats.arbitration_ids[0].id, 0x123U );
+    EXPECT_FALSE( stats.arbitration_ids[0].extended );
+    EXPECT_EQ( stats.arbitration_ids[0].count, 2U );
+    EXPECT_EQ( stats.arbitration_ids[1].id, 0x123U );
+    EXPECT_TRUE( stats.arbitration_ids[1].extended );
+    EXPECT_EQ( stats.arbitration_ids[1].count, 1U );
+    EXPECT_EQ( stats.arbitration_untracked, 2U );
+    EXPECT_EQ( HW_CAN_Tx_Status1(), HW_CAN_TX_STATUS_IDLE );
+
+    HW_CAN_Stats_Error_State_T state = {};
+    HW_CAN_Stats_T             scratch;
+    HW_CAN_Stats_Reset( &scratch, 0U, 0U );
+    HW_CAN_Stats_Tx( &scratch, 0x7FFU, false, 8U, false, false, false, 0U );
+    HW_CAN_Stats_Snapshot( &scratch, &state, 0U, &stats );
+    EXPECT_EQ( stats.tx_frames + stats.arbitration_lost + stats.tx_errors, 0U );
+}
+
+/** Verify error counter snapshots, bus error counts and bus-off recovery times. */
+TEST_F( HWCANTest, BusStatsRecordsErrorCountersAndBusOffRecovery )
+{
+    HW_CAN_Bus_Stats_T stats = {};
+
+    mock_time_us       = 1000U;
+    mock_can1_regs.MSR = CAN_MSR_ERRI;
+    mock_can1_regs.ESR = ( 130U << CAN_ESR_TEC_Pos ) | ( 7U << CAN_ESR_REC_Pos ) | CAN_ESR_EWGF
+                         | CAN_ESR_EPVF | CAN_ESR_LEC_0 | CAN_ESR_LEC_1;
+    CAN1_SCE_IRQHandler();
+    ASSERT_EQ( HW_CAN_Bus_Get_Stats1( &stats ), HW_CAN_RESULT_OK );
+    EXPECT_EQ( stats.bus_errors, 1U );
+    EXPECT_EQ( stats.last_error_code, 3U );
+    EXPECT_EQ( stats.tec, 130U );
+    EXPECT_EQ( stats.rec, 7U );
+    EXPECT_TRUE( stats.error_warning );
+    EXPECT_TRUE( stats.error_passive );
+
+    /* Bus-off, reported twice, counts once and stays open until the bus is back */
+    mock_time_us       = 2000U;
+    mock_can1_regs.MSR = CAN_MSR_ERRI;
+    mock_can1_regs.ESR = ( 255U << CAN_ESR_TEC_Pos ) | CAN_ESR_BOFF;
+    CAN1_SCE_IRQHandler();
+    mock_time_us       = 2500U;
+    mock_can1_regs.MSR = CAN_MSR_ERRI;
+    CAN1_SCE_IRQHandler();
+    ASSERT_EQ( HW_CAN_Bus_Get_Stats1( &stats ), HW_CAN_RESULT_OK );
+    EXPECT_EQ( stats.bus_off_count, 1U );
+    EXPECT_TRUE( stats.bus_off );
+    EXPECT_EQ( stats.bus_errors, 1U );
+    EXPECT_EQ( stats.last_recovery_us, 0U );
+
+    /* A snapshot that finds the controller back on the bus ends the bus-off */
+    mock_time_us       = 52000U;
+    mock_can1_regs.ESR = 0U;
+    ASSERT_EQ( HW_CAN_Bus_Get_Stats1( &stats ), HW_CAN_RESULT_OK );
+    EXPECT_FALSE( stats.bus_off );
+    EXPECT_EQ( stats.tec, 0U );
+    EXPECT_EQ( stats.peak_tec, 255U );
+    EXPECT_EQ( stats.peak_rec, 7U );
+    EXPECT_EQ( stats.last_recovery_us, 50000U );
+
+    /* So does the first frame received after it */
+    mock_time_us       = 100000U;
+    mock_can1_regs.MSR = CAN_MSR_ERRI;
+    mock_can1_regs.ESR = CAN_ESR_BOFF;
+    CAN1_SCE_IRQHandler();
+    mock_time_us          = 100300U;
+    const uint8_t data[1] = { 0x55 };
+    ReceiveFrame1( 0x10U, data, 1U );
+    ASSERT_EQ( HW_CAN_Bus_Get_Stats1( &stats ), HW_CAN_RESULT_OK );
+    EXPECT_EQ( stats.bus_off_count, 2U );
+    EXPECT_EQ( stats.last_recovery_us, 300U );
+    EXPECT_EQ( stats.max_recovery_us, 50000U );
+}
+
+/** Verify that dropped frames and overruns are counted and that a reset clears only the stats. */
+TEST_F( HWCANTest, BusStatsCountsRxDropsAndResets )
+{
+    HW_CAN_Stats_Reset( &can_stats1, 1000000U, 0U );
+    const uint8_t data[2] = { 0xAA, 0xBB };
+
+    mock_time_us = 10U;
+    for ( uint32_t i = 0U; i < HW_CAN_CH1_RX_QUEUE_CAPACITY + 2U; i++ )
+    {
+        ReceiveFrame1( 0x200U, data, 2U );
+    }
+    mock_can1_regs.RF0R = CAN_RF0R_FOVR0;
+    CAN1_RX0_IRQHandler();
+
+    HW_CAN_Bus_Stats_T stats = {};
+    mock_time_us             = 500010U;
+    ASSERT_EQ( HW_CAN_Bus_Get_Stats1( &stats ), HW_CAN_RESULT_OK );
+    EXPECT_EQ( stats.rx_frames, HW_CAN_CH1_RX_QUEUE_CAPACITY + 2U );
+    EXPECT_EQ( stats.rx_dropped, 3U );
+
+    mock_time_us = 1000000U;
+    ASSERT_EQ( HW_CAN_Bus_Get_Stats1( &stats ), HW_CAN_RESULT_OK );
+    EXPECT_EQ( stats.rx_dropped_per_s, 3U );
+
+    HW_CAN_Bus_Reset_Stats1();
+    ASSERT_EQ( HW_CAN_Bus_Get_Stats1( &stats ), HW_CAN_RESULT_OK );
+    EXPECT_EQ( stats.rx_frames, 0U );
+    EXPECT_EQ( stats.rx_dropped, 0U );
+    EXPECT_EQ( stats.rx_dropped_per_s, 0U );
+    EXPECT_EQ( can_stats1.bitrate, 1000000U );
+    EXPECT_EQ( HW_CAN_Rx_Dropped_Count1(), 3U );
+    EXPECT_TRUE( nvic_irq_enabled[CAN1_SCE_IRQn] );
+}
@@ -30,6 +30,8 @@
 #else
 #include "gpio.h"
 #include "stm32f4xx_ll_gpio.h"
+#include "stm32f4xx_ll_exti.h"
+#include "stm32f4xx_ll_system.h"
 #include "stm32f446xx.h"
 #include "main.h"
 #endif
@@ -63,6 +65,9 @@ typedef struct GPIOConfigurablePin_T
     uint32_t      pin_mask;
     uint32_t      alternate_function;
     bool          has_alternate_function;
+    uint32_t      exti_port;         ///< SYSCFG EXTICR port selection for this pin.
+    uint32_t      exti_line_config;  ///< SYSCFG EXTICR line selection for this pin.
+    uint32_t      exti_line;         ///< EXTI line mask shared by IMR/RTSR/FTSR/PR.
 } GPIOConfigurablePin_T;
 static GPIO_TypeDef* gpio_ports[] = {
     GPIOA, GPIOB, GPIOC, GPIOD, GPIOE, GPIOF, GPIOG, GPIOH,
@@ -114,6 +119,9 @@ static bool HW_GPIO_Get_Configurable_Pin( GPIOPin_T pin, GPIOConfigurablePin_T*
                 .pin_mask               = GPIO_PIN_4,
                 .alternate_function     = GPIO_AF5_SPI1,
                 .has_alternate_function = true,
+                .exti_port              = LL_SYSCFG_EXTI_PORTA,
+                .exti_line_config       = LL_SYSCFG_EXTI_LINE4,
+                .exti_line              = LL_EXTI_LINE_4,
             };
             return true;
         case GPIO_SPI2_NSS:
@@ -122,6 +130,9 @@ static bool HW_GPIO_Get_Configurable_Pin( GPIOPin_T pin, GPIOConfigurablePin_T*
                 .pin_mask               = GPIO_PIN_12,
                 .alternate_function     = GPIO_AF5_SPI2,
                 .has_alternate_function = true,
+                .exti_port              = LL_SYSCFG_EXTI_PORTB,
+                .exti_line_config       = LL_SYSCFG_EXTI_LINE12,
+                .exti_line              = LL_EXTI_LINE_12,
             };
             return true;
         case GPIO_SPI4_NSS:
@@ -130,6 +141,31 @@ static bool HW_GPIO_Get_Configurable_Pin( GPIOPin_T pin, GPIOConfigurablePin_T*
                 .pin_mask               = GPIO_PIN_11,
                 .alternate_function     = GPIO_AF5_SPI4,
                 .has_alternate_function = true,
+                .exti_port              = LL_SYSCFG_EXTI_PORTE,
+                .exti_line_config       = LL_SYSCFG_EXTI_LINE11,
+                .exti_line              = LL_EXTI_LINE_11,
+            };
+            return true;
+        case GPIO_USART6_RX:
+            *configuration = ( GPIOConfigurablePin_T ){
+                .gpiox                  = GPIOC,
+                .pin_mask               = GPIO_PIN_7,
+                .alternate_function     = GPIO_AF8_USART6,
+                .has_alternate_function = true,
+                .exti_port              = LL_SYSCFG_EXTI_PORTC,
+                .exti_line_config       = LL_SYSCFG_EXTI_LINE7,
+                .exti_line              = LL_EXTI_LINE_7,
+            };
+            return true;
+        case GPIO_USART2_RX:
+            *configuration = ( GPIOConfigurablePin_T ){
+                .gpiox                  = GPIOD,
+                .pin_mask               = GPIO_PIN_6,
+                .alternate_function     = GPIO_AF7_USART2,
+                .has_alternate_function = true,
+                .exti_port              = LL_SYSCFG_EXTI_PORTD,
+                .exti_line_config       = LL_SYSCFG_EXTI_LINE6,
+                .exti_line              = LL_EXTI_LINE_6,
             };
             return true;
         case GPIO_PIN_NONE:
@@ -555,6 +591,8 @@ bool HW_GPIO_Is_Valid_Pin( GPIOPin_T pin )
         case GPIO_SPI1_NSS:
         case GPIO_SPI2_NSS:
         case GPIO_SPI4_NSS:
+        case GPIO_USART6_RX:
+        case GPIO_USART2_RX:
             return true;
         case GPIO_PIN_NONE:
         case GPIO_NUM_PINS:
@@ -662,6 +700,84 @@ void HW_GPIO_Reset_Pin( GPIOPin_T pin )
 #endif
 }
 
+bool HW_GPIO_Read_Configurable_Pin( GPIOPin_T pin )
+{
+#ifndef TEST_BUILD
+    GPIOConfigurablePin_T pin_configuration;
+
+    if ( HW_GPIO_Get_Configurable_Pin( pin, &pin_configuration ) == false )
+    {
+        return false;
+    }
+
+    return LL_GPIO_IsInputPinSet( pin_configuration.gpiox, pin_configuration.pin_mask ) != 0U;
+#else
+    ( void )pin;
+    return false;
+#endif
+}
+
+bool HW_GPIO_Configure_Pin_Edge_Interrupt( GPIOPin_T pin, bool enable )
+{
+    if ( HW_GPIO_Is_Valid_Pin( pin ) == false )
+    {
+        return false;
+    }
+
+#ifndef TEST_BUILD
+    GPIOConfigurablePin_T pin_configuration;
+
+    if ( HW_GPIO_Get_Configurable_Pin( pin, &pin_configuration ) == false )
+    {
+        return false;
+    }
+
+    if ( enable == false )
+    {
+        LL_EXTI_DisableIT_0_31( pin_configuration.exti_line );
+        LL_EXTI_DisableRisingTrig_0_31( pin_configuration.exti_line );
+        LL_EXTI_DisableFallingTrig_0_31( pin_configuration.exti_line );
+        LL_EXTI_ClearFlag_0_31( pin_configuration.exti_line );
+        return true;
+    }
+
+    // EXTI samples the input data path, which stays active in alternate-function
+    // mode, so the pin can remain owned by its peripheral while edges are seen.
+    LL_SYSCFG_SetEXTISource( pin_configuration.exti_port, pin_configuration.exti_line_config );
+    LL_EXTI_EnableRisingTrig_0_31( pin_configuration.exti_line );
+    LL_EXTI_EnableFallingTrig_0_31( pin_configuration.exti_line );
+    LL_EXTI_ClearFlag_0_31( pin_configuration.exti_line );
+    LL_EXTI_EnableIT_0_31( pin_configuration.exti_line );
+#else
+    ( void )enable;
+#endif
+
+    return true;
+}
+
+bool HW_GPIO_Clear_Edge_Interrupt( GPIOPin_T pin )
+{
+#ifndef TEST_BUILD
+    GPIOConfigurablePin_T pin_configuration;
+
+    if ( HW_GPIO_Get_Configurable_Pin( pin, &pin_configuration ) == false )
+    {
+        return false;
+    }
+
+    if ( LL_EXTI_IsActiveFlag_0_31( pin_configuration.exti_line ) == 0U )
+    {
+        return false;
+    }
+
+    LL_EXTI_ClearFlag_0_31( pin_configuration.exti_line );
+    return true;
+#else
+    ( void )pin;
+    return false;
+#endif
+}
+
 /**
  * @brief Converts a string to a digital pin name
  *
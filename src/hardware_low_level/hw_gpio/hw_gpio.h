@@ -62,6 +62,8 @@ typedef enum GPIOPin_T
     GPIO_SPI1_NSS,       ///< PA4, SPI1 NSS (AF5 when peripheral-owned).
     GPIO_SPI2_NSS,       ///< PB12, SPI2 NSS (AF5 when peripheral-owned).
     GPIO_SPI4_NSS,       ///< PE11, SPI4 NSS (AF5 when peripheral-owned).
+    GPIO_USART6_RX,      ///< PC7, DUT UART channel 1 RX (AF8 when peripheral-owned).
+    GPIO_USART2_RX,      ///< PD6, DUT UART channel 2 RX (AF7 when peripheral-owned).
 
     GPIO_NUM_PINS
 } GPIOPin_T;
@@ -169,6 +171,25 @@ void HW_GPIO_Set_Pin( GPIOPin_T pin );
 /** @brief Drive a runtime-configurable logical output low. */
 void HW_GPIO_Reset_Pin( GPIOPin_T pin );
 
+/** @brief Read the input level of a runtime-configurable logical pin. */
+bool HW_GPIO_Read_Configurable_Pin( GPIOPin_T pin );
+
+/**
+ * @brief Enable or disable a both-edge EXTI interrupt on a logical pin.
+ *
+ * The pin keeps its current mode, so a peripheral-owned NSS input can still
+ * raise edge interrupts. Routing the EXTI line to the NVIC is left to the
+ * driver that owns the matching EXTIx_IRQHandler.
+ */
+bool HW_GPIO_Configure_Pin_Edge_Interrupt( GPIOPin_T pin, bool enable );
+
+/**
+ * @brief Clear a pending EXTI edge on a logical pin.
+ *
+ * @return true if an edge was pending for this pin and has been cleared.
+ */
+bool HW_GPIO_Clear_Edge_Interrupt( GPIOPin_T pin );
+
 /**-----------------------------------------------------------------------------
  *  Existing digital-I/O API
  *----------------------------------------------------------------------------*/
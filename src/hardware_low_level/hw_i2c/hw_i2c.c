@@ -11,10 +11,11 @@
  *
  *  Notes:
  *      - Requires STM32F4xx HAL/LL driver libraries
- *      - FMPI2C1 operates at 100 kHz with fixed timing register value
- *      - I2C3 interrupt-only; I2C2 supports DMA; FMPI2C1 interrupt-only
+ *      - FMPI2C1 timing is computed for its speed; only FMPI2C1 runs at 1 MHz
+ *      - I2C2 supports DMA; I2C3 and FMPI2C1 support DMA receive only
  *      - Receive storage is 512 bytes; maximum transmit message is 256 bytes
  *      - Queue state is protected against the channel's I2C/DMA interrupts
+ *      - Register-map slaves are served entirely from the event interrupt
  *      - Interrupt handlers must be called from corresponding ISRs in stm32f4xx_it.c
  ******************************************************************************/
 
@@ -35,20 +36,41 @@
 #endif
 
 #include "hw_i2c.h"
+#include "hw_i2c_timing.h"
 #include <stdint.h>
 #include <stdbool.h>
 #include <stddef.h>
 #include <string.h>
 
+/* DMA1 streams 3 to 6 belong to SPI2 and USART2. I2C3_TX and FMPI2C1_TX are only mapped to
+ * taken streams, so those two channels transmit on the interrupt path. */
+#define HW_I2C_CHANNEL_1_DMA_RX_STREAM DMA1_Stream1
 #define HW_I2C_CHANNEL_2_DMA_RX_STREAM DMA1_Stream2
 #define HW_I2C_CHANNEL_2_DMA_TX_STREAM DMA1_Stream7
+#define HW_I2C_FMPI2C1_DMA_RX_STREAM DMA1_Stream0
+
+/* Streams 0 and 1 are not in the CubeMX project, so their vectors are given the I2C event
+ * priority here. A stream TC then never preempts the event handler of its channel. */
+#define HW_I2C_DMA_RX_IRQ_PRIORITY 5U
 
 #define HW_I2C_APB1_HZ 45000000UL
-#define FMPI2C1_TIMINGR 0xC0000E12U
+
+/* FMPI2C1 runs from APB1 and reaches the logic expander over a short on-board bus. */
+#define HW_I2C_FMPI2C1_RISE_NS 100U
+#define HW_I2C_FMPI2C1_FALL_NS 20U
+#define HW_I2C_FMPI2C1_FAST_MODE_PLUS_DRIVE ( SYSCFG_CFGR_FMPI2C1_SCL | SYSCFG_CFGR_FMPI2C1_SDA )
+#define HW_I2C_CHANNEL_1_DMA_RX_TC_FLAG DMA_LISR_TCIF1
+#define HW_I2C_CHANNEL_1_DMA_RX_TE_FLAG DMA_LISR_TEIF1
+#define HW_I2C_FMPI2C1_DMA_RX_TC_FLAG DMA_LISR_TCIF0
+#define HW_I2C_FMPI2C1_DMA_RX_TE_FLAG DMA_LISR_TEIF0
 #define HW_I2C_CHANNEL_2_DMA_RX_TC_FLAG DMA_LISR_TCIF2
 #define HW_I2C_CHANNEL_2_DMA_RX_TE_FLAG DMA_LISR_TEIF2
 #define HW_I2C_CHANNEL_2_DMA_TX_TC_FLAG DMA_HISR_TCIF7
 #define HW_I2C_CHANNEL_2_DMA_TX_TE_FLAG DMA_HISR_TEIF7
+#define HW_I2C_CHANNEL_1_DMA_RX_CLEAR_FLAGS_MASK                                                   \
+    ( DMA_LIFCR_CTCIF1 | DMA_LIFCR_CTEIF1 | DMA_LIFCR_CDMEIF1 | DMA_LIFCR_CFEIF1 )
+#define HW_I2C_FMPI2C1_DMA_RX_CLEAR_FLAGS_MASK                                                     \
+    ( DMA_LIFCR_CTCIF0 | DMA_LIFCR_CTEIF0 | DMA_LIFCR_CDMEIF0 | DMA_LIFCR_CFEIF0 )
 #define HW_I2C_CHANNEL_2_DMA_RX_CLEAR_FLAGS_MASK                                                   \
     ( DMA_LIFCR_CTCIF2 | DMA_LIFCR_CTEIF2 | DMA_LIFCR_CDMEIF2 | DMA_LIFCR_CFEIF2 )
 #define HW_I2C_CHANNEL_2_DMA_TX_CLEAR_FLAGS_MASK                                                   \
@@ -60,8 +82,10 @@
 #define HW_I2C_ER_IRQ_CHANNEL_1 I2C3_ER_IRQHandler
 #define HW_I2C_ER_IRQ_CHANNEL_2 I2C2_ER_IRQHandler
 #define HW_I2C_ER_IRQ_FMPI2C1 FMPI2C1_ER_IRQHandler
+#define HW_I2C_DMA_RX_IRQ_CHANNEL_1 DMA1_Stream1_IRQHandler
 #define HW_I2C_DMA_RX_IRQ_CHANNEL_2 DMA1_Stream2_IRQHandler
 #define HW_I2C_DMA_TX_IRQ_CHANNEL_2 DMA1_Stream7_IRQHandler
+#define HW_I2C_DMA_RX_IRQ_FMPI2C1 DMA1_Stream0_IRQHandler
 
 void HW_I2C_EV_IRQ_CHANNEL_1( void );
 void HW_I2C_EV_IRQ_CHANNEL_2( void );
@@ -69,8 +93,10 @@ void HW_I2C_EV_IRQ_FMPI2C1( void );
 void HW_I2C_ER_IRQ_CHANNEL_1( void );
 void HW_I2C_ER_IRQ_CHANNEL_2( void );
 void HW_I2C_ER_IRQ_FMPI2C1( void );
+void HW_I2C_DMA_RX_IRQ_CHANNEL_1( void );
 void HW_I2C_DMA_RX_IRQ_CHANNEL_2( void );
 void HW_I2C_DMA_TX_IRQ_CHANNEL_2( void );
+void HW_I2C_DMA_RX_IRQ_FMPI2C1( void );
 
 /**-----------------------------------------------------------------------------
  *  Defines / Macros
@@ -86,10 +112,20 @@ typedef struct HWI2CMasterTransaction_T
 {
     HWI2CTransferKind_T transfer_kind;
     uint16_t            target_address_7bit;
-    uint16_t            length;
+    uint16_t            length;    /* TX payload length, or the RX length of a receive */
+    uint16_t            rx_length; /* Read length of a combined write-then-read */
     uint8_t             tx_payload[HW_I2C_TX_MAX_MESSAGE_SIZE];
 } HWI2CMasterTransaction_T;
 
+/* Where a register-map slave is within the current bus transaction. */
+typedef enum HWI2CRegisterMapPhase_T
+{
+    HW_I2C_REGISTER_MAP_IDLE,    /* No transaction addressed to the map */
+    HW_I2C_REGISTER_MAP_POINTER, /* Write addressed; next byte sets the pointer */
+    HW_I2C_REGISTER_MAP_WRITE,   /* Pointer set; further bytes are register writes */
+    HW_I2C_REGISTER_MAP_READ,    /* Read addressed; registers are sent from the pointer */
+} HWI2CRegisterMapPhase_T;
+
 typedef struct HWI2CIrqState_T
 {
     uint32_t event_irq_enabled;
@@ -112,6 +148,12 @@ typedef struct HWI2CChannelState_T
     volatile bool       restart_pending;
     bool                active_uses_dma;
 
+    /* Combined write-then-read: the write phase runs as MASTER_TX and turns into MASTER_RX
+     * at the repeated start. Events before the repeated start's SB are ignored. */
+    bool          write_read_active;
+    uint16_t      write_read_rx_length;
+    volatile bool repeated_start_pending;
+
     /* Complete master transactions. Count includes the active queue head. */
     HWI2CMasterTransaction_T master_queue[HW_I2C_MASTER_TRANSACTION_QUEUE_DEPTH];
     volatile uint8_t         master_queue_head;
@@ -146,6 +188,15 @@ typedef struct HWI2CChannelState_T
     volatile uint8_t           rx_message_tail;
     volatile uint8_t           rx_message_count;
 
+    /* Register-map slave. The pointer wraps at 256 like a one-byte register address. */
+    volatile bool                    register_map_active;
+    uint8_t*                         register_map;
+    uint16_t                         register_map_size;
+    bool                             register_map_writable;
+    volatile HWI2CRegisterMapPhase_T register_map_phase;
+    uint8_t                          register_pointer;
+    uint16_t                         register_bytes_loaded; /* Bytes written to DR this read */
+
     /* Error tracking */
     volatile bool          overflow_occurred;
     volatile HWI2CStatus_T transfer_result;
@@ -172,12 +223,18 @@ typedef struct HWI2CMapping_T
 } HWI2CMapping_T;
 
 static const HWI2CMapping_T HW_I2C_MAP[HW_I2C_CHANNEL_COUNT] = {
-    { .instance = I2C3, .dma_rx = NULL, .dma_tx = NULL, .dma_channel_bits = 0UL },
+    { .instance         = I2C3,
+      .dma_rx           = HW_I2C_CHANNEL_1_DMA_RX_STREAM,
+      .dma_tx           = NULL,
+      .dma_channel_bits = ( 1UL << DMA_SxCR_CHSEL_Pos ) },
     { .instance         = I2C2,
       .dma_rx           = HW_I2C_CHANNEL_2_DMA_RX_STREAM,
       .dma_tx           = HW_I2C_CHANNEL_2_DMA_TX_STREAM,
       .dma_channel_bits = ( 7UL << DMA_SxCR_CHSEL_Pos ) },
-    { .instance = NULL, .dma_rx = NULL, .dma_tx = NULL, .dma_channel_bits = 0UL },
+    { .instance         = NULL,
+      .dma_rx           = HW_I2C_FMPI2C1_DMA_RX_STREAM,
+      .dma_tx           = NULL,
+      .dma_channel_bits = ( 7UL << DMA_SxCR_CHSEL_Pos ) },
 };
 
 /**-----------------------------------------------------------------------------
@@ -200,6 +257,8 @@ static bool HW_I2C_Publish_Received_Message( HWI2CChannelState_T* state );
 static inline uint32_t HWI2CSpeed_To_Hz( HWI2CSpeed_T speed );
 static inline void     HW_I2C_Enable_Clock_For_Channel( HWI2CChannel_T channel );
 static inline void     HW_I2C_Enable_Error_IRQ_For_Channel( HWI2CChannel_T channel );
+static inline void     HW_I2C_Enable_DMA_IRQ_For_Channel( HWI2CChannel_T              channel,
+                                                          const HWI2CChannelConfig_T* config );
 static inline void     HW_I2C_Disable_All_Runtime_Irq_Bits( I2C_TypeDef* i2c_instance );
 static inline void     HW_I2C_Disable_DMA_Request( I2C_TypeDef* i2c_instance );
 static inline void     HW_I2C_Set_Speed_And_Address( I2C_TypeDef* i2c_instance, HWI2CSpeed_T speed,
@@ -213,6 +272,11 @@ static void            HW_I2C_Cleanup_Active_Transfer( HWI2CChannel_T channel );
 static void        HW_I2C_Latch_Transfer_Result( HWI2CChannelState_T* state, HWI2CStatus_T result );
 static void        HW_I2C_Abort_Transfer( HWI2CChannel_T channel, HWI2CStatus_T result );
 static void        HW_I2C_Request_Master_Stop( HWI2CChannel_T channel );
+static void        HW_I2C_Start_Repeated_Read( HWI2CChannel_T channel );
+static void        HW_I2C_Finish_Master_Write( HWI2CChannel_T channel );
+static uint16_t    HW_I2C_Transaction_Rx_Length( const HWI2CMasterTransaction_T* transaction );
+static bool        HW_I2C_Rx_Capacity_Available( const HWI2CChannelState_T* state,
+                                                 uint16_t                   expected_length );
 static bool        HW_I2C_Pump_Master_Queue( HWI2CChannel_T channel );
 static void        HW_I2C_Complete_Master_Queue_Head( HWI2CChannel_T channel );
 static void        HW_I2C_Configure_DMA_Stream( DMA_Stream_TypeDef* stream, uint32_t channel_bits,
@@ -221,9 +285,12 @@ static void        HW_I2C_Configure_DMA_Stream( DMA_Stream_TypeDef* stream, uint
 static inline bool HW_I2C_DMA_Stream_Has_TC( DMA_Stream_TypeDef* stream );
 static inline bool HW_I2C_DMA_Stream_Has_TE( DMA_Stream_TypeDef* stream );
 static inline void HW_I2C_DMA_Stream_Clear_Flags( DMA_Stream_TypeDef* stream );
+static void        HW_I2C_Prepare_FMPI2C1_Receive( HWI2CChannelState_T* state, uint16_t length );
 static inline void HW_I2C_Service_Event_External( HWI2CChannel_T channel,
                                                   I2C_TypeDef*   i2c_instance );
 static bool        HW_I2C_Read_External_Byte( HWI2CChannel_T channel, I2C_TypeDef* i2c_instance );
+static void        HW_I2C_Service_Register_Map( HWI2CChannel_T channel, I2C_TypeDef* i2c_instance,
+                                                uint32_t sr1 );
 static inline void HW_I2C_Service_Event_FMPI2C1( HWI2CChannel_T channel );
 
 /**-----------------------------------------------------------------------------
@@ -260,7 +327,7 @@ static inline bool HW_I2C_Config_Is_Valid( HWI2CChannel_T              channel,
         return false;
     }
 
-    /* Speed must be 100 kHz or 400 kHz */
+    /* I2C3 and I2C2 stop at fast mode; 1 MHz is FMPI2C1 only */
     if ( ( config->speed != HW_I2C_SPEED_100KHZ ) && ( config->speed != HW_I2C_SPEED_400KHZ ) )
     {
         return false;
@@ -286,14 +353,11 @@ static inline bool HW_I2C_Config_Is_Valid( HWI2CChannel_T              channel,
         return false;
     }
 
-    /* I2C3 does not support DMA */
-    if ( channel == HW_I2C_CHANNEL_1 )
+    /* A channel without a transmit stream cannot transmit by DMA */
+    if ( ( config->tx_transfer_path == HW_I2C_TRANSFER_DMA )
+         && ( HW_I2C_MAP[channel].dma_tx == NULL ) )
     {
-        if ( ( config->tx_transfer_path == HW_I2C_TRANSFER_DMA )
-             || ( config->rx_transfer_path == HW_I2C_TRANSFER_DMA ) )
-        {
-            return false;
-        }
+        return false;
     }
 
     return true;
@@ -326,10 +390,12 @@ static HWI2CIrqState_T HW_I2C_Channel_Irqs_Disable( HWI2CChannel_T channel )
     switch ( channel )
     {
         case HW_I2C_CHANNEL_1:
-            irq_state.event_irq_enabled = NVIC_GetEnableIRQ( I2C3_EV_IRQn );
-            irq_state.error_irq_enabled = NVIC_GetEnableIRQ( I2C3_ER_IRQn );
+            irq_state.event_irq_enabled  = NVIC_GetEnableIRQ( I2C3_EV_IRQn );
+            irq_state.error_irq_enabled  = NVIC_GetEnableIRQ( I2C3_ER_IRQn );
+            irq_state.dma_rx_irq_enabled = NVIC_GetEnableIRQ( DMA1_Stream1_IRQn );
             NVIC_DisableIRQ( I2C3_EV_IRQn );
             NVIC_DisableIRQ( I2C3_ER_IRQn );
+            NVIC_DisableIRQ( DMA1_Stream1_IRQn );
             break;
         case HW_I2C_CHANNEL_2:
             irq_state.event_irq_enabled  = NVIC_GetEnableIRQ( I2C2_EV_IRQn );
@@ -342,10 +408,12 @@ static HWI2CIrqState_T HW_I2C_Channel_Irqs_Disable( HWI2CChannel_T channel )
             NVIC_DisableIRQ( DMA1_Stream7_IRQn );
             break;
         case HW_I2C_CHANNEL_FMPI2C1:
-            irq_state.event_irq_enabled = NVIC_GetEnableIRQ( FMPI2C1_EV_IRQn );
-            irq_state.error_irq_enabled = NVIC_GetEnableIRQ( FMPI2C1_ER_IRQn );
+            irq_state.event_irq_enabled  = NVIC_GetEnableIRQ( FMPI2C1_EV_IRQn );
+            irq_state.error_irq_enabled  = NVIC_GetEnableIRQ( FMPI2C1_ER_IRQn );
+            irq_state.dma_rx_irq_enabled = NVIC_GetEnableIRQ( DMA1_Stream0_IRQn );
             NVIC_DisableIRQ( FMPI2C1_EV_IRQn );
             NVIC_DisableIRQ( FMPI2C1_ER_IRQn );
+            NVIC_DisableIRQ( DMA1_Stream0_IRQn );
             break;
         case HW_I2C_CHANNEL_COUNT:
         default:
@@ -368,6 +436,10 @@ static void HW_I2C_Channel_Irqs_Restore( HWI2CChannel_T channel, HWI2CIrqState_T
             {
                 NVIC_EnableIRQ( I2C3_ER_IRQn );
             }
+            if ( irq_state.dma_rx_irq_enabled != 0U )
+            {
+                NVIC_EnableIRQ( DMA1_Stream1_IRQn );
+            }
             break;
         case HW_I2C_CHANNEL_2:
             if ( irq_state.event_irq_enabled != 0U )
@@ -396,6 +468,10 @@ static void HW_I2C_Channel_Irqs_Restore( HWI2CChannel_T channel, HWI2CIrqState_T
             {
                 NVIC_EnableIRQ( FMPI2C1_ER_IRQn );
             }
+            if ( irq_state.dma_rx_irq_enabled != 0U )
+            {
+                NVIC_EnableIRQ( DMA1_Stream0_IRQn );
+            }
             break;
         case HW_I2C_CHANNEL_COUNT:
         default:
@@ -423,7 +499,8 @@ static bool HW_I2C_Publish_Received_Message( HWI2CChannelState_T* state )
     }
 
     HWI2CRxMessageDescriptor_T* descriptor = &state->rx_message_queue[state->rx_message_head];
-    descriptor->transfer_kind              = state->transfer_kind;
+    descriptor->transfer_kind =
+        state->write_read_active ? HW_I2C_TRANSFER_KIND_MASTER_WRITE_READ : state->transfer_kind;
     descriptor->target_address_7bit = ( state->transfer_kind == HW_I2C_TRANSFER_KIND_MASTER_RX )
                                           ? state->target_address_7bit
                                           : 0U;
@@ -441,7 +518,41 @@ static bool HW_I2C_Publish_Received_Message( HWI2CChannelState_T* state )
 
 static inline uint32_t HWI2CSpeed_To_Hz( HWI2CSpeed_T speed )
 {
-    return ( speed == HW_I2C_SPEED_400KHZ ) ? 400000UL : 100000UL;
+    switch ( speed )
+    {
+        case HW_I2C_SPEED_400KHZ:
+            return HW_I2C_TIMING_FAST_MODE_HZ;
+        case HW_I2C_SPEED_1MHZ:
+            return HW_I2C_TIMING_FAST_MODE_PLUS_HZ;
+        case HW_I2C_SPEED_100KHZ:
+        default:
+            return HW_I2C_TIMING_STANDARD_MODE_HZ;
+    }
+}
+
+/* Writes TIMINGR for the speed; FMPI2C1 must be disabled. Fast-mode plus also needs the
+ * stronger pin drive. Returns false, leaving the registers alone, if the board's edge
+ * times do not allow the speed. */
+static bool HW_I2C_FMPI2C1_Set_Timing( HWI2CSpeed_T speed )
+{
+    HW_I2C_Timing_T timing;
+    if ( !HW_I2C_Timing_Compute( HW_I2C_APB1_HZ, HWI2CSpeed_To_Hz( speed ),
+                                 HW_I2C_FMPI2C1_RISE_NS, HW_I2C_FMPI2C1_FALL_NS, &timing ) )
+    {
+        return false;
+    }
+
+    LL_FMPI2C_SetTiming( FMPI2C1, timing.timingr );
+    if ( speed == HW_I2C_SPEED_1MHZ )
+    {
+        SYSCFG->CFGR |= HW_I2C_FMPI2C1_FAST_MODE_PLUS_DRIVE;
+    }
+    else
+    {
+        SYSCFG->CFGR &= ~HW_I2C_FMPI2C1_FAST_MODE_PLUS_DRIVE;
+    }
+
+    return true;
 }
 
 static inline void HW_I2C_Enable_Clock_For_Channel( HWI2CChannel_T channel )
@@ -456,6 +567,7 @@ static inline void HW_I2C_Enable_Clock_For_Channel( HWI2CChannel_T channel )
             break;
         case HW_I2C_CHANNEL_FMPI2C1:
             LL_APB1_GRP1_EnableClock( LL_APB1_GRP1_PERIPH_FMPI2C1 );
+            LL_APB2_GRP1_EnableClock( LL_APB2_GRP1_PERIPH_SYSCFG );
             break;
         case HW_I2C_CHANNEL_COUNT:
         default:
@@ -482,6 +594,41 @@ static inline void HW_I2C_Enable_Error_IRQ_For_Channel( HWI2CChannel_T channel )
     }
 }
 
+static inline void HW_I2C_Enable_DMA_IRQ_For_Channel( HWI2CChannel_T              channel,
+                                                      const HWI2CChannelConfig_T* config )
+{
+    switch ( channel )
+    {
+        case HW_I2C_CHANNEL_1:
+            if ( config->rx_transfer_path == HW_I2C_TRANSFER_DMA )
+            {
+                NVIC_SetPriority( DMA1_Stream1_IRQn, HW_I2C_DMA_RX_IRQ_PRIORITY );
+                NVIC_EnableIRQ( DMA1_Stream1_IRQn );
+            }
+            break;
+        case HW_I2C_CHANNEL_2:
+            if ( config->rx_transfer_path == HW_I2C_TRANSFER_DMA )
+            {
+                NVIC_EnableIRQ( DMA1_Stream2_IRQn );
+            }
+            if ( config->tx_transfer_path == HW_I2C_TRANSFER_DMA )
+            {
+                NVIC_EnableIRQ( DMA1_Stream7_IRQn );
+            }
+            break;
+        case HW_I2C_CHANNEL_FMPI2C1:
+            if ( config->rx_transfer_path == HW_I2C_TRANSFER_DMA )
+            {
+                NVIC_SetPriority( DMA1_Stream0_IRQn, HW_I2C_DMA_RX_IRQ_PRIORITY );
+                NVIC_EnableIRQ( DMA1_Stream0_IRQn );
+            }
+            break;
+        case HW_I2C_CHANNEL_COUNT:
+        default:
+            break;
+    }
+}
+
 static inline void HW_I2C_Disable_All_Runtime_Irq_Bits( I2C_TypeDef* i2c_instance )
 {
     LL_I2C_DisableIT_ERR( i2c_instance );
@@ -608,11 +755,20 @@ static void HW_I2C_Cleanup_Active_Transfer( HWI2CChannel_T channel )
         LL_I2C_AcknowledgeNextData(
             i2c_instance, ( state->config.mode == HW_I2C_MODE_SLAVE ) ? LL_I2C_ACK : LL_I2C_NACK );
     }
+    else if ( channel == HW_I2C_CHANNEL_FMPI2C1 )
+    {
+        HW_I2C_MAP[channel].dma_rx->CR &= ~DMA_SxCR_EN;
+        LL_FMPI2C_DisableDMAReq_RX( FMPI2C1 );
+        LL_FMPI2C_EnableIT_RX( FMPI2C1 );
+    }
 
     state->transfer_in_progress     = false;
     state->transfer_kind            = HW_I2C_TRANSFER_KIND_IDLE;
     state->master_queue_active      = false;
     state->active_uses_dma          = false;
+    state->write_read_active        = false;
+    state->write_read_rx_length     = 0U;
+    state->repeated_start_pending   = false;
     state->tx_remaining             = 0U;
     state->dma_tx_transfer_complete = false;
     state->rx_expected_length       = 0U;
@@ -703,6 +859,127 @@ static void HW_I2C_Request_Master_Stop( HWI2CChannel_T channel )
     }
 }
 
+/**
+ * @brief Turn the write phase of a combined transaction into its read.
+ *
+ * Called once the last payload byte is in the shift register, so the repeated
+ * start follows it directly. The event interrupt ignores everything until the
+ * repeated start's SB, when the read path's interrupts or DMA request are
+ * enabled. SR1 has been read by the caller; the DR read clears a BTF that may
+ * already be set so it does not re-enter the interrupt meanwhile.
+ */
+static void HW_I2C_Start_Repeated_Read( HWI2CChannel_T channel )
+{
+    HWI2CChannelState_T* state = &hw_i2c_channel_state[channel];
+
+    state->transfer_kind            = HW_I2C_TRANSFER_KIND_MASTER_RX;
+    state->tx_remaining             = 0U;
+    state->dma_tx_transfer_complete = false;
+    state->rx_transfer_length       = state->write_read_rx_length;
+    state->rx_received_length       = 0U;
+    state->rx_expected_length       = state->write_read_rx_length;
+    state->dma_rx_expected_length   = state->write_read_rx_length;
+
+    if ( channel == HW_I2C_CHANNEL_FMPI2C1 )
+    {
+        HW_I2C_Prepare_FMPI2C1_Receive( state, state->write_read_rx_length );
+        FMPI2C1->CR2 = ( ( uint32_t )state->target_address_7bit << 1U )
+                       | ( ( uint32_t )state->write_read_rx_length << FMPI2C_CR2_NBYTES_Pos )
+                       | FMPI2C_CR2_RD_WRN | FMPI2C_CR2_START | FMPI2C_CR2_AUTOEND;
+        return;
+    }
+
+    I2C_TypeDef*        i2c_instance = HW_I2C_MAP[channel].instance;
+    DMA_Stream_TypeDef* tx_stream    = HW_I2C_MAP[channel].dma_tx;
+    if ( tx_stream != NULL )
+    {
+        tx_stream->CR &= ~DMA_SxCR_EN;
+    }
+    HW_I2C_Disable_DMA_Request( i2c_instance );
+    LL_I2C_DisableIT_BUF( i2c_instance );
+
+    state->active_uses_dma = state->config.rx_transfer_path == HW_I2C_TRANSFER_DMA;
+    if ( state->active_uses_dma )
+    {
+        DMA_Stream_TypeDef* rx_stream = HW_I2C_MAP[channel].dma_rx;
+
+        HW_I2C_DMA_Stream_Clear_Flags( rx_stream );
+        HW_I2C_Configure_DMA_Stream( rx_stream, HW_I2C_MAP[channel].dma_channel_bits, false,
+                                     ( uint32_t )( uintptr_t )&i2c_instance->DR,
+                                     ( uint32_t )( uintptr_t )state->rx_staging_buffer,
+                                     state->write_read_rx_length );
+    }
+
+    i2c_instance->CR1 &= ~I2C_CR1_POS;
+    i2c_instance->CR2 &= ~I2C_CR2_LAST;
+    LL_I2C_AcknowledgeNextData( i2c_instance, LL_I2C_ACK );
+    state->repeated_start_pending = true;
+    ( void )i2c_instance->DR;
+    LL_I2C_GenerateStartCondition( i2c_instance );
+}
+
+/**
+ * @brief End a master write: STOP, or the repeated start of a combined transaction.
+ */
+static void HW_I2C_Finish_Master_Write( HWI2CChannel_T channel )
+{
+    if ( hw_i2c_channel_state[channel].write_read_active )
+    {
+        HW_I2C_Start_Repeated_Read( channel );
+        return;
+    }
+
+    HW_I2C_Request_Master_Stop( channel );
+}
+
+static uint16_t HW_I2C_Transaction_Rx_Length( const HWI2CMasterTransaction_T* transaction )
+{
+    switch ( transaction->transfer_kind )
+    {
+        case HW_I2C_TRANSFER_KIND_MASTER_RX:
+            return transaction->length;
+        case HW_I2C_TRANSFER_KIND_MASTER_WRITE_READ:
+            return transaction->rx_length;
+        case HW_I2C_TRANSFER_KIND_IDLE:
+        case HW_I2C_TRANSFER_KIND_MASTER_TX:
+        case HW_I2C_TRANSFER_KIND_SLAVE_RX:
+        case HW_I2C_TRANSFER_KIND_SLAVE_TX:
+        default:
+            return 0U;
+    }
+}
+
+/**
+ * @brief Check that a further receive of expected_length still fits.
+ *
+ * Completed unconsumed messages plus every active or queued receive reserve
+ * their bytes and one descriptor each, so an accepted receive always has room
+ * to publish.
+ */
+static bool HW_I2C_Rx_Capacity_Available( const HWI2CChannelState_T* state,
+                                          uint16_t                   expected_length )
+{
+    uint32_t reserved_rx_bytes       = state->rx_count;
+    uint32_t reserved_rx_descriptors = state->rx_message_count;
+    uint8_t  queue_index             = state->master_queue_head;
+    for ( uint8_t index = 0U; index < state->master_queue_count; ++index )
+    {
+        const uint16_t rx_length =
+            HW_I2C_Transaction_Rx_Length( &state->master_queue[queue_index] );
+        if ( rx_length > 0U )
+        {
+            reserved_rx_bytes += rx_length;
+            reserved_rx_descriptors++;
+        }
+        queue_index = ( uint8_t )( ( queue_index + 1U ) % HW_I2C_MASTER_TRANSACTION_QUEUE_DEPTH );
+    }
+
+    reserved_rx_bytes += expected_length;
+    reserved_rx_descriptors++;
+    return ( reserved_rx_bytes <= HW_I2C_RX_BUFFER_SIZE )
+           && ( reserved_rx_descriptors <= HW_I2C_RX_MESSAGE_QUEUE_DEPTH );
+}
+
 static bool HW_I2C_Pump_Master_Queue( HWI2CChannel_T channel )
 {
     HWI2CChannelState_T* state = &hw_i2c_channel_state[channel];
@@ -720,8 +997,16 @@ static bool HW_I2C_Pump_Master_Queue( HWI2CChannel_T channel )
 
     HWI2CMasterTransaction_T* transaction = &state->master_queue[state->master_queue_head];
 
+    /* A combined transaction starts as a write and turns into a read at the repeated start. */
+    const bool write_read = transaction->transfer_kind == HW_I2C_TRANSFER_KIND_MASTER_WRITE_READ;
+    const HWI2CTransferKind_T transfer_kind =
+        write_read ? HW_I2C_TRANSFER_KIND_MASTER_TX : transaction->transfer_kind;
+
     state->target_address_7bit       = transaction->target_address_7bit;
-    state->transfer_kind             = transaction->transfer_kind;
+    state->transfer_kind             = transfer_kind;
+    state->write_read_active         = write_read;
+    state->write_read_rx_length      = transaction->rx_length;
+    state->repeated_start_pending    = false;
     state->transfer_in_progress      = true;
     state->master_queue_active       = true;
     state->completion_condition_seen = false;
@@ -733,7 +1018,7 @@ static bool HW_I2C_Pump_Master_Queue( HWI2CChannel_T channel )
     state->rx_expected_length        = 0U;
     state->dma_rx_expected_length    = 0U;
 
-    if ( transaction->transfer_kind == HW_I2C_TRANSFER_KIND_MASTER_TX )
+    if ( transfer_kind == HW_I2C_TRANSFER_KIND_MASTER_TX )
     {
         state->tx_ptr       = transaction->tx_payload;
         state->tx_remaining = transaction->length;
@@ -751,18 +1036,27 @@ static bool HW_I2C_Pump_Master_Queue( HWI2CChannel_T channel )
     {
         uint32_t cr2 = ( ( uint32_t )transaction->target_address_7bit << 1U )
                        | ( ( uint32_t )transaction->length << FMPI2C_CR2_NBYTES_Pos )
-                       | FMPI2C_CR2_START | FMPI2C_CR2_AUTOEND;
-        if ( transaction->transfer_kind == HW_I2C_TRANSFER_KIND_MASTER_RX )
+                       | FMPI2C_CR2_START;
+        if ( transfer_kind == HW_I2C_TRANSFER_KIND_MASTER_RX )
         {
             cr2 |= FMPI2C_CR2_RD_WRN;
         }
-        FMPI2C1->CR2           = cr2;
+        if ( !write_read )
+        {
+            cr2 |= FMPI2C_CR2_AUTOEND;
+        }
+
         state->active_uses_dma = false;
+        if ( transfer_kind == HW_I2C_TRANSFER_KIND_MASTER_RX )
+        {
+            HW_I2C_Prepare_FMPI2C1_Receive( state, transaction->length );
+        }
+        FMPI2C1->CR2 = cr2;
         return true;
     }
 
     I2C_TypeDef* i2c_instance = HW_I2C_MAP[channel].instance;
-    const bool   use_dma      = ( transaction->transfer_kind == HW_I2C_TRANSFER_KIND_MASTER_TX )
+    const bool   use_dma      = ( transfer_kind == HW_I2C_TRANSFER_KIND_MASTER_TX )
                                     ? ( ( state->config.tx_transfer_path == HW_I2C_TRANSFER_DMA )
                                  && ( transaction->length > 0U ) )
                                     : ( state->config.rx_transfer_path == HW_I2C_TRANSFER_DMA );
@@ -770,12 +1064,10 @@ static bool HW_I2C_Pump_Master_Queue( HWI2CChannel_T channel )
 
     if ( use_dma )
     {
-        DMA_Stream_TypeDef* stream =
-            ( transaction->transfer_kind == HW_I2C_TRANSFER_KIND_MASTER_TX )
-                ? HW_I2C_MAP[channel].dma_tx
-                : HW_I2C_MAP[channel].dma_rx;
-        const bool memory_to_peripheral =
-            transaction->transfer_kind == HW_I2C_TRANSFER_KIND_MASTER_TX;
+        DMA_Stream_TypeDef* stream = ( transfer_kind == HW_I2C_TRANSFER_KIND_MASTER_TX )
+                                         ? HW_I2C_MAP[channel].dma_tx
+                                         : HW_I2C_MAP[channel].dma_rx;
+        const bool memory_to_peripheral = transfer_kind == HW_I2C_TRANSFER_KIND_MASTER_TX;
         const uint8_t* memory =
             memory_to_peripheral ? transaction->tx_payload : state->rx_staging_buffer;
 
@@ -786,7 +1078,7 @@ static bool HW_I2C_Pump_Master_Queue( HWI2CChannel_T channel )
                                      ( uint32_t )( uintptr_t )memory, transaction->length );
     }
 
-    HW_I2C_Start_Master_Transfer( i2c_instance, transaction->transfer_kind, use_dma );
+    HW_I2C_Start_Master_Transfer( i2c_instance, transfer_kind, use_dma );
     return true;
 }
 
@@ -845,6 +1137,14 @@ static void HW_I2C_Configure_DMA_Stream( DMA_Stream_TypeDef* stream, uint32_t ch
 
 static inline bool HW_I2C_DMA_Stream_Has_TC( DMA_Stream_TypeDef* stream )
 {
+    if ( stream == HW_I2C_CHANNEL_1_DMA_RX_STREAM )
+    {
+        return ( ( DMA1->LISR & HW_I2C_CHANNEL_1_DMA_RX_TC_FLAG ) != 0U );
+    }
+    if ( stream == HW_I2C_FMPI2C1_DMA_RX_STREAM )
+    {
+        return ( ( DMA1->LISR & HW_I2C_FMPI2C1_DMA_RX_TC_FLAG ) != 0U );
+    }
     if ( stream == HW_I2C_CHANNEL_2_DMA_RX_STREAM )
     {
         return ( ( DMA1->LISR & HW_I2C_CHANNEL_2_DMA_RX_TC_FLAG ) != 0U );
@@ -858,6 +1158,14 @@ static inline bool HW_I2C_DMA_Stream_Has_TC( DMA_Stream_TypeDef* stream )
 
 static inline bool HW_I2C_DMA_Stream_Has_TE( DMA_Stream_TypeDef* stream )
 {
+    if ( stream == HW_I2C_CHANNEL_1_DMA_RX_STREAM )
+    {
+        return ( ( DMA1->LISR & HW_I2C_CHANNEL_1_DMA_RX_TE_FLAG ) != 0U );
+    }
+    if ( stream == HW_I2C_FMPI2C1_DMA_RX_STREAM )
+    {
+        return ( ( DMA1->LISR & HW_I2C_FMPI2C1_DMA_RX_TE_FLAG ) != 0U );
+    }
     if ( stream == HW_I2C_CHANNEL_2_DMA_RX_STREAM )
     {
         return ( ( DMA1->LISR & HW_I2C_CHANNEL_2_DMA_RX_TE_FLAG ) != 0U );
@@ -871,7 +1179,15 @@ static inline bool HW_I2C_DMA_Stream_Has_TE( DMA_Stream_TypeDef* stream )
 
 static inline void HW_I2C_DMA_Stream_Clear_Flags( DMA_Stream_TypeDef* stream )
 {
-    if ( stream == HW_I2C_CHANNEL_2_DMA_RX_STREAM )
+    if ( stream == HW_I2C_CHANNEL_1_DMA_RX_STREAM )
+    {
+        DMA1->LIFCR = HW_I2C_CHANNEL_1_DMA_RX_CLEAR_FLAGS_MASK;
+    }
+    else if ( stream == HW_I2C_FMPI2C1_DMA_RX_STREAM )
+    {
+        DMA1->LIFCR = HW_I2C_FMPI2C1_DMA_RX_CLEAR_FLAGS_MASK;
+    }
+    else if ( stream == HW_I2C_CHANNEL_2_DMA_RX_STREAM )
     {
         DMA1->LIFCR = HW_I2C_CHANNEL_2_DMA_RX_CLEAR_FLAGS_MASK;
     }
@@ -881,12 +1197,45 @@ static inline void HW_I2C_DMA_Stream_Clear_Flags( DMA_Stream_TypeDef* stream )
     }
 }
 
+/**
+ * @brief Select the receive path of the FMPI2C1 master read about to start.
+ *
+ * On the DMA path the RX interrupt is off and the stream moves RXDR into the
+ * staging buffer; the STOPF interrupt that AUTOEND produces still ends the
+ * transaction.
+ */
+static void HW_I2C_Prepare_FMPI2C1_Receive( HWI2CChannelState_T* state, uint16_t length )
+{
+    state->active_uses_dma = state->config.rx_transfer_path == HW_I2C_TRANSFER_DMA;
+    if ( !state->active_uses_dma )
+    {
+        LL_FMPI2C_DisableDMAReq_RX( FMPI2C1 );
+        LL_FMPI2C_EnableIT_RX( FMPI2C1 );
+        return;
+    }
+
+    DMA_Stream_TypeDef* rx_stream = HW_I2C_MAP[HW_I2C_CHANNEL_FMPI2C1].dma_rx;
+
+    HW_I2C_DMA_Stream_Clear_Flags( rx_stream );
+    HW_I2C_Configure_DMA_Stream( rx_stream, HW_I2C_MAP[HW_I2C_CHANNEL_FMPI2C1].dma_channel_bits,
+                                 false, ( uint32_t )( uintptr_t )&FMPI2C1->RXDR,
+                                 ( uint32_t )( uintptr_t )state->rx_staging_buffer, length );
+    LL_FMPI2C_DisableIT_RX( FMPI2C1 );
+    LL_FMPI2C_EnableDMAReq_RX( FMPI2C1 );
+}
+
 static inline void HW_I2C_Service_Event_External( HWI2CChannel_T channel,
                                                   I2C_TypeDef*   i2c_instance )
 {
     HWI2CChannelState_T* state = &hw_i2c_channel_state[channel];
     uint32_t             sr1   = i2c_instance->SR1;
 
+    if ( state->register_map_active )
+    {
+        HW_I2C_Service_Register_Map( channel, i2c_instance, sr1 );
+        return;
+    }
+
     if ( ( sr1 & ( I2C_SR1_ARLO | I2C_SR1_BERR | I2C_SR1_OVR | I2C_SR1_TIMEOUT ) ) != 0U )
     {
         if ( ( sr1 & I2C_SR1_AF ) != 0U )
@@ -935,6 +1284,24 @@ static inline void HW_I2C_Service_Event_External( HWI2CChannel_T channel,
             ( state->transfer_kind == HW_I2C_TRANSFER_KIND_MASTER_RX ) ? 1U : 0U;
         i2c_instance->DR =
             ( uint32_t )( ( uint8_t )( ( state->target_address_7bit << 1U ) | direction_bit ) );
+
+        if ( state->repeated_start_pending )
+        {
+            state->repeated_start_pending = false;
+            if ( state->active_uses_dma )
+            {
+                HW_I2C_Prepare_DMA_Path( i2c_instance, state->transfer_kind );
+            }
+            else
+            {
+                LL_I2C_EnableIT_BUF( i2c_instance );
+            }
+        }
+        return;
+    }
+
+    if ( state->repeated_start_pending )
+    {
         return;
     }
 
@@ -988,6 +1355,13 @@ static inline void HW_I2C_Service_Event_External( HWI2CChannel_T channel,
                 state->tx_ptr++;
                 state->tx_remaining--;
             }
+            else if ( state->write_read_active )
+            {
+                /* The last byte is in the shift register: the repeated start can be requested
+                 * now rather than after BTF. */
+                HW_I2C_Start_Repeated_Read( channel );
+                return;
+            }
             else if ( state->transfer_kind == HW_I2C_TRANSFER_KIND_SLAVE_TX )
             {
                 /* No data to send for slave - send 0xFF as filler. */
@@ -1000,7 +1374,7 @@ static inline void HW_I2C_Service_Event_External( HWI2CChannel_T channel,
              && ( ( !tx_dma_mode ) || state->dma_tx_transfer_complete )
              && ( ( sr1 & I2C_SR1_BTF ) != 0U ) )
         {
-            HW_I2C_Request_Master_Stop( channel );
+            HW_I2C_Finish_Master_Write( channel );
             return;
         }
 
@@ -1147,6 +1521,108 @@ static bool HW_I2C_Read_External_Byte( HWI2CChannel_T channel, I2C_TypeDef* i2c_
     return true;
 }
 
+/**
+ * @brief Serve one event of a register-map slave.
+ *
+ * Bus errors end the transaction but leave the map armed; the master retries
+ * with a new transaction. On a read, TXE follows ADDR immediately, so the
+ * first register is loaded in the same interrupt. The peripheral asks for one
+ * byte more than the master takes: when the master's NACK arrives with that
+ * byte still unsent in DR, the pointer is moved back over it.
+ */
+static void HW_I2C_Service_Register_Map( HWI2CChannel_T channel, I2C_TypeDef* i2c_instance,
+                                         uint32_t sr1 )
+{
+    HWI2CChannelState_T* state = &hw_i2c_channel_state[channel];
+
+    if ( ( sr1 & ( I2C_SR1_ARLO | I2C_SR1_BERR | I2C_SR1_OVR | I2C_SR1_TIMEOUT ) ) != 0U )
+    {
+        if ( ( sr1 & I2C_SR1_ARLO ) != 0U )
+        {
+            LL_I2C_ClearFlag_ARLO( i2c_instance );
+        }
+        if ( ( sr1 & I2C_SR1_BERR ) != 0U )
+        {
+            LL_I2C_ClearFlag_BERR( i2c_instance );
+        }
+        if ( ( sr1 & I2C_SR1_OVR ) != 0U )
+        {
+            LL_I2C_ClearFlag_OVR( i2c_instance );
+        }
+        if ( ( sr1 & I2C_SR1_TIMEOUT ) != 0U )
+        {
+            LL_I2C_ClearSMBusFlag_TIMEOUT( i2c_instance );
+        }
+        state->register_map_phase = HW_I2C_REGISTER_MAP_IDLE;
+        HW_I2C_Latch_Transfer_Result( state, HW_I2C_STATUS_ERROR );
+        return;
+    }
+
+    if ( ( sr1 & I2C_SR1_AF ) != 0U )
+    {
+        LL_I2C_ClearFlag_AF( i2c_instance );
+        if ( ( state->register_map_phase == HW_I2C_REGISTER_MAP_READ )
+             && ( state->register_bytes_loaded > 0U ) && ( ( sr1 & I2C_SR1_TXE ) == 0U ) )
+        {
+            state->register_pointer--;
+        }
+        state->register_map_phase = HW_I2C_REGISTER_MAP_IDLE;
+        return;
+    }
+
+    if ( ( sr1 & I2C_SR1_ADDR ) != 0U )
+    {
+        const bool slave_transmits = ( i2c_instance->SR2 & I2C_SR2_TRA ) != 0U;
+        LL_I2C_ClearFlag_ADDR( i2c_instance );
+
+        if ( !slave_transmits )
+        {
+            state->register_map_phase = HW_I2C_REGISTER_MAP_POINTER;
+            return;
+        }
+
+        state->register_map_phase    = HW_I2C_REGISTER_MAP_READ;
+        state->register_bytes_loaded = 0U;
+        sr1                          = i2c_instance->SR1;
+    }
+
+    if ( ( sr1 & I2C_SR1_RXNE ) != 0U )
+    {
+        const uint8_t data_byte = ( uint8_t )i2c_instance->DR;
+
+        if ( state->register_map_phase == HW_I2C_REGISTER_MAP_POINTER )
+        {
+            state->register_pointer   = data_byte;
+            state->register_map_phase = HW_I2C_REGISTER_MAP_WRITE;
+        }
+        else if ( state->register_map_phase == HW_I2C_REGISTER_MAP_WRITE )
+        {
+            if ( state->register_map_writable
+                 && ( state->register_pointer < state->register_map_size ) )
+            {
+                state->register_map[state->register_pointer] = data_byte;
+            }
+            state->register_pointer++;
+        }
+    }
+
+    if ( ( ( sr1 & I2C_SR1_TXE ) != 0U )
+         && ( state->register_map_phase == HW_I2C_REGISTER_MAP_READ ) )
+    {
+        i2c_instance->DR = ( state->register_pointer < state->register_map_size )
+                               ? ( uint32_t )state->register_map[state->register_pointer]
+                               : 0xFFU;
+        state->register_pointer++;
+        state->register_bytes_loaded++;
+    }
+
+    if ( ( sr1 & I2C_SR1_STOPF ) != 0U )
+    {
+        LL_I2C_ClearFlag_STOP( i2c_instance );
+        state->register_map_phase = HW_I2C_REGISTER_MAP_IDLE;
+    }
+}
+
 static inline void HW_I2C_Service_Event_FMPI2C1( HWI2CChannel_T channel )
 {
     HWI2CChannelState_T* state = &hw_i2c_channel_state[channel];
@@ -1181,7 +1657,8 @@ static inline void HW_I2C_Service_Event_FMPI2C1( HWI2CChannel_T channel )
         }
     }
 
-    if ( ( isr & FMPI2C_ISR_RXNE ) != 0U )
+    /* On the DMA path RXNE belongs to the stream. */
+    if ( ( ( isr & FMPI2C_ISR_RXNE ) != 0U ) && !state->active_uses_dma )
     {
         uint8_t data_byte = ( uint8_t )FMPI2C1->RXDR;
         if ( state->rx_received_length >= state->rx_transfer_length )
@@ -1200,14 +1677,29 @@ static inline void HW_I2C_Service_Event_FMPI2C1( HWI2CChannel_T channel )
     if ( ( isr & FMPI2C_ISR_STOPF ) != 0U )
     {
         LL_FMPI2C_ClearFlag_STOP( FMPI2C1 );
+        if ( state->active_uses_dma && ( state->transfer_kind == HW_I2C_TRANSFER_KIND_MASTER_RX ) )
+        {
+            /* STOPF may be served before the stream's transfer-complete interrupt. */
+            const uint16_t remaining = ( uint16_t )HW_I2C_MAP[channel].dma_rx->NDTR;
+            state->rx_received_length =
+                ( remaining <= state->rx_transfer_length )
+                    ? ( uint16_t )( state->rx_transfer_length - remaining )
+                    : 0U;
+        }
         state->completion_condition_seen = true;
         state->restart_pending           = true;
         return;
     }
 
-    /* Transfer complete: generate STOP to terminate transfer. */
+    /* Transfer complete: repeated start into the read of a combined transaction, or STOP. */
     if ( ( isr & FMPI2C_ISR_TC ) != 0U )
     {
+        if ( state->write_read_active
+             && ( state->transfer_kind == HW_I2C_TRANSFER_KIND_MASTER_TX ) )
+        {
+            HW_I2C_Start_Repeated_Read( channel );
+            return;
+        }
         LL_FMPI2C_GenerateStopCondition( FMPI2C1 );
     }
 }
@@ -1270,7 +1762,12 @@ static inline void HW_I2C_Service_DMA_Rx_IRQ( HWI2CChannel_T channel )
         state->rx_received_length       = state->dma_rx_expected_length;
         state->dma_rx_transfer_complete = true;
 
-        if ( state->transfer_kind == HW_I2C_TRANSFER_KIND_MASTER_RX )
+        /* FMPI2C1 NACKs the last byte and sends STOP itself under AUTOEND. */
+        if ( channel == HW_I2C_CHANNEL_FMPI2C1 )
+        {
+            LL_FMPI2C_DisableDMAReq_RX( FMPI2C1 );
+        }
+        else if ( state->transfer_kind == HW_I2C_TRANSFER_KIND_MASTER_RX )
         {
             I2C_TypeDef* i2c_instance = HW_I2C_MAP[channel].instance;
             HW_I2C_Disable_DMA_Request( i2c_instance );
@@ -1319,7 +1816,7 @@ static inline void HW_I2C_Service_DMA_Tx_IRQ( HWI2CChannel_T channel )
             state->dma_tx_transfer_complete = true;
             if ( ( i2c_instance->SR1 & I2C_SR1_BTF ) != 0U )
             {
-                HW_I2C_Request_Master_Stop( channel );
+                HW_I2C_Finish_Master_Write( channel );
             }
         }
         /* For slave transmit, mark DMA complete but don't finish yet; wait for
@@ -1371,6 +1868,7 @@ HWI2CStatus_T HW_I2C_Configure_Channel( HWI2CChannel_T channel, const HWI2CChann
 
     HW_I2C_Enable_Clock_For_Channel( channel );
     HW_I2C_Enable_Error_IRQ_For_Channel( channel );
+    HW_I2C_Enable_DMA_IRQ_For_Channel( channel, config );
     HW_I2C_Set_Speed_And_Address( i2c_instance, config->speed, config->own_address_7bit );
 
     if ( config->mode == HW_I2C_MODE_SLAVE )
@@ -1391,7 +1889,7 @@ HWI2CStatus_T HW_I2C_Configure_Channel( HWI2CChannel_T channel, const HWI2CChann
  * @brief Configure the internal FMPI2C1 channel.
  *
  * Initializes the high-speed internal FMPI2C1 channel with a specified own address.
- * Channel operates in master mode with interrupt-based transfer path.
+ * Channel operates in master mode and starts on the interrupt transfer path.
  *
  * @param[in] own_address_7bit  7-bit own address for the channel (0x00-0x7F)
  *
@@ -1420,7 +1918,7 @@ HWI2CStatus_T HW_I2C_Configure_Internal_FMPI2C1( uint16_t own_address_7bit )
     HW_I2C_Enable_Error_IRQ_For_Channel( HW_I2C_CHANNEL_FMPI2C1 );
 
     LL_FMPI2C_Disable( FMPI2C1 );
-    LL_FMPI2C_SetTiming( FMPI2C1, FMPI2C1_TIMINGR );
+    ( void )HW_I2C_FMPI2C1_Set_Timing( state->config.speed );
     LL_FMPI2C_SetOwnAddress1( FMPI2C1, ( uint32_t )own_address_7bit << 1U,
                               LL_FMPI2C_OWNADDRESS1_7BIT );
     LL_FMPI2C_EnableOwnAddress1( FMPI2C1 );
@@ -1435,6 +1933,67 @@ HWI2CStatus_T HW_I2C_Configure_Internal_FMPI2C1( uint16_t own_address_7bit )
     return HW_I2C_STATUS_OK;
 }
 
+HWI2CStatus_T HW_I2C_Set_Internal_FMPI2C1_Rx_Path( HWI2CTransferPath_T rx_transfer_path )
+{
+    if ( ( rx_transfer_path != HW_I2C_TRANSFER_INTERRUPT )
+         && ( rx_transfer_path != HW_I2C_TRANSFER_DMA ) )
+    {
+        return HW_I2C_STATUS_INVALID_PARAM;
+    }
+
+    HWI2CChannelState_T* state = &hw_i2c_channel_state[HW_I2C_CHANNEL_FMPI2C1];
+    if ( !state->configured )
+    {
+        return HW_I2C_STATUS_NOT_CONFIGURED;
+    }
+
+    HWI2CIrqState_T irq_state = HW_I2C_Channel_Irqs_Disable( HW_I2C_CHANNEL_FMPI2C1 );
+    if ( state->master_queue_count > 0U )
+    {
+        HW_I2C_Channel_Irqs_Restore( HW_I2C_CHANNEL_FMPI2C1, irq_state );
+        return HW_I2C_STATUS_BUSY;
+    }
+
+    state->config.rx_transfer_path = rx_transfer_path;
+    HW_I2C_Channel_Irqs_Restore( HW_I2C_CHANNEL_FMPI2C1, irq_state );
+    HW_I2C_Enable_DMA_IRQ_For_Channel( HW_I2C_CHANNEL_FMPI2C1, &state->config );
+
+    return HW_I2C_STATUS_OK;
+}
+
+HWI2CStatus_T HW_I2C_Set_Internal_FMPI2C1_Speed( HWI2CSpeed_T speed )
+{
+    if ( ( speed != HW_I2C_SPEED_100KHZ ) && ( speed != HW_I2C_SPEED_400KHZ )
+         && ( speed != HW_I2C_SPEED_1MHZ ) )
+    {
+        return HW_I2C_STATUS_INVALID_PARAM;
+    }
+
+    HWI2CChannelState_T* state = &hw_i2c_channel_state[HW_I2C_CHANNEL_FMPI2C1];
+    if ( !state->configured )
+    {
+        return HW_I2C_STATUS_NOT_CONFIGURED;
+    }
+
+    HWI2CIrqState_T irq_state = HW_I2C_Channel_Irqs_Disable( HW_I2C_CHANNEL_FMPI2C1 );
+    if ( state->master_queue_count > 0U )
+    {
+        HW_I2C_Channel_Irqs_Restore( HW_I2C_CHANNEL_FMPI2C1, irq_state );
+        return HW_I2C_STATUS_BUSY;
+    }
+
+    LL_FMPI2C_Disable( FMPI2C1 );
+    bool applied = HW_I2C_FMPI2C1_Set_Timing( speed );
+    LL_FMPI2C_Enable( FMPI2C1 );
+    if ( applied )
+    {
+        state->config.speed = speed;
+    }
+    HW_I2C_Channel_Irqs_Restore( HW_I2C_CHANNEL_FMPI2C1, irq_state );
+
+    return applied ? HW_I2C_STATUS_OK : HW_I2C_STATUS_INVALID_PARAM;
+}
+
 HWI2CStatus_T HW_I2C_Enqueue_Master_Transmit( HWI2CChannel_T channel, uint16_t device_address_7bit,
                                               const uint8_t* payload, uint16_t payload_length )
 {
@@ -1470,6 +2029,7 @@ HWI2CStatus_T HW_I2C_Enqueue_Master_Transmit( HWI2CChannel_T channel, uint16_t d
     transaction->transfer_kind            = HW_I2C_TRANSFER_KIND_MASTER_TX;
     transaction->target_address_7bit      = device_address_7bit;
     transaction->length                   = payload_length;
+    transaction->rx_length                = 0U;
     if ( payload_length > 0U )
     {
         memcpy( transaction->tx_payload, payload, ( size_t )payload_length );
@@ -1515,33 +2075,70 @@ HWI2CStatus_T HW_I2C_Enqueue_Master_Receive( HWI2CChannel_T channel, uint16_t de
         return HW_I2C_STATUS_BUSY;
     }
 
-    uint32_t reserved_rx_bytes       = state->rx_count;
-    uint32_t reserved_rx_descriptors = state->rx_message_count;
-    uint8_t  queue_index             = state->master_queue_head;
-    for ( uint8_t index = 0U; index < state->master_queue_count; ++index )
+    if ( !HW_I2C_Rx_Capacity_Available( state, expected_length ) )
     {
-        const HWI2CMasterTransaction_T* queued = &state->master_queue[queue_index];
-        if ( queued->transfer_kind == HW_I2C_TRANSFER_KIND_MASTER_RX )
-        {
-            reserved_rx_bytes += queued->length;
-            reserved_rx_descriptors++;
-        }
-        queue_index = ( uint8_t )( ( queue_index + 1U ) % HW_I2C_MASTER_TRANSACTION_QUEUE_DEPTH );
+        HW_I2C_Channel_Irqs_Restore( channel, irq_state );
+        return HW_I2C_STATUS_BUSY;
     }
 
-    reserved_rx_bytes += expected_length;
-    reserved_rx_descriptors++;
-    if ( ( reserved_rx_bytes > HW_I2C_RX_BUFFER_SIZE )
-         || ( reserved_rx_descriptors > HW_I2C_RX_MESSAGE_QUEUE_DEPTH ) )
+    HWI2CMasterTransaction_T* transaction = &state->master_queue[state->master_queue_tail];
+    transaction->transfer_kind            = HW_I2C_TRANSFER_KIND_MASTER_RX;
+    transaction->target_address_7bit      = device_address_7bit;
+    transaction->length                   = expected_length;
+    transaction->rx_length                = 0U;
+
+    state->master_queue_tail =
+        ( uint8_t )( ( state->master_queue_tail + 1U ) % HW_I2C_MASTER_TRANSACTION_QUEUE_DEPTH );
+    state->master_queue_count++;
+    state->completion_condition_seen = false;
+    ( void )HW_I2C_Pump_Master_Queue( channel );
+    HW_I2C_Channel_Irqs_Restore( channel, irq_state );
+
+    return HW_I2C_STATUS_OK;
+}
+
+HWI2CStatus_T HW_I2C_Enqueue_Master_Write_Read( HWI2CChannel_T channel,
+                                                uint16_t       device_address_7bit,
+                                                const uint8_t* payload, uint16_t payload_length,
+                                                uint16_t expected_length )
+{
+    if ( !HW_I2C_Channel_Is_Valid( channel ) || !HW_I2C_Address_Is_Valid( device_address_7bit )
+         || ( payload == NULL ) || ( payload_length == 0U )
+         || ( payload_length > HW_I2C_TX_MAX_MESSAGE_SIZE ) || ( expected_length == 0U )
+         || ( expected_length > HW_I2C_RX_BUFFER_SIZE )
+         || ( ( channel == HW_I2C_CHANNEL_FMPI2C1 )
+              && ( ( payload_length > 255U ) || ( expected_length > 255U ) ) ) )
+    {
+        return HW_I2C_STATUS_INVALID_PARAM;
+    }
+
+    HWI2CChannelState_T* state = &hw_i2c_channel_state[channel];
+    if ( !state->configured || ( state->config.mode != HW_I2C_MODE_MASTER ) )
+    {
+        return HW_I2C_STATUS_NOT_CONFIGURED;
+    }
+
+    HWI2CIrqState_T irq_state = HW_I2C_Channel_Irqs_Disable( channel );
+    if ( state->transfer_result != HW_I2C_STATUS_OK )
+    {
+        HWI2CStatus_T result = state->transfer_result;
+        HW_I2C_Channel_Irqs_Restore( channel, irq_state );
+        return result;
+    }
+
+    if ( ( state->master_queue_count >= HW_I2C_MASTER_TRANSACTION_QUEUE_DEPTH )
+         || !HW_I2C_Rx_Capacity_Available( state, expected_length ) )
     {
         HW_I2C_Channel_Irqs_Restore( channel, irq_state );
         return HW_I2C_STATUS_BUSY;
     }
 
     HWI2CMasterTransaction_T* transaction = &state->master_queue[state->master_queue_tail];
-    transaction->transfer_kind            = HW_I2C_TRANSFER_KIND_MASTER_RX;
+    transaction->transfer_kind            = HW_I2C_TRANSFER_KIND_MASTER_WRITE_READ;
     transaction->target_address_7bit      = device_address_7bit;
-    transaction->length                   = expected_length;
+    transaction->length                   = payload_length;
+    transaction->rx_length                = expected_length;
+    memcpy( transaction->tx_payload, payload, ( size_t )payload_length );
 
     state->master_queue_tail =
         ( uint8_t )( ( state->master_queue_tail + 1U ) % HW_I2C_MASTER_TRANSACTION_QUEUE_DEPTH );
@@ -1667,12 +2264,15 @@ HWI2CStatus_T HW_I2C_Recover_Channel( HWI2CChannel_T channel )
     state->overflow_occurred = false;
     state->transfer_result   = HW_I2C_STATUS_ERROR;
 
+    state->register_map_active = false;
+    state->register_map_phase  = HW_I2C_REGISTER_MAP_IDLE;
+
     if ( channel == HW_I2C_CHANNEL_FMPI2C1 )
     {
         LL_FMPI2C_Disable( FMPI2C1 );
         FMPI2C1->CR1 = 0U;
         FMPI2C1->CR2 = 0U;
-        LL_FMPI2C_SetTiming( FMPI2C1, FMPI2C1_TIMINGR );
+        ( void )HW_I2C_FMPI2C1_Set_Timing( state->config.speed );
         LL_FMPI2C_SetOwnAddress1( FMPI2C1, ( uint32_t )state->config.own_address_7bit << 1U,
                                   LL_FMPI2C_OWNADDRESS1_7BIT );
         LL_FMPI2C_EnableOwnAddress1( FMPI2C1 );
@@ -1798,7 +2398,8 @@ bool HW_I2C_Trigger_Slave_Transmit_External( HWI2CChannel_T channel )
     HWI2CIrqState_T      irq_state = HW_I2C_Channel_Irqs_Disable( channel );
     HWI2CChannelState_T* state     = &hw_i2c_channel_state[channel];
     if ( !state->configured || ( state->config.mode != HW_I2C_MODE_SLAVE )
-         || state->transfer_in_progress || ( state->master_queue_count > 0U ) )
+         || state->transfer_in_progress || ( state->master_queue_count > 0U )
+         || state->register_map_active )
     {
         HW_I2C_Channel_Irqs_Restore( channel, irq_state );
         return false;
@@ -1863,7 +2464,8 @@ bool HW_I2C_Trigger_Slave_Receive_External( HWI2CChannel_T channel, uint16_t exp
     HWI2CIrqState_T      irq_state = HW_I2C_Channel_Irqs_Disable( channel );
     HWI2CChannelState_T* state     = &hw_i2c_channel_state[channel];
     if ( !state->configured || ( state->config.mode != HW_I2C_MODE_SLAVE )
-         || state->transfer_in_progress || ( state->master_queue_count > 0U ) )
+         || state->transfer_in_progress || ( state->master_queue_count > 0U )
+         || state->register_map_active )
     {
         HW_I2C_Channel_Irqs_Restore( channel, irq_state );
         return false;
@@ -1903,6 +2505,110 @@ bool HW_I2C_Trigger_Slave_Receive_External( HWI2CChannel_T channel, uint16_t exp
     return true;
 }
 
+HWI2CStatus_T HW_I2C_Start_Register_Map( HWI2CChannel_T channel, uint8_t* registers,
+                                         uint16_t size, bool writable )
+{
+    if ( !HW_I2C_Is_External_Channel( channel ) || ( registers == NULL ) || ( size == 0U )
+         || ( size > HW_I2C_REGISTER_MAP_MAX_SIZE ) )
+    {
+        return HW_I2C_STATUS_INVALID_PARAM;
+    }
+
+    HWI2CIrqState_T      irq_state = HW_I2C_Channel_Irqs_Disable( channel );
+    HWI2CChannelState_T* state     = &hw_i2c_channel_state[channel];
+    if ( !state->configured || ( state->config.mode != HW_I2C_MODE_SLAVE ) )
+    {
+        HW_I2C_Channel_Irqs_Restore( channel, irq_state );
+        return HW_I2C_STATUS_NOT_CONFIGURED;
+    }
+    if ( state->transfer_in_progress || state->register_map_active )
+    {
+        HW_I2C_Channel_Irqs_Restore( channel, irq_state );
+        return HW_I2C_STATUS_BUSY;
+    }
+
+    state->register_map          = registers;
+    state->register_map_size     = size;
+    state->register_map_writable = writable;
+    state->register_map_phase    = HW_I2C_REGISTER_MAP_IDLE;
+    state->register_pointer      = 0U;
+    state->register_bytes_loaded = 0U;
+    state->register_map_active   = true;
+
+    I2C_TypeDef* i2c_instance = HW_I2C_MAP[channel].instance;
+    HW_I2C_Prepare_Interrupt_Path( i2c_instance );
+    LL_I2C_AcknowledgeNextData( i2c_instance, LL_I2C_ACK );
+    HW_I2C_Channel_Irqs_Restore( channel, irq_state );
+
+    return HW_I2C_STATUS_OK;
+}
+
+HWI2CStatus_T HW_I2C_Stop_Register_Map( HWI2CChannel_T channel )
+{
+    if ( !HW_I2C_Is_External_Channel( channel ) )
+    {
+        return HW_I2C_STATUS_INVALID_PARAM;
+    }
+
+    HWI2CIrqState_T      irq_state = HW_I2C_Channel_Irqs_Disable( channel );
+    HWI2CChannelState_T* state     = &hw_i2c_channel_state[channel];
+    if ( !state->register_map_active )
+    {
+        HW_I2C_Channel_Irqs_Restore( channel, irq_state );
+        return HW_I2C_STATUS_OK;
+    }
+
+    /* With the event interrupt off, a master mid-transaction would be held by clock stretching. */
+    if ( state->register_map_phase != HW_I2C_REGISTER_MAP_IDLE )
+    {
+        HW_I2C_Channel_Irqs_Restore( channel, irq_state );
+        return HW_I2C_STATUS_BUSY;
+    }
+
+    state->register_map_active = false;
+    state->register_map        = NULL;
+    state->register_map_size   = 0U;
+    HW_I2C_Disable_All_Runtime_Irq_Bits( HW_I2C_MAP[channel].instance );
+    HW_I2C_Channel_Irqs_Restore( channel, irq_state );
+
+    return HW_I2C_STATUS_OK;
+}
+
+HWI2CStatus_T HW_I2C_Update_Register_Map( HWI2CChannel_T channel, uint8_t first_register,
+                                          const uint8_t* data, uint16_t length )
+{
+    if ( !HW_I2C_Is_External_Channel( channel ) || ( data == NULL ) )
+    {
+        return HW_I2C_STATUS_INVALID_PARAM;
+    }
+
+    HWI2CIrqState_T      irq_state = HW_I2C_Channel_Irqs_Disable( channel );
+    HWI2CChannelState_T* state     = &hw_i2c_channel_state[channel];
+    if ( !state->register_map_active )
+    {
+        HW_I2C_Channel_Irqs_Restore( channel, irq_state );
+        return HW_I2C_STATUS_NOT_CONFIGURED;
+    }
+    if ( ( uint32_t )first_register + length > state->register_map_size )
+    {
+        HW_I2C_Channel_Irqs_Restore( channel, irq_state );
+        return HW_I2C_STATUS_INVALID_PARAM;
+    }
+    if ( state->register_map_phase == HW_I2C_REGISTER_MAP_READ )
+    {
+        HW_I2C_Channel_Irqs_Restore( channel, irq_state );
+        return HW_I2C_STATUS_BUSY;
+    }
+
+    if ( length > 0U )
+    {
+        memcpy( &state->register_map[first_register], data, ( size_t )length );
+    }
+    HW_I2C_Channel_Irqs_Restore( channel, irq_state );
+
+    return HW_I2C_STATUS_OK;
+}
+
 /**
  * @brief Peek at received data without consuming it.
  *
@@ -2105,6 +2811,14 @@ void HW_I2C_ER_IRQ_FMPI2C1( void )
     HW_I2C_Service_Event_IRQ( HW_I2C_CHANNEL_FMPI2C1 );
 }
 
+/**
+ * @brief This function handles DMA1 stream1 global interrupt.
+ */
+void HW_I2C_DMA_RX_IRQ_CHANNEL_1( void )
+{
+    HW_I2C_Service_DMA_Rx_IRQ( HW_I2C_CHANNEL_1 );
+}
+
 /**
  * @brief This function handles DMA1 stream2 global interrupt.
  */
@@ -2120,3 +2834,11 @@ void HW_I2C_DMA_TX_IRQ_CHANNEL_2( void )
 {
     HW_I2C_Service_DMA_Tx_IRQ( HW_I2C_CHANNEL_2 );
 }
+
+/**
+ * @brief This function handles DMA1 stream0 global interrupt.
+ */
+void HW_I2C_DMA_RX_IRQ_FMPI2C1( void )
+{
+    HW_I2C_Service_DMA_Rx_IRQ( HW_I2C_CHANNEL_FMPI2C1 );
+}
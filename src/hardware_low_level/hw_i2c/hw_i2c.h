@@ -12,12 +12,14 @@
  *      received data is published as complete messages.
  *
  *  Notes:
- *      - I2C3 supports interrupt-only transfers (no DMA)
  *      - I2C2 supports both interrupt and DMA transfers
- *      - FMPI2C1 is a high-speed internal channel (interrupt-only)
+ *      - I2C3 supports interrupt transfers and DMA receive
+ *      - FMPI2C1 is a high-speed internal channel (interrupt transfers, optional DMA receive)
+ *      - I2C3 and I2C2 run at up to 400 kHz; FMPI2C1 also runs at 1 MHz
  *      - Must call configuration function before any transfers
  *      - Interrupt handlers (HW_I2C_Service_*_IRQ) must be called from application ISRs
  *      - RX byte storage is 512 bytes; maximum TX message size is 256 bytes
+ *      - An external slave can serve a register map without per-transaction triggers
  ******************************************************************************/
 
 #ifndef HW_I2C_H
@@ -46,6 +48,9 @@ extern "C"
 #define HW_I2C_MASTER_TRANSACTION_QUEUE_DEPTH ( 8U )
 #define HW_I2C_RX_MESSAGE_QUEUE_DEPTH ( 8U )
 
+/* A register map is addressed by a one-byte register pointer. */
+#define HW_I2C_REGISTER_MAP_MAX_SIZE ( 256U )
+
 /* Compatibility name retained for the non-queued slave TX staging API. */
 #define HW_I2C_TX_STAGE_SIZE HW_I2C_TX_MAX_MESSAGE_SIZE
 
@@ -73,6 +78,7 @@ typedef enum HWI2CSpeed_T
 {
     HW_I2C_SPEED_100KHZ,
     HW_I2C_SPEED_400KHZ,
+    HW_I2C_SPEED_1MHZ, /* Fast-mode plus; FMPI2C1 only */
 } HWI2CSpeed_T;
 
 typedef enum HWI2CTransferPath_T
@@ -98,6 +104,7 @@ typedef enum HWI2CTransferKind_T
     HW_I2C_TRANSFER_KIND_MASTER_RX,
     HW_I2C_TRANSFER_KIND_SLAVE_TX,
     HW_I2C_TRANSFER_KIND_SLAVE_RX,
+    HW_I2C_TRANSFER_KIND_MASTER_WRITE_READ, /* Write, repeated start, then read */
 } HWI2CTransferKind_T;
 
 typedef struct HWI2CChannelConfig_T
@@ -162,7 +169,7 @@ HWI2CStatus_T HW_I2C_Configure_Channel( HWI2CChannel_T              channel,
  * @brief Configure the internal FMPI2C1 channel.
  *
  * Initializes the high-speed internal FMPI2C1 channel with a specified own address.
- * Channel operates in master mode with interrupt-based transfer path.
+ * Channel operates in master mode and starts at 100 kHz on the interrupt transfer path.
  *
  * @param[in] own_address_7bit  7-bit own address for the channel (0x00-0x7F)
  *
@@ -171,6 +178,34 @@ HWI2CStatus_T HW_I2C_Configure_Channel( HWI2CChannel_T              channel,
  */
 HWI2CStatus_T HW_I2C_Configure_Internal_FMPI2C1( uint16_t own_address_7bit );
 
+/**
+ * @brief Select the receive path of the internal FMPI2C1 channel.
+ *
+ * FMPI2C1 receives on the interrupt path after configuration. On the DMA path
+ * master reads are moved by DMA1 stream 0 and end at the AUTOEND STOP; writes
+ * always use the interrupt path.
+ *
+ * @return HW_I2C_STATUS_OK on success
+ * @return HW_I2C_STATUS_INVALID_PARAM for an invalid path
+ * @return HW_I2C_STATUS_NOT_CONFIGURED before HW_I2C_Configure_Internal_FMPI2C1()
+ * @return HW_I2C_STATUS_BUSY while master transactions are queued or active
+ */
+HWI2CStatus_T HW_I2C_Set_Internal_FMPI2C1_Rx_Path( HWI2CTransferPath_T rx_transfer_path );
+
+/**
+ * @brief Select the bus speed of the internal FMPI2C1 channel.
+ *
+ * Recomputes the timing register for the speed from the I2C-bus specification
+ * limits and the on-board bus edge times. 1 MHz also switches the SCL and SDA
+ * pins to fast-mode plus drive. The speed is kept across channel recovery.
+ *
+ * @return HW_I2C_STATUS_OK on success
+ * @return HW_I2C_STATUS_INVALID_PARAM for an invalid speed or one the bus timing cannot meet
+ * @return HW_I2C_STATUS_NOT_CONFIGURED before HW_I2C_Configure_Internal_FMPI2C1()
+ * @return HW_I2C_STATUS_BUSY while master transactions are queued or active
+ */
+HWI2CStatus_T HW_I2C_Set_Internal_FMPI2C1_Speed( HWI2CSpeed_T speed );
+
 /**
  * @brief Atomically enqueue one complete master transmit transaction.
  *
@@ -202,6 +237,23 @@ HWI2CStatus_T HW_I2C_Enqueue_Master_Transmit( HWI2CChannel_T channel, uint16_t d
 HWI2CStatus_T HW_I2C_Enqueue_Master_Receive( HWI2CChannel_T channel, uint16_t device_address_7bit,
                                              uint16_t expected_length );
 
+/**
+ * @brief Atomically enqueue one combined write, repeated start, read transaction.
+ *
+ * Typically a register read: payload holds the register address and the read
+ * follows without a STOP in between. The read is published as one RX message
+ * whose descriptor kind is HW_I2C_TRANSFER_KIND_MASTER_WRITE_READ. The read
+ * reserves RX capacity like HW_I2C_Enqueue_Master_Receive().
+ *
+ * @return HW_I2C_STATUS_OK when accepted
+ * @return HW_I2C_STATUS_BUSY when queue, reserved byte storage, or future
+ *         descriptor capacity is unavailable
+ */
+HWI2CStatus_T HW_I2C_Enqueue_Master_Write_Read( HWI2CChannel_T channel,
+                                                uint16_t       device_address_7bit,
+                                                const uint8_t* payload, uint16_t payload_length,
+                                                uint16_t expected_length );
+
 /**
  * @brief Service deferred queue completion and start the next safe transaction.
  *
@@ -306,7 +358,8 @@ bool HW_I2C_Trigger_Master_Receive_External( HWI2CChannel_T channel, uint16_t de
  *
  * Initiates an I2C master receive from the specified device address on the internal
  * FMPI2C1 channel. Received data will be available via HW_I2C_Peek_Received() and consumed
- * with HW_I2C_Consume_Received(). The FMPI2C1 channel uses interrupt-based transfer path only.
+ * with HW_I2C_Consume_Received(). The FMPI2C1 channel receives on the path selected with
+ * HW_I2C_Set_Internal_FMPI2C1_Rx_Path().
  *
  * @param[in] device_address_7bit   7-bit slave address to receive from
  * @param[in] expected_length       Number of bytes expected to receive
@@ -345,6 +398,65 @@ bool HW_I2C_Trigger_Slave_Transmit_External( HWI2CChannel_T channel );
  */
 bool HW_I2C_Trigger_Slave_Receive_External( HWI2CChannel_T channel, uint16_t expected_length );
 
+/**
+ * @brief Serve a register array to the bus master from the event interrupt.
+ *
+ * Emulates a register-based slave device such as a sensor. The first byte of a
+ * master write sets the register pointer and any further bytes are stored
+ * from the pointer onwards when the map is writable. A master read, usually
+ * after a repeated start, is answered from the pointer onwards. The pointer
+ * advances with every byte on the bus and is kept between transactions, so a
+ * read without a preceding pointer write continues where the last one ended.
+ * Registers past size read as 0xFF and ignore writes.
+ *
+ * The channel stays armed until HW_I2C_Stop_Register_Map() and does not need a
+ * trigger per transaction. The map is always served on the interrupt path.
+ * registers is owned by the caller and must stay valid while the map is
+ * active; change it through HW_I2C_Update_Register_Map().
+ *
+ * @param[in] channel   External channel configured in slave mode
+ * @param[in] registers Register array
+ * @param[in] size      Number of registers (1 to HW_I2C_REGISTER_MAP_MAX_SIZE)
+ * @param[in] writable  Whether master writes are stored in the array
+ *
+ * @return HW_I2C_STATUS_OK when the map is armed
+ * @return HW_I2C_STATUS_BUSY when a slave transfer or map is already active
+ * @return HW_I2C_STATUS_NOT_CONFIGURED when the channel is not a configured slave
+ * @return HW_I2C_STATUS_INVALID_PARAM for an invalid channel, array or size
+ */
+HWI2CStatus_T HW_I2C_Start_Register_Map( HWI2CChannel_T channel, uint8_t* registers,
+                                         uint16_t size, bool writable );
+
+/**
+ * @brief Stop serving the register map and release the channel.
+ *
+ * @return HW_I2C_STATUS_OK when the map was stopped or was not active
+ * @return HW_I2C_STATUS_BUSY while a master is addressing the map
+ * @return HW_I2C_STATUS_INVALID_PARAM for an invalid channel
+ */
+HWI2CStatus_T HW_I2C_Stop_Register_Map( HWI2CChannel_T channel );
+
+/**
+ * @brief Copy new values into the active register map.
+ *
+ * The copy is made with the channel's interrupts masked and is refused while
+ * a master read is in progress, so a burst read never returns registers from
+ * two different updates.
+ *
+ * @param[in] channel        Channel serving the map
+ * @param[in] first_register Index of the first register to write
+ * @param[in] data           New register values
+ * @param[in] length         Number of registers to write
+ *
+ * @return HW_I2C_STATUS_OK when the registers were updated
+ * @return HW_I2C_STATUS_BUSY while a master read is in progress; retry later
+ * @return HW_I2C_STATUS_NOT_CONFIGURED when no map is active on the channel
+ * @return HW_I2C_STATUS_INVALID_PARAM for an invalid channel, NULL data or a
+ *         range outside the map
+ */
+HWI2CStatus_T HW_I2C_Update_Register_Map( HWI2CChannel_T channel, uint8_t first_register,
+                                          const uint8_t* data, uint16_t length );
+
 /**
  * @brief Peek at received data without consuming it.
  *
@@ -0,0 +1,220 @@
+/******************************************************************************
+ *  File:       hw_i2c_timing.c
+ *  Author:     Coen Pasitchnyj
+ *  Created:    18-Oct-2026
+ *
+ *  Description:
+ *      Implementation of the FMPI2C bus timing and transfer time calculations.
+ *
+ *  Notes:
+ *      The limits follow the FMPI2C timing section of RM0390 with DNF = 0:
+ *        (SCLDEL + 1) * tPRESC >= tr + tSU;DAT
+ *        SDADEL * tPRESC >= tf + tHD;DAT(min) - tAF(min) - 3 * tI2CCLK
+ *        SDADEL * tPRESC <= tHD;DAT(max) - tr - tAF(max) - 4 * tI2CCLK
+ *        tSCL = tSYNC1 + tSYNC2 + (SCLL + 1 + SCLH + 1) * tPRESC
+ *      with each tSYNC at least the edge time, tAF(min) and two kernel
+ *      clocks. tHD;DAT(min) is zero in all three modes.
+ *
+ *      Times are kept as nanoseconds multiplied by the kernel clock, in
+ *      which one kernel clock is HW_I2C_TIMING_NS_PER_S, so every limit is
+ *      compared exactly.
+ ******************************************************************************/
+
+/**-----------------------------------------------------------------------------
+ *  Includes
+ *------------------------------------------------------------------------------
+ */
+
+#include "hw_i2c_timing.h"
+#include <stddef.h>
+
+/**-----------------------------------------------------------------------------
+ *  Defines / Macros
+ *------------------------------------------------------------------------------
+ */
+
+#define HW_I2C_TIMING_NS_PER_S ( 1000000000LL )
+
+#define HW_I2C_TIMING_MAX_PRESC ( 15U )
+#define HW_I2C_TIMING_MAX_DELAY ( 15 )  /* SCLDEL and SDADEL */
+#define HW_I2C_TIMING_MAX_COUNT ( 256 ) /* SCLL + 1 and SCLH + 1 */
+
+#define HW_I2C_TIMING_PRESC_POS ( 28U )
+#define HW_I2C_TIMING_SCLDEL_POS ( 20U )
+#define HW_I2C_TIMING_SDADEL_POS ( 16U )
+#define HW_I2C_TIMING_SCLH_POS ( 8U )
+
+/* Start, address, acknowledge and stop around the payload of one transfer. */
+#define HW_I2C_TIMING_TRANSFER_OVERHEAD_BITS ( 11U )
+#define HW_I2C_TIMING_BITS_PER_BYTE ( 9U )
+
+/**-----------------------------------------------------------------------------
+ *  Typedefs / Enums / Structures
+ *------------------------------------------------------------------------------
+ */
+
+/* I2C-bus specification limits of one mode, in nanoseconds. */
+typedef struct HW_I2C_Timing_Mode_T
+{
+    uint32_t max_hz;
+    uint32_t low_min_ns;
+    uint32_t high_min_ns;
+    uint32_t setup_min_ns;
+    uint32_t hold_max_ns;
+} HW_I2C_Timing_Mode_T;
+
+/**-----------------------------------------------------------------------------
+ *  Private (static) Variables
+ *------------------------------------------------------------------------------
+ */
+
+static const HW_I2C_Timing_Mode_T HW_I2C_TIMING_MODES[] = {
+    { HW_I2C_TIMING_STANDARD_MODE_HZ, 4700U, 4000U, 250U, 3450U },
+    { HW_I2C_TIMING_FAST_MODE_HZ, 1300U, 600U, 100U, 900U },
+    { HW_I2C_TIMING_FAST_MODE_PLUS_HZ, 500U, 260U, 50U, 450U },
+};
+
+/**-----------------------------------------------------------------------------
+ *  Private Function Definitions
+ *------------------------------------------------------------------------------
+ */
+
+static const HW_I2C_Timing_Mode_T* HW_I2C_Timing_Mode( uint32_t scl_hz )
+{
+    for ( size_t i = 0U; i < sizeof( HW_I2C_TIMING_MODES ) / sizeof( HW_I2C_TIMING_MODES[0] );
+          i++ )
+    {
+        if ( scl_hz <= HW_I2C_TIMING_MODES[i].max_hz )
+        {
+            return &HW_I2C_TIMING_MODES[i];
+        }
+    }
+
+    return NULL;
+}
+
+static int64_t HW_I2C_Timing_Scaled( uint32_t ns, uint32_t kernel_hz )
+{
+    return ( int64_t )ns * ( int64_t )kernel_hz;
+}
+
+/** Fewest prescaled clocks that last at least duration; zero if it is not positive. */
+static int64_t HW_I2C_Timing_Count( int64_t duration, int64_t prescaled_clock )
+{
+    return duration > 0 ? ( duration + prescaled_clock - 1 ) / prescaled_clock : 0;
+}
+
+/** Both edge detection delays, without the SCLL and SCLH counts. */
+static int64_t HW_I2C_Timing_Sync( uint32_t kernel_hz, uint32_t rise_ns, uint32_t fall_ns )
+{
+    return HW_I2C_Timing_Scaled( rise_ns + fall_ns + 2U * HW_I2C_TIMING_ANALOG_FILTER_MIN_NS,
+                                 kernel_hz )
+           + 4 * HW_I2C_TIMING_NS_PER_S;
+}
+
+static bool HW_I2C_Timing_Try_Prescaler( const HW_I2C_Timing_Mode_T* mode, uint32_t kernel_hz,
+                                         uint32_t scl_hz, uint32_t rise_ns, uint32_t fall_ns,
+                                         uint8_t presc, HW_I2C_Timing_T* timing )
+{
+    const int64_t kernel_clock    = HW_I2C_TIMING_NS_PER_S;
+    const int64_t prescaled_clock = ( int64_t )( presc + 1U ) * kernel_clock;
+
+    int64_t scldel = HW_I2C_Timing_Count(
+                         HW_I2C_Timing_Scaled( rise_ns + mode->setup_min_ns, kernel_hz ),
+                         prescaled_clock )
+                     - 1;
+    scldel = scldel > 0 ? scldel : 0;
+
+    int64_t sdadel = HW_I2C_Timing_Count(
+        HW_I2C_Timing_Scaled( fall_ns, kernel_hz )
+            - HW_I2C_Timing_Scaled( HW_I2C_TIMING_ANALOG_FILTER_MIN_NS, kernel_hz )
+            - 3 * kernel_clock,
+        prescaled_clock );
+    int64_t hold_limit = HW_I2C_Timing_Scaled( mode->hold_max_ns, kernel_hz )
+                         - HW_I2C_Timing_Scaled( rise_ns + HW_I2C_TIMING_ANALOG_FILTER_MAX_NS,
+                                                 kernel_hz )
+                         - 4 * kernel_clock;
+
+    if ( ( scldel > HW_I2C_TIMING_MAX_DELAY ) || ( sdadel > HW_I2C_TIMING_MAX_DELAY )
+         || ( hold_limit < sdadel * prescaled_clock ) )
+    {
+        return false;
+    }
+
+    int64_t low    = HW_I2C_Timing_Count( HW_I2C_Timing_Scaled( mode->low_min_ns, kernel_hz ),
+                                          prescaled_clock );
+    int64_t high   = HW_I2C_Timing_Count( HW_I2C_Timing_Scaled( mode->high_min_ns, kernel_hz ),
+                                          prescaled_clock );
+    int64_t period = ( HW_I2C_TIMING_NS_PER_S * ( int64_t )kernel_hz + scl_hz - 1 ) / scl_hz;
+    int64_t counts = HW_I2C_Timing_Count(
+        period - HW_I2C_Timing_Sync( kernel_hz, rise_ns, fall_ns ), prescaled_clock );
+
+    if ( counts > low + high )
+    {
+        int64_t extra = counts - low - high;
+        low += ( extra + 1 ) / 2;
+        high += extra / 2;
+    }
+
+    if ( ( low > HW_I2C_TIMING_MAX_COUNT ) || ( high > HW_I2C_TIMING_MAX_COUNT ) )
+    {
+        return false;
+    }
+
+    timing->presc   = presc;
+    timing->scldel  = ( uint8_t )scldel;
+    timing->sdadel  = ( uint8_t )sdadel;
+    timing->sclh    = ( uint8_t )( high - 1 );
+    timing->scll    = ( uint8_t )( low - 1 );
+    timing->timingr = ( ( uint32_t )timing->presc << HW_I2C_TIMING_PRESC_POS )
+                      | ( ( uint32_t )timing->scldel << HW_I2C_TIMING_SCLDEL_POS )
+                      | ( ( uint32_t )timing->sdadel << HW_I2C_TIMING_SDADEL_POS )
+                      | ( ( uint32_t )timing->sclh << HW_I2C_TIMING_SCLH_POS )
+                      | ( uint32_t )timing->scll;
+    return true;
+}
+
+/**-----------------------------------------------------------------------------
+ *  Public Function Definitions
+ *------------------------------------------------------------------------------
+ */
+
+bool HW_I2C_Timing_Compute( uint32_t kernel_hz, uint32_t scl_hz, uint32_t rise_ns,
+                            uint32_t fall_ns, HW_I2C_Timing_T* timing )
+{
+    const HW_I2C_Timing_Mode_T* mode = HW_I2C_Timing_Mode( scl_hz );
+    if ( ( timing == NULL ) || ( kernel_hz == 0U ) || ( scl_hz == 0U ) || ( mode == NULL ) )
+    {
+        return false;
+    }
+
+    for ( uint8_t presc = 0U; presc <= HW_I2C_TIMING_MAX_PRESC; presc++ )
+    {
+        if ( HW_I2C_Timing_Try_Prescaler( mode, kernel_hz, scl_hz, rise_ns, fall_ns, presc,
+                                          timing ) )
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+uint32_t HW_I2C_Timing_Scl_Hz( uint32_t kernel_hz, uint32_t timingr, uint32_t rise_ns,
+                               uint32_t fall_ns )
+{
+    int64_t presc  = ( int64_t )( timingr >> HW_I2C_TIMING_PRESC_POS ) & 0xF;
+    int64_t counts = ( ( int64_t )( timingr >> HW_I2C_TIMING_SCLH_POS ) & 0xFF )
+                     + ( ( int64_t )timingr & 0xFF ) + 2;
+    int64_t period = counts * ( presc + 1 ) * HW_I2C_TIMING_NS_PER_S
+                     + HW_I2C_Timing_Sync( kernel_hz, rise_ns, fall_ns );
+
+    return ( uint32_t )( ( HW_I2C_TIMING_NS_PER_S * ( int64_t )kernel_hz ) / period );
+}
+
+uint32_t HW_I2C_Timing_Payload_Bytes_Per_S( uint32_t scl_hz, uint16_t payload_length )
+{
+    uint64_t bits = HW_I2C_TIMING_TRANSFER_OVERHEAD_BITS
+                    + ( uint64_t )HW_I2C_TIMING_BITS_PER_BYTE * payload_length;
+    return ( uint32_t )( ( ( uint64_t )scl_hz * payload_length ) / bits );
+}
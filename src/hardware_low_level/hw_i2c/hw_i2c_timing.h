@@ -0,0 +1,122 @@
+/******************************************************************************
+ *  File:       hw_i2c_timing.h
+ *  Author:     Coen Pasitchnyj
+ *  Created:    18-Oct-2026
+ *
+ *  Description:
+ *      FMPI2C bus timing and I2C transfer time calculations.
+ *
+ *      Computes the FMPI2C TIMINGR value for a kernel clock and SCL frequency
+ *      from the I2C-bus specification minimums of standard mode, fast mode
+ *      and fast-mode plus, and the transfer rate a bus frequency gives.
+ *
+ *  Notes:
+ *      Pure logic. The analog filter is assumed enabled and the digital
+ *      filter off, as hw_i2c.c leaves them.
+ *
+ *      The SCL period is built from SCLL and SCLH plus the time the
+ *      peripheral takes to see each edge, which includes the rise and fall
+ *      times of the bus. Those come from the board's pull-ups and bus
+ *      capacitance and must be supplied. Edges slower than assumed lengthen
+ *      the SCL period but eat into the data setup and hold margins, so give
+ *      the slowest edges the bus shows.
+ ******************************************************************************/
+
+#ifndef HW_I2C_TIMING_H
+#define HW_I2C_TIMING_H
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/**-----------------------------------------------------------------------------
+ *  Includes
+ *------------------------------------------------------------------------------
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/**-----------------------------------------------------------------------------
+ *  Public Defines / Macros
+ *------------------------------------------------------------------------------
+ */
+
+/* Highest SCL frequency of each bus mode. */
+#define HW_I2C_TIMING_STANDARD_MODE_HZ ( 100000U )
+#define HW_I2C_TIMING_FAST_MODE_HZ ( 400000U )
+#define HW_I2C_TIMING_FAST_MODE_PLUS_HZ ( 1000000U )
+
+/* Spike widths the analog filter suppresses. */
+#define HW_I2C_TIMING_ANALOG_FILTER_MIN_NS ( 50U )
+#define HW_I2C_TIMING_ANALOG_FILTER_MAX_NS ( 260U )
+
+/**-----------------------------------------------------------------------------
+ *  Public Typedefs / Enums / Structures
+ *------------------------------------------------------------------------------
+ */
+
+/**
+ * @brief Fields of an FMPI2C TIMINGR value and the register value itself.
+ */
+typedef struct HW_I2C_Timing_T
+{
+    uint8_t  presc;
+    uint8_t  scldel;
+    uint8_t  sdadel;
+    uint8_t  sclh;
+    uint8_t  scll;
+    uint32_t timingr;
+
+} HW_I2C_Timing_T;
+
+/**-----------------------------------------------------------------------------
+ *  Public Function Prototypes
+ *------------------------------------------------------------------------------
+ */
+
+/**
+ * @brief Computes the TIMINGR value for an SCL frequency.
+ *
+ * The bus mode is the slowest one that allows scl_hz. Picks the smallest
+ * prescaler for which the SCL low and high times, the data setup time and
+ * the data hold time all meet the mode's limits with the given edge times
+ * and the SCL period is not shorter than 1 / scl_hz. The low and high counts
+ * share any time beyond their minimums equally.
+ *
+ * @param kernel_hz Clock of the peripheral.
+ * @param scl_hz    SCL frequency, at most HW_I2C_TIMING_FAST_MODE_PLUS_HZ.
+ * @param rise_ns   Largest SCL and SDA rise time on the bus.
+ * @param fall_ns   Largest SCL and SDA fall time on the bus.
+ *
+ * @return false if scl_hz is zero or above fast-mode plus, or no prescaler
+ *         meets the limits, as when the data hold time cannot fit between
+ *         the rise time and the mode's maximum.
+ */
+bool HW_I2C_Timing_Compute( uint32_t kernel_hz, uint32_t scl_hz, uint32_t rise_ns,
+                            uint32_t fall_ns, HW_I2C_Timing_T* timing );
+
+/**
+ * @brief Highest SCL frequency a TIMINGR value can produce.
+ *
+ * Assumes the given edge times and the quickest edge detection.
+ */
+uint32_t HW_I2C_Timing_Scl_Hz( uint32_t kernel_hz, uint32_t timingr, uint32_t rise_ns,
+                               uint32_t fall_ns );
+
+/**
+ * @brief Payload bytes per second of back-to-back single transfers.
+ *
+ * Each transfer takes a START, the address byte, payload_length data bytes
+ * with their acknowledge bits and a STOP: 11 + 9 * payload_length SCL
+ * periods, counting START and STOP as one each. Clock stretching and the
+ * gap software leaves between transfers are not counted.
+ */
+uint32_t HW_I2C_Timing_Payload_Bytes_Per_S( uint32_t scl_hz, uint16_t payload_length );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HW_I2C_TIMING_H */
@@ -74,19 +74,36 @@ typedef struct
     volatile uint32_t TXDR;
 } FMPI2C_TypeDef;
 
+typedef struct
+{
+    volatile uint32_t MEMRMP;
+    volatile uint32_t PMC;
+    volatile uint32_t EXTICR[4];
+    uint32_t          RESERVED[2];
+    volatile uint32_t CMPCR;
+    uint32_t          RESERVED1[2];
+    volatile uint32_t CFGR;
+} SYSCFG_TypeDef;
+
 static I2C_TypeDef        hw_i2c_mock_i2c1         = { 0 };
 static I2C_TypeDef        hw_i2c_mock_i2c2         = { 0 };
 static DMA_TypeDef        hw_i2c_mock_dma1         = { 0 };
+static DMA_Stream_TypeDef hw_i2c_mock_dma1_stream0 = { 0 };
+static DMA_Stream_TypeDef hw_i2c_mock_dma1_stream1 = { 0 };
 static DMA_Stream_TypeDef hw_i2c_mock_dma1_stream2 = { 0 };
 static DMA_Stream_TypeDef hw_i2c_mock_dma1_stream7 = { 0 };
 static FMPI2C_TypeDef     hw_i2c_mock_fmpi2c1      = { 0 };
+static SYSCFG_TypeDef     hw_i2c_mock_syscfg       = { 0 };
 
 #define I2C3 ( &hw_i2c_mock_i2c1 )
 #define I2C2 ( &hw_i2c_mock_i2c2 )
 #define DMA1 ( &hw_i2c_mock_dma1 )
+#define DMA1_Stream0 ( &hw_i2c_mock_dma1_stream0 )
+#define DMA1_Stream1 ( &hw_i2c_mock_dma1_stream1 )
 #define DMA1_Stream2 ( &hw_i2c_mock_dma1_stream2 )
 #define DMA1_Stream7 ( &hw_i2c_mock_dma1_stream7 )
 #define FMPI2C1 ( &hw_i2c_mock_fmpi2c1 )
+#define SYSCFG ( &hw_i2c_mock_syscfg )
 
 typedef enum IRQn_Type
 {
@@ -98,10 +115,13 @@ typedef enum IRQn_Type
     DMA1_Stream7_IRQn,
     FMPI2C1_EV_IRQn,
     FMPI2C1_ER_IRQn,
+    DMA1_Stream0_IRQn,
+    DMA1_Stream1_IRQn,
     HW_I2C_MOCK_IRQ_COUNT,
 } IRQn_Type;
 
-static uint32_t hw_i2c_mock_nvic_enabled[HW_I2C_MOCK_IRQ_COUNT] = { 0 };
+static uint32_t hw_i2c_mock_nvic_enabled[HW_I2C_MOCK_IRQ_COUNT]  = { 0 };
+static uint32_t hw_i2c_mock_nvic_priority[HW_I2C_MOCK_IRQ_COUNT] = { 0 };
 
 static inline uint32_t NVIC_GetEnableIRQ( IRQn_Type irq )
 {
@@ -118,11 +138,21 @@ static inline void NVIC_EnableIRQ( IRQn_Type irq )
     hw_i2c_mock_nvic_enabled[irq] = 1U;
 }
 
+static inline void NVIC_SetPriority( IRQn_Type irq, uint32_t priority )
+{
+    hw_i2c_mock_nvic_priority[irq] = priority;
+}
+
 #define LL_APB1_GRP1_PERIPH_I2C3 ( 0x00000001U )
 #define LL_APB1_GRP1_PERIPH_I2C2 ( 0x00000002U )
 #define LL_APB1_GRP1_PERIPH_FMPI2C1 ( 0x00000004U )
 
+#define LL_APB2_GRP1_PERIPH_SYSCFG ( 0x00004000U )
 #define LL_APB1_GRP1_EnableClock( x ) ( ( void )( x ) )
+#define LL_APB2_GRP1_EnableClock( x ) ( ( void )( x ) )
+
+#define SYSCFG_CFGR_FMPI2C1_SCL ( 1U << 0 )
+#define SYSCFG_CFGR_FMPI2C1_SDA ( 1U << 1 )
 
 #define I2C_CR1_PE ( 1U << 0 )
 #define I2C_CR1_START ( 1U << 8 )
@@ -157,6 +187,7 @@ static inline void NVIC_EnableIRQ( IRQn_Type irq )
 #define I2C_SR1_TIMEOUT ( 1U << 14 )
 
 #define I2C_SR2_BUSY ( 1U << 1 )
+#define I2C_SR2_TRA ( 1U << 2 )
 
 #define DMA_SxCR_EN ( 1U << 0 )
 #define DMA_SxCR_DIR_0 ( 1U << 6 )
@@ -165,14 +196,26 @@ static inline void NVIC_EnableIRQ( IRQn_Type irq )
 #define DMA_SxCR_TEIE ( 1U << 2 )
 #define DMA_SxCR_CHSEL_Pos ( 25U )
 
-#define DMA_LISR_TCIF2 ( 1U << 5 )
-#define DMA_LISR_TEIF2 ( 1U << 3 )
+#define DMA_LISR_TCIF0 ( 1U << 5 )
+#define DMA_LISR_TEIF0 ( 1U << 3 )
+#define DMA_LISR_TCIF1 ( 1U << 11 )
+#define DMA_LISR_TEIF1 ( 1U << 9 )
+#define DMA_LISR_TCIF2 ( 1U << 21 )
+#define DMA_LISR_TEIF2 ( 1U << 19 )
 #define DMA_HISR_TCIF7 ( 1U << 27 )
 #define DMA_HISR_TEIF7 ( 1U << 25 )
-#define DMA_LIFCR_CTCIF2 ( 1U << 5 )
-#define DMA_LIFCR_CTEIF2 ( 1U << 3 )
-#define DMA_LIFCR_CDMEIF2 ( 1U << 2 )
-#define DMA_LIFCR_CFEIF2 ( 1U << 1 )
+#define DMA_LIFCR_CTCIF0 ( 1U << 5 )
+#define DMA_LIFCR_CTEIF0 ( 1U << 3 )
+#define DMA_LIFCR_CDMEIF0 ( 1U << 2 )
+#define DMA_LIFCR_CFEIF0 ( 1U << 0 )
+#define DMA_LIFCR_CTCIF1 ( 1U << 11 )
+#define DMA_LIFCR_CTEIF1 ( 1U << 9 )
+#define DMA_LIFCR_CDMEIF1 ( 1U << 8 )
+#define DMA_LIFCR_CFEIF1 ( 1U << 6 )
+#define DMA_LIFCR_CTCIF2 ( 1U << 21 )
+#define DMA_LIFCR_CTEIF2 ( 1U << 19 )
+#define DMA_LIFCR_CDMEIF2 ( 1U << 18 )
+#define DMA_LIFCR_CFEIF2 ( 1U << 16 )
 #define DMA_HIFCR_CTCIF7 ( 1U << 27 )
 #define DMA_HIFCR_CTEIF7 ( 1U << 25 )
 #define DMA_HIFCR_CDMEIF7 ( 1U << 24 )
@@ -185,6 +228,8 @@ static inline void NVIC_EnableIRQ( IRQn_Type irq )
 #define FMPI2C_CR1_STOPIE ( 1U << 5 )
 #define FMPI2C_CR1_TCIE ( 1U << 6 )
 #define FMPI2C_CR1_ERRIE ( 1U << 7 )
+#define FMPI2C_CR1_TXDMAEN ( 1U << 14 )
+#define FMPI2C_CR1_RXDMAEN ( 1U << 15 )
 
 #define FMPI2C_CR2_START ( 1U << 13 )
 #define FMPI2C_CR2_STOP ( 1U << 14 )
@@ -444,6 +489,21 @@ static inline void LL_FMPI2C_EnableIT_RX( FMPI2C_TypeDef* fmpi2c_instance )
     fmpi2c_instance->CR1 |= FMPI2C_CR1_RXIE;
 }
 
+static inline void LL_FMPI2C_DisableIT_RX( FMPI2C_TypeDef* fmpi2c_instance )
+{
+    fmpi2c_instance->CR1 &= ~FMPI2C_CR1_RXIE;
+}
+
+static inline void LL_FMPI2C_EnableDMAReq_RX( FMPI2C_TypeDef* fmpi2c_instance )
+{
+    fmpi2c_instance->CR1 |= FMPI2C_CR1_RXDMAEN;
+}
+
+static inline void LL_FMPI2C_DisableDMAReq_RX( FMPI2C_TypeDef* fmpi2c_instance )
+{
+    fmpi2c_instance->CR1 &= ~FMPI2C_CR1_RXDMAEN;
+}
+
 static inline void LL_FMPI2C_EnableIT_NACK( FMPI2C_TypeDef* fmpi2c_instance )
 {
     fmpi2c_instance->CR1 |= FMPI2C_CR1_NACKIE;
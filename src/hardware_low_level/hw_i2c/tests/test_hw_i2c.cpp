@@ -30,10 +30,14 @@ class HWI2CTest : public ::testing::Test
         std::memset( &hw_i2c_mock_i2c1, 0, sizeof( hw_i2c_mock_i2c1 ) );
         std::memset( &hw_i2c_mock_i2c2, 0, sizeof( hw_i2c_mock_i2c2 ) );
         std::memset( &hw_i2c_mock_dma1, 0, sizeof( hw_i2c_mock_dma1 ) );
+        std::memset( &hw_i2c_mock_dma1_stream0, 0, sizeof( hw_i2c_mock_dma1_stream0 ) );
+        std::memset( &hw_i2c_mock_dma1_stream1, 0, sizeof( hw_i2c_mock_dma1_stream1 ) );
         std::memset( &hw_i2c_mock_dma1_stream2, 0, sizeof( hw_i2c_mock_dma1_stream2 ) );
         std::memset( &hw_i2c_mock_dma1_stream7, 0, sizeof( hw_i2c_mock_dma1_stream7 ) );
         std::memset( &hw_i2c_mock_fmpi2c1, 0, sizeof( hw_i2c_mock_fmpi2c1 ) );
+        std::memset( &hw_i2c_mock_syscfg, 0, sizeof( hw_i2c_mock_syscfg ) );
         std::memset( hw_i2c_mock_nvic_enabled, 0, sizeof( hw_i2c_mock_nvic_enabled ) );
+        std::memset( hw_i2c_mock_nvic_priority, 0, sizeof( hw_i2c_mock_nvic_priority ) );
     }
 
     static void ConfigureExternal( HWI2CChannel_T channel, HWI2CMode_T mode,
@@ -50,6 +54,12 @@ class HWI2CTest : public ::testing::Test
         ASSERT_EQ( HW_I2C_Configure_Channel( channel, &config ), HW_I2C_STATUS_OK );
     }
 
+    /* The value one past path; applied to the last path it gives an invalid one. */
+    static HWI2CTransferPath_T TransferPathAfter( HWI2CTransferPath_T path )
+    {
+        return static_cast<HWI2CTransferPath_T>( static_cast<int>( path ) + 1 );
+    }
+
     static void StageAndPublish( HWI2CChannelState_T& state, HWI2CTransferKind_T kind,
                                  uint16_t address, const uint8_t* data, uint16_t length )
     {
@@ -62,6 +72,85 @@ class HWI2CTest : public ::testing::Test
         }
         ASSERT_TRUE( HW_I2C_Publish_Received_Message( &state ) );
     }
+
+    /* Drive one I2C3 event interrupt and return the interrupt count for tallying. */
+    static uint32_t SlaveEvent( uint32_t sr1, uint32_t sr2 = 0U )
+    {
+        I2C3->SR1 = sr1;
+        I2C3->SR2 = sr2;
+        HW_I2C_EV_IRQ_CHANNEL_1();
+        return 1U;
+    }
+
+    /* Master writes to I2C3: address, then each byte; repeated start or STOP follows. */
+    static uint32_t MasterWrite( const uint8_t* data, uint16_t length, bool stop )
+    {
+        uint32_t interrupts = SlaveEvent( I2C_SR1_ADDR );
+        for ( uint16_t index = 0U; index < length; ++index )
+        {
+            I2C3->DR = data[index];
+            interrupts += SlaveEvent( I2C_SR1_RXNE );
+        }
+        if ( stop )
+        {
+            interrupts += SlaveEvent( I2C_SR1_STOPF );
+        }
+        return interrupts;
+    }
+
+    /* Master reads length bytes from I2C3, NACKs the last one and sends STOP. The peripheral
+     * asks for one byte beyond the last, which is still in DR when the NACK arrives. */
+    static uint32_t MasterRead( uint8_t* data, uint16_t length )
+    {
+        uint32_t interrupts = SlaveEvent( I2C_SR1_ADDR | I2C_SR1_TXE, I2C_SR2_TRA );
+        data[0]             = static_cast<uint8_t>( I2C3->DR );
+        for ( uint16_t index = 1U; index < length; ++index )
+        {
+            interrupts += SlaveEvent( I2C_SR1_TXE, I2C_SR2_TRA );
+            data[index] = static_cast<uint8_t>( I2C3->DR );
+        }
+        interrupts += SlaveEvent( I2C_SR1_TXE, I2C_SR2_TRA );
+        interrupts += SlaveEvent( I2C_SR1_AF );
+        interrupts += SlaveEvent( I2C_SR1_STOPF );
+        return interrupts;
+    }
+
+    /* Drive one I2C3 event interrupt of a master transfer with the bus busy. */
+    static uint32_t MasterEvent( uint32_t sr1, uint8_t data = 0U )
+    {
+        I2C3->DR = data;
+        return SlaveEvent( sr1, I2C_SR2_BUSY );
+    }
+
+    /* Six-byte interrupt-path master read on I2C3 from its SB: RXNE down to three bytes
+     * remaining, then the two BTF tail steps. */
+    static uint32_t MasterReadSixBytes( uint8_t first_byte )
+    {
+        uint32_t interrupts = MasterEvent( I2C_SR1_SB );
+        interrupts += MasterEvent( I2C_SR1_ADDR );
+        for ( uint8_t index = 0U; index < 3U; ++index )
+        {
+            interrupts += MasterEvent( I2C_SR1_RXNE, static_cast<uint8_t>( first_byte + index ) );
+        }
+        interrupts += MasterEvent( I2C_SR1_BTF, static_cast<uint8_t>( first_byte + 3U ) );
+        interrupts += MasterEvent( I2C_SR1_BTF, static_cast<uint8_t>( first_byte + 4U ) );
+        return interrupts;
+    }
+
+    /* Register layout of a common 6-axis IMU. */
+    static constexpr uint8_t IMU_ACCEL_XOUT_H = 0x3BU;
+    static constexpr uint8_t IMU_GYRO_CONFIG  = 0x1BU;
+    static constexpr uint8_t IMU_PWR_MGMT_1   = 0x6BU;
+    static constexpr uint8_t IMU_WHO_AM_I     = 0x75U;
+    static constexpr uint8_t IMU_BURST_LENGTH = 14U; /* Accel XYZ, temperature, gyro XYZ */
+
+    static void FillImuSample( std::array<uint8_t, 128U>& registers, uint8_t seed )
+    {
+        for ( uint8_t index = 0U; index < IMU_BURST_LENGTH; ++index )
+        {
+            registers[IMU_ACCEL_XOUT_H + index] = static_cast<uint8_t>( seed + index );
+        }
+    }
 };
 
 TEST_F( HWI2CTest, ConfigureRejectsInvalidChannelAndAddress )
@@ -731,3 +820,696 @@ TEST_F( HWI2CTest, WrappedRxStorageRetainsOneMessageBoundary )
     EXPECT_EQ( message.second.data[0], 3U );
     EXPECT_EQ( message.second.data[1], 4U );
 }
+
+TEST_F( HWI2CTest, RegisterMapServesImuBurstReadAfterPointerWrite )
+{
+    ConfigureExternal( HW_I2C_CHANNEL_1, HW_I2C_MODE_SLAVE );
+    std::array<uint8_t, 128U> registers{};
+    registers[IMU_WHO_AM_I] = 0x68U;
+    FillImuSample( registers, 0x40U );
+    ASSERT_EQ(
+        HW_I2C_Start_Register_Map( HW_I2C_CHANNEL_1, registers.data(), registers.size(), false ),
+        HW_I2C_STATUS_OK );
+    EXPECT_NE( I2C3->CR2 & I2C_CR2_ITEVTEN, 0U );
+    EXPECT_NE( I2C3->CR2 & I2C_CR2_ITBUFEN, 0U );
+    EXPECT_NE( I2C3->CR1 & I2C_CR1_ACK, 0U );
+
+    uint8_t who_am_i = 0U;
+    MasterWrite( &IMU_WHO_AM_I, 1U, false );
+    MasterRead( &who_am_i, 1U );
+    EXPECT_EQ( who_am_i, 0x68U );
+
+    std::array<uint8_t, IMU_BURST_LENGTH> sample{};
+    uint32_t interrupts = MasterWrite( &IMU_ACCEL_XOUT_H, 1U, false );
+    interrupts += MasterRead( sample.data(), sample.size() );
+    for ( uint8_t index = 0U; index < IMU_BURST_LENGTH; ++index )
+    {
+        EXPECT_EQ( sample[index], 0x40U + index );
+    }
+
+    /* Two for the pointer write; the first byte of the read is loaded with ADDR. */
+    EXPECT_EQ( interrupts, 2U + IMU_BURST_LENGTH + 3U );
+    EXPECT_EQ( hw_i2c_channel_state[HW_I2C_CHANNEL_1].register_pointer,
+               IMU_ACCEL_XOUT_H + IMU_BURST_LENGTH );
+    EXPECT_EQ( HW_I2C_Get_And_Clear_Transfer_Result( HW_I2C_CHANNEL_1 ), HW_I2C_STATUS_OK );
+}
+
+TEST_F( HWI2CTest, RegisterMapReadWithoutPointerWriteContinuesAfterLastByteSent )
+{
+    ConfigureExternal( HW_I2C_CHANNEL_1, HW_I2C_MODE_SLAVE );
+    std::array<uint8_t, 128U> registers{};
+    FillImuSample( registers, 0x10U );
+    ASSERT_EQ(
+        HW_I2C_Start_Register_Map( HW_I2C_CHANNEL_1, registers.data(), registers.size(), false ),
+        HW_I2C_STATUS_OK );
+
+    std::array<uint8_t, 6U> accel{};
+    std::array<uint8_t, 2U> temperature{};
+    MasterWrite( &IMU_ACCEL_XOUT_H, 1U, true );
+    MasterRead( accel.data(), accel.size() );
+    MasterRead( temperature.data(), temperature.size() );
+
+    EXPECT_EQ( accel[0], 0x10U );
+    EXPECT_EQ( accel[5], 0x15U );
+    EXPECT_EQ( temperature[0], 0x16U );
+    EXPECT_EQ( temperature[1], 0x17U );
+}
+
+TEST_F( HWI2CTest, RegisterMapStoresMasterWritesOnlyWhenWritableAndInRange )
+{
+    ConfigureExternal( HW_I2C_CHANNEL_1, HW_I2C_MODE_SLAVE );
+    std::array<uint8_t, 128U> registers{};
+    registers[IMU_PWR_MGMT_1] = 0x40U;
+    ASSERT_EQ(
+        HW_I2C_Start_Register_Map( HW_I2C_CHANNEL_1, registers.data(), registers.size(), true ),
+        HW_I2C_STATUS_OK );
+
+    const uint8_t wake[]        = { IMU_PWR_MGMT_1, 0x01U };
+    const uint8_t gyro_config[] = { IMU_GYRO_CONFIG, 0x18U, 0x10U };
+    MasterWrite( wake, sizeof( wake ), true );
+    MasterWrite( gyro_config, sizeof( gyro_config ), true );
+    EXPECT_EQ( registers[IMU_PWR_MGMT_1], 0x01U );
+    EXPECT_EQ( registers[IMU_GYRO_CONFIG], 0x18U );
+    EXPECT_EQ( registers[IMU_GYRO_CONFIG + 1U], 0x10U );
+
+    /* Registers past the map ignore writes and read as 0xFF. */
+    const uint8_t past_end[] = { 0x7FU, 0x22U, 0x33U };
+    MasterWrite( past_end, sizeof( past_end ), true );
+    EXPECT_EQ( registers[0x7FU], 0x22U );
+    uint8_t beyond[2] = {};
+    MasterWrite( past_end, 1U, false );
+    MasterRead( beyond, sizeof( beyond ) );
+    EXPECT_EQ( beyond[0], 0x22U );
+    EXPECT_EQ( beyond[1], 0xFFU );
+
+    ASSERT_EQ( HW_I2C_Stop_Register_Map( HW_I2C_CHANNEL_1 ), HW_I2C_STATUS_OK );
+    ASSERT_EQ(
+        HW_I2C_Start_Register_Map( HW_I2C_CHANNEL_1, registers.data(), registers.size(), false ),
+        HW_I2C_STATUS_OK );
+    MasterWrite( wake, sizeof( wake ), true );
+    EXPECT_EQ( registers[IMU_PWR_MGMT_1], 0x01U );
+    MasterWrite( &wake[0], 1U, false );
+    uint8_t read_only = 0U;
+    MasterRead( &read_only, 1U );
+    EXPECT_EQ( read_only, 0x01U );
+}
+
+TEST_F( HWI2CTest, RegisterMapUpdateIsRefusedDuringReadBurst )
+{
+    ConfigureExternal( HW_I2C_CHANNEL_1, HW_I2C_MODE_SLAVE );
+    std::array<uint8_t, 128U> registers{};
+    FillImuSample( registers, 0x00U );
+    ASSERT_EQ(
+        HW_I2C_Start_Register_Map( HW_I2C_CHANNEL_1, registers.data(), registers.size(), false ),
+        HW_I2C_STATUS_OK );
+
+    std::array<uint8_t, IMU_BURST_LENGTH> next_sample{};
+    next_sample.fill( 0xA5U );
+
+    MasterWrite( &IMU_ACCEL_XOUT_H, 1U, false );
+    SlaveEvent( I2C_SR1_ADDR | I2C_SR1_TXE, I2C_SR2_TRA );
+    EXPECT_EQ( HW_I2C_Update_Register_Map( HW_I2C_CHANNEL_1, IMU_ACCEL_XOUT_H, next_sample.data(),
+                                           next_sample.size() ),
+               HW_I2C_STATUS_BUSY );
+    EXPECT_EQ( HW_I2C_Stop_Register_Map( HW_I2C_CHANNEL_1 ), HW_I2C_STATUS_BUSY );
+    SlaveEvent( I2C_SR1_TXE, I2C_SR2_TRA );
+    SlaveEvent( I2C_SR1_AF );
+    SlaveEvent( I2C_SR1_STOPF );
+    EXPECT_EQ( registers[IMU_ACCEL_XOUT_H], 0x00U );
+
+    EXPECT_EQ( HW_I2C_Update_Register_Map( HW_I2C_CHANNEL_1, IMU_ACCEL_XOUT_H, next_sample.data(),
+                                           next_sample.size() ),
+               HW_I2C_STATUS_OK );
+    std::array<uint8_t, IMU_BURST_LENGTH> sample{};
+    MasterWrite( &IMU_ACCEL_XOUT_H, 1U, false );
+    MasterRead( sample.data(), sample.size() );
+    EXPECT_EQ( sample, next_sample );
+
+    EXPECT_EQ( HW_I2C_Update_Register_Map( HW_I2C_CHANNEL_1, 0x7FU, next_sample.data(), 2U ),
+               HW_I2C_STATUS_INVALID_PARAM );
+}
+
+TEST_F( HWI2CTest, RegisterMapBusErrorEndsTransactionButStaysArmed )
+{
+    ConfigureExternal( HW_I2C_CHANNEL_1, HW_I2C_MODE_SLAVE );
+    std::array<uint8_t, 128U> registers{};
+    registers[IMU_WHO_AM_I] = 0x68U;
+    ASSERT_EQ(
+        HW_I2C_Start_Register_Map( HW_I2C_CHANNEL_1, registers.data(), registers.size(), false ),
+        HW_I2C_STATUS_OK );
+
+    MasterWrite( &IMU_WHO_AM_I, 1U, false );
+    SlaveEvent( I2C_SR1_BERR );
+    EXPECT_EQ( I2C3->SR1 & I2C_SR1_BERR, 0U );
+    EXPECT_EQ( HW_I2C_Get_And_Clear_Transfer_Result( HW_I2C_CHANNEL_1 ), HW_I2C_STATUS_ERROR );
+    EXPECT_NE( I2C3->CR2 & I2C_CR2_ITEVTEN, 0U );
+
+    uint8_t who_am_i = 0U;
+    MasterWrite( &IMU_WHO_AM_I, 1U, false );
+    MasterRead( &who_am_i, 1U );
+    EXPECT_EQ( who_am_i, 0x68U );
+}
+
+TEST_F( HWI2CTest, RegisterMapValidatesChannelAndExcludesTriggeredSlaveTransfers )
+{
+    std::array<uint8_t, HW_I2C_REGISTER_MAP_MAX_SIZE + 1U> registers{};
+
+    EXPECT_EQ( HW_I2C_Start_Register_Map( HW_I2C_CHANNEL_1, registers.data(), 16U, false ),
+               HW_I2C_STATUS_NOT_CONFIGURED );
+    ConfigureExternal( HW_I2C_CHANNEL_2, HW_I2C_MODE_MASTER );
+    EXPECT_EQ( HW_I2C_Start_Register_Map( HW_I2C_CHANNEL_2, registers.data(), 16U, false ),
+               HW_I2C_STATUS_NOT_CONFIGURED );
+    EXPECT_EQ( HW_I2C_Start_Register_Map( HW_I2C_CHANNEL_FMPI2C1, registers.data(), 16U, false ),
+               HW_I2C_STATUS_INVALID_PARAM );
+
+    ConfigureExternal( HW_I2C_CHANNEL_1, HW_I2C_MODE_SLAVE );
+    EXPECT_EQ( HW_I2C_Start_Register_Map( HW_I2C_CHANNEL_1, nullptr, 16U, false ),
+               HW_I2C_STATUS_INVALID_PARAM );
+    EXPECT_EQ( HW_I2C_Start_Register_Map( HW_I2C_CHANNEL_1, registers.data(), 0U, false ),
+               HW_I2C_STATUS_INVALID_PARAM );
+    EXPECT_EQ( HW_I2C_Start_Register_Map( HW_I2C_CHANNEL_1, registers.data(),
+                                          HW_I2C_REGISTER_MAP_MAX_SIZE + 1U, false ),
+               HW_I2C_STATUS_INVALID_PARAM );
+    EXPECT_EQ( HW_I2C_Update_Register_Map( HW_I2C_CHANNEL_1, 0U, registers.data(), 1U ),
+               HW_I2C_STATUS_NOT_CONFIGURED );
+
+    ASSERT_EQ( HW_I2C_Start_Register_Map( HW_I2C_CHANNEL_1, registers.data(),
+                                          HW_I2C_REGISTER_MAP_MAX_SIZE, false ),
+               HW_I2C_STATUS_OK );
+    EXPECT_EQ( HW_I2C_Start_Register_Map( HW_I2C_CHANNEL_1, registers.data(), 16U, false ),
+               HW_I2C_STATUS_BUSY );
+    EXPECT_FALSE( HW_I2C_Trigger_Slave_Transmit_External( HW_I2C_CHANNEL_1 ) );
+    EXPECT_FALSE( HW_I2C_Trigger_Slave_Receive_External( HW_I2C_CHANNEL_1, 4U ) );
+
+    ASSERT_EQ( HW_I2C_Stop_Register_Map( HW_I2C_CHANNEL_1 ), HW_I2C_STATUS_OK );
+    EXPECT_EQ( I2C3->CR2 & I2C_CR2_ITEVTEN, 0U );
+    EXPECT_TRUE( HW_I2C_Trigger_Slave_Receive_External( HW_I2C_CHANNEL_1, 4U ) );
+}
+
+TEST_F( HWI2CTest, WriteReadUsesRepeatedStartAndPublishesOneMessage )
+{
+    ConfigureExternal( HW_I2C_CHANNEL_1, HW_I2C_MODE_MASTER );
+    HWI2CChannelState_T& state = hw_i2c_channel_state[HW_I2C_CHANNEL_1];
+    ASSERT_EQ( HW_I2C_Enqueue_Master_Write_Read( HW_I2C_CHANNEL_1, 0x68U, &IMU_ACCEL_XOUT_H, 1U,
+                                                 6U ),
+               HW_I2C_STATUS_OK );
+    EXPECT_NE( I2C3->CR1 & I2C_CR1_START, 0U );
+    EXPECT_EQ( state.transfer_kind, HW_I2C_TRANSFER_KIND_MASTER_TX );
+
+    MasterEvent( I2C_SR1_SB );
+    EXPECT_EQ( I2C3->DR, 0xD0U );
+    MasterEvent( I2C_SR1_ADDR );
+    MasterEvent( I2C_SR1_TXE );
+    EXPECT_EQ( I2C3->DR, IMU_ACCEL_XOUT_H );
+
+    /* With the register address in the shift register, the repeated start is requested at
+     * once; BUF stays off until SB so TXE does not re-enter the interrupt. */
+    I2C3->CR1 &= ~I2C_CR1_START;
+    MasterEvent( I2C_SR1_TXE );
+    EXPECT_NE( I2C3->CR1 & I2C_CR1_START, 0U );
+    EXPECT_EQ( I2C3->CR1 & I2C_CR1_STOP, 0U );
+    EXPECT_NE( I2C3->CR1 & I2C_CR1_ACK, 0U );
+    EXPECT_EQ( I2C3->CR2 & I2C_CR2_ITBUFEN, 0U );
+    EXPECT_EQ( state.transfer_kind, HW_I2C_TRANSFER_KIND_MASTER_RX );
+
+    MasterEvent( I2C_SR1_TXE | I2C_SR1_BTF );
+    EXPECT_EQ( state.rx_received_length, 0U );
+    EXPECT_EQ( I2C3->CR1 & I2C_CR1_STOP, 0U );
+
+    MasterReadSixBytes( 0xA0U );
+    EXPECT_EQ( state.rx_received_length, 6U );
+    EXPECT_NE( I2C3->CR1 & I2C_CR1_STOP, 0U );
+
+    I2C3->SR2 = 0U;
+    HW_I2C_Service_Transaction_Queue( HW_I2C_CHANNEL_1 );
+    EXPECT_EQ( state.master_queue_count, 0U );
+    HWI2CRxMessagePeek_T message{};
+    ASSERT_TRUE( HW_I2C_Peek_Received_Message( HW_I2C_CHANNEL_1, &message ) );
+    EXPECT_EQ( message.descriptor.transfer_kind, HW_I2C_TRANSFER_KIND_MASTER_WRITE_READ );
+    EXPECT_EQ( message.descriptor.target_address_7bit, 0x68U );
+    EXPECT_EQ( message.descriptor.length, 6U );
+    EXPECT_EQ( message.first.data[0], 0xA0U );
+    EXPECT_EQ( HW_I2C_Get_And_Clear_Transfer_Result( HW_I2C_CHANNEL_1 ), HW_I2C_STATUS_OK );
+}
+
+TEST_F( HWI2CTest, WriteReadNeedsFewerInterruptsAndQueueServicesThanSeparateRequests )
+{
+    ConfigureExternal( HW_I2C_CHANNEL_1, HW_I2C_MODE_MASTER );
+    HWI2CChannelState_T& state = hw_i2c_channel_state[HW_I2C_CHANNEL_1];
+
+    /* Separate write and read: the read only starts once a queue service has retired the
+     * write after its STOP. The write's TXE with nothing left re-enters at least once. */
+    ASSERT_EQ( HW_I2C_Enqueue_Master_Transmit( HW_I2C_CHANNEL_1, 0x68U, &IMU_ACCEL_XOUT_H, 1U ),
+               HW_I2C_STATUS_OK );
+    ASSERT_EQ( HW_I2C_Enqueue_Master_Receive( HW_I2C_CHANNEL_1, 0x68U, 6U ), HW_I2C_STATUS_OK );
+    uint32_t separate_interrupts = MasterEvent( I2C_SR1_SB ) + MasterEvent( I2C_SR1_ADDR )
+                                   + MasterEvent( I2C_SR1_TXE ) + MasterEvent( I2C_SR1_TXE )
+                                   + MasterEvent( I2C_SR1_TXE | I2C_SR1_BTF );
+    I2C3->SR2 = 0U;
+    HW_I2C_Service_Transaction_Queue( HW_I2C_CHANNEL_1 );
+    ASSERT_EQ( state.transfer_kind, HW_I2C_TRANSFER_KIND_MASTER_RX );
+    separate_interrupts += MasterReadSixBytes( 0x10U );
+    I2C3->SR2 = 0U;
+    HW_I2C_Service_Transaction_Queue( HW_I2C_CHANNEL_1 );
+    ASSERT_TRUE( HW_I2C_Consume_Received_Message( HW_I2C_CHANNEL_1 ) );
+
+    ASSERT_EQ( HW_I2C_Enqueue_Master_Write_Read( HW_I2C_CHANNEL_1, 0x68U, &IMU_ACCEL_XOUT_H, 1U,
+                                                 6U ),
+               HW_I2C_STATUS_OK );
+    uint32_t combined_interrupts = MasterEvent( I2C_SR1_SB ) + MasterEvent( I2C_SR1_ADDR )
+                                   + MasterEvent( I2C_SR1_TXE ) + MasterEvent( I2C_SR1_TXE );
+    combined_interrupts += MasterReadSixBytes( 0x10U );
+    I2C3->SR2 = 0U;
+    HW_I2C_Service_Transaction_Queue( HW_I2C_CHANNEL_1 );
+
+    EXPECT_EQ( separate_interrupts, 12U );
+    EXPECT_EQ( combined_interrupts, 11U );
+    EXPECT_TRUE( HW_I2C_Is_Transaction_Queue_Complete( HW_I2C_CHANNEL_1 ) );
+    HWI2CRxMessagePeek_T message{};
+    ASSERT_TRUE( HW_I2C_Peek_Received_Message( HW_I2C_CHANNEL_1, &message ) );
+    EXPECT_EQ( message.descriptor.length, 6U );
+}
+
+TEST_F( HWI2CTest, DmaWriteReadRestartsFromBtfAndReadsByDma )
+{
+    ConfigureExternal( HW_I2C_CHANNEL_2, HW_I2C_MODE_MASTER, HW_I2C_TRANSFER_DMA,
+                       HW_I2C_TRANSFER_DMA );
+    HWI2CChannelState_T& state            = hw_i2c_channel_state[HW_I2C_CHANNEL_2];
+    const uint8_t        register_address = 0x10U;
+    ASSERT_EQ(
+        HW_I2C_Enqueue_Master_Write_Read( HW_I2C_CHANNEL_2, 0x50U, &register_address, 1U, 8U ),
+        HW_I2C_STATUS_OK );
+    EXPECT_NE( DMA1_Stream7->CR & DMA_SxCR_EN, 0U );
+
+    I2C2->CR1 &= ~I2C_CR1_START;
+    I2C2->SR1  = I2C_SR1_BTF;
+    DMA1->HISR = DMA_HISR_TCIF7;
+    HW_I2C_DMA_TX_IRQ_CHANNEL_2();
+    EXPECT_NE( I2C2->CR1 & I2C_CR1_START, 0U );
+    EXPECT_EQ( I2C2->CR1 & I2C_CR1_STOP, 0U );
+    EXPECT_EQ( DMA1_Stream7->CR & DMA_SxCR_EN, 0U );
+    EXPECT_NE( DMA1_Stream2->CR & DMA_SxCR_EN, 0U );
+    EXPECT_EQ( DMA1_Stream2->NDTR, 8U );
+    EXPECT_EQ( I2C2->CR2 & I2C_CR2_DMAEN, 0U );
+
+    I2C2->SR1 = I2C_SR1_SB;
+    HW_I2C_EV_IRQ_CHANNEL_2();
+    EXPECT_EQ( I2C2->DR, 0xA1U );
+    EXPECT_NE( I2C2->CR2 & I2C_CR2_DMAEN, 0U );
+    EXPECT_NE( I2C2->CR2 & I2C_CR2_LAST, 0U );
+
+    I2C2->SR1 = I2C_SR1_ADDR;
+    HW_I2C_EV_IRQ_CHANNEL_2();
+    DMA1->LISR = DMA_LISR_TCIF2;
+    HW_I2C_DMA_RX_IRQ_CHANNEL_2();
+    EXPECT_NE( I2C2->CR1 & I2C_CR1_STOP, 0U );
+
+    I2C2->SR1 = 0U;
+    I2C2->SR2 = 0U;
+    HW_I2C_Service_Transaction_Queue( HW_I2C_CHANNEL_2 );
+    HWI2CRxMessagePeek_T message{};
+    ASSERT_TRUE( HW_I2C_Peek_Received_Message( HW_I2C_CHANNEL_2, &message ) );
+    EXPECT_EQ( message.descriptor.transfer_kind, HW_I2C_TRANSFER_KIND_MASTER_WRITE_READ );
+    EXPECT_EQ( message.descriptor.length, 8U );
+    EXPECT_EQ( state.master_queue_count, 0U );
+}
+
+TEST_F( HWI2CTest, FmpiWriteReadTurnsTransferCompleteIntoRepeatedStartRead )
+{
+    ASSERT_EQ( HW_I2C_Configure_Internal_FMPI2C1( 0x33U ), HW_I2C_STATUS_OK );
+    const uint8_t register_address = 0x0FU;
+    ASSERT_EQ( HW_I2C_Enqueue_Master_Write_Read( HW_I2C_CHANNEL_FMPI2C1, 0x1EU, &register_address,
+                                                 1U, 2U ),
+               HW_I2C_STATUS_OK );
+    EXPECT_EQ( FMPI2C1->CR2 & ( FMPI2C_CR2_AUTOEND | FMPI2C_CR2_RD_WRN ), 0U );
+    EXPECT_EQ( FMPI2C1->CR2 >> FMPI2C_CR2_NBYTES_Pos, 1U );
+
+    FMPI2C1->ISR = FMPI2C_ISR_TXIS | FMPI2C_ISR_BUSY;
+    HW_I2C_EV_IRQ_FMPI2C1();
+    EXPECT_EQ( FMPI2C1->TXDR, register_address );
+
+    FMPI2C1->ISR = FMPI2C_ISR_TC | FMPI2C_ISR_BUSY;
+    HW_I2C_EV_IRQ_FMPI2C1();
+    EXPECT_EQ( FMPI2C1->CR2,
+               ( 0x1EU << 1U ) | ( 2U << FMPI2C_CR2_NBYTES_Pos ) | FMPI2C_CR2_RD_WRN
+                   | FMPI2C_CR2_START | FMPI2C_CR2_AUTOEND );
+
+    for ( uint8_t index = 0U; index < 2U; ++index )
+    {
+        FMPI2C1->RXDR = 0x40U + index;
+        FMPI2C1->ISR  = FMPI2C_ISR_RXNE | FMPI2C_ISR_BUSY;
+        HW_I2C_EV_IRQ_FMPI2C1();
+    }
+    FMPI2C1->ISR = FMPI2C_ISR_STOPF;
+    HW_I2C_EV_IRQ_FMPI2C1();
+    FMPI2C1->ISR = 0U;
+    HW_I2C_Service_Transaction_Queue( HW_I2C_CHANNEL_FMPI2C1 );
+
+    HWI2CRxMessagePeek_T message{};
+    ASSERT_TRUE( HW_I2C_Peek_Received_Message( HW_I2C_CHANNEL_FMPI2C1, &message ) );
+    EXPECT_EQ( message.descriptor.transfer_kind, HW_I2C_TRANSFER_KIND_MASTER_WRITE_READ );
+    EXPECT_EQ( message.descriptor.target_address_7bit, 0x1EU );
+    EXPECT_EQ( message.descriptor.length, 2U );
+    EXPECT_EQ( message.first.data[1], 0x41U );
+}
+
+TEST_F( HWI2CTest, WriteReadValidatesRequestAndReservesReceiveCapacity )
+{
+    const uint8_t register_address = 0x00U;
+    EXPECT_EQ( HW_I2C_Enqueue_Master_Write_Read( HW_I2C_CHANNEL_1, 0x20U, &register_address, 1U,
+                                                 1U ),
+               HW_I2C_STATUS_NOT_CONFIGURED );
+
+    ConfigureExternal( HW_I2C_CHANNEL_1, HW_I2C_MODE_MASTER );
+    EXPECT_EQ( HW_I2C_Enqueue_Master_Write_Read( HW_I2C_CHANNEL_1, 0x20U, nullptr, 1U, 1U ),
+               HW_I2C_STATUS_INVALID_PARAM );
+    EXPECT_EQ( HW_I2C_Enqueue_Master_Write_Read( HW_I2C_CHANNEL_1, 0x20U, &register_address, 0U,
+                                                 1U ),
+               HW_I2C_STATUS_INVALID_PARAM );
+    EXPECT_EQ( HW_I2C_Enqueue_Master_Write_Read( HW_I2C_CHANNEL_1, 0x20U, &register_address, 1U,
+                                                 0U ),
+               HW_I2C_STATUS_INVALID_PARAM );
+    EXPECT_EQ( HW_I2C_Enqueue_Master_Write_Read( HW_I2C_CHANNEL_1, 0x80U, &register_address, 1U,
+                                                 1U ),
+               HW_I2C_STATUS_INVALID_PARAM );
+    EXPECT_EQ( HW_I2C_Enqueue_Master_Write_Read( HW_I2C_CHANNEL_FMPI2C1, 0x20U, &register_address,
+                                                 1U, 256U ),
+               HW_I2C_STATUS_INVALID_PARAM );
+
+    I2C3->SR2 = I2C_SR2_BUSY;
+    ASSERT_EQ( HW_I2C_Enqueue_Master_Write_Read( HW_I2C_CHANNEL_1, 0x20U, &register_address, 1U,
+                                                 500U ),
+               HW_I2C_STATUS_OK );
+    EXPECT_EQ( HW_I2C_Enqueue_Master_Receive( HW_I2C_CHANNEL_1, 0x21U, 13U ), HW_I2C_STATUS_BUSY );
+    EXPECT_EQ( HW_I2C_Enqueue_Master_Write_Read( HW_I2C_CHANNEL_1, 0x21U, &register_address, 1U,
+                                                 13U ),
+               HW_I2C_STATUS_BUSY );
+    EXPECT_EQ( HW_I2C_Enqueue_Master_Write_Read( HW_I2C_CHANNEL_1, 0x21U, &register_address, 1U,
+                                                 12U ),
+               HW_I2C_STATUS_OK );
+    EXPECT_EQ( hw_i2c_channel_state[HW_I2C_CHANNEL_1].master_queue_count, 2U );
+}
+
+TEST_F( HWI2CTest, I2c3ReceivesByDmaOnlyAndRejectsTransmitDma )
+{
+    const HWI2CChannelConfig_T tx_dma = {
+        .mode             = HW_I2C_MODE_MASTER,
+        .speed            = HW_I2C_SPEED_400KHZ,
+        .tx_transfer_path = HW_I2C_TRANSFER_DMA,
+        .rx_transfer_path = HW_I2C_TRANSFER_INTERRUPT,
+        .own_address_7bit = 0x12U,
+    };
+    EXPECT_EQ( HW_I2C_Configure_Channel( HW_I2C_CHANNEL_1, &tx_dma ), HW_I2C_STATUS_INVALID_PARAM );
+
+    ConfigureExternal( HW_I2C_CHANNEL_1, HW_I2C_MODE_MASTER, HW_I2C_TRANSFER_INTERRUPT,
+                       HW_I2C_TRANSFER_DMA );
+    EXPECT_EQ( hw_i2c_mock_nvic_enabled[DMA1_Stream1_IRQn], 1U );
+    EXPECT_EQ( hw_i2c_mock_nvic_priority[DMA1_Stream1_IRQn], 5U );
+    EXPECT_EQ( hw_i2c_mock_nvic_enabled[DMA1_Stream2_IRQn], 0U );
+
+    ASSERT_EQ( HW_I2C_Enqueue_Master_Receive( HW_I2C_CHANNEL_1, 0x20U, 16U ), HW_I2C_STATUS_OK );
+    EXPECT_EQ( DMA1_Stream1->CR & ( DMA_SxCR_EN | ( 7U << DMA_SxCR_CHSEL_Pos ) ),
+               DMA_SxCR_EN | ( 1U << DMA_SxCR_CHSEL_Pos ) );
+    EXPECT_EQ( DMA1_Stream1->PAR,
+               static_cast<uint32_t>( reinterpret_cast<uintptr_t>( &I2C3->DR ) ) );
+    EXPECT_EQ( DMA1_Stream1->NDTR, 16U );
+    EXPECT_NE( I2C3->CR2 & I2C_CR2_DMAEN, 0U );
+    EXPECT_EQ( I2C3->CR2 & I2C_CR2_ITBUFEN, 0U );
+    EXPECT_EQ( DMA1_Stream2->CR & DMA_SxCR_EN, 0U );
+}
+
+TEST_F( HWI2CTest, I2c3DmaReceiveTakesThreeInterruptsInsteadOfOnePerByte )
+{
+    /* Interrupt path: SB, ADDR, RXNE down to three bytes left, then the two BTF tail steps. */
+    ConfigureExternal( HW_I2C_CHANNEL_1, HW_I2C_MODE_MASTER );
+    ASSERT_EQ( HW_I2C_Enqueue_Master_Receive( HW_I2C_CHANNEL_1, 0x68U, 16U ), HW_I2C_STATUS_OK );
+    uint32_t interrupt_path = MasterEvent( I2C_SR1_SB ) + MasterEvent( I2C_SR1_ADDR );
+    for ( uint8_t index = 0U; index < 13U; ++index )
+    {
+        interrupt_path += MasterEvent( I2C_SR1_RXNE, index );
+    }
+    interrupt_path += MasterEvent( I2C_SR1_BTF, 13U ) + MasterEvent( I2C_SR1_BTF, 14U );
+    I2C3->SR2 = 0U;
+    HW_I2C_Service_Transaction_Queue( HW_I2C_CHANNEL_1 );
+    HWI2CRxMessagePeek_T message{};
+    ASSERT_TRUE( HW_I2C_Peek_Received_Message( HW_I2C_CHANNEL_1, &message ) );
+    ASSERT_EQ( message.descriptor.length, 16U );
+
+    /* DMA path: SB, ADDR and the stream's transfer complete, which NACKs and requests STOP. */
+    ConfigureExternal( HW_I2C_CHANNEL_1, HW_I2C_MODE_MASTER, HW_I2C_TRANSFER_INTERRUPT,
+                       HW_I2C_TRANSFER_DMA );
+    ASSERT_EQ( HW_I2C_Enqueue_Master_Receive( HW_I2C_CHANNEL_1, 0x68U, 16U ), HW_I2C_STATUS_OK );
+    uint32_t dma_path = MasterEvent( I2C_SR1_SB ) + MasterEvent( I2C_SR1_ADDR );
+    DMA1->LISR = DMA_LISR_TCIF1;
+    HW_I2C_DMA_RX_IRQ_CHANNEL_1();
+    dma_path++;
+    EXPECT_EQ( DMA1->LIFCR & DMA_LIFCR_CTCIF1, DMA_LIFCR_CTCIF1 );
+    EXPECT_NE( I2C3->CR1 & I2C_CR1_STOP, 0U );
+    EXPECT_EQ( I2C3->CR2 & ( I2C_CR2_DMAEN | I2C_CR2_LAST ), 0U );
+    I2C3->SR1 = 0U;
+    I2C3->SR2 = 0U;
+    HW_I2C_Service_Transaction_Queue( HW_I2C_CHANNEL_1 );
+    ASSERT_TRUE( HW_I2C_Peek_Received_Message( HW_I2C_CHANNEL_1, &message ) );
+    EXPECT_EQ( message.descriptor.length, 16U );
+
+    EXPECT_EQ( interrupt_path, 17U );
+    EXPECT_EQ( dma_path, 3U );
+}
+
+TEST_F( HWI2CTest, FmpiRxPathSelectionValidatesStateAndEnablesStreamInterrupt )
+{
+    EXPECT_EQ( HW_I2C_Set_Internal_FMPI2C1_Rx_Path( HW_I2C_TRANSFER_DMA ),
+               HW_I2C_STATUS_NOT_CONFIGURED );
+    ASSERT_EQ( HW_I2C_Configure_Internal_FMPI2C1( 0x33U ), HW_I2C_STATUS_OK );
+    EXPECT_EQ( HW_I2C_Set_Internal_FMPI2C1_Rx_Path( TransferPathAfter( HW_I2C_TRANSFER_DMA ) ),
+               HW_I2C_STATUS_INVALID_PARAM );
+
+    ASSERT_EQ( HW_I2C_Enqueue_Master_Receive( HW_I2C_CHANNEL_FMPI2C1, 0x20U, 4U ),
+               HW_I2C_STATUS_OK );
+    EXPECT_EQ( HW_I2C_Set_Internal_FMPI2C1_Rx_Path( HW_I2C_TRANSFER_DMA ), HW_I2C_STATUS_BUSY );
+    EXPECT_NE( FMPI2C1->CR1 & FMPI2C_CR1_RXIE, 0U );
+    EXPECT_EQ( FMPI2C1->CR1 & FMPI2C_CR1_RXDMAEN, 0U );
+
+    ASSERT_EQ( HW_I2C_Recover_Channel( HW_I2C_CHANNEL_FMPI2C1 ), HW_I2C_STATUS_ERROR );
+    EXPECT_EQ( HW_I2C_Set_Internal_FMPI2C1_Rx_Path( HW_I2C_TRANSFER_DMA ), HW_I2C_STATUS_OK );
+    EXPECT_EQ( hw_i2c_mock_nvic_enabled[DMA1_Stream0_IRQn], 1U );
+    EXPECT_EQ( hw_i2c_mock_nvic_priority[DMA1_Stream0_IRQn], 5U );
+}
+
+TEST_F( HWI2CTest, FmpiDmaReceiveEndsAtAutoendStopWithoutByteInterrupts )
+{
+    ASSERT_EQ( HW_I2C_Configure_Internal_FMPI2C1( 0x33U ), HW_I2C_STATUS_OK );
+    HWI2CChannelState_T& state = hw_i2c_channel_state[HW_I2C_CHANNEL_FMPI2C1];
+
+    /* Interrupt path: one RXNE per byte and the AUTOEND STOPF. */
+    ASSERT_EQ( HW_I2C_Enqueue_Master_Receive( HW_I2C_CHANNEL_FMPI2C1, 0x20U, 16U ),
+               HW_I2C_STATUS_OK );
+    uint32_t interrupt_path = 0U;
+    for ( uint8_t index = 0U; index < 16U; ++index )
+    {
+        FMPI2C1->RXDR = index;
+        FMPI2C1->ISR  = FMPI2C_ISR_RXNE | FMPI2C_ISR_BUSY;
+        HW_I2C_EV_IRQ_FMPI2C1();
+        interrupt_path++;
+    }
+    FMPI2C1->ISR = FMPI2C_ISR_STOPF;
+    HW_I2C_EV_IRQ_FMPI2C1();
+    interrupt_path++;
+    FMPI2C1->ISR = 0U;
+    HW_I2C_Service_Transaction_Queue( HW_I2C_CHANNEL_FMPI2C1 );
+    ASSERT_TRUE( HW_I2C_Consume_Received_Message( HW_I2C_CHANNEL_FMPI2C1 ) );
+
+    /* DMA path: the stream's transfer complete and the STOPF. */
+    ASSERT_EQ( HW_I2C_Set_Internal_FMPI2C1_Rx_Path( HW_I2C_TRANSFER_DMA ), HW_I2C_STATUS_OK );
+    ASSERT_EQ( HW_I2C_Enqueue_Master_Receive( HW_I2C_CHANNEL_FMPI2C1, 0x20U, 16U ),
+               HW_I2C_STATUS_OK );
+    EXPECT_EQ( DMA1_Stream0->CR & ( DMA_SxCR_EN | ( 7U << DMA_SxCR_CHSEL_Pos ) ),
+               DMA_SxCR_EN | ( 7U << DMA_SxCR_CHSEL_Pos ) );
+    EXPECT_EQ( DMA1_Stream0->PAR,
+               static_cast<uint32_t>( reinterpret_cast<uintptr_t>( &FMPI2C1->RXDR ) ) );
+    EXPECT_EQ( DMA1_Stream0->NDTR, 16U );
+    EXPECT_NE( FMPI2C1->CR1 & FMPI2C_CR1_RXDMAEN, 0U );
+    EXPECT_EQ( FMPI2C1->CR1 & FMPI2C_CR1_RXIE, 0U );
+    EXPECT_NE( FMPI2C1->CR2 & FMPI2C_CR2_AUTOEND, 0U );
+
+    uint32_t dma_path  = 0U;
+    DMA1_Stream0->NDTR = 0U;
+    DMA1->LISR         = DMA_LISR_TCIF0;
+    HW_I2C_DMA_RX_IRQ_FMPI2C1();
+    dma_path++;
+    EXPECT_TRUE( state.dma_rx_transfer_complete );
+    EXPECT_EQ( DMA1_Stream0->CR & DMA_SxCR_EN, 0U );
+    EXPECT_EQ( FMPI2C1->CR1 & FMPI2C_CR1_RXDMAEN, 0U );
+
+    /* RXNE seen alongside STOPF belongs to the stream and is left alone. */
+    FMPI2C1->RXDR = 0xEEU;
+    FMPI2C1->ISR  = FMPI2C_ISR_STOPF | FMPI2C_ISR_RXNE;
+    HW_I2C_EV_IRQ_FMPI2C1();
+    dma_path++;
+    FMPI2C1->ISR = 0U;
+    HW_I2C_Service_Transaction_Queue( HW_I2C_CHANNEL_FMPI2C1 );
+    HWI2CRxMessagePeek_T message{};
+    ASSERT_TRUE( HW_I2C_Peek_Received_Message( HW_I2C_CHANNEL_FMPI2C1, &message ) );
+    EXPECT_EQ( message.descriptor.length, 16U );
+    EXPECT_NE( FMPI2C1->CR1 & FMPI2C_CR1_RXIE, 0U );
+
+    EXPECT_EQ( interrupt_path, 17U );
+    EXPECT_EQ( dma_path, 2U );
+}
+
+TEST_F( HWI2CTest, FmpiDmaStopBeforeStreamCompletionTakesLengthFromStream )
+{
+    ASSERT_EQ( HW_I2C_Configure_Internal_FMPI2C1( 0x33U ), HW_I2C_STATUS_OK );
+    ASSERT_EQ( HW_I2C_Set_Internal_FMPI2C1_Rx_Path( HW_I2C_TRANSFER_DMA ), HW_I2C_STATUS_OK );
+    const uint8_t register_address = 0x0FU;
+    ASSERT_EQ( HW_I2C_Enqueue_Master_Write_Read( HW_I2C_CHANNEL_FMPI2C1, 0x1EU, &register_address,
+                                                 1U, 6U ),
+               HW_I2C_STATUS_OK );
+    EXPECT_EQ( DMA1_Stream0->CR & DMA_SxCR_EN, 0U );
+
+    FMPI2C1->ISR = FMPI2C_ISR_TXIS | FMPI2C_ISR_BUSY;
+    HW_I2C_EV_IRQ_FMPI2C1();
+    FMPI2C1->ISR = FMPI2C_ISR_TC | FMPI2C_ISR_BUSY;
+    HW_I2C_EV_IRQ_FMPI2C1();
+    EXPECT_NE( DMA1_Stream0->CR & DMA_SxCR_EN, 0U );
+    EXPECT_EQ( DMA1_Stream0->NDTR, 6U );
+    EXPECT_NE( FMPI2C1->CR2 & FMPI2C_CR2_RD_WRN, 0U );
+
+    DMA1_Stream0->NDTR = 0U;
+    FMPI2C1->ISR       = FMPI2C_ISR_STOPF;
+    HW_I2C_EV_IRQ_FMPI2C1();
+    FMPI2C1->ISR = 0U;
+    HW_I2C_Service_Transaction_Queue( HW_I2C_CHANNEL_FMPI2C1 );
+
+    HWI2CRxMessagePeek_T message{};
+    ASSERT_TRUE( HW_I2C_Peek_Received_Message( HW_I2C_CHANNEL_FMPI2C1, &message ) );
+    EXPECT_EQ( message.descriptor.transfer_kind, HW_I2C_TRANSFER_KIND_MASTER_WRITE_READ );
+    EXPECT_EQ( message.descriptor.length, 6U );
+    EXPECT_EQ( DMA1_Stream0->CR & DMA_SxCR_EN, 0U );
+}
+
+TEST_F( HWI2CTest, FmpiTimingMeetsBusLimitsAtEachSpeed )
+{
+    struct BusMode
+    {
+        uint32_t hz;
+        double   low_min_ns, high_min_ns, setup_min_ns, hold_max_ns;
+    };
+    const std::array<BusMode, 3> modes = { {
+        { 100000U, 4700.0, 4000.0, 250.0, 3450.0 },
+        { 400000U, 1300.0, 600.0, 100.0, 900.0 },
+        { 1000000U, 500.0, 260.0, 50.0, 450.0 },
+    } };
+    const std::array<uint32_t, 2> kernels  = { { 45000000U, 180000000U } };
+    const double                  rise_ns  = 100.0;
+    const double                  fall_ns  = 20.0;
+    const double                  slack_ns = 1e-6; /* Limits met exactly, in floating point */
+
+    for ( uint32_t kernel_hz : kernels )
+    {
+        const double clock_ns = 1e9 / kernel_hz;
+        for ( const BusMode& mode : modes )
+        {
+            HW_I2C_Timing_T timing = {};
+            ASSERT_TRUE( HW_I2C_Timing_Compute( kernel_hz, mode.hz, 100U, 20U, &timing ) )
+                << kernel_hz << " Hz kernel, " << mode.hz << " Hz bus";
+            const double presc_ns = ( timing.presc + 1U ) * clock_ns;
+            const double period_ns =
+                ( timing.scll + timing.sclh + 2U ) * presc_ns + rise_ns + fall_ns + 100.0
+                + 4.0 * clock_ns;
+
+            EXPECT_EQ( timing.timingr,
+                       ( static_cast<uint32_t>( timing.presc ) << 28 )
+                           | ( static_cast<uint32_t>( timing.scldel ) << 20 )
+                           | ( static_cast<uint32_t>( timing.sdadel ) << 16 )
+                           | ( static_cast<uint32_t>( timing.sclh ) << 8 ) | timing.scll );
+            EXPECT_GE( ( timing.scll + 1U ) * presc_ns + slack_ns, mode.low_min_ns );
+            EXPECT_GE( ( timing.sclh + 1U ) * presc_ns + slack_ns, mode.high_min_ns );
+            EXPECT_GE( ( timing.scldel + 1U ) * presc_ns + slack_ns, rise_ns + mode.setup_min_ns );
+            EXPECT_GE( timing.sdadel * presc_ns + slack_ns, fall_ns - 50.0 - 3.0 * clock_ns );
+            EXPECT_LE( timing.sdadel * presc_ns,
+                       mode.hold_max_ns - rise_ns - 260.0 - 4.0 * clock_ns + slack_ns );
+            EXPECT_GE( period_ns + slack_ns, 1e9 / mode.hz );
+            EXPECT_LE( HW_I2C_Timing_Scl_Hz( kernel_hz, timing.timingr, 100U, 20U ), mode.hz );
+            EXPECT_GT( HW_I2C_Timing_Scl_Hz( kernel_hz, timing.timingr, 100U, 20U ),
+                       mode.hz * 9U / 10U );
+        }
+    }
+}
+
+TEST_F( HWI2CTest, FmpiTimingRejectsSpeedsTheBusCannotMeet )
+{
+    HW_I2C_Timing_T timing = {};
+    EXPECT_FALSE( HW_I2C_Timing_Compute( 45000000U, 0U, 100U, 20U, &timing ) );
+    EXPECT_FALSE( HW_I2C_Timing_Compute( 45000000U, 1000001U, 100U, 20U, &timing ) );
+    EXPECT_FALSE( HW_I2C_Timing_Compute( 45000000U, 1000000U, 100U, 20U, nullptr ) );
+
+    /* With 120 ns edges the 450 ns hold limit leaves no room after the analog filter. */
+    EXPECT_FALSE( HW_I2C_Timing_Compute( 45000000U, 1000000U, 120U, 120U, &timing ) );
+    EXPECT_TRUE( HW_I2C_Timing_Compute( 45000000U, 400000U, 120U, 120U, &timing ) );
+
+    /* At 16 MHz four kernel clocks alone exceed the fast-mode plus hold margin. */
+    EXPECT_FALSE( HW_I2C_Timing_Compute( 16000000U, 1000000U, 100U, 20U, &timing ) );
+}
+
+TEST_F( HWI2CTest, PayloadRateCountsAddressAcknowledgeStartAndStop )
+{
+    /* 16 bytes: 11 + 9 * 16 = 155 SCL periods per transfer */
+    EXPECT_EQ( HW_I2C_Timing_Payload_Bytes_Per_S( 100000U, 16U ), 10322U );
+    EXPECT_EQ( HW_I2C_Timing_Payload_Bytes_Per_S( 400000U, 16U ), 41290U );
+    EXPECT_EQ( HW_I2C_Timing_Payload_Bytes_Per_S( 1000000U, 16U ), 103225U );
+    EXPECT_EQ( HW_I2C_Timing_Payload_Bytes_Per_S( 1000000U, 1U ), 50000U );
+    EXPECT_EQ( HW_I2C_Timing_Payload_Bytes_Per_S( 1000000U, 0U ), 0U );
+}
+
+TEST_F( HWI2CTest, FmpiSpeedSelectionRecomputesTimingAndSetsPinDrive )
+{
+    const uint32_t  drive    = SYSCFG_CFGR_FMPI2C1_SCL | SYSCFG_CFGR_FMPI2C1_SDA;
+    HW_I2C_Timing_T standard = {};
+    HW_I2C_Timing_T plus     = {};
+    ASSERT_TRUE( HW_I2C_Timing_Compute( HW_I2C_APB1_HZ, 100000U, HW_I2C_FMPI2C1_RISE_NS,
+                                        HW_I2C_FMPI2C1_FALL_NS, &standard ) );
+    ASSERT_TRUE( HW_I2C_Timing_Compute( HW_I2C_APB1_HZ, 1000000U, HW_I2C_FMPI2C1_RISE_NS,
+                                        HW_I2C_FMPI2C1_FALL_NS, &plus ) );
+    EXPECT_EQ( plus.timingr, 0x00600B16U );
+
+    EXPECT_EQ( HW_I2C_Set_Internal_FMPI2C1_Speed( HW_I2C_SPEED_1MHZ ),
+               HW_I2C_STATUS_NOT_CONFIGURED );
+    ASSERT_EQ( HW_I2C_Configure_Internal_FMPI2C1( 0x33U ), HW_I2C_STATUS_OK );
+    EXPECT_EQ( FMPI2C1->TIMINGR, standard.timingr );
+    EXPECT_EQ( SYSCFG->CFGR & drive, 0U );
+    EXPECT_EQ( HW_I2C_Set_Internal_FMPI2C1_Speed( static_cast<HWI2CSpeed_T>( 3 ) ),
+               HW_I2C_STATUS_INVALID_PARAM );
+
+    ASSERT_EQ( HW_I2C_Enqueue_Master_Receive( HW_I2C_CHANNEL_FMPI2C1, 0x20U, 4U ),
+               HW_I2C_STATUS_OK );
+    EXPECT_EQ( HW_I2C_Set_Internal_FMPI2C1_Speed( HW_I2C_SPEED_1MHZ ), HW_I2C_STATUS_BUSY );
+    EXPECT_EQ( FMPI2C1->TIMINGR, standard.timingr );
+
+    ASSERT_EQ( HW_I2C_Recover_Channel( HW_I2C_CHANNEL_FMPI2C1 ), HW_I2C_STATUS_ERROR );
+    ASSERT_EQ( HW_I2C_Set_Internal_FMPI2C1_Speed( HW_I2C_SPEED_1MHZ ), HW_I2C_STATUS_OK );
+    EXPECT_EQ( FMPI2C1->TIMINGR, plus.timingr );
+    EXPECT_EQ( SYSCFG->CFGR & drive, drive );
+    EXPECT_NE( FMPI2C1->CR1 & FMPI2C_CR1_PE, 0U );
+
+    FMPI2C1->TIMINGR = 0U;
+    ASSERT_EQ( HW_I2C_Recover_Channel( HW_I2C_CHANNEL_FMPI2C1 ), HW_I2C_STATUS_ERROR );
+    EXPECT_EQ( FMPI2C1->TIMINGR, plus.timingr );
+
+    ASSERT_EQ( HW_I2C_Set_Internal_FMPI2C1_Speed( HW_I2C_SPEED_100KHZ ), HW_I2C_STATUS_OK );
+    EXPECT_EQ( FMPI2C1->TIMINGR, standard.timingr );
+    EXPECT_EQ( SYSCFG->CFGR & drive, 0U );
+}
+
+TEST_F( HWI2CTest, ExternalChannelsRejectFastModePlus )
+{
+    const HWI2CChannelConfig_T config = {
+        .mode             = HW_I2C_MODE_MASTER,
+        .speed            = HW_I2C_SPEED_1MHZ,
+        .tx_transfer_path = HW_I2C_TRANSFER_INTERRUPT,
+        .rx_transfer_path = HW_I2C_TRANSFER_INTERRUPT,
+        .own_address_7bit = 0x12U,
+    };
+    EXPECT_EQ( HW_I2C_Configure_Channel( HW_I2C_CHANNEL_1, &config ), HW_I2C_STATUS_INVALID_PARAM );
+    EXPECT_EQ( HW_I2C_Configure_Channel( HW_I2C_CHANNEL_2, &config ), HW_I2C_STATUS_INVALID_PARAM );
+}
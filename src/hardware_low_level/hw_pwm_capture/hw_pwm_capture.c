@@ -16,6 +16,7 @@
  *      - Start and stop the associated timer capture path
  *      - Map logical PWM capture channels to timer CCR registers
  *      - Expose new capture availability through hardware capture flags
+ *      - Timestamp every edge into a ring in edge capture mode
  *
  *      Non-Responsibilities:
  *      - Interpreting captured values
@@ -27,6 +28,14 @@
  *      - Timer PWM input mode is configured in the IOC
  *      - Timer capture is stopped before analogue mode changes
  *      - The execution layer consumes capture results before clearing flags
+ *
+ *      Edge capture mode:
+ *      - The slave reset mode is turned off so the counter runs free, and the
+ *        period and high-time captures become rising and falling edge
+ *        timestamps of the same input
+ *      - Each capture interrupt moves its timestamp into the channel's ring.
+ *        All DMA1 streams carrying the TIM2 and TIM5 CC1/CC2 requests belong
+ *        to USART2, SPI2 and I2C2, so the captures are not moved by DMA
  ******************************************************************************/
 
 /**-----------------------------------------------------------------------------
@@ -75,6 +84,9 @@
 #define HW_PWM_CAPTURE_CH_1_PERIOD_CCR CCR1
 #define HW_PWM_CAPTURE_CH_1_HIGH_CCR CCR2
 #define HW_PWM_CAPTURE_CH_1_PERIOD_FLAG TIM_SR_CC1IF
+#define HW_PWM_CAPTURE_CH_1_HIGH_FLAG TIM_SR_CC2IF
+#define HW_PWM_CAPTURE_CH_1_IRQN TIM2_IRQn
+#define HW_PWM_CAPTURE_CH_1_IRQ TIM2_IRQHandler
 
 /*
  * PWM capture channel 2 timer mapping.
@@ -88,6 +100,27 @@
 #define HW_PWM_CAPTURE_CH_2_PERIOD_CCR CCR2
 #define HW_PWM_CAPTURE_CH_2_HIGH_CCR CCR1
 #define HW_PWM_CAPTURE_CH_2_PERIOD_FLAG TIM_SR_CC2IF
+#define HW_PWM_CAPTURE_CH_2_HIGH_FLAG TIM_SR_CC1IF
+#define HW_PWM_CAPTURE_CH_2_IRQN TIM5_IRQn
+#define HW_PWM_CAPTURE_CH_2_IRQ TIM5_IRQHandler
+
+/*
+ * Both channels capture on CC1 and CC2. Their interrupt enables sit at the
+ * same bit positions in DIER as the flags in SR, and each overcapture flag
+ * sits eight bits above its capture flag.
+ */
+#define HW_PWM_CAPTURE_EDGE_FLAGS ( TIM_SR_CC1IF | TIM_SR_CC2IF )
+#define HW_PWM_CAPTURE_OVERCAPTURE_FLAGS ( TIM_SR_CC1OF | TIM_SR_CC2OF )
+#define HW_PWM_CAPTURE_EDGE_IRQ_ENABLES ( TIM_DIER_CC1IE | TIM_DIER_CC2IE )
+
+/* TIM2 and TIM5 have no vector in the IOC, so edge capture sets the priority itself. It is
+ * the FreeRTOS syscall ceiling shared by the other peripheral interrupts. */
+#define HW_PWM_CAPTURE_EDGE_IRQ_PRIORITY 5U
+
+/* Slave mode the IOC selects for PWM input: a rising edge resets the counter. */
+#define HW_PWM_CAPTURE_SLAVE_MODE_RESET TIM_SMCR_SMS_2
+
+#define HW_PWM_CAPTURE_EDGE_RING_MASK ( HW_PWM_CAPTURE_EDGE_RING_SIZE - 1U )
 
 /*
  * PWM capture timers run at full timer resolution.
@@ -120,11 +153,23 @@ typedef struct
 
     uint32_t period_capture_flag;  // SR flag bit corresponding to a new period capture event for
                                    // this channel
+    uint32_t  high_capture_flag;   // SR flag bit of the high-time (falling edge) capture
+    IRQn_Type irq;                 // Capture interrupt used in edge capture mode
 
     uint32_t timer_clock_hz;
 
     HwPWMCaptureConfig_T config;
     bool                 is_configured;
+
+    /*
+     * Edge ring. edge_head is written only by the capture interrupt and
+     * edge_tail only by the consumer; both run freely and are masked on use.
+     */
+    HwPWMCaptureEdge_T edges[HW_PWM_CAPTURE_EDGE_RING_SIZE];
+    volatile uint16_t  edge_head;
+    volatile uint16_t  edge_tail;
+    volatile uint32_t  lost_edges;
+    bool               edge_gap_pending;
 } HwPWMCaptureChannelContext_T;
 
 /**-----------------------------------------------------------------------------
@@ -150,6 +195,8 @@ static HwPWMCaptureChannelContext_T hw_pwm_capture_channels[PWM_CAPTURE_CHANNEL_
         .period_ccr          = &HW_PWM_CAPTURE_CH_1_INSTANCE->HW_PWM_CAPTURE_CH_1_PERIOD_CCR,
         .high_ccr            = &HW_PWM_CAPTURE_CH_1_INSTANCE->HW_PWM_CAPTURE_CH_1_HIGH_CCR,
         .period_capture_flag = HW_PWM_CAPTURE_CH_1_PERIOD_FLAG,
+        .high_capture_flag   = HW_PWM_CAPTURE_CH_1_HIGH_FLAG,
+        .irq                 = HW_PWM_CAPTURE_CH_1_IRQN,
         .is_configured       = false,
     },
     {
@@ -158,6 +205,8 @@ static HwPWMCaptureChannelContext_T hw_pwm_capture_channels[PWM_CAPTURE_CHANNEL_
         .period_ccr          = &HW_PWM_CAPTURE_CH_2_INSTANCE->HW_PWM_CAPTURE_CH_2_PERIOD_CCR,
         .high_ccr            = &HW_PWM_CAPTURE_CH_2_INSTANCE->HW_PWM_CAPTURE_CH_2_HIGH_CCR,
         .period_capture_flag = HW_PWM_CAPTURE_CH_2_PERIOD_FLAG,
+        .high_capture_flag   = HW_PWM_CAPTURE_CH_2_HIGH_FLAG,
+        .irq                 = HW_PWM_CAPTURE_CH_2_IRQN,
         .is_configured       = false,
     },
 };
@@ -167,6 +216,9 @@ static HwPWMCaptureChannelContext_T hw_pwm_capture_channels[PWM_CAPTURE_CHANNEL_
  *------------------------------------------------------------------------------
  */
 
+void HW_PWM_CAPTURE_CH_1_IRQ( void );
+void HW_PWM_CAPTURE_CH_2_IRQ( void );
+
 /**-----------------------------------------------------------------------------
  *  Private Function Definitions
  *------------------------------------------------------------------------------
@@ -241,6 +293,101 @@ static bool HW_PWM_Capture_Configuration_Is_Valid( const HwPWMCaptureConfig_T* c
             return false;
     }
 }
+
+/**
+ * @brief Stop edge capture interrupts and return the timer to PWM input mode.
+ *
+ * Restores the counter reset on the rising edge so CCRs hold period and high
+ * time again, and empties the ring. Called with the timer stopped.
+ */
+static void HW_PWM_Capture_Stop_Edge_Capture( HwPWMCaptureChannelContext_T* context )
+{
+    NVIC_DisableIRQ( context->irq );
+    context->timer->DIER &= ~HW_PWM_CAPTURE_EDGE_IRQ_ENABLES;
+    context->timer->SMCR =
+        ( context->timer->SMCR & ~TIM_SMCR_SMS ) | HW_PWM_CAPTURE_SLAVE_MODE_RESET;
+
+    context->edge_head        = 0U;
+    context->edge_tail        = 0U;
+    context->lost_edges       = 0U;
+    context->edge_gap_pending = false;
+}
+
+/**
+ * @brief Switch a started timer to free-running edge capture.
+ */
+static void HW_PWM_Capture_Start_Edge_Capture( HwPWMCaptureChannelContext_T* context )
+{
+    context->timer->SMCR &= ~TIM_SMCR_SMS;
+    context->timer->SR = ~( HW_PWM_CAPTURE_EDGE_FLAGS | HW_PWM_CAPTURE_OVERCAPTURE_FLAGS );
+    context->timer->DIER |= HW_PWM_CAPTURE_EDGE_IRQ_ENABLES;
+    NVIC_SetPriority( context->irq, HW_PWM_CAPTURE_EDGE_IRQ_PRIORITY );
+    NVIC_EnableIRQ( context->irq );
+}
+
+/**
+ * @brief Append one edge to the ring, or count it lost when the ring is full.
+ */
+static void HW_PWM_Capture_Store_Edge( HwPWMCaptureChannelContext_T* context,
+                                       uint32_t timestamp_ticks, bool rising )
+{
+    uint16_t head = context->edge_head;
+
+    if ( ( uint16_t )( head - context->edge_tail ) >= HW_PWM_CAPTURE_EDGE_RING_SIZE )
+    {
+        context->lost_edges++;
+        context->edge_gap_pending = true;
+        return;
+    }
+
+    HwPWMCaptureEdge_T* edge = &context->edges[head & HW_PWM_CAPTURE_EDGE_RING_MASK];
+    edge->timestamp_ticks    = timestamp_ticks;
+    edge->rising             = rising;
+    edge->follows_gap        = context->edge_gap_pending;
+
+    context->edge_gap_pending = false;
+    context->edge_head        = ( uint16_t )( head + 1U );
+}
+
+/**
+ * @brief Capture interrupt service for a channel in edge capture mode.
+ *
+ * Reading a CCR clears its capture flag. When interrupt latency lets both
+ * edges capture before service, the two are stored in timestamp order.
+ */
+static void HW_PWM_Capture_Service_Edge_IRQ( HwPWMCaptureChannelContext_T* context )
+{
+    uint32_t status = context->timer->SR;
+
+    if ( ( status & HW_PWM_CAPTURE_OVERCAPTURE_FLAGS ) != 0U )
+    {
+        context->timer->SR = ~( status & HW_PWM_CAPTURE_OVERCAPTURE_FLAGS );
+        context->lost_edges++;
+        context->edge_gap_pending = true;
+    }
+
+    bool     rising_seen   = ( status & context->period_capture_flag ) != 0U;
+    bool     falling_seen  = ( status & context->high_capture_flag ) != 0U;
+    uint32_t rising_ticks  = rising_seen ? *context->period_ccr : 0U;
+    uint32_t falling_ticks = falling_seen ? *context->high_ccr : 0U;
+
+    if ( rising_seen && falling_seen && ( int32_t )( falling_ticks - rising_ticks ) < 0 )
+    {
+        HW_PWM_Capture_Store_Edge( context, falling_ticks, false );
+        falling_seen = false;
+    }
+
+    if ( rising_seen )
+    {
+        HW_PWM_Capture_Store_Edge( context, rising_ticks, true );
+    }
+
+    if ( falling_seen )
+    {
+        HW_PWM_Capture_Store_Edge( context, falling_ticks, false );
+    }
+}
+
 /**-----------------------------------------------------------------------------
  *  Public Function Definitions
  *------------------------------------------------------------------------------
@@ -266,6 +413,7 @@ bool HW_PWM_Capture_Configure_Channel( HwPWMCaptureChannel_T       channel,
     // Stop the timer to ensure safe configuration of hardware and to prevent unintended captures
     // during reconfiguration
     HW_TIMER_Stop_Timer( context->timer_role );
+    HW_PWM_Capture_Stop_Edge_Capture( context );
 
     if ( !config->is_enabled )
     {
@@ -290,6 +438,11 @@ bool HW_PWM_Capture_Configure_Channel( HwPWMCaptureChannel_T       channel,
 
     HW_TIMER_Start_Timer( context->timer_role );
 
+    if ( config->capture_edges )
+    {
+        HW_PWM_Capture_Start_Edge_Capture( context );
+    }
+
     context->timer_clock_hz = HW_TIMER_Get_Clock_Hz( context->timer_role );
     context->config         = *config;
     context->is_configured  = true;
@@ -349,3 +502,55 @@ uint32_t HW_PWM_Capture_Get_Timer_Clock_Hz( HwPWMCaptureChannel_T channel )
 
     return hw_pwm_capture_channels[channel].timer_clock_hz;
 }
+
+uint16_t HW_PWM_Capture_Peek_Edges( HwPWMCaptureChannel_T      channel,
+                                    const HwPWMCaptureEdge_T** edges )
+{
+    if ( channel >= PWM_CAPTURE_CHANNEL_COUNT )
+    {
+        *edges = NULL;
+        return 0U;
+    }
+
+    HwPWMCaptureChannelContext_T* context = &hw_pwm_capture_channels[channel];
+    uint16_t                      tail    = context->edge_tail;
+    uint16_t                      count   = ( uint16_t )( context->edge_head - tail );
+    uint16_t                      to_wrap =
+        ( uint16_t )( HW_PWM_CAPTURE_EDGE_RING_SIZE - ( tail & HW_PWM_CAPTURE_EDGE_RING_MASK ) );
+
+    *edges = &context->edges[tail & HW_PWM_CAPTURE_EDGE_RING_MASK];
+
+    return count < to_wrap ? count : to_wrap;
+}
+
+void HW_PWM_Capture_Consume_Edges( HwPWMCaptureChannel_T channel, uint16_t count )
+{
+    if ( channel >= PWM_CAPTURE_CHANNEL_COUNT )
+    {
+        return;
+    }
+
+    HwPWMCaptureChannelContext_T* context = &hw_pwm_capture_channels[channel];
+
+    context->edge_tail = ( uint16_t )( context->edge_tail + count );
+}
+
+uint32_t HW_PWM_Capture_Get_Lost_Edges( HwPWMCaptureChannel_T channel )
+{
+    if ( channel >= PWM_CAPTURE_CHANNEL_COUNT )
+    {
+        return 0U;
+    }
+
+    return hw_pwm_capture_channels[channel].lost_edges;
+}
+
+void HW_PWM_CAPTURE_CH_1_IRQ( void )
+{
+    HW_PWM_Capture_Service_Edge_IRQ( &hw_pwm_capture_channels[HW_PWM_CAPTURE_CHANNEL_1] );
+}
+
+void HW_PWM_CAPTURE_CH_2_IRQ( void )
+{
+    HW_PWM_Capture_Service_Edge_IRQ( &hw_pwm_capture_channels[HW_PWM_CAPTURE_CHANNEL_2] );
+}
@@ -17,6 +17,7 @@
  *      - Start and stop timer-based PWM capture
  *      - Map logical channels to timer capture registers (CCR)
  *      - Expose new capture availability via hardware flags
+ *      - Timestamp every edge into a per-channel ring in edge capture mode
  *
  *      Non-Responsibilities:
  *      - Validating captured data
@@ -27,6 +28,8 @@
  *      - Configure channels using HW_PWM_Capture_Configure_Channel()
  *      - Use HW_PWM_Capture_Peek_Result() to inspect new data
  *      - Use HW_PWM_Capture_Consume_Result() to clear capture flags
+ *      - In edge capture mode use HW_PWM_Capture_Peek_Edges() and
+ *        HW_PWM_Capture_Consume_Edges() instead
  *
  *      Assumptions:
  *      - Timer PWM input mode is configured via IOC
@@ -56,6 +59,12 @@ extern "C"
  *------------------------------------------------------------------------------
  */
 
+/*
+ * Edges held per channel in edge capture mode. Must be a power of two.
+ * 256 edges cover 128 PWM periods, or about ten SENT frames.
+ */
+#define HW_PWM_CAPTURE_EDGE_RING_SIZE 256U
+
 /**
  * @brief PWM capture analogue front-end mode.
  *
@@ -98,8 +107,9 @@ typedef enum
  */
 typedef struct
 {
-    HwPWMCaptureMode_T mode;        // Desired capture mode (voltage level)
-    bool               is_enabled;  // Flag to indicate if capture is enabled for this channel
+    HwPWMCaptureMode_T mode;           // Desired capture mode (voltage level)
+    bool               is_enabled;     // Flag to indicate if capture is enabled for this channel
+    bool               capture_edges;  // Timestamp every edge instead of the latest period
 } HwPWMCaptureConfig_T;
 
 /**
@@ -120,6 +130,23 @@ typedef struct
     volatile uint32_t* high_ticks;
 } HwPWMCaptureResult_T;
 
+/**
+ * @brief One input edge captured in edge capture mode.
+ *
+ * timestamp_ticks is the free-running 32-bit timer count at the edge; the
+ * difference between two timestamps is valid across counter wrap.
+ *
+ * follows_gap is set on the first edge stored after edges were lost, either
+ * to a full ring or to a capture overrun, so the interval from the previous
+ * edge in the ring is not a measurement.
+ */
+typedef struct
+{
+    uint32_t timestamp_ticks;
+    bool     rising;
+    bool     follows_gap;
+} HwPWMCaptureEdge_T;
+
 /**-----------------------------------------------------------------------------
  *  Public Typedefs / Enums / Structures
  *------------------------------------------------------------------------------
@@ -199,6 +226,38 @@ void HW_PWM_Capture_Consume_Result( HwPWMCaptureChannel_T channel );
  */
 uint32_t HW_PWM_Capture_Get_Timer_Clock_Hz( HwPWMCaptureChannel_T channel );
 
+/**
+ * @brief Peek the oldest block of captured edges without consuming it.
+ *
+ * Returns the number of edges stored contiguously from the oldest one and
+ * points edges at them in the ring. Edges after a ring wrap are returned by
+ * the next peek once these are consumed. Returns 0 when the ring is empty or
+ * the channel is not in edge capture mode. An invalid channel returns 0 and
+ * sets edges to NULL.
+ *
+ * @param channel Logical PWM capture channel to inspect.
+ * @param edges   Set to the oldest edge; must not be NULL.
+ */
+uint16_t HW_PWM_Capture_Peek_Edges( HwPWMCaptureChannel_T      channel,
+                                    const HwPWMCaptureEdge_T** edges );
+
+/**
+ * @brief Release edges returned by HW_PWM_Capture_Peek_Edges().
+ *
+ * An invalid channel is ignored.
+ *
+ * @param count Number of edges to release, at most the count last peeked.
+ */
+void HW_PWM_Capture_Consume_Edges( HwPWMCaptureChannel_T channel, uint16_t count );
+
+/**
+ * @brief Return the number of edges lost since the channel was configured.
+ *
+ * Counts edges dropped for a full ring and capture overruns; an overrun
+ * counts once however many edges it lost.
+ */
+uint32_t HW_PWM_Capture_Get_Lost_Edges( HwPWMCaptureChannel_T channel );
+
 #ifdef __cplusplus
 }
 #endif
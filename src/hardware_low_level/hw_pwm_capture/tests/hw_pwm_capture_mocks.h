@@ -36,6 +36,12 @@ extern "C"
 #define TIM5 ( &mock_tim5 )
 #define TIM_SR_CC1IF ( 1u << 1 )
 #define TIM_SR_CC2IF ( 1u << 2 )
+#define TIM_SR_CC1OF ( 1u << 9 )
+#define TIM_SR_CC2OF ( 1u << 10 )
+#define TIM_DIER_CC1IE ( 1u << 1 )
+#define TIM_DIER_CC2IE ( 1u << 2 )
+#define TIM_SMCR_SMS ( 7u << 0 )
+#define TIM_SMCR_SMS_2 ( 4u << 0 )
 
 /**-----------------------------------------------------------------------------
  *  Public Typedefs / Enums / Structures
@@ -47,16 +53,45 @@ typedef struct
     volatile uint32_t CCR1;
     volatile uint32_t CCR2;
     volatile uint32_t SR;
+    volatile uint32_t DIER;
+    volatile uint32_t SMCR;
 } TIM_TypeDef;
 
+typedef enum
+{
+    TIM2_IRQn = 0,
+    TIM5_IRQn,
+    MOCK_IRQ_COUNT
+} IRQn_Type;
+
 extern TIM_TypeDef mock_tim2;
 extern TIM_TypeDef mock_tim5;
+extern bool        mock_nvic_enabled[MOCK_IRQ_COUNT];
+extern uint32_t    mock_nvic_priority[MOCK_IRQ_COUNT];
 
 /**-----------------------------------------------------------------------------
  *  Public Function Prototypes
  *------------------------------------------------------------------------------
  */
 
+static inline void NVIC_EnableIRQ( IRQn_Type irq )
+{
+    mock_nvic_enabled[irq] = true;
+}
+
+static inline void NVIC_DisableIRQ( IRQn_Type irq )
+{
+    mock_nvic_enabled[irq] = false;
+}
+
+static inline void NVIC_SetPriority( IRQn_Type irq, uint32_t priority )
+{
+    mock_nvic_priority[irq] = priority;
+}
+
+void TIM2_IRQHandler( void );
+void TIM5_IRQHandler( void );
+
 // NOLINTEND
 
 #ifdef __cplusplus
@@ -53,6 +53,8 @@ extern "C"
 {
 TIM_TypeDef mock_tim2;
 TIM_TypeDef mock_tim5;
+bool        mock_nvic_enabled[MOCK_IRQ_COUNT];
+uint32_t    mock_nvic_priority[MOCK_IRQ_COUNT];
 
 void HW_TIMER_Stop_Timer( Timer_T timer )
 {
@@ -90,6 +92,36 @@ class HWPWMCaptureTest : public ::testing::Test
         g_mock_timer = &mock_timer;
         mock_tim2    = {};
         mock_tim5    = {};
+
+        mock_nvic_enabled[TIM2_IRQn]  = false;
+        mock_nvic_enabled[TIM5_IRQn]  = false;
+        mock_nvic_priority[TIM2_IRQn] = 0U;
+        mock_nvic_priority[TIM5_IRQn] = 0U;
+    }
+
+    /* Configure a channel in edge capture mode with the timer calls allowed. */
+    void StartEdgeCapture( HwPWMCaptureChannel_T channel )
+    {
+        HwPWMCaptureConfig_T config = {};
+        config.mode                 = HW_PWM_CAPTURE_LV_5V;
+        config.is_enabled           = true;
+        config.capture_edges        = true;
+
+        EXPECT_CALL( mock_timer, Stop_Timer( _ ) );
+        EXPECT_CALL( mock_timer, Configure_Timer( _, _, _ ) );
+        EXPECT_CALL( mock_timer, Start_Timer( _ ) );
+        EXPECT_CALL( mock_timer, Get_Clock_Hz( _ ) ).WillOnce( testing::Return( 90000000U ) );
+        ASSERT_TRUE( HW_PWM_Capture_Configure_Channel( channel, &config ) );
+    }
+
+    /* Capture on TIM2 as the hardware does, then service the interrupt; reading CCR clears SR. */
+    static void CaptureTim2( uint32_t status, uint32_t rising_ticks, uint32_t falling_ticks )
+    {
+        mock_tim2.SR   = status;
+        mock_tim2.CCR1 = rising_ticks;
+        mock_tim2.CCR2 = falling_ticks;
+        TIM2_IRQHandler();
+        mock_tim2.SR = 0U;
     }
 
     void TearDown( void ) override
@@ -326,3 +358,120 @@ TEST_F( HWPWMCaptureTest, ConsumeChannel2PreservesOtherStatusFlags )
     EXPECT_EQ( mock_tim5.SR & TIM_SR_CC2IF, 0U );
     EXPECT_NE( mock_tim5.SR & TIM_SR_CC1IF, 0U );
 }
+
+TEST_F( HWPWMCaptureTest, EdgeCaptureRunsCounterFreeAndEnablesCaptureInterrupts )
+{
+    mock_tim5.SMCR = TIM_SMCR_SMS_2;
+    StartEdgeCapture( HW_PWM_CAPTURE_CHANNEL_2 );
+
+    EXPECT_EQ( mock_tim5.SMCR & TIM_SMCR_SMS, 0U );
+    EXPECT_EQ( mock_tim5.DIER, TIM_DIER_CC1IE | TIM_DIER_CC2IE );
+    EXPECT_TRUE( mock_nvic_enabled[TIM5_IRQn] );
+    EXPECT_EQ( mock_nvic_priority[TIM5_IRQn], 5U );
+    EXPECT_FALSE( mock_nvic_enabled[TIM2_IRQn] );
+
+    HwPWMCaptureConfig_T config = {};
+    config.mode                 = HW_PWM_CAPTURE_LV_3V3;
+    config.is_enabled           = false;
+    EXPECT_CALL( mock_timer, Stop_Timer( PWM_CAPTURE_TIMER_CH2 ) );
+    ASSERT_TRUE( HW_PWM_Capture_Configure_Channel( HW_PWM_CAPTURE_CHANNEL_2, &config ) );
+
+    EXPECT_EQ( mock_tim5.SMCR & TIM_SMCR_SMS, TIM_SMCR_SMS_2 );
+    EXPECT_EQ( mock_tim5.DIER, 0U );
+    EXPECT_FALSE( mock_nvic_enabled[TIM5_IRQn] );
+}
+
+TEST_F( HWPWMCaptureTest, EdgeCaptureStoresEveryEdgeAndPeeksUpToRingWrap )
+{
+    StartEdgeCapture( HW_PWM_CAPTURE_CHANNEL_1 );
+
+    const HwPWMCaptureEdge_T* edges = nullptr;
+    EXPECT_EQ( HW_PWM_Capture_Peek_Edges( HW_PWM_CAPTURE_CHANNEL_1, &edges ), 0U );
+
+    /* Fill to four short of the end of the ring, consume, then capture across the wrap. */
+    for ( uint32_t i = 0U; i < HW_PWM_CAPTURE_EDGE_RING_SIZE - 4U; i++ )
+    {
+        CaptureTim2( TIM_SR_CC1IF, i, 0U );
+    }
+    ASSERT_EQ( HW_PWM_Capture_Peek_Edges( HW_PWM_CAPTURE_CHANNEL_1, &edges ),
+               HW_PWM_CAPTURE_EDGE_RING_SIZE - 4U );
+    HW_PWM_Capture_Consume_Edges( HW_PWM_CAPTURE_CHANNEL_1, HW_PWM_CAPTURE_EDGE_RING_SIZE - 4U );
+
+    for ( uint32_t i = 0U; i < 3U; i++ )
+    {
+        CaptureTim2( TIM_SR_CC1IF, 1000U + 200U * i, 0U );
+        CaptureTim2( TIM_SR_CC2IF, 0U, 1050U + 200U * i );
+    }
+
+    ASSERT_EQ( HW_PWM_Capture_Peek_Edges( HW_PWM_CAPTURE_CHANNEL_1, &edges ), 4U );
+    EXPECT_EQ( edges[0].timestamp_ticks, 1000U );
+    EXPECT_TRUE( edges[0].rising );
+    EXPECT_EQ( edges[1].timestamp_ticks, 1050U );
+    EXPECT_FALSE( edges[1].rising );
+    EXPECT_FALSE( edges[3].follows_gap );
+    HW_PWM_Capture_Consume_Edges( HW_PWM_CAPTURE_CHANNEL_1, 4U );
+
+    ASSERT_EQ( HW_PWM_Capture_Peek_Edges( HW_PWM_CAPTURE_CHANNEL_1, &edges ), 2U );
+    EXPECT_EQ( edges[0].timestamp_ticks, 1400U );
+    EXPECT_EQ( edges[1].timestamp_ticks, 1450U );
+    EXPECT_EQ( HW_PWM_Capture_Get_Lost_Edges( HW_PWM_CAPTURE_CHANNEL_1 ), 0U );
+}
+
+TEST_F( HWPWMCaptureTest, EdgeAccessIgnoresInvalidChannel )
+{
+    const HwPWMCaptureChannel_T invalid = static_cast<HwPWMCaptureChannel_T>( 2U );
+    StartEdgeCapture( HW_PWM_CAPTURE_CHANNEL_1 );
+    CaptureTim2( TIM_SR_CC1IF, 100U, 0U );
+
+    const HwPWMCaptureEdge_T* edges = nullptr;
+    EXPECT_EQ( HW_PWM_Capture_Peek_Edges( invalid, &edges ), 0U );
+    EXPECT_EQ( edges, nullptr );
+    HW_PWM_Capture_Consume_Edges( invalid, 1U );
+    EXPECT_EQ( HW_PWM_Capture_Get_Lost_Edges( invalid ), 0U );
+
+    EXPECT_EQ( HW_PWM_Capture_Peek_Edges( HW_PWM_CAPTURE_CHANNEL_1, &edges ), 1U );
+}
+
+TEST_F( HWPWMCaptureTest, EdgeCaptureOrdersEdgesServedTogetherAcrossCounterWrap )
+{
+    StartEdgeCapture( HW_PWM_CAPTURE_CHANNEL_1 );
+
+    /* The falling edge came first, just before the counter wrapped. */
+    CaptureTim2( TIM_SR_CC1IF | TIM_SR_CC2IF, 0x00000010U, 0xFFFFFFF0U );
+
+    const HwPWMCaptureEdge_T* edges = nullptr;
+    ASSERT_EQ( HW_PWM_Capture_Peek_Edges( HW_PWM_CAPTURE_CHANNEL_1, &edges ), 2U );
+    EXPECT_FALSE( edges[0].rising );
+    EXPECT_EQ( edges[0].timestamp_ticks, 0xFFFFFFF0U );
+    EXPECT_TRUE( edges[1].rising );
+    EXPECT_EQ( edges[1].timestamp_ticks, 0x00000010U );
+}
+
+TEST_F( HWPWMCaptureTest, EdgeCaptureMarksGapAfterOvercaptureAndFullRing )
+{
+    StartEdgeCapture( HW_PWM_CAPTURE_CHANNEL_1 );
+
+    CaptureTim2( TIM_SR_CC1IF | TIM_SR_CC1OF, 100U, 0U );
+    EXPECT_EQ( HW_PWM_Capture_Get_Lost_Edges( HW_PWM_CAPTURE_CHANNEL_1 ), 1U );
+
+    for ( uint32_t i = 1U; i < HW_PWM_CAPTURE_EDGE_RING_SIZE + 3U; i++ )
+    {
+        CaptureTim2( TIM_SR_CC2IF, 0U, 100U + i );
+    }
+    EXPECT_EQ( HW_PWM_Capture_Get_Lost_Edges( HW_PWM_CAPTURE_CHANNEL_1 ), 4U );
+
+    const HwPWMCaptureEdge_T* edges = nullptr;
+    ASSERT_EQ( HW_PWM_Capture_Peek_Edges( HW_PWM_CAPTURE_CHANNEL_1, &edges ),
+               HW_PWM_CAPTURE_EDGE_RING_SIZE );
+    EXPECT_TRUE( edges[0].follows_gap );
+    EXPECT_FALSE( edges[1].follows_gap );
+    HW_PWM_Capture_Consume_Edges( HW_PWM_CAPTURE_CHANNEL_1, 1U );
+
+    CaptureTim2( TIM_SR_CC1IF, 5000U, 0U );
+    ASSERT_EQ( HW_PWM_Capture_Peek_Edges( HW_PWM_CAPTURE_CHANNEL_1, &edges ),
+               HW_PWM_CAPTURE_EDGE_RING_SIZE - 1U );
+    HW_PWM_Capture_Consume_Edges( HW_PWM_CAPTURE_CHANNEL_1, HW_PWM_CAPTURE_EDGE_RING_SIZE - 1U );
+    ASSERT_EQ( HW_PWM_Capture_Peek_Edges( HW_PWM_CAPTURE_CHANNEL_1, &edges ), 1U );
+    EXPECT_EQ( edges[0].timestamp_ticks, 5000U );
+    EXPECT_TRUE( edges[0].follows_gap );
+}
@@ -8,7 +8,11 @@
  *PWM generation
  *
  *  Notes:
- *      <Any design notes, dependencies, or assumptions go here>
+ *      PSC, ARR and CCR are all preloaded, so a write only reaches the active
+ *      registers at the timer's next update event. The execution-stage setters
+ *      hold off update events while they write, so the three registers move to
+ *      their new values together at the end of the running period and never
+ *      produce a runt or mixed-parameter pulse.
  ******************************************************************************/
 
 /**-----------------------------------------------------------------------------
@@ -39,12 +43,19 @@
 #define PWM1_HAL_CHANNEL TIM_CHANNEL_2
 #define PWM1_LL_SET_COMPARE LL_TIM_OC_SetCompareCH2
 #define PWM1_START_OUTPUT HAL_TIM_PWM_Start
+#define PWM1_LL_CHANNEL LL_TIM_CHANNEL_CH2
+#define PWM1_TICK_TRIGGER_INPUT LL_TIM_TS_ITR0 /* TIM12 ITR0 = TIM4 TRGO */
 
 /* PWM2 / HV hardware mapping */
 #define PWM2_TIMER_HANDLE ( &htim8 )
 #define PWM2_HAL_CHANNEL TIM_CHANNEL_2
 #define PWM2_LL_SET_COMPARE LL_TIM_OC_SetCompareCH2
 #define PWM2_START_OUTPUT HAL_TIMEx_PWMN_Start
+#define PWM2_LL_CHANNEL LL_TIM_CHANNEL_CH2
+#define PWM2_TICK_TRIGGER_INPUT LL_TIM_TS_ITR2 /* TIM8 ITR2 = TIM4 TRGO */
+
+/* Execution manager tick, see hw_timer.c */
+#define PWM_TICK_TIMER_INSTANCE TIM4
 
 /**-----------------------------------------------------------------------------
  *  Typedefs / Enums / Structures
@@ -67,6 +78,19 @@
  *------------------------------------------------------------------------------
  */
 
+/**
+ * @brief Makes PSC, ARR and CCR of one channel load only on an update event.
+ *
+ * PSC is always preloaded. Cube already enables ARR preload and HAL enables
+ * the compare preload when it configures the channel, but the glitch-free
+ * update depends on both so they are set here as well.
+ */
+static void HW_PWM_GEN_Enable_Preload( TIM_TypeDef* timer, uint32_t channel )
+{
+    LL_TIM_EnableARRPreload( timer );
+    LL_TIM_OC_EnablePreload( timer, channel );
+}
+
 /**-----------------------------------------------------------------------------
  *  Configure Stage Public Function Definitions
  *------------------------------------------------------------------------------
@@ -91,15 +115,60 @@ void HW_PWM_GEN_Config( PwmGenChannel_T channel, PwmGenVoltageLevel_T volt_lvl )
     if ( channel == PWM_GEN_CHANNEL_LV )
     {
         // Call to output expander to set voltage levels
+        HW_PWM_GEN_Enable_Preload( PWM1_TIMER_HANDLE->Instance, PWM1_LL_CHANNEL );
         ( void )PWM1_START_OUTPUT( PWM1_TIMER_HANDLE, PWM1_HAL_CHANNEL );
     }
     else if ( channel == PWM_GEN_CHANNEL_HV )
     {
         // Call to output expander to set voltage levels
+        HW_PWM_GEN_Enable_Preload( PWM2_TIMER_HANDLE->Instance, PWM2_LL_CHANNEL );
         ( void )PWM2_START_OUTPUT( PWM2_TIMER_HANDLE, PWM2_HAL_CHANNEL );
     }
 }
 
+/**
+ * @brief Locks or frees the PWM period from the execution manager tick.
+ *
+ * @param channel   The channel to synchronise
+ * @param enable    true to restart the PWM period on every execution tick
+ *
+ * With sync enabled TIM4 drives its update event out on TRGO and the PWM timer
+ * resets its counter on it, so every PWM period boundary falls a whole number
+ * of periods after a tick. Parameters written during a tick then take effect
+ * on the first of those boundaries. The PWM period must divide the execution
+ * tick period, otherwise the reset cuts the last period of each tick short.
+ */
+void HW_PWM_GEN_Set_Tick_Sync( PwmGenChannel_T channel, bool enable )
+{
+    TIM_TypeDef* timer;
+    uint32_t     trigger_input;
+
+    if ( channel == PWM_GEN_CHANNEL_LV )
+    {
+        timer         = PWM1_TIMER_HANDLE->Instance;
+        trigger_input = PWM1_TICK_TRIGGER_INPUT;
+    }
+    else if ( channel == PWM_GEN_CHANNEL_HV )
+    {
+        timer         = PWM2_TIMER_HANDLE->Instance;
+        trigger_input = PWM2_TICK_TRIGGER_INPUT;
+    }
+    else
+    {
+        return;
+    }
+
+    if ( !enable )
+    {
+        LL_TIM_SetSlaveMode( timer, LL_TIM_SLAVEMODE_DISABLED );
+        return;
+    }
+
+    LL_TIM_SetTriggerOutput( PWM_TICK_TIMER_INSTANCE, LL_TIM_TRGO_UPDATE );
+    LL_TIM_SetTriggerInput( timer, trigger_input );
+    LL_TIM_SetSlaveMode( timer, LL_TIM_SLAVEMODE_RESET );
+}
+
 /**
  * @brief Computes the prescaler register (PSC).
  *
@@ -200,14 +269,20 @@ uint16_t HW_PWM_GEN_compute_ccr( uint16_t duty_pm, uint16_t arr )
  * This function sets the values of the PWM channel 1 registers
  * To calculate the required values functions like HW_PWM_GEN_compute_arr should be used
  * This function is designed to be very fast and should be implemented in the execution phase
+ *
+ * Update events are disabled while the preload registers are written, so the new values take
+ * effect together at the first period boundary after the call and the running period completes
+ * unchanged. A boundary that falls inside the call keeps the old values for one more period.
  */
 void HW_PWM_GEN_Set_PWM1_Direct( uint16_t arr, uint16_t ccr, uint16_t psc )
 {
     TIM_TypeDef* timer = PWM1_TIMER_HANDLE->Instance;
 
-    PWM1_LL_SET_COMPARE( timer, ccr );
-    LL_TIM_SetAutoReload( timer, arr );
+    LL_TIM_DisableUpdateEvent( timer );
     LL_TIM_SetPrescaler( timer, psc );
+    LL_TIM_SetAutoReload( timer, arr );
+    PWM1_LL_SET_COMPARE( timer, ccr );
+    LL_TIM_EnableUpdateEvent( timer );
 }
 
 /**
@@ -219,12 +294,16 @@ void HW_PWM_GEN_Set_PWM1_Direct( uint16_t arr, uint16_t ccr, uint16_t psc )
  * This function sets the values of the PWM channel 2 registers
  * To calculate the required values functions like HW_PWM_GEN_compute_arr should be used
  * This function is designed to be very fast and should be implemented in the execution phase
+ *
+ * Updates without glitches in the same way as HW_PWM_GEN_Set_PWM1_Direct.
  */
 void HW_PWM_GEN_Set_PWM2_Direct( uint16_t arr, uint16_t ccr, uint16_t psc )
 {
     TIM_TypeDef* timer = PWM2_TIMER_HANDLE->Instance;
 
-    PWM2_LL_SET_COMPARE( timer, ccr );
-    LL_TIM_SetAutoReload( timer, arr );
+    LL_TIM_DisableUpdateEvent( timer );
     LL_TIM_SetPrescaler( timer, psc );
+    LL_TIM_SetAutoReload( timer, arr );
+    PWM2_LL_SET_COMPARE( timer, ccr );
+    LL_TIM_EnableUpdateEvent( timer );
 }
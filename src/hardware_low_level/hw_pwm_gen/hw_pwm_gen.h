@@ -63,6 +63,18 @@ typedef enum
  */
 void HW_PWM_GEN_Config( PwmGenChannel_T channel, PwmGenVoltageLevel_T volt_lvl );
 
+/**
+ * @brief Locks or frees the PWM period from the execution manager tick.
+ *
+ * @param channel   The channel to synchronise
+ * @param enable    true to restart the PWM period on every execution tick
+ *
+ * With sync enabled every PWM period boundary falls a whole number of periods after an
+ * execution tick, so parameters written during a tick take effect a fixed time after it.
+ * The PWM period must divide the execution tick period. Off by default.
+ */
+void HW_PWM_GEN_Set_Tick_Sync( PwmGenChannel_T channel, bool enable );
+
 /**
  * @brief Computes the prescaler register (PSC).
  *
@@ -117,6 +129,9 @@ uint16_t HW_PWM_GEN_compute_ccr( uint16_t duty_pm, uint16_t arr );
  * This function sets the values of the PWM channel 1 registers
  * To calculate the required values functions like HW_PWM_GEN_compute_arr should be used
  * This function is designed to be very fast and should be implemented in the execution phase
+ *
+ * The new values take effect together at the first period boundary after the call; the running
+ * period completes with the old values.
  */
 void HW_PWM_GEN_Set_PWM1_Direct( uint16_t arr, uint16_t ccr, uint16_t psc );
 
@@ -129,6 +144,9 @@ void HW_PWM_GEN_Set_PWM1_Direct( uint16_t arr, uint16_t ccr, uint16_t psc );
  * This function sets the values of the PWM channel 2 registers
  * To calculate the required values functions like HW_PWM_GEN_compute_arr should be used
  * This function is designed to be very fast and should be implemented in the execution phase
+ *
+ * The new values take effect together at the first period boundary after the call; the running
+ * period completes with the old values.
  */
 void HW_PWM_GEN_Set_PWM2_Direct( uint16_t arr, uint16_t ccr, uint16_t psc );
 
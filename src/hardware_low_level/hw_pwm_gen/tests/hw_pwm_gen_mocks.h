@@ -45,6 +45,22 @@ extern "C"
 /* Event generation register */
 #define TIM_EGR_UG ( 1U << 0 )
 
+/* Control and mode register bits */
+#define TIM_CR1_UDIS ( 1U << 1 )
+#define TIM_CR1_ARPE ( 1U << 7 )
+#define TIM_CR2_MMS ( 7U << 4 )
+#define TIM_SMCR_SMS ( 7U << 0 )
+#define TIM_SMCR_TS ( 7U << 4 )
+#define TIM_CCMR1_OC2PE ( 1U << 11 )
+
+/* LL channel, trigger and slave mode selections */
+#define LL_TIM_CHANNEL_CH2 ( 1U << 4 )
+#define LL_TIM_TRGO_UPDATE ( 2U << 4 )
+#define LL_TIM_TS_ITR0 ( 0U << 4 )
+#define LL_TIM_TS_ITR2 ( 2U << 4 )
+#define LL_TIM_SLAVEMODE_DISABLED ( 0U )
+#define LL_TIM_SLAVEMODE_RESET ( 4U )
+
 /**-----------------------------------------------------------------------------
  * Public Typedefs / Structures
  *----------------------------------------------------------------------------*/
@@ -96,6 +112,9 @@ extern TIM_HandleTypeDef htim8;
 
 extern TIM_TypeDef mock_tim12_regs;
 extern TIM_TypeDef mock_tim8_regs;
+extern TIM_TypeDef mock_tim4_regs;
+
+#define TIM4 ( &mock_tim4_regs )
 
 /**-----------------------------------------------------------------------------
  * Public Function Prototypes
@@ -121,6 +140,20 @@ void LL_TIM_SetAutoReload( TIM_TypeDef* TIMx, uint32_t AutoReload );
 
 void LL_TIM_SetPrescaler( TIM_TypeDef* TIMx, uint32_t Prescaler );
 
+void LL_TIM_EnableUpdateEvent( TIM_TypeDef* TIMx );
+
+void LL_TIM_DisableUpdateEvent( TIM_TypeDef* TIMx );
+
+void LL_TIM_EnableARRPreload( TIM_TypeDef* TIMx );
+
+void LL_TIM_OC_EnablePreload( TIM_TypeDef* TIMx, uint32_t Channel );
+
+void LL_TIM_SetTriggerOutput( TIM_TypeDef* TIMx, uint32_t TimerSynchronization );
+
+void LL_TIM_SetTriggerInput( TIM_TypeDef* TIMx, uint32_t TriggerInput );
+
+void LL_TIM_SetSlaveMode( TIM_TypeDef* TIMx, uint32_t SlaveMode );
+
 // NOLINTEND
 
 #ifdef __cplusplus
@@ -21,6 +21,8 @@
 #include <gtest/gtest.h>
 #include <gmock/gmock.h>
 #include <cstring>
+#include <string>
+#include <vector>
 
 extern "C"
 {
@@ -41,6 +43,7 @@ using ::testing::Return;
 
 TIM_TypeDef mock_tim12_regs{};
 TIM_TypeDef mock_tim8_regs{};
+TIM_TypeDef mock_tim4_regs{};
 
 TIM_HandleTypeDef htim12{};
 TIM_HandleTypeDef htim8{};
@@ -61,6 +64,51 @@ class MockHWPWM
 
 static MockHWPWM* g_mock = nullptr;
 
+/**
+ * @brief Active (shadow) copies of the preloaded registers of one timer.
+ */
+struct ActiveRegs
+{
+    uint32_t psc;
+    uint32_t arr;
+    uint32_t ccr2;
+
+    bool operator==( const ActiveRegs& other ) const
+    {
+        return psc == other.psc && arr == other.arr && ccr2 == other.ccr2;
+    }
+};
+
+/* Register writes to PWM timers, in order. */
+static std::vector<std::string> g_writes;
+
+/* When set, a period boundary of this timer is emulated after each of its register writes. */
+static TIM_TypeDef*            g_boundary_timer = nullptr;
+static ActiveRegs              g_active{};
+static std::vector<ActiveRegs> g_active_at_boundary;
+
+/**
+ * @brief Emulates the update event at a period boundary: the preloaded registers move to the
+ *        active registers unless update events are disabled.
+ */
+static void PeriodBoundary( TIM_TypeDef* TIMx )
+{
+    if ( ( TIMx->CR1 & TIM_CR1_UDIS ) == 0U )
+    {
+        g_active = { TIMx->PSC, TIMx->ARR, TIMx->CCR2 };
+    }
+    g_active_at_boundary.push_back( g_active );
+}
+
+static void RecordWrite( TIM_TypeDef* TIMx, const char* write )
+{
+    g_writes.push_back( write );
+    if ( TIMx == g_boundary_timer )
+    {
+        PeriodBoundary( TIMx );
+    }
+}
+
 /**-----------------------------------------------------------------------------
  *  HAL Mock Implementations
  *------------------------------------------------------------------------------
@@ -89,6 +137,7 @@ extern "C" void LL_TIM_OC_SetCompareCH1( TIM_TypeDef* TIMx, uint32_t CompareValu
 extern "C" void LL_TIM_OC_SetCompareCH2( TIM_TypeDef* TIMx, uint32_t CompareValue )
 {
     TIMx->CCR2 = CompareValue;
+    RecordWrite( TIMx, "CCR2" );
 }
 
 extern "C" void LL_TIM_OC_SetCompareCH3( TIM_TypeDef* TIMx, uint32_t CompareValue )
@@ -104,11 +153,53 @@ extern "C" void LL_TIM_OC_SetCompareCH4( TIM_TypeDef* TIMx, uint32_t CompareValu
 extern "C" void LL_TIM_SetAutoReload( TIM_TypeDef* TIMx, uint32_t AutoReload )
 {
     TIMx->ARR = AutoReload;
+    RecordWrite( TIMx, "ARR" );
 }
 
 extern "C" void LL_TIM_SetPrescaler( TIM_TypeDef* TIMx, uint32_t Prescaler )
 {
     TIMx->PSC = Prescaler;
+    RecordWrite( TIMx, "PSC" );
+}
+
+extern "C" void LL_TIM_EnableUpdateEvent( TIM_TypeDef* TIMx )
+{
+    TIMx->CR1 &= ~TIM_CR1_UDIS;
+    RecordWrite( TIMx, "UDIS=0" );
+}
+
+extern "C" void LL_TIM_DisableUpdateEvent( TIM_TypeDef* TIMx )
+{
+    TIMx->CR1 |= TIM_CR1_UDIS;
+    RecordWrite( TIMx, "UDIS=1" );
+}
+
+extern "C" void LL_TIM_EnableARRPreload( TIM_TypeDef* TIMx )
+{
+    TIMx->CR1 |= TIM_CR1_ARPE;
+}
+
+extern "C" void LL_TIM_OC_EnablePreload( TIM_TypeDef* TIMx, uint32_t Channel )
+{
+    if ( Channel == LL_TIM_CHANNEL_CH2 )
+    {
+        TIMx->CCMR1 |= TIM_CCMR1_OC2PE;
+    }
+}
+
+extern "C" void LL_TIM_SetTriggerOutput( TIM_TypeDef* TIMx, uint32_t TimerSynchronization )
+{
+    TIMx->CR2 = ( TIMx->CR2 & ~TIM_CR2_MMS ) | TimerSynchronization;
+}
+
+extern "C" void LL_TIM_SetTriggerInput( TIM_TypeDef* TIMx, uint32_t TriggerInput )
+{
+    TIMx->SMCR = ( TIMx->SMCR & ~TIM_SMCR_TS ) | TriggerInput;
+}
+
+extern "C" void LL_TIM_SetSlaveMode( TIM_TypeDef* TIMx, uint32_t SlaveMode )
+{
+    TIMx->SMCR = ( TIMx->SMCR & ~TIM_SMCR_SMS ) | SlaveMode;
 }
 
 /**-----------------------------------------------------------------------------
@@ -127,14 +218,30 @@ class HWPWMGenTest : public ::testing::Test
 
         memset( &mock_tim12_regs, 0, sizeof( mock_tim12_regs ) );
         memset( &mock_tim8_regs, 0, sizeof( mock_tim8_regs ) );
+        memset( &mock_tim4_regs, 0, sizeof( mock_tim4_regs ) );
 
         htim12.Instance = &mock_tim12_regs;
         htim8.Instance  = &mock_tim8_regs;
+
+        g_writes.clear();
+        g_boundary_timer = nullptr;
+        g_active         = {};
+        g_active_at_boundary.clear();
     }
 
     void TearDown() override
     {
-        g_mock = nullptr;
+        g_mock           = nullptr;
+        g_boundary_timer = nullptr;
+    }
+
+    /** Loads a running configuration into both the preload and the active registers. */
+    static void Run( TIM_TypeDef* timer, uint32_t arr, uint32_t ccr, uint32_t psc )
+    {
+        timer->ARR  = arr;
+        timer->CCR2 = ccr;
+        timer->PSC  = psc;
+        g_active    = { psc, arr, ccr };
     }
 };
 
@@ -302,10 +409,132 @@ TEST_F( HWPWMGenTest, SetPWM2DirectDoesNotModifyOtherChannels )
     EXPECT_EQ( mock_tim8_regs.CCR4, 0 );
 }
 
+/*-----------------------------------------------------------------------------
+ * Synchronised Update Tests
+ *---------------------------------------------------------------------------*/
+
+TEST_F( HWPWMGenTest, SetPWM1DirectWritesRegistersWithUpdateEventsDisabled )
+{
+    HW_PWM_GEN_Set_PWM1_Direct( 1000, 250, 4 );
+
+    std::vector<std::string> expected = { "UDIS=1", "PSC", "ARR", "CCR2", "UDIS=0" };
+    EXPECT_EQ( g_writes, expected );
+    EXPECT_EQ( mock_tim12_regs.CR1 & TIM_CR1_UDIS, 0U );
+}
+
+TEST_F( HWPWMGenTest, SetPWM2DirectWritesRegistersWithUpdateEventsDisabled )
+{
+    HW_PWM_GEN_Set_PWM2_Direct( 2000, 500, 8 );
+
+    std::vector<std::string> expected = { "UDIS=1", "PSC", "ARR", "CCR2", "UDIS=0" };
+    EXPECT_EQ( g_writes, expected );
+    EXPECT_EQ( mock_tim8_regs.CR1 & TIM_CR1_UDIS, 0U );
+}
+
+TEST_F( HWPWMGenTest, SetPWM1DirectAppliesAllValuesAtTheSamePeriodBoundary )
+{
+    const ActiveRegs old_regs = { 1U, 999U, 250U };
+    const ActiveRegs new_regs = { 4U, 1999U, 1500U };
+
+    Run( &mock_tim12_regs, old_regs.arr, old_regs.ccr2, old_regs.psc );
+    g_boundary_timer = &mock_tim12_regs;
+
+    HW_PWM_GEN_Set_PWM1_Direct( 1999, 1500, 4 );
+
+    // A boundary after every write: all but the one after the last write run the old values.
+    ASSERT_EQ( g_active_at_boundary.size(), 5U );
+    for ( size_t i = 0U; i + 1U < g_active_at_boundary.size(); i++ )
+    {
+        EXPECT_EQ( g_active_at_boundary[i], old_regs ) << "boundary " << i;
+    }
+    EXPECT_EQ( g_active_at_boundary.back(), new_regs );
+}
+
+TEST_F( HWPWMGenTest, SetPWM2DirectAppliesAllValuesAtTheSamePeriodBoundary )
+{
+    const ActiveRegs old_regs = { 0U, 4199U, 2100U };
+    const ActiveRegs new_regs = { 9U, 999U, 100U };
+
+    Run( &mock_tim8_regs, old_regs.arr, old_regs.ccr2, old_regs.psc );
+    g_boundary_timer = &mock_tim8_regs;
+
+    HW_PWM_GEN_Set_PWM2_Direct( 999, 100, 9 );
+
+    ASSERT_EQ( g_active_at_boundary.size(), 5U );
+    for ( size_t i = 0U; i + 1U < g_active_at_boundary.size(); i++ )
+    {
+        EXPECT_EQ( g_active_at_boundary[i], old_regs ) << "boundary " << i;
+    }
+    EXPECT_EQ( g_active_at_boundary.back(), new_regs );
+}
+
+TEST_F( HWPWMGenTest, SetPWM1DirectLeavesRunningPeriodUntilNextBoundary )
+{
+    const ActiveRegs old_regs = { 1U, 999U, 250U };
+
+    Run( &mock_tim12_regs, old_regs.arr, old_regs.ccr2, old_regs.psc );
+
+    HW_PWM_GEN_Set_PWM1_Direct( 1999, 1500, 4 );
+
+    EXPECT_EQ( g_active, old_regs );
+    EXPECT_EQ( mock_tim12_regs.EGR, 0U );
+
+    PeriodBoundary( &mock_tim12_regs );
+
+    const ActiveRegs new_regs = { 4U, 1999U, 1500U };
+    EXPECT_EQ( g_active, new_regs );
+}
+
+/*-----------------------------------------------------------------------------
+ * Tick Sync Tests
+ *---------------------------------------------------------------------------*/
+
+TEST_F( HWPWMGenTest, TickSyncLVResetsTIM12OnTIM4Update )
+{
+    HW_PWM_GEN_Set_Tick_Sync( PWM_GEN_CHANNEL_LV, true );
+
+    EXPECT_EQ( mock_tim4_regs.CR2 & TIM_CR2_MMS, LL_TIM_TRGO_UPDATE );
+    EXPECT_EQ( mock_tim12_regs.SMCR & TIM_SMCR_TS, LL_TIM_TS_ITR0 );
+    EXPECT_EQ( mock_tim12_regs.SMCR & TIM_SMCR_SMS, LL_TIM_SLAVEMODE_RESET );
+    EXPECT_EQ( mock_tim8_regs.SMCR, 0U );
+}
+
+TEST_F( HWPWMGenTest, TickSyncHVResetsTIM8OnTIM4Update )
+{
+    HW_PWM_GEN_Set_Tick_Sync( PWM_GEN_CHANNEL_HV, true );
+
+    EXPECT_EQ( mock_tim4_regs.CR2 & TIM_CR2_MMS, LL_TIM_TRGO_UPDATE );
+    EXPECT_EQ( mock_tim8_regs.SMCR & TIM_SMCR_TS, LL_TIM_TS_ITR2 );
+    EXPECT_EQ( mock_tim8_regs.SMCR & TIM_SMCR_SMS, LL_TIM_SLAVEMODE_RESET );
+    EXPECT_EQ( mock_tim12_regs.SMCR, 0U );
+}
+
+TEST_F( HWPWMGenTest, TickSyncDisableReturnsTimerToFreeRunning )
+{
+    HW_PWM_GEN_Set_Tick_Sync( PWM_GEN_CHANNEL_LV, true );
+    HW_PWM_GEN_Set_Tick_Sync( PWM_GEN_CHANNEL_LV, false );
+
+    EXPECT_EQ( mock_tim12_regs.SMCR & TIM_SMCR_SMS, LL_TIM_SLAVEMODE_DISABLED );
+}
+
 /*-----------------------------------------------------------------------------
  * Configure Tests
  *---------------------------------------------------------------------------*/
 
+TEST_F( HWPWMGenTest, ConfigEnablesPreloadBeforeStartingOutputs )
+{
+    EXPECT_CALL( mock, TIMPWMStart( &htim12, TIM_CHANNEL_2 ) ).WillOnce( Return( HAL_OK ) );
+    EXPECT_CALL( mock, TIMPWMNStart( &htim8, TIM_CHANNEL_2 ) ).WillOnce( Return( HAL_OK ) );
+
+    HW_PWM_GEN_Config( PWM_GEN_CHANNEL_LV, PWM_GEN_VOLTAGE_LOW );
+    HW_PWM_GEN_Config( PWM_GEN_CHANNEL_HV, PWM_GEN_VOLTAGE_LOW );
+
+    EXPECT_EQ( mock_tim12_regs.CR1 & TIM_CR1_ARPE, TIM_CR1_ARPE );
+    EXPECT_EQ( mock_tim12_regs.CCMR1 & TIM_CCMR1_OC2PE, TIM_CCMR1_OC2PE );
+    EXPECT_EQ( mock_tim8_regs.CR1 & TIM_CR1_ARPE, TIM_CR1_ARPE );
+    EXPECT_EQ( mock_tim8_regs.CCMR1 & TIM_CCMR1_OC2PE, TIM_CCMR1_OC2PE );
+}
+
 TEST_F( HWPWMGenTest, ConfigStartsLVChannelLowVoltagePWM )
 {
     EXPECT_CALL( mock, TIMPWMStart( &htim12, TIM_CHANNEL_2 ) )
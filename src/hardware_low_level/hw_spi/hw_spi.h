@@ -31,7 +31,14 @@
  *        mode.
  *      - In master mode, each HW_SPI_Load_Tx_Buffer() call is treated as one
  *        DMA-backed packet and is automatically framed by software chip-select.
- *      - In slave mode, the driver does not define packet/message boundaries.
+ *      - In slave mode, the driver does not define packet/message boundaries
+ *        unless rx_nss_framing is enabled. With framing enabled, NSS edges are
+ *        timestamped from an EXTI interrupt and each NSS-low period is queued as
+ *        one RX transaction (see HW_SPI_Rx_Peek_Transaction()).
+ *      - Slave channels can instead emulate a register-mapped SPI sensor (see
+ *        HWSPIRegisterMapConfig_T). Read commands are answered from an SRAM
+ *        register map updated with HW_SPI_Register_Map_Write() and published
+ *        with HW_SPI_Register_Map_Commit().
  *      - The driver does not perform byte swapping or data repacking for
  *        16-bit mode; higher-level software must provide data in the intended
  *        in-memory order.
@@ -60,6 +67,8 @@ extern "C"
  *------------------------------------------------------------------------------
  */
 
+#define HW_SPI_REGISTER_MAP_SIZE_BYTES 256U
+
 /**-----------------------------------------------------------------------------
  *  Public Typedefs / Enums / Structures
  *------------------------------------------------------------------------------
@@ -142,18 +151,43 @@ typedef enum SPIChannel_T
     SPI_NUM_CHANNELS
 } SPIChannel_T;
 
+/**
+ * @brief Register-map slave emulation settings for one SPI channel.
+ *
+ * @details
+ *     When enabled, the first command_bytes of every NSS-framed transaction
+ *     select a register. A read command is answered from the channel's SRAM
+ *     register map: the first response byte is written to SPI->DR from the SPI
+ *     RXNE interrupt and the rest of the burst is streamed by TX DMA with
+ *     auto-increment through the map. Write commands are not applied to the
+ *     map; their payload is captured in the NSS transaction queue for the
+ *     plant model to interpret.
+ *
+ *     Requires slave mode, 8-bit frames, rx_nss_framing, and a channel with
+ *     both RX and TX DMA.
+ */
+typedef struct HWSPIRegisterMapConfig_T
+{
+    bool    enabled;         ///< Answer reads from the register map instead of the TX stream.
+    uint8_t command_bytes;   ///< Command length preceding the response: 1 or 2 bytes.
+    uint8_t read_flag_mask;  ///< First-byte bits that must all be set for a read; 0 = always read.
+    uint8_t address_mask;    ///< Mask applied to the last command byte to form the address.
+} HWSPIRegisterMapConfig_T;
+
 /**
  * @brief Public configuration applied to one logical SPI peripheral.
  */
 typedef struct HWSPIConfig_T
 {
-    SPIMode_T     spi_mode;   ///< Master/slave operating mode.
-    SPIDataSize_T data_size;  ///< SPI frame width.
-    SPIFirstBit_T first_bit;  ///< Bit transmission order.
-    SPIBaudRate_T baud_rate;  ///< Baud-rate enum mapped to STM32 prescaler settings.
-    SPICPOL_T     cpol;       ///< Clock polarity.
-    SPICPHA_T     cpha;       ///< Clock phase.
-    GPIOPin_T     nss_pin;    ///< Logical active-low NSS/CS pin selected for this channel.
+    SPIMode_T     spi_mode;        ///< Master/slave operating mode.
+    SPIDataSize_T data_size;       ///< SPI frame width.
+    SPIFirstBit_T first_bit;       ///< Bit transmission order.
+    SPIBaudRate_T baud_rate;       ///< Baud-rate enum mapped to STM32 prescaler settings.
+    SPICPOL_T     cpol;            ///< Clock polarity.
+    SPICPHA_T     cpha;            ///< Clock phase.
+    GPIOPin_T     nss_pin;         ///< Logical active-low NSS/CS pin selected for this channel.
+    bool          rx_nss_framing;  ///< Slave RX only: queue timestamped NSS transactions.
+    HWSPIRegisterMapConfig_T register_map;  ///< Slave only: register-map sensor emulation.
 } HWSPIConfig_T;
 
 /**
@@ -175,6 +209,45 @@ typedef struct
     uint32_t      total_length_bytes;  ///< Total unread byte count across both spans.
 } HWSPIRxSpans_T;
 
+/**
+ * @brief One completed NSS-framed slave RX transaction.
+ *
+ * @details
+ *     Timestamps are raw core cycle counts from HW_TIMER_Get_Cycle_Count(),
+ *     captured at the top of the NSS EXTI interrupt. They therefore include the
+ *     EXTI interrupt entry latency (12 cycles plus any higher-priority ISR
+ *     time) but not the time spent reading DMA state, giving sub-microsecond
+ *     edge resolution in normal operation.
+ */
+typedef struct
+{
+    HWSPIRxSpans_T data;                       ///< Transaction bytes as one or two spans.
+    uint32_t       assert_timestamp_cycles;    ///< Cycle count at the NSS falling edge.
+    uint32_t       deassert_timestamp_cycles;  ///< Cycle count at the NSS rising edge.
+    uint32_t dropped_transactions;  ///< Transactions lost to a full descriptor queue since start.
+} HWSPIRxTransaction_T;
+
+/**
+ * @brief Register-map emulation counters for one SPI channel.
+ *
+ * @details
+ *     Turnaround is measured in core cycles from entry of the SPI RXNE
+ *     interrupt to the write of the first response byte into SPI->DR. Add the
+ *     12-cycle exception entry to get the delay from the end of the command
+ *     byte. A response is counted late when another frame had already been
+ *     received by the time SPI->DR was written, meaning the DUT clocked the
+ *     first response byte before it was loaded.
+ */
+typedef struct HWSPIRegisterMapStats_T
+{
+    uint32_t read_commands;           ///< Read commands answered from the register map.
+    uint32_t write_commands;          ///< Write commands captured without a response.
+    uint32_t late_responses;          ///< Reads whose first byte missed the inter-byte gap.
+    uint32_t commit_retries;          ///< Commits refused because a burst was in progress.
+    uint32_t last_turnaround_cycles;  ///< Most recent RXNE-to-DR turnaround.
+    uint32_t max_turnaround_cycles;   ///< Worst RXNE-to-DR turnaround since configuration.
+} HWSPIRegisterMapStats_T;
+
 /**-----------------------------------------------------------------------------
  *  Public Function Prototypes
  *------------------------------------------------------------------------------
@@ -328,6 +401,42 @@ HWSPIRxSpans_T HW_SPI_Rx_Peek( SPIChannel_T peripheral );
  */
 void HW_SPI_Rx_Consume( SPIChannel_T peripheral, uint32_t bytes_to_consume );
 
+/**
+ * @brief Return the oldest completed NSS-framed RX transaction without consuming it.
+ *
+ * Only available on slave channels configured with rx_nss_framing. Every NSS
+ * assert/deassert pair observed while the channel is started produces one
+ * transaction descriptor holding the RX byte range and both edge timestamps.
+ * A transaction that is still in progress (NSS low) is never returned.
+ *
+ * Transactions must be shorter than the RX buffer for their byte range to be
+ * meaningful. If both NSS edges are coalesced into a single EXTI interrupt, the
+ * driver closes the open transaction at the later edge and starts the next one.
+ *
+ * @param peripheral
+ *     The SPI peripheral/channel to inspect.
+ *
+ * @param transaction
+ *     Receives the transaction spans and timestamps when one is available.
+ *
+ * @return
+ *     true if a completed transaction was returned; false if none is queued.
+ */
+bool HW_SPI_Rx_Peek_Transaction( SPIChannel_T peripheral, HWSPIRxTransaction_T* transaction );
+
+/**
+ * @brief Release the oldest completed NSS-framed RX transaction.
+ *
+ * Advances the RX consume position to the end of the transaction returned by
+ * HW_SPI_Rx_Peek_Transaction() and frees its descriptor. Any unread bytes that
+ * arrived before the transaction started are discarded with it. Does nothing
+ * if no completed transaction is queued.
+ *
+ * @param peripheral
+ *     The SPI peripheral/channel whose oldest transaction should be released.
+ */
+void HW_SPI_Rx_Consume_Transaction( SPIChannel_T peripheral );
+
 /**
  * @brief Load data into the channel's internal transmit queue.
  *
@@ -471,6 +580,68 @@ bool HW_SPI_Tx_Is_Complete( SPIChannel_T peripheral );
  */
 bool HW_SPI_Tx_Is_Faulted( SPIChannel_T peripheral );
 
+/**
+ * @brief Stage register values for a register-map slave channel.
+ *
+ * @details
+ *     Copies bytes into the staging copy of the register map. The DUT keeps
+ *     reading the published copy until HW_SPI_Register_Map_Commit() succeeds,
+ *     so multi-byte registers updated in the same tick are never observed
+ *     half-written. Intended to be called once per executor or plant-model
+ *     tick, from thread context.
+ *
+ * @param peripheral
+ *     Register-map slave channel to update.
+ *
+ * @param address
+ *     First register address to write.
+ *
+ * @param data
+ *     Caller-owned register values; copied before return.
+ *
+ * @param size_bytes
+ *     Number of consecutive registers to write.
+ *
+ * @return
+ *     true if the values were staged; false if the channel is not a
+ *     register-map slave or the range runs past the end of the map.
+ */
+bool HW_SPI_Register_Map_Write( SPIChannel_T peripheral, uint8_t address, const uint8_t* data,
+                                uint32_t size_bytes );
+
+/**
+ * @brief Publish the staged register map to the DUT.
+ *
+ * @details
+ *     Swaps the staged and published maps, then copies the new contents back
+ *     into the staging map so later partial writes start from current values.
+ *     The swap is refused while a read burst is streaming from the published
+ *     map; the caller should retry on its next tick.
+ *
+ * @param peripheral
+ *     Register-map slave channel to publish.
+ *
+ * @return
+ *     true if the staged map is now visible to the DUT; false if the channel is
+ *     not a register-map slave or a read burst is in progress.
+ */
+bool HW_SPI_Register_Map_Commit( SPIChannel_T peripheral );
+
+/**
+ * @brief Read the register-map emulation counters for a channel.
+ *
+ * @param peripheral
+ *     Register-map slave channel to inspect.
+ *
+ * @param stats
+ *     Output for a snapshot of the channel counters.
+ *
+ * @return
+ *     true if stats was written; false if the channel is not a register-map
+ *     slave or stats is NULL.
+ */
+bool HW_SPI_Register_Map_Get_Stats( SPIChannel_T peripheral, HWSPIRegisterMapStats_T* stats );
+
 /**
  * @brief Complete slow-baud master final-drain handling from a timer ISR.
  *
@@ -38,6 +38,62 @@
 
 SPIPeripheralState_T channel_state_array[SPI_NUM_CHANNELS];
 
+// Ring storage lives outside the state blocks so each channel can be sized
+// for its traffic. SPI_DAC has no RX DMA and therefore no RX ring.
+static uint8_t spi_channel_0_rx_buffer[SPI_CHANNEL_0_RX_BUFFER_SIZE_BYTES]
+    __attribute__( ( aligned( 2 ) ) );
+static uint8_t spi_channel_0_tx_buffer[SPI_CHANNEL_0_TX_BUFFER_SIZE_BYTES]
+    __attribute__( ( aligned( 2 ) ) );
+static uint8_t spi_channel_1_rx_buffer[SPI_CHANNEL_1_RX_BUFFER_SIZE_BYTES]
+    __attribute__( ( aligned( 2 ) ) );
+static uint8_t spi_channel_1_tx_buffer[SPI_CHANNEL_1_TX_BUFFER_SIZE_BYTES]
+    __attribute__( ( aligned( 2 ) ) );
+static uint8_t spi_dac_tx_buffer[SPI_DAC_TX_BUFFER_SIZE_BYTES] __attribute__( ( aligned( 2 ) ) );
+
+#if SPI_CHANNEL_0_REGISTER_MAP_ENABLED
+static uint8_t spi_channel_0_register_map[2][HW_SPI_REGISTER_MAP_SIZE_BYTES];
+#endif
+#if SPI_CHANNEL_1_REGISTER_MAP_ENABLED
+static uint8_t spi_channel_1_register_map[2][HW_SPI_REGISTER_MAP_SIZE_BYTES];
+#endif
+
+static SPITxPacketDescriptor_T spi_channel_0_tx_packets[SPI_CHANNEL_0_TX_PACKET_QUEUE_DEPTH];
+static SPITxPacketDescriptor_T spi_channel_1_tx_packets[SPI_CHANNEL_1_TX_PACKET_QUEUE_DEPTH];
+static SPITxPacketDescriptor_T spi_dac_tx_packets[SPI_DAC_TX_PACKET_QUEUE_DEPTH];
+
+static uint8_t* const SPI_RX_BUFFER_ARRAY[SPI_NUM_CHANNELS] = {
+    [SPI_CHANNEL_0] = spi_channel_0_rx_buffer,
+    [SPI_CHANNEL_1] = spi_channel_1_rx_buffer,
+    [SPI_DAC]       = NULL,
+};
+
+static uint8_t* const SPI_TX_BUFFER_ARRAY[SPI_NUM_CHANNELS] = {
+    [SPI_CHANNEL_0] = spi_channel_0_tx_buffer,
+    [SPI_CHANNEL_1] = spi_channel_1_tx_buffer,
+    [SPI_DAC]       = spi_dac_tx_buffer,
+};
+
+static SPITxPacketDescriptor_T* const SPI_TX_PACKET_ARRAY[SPI_NUM_CHANNELS] = {
+    [SPI_CHANNEL_0] = spi_channel_0_tx_packets,
+    [SPI_CHANNEL_1] = spi_channel_1_tx_packets,
+    [SPI_DAC]       = spi_dac_tx_packets,
+};
+
+static uint8_t ( *const SPI_REGISTER_MAP_ARRAY[SPI_NUM_CHANNELS] )
+    [HW_SPI_REGISTER_MAP_SIZE_BYTES] = {
+#if SPI_CHANNEL_0_REGISTER_MAP_ENABLED
+    [SPI_CHANNEL_0] = spi_channel_0_register_map,
+#else
+    [SPI_CHANNEL_0] = NULL,
+#endif
+#if SPI_CHANNEL_1_REGISTER_MAP_ENABLED
+    [SPI_CHANNEL_1] = spi_channel_1_register_map,
+#else
+    [SPI_CHANNEL_1] = NULL,
+#endif
+    [SPI_DAC]       = NULL,
+};
+
 static SPI_HandleTypeDef* const SPI_HAL_HANDLE_ARRAY[SPI_NUM_CHANNELS] = {
     [SPI_CHANNEL_0] = &SPI_CHANNEL_0_HANDLE,
     [SPI_CHANNEL_1] = &SPI_CHANNEL_1_HANDLE,
@@ -80,6 +136,12 @@ static const IRQn_Type SPI_TX_DMA_IRQN_ARRAY[SPI_NUM_CHANNELS] = {
     [SPI_DAC]       = SPI_DAC_TX_DMA_IRQN,
 };
 
+static const IRQn_Type SPI_IRQN_ARRAY[SPI_NUM_CHANNELS] = {
+    [SPI_CHANNEL_0] = SPI_CHANNEL_0_IRQN,
+    [SPI_CHANNEL_1] = SPI_CHANNEL_1_IRQN,
+    [SPI_DAC]       = SPI_DAC_IRQN,
+};
+
 static const Timer_T SPI_FINAL__DRAIN_TIMER_ARRAY[SPI_NUM_CHANNELS] = {
     [SPI_CHANNEL_0] = SPI_CHANNEL_0_TIMER,
     [SPI_CHANNEL_1] = SPI_CHANNEL_1_TIMER,
@@ -159,6 +221,71 @@ static bool HW_SPI_Config_Is_Valid_NSS( SPIChannel_T         peripheral,
     }
 }
 
+static bool HW_SPI_Config_Is_Valid_Framing( SPIChannel_T         peripheral,
+                                            const HWSPIConfig_T* configuration )
+{
+    if ( configuration->rx_nss_framing == false )
+    {
+        return true;
+    }
+
+    // NSS framing needs an externally driven NSS and an RX DMA ring to index.
+    return configuration->spi_mode == SPI_SLAVE_MODE
+           && SPI_RX_DMA_ARRAY[( uint32_t )peripheral] != NULL;
+}
+
+static bool HW_SPI_Config_Is_Valid_Register_Map( SPIChannel_T         peripheral,
+                                                 const HWSPIConfig_T* configuration )
+{
+    const HWSPIRegisterMapConfig_T* register_map = &( configuration->register_map );
+
+    if ( register_map->enabled == false )
+    {
+        return true;
+    }
+
+    // The command is decoded from NSS-framed RX data and answered over TX DMA,
+    // one byte per register.
+    return configuration->spi_mode == SPI_SLAVE_MODE && configuration->rx_nss_framing
+           && configuration->data_size == SPI_SIZE_8_BIT
+           && SPI_RX_DMA_ARRAY[( uint32_t )peripheral] != NULL
+           && SPI_TX_DMA_ARRAY[( uint32_t )peripheral] != NULL
+           && SPI_REGISTER_MAP_ARRAY[( uint32_t )peripheral] != NULL
+           && register_map->command_bytes >= 1U && register_map->command_bytes <= 2U;
+}
+
+static void HW_SPI_Config_Set_NSS_Framing_IRQ( SPIChannel_T peripheral, bool enable )
+{
+    IRQn_Type irqn;
+
+    switch ( peripheral )
+    {
+        case SPI_CHANNEL_0:
+            irqn = SPI_CHANNEL_0_NSS_EXTI_IRQN;
+            break;
+        case SPI_CHANNEL_1:
+            irqn = SPI_CHANNEL_1_NSS_EXTI_IRQN;
+            break;
+        case SPI_DAC:
+        case SPI_NUM_CHANNELS:
+        default:
+            return;
+    }
+
+    if ( enable == false )
+    {
+        NVIC_DisableIRQ( irqn );
+        return;
+    }
+
+    HW_TIMER_Start_Cycle_Counter();
+
+    // Same level as the SPI DMA streams, so an edge cannot preempt DMA service
+    // (or the register-map RXNE ISR) in the middle of a channel state update.
+    NVIC_SetPriority( irqn, SPI_IRQ_PRIORITY );
+    NVIC_EnableIRQ( irqn );
+}
+
 static bool HW_SPI_Config_Build_HAL_Init( const HWSPIConfig_T* configuration,
                                           SPI_InitTypeDef*     requested_init )
 {
@@ -285,6 +412,14 @@ static bool HW_SPI_Config_Channel_Is_Stopped( const SPIPeripheralState_T* periph
 
 static bool HW_SPI_Config_Apply_GPIO( const HWSPIConfig_T* configuration )
 {
+    // NSS edge interrupts are only wanted while the pin is a framed slave input.
+    if ( HW_GPIO_Configure_Pin_Edge_Interrupt( configuration->nss_pin,
+                                               configuration->rx_nss_framing )
+         == false )
+    {
+        return false;
+    }
+
     if ( configuration->spi_mode == SPI_MASTER_MODE )
     {
         return HW_GPIO_Configure_Pin_As_Output( configuration->nss_pin, true );
@@ -338,6 +473,29 @@ SPIPeripheralState_T* HW_SPI_Get_State( SPIChannel_T peripheral )
     return &( channel_state_array[( uint32_t )peripheral] );
 }
 
+/**
+ * @brief Point a channel state block at its compile-time sized ring storage.
+ *
+ * @details
+ *     Only the storage pointers are bound here. The wrap masks stay
+ *     compile-time constants selected per channel by HW_SPI_*_Index_Mask().
+ *
+ * @param peripheral_state
+ *     State block to bind.
+ *
+ * @param peripheral
+ *     Logical SPI channel that owns the storage.
+ */
+void HW_SPI_Bind_Channel_Storage( SPIPeripheralState_T* peripheral_state, SPIChannel_T peripheral )
+{
+    uint32_t channel_index = ( uint32_t )peripheral;
+
+    peripheral_state->rx_buffer             = SPI_RX_BUFFER_ARRAY[channel_index];
+    peripheral_state->tx_buffer             = SPI_TX_BUFFER_ARRAY[channel_index];
+    peripheral_state->tx_packet_descriptors = SPI_TX_PACKET_ARRAY[channel_index];
+    peripheral_state->register_map          = SPI_REGISTER_MAP_ARRAY[channel_index];
+}
+
 /**
  * @brief Configure DMA memory/peripheral data widths to match the SPI frame size.
  *
@@ -437,6 +595,7 @@ bool HW_SPI_Configure_Channel( SPIChannel_T peripheral, HWSPIConfig_T configurat
     SPI_InitTypeDef       previous_init;
     SPI_TypeDef*          previous_instance;
     bool                  had_previous_configuration;
+    bool                  had_previous_nss_framing;
 
     if ( HW_SPI_Is_Valid_Channel( peripheral ) == false )
     {
@@ -448,6 +607,8 @@ bool HW_SPI_Configure_Channel( SPIChannel_T peripheral, HWSPIConfig_T configurat
     // Validate the complete request without touching the HAL handle, GPIO
     // ownership, or stored channel state.
     if ( HW_SPI_Config_Is_Valid_NSS( peripheral, &configuration ) == false
+         || HW_SPI_Config_Is_Valid_Framing( peripheral, &configuration ) == false
+         || HW_SPI_Config_Is_Valid_Register_Map( peripheral, &configuration ) == false
          || HW_SPI_Config_Build_HAL_Init( &configuration, &requested_init ) == false
          || HW_SPI_Config_Channel_Is_Stopped( peripheral_state ) == false )
     {
@@ -458,6 +619,7 @@ bool HW_SPI_Configure_Channel( SPIChannel_T peripheral, HWSPIConfig_T configurat
     previous_init              = hspi->Init;
     previous_instance          = hspi->Instance;
     had_previous_configuration = peripheral_state->is_configured;
+    had_previous_nss_framing   = had_previous_configuration && peripheral_state->rx_nss_framing;
 
     // A stopped master must already be inactive, but explicitly release the old
     // line before its ownership or the selected CS changes.
@@ -468,6 +630,14 @@ bool HW_SPI_Configure_Channel( SPIChannel_T peripheral, HWSPIConfig_T configurat
         HW_GPIO_Set_Pin( peripheral_state->nss_pin );
     }
 
+    // Likewise stop edge interrupts on an old framed NSS input before it is
+    // handed to a different owner.
+    if ( had_previous_configuration && peripheral_state->rx_nss_framing
+         && configuration.nss_pin != peripheral_state->nss_pin )
+    {
+        ( void )HW_GPIO_Configure_Pin_Edge_Interrupt( peripheral_state->nss_pin, false );
+    }
+
     hspi->Instance = SPI_INSTANCE_ARRAY[( uint32_t )peripheral];
     hspi->Init     = requested_init;
 
@@ -496,10 +666,17 @@ bool HW_SPI_Configure_Channel( SPIChannel_T peripheral, HWSPIConfig_T configurat
     // Commit driver-visible state only after both SPI and GPIO configuration
     // have succeeded.
     memcpy( &( peripheral_state->config ), &configuration, sizeof( HWSPIConfig_T ) );
-    peripheral_state->nss_pin       = configuration.nss_pin;
-    peripheral_state->is_configured = true;
-    peripheral_state->is_started    = false;
-    peripheral_state->cs_asserted   = false;
+    peripheral_state->nss_pin        = configuration.nss_pin;
+    peripheral_state->is_configured  = true;
+    peripheral_state->is_started     = false;
+    peripheral_state->cs_asserted    = false;
+    peripheral_state->rx_nss_framing = configuration.rx_nss_framing;
+    HW_SPI_RX_Reset_Transactions( peripheral_state );
+
+    peripheral_state->register_map_enabled        = configuration.register_map.enabled;
+    peripheral_state->register_map_command_bytes  = configuration.register_map.command_bytes;
+    peripheral_state->register_map_read_flag_mask = configuration.register_map.read_flag_mask;
+    peripheral_state->register_map_address_mask   = configuration.register_map.address_mask;
 
     peripheral_state->rx_dma         = SPI_RX_DMA_ARRAY[( uint32_t )peripheral];
     peripheral_state->rx_dma_stream  = SPI_RX_DMA_STREAM_ARRAY[( uint32_t )peripheral];
@@ -507,7 +684,10 @@ bool HW_SPI_Configure_Channel( SPIChannel_T peripheral, HWSPIConfig_T configurat
     peripheral_state->tx_dma_stream  = SPI_TX_DMA_STREAM_ARRAY[( uint32_t )peripheral];
     peripheral_state->spi_peripheral = SPI_INSTANCE_ARRAY[( uint32_t )peripheral];
     peripheral_state->tx_dma_irqn    = SPI_TX_DMA_IRQN_ARRAY[( uint32_t )peripheral];
+    peripheral_state->spi_irqn       = SPI_IRQN_ARRAY[( uint32_t )peripheral];
 
+    HW_SPI_Bind_Channel_Storage( peripheral_state, peripheral );
+    HW_SPI_Register_Map_Reset( peripheral_state );
     HW_SPI_Config_Precompute_Hot_Fields( peripheral_state, peripheral, configuration );
     HW_SPI_TX_Configure_Timer( peripheral_state );
     HW_SPI_TX_Reset_State( peripheral_state );
@@ -515,6 +695,21 @@ bool HW_SPI_Configure_Channel( SPIChannel_T peripheral, HWSPIConfig_T configurat
     // Ensure DMA memory/peripheral data widths match the configured SPI frame size.
     HW_SPI_Configure_DMA_Data_Widths( peripheral_state );
 
+    if ( configuration.rx_nss_framing )
+    {
+        HW_SPI_Config_Set_NSS_Framing_IRQ( peripheral, true );
+    }
+    else if ( had_previous_nss_framing )
+    {
+        HW_SPI_Config_Set_NSS_Framing_IRQ( peripheral, false );
+    }
+
+    // RXNEIE itself is only set per transaction by the NSS assert hook.
+    if ( configuration.register_map.enabled )
+    {
+        NVIC_EnableIRQ( peripheral_state->spi_irqn );
+    }
+
     return true;
 }
 
@@ -560,6 +755,14 @@ bool HW_SPI_Stop_Channel( SPIChannel_T peripheral )
 
     stop_status = HAL_SPI_DMAStop( SPI_HAL_HANDLE_ARRAY[( uint32_t )peripheral] );
 
+    // HAL_SPI_DMAStop() has stopped any read burst; disarm command detection so
+    // a late NSS assert cannot re-enter the register-map ISR.
+    if ( peripheral_state->register_map_enabled )
+    {
+        LL_SPI_DisableIT_RXNE( peripheral_state->spi_peripheral );
+        peripheral_state->register_map_burst_active = false;
+    }
+
     // CS safety is independent of whether HAL could fully stop the DMA path.
     if ( peripheral_state->is_master )
     {
@@ -90,15 +90,87 @@ extern "C"
 #define SPI_DAC_TX_DMA_CLEAR_TC LL_DMA_ClearFlag_TC1
 #define SPI_DAC_TX_DMA_CLEAR_TE LL_DMA_ClearFlag_TE1
 
-#define RX_BUFFER_SIZE_BYTES 1024U
-#define TX_BUFFER_SIZE_BYTES 1024U
-#define TX_PACKET_QUEUE_DEPTH 16U
+// NSS edge interrupts used for slave RX transaction framing. EXTI15_10 is
+// shared with PE11 (SPI4 NSS), but SPI_DAC is master-only and never enables it.
+#define SPI_CHANNEL_0_NSS_EXTI_IRQ EXTI4_IRQHandler
+#define SPI_CHANNEL_0_NSS_EXTI_IRQN EXTI4_IRQn
+#define SPI_CHANNEL_1_NSS_EXTI_IRQ EXTI15_10_IRQHandler
+#define SPI_CHANNEL_1_NSS_EXTI_IRQN EXTI15_10_IRQn
+
+// NVIC priority for interrupts enabled by this driver. Matches the CubeMX SPI
+// DMA streams (dma.c) and stays below configMAX_SYSCALL_INTERRUPT_PRIORITY.
+#define SPI_IRQ_PRIORITY 5U
+
+// SPI global interrupts, used only for the register-map command byte (RXNE).
+#define SPI_CHANNEL_0_IRQ SPI1_IRQHandler
+#define SPI_CHANNEL_0_IRQN SPI1_IRQn
+#define SPI_CHANNEL_1_IRQ SPI2_IRQHandler
+#define SPI_CHANNEL_1_IRQN SPI2_IRQn
+#define SPI_DAC_IRQN SPI4_IRQn
+
+// Per-channel ring and descriptor sizes. Each can be overridden with -D at
+// build time (the host test matrix does this); all must be powers of two.
+// SPI_CHANNEL_0 runs at up to 45 Mbit/s and gets the deep rings. SPI_DAC is
+// TX-only, so it has no RX ring and a small TX ring.
+#ifndef SPI_CHANNEL_0_RX_BUFFER_SIZE_BYTES
+#define SPI_CHANNEL_0_RX_BUFFER_SIZE_BYTES 4096U
+#endif
+#ifndef SPI_CHANNEL_0_TX_BUFFER_SIZE_BYTES
+#define SPI_CHANNEL_0_TX_BUFFER_SIZE_BYTES 2048U
+#endif
+#ifndef SPI_CHANNEL_0_TX_PACKET_QUEUE_DEPTH
+#define SPI_CHANNEL_0_TX_PACKET_QUEUE_DEPTH 32U
+#endif
+#ifndef SPI_CHANNEL_1_RX_BUFFER_SIZE_BYTES
+#define SPI_CHANNEL_1_RX_BUFFER_SIZE_BYTES 1024U
+#endif
+#ifndef SPI_CHANNEL_1_TX_BUFFER_SIZE_BYTES
+#define SPI_CHANNEL_1_TX_BUFFER_SIZE_BYTES 1024U
+#endif
+#ifndef SPI_CHANNEL_1_TX_PACKET_QUEUE_DEPTH
+#define SPI_CHANNEL_1_TX_PACKET_QUEUE_DEPTH 16U
+#endif
+#ifndef SPI_DAC_TX_BUFFER_SIZE_BYTES
+#define SPI_DAC_TX_BUFFER_SIZE_BYTES 256U
+#endif
+#ifndef SPI_DAC_TX_PACKET_QUEUE_DEPTH
+#define SPI_DAC_TX_PACKET_QUEUE_DEPTH 16U
+#endif
+
+// Register-map storage (two 256-byte copies) is only reserved for channels that
+// can be framed slaves. Set to 0 to reclaim it on a channel that never emulates
+// a register-map sensor. SPI_DAC is master-only and never has a map.
+#ifndef SPI_CHANNEL_0_REGISTER_MAP_ENABLED
+#define SPI_CHANNEL_0_REGISTER_MAP_ENABLED 1
+#endif
+#ifndef SPI_CHANNEL_1_REGISTER_MAP_ENABLED
+#define SPI_CHANNEL_1_REGISTER_MAP_ENABLED 1
+#endif
+
+#define SPI_CHANNEL_0_RX_BUFFER_INDEX_MASK ( SPI_CHANNEL_0_RX_BUFFER_SIZE_BYTES - 1U )
+#define SPI_CHANNEL_0_TX_BUFFER_INDEX_MASK ( SPI_CHANNEL_0_TX_BUFFER_SIZE_BYTES - 1U )
+#define SPI_CHANNEL_0_TX_PACKET_QUEUE_INDEX_MASK ( SPI_CHANNEL_0_TX_PACKET_QUEUE_DEPTH - 1U )
+#define SPI_CHANNEL_1_RX_BUFFER_INDEX_MASK ( SPI_CHANNEL_1_RX_BUFFER_SIZE_BYTES - 1U )
+#define SPI_CHANNEL_1_TX_BUFFER_INDEX_MASK ( SPI_CHANNEL_1_TX_BUFFER_SIZE_BYTES - 1U )
+#define SPI_CHANNEL_1_TX_PACKET_QUEUE_INDEX_MASK ( SPI_CHANNEL_1_TX_PACKET_QUEUE_DEPTH - 1U )
+#define SPI_DAC_TX_BUFFER_INDEX_MASK ( SPI_DAC_TX_BUFFER_SIZE_BYTES - 1U )
+#define SPI_DAC_TX_PACKET_QUEUE_INDEX_MASK ( SPI_DAC_TX_PACKET_QUEUE_DEPTH - 1U )
+
+// Largest per-channel packet queue, for scratch arrays sized at compile time.
+#define SPI_MAX_TX_PACKET_QUEUE_DEPTH                                                     \
+    ( SPI_CHANNEL_0_TX_PACKET_QUEUE_DEPTH > SPI_CHANNEL_1_TX_PACKET_QUEUE_DEPTH           \
+          ? ( SPI_CHANNEL_0_TX_PACKET_QUEUE_DEPTH > SPI_DAC_TX_PACKET_QUEUE_DEPTH         \
+                  ? SPI_CHANNEL_0_TX_PACKET_QUEUE_DEPTH                                   \
+                  : SPI_DAC_TX_PACKET_QUEUE_DEPTH )                                       \
+          : ( SPI_CHANNEL_1_TX_PACKET_QUEUE_DEPTH > SPI_DAC_TX_PACKET_QUEUE_DEPTH         \
+                  ? SPI_CHANNEL_1_TX_PACKET_QUEUE_DEPTH                                   \
+                  : SPI_DAC_TX_PACKET_QUEUE_DEPTH ) )
+
+#define RX_TRANSACTION_QUEUE_DEPTH 16U
 #define HW_SPI_DMA_DISABLE_TIMEOUT_ITERATIONS 1000U
 #define SPI_DAC_FINAL_DRAIN_TIMER_MAX_ATTEMPTS 2U
 
-#define RX_BUFFER_INDEX_MASK ( RX_BUFFER_SIZE_BYTES - 1U )
-#define TX_BUFFER_INDEX_MASK ( TX_BUFFER_SIZE_BYTES - 1U )
-#define TX_PACKET_QUEUE_INDEX_MASK ( TX_PACKET_QUEUE_DEPTH - 1U )
+#define RX_TRANSACTION_QUEUE_INDEX_MASK ( RX_TRANSACTION_QUEUE_DEPTH - 1U )
 #define SPI_FINAL_DRAIN_GUARD_CYCLES 16U
 
 #ifndef HW_SPI_ALWAYS_INLINE
@@ -109,26 +181,61 @@ extern "C"
 #define HW_SPI_COLD_NOINLINE __attribute__( ( cold, noinline ) )
 #endif
 
-#if RX_BUFFER_SIZE_BYTES % 2 != 0
-#error "RX Buffer Must be a size that is a multiple of 2"
+#define HW_SPI_IS_POWER_OF_TWO( value ) \
+    ( ( value ) != 0U && ( ( value ) & ( ( value ) - 1U ) ) == 0U )
+
+#if !HW_SPI_IS_POWER_OF_TWO( SPI_CHANNEL_0_RX_BUFFER_SIZE_BYTES ) \
+    || !HW_SPI_IS_POWER_OF_TWO( SPI_CHANNEL_1_RX_BUFFER_SIZE_BYTES )
+#error "RX Buffer size must be a power of two for mask-based wrapping"
 #endif
 
-#if TX_BUFFER_SIZE_BYTES % 2 != 0
-#error "TX Buffer Must be a size that is a multiple of 2"
+#if !HW_SPI_IS_POWER_OF_TWO( SPI_CHANNEL_0_TX_BUFFER_SIZE_BYTES ) \
+    || !HW_SPI_IS_POWER_OF_TWO( SPI_CHANNEL_1_TX_BUFFER_SIZE_BYTES ) \
+    || !HW_SPI_IS_POWER_OF_TWO( SPI_DAC_TX_BUFFER_SIZE_BYTES )
+#error "TX Buffer size must be a power of two for mask-based wrapping"
 #endif
 
-#if ( RX_BUFFER_SIZE_BYTES & ( RX_BUFFER_SIZE_BYTES - 1U ) ) != 0
-#error "RX Buffer size must be a power of two for mask-based wrapping"
+// 16-bit frames need an even ring; NDTR and the uint16_t descriptor indices
+// need the ring to fit in 16 bits.
+#if SPI_CHANNEL_0_RX_BUFFER_SIZE_BYTES < 2U || SPI_CHANNEL_1_RX_BUFFER_SIZE_BYTES < 2U     \
+    || SPI_CHANNEL_0_TX_BUFFER_SIZE_BYTES < 2U || SPI_CHANNEL_1_TX_BUFFER_SIZE_BYTES < 2U \
+    || SPI_DAC_TX_BUFFER_SIZE_BYTES < 2U
+#error "SPI buffers must hold at least one 16-bit frame"
 #endif
 
-#if ( TX_BUFFER_SIZE_BYTES & ( TX_BUFFER_SIZE_BYTES - 1U ) ) != 0
-#error "TX Buffer size must be a power of two for mask-based wrapping"
+#if SPI_CHANNEL_0_RX_BUFFER_SIZE_BYTES > 32768U || SPI_CHANNEL_1_RX_BUFFER_SIZE_BYTES > 32768U \
+    || SPI_CHANNEL_0_TX_BUFFER_SIZE_BYTES > 32768U                                             \
+    || SPI_CHANNEL_1_TX_BUFFER_SIZE_BYTES > 32768U || SPI_DAC_TX_BUFFER_SIZE_BYTES > 32768U
+#error "SPI buffers must fit in uint16_t descriptor indices"
 #endif
 
-#if ( TX_PACKET_QUEUE_DEPTH & ( TX_PACKET_QUEUE_DEPTH - 1U ) ) != 0
+#if !HW_SPI_IS_POWER_OF_TWO( SPI_CHANNEL_0_TX_PACKET_QUEUE_DEPTH ) \
+    || !HW_SPI_IS_POWER_OF_TWO( SPI_CHANNEL_1_TX_PACKET_QUEUE_DEPTH ) \
+    || !HW_SPI_IS_POWER_OF_TWO( SPI_DAC_TX_PACKET_QUEUE_DEPTH )
 #error "TX packet queue depth must be a power of two for mask-based wrapping"
 #endif
 
+// exec_analogue_output queues its 11-frame DAC startup as one packet batch.
+#if SPI_DAC_TX_PACKET_QUEUE_DEPTH < 16U
+#error "SPI_DAC packet queue must hold the DAC startup sequence"
+#endif
+
+#if SPI_MAX_TX_PACKET_QUEUE_DEPTH > 128U
+#error "TX packet queue positions are uint8_t; depth must not exceed 128"
+#endif
+
+#if ( RX_TRANSACTION_QUEUE_DEPTH & ( RX_TRANSACTION_QUEUE_DEPTH - 1U ) ) != 0
+#error "RX transaction queue depth must be a power of two for mask-based wrapping"
+#endif
+
+#if HW_SPI_REGISTER_MAP_SIZE_BYTES != 256U
+#error "Register map must cover exactly the 8-bit register address space"
+#endif
+
+#ifndef HW_SPI_COMPILER_BARRIER
+#define HW_SPI_COMPILER_BARRIER() __asm volatile( "" ::: "memory" )
+#endif
+
 #define HW_SPI_STATE( peripheral ) ( &channel_state_array[( uint32_t )( peripheral )] )
 
 /**-----------------------------------------------------------------------------
@@ -151,6 +258,22 @@ typedef struct SPITxPacketDescriptor_T
     uint16_t size_bytes;   ///< Number of bytes in this packet; must be frame aligned.
 } SPITxPacketDescriptor_T;
 
+/**
+ * @brief Describes one completed NSS-framed slave RX transaction.
+ *
+ * @details
+ *     Written only by the NSS EXTI ISR and read only by task context. The byte
+ *     range refers to rx_buffer and is captured from the RX DMA NDTR at each
+ *     edge, so no data is copied out of the DMA ring.
+ */
+typedef struct SPIRxTransactionDescriptor_T
+{
+    uint16_t start_index;                ///< rx_buffer byte index at the NSS falling edge.
+    uint16_t size_bytes;                 ///< Bytes received while NSS was low.
+    uint32_t assert_timestamp_cycles;    ///< Cycle count at the NSS falling edge.
+    uint32_t deassert_timestamp_cycles;  ///< Cycle count at the NSS rising edge.
+} SPIRxTransactionDescriptor_T;
+
 /**
  * @brief Tracks the electrical completion state of a master TX transaction.
  *
@@ -196,12 +319,41 @@ struct SPIPeripheralState_T
     Timer_T      tx_final_drain_timer;       ///< One-shot timer used for slow-baud final drain.
     uint8_t      tx_final_drain_timer_attempts;  ///< Bounded SPI_DAC drain intervals elapsed.
 
-    uint8_t rx_buffer[RX_BUFFER_SIZE_BYTES]
-        __attribute__( ( aligned( 2 ) ) );  ///< DMA-backed circular RX buffer.
+    // Ring storage is per channel and sized at compile time. The pointers are
+    // bound once by HW_SPI_Bind_Channel_Storage(); the wrap masks are not stored
+    // here but come from the HW_SPI_*_Index_Mask() constants for the channel.
+    uint8_t* rx_buffer;    ///< DMA-backed circular RX buffer; NULL without RX DMA.
     uint32_t rx_position;  ///< Software consume index into rx_buffer, expressed in bytes.
 
-    uint8_t tx_buffer[TX_BUFFER_SIZE_BYTES]
-        __attribute__( ( aligned( 2 ) ) );  ///< Software TX queue storage.
+    // Slave NSS framing. The EXTI ISR is the only writer of the open-transaction
+    // fields and rx_transaction_write_count; task context only advances
+    // rx_transaction_read_count. Counts are free-running and masked on access.
+    bool     rx_nss_framing;                   ///< NSS edges delimit RX transactions.
+    bool     rx_transaction_open;              ///< NSS is currently asserted.
+    uint16_t rx_transaction_start_index;       ///< rx_buffer index of the open transaction.
+    uint16_t rx_transaction_end_index;         ///< rx_buffer index of the last closing edge.
+    uint32_t rx_transaction_assert_timestamp;  ///< Cycle count of the open transaction.
+    SPIRxTransactionDescriptor_T
+        rx_transaction_descriptors[RX_TRANSACTION_QUEUE_DEPTH];  ///< Completed transactions.
+    volatile uint32_t rx_transaction_write_count;  ///< Descriptors produced by the ISR.
+    volatile uint32_t rx_transaction_read_count;   ///< Descriptors released by the consumer.
+    uint32_t          rx_transactions_dropped;     ///< Transactions lost to a full queue.
+
+    // Register-map slave emulation. The SPI RXNE ISR reads the command from
+    // rx_buffer and serves the burst from register_map[register_map_active];
+    // thread context only writes the other copy and swaps them on commit while
+    // the SPI IRQ is masked and no burst is active.
+    bool     register_map_enabled;         ///< Reads are answered from the register map.
+    uint8_t  register_map_command_bytes;   ///< Command bytes preceding the response.
+    uint8_t  register_map_read_flag_mask;  ///< First-byte bits identifying a read.
+    uint8_t  register_map_address_mask;    ///< Last-byte mask selecting the register.
+    volatile uint8_t register_map_active;        ///< Map index currently visible to the DUT.
+    volatile bool    register_map_burst_active;  ///< TX DMA is streaming a read burst.
+    uint8_t ( *register_map )[HW_SPI_REGISTER_MAP_SIZE_BYTES];  ///< Published/staging maps.
+    HWSPIRegisterMapStats_T register_map_stats;  ///< Turnaround and command counters.
+    IRQn_Type               spi_irqn;            ///< NVIC IRQn for the SPI global interrupt.
+
+    uint8_t* tx_buffer;                     ///< Software TX queue storage.
     uint32_t tx_write_position;             ///< Next byte index to write when loading TX data.
     uint32_t tx_read_position;              ///< Next byte index to hand to DMA.
     uint32_t tx_num_bytes_pending;          ///< Bytes queued in software but not yet owned by DMA.
@@ -213,7 +365,7 @@ struct SPIPeripheralState_T
     // immediately making the channel idle. Slave mode leaves this state idle.
     HWSPI_TX_Transaction_State_T tx_transaction_state;
 
-    SPITxPacketDescriptor_T tx_packet_descriptors[TX_PACKET_QUEUE_DEPTH];  ///< Master packet queue.
+    SPITxPacketDescriptor_T* tx_packet_descriptors;    ///< Master packet queue.
     uint8_t                 tx_packet_write_position;  ///< Next descriptor slot to fill.
     uint8_t                 tx_packet_read_position;   ///< Next descriptor slot to start via DMA.
     uint8_t tx_num_packets_pending;  ///< Number of queued master packet descriptors.
@@ -279,25 +431,130 @@ HW_SPI_TX_Get_Used_Space_Fast( const SPIPeripheralState_T* peripheral_state )
     return peripheral_state->tx_num_bytes_pending + peripheral_state->tx_num_bytes_in_transmission;
 }
 
-HW_SPI_ALWAYS_INLINE uint32_t
-HW_SPI_TX_Get_Free_Space_Fast( const SPIPeripheralState_T* peripheral_state )
+/**
+ * @brief Return the compile-time RX ring wrap mask for a logical channel.
+ *
+ * @details
+ *     The ring masks are constants, not state fields. IRQ entry points pass a
+ *     literal channel into their always-inline workers, so this switch folds
+ *     away and each wrap is an AND with an immediate. Thread-context callers
+ *     pass logical_peripheral and pay one compare instead of a load.
+ *     SPI_DAC has no RX ring and reports a zero mask.
+ */
+HW_SPI_ALWAYS_INLINE uint32_t HW_SPI_RX_Buffer_Index_Mask( SPIChannel_T peripheral )
 {
-    return TX_BUFFER_SIZE_BYTES - HW_SPI_TX_Get_Used_Space_Fast( peripheral_state );
+    switch ( peripheral )
+    {
+        case SPI_CHANNEL_0:
+            return SPI_CHANNEL_0_RX_BUFFER_INDEX_MASK;
+        case SPI_CHANNEL_1:
+            return SPI_CHANNEL_1_RX_BUFFER_INDEX_MASK;
+        case SPI_DAC:
+        case SPI_NUM_CHANNELS:
+        default:
+            return 0U;
+    }
+}
+
+/**
+ * @brief Return the compile-time TX ring wrap mask for a logical channel.
+ */
+HW_SPI_ALWAYS_INLINE uint32_t HW_SPI_TX_Buffer_Index_Mask( SPIChannel_T peripheral )
+{
+    switch ( peripheral )
+    {
+        case SPI_CHANNEL_0:
+            return SPI_CHANNEL_0_TX_BUFFER_INDEX_MASK;
+        case SPI_CHANNEL_1:
+            return SPI_CHANNEL_1_TX_BUFFER_INDEX_MASK;
+        case SPI_DAC:
+            return SPI_DAC_TX_BUFFER_INDEX_MASK;
+        case SPI_NUM_CHANNELS:
+        default:
+            return 0U;
+    }
+}
+
+/**
+ * @brief Return the compile-time master packet queue wrap mask for a channel.
+ */
+HW_SPI_ALWAYS_INLINE uint32_t HW_SPI_TX_Packet_Index_Mask( SPIChannel_T peripheral )
+{
+    switch ( peripheral )
+    {
+        case SPI_CHANNEL_0:
+            return SPI_CHANNEL_0_TX_PACKET_QUEUE_INDEX_MASK;
+        case SPI_CHANNEL_1:
+            return SPI_CHANNEL_1_TX_PACKET_QUEUE_INDEX_MASK;
+        case SPI_DAC:
+            return SPI_DAC_TX_PACKET_QUEUE_INDEX_MASK;
+        case SPI_NUM_CHANNELS:
+        default:
+            return 0U;
+    }
 }
 
-HW_SPI_ALWAYS_INLINE uint32_t HW_SPI_Wrap_Tx_Buffer_Index( uint32_t index )
+HW_SPI_ALWAYS_INLINE uint32_t HW_SPI_RX_Buffer_Size_Fast( SPIChannel_T peripheral )
 {
-    return index & TX_BUFFER_INDEX_MASK;
+    return HW_SPI_RX_Buffer_Index_Mask( peripheral ) + 1U;
 }
 
-HW_SPI_ALWAYS_INLINE uint32_t HW_SPI_Wrap_Rx_Buffer_Index( uint32_t index )
+HW_SPI_ALWAYS_INLINE uint32_t HW_SPI_TX_Buffer_Size_Fast( SPIChannel_T peripheral )
 {
-    return index & RX_BUFFER_INDEX_MASK;
+    return HW_SPI_TX_Buffer_Index_Mask( peripheral ) + 1U;
 }
 
-HW_SPI_ALWAYS_INLINE uint8_t HW_SPI_Wrap_Tx_Packet_Index( uint32_t index )
+HW_SPI_ALWAYS_INLINE uint32_t HW_SPI_TX_Packet_Queue_Depth_Fast( SPIChannel_T peripheral )
 {
-    return ( uint8_t )( index & TX_PACKET_QUEUE_INDEX_MASK );
+    return HW_SPI_TX_Packet_Index_Mask( peripheral ) + 1U;
+}
+
+HW_SPI_ALWAYS_INLINE uint32_t HW_SPI_TX_Get_Free_Space_Fast(
+    SPIChannel_T peripheral, const SPIPeripheralState_T* peripheral_state )
+{
+    return HW_SPI_TX_Buffer_Size_Fast( peripheral )
+           - HW_SPI_TX_Get_Used_Space_Fast( peripheral_state );
+}
+
+HW_SPI_ALWAYS_INLINE uint32_t HW_SPI_Wrap_Tx_Buffer_Index( SPIChannel_T peripheral,
+                                                           uint32_t     index )
+{
+    return index & HW_SPI_TX_Buffer_Index_Mask( peripheral );
+}
+
+HW_SPI_ALWAYS_INLINE uint32_t HW_SPI_Wrap_Rx_Buffer_Index( SPIChannel_T peripheral,
+                                                           uint32_t     index )
+{
+    return index & HW_SPI_RX_Buffer_Index_Mask( peripheral );
+}
+
+/**
+ * @brief Convert the RX DMA NDTR into the current byte write index in rx_buffer.
+ *
+ * @details
+ *     NDTR counts down from the full buffer length to 0 and then reloads, so
+ *     subtracting the remaining count gives the DMA write index. Shared by the
+ *     stream peek path and the NSS edge ISR.
+ */
+HW_SPI_ALWAYS_INLINE uint32_t HW_SPI_RX_Get_DMA_Write_Index_Fast(
+    SPIChannel_T peripheral, const SPIPeripheralState_T* peripheral_state )
+{
+    uint32_t dma_remaining_elements =
+        LL_DMA_GetDataLength( peripheral_state->rx_dma, peripheral_state->rx_dma_stream );
+
+    // DMA NDTR is expressed in DMA elements, not bytes. Convert back to bytes
+    // so the software RX stream remains byte-oriented.
+    uint32_t dma_remaining_bytes =
+        HW_SPI_DMA_Elements_To_Bytes_Fast( peripheral_state, dma_remaining_elements );
+
+    return HW_SPI_Wrap_Rx_Buffer_Index(
+        peripheral, HW_SPI_RX_Buffer_Size_Fast( peripheral ) - dma_remaining_bytes );
+}
+
+HW_SPI_ALWAYS_INLINE uint8_t HW_SPI_Wrap_Tx_Packet_Index( SPIChannel_T peripheral,
+                                                          uint32_t     index )
+{
+    return ( uint8_t )( index & HW_SPI_TX_Packet_Index_Mask( peripheral ) );
 }
 
 HW_SPI_ALWAYS_INLINE void
@@ -375,6 +632,7 @@ HW_SPI_ALWAYS_INLINE bool HW_SPI_TX_Program_DMA( SPIPeripheralState_T* periphera
  */
 SPIPeripheralState_T* HW_SPI_Get_State( SPIChannel_T peripheral );
 void                  HW_SPI_Configure_DMA_Data_Widths( SPIPeripheralState_T* peripheral_state );
+void HW_SPI_Bind_Channel_Storage( SPIPeripheralState_T* peripheral_state, SPIChannel_T peripheral );
 /** @} */
 
 /**
@@ -382,6 +640,7 @@ void                  HW_SPI_Configure_DMA_Data_Widths( SPIPeripheralState_T* pe
  * @{
  */
 bool HW_SPI_RX_Start_Passive_DMA( SPIPeripheralState_T* peripheral_state );
+void HW_SPI_RX_Reset_Transactions( SPIPeripheralState_T* peripheral_state );
 /** @} */
 
 /**
@@ -404,7 +663,6 @@ bool HW_SPI_TX_Load_Master_Packet( SPIPeripheralState_T* peripheral_state, const
                                    uint32_t size );
 bool HW_SPI_TX_Load_Master_Packets( SPIPeripheralState_T* peripheral_state, const uint8_t* data,
                                     uint32_t packet_size_bytes, uint32_t packet_count );
-bool HW_SPI_TX_Start_Master_Packet_DMA( SPIPeripheralState_T* peripheral_state );
 /** @} */
 
 /**
@@ -413,8 +671,172 @@ bool HW_SPI_TX_Start_Master_Packet_DMA( SPIPeripheralState_T* peripheral_state )
  */
 bool HW_SPI_TX_Load_Slave_Stream( SPIPeripheralState_T* peripheral_state, const uint8_t* data,
                                   uint32_t size );
-bool HW_SPI_TX_Start_Slave_Stream_DMA( SPIPeripheralState_T* peripheral_state );
 /** @} */
+
+/**
+ * @name Slave register-map emulation hooks
+ * @{
+ */
+void HW_SPI_Register_Map_Reset( SPIPeripheralState_T* peripheral_state );
+void HW_SPI_Register_Map_NSS_Assert_From_ISR( SPIPeripheralState_T* peripheral_state );
+void HW_SPI_Register_Map_NSS_Deassert_From_ISR( SPIPeripheralState_T* peripheral_state );
+/** @} */
+
+/**-----------------------------------------------------------------------------
+ *  Internal TX Start Inline Helpers
+ *------------------------------------------------------------------------------
+ *
+ * These are entered from the TX DMA IRQ for every packet or stream span. They
+ * live here rather than in the master/slave translation units so the IRQ entry
+ * points can inline them with a literal channel and wrap with constant masks.
+ */
+
+/**
+ * @brief Start a master-mode TX DMA transfer for exactly one queued packet.
+ *
+ * @details
+ *     Master TX progresses from the packet descriptor queue. Starting a packet
+ *     consumes one descriptor, moves the packet bytes from pending to in-flight,
+ *     asserts software CS, and arms one TX DMA transfer. The DMA completion path
+ *     is responsible for final-drain handling and CS release.
+ *
+ * @param peripheral
+ *     Logical SPI peripheral. A literal from the DMA IRQ entry point, so the
+ *     ring masks fold to constants.
+ *
+ * @param peripheral_state
+ *     SPI channel state containing the queued packet and DMA resources.
+ *
+ * @return
+ *     true when one packet was successfully handed to DMA; false if no packet
+ *     was available, another transaction was active, or DMA setup failed.
+ */
+HW_SPI_ALWAYS_INLINE bool
+HW_SPI_TX_Start_Master_Packet_DMA( SPIChannel_T          peripheral,
+                                   SPIPeripheralState_T* peripheral_state )
+{
+    if ( peripheral_state->tx_num_bytes_in_transmission > 0U
+         || peripheral_state->tx_transaction_state != HW_SPI_TX_TRANSACTION_IDLE )
+    {
+        return false;
+    }
+
+    // Check if there are any packets pending
+    if ( peripheral_state->tx_num_packets_pending == 0U )
+    {
+        return false;
+    }
+
+    SPITxPacketDescriptor_T* packet =
+        &( peripheral_state->tx_packet_descriptors[peripheral_state->tx_packet_read_position] );
+
+    if ( packet->size_bytes == 0U )
+    {
+        return false;
+    }
+
+    uint32_t packet_size_bytes = packet->size_bytes;
+    uint8_t* tx_ptr            = &( peripheral_state->tx_buffer[packet->start_index] );
+
+    // Mark the transaction as DMA-active before enabling DMA. The DMA TC IRQ
+    // may run very soon after LL_SPI_EnableDMAReq_TX(), especially for short
+    // packets, so the IRQ must not observe the transaction as idle.
+    // The packet descriptor and pending byte counts are not consumed until DMA
+    // programming succeeds.
+    peripheral_state->tx_num_bytes_in_transmission = packet_size_bytes;
+    peripheral_state->tx_transaction_state         = HW_SPI_TX_TRANSACTION_DMA_ACTIVE;
+
+    // Master software CS is asserted immediately before arming the DMA transfer
+    // for this packet. The actual GPIO access is intentionally hidden behind
+    // HW_SPI_TX_Master_CS_Assert(), which should call the separate GPIO driver.
+    HW_SPI_TX_Master_CS_Assert( peripheral_state );
+
+    if ( HW_SPI_TX_Program_DMA( peripheral_state, tx_ptr, packet_size_bytes ) == false )
+    {
+        HW_SPI_TX_Master_CS_Deassert( peripheral_state );
+        peripheral_state->tx_transaction_state         = HW_SPI_TX_TRANSACTION_ERROR;
+        peripheral_state->tx_num_bytes_in_transmission = 0U;
+        return false;
+    }
+
+    // Move exactly this packet out of the pending software state and into the
+    // in-flight DMA state. The descriptor is consumed after DMA is armed. The
+    // DMA completion IRQ must not start another packet until the automatic-CS
+    // completion path has waited for the final SPI frame to drain and released
+    // CS for this packet.
+    peripheral_state->tx_packet_read_position =
+        HW_SPI_Wrap_Tx_Packet_Index( peripheral, peripheral_state->tx_packet_read_position + 1U );
+    peripheral_state->tx_num_packets_pending--;
+
+    peripheral_state->tx_num_bytes_pending =
+        peripheral_state->tx_num_bytes_pending - packet_size_bytes;
+
+    peripheral_state->tx_read_position =
+        HW_SPI_Wrap_Tx_Buffer_Index( peripheral, packet->start_index + packet_size_bytes );
+
+    // Descriptor clearing is for debug/readability only. Descriptor ownership is
+    // controlled by tx_packet_read_position and tx_num_packets_pending.
+    packet->start_index = 0U;
+    packet->size_bytes  = 0U;
+
+    return true;
+}
+
+/**
+ * @brief Start a slave-mode TX DMA transfer for the next contiguous stream span.
+ *
+ * @details
+ *     This is the original byte-stream behaviour separated from master packet
+ *     TX. The function hands one contiguous span to DMA, updates the TX ring
+ *     positions, and leaves any wrapped remainder pending for a later DMA TC
+ *     re-arm.
+ *
+ * @param peripheral
+ *     Logical SPI peripheral. A literal from the DMA IRQ entry point, so the
+ *     ring mask folds to a constant.
+ *
+ * @param peripheral_state
+ *     SPI channel state containing the slave stream queue and DMA resources.
+ *
+ * @return
+ *     true if a contiguous stream span was handed to DMA; false if no data was
+ *     available or a transfer was already active.
+ */
+HW_SPI_ALWAYS_INLINE bool
+HW_SPI_TX_Start_Slave_Stream_DMA( SPIChannel_T peripheral, SPIPeripheralState_T* peripheral_state )
+{
+    uint32_t bytes_to_send = 0U;
+    uint8_t* tx_ptr        = NULL;
+
+    if ( peripheral_state->tx_num_bytes_in_transmission > 0U )
+    {
+        return false;
+    }
+
+    if ( peripheral_state->tx_num_bytes_pending == 0U )
+    {
+        return false;
+    }
+
+    // DMA can only be programmed with a single linear memory span. If the TX
+    // ring has wrapped, only the bytes up to the end of the buffer are sent
+    // here; the DMA TC IRQ starts another transfer for the wrapped span.
+    bytes_to_send = HW_SPI_TX_Buffer_Size_Fast( peripheral ) - peripheral_state->tx_read_position;
+    if ( peripheral_state->tx_num_bytes_pending < bytes_to_send )
+    {
+        bytes_to_send = peripheral_state->tx_num_bytes_pending;
+    }
+
+    tx_ptr = &( peripheral_state->tx_buffer[peripheral_state->tx_read_position] );
+
+    peripheral_state->tx_read_position = HW_SPI_Wrap_Tx_Buffer_Index(
+        peripheral, peripheral_state->tx_read_position + bytes_to_send );
+    peripheral_state->tx_num_bytes_pending = peripheral_state->tx_num_bytes_pending - bytes_to_send;
+    peripheral_state->tx_num_bytes_in_transmission = bytes_to_send;
+
+    return HW_SPI_TX_Program_DMA( peripheral_state, tx_ptr, bytes_to_send );
+}
+
 #endif /* HW_SPI_INTERNAL */
 
 #ifdef __cplusplus
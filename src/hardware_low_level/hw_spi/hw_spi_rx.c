@@ -7,9 +7,10 @@
  *      RX-side implementation for the low-level SPI driver used by the HIL-RIG
  *      firmware.
  *
- *      This file contains the RX DMA start helper, RX DMA IRQ entry points, and
- *      public RX peek/consume functions. Shared state and common helpers are
- *      declared through hw_spi.h when HW_SPI_INTERNAL is enabled.
+ *      This file contains the RX DMA start helper, RX DMA IRQ entry points,
+ *      slave NSS edge framing, and public RX peek/consume functions. Shared
+ *      state and common helpers are declared through hw_spi.h when
+ *      HW_SPI_INTERNAL is enabled.
  *  Notes:
  *      Runtime TX/RX paths intentionally keep validation minimal. Configuration
  *      functions perform setup-time checks; ISR and hot-path functions assume
@@ -49,11 +50,146 @@
  *------------------------------------------------------------------------------
  */
 
+/**
+ * @brief Build the one-or-two span view of a byte range inside rx_buffer.
+ *
+ * @param peripheral
+ *     Logical SPI peripheral whose RX buffer size wraps the range.
+ *
+ * @param peripheral_state
+ *     SPI channel state owning the RX buffer.
+ *
+ * @param start_index
+ *     First byte index of the range; must already be wrapped.
+ *
+ * @param length_bytes
+ *     Number of bytes in the range; must be smaller than the RX buffer.
+ *
+ * @return
+ *     Spans covering the range, splitting it at the end of rx_buffer.
+ */
+HW_SPI_ALWAYS_INLINE HWSPIRxSpans_T
+HW_SPI_RX_Make_Spans( SPIChannel_T peripheral, const SPIPeripheralState_T* peripheral_state,
+                      uint32_t start_index, uint32_t length_bytes );
+
+/**
+ * @brief Queue the currently open NSS transaction as completed.
+ *
+ * @param peripheral
+ *     Logical SPI peripheral; selects the compile-time RX ring mask.
+ *
+ * @param peripheral_state
+ *     SPI channel state with an open NSS transaction.
+ *
+ * @param end_index
+ *     rx_buffer byte index captured at the closing edge.
+ *
+ * @param timestamp_cycles
+ *     Cycle count captured at the closing edge.
+ */
+HW_SPI_ALWAYS_INLINE void HW_SPI_RX_Close_Transaction( SPIChannel_T          peripheral,
+                                                       SPIPeripheralState_T* peripheral_state,
+                                                       uint32_t              end_index,
+                                                       uint32_t              timestamp_cycles );
+
+/**
+ * @brief Track NSS edges and queue completed slave RX transactions.
+ */
+HW_SPI_ALWAYS_INLINE void HW_SPI_RX_NSS_Edge_From_ISR( SPIChannel_T          peripheral,
+                                                       SPIPeripheralState_T* peripheral_state,
+                                                       bool nss_high, uint32_t timestamp_cycles );
+
+/**
+ * @brief Common body of the per-channel NSS EXTI IRQ entry points.
+ */
+HW_SPI_ALWAYS_INLINE void HW_SPI_RX_NSS_EXTI_Handler( SPIChannel_T peripheral );
+
 /**-----------------------------------------------------------------------------
  *  Private Function Definitions
  *------------------------------------------------------------------------------
  */
 
+HW_SPI_ALWAYS_INLINE HWSPIRxSpans_T
+HW_SPI_RX_Make_Spans( SPIChannel_T peripheral, const SPIPeripheralState_T* peripheral_state,
+                      uint32_t start_index, uint32_t length_bytes )
+{
+    const uint8_t* rx_buffer = peripheral_state->rx_buffer;
+
+    if ( length_bytes == 0U )
+    {
+        return ( HWSPIRxSpans_T ){ .first_span  = { .data = &rx_buffer[0], .length_bytes = 0U },
+                                   .second_span = { .data = &rx_buffer[0], .length_bytes = 0U },
+                                   .total_length_bytes = 0U };
+    }
+
+    // If the range ends before the end of rx_buffer, it is one contiguous span.
+    if ( start_index + length_bytes <= HW_SPI_RX_Buffer_Size_Fast( peripheral ) )
+    {
+        return ( HWSPIRxSpans_T ){
+            .first_span         = { .data = &rx_buffer[start_index], .length_bytes = length_bytes },
+            .second_span        = { .data = &rx_buffer[0], .length_bytes = 0U },
+            .total_length_bytes = length_bytes };
+    }
+
+    // Otherwise the range wraps around the end of rx_buffer. Return two spans so
+    // the caller can process both without copying inside the driver.
+    uint32_t first_span_length  = HW_SPI_RX_Buffer_Size_Fast( peripheral ) - start_index;
+    uint32_t second_span_length = length_bytes - first_span_length;
+
+    return ( HWSPIRxSpans_T ){
+        .first_span         = { .data = &rx_buffer[start_index], .length_bytes = first_span_length },
+        .second_span        = { .data = &rx_buffer[0], .length_bytes = second_span_length },
+        .total_length_bytes = length_bytes };
+}
+
+HW_SPI_ALWAYS_INLINE void HW_SPI_RX_Close_Transaction( SPIChannel_T          peripheral,
+                                                       SPIPeripheralState_T* peripheral_state,
+                                                       uint32_t              end_index,
+                                                       uint32_t              timestamp_cycles )
+{
+    uint32_t write_count = peripheral_state->rx_transaction_write_count;
+
+    peripheral_state->rx_transaction_open      = false;
+    peripheral_state->rx_transaction_end_index = ( uint16_t )end_index;
+
+    if ( write_count - peripheral_state->rx_transaction_read_count >= RX_TRANSACTION_QUEUE_DEPTH )
+    {
+        // The consumer has fallen behind. Keep the queued transactions intact
+        // and count the loss so it is visible with the next returned one.
+        peripheral_state->rx_transactions_dropped++;
+        return;
+    }
+
+    SPIRxTransactionDescriptor_T* descriptor =
+        &peripheral_state->rx_transaction_descriptors[write_count & RX_TRANSACTION_QUEUE_INDEX_MASK];
+
+    descriptor->start_index = peripheral_state->rx_transaction_start_index;
+    descriptor->size_bytes  = ( uint16_t )HW_SPI_Wrap_Rx_Buffer_Index(
+        peripheral, end_index - peripheral_state->rx_transaction_start_index );
+    descriptor->assert_timestamp_cycles   = peripheral_state->rx_transaction_assert_timestamp;
+    descriptor->deassert_timestamp_cycles = timestamp_cycles;
+
+    // Publish the descriptor only after it is fully written.
+    HW_SPI_COMPILER_BARRIER();
+    peripheral_state->rx_transaction_write_count = write_count + 1U;
+}
+
+HW_SPI_ALWAYS_INLINE void HW_SPI_RX_NSS_EXTI_Handler( SPIChannel_T peripheral )
+{
+    // Timestamp first so the edge time excludes the handler's own work.
+    uint32_t              timestamp_cycles = HW_TIMER_Get_Cycle_Count();
+    SPIPeripheralState_T* peripheral_state = HW_SPI_Get_State_Fast( peripheral );
+
+    if ( HW_GPIO_Clear_Edge_Interrupt( peripheral_state->nss_pin ) == false )
+    {
+        return;
+    }
+
+    HW_SPI_RX_NSS_Edge_From_ISR( peripheral, peripheral_state,
+                                 HW_GPIO_Read_Configurable_Pin( peripheral_state->nss_pin ),
+                                 timestamp_cycles );
+}
+
 /**
  * @brief Arm RX DMA without causing master-mode dummy clock generation.
  *
@@ -85,11 +221,14 @@ bool HW_SPI_RX_Start_Passive_DMA( SPIPeripheralState_T* peripheral_state )
     // elements. In 8-bit mode bytes == elements; in 16-bit mode two bytes are
     // one DMA element.
     rx_length_elements =
-        HW_SPI_Bytes_To_DMA_Elements_Fast( peripheral_state, RX_BUFFER_SIZE_BYTES );
+        HW_SPI_Bytes_To_DMA_Elements_Fast( peripheral_state,
+                                           HW_SPI_RX_Buffer_Size_Fast(
+                                               peripheral_state->logical_peripheral ) );
 
     // Reset the software consume index. The DMA write index is calculated later
     // from NDTR in HW_SPI_Rx_Peek().
     peripheral_state->rx_position = 0U;
+    HW_SPI_RX_Reset_Transactions( peripheral_state );
 
     // Reprogram the RX stream from a known disabled state. The stream is
     // circular, so once enabled it continuously drains SPI->DR into rx_buffer.
@@ -134,6 +273,95 @@ bool HW_SPI_RX_Start_Passive_DMA( SPIPeripheralState_T* peripheral_state )
     return true;
 }
 
+/**
+ * @brief Discard all queued and open NSS transactions for a channel.
+ *
+ * @details
+ *     Called whenever the RX ring restarts from index 0, because queued byte
+ *     ranges would no longer refer to valid data.
+ */
+void HW_SPI_RX_Reset_Transactions( SPIPeripheralState_T* peripheral_state )
+{
+    peripheral_state->rx_transaction_open             = false;
+    peripheral_state->rx_transaction_start_index      = 0U;
+    peripheral_state->rx_transaction_end_index        = 0U;
+    peripheral_state->rx_transaction_assert_timestamp = 0U;
+    peripheral_state->rx_transaction_write_count      = 0U;
+    peripheral_state->rx_transaction_read_count       = 0U;
+    peripheral_state->rx_transactions_dropped         = 0U;
+}
+
+/**
+ * @brief Record one NSS edge for a slave channel using RX transaction framing.
+ *
+ * @details
+ *     A low level opens a transaction at the current DMA write index; a high
+ *     level closes it. If both edges were coalesced into one EXTI interrupt, a
+ *     low level is seen while a transaction is already open, so the open one is
+ *     closed and a new one is started at the same index and timestamp.
+ *
+ *     A high level with no transaction open means a short fall-then-rise pair
+ *     was coalesced instead. NSS gates the slave, so every byte DMA wrote since
+ *     the previous closing edge belongs to that transaction; it is queued with
+ *     the lost assert time replaced by the deassert time.
+ *
+ *     The final frame of a transaction is normally drained by RX DMA well
+ *     before the EXTI handler reads NDTR, because DMA service takes a few bus
+ *     cycles while interrupt entry alone takes 12 core cycles.
+ *
+ * @param peripheral
+ *     Logical SPI peripheral. A literal from the EXTI IRQ entry point, so the
+ *     RX ring mask folds to a constant.
+ *
+ * @param peripheral_state
+ *     SPI channel state owning the NSS pin.
+ *
+ * @param nss_high
+ *     NSS input level read after the edge.
+ *
+ * @param timestamp_cycles
+ *     Cycle count captured at ISR entry.
+ */
+HW_SPI_ALWAYS_INLINE void HW_SPI_RX_NSS_Edge_From_ISR( SPIChannel_T          peripheral,
+                                                       SPIPeripheralState_T* peripheral_state,
+                                                       bool nss_high, uint32_t timestamp_cycles )
+{
+    if ( peripheral_state->rx_nss_framing == false || peripheral_state->is_started == false )
+    {
+        return;
+    }
+
+    uint32_t write_index = HW_SPI_RX_Get_DMA_Write_Index_Fast( peripheral, peripheral_state );
+
+    if ( peripheral_state->rx_transaction_open )
+    {
+        HW_SPI_RX_Close_Transaction( peripheral, peripheral_state, write_index, timestamp_cycles );
+
+        if ( peripheral_state->register_map_enabled )
+        {
+            HW_SPI_Register_Map_NSS_Deassert_From_ISR( peripheral_state );
+        }
+    }
+    else if ( nss_high )
+    {
+        peripheral_state->rx_transaction_start_index = peripheral_state->rx_transaction_end_index;
+        peripheral_state->rx_transaction_assert_timestamp = timestamp_cycles;
+        HW_SPI_RX_Close_Transaction( peripheral, peripheral_state, write_index, timestamp_cycles );
+    }
+
+    if ( nss_high == false )
+    {
+        peripheral_state->rx_transaction_open             = true;
+        peripheral_state->rx_transaction_start_index      = ( uint16_t )write_index;
+        peripheral_state->rx_transaction_assert_timestamp = timestamp_cycles;
+
+        if ( peripheral_state->register_map_enabled )
+        {
+            HW_SPI_Register_Map_NSS_Assert_From_ISR( peripheral_state );
+        }
+    }
+}
+
 /**-----------------------------------------------------------------------------
  *  Public Function Definitions
  *------------------------------------------------------------------------------
@@ -165,6 +393,28 @@ void SPI_CHANNEL_1_RX_DMA_IRQ( void )
     // Circular RX DMA does not require per-interrupt work in the current design.
 }
 
+/**
+ * @brief NSS EXTI IRQ entry point for SPI channel 0 (PA4, EXTI line 4).
+ *
+ * @details
+ *     Only active when channel 0 is a slave configured with rx_nss_framing.
+ */
+void SPI_CHANNEL_0_NSS_EXTI_IRQ( void )
+{
+    HW_SPI_RX_NSS_EXTI_Handler( SPI_CHANNEL_0 );
+}
+
+/**
+ * @brief NSS EXTI IRQ entry point for SPI channel 1 (PB12, EXTI line 12).
+ *
+ * @details
+ *     Only active when channel 1 is a slave configured with rx_nss_framing.
+ */
+void SPI_CHANNEL_1_NSS_EXTI_IRQ( void )
+{
+    HW_SPI_RX_NSS_EXTI_Handler( SPI_CHANNEL_1 );
+}
+
 /**
  * @brief Start the runtime RX side of a configured SPI channel.
  *
@@ -226,57 +476,15 @@ HWSPIRxSpans_T HW_SPI_Rx_Peek( SPIChannel_T peripheral )
 {
     SPIPeripheralState_T* peripheral_state = HW_SPI_Get_State_Fast( peripheral );
 
-    uint8_t* rx_buffer  = peripheral_state->rx_buffer;
-    uint32_t read_index = peripheral_state->rx_position;
-
-    uint32_t dma_remaining_elements =
-        LL_DMA_GetDataLength( peripheral_state->rx_dma, peripheral_state->rx_dma_stream );
-
-    // DMA NDTR is expressed in DMA elements, not bytes. Convert back to bytes
-    // so the software RX stream remains byte-oriented.
-    uint32_t dma_remaining_bytes =
-        HW_SPI_DMA_Elements_To_Bytes_Fast( peripheral_state, dma_remaining_elements );
-
-    // In circular RX mode, NDTR counts down from the full buffer length to 0
-    // and then reloads. Subtracting the remaining count gives the current DMA
-    // write index in byte units.
-    uint32_t dma_write_index = RX_BUFFER_SIZE_BYTES - dma_remaining_bytes;
-
-    if ( dma_write_index == RX_BUFFER_SIZE_BYTES )
-    {
-        dma_write_index = 0U;
-    }
+    uint32_t read_index      = peripheral_state->rx_position;
+    uint32_t dma_write_index = HW_SPI_RX_Get_DMA_Write_Index_Fast( peripheral, peripheral_state );
 
     // The modulo subtraction handles both non-wrapped and wrapped unread RX
     // regions.
-    uint32_t unread_bytes = ( dma_write_index - read_index ) & RX_BUFFER_INDEX_MASK;
-
-    if ( unread_bytes == 0U )
-    {
-        return ( HWSPIRxSpans_T ){ .first_span  = { .data = &rx_buffer[0], .length_bytes = 0U },
-                                   .second_span = { .data = &rx_buffer[0], .length_bytes = 0U },
-                                   .total_length_bytes = 0U };
-    }
+    uint32_t unread_bytes =
+        HW_SPI_Wrap_Rx_Buffer_Index( peripheral, dma_write_index - read_index );
 
-    // If the DMA write index is ahead of the software read index, all unread
-    // data is one contiguous span.
-    if ( dma_write_index > read_index )
-    {
-        return ( HWSPIRxSpans_T ){
-            .first_span         = { .data = &rx_buffer[read_index], .length_bytes = unread_bytes },
-            .second_span        = { .data = &rx_buffer[0], .length_bytes = 0U },
-            .total_length_bytes = unread_bytes };
-    }
-
-    // Otherwise the unread data wraps around the end of rx_buffer. Return two
-    // spans so the caller can process both without copying inside the driver.
-    uint32_t first_span_length  = RX_BUFFER_SIZE_BYTES - read_index;
-    uint32_t second_span_length = unread_bytes - first_span_length;
-
-    return ( HWSPIRxSpans_T ){
-        .first_span         = { .data = &rx_buffer[read_index], .length_bytes = first_span_length },
-        .second_span        = { .data = &rx_buffer[0], .length_bytes = second_span_length },
-        .total_length_bytes = unread_bytes };
+    return HW_SPI_RX_Make_Spans( peripheral, peripheral_state, read_index, unread_bytes );
 }
 
 /**
@@ -312,5 +520,72 @@ void HW_SPI_Rx_Consume( SPIChannel_T peripheral, uint32_t bytes_to_consume )
     // Advance only the software consume index. The DMA write index is hardware
     // controlled and is derived from NDTR when peeking.
     peripheral_state->rx_position =
-        HW_SPI_Wrap_Rx_Buffer_Index( peripheral_state->rx_position + bytes_to_consume );
+        HW_SPI_Wrap_Rx_Buffer_Index( peripheral,
+                                     peripheral_state->rx_position + bytes_to_consume );
+}
+
+/**
+ * @brief Return the oldest completed NSS-framed RX transaction without consuming it.
+ *
+ * @param peripheral
+ *     The SPI peripheral/channel to inspect.
+ *
+ * @param transaction
+ *     Receives the transaction spans and timestamps when one is available.
+ *
+ * @return
+ *     true if a completed transaction was returned; false if none is queued.
+ */
+bool HW_SPI_Rx_Peek_Transaction( SPIChannel_T peripheral, HWSPIRxTransaction_T* transaction )
+{
+    SPIPeripheralState_T* peripheral_state = HW_SPI_Get_State_Fast( peripheral );
+    uint32_t              read_count       = peripheral_state->rx_transaction_read_count;
+
+    if ( read_count == peripheral_state->rx_transaction_write_count )
+    {
+        return false;
+    }
+
+    // Pairs with the ISR publish barrier: read the descriptor only after the
+    // write count that made it visible.
+    HW_SPI_COMPILER_BARRIER();
+
+    const SPIRxTransactionDescriptor_T* descriptor =
+        &peripheral_state->rx_transaction_descriptors[read_count & RX_TRANSACTION_QUEUE_INDEX_MASK];
+
+    transaction->data =
+        HW_SPI_RX_Make_Spans( peripheral, peripheral_state, descriptor->start_index,
+                              descriptor->size_bytes );
+    transaction->assert_timestamp_cycles   = descriptor->assert_timestamp_cycles;
+    transaction->deassert_timestamp_cycles = descriptor->deassert_timestamp_cycles;
+    transaction->dropped_transactions      = peripheral_state->rx_transactions_dropped;
+    return true;
+}
+
+/**
+ * @brief Release the oldest completed NSS-framed RX transaction.
+ *
+ * @param peripheral
+ *     The SPI peripheral/channel whose oldest transaction should be released.
+ */
+void HW_SPI_Rx_Consume_Transaction( SPIChannel_T peripheral )
+{
+    SPIPeripheralState_T* peripheral_state = HW_SPI_Get_State_Fast( peripheral );
+    uint32_t              read_count       = peripheral_state->rx_transaction_read_count;
+
+    if ( read_count == peripheral_state->rx_transaction_write_count )
+    {
+        return;
+    }
+
+    const SPIRxTransactionDescriptor_T* descriptor =
+        &peripheral_state->rx_transaction_descriptors[read_count & RX_TRANSACTION_QUEUE_INDEX_MASK];
+
+    peripheral_state->rx_position =
+        HW_SPI_Wrap_Rx_Buffer_Index( peripheral,
+                                     ( uint32_t )descriptor->start_index + descriptor->size_bytes );
+
+    // Release the slot only after the descriptor has been read.
+    HW_SPI_COMPILER_BARRIER();
+    peripheral_state->rx_transaction_read_count = read_count + 1U;
 }
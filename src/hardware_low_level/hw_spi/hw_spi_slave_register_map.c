@@ -0,0 +1,355 @@
+/******************************************************************************
+ *  File:       hw_spi_slave_register_map.c
+ *  Author:     Angus Corr
+ *  Created:    18-Oct-2026
+ *
+ *  Description:
+ *      Register-map slave emulation for the low-level SPI driver used by the
+ *      HIL-RIG firmware.
+ *
+ *      Many DUTs poll SPI sensors with a command byte (read flag plus register
+ *      address) followed by a read burst. This file lets a slave channel answer
+ *      those reads from an SRAM register map that the executor or plant model
+ *      refreshes every tick, instead of streaming preloaded TX bytes.
+ *
+ *  Notes:
+ *      - The feature builds on NSS framing (hw_spi_rx.c). NSS assert arms the
+ *        SPI RXNE interrupt; NSS deassert disarms it and stops any read burst.
+ *      - RX DMA keeps draining SPI->DR into rx_buffer, so the RXNE ISR reads
+ *        the command back from the ring at the transaction start index rather
+ *        than from DR. The full transaction is still queued for the caller.
+ *      - The first response byte is written to SPI->DR directly from the ISR;
+ *        TX DMA then streams the rest of the burst with auto-increment. The
+ *        DUT must leave an inter-byte gap longer than the measured turnaround
+ *        (see HWSPIRegisterMapStats_T and the README).
+ *      - The byte shifted out while the DUT clocks the command is undefined.
+ *        STM32F4 SPI cannot flush a prefetched TX byte, so it is usually the
+ *        byte after the end of the previous burst.
+ ******************************************************************************/
+
+/**-----------------------------------------------------------------------------
+ *  Includes
+ *------------------------------------------------------------------------------
+ */
+
+#define HW_SPI_INTERNAL
+#include "hw_spi.h"
+#include "hw_timer.h"
+
+/**-----------------------------------------------------------------------------
+ *  Defines / Macros
+ *------------------------------------------------------------------------------
+ */
+
+/**-----------------------------------------------------------------------------
+ *  Typedefs / Enums / Structures
+ *------------------------------------------------------------------------------
+ */
+
+/**-----------------------------------------------------------------------------
+ *  Public (global) and Extern Variables
+ *------------------------------------------------------------------------------
+ */
+
+/**-----------------------------------------------------------------------------
+ *  Private (static) Variables
+ *------------------------------------------------------------------------------
+ */
+
+/**-----------------------------------------------------------------------------
+ *  Private (static) Function Prototypes
+ *------------------------------------------------------------------------------
+ */
+
+/**
+ * @brief Return the state of a configured register-map slave channel.
+ *
+ * @param peripheral
+ *     Logical SPI channel requested by the caller.
+ *
+ * @return
+ *     Channel state, or NULL if the channel is invalid or not a register-map
+ *     slave.
+ */
+static SPIPeripheralState_T* HW_SPI_Register_Map_Get_State( SPIChannel_T peripheral );
+
+/**
+ * @brief Return how many bytes RX DMA has written since NSS was asserted.
+ */
+HW_SPI_ALWAYS_INLINE uint32_t HW_SPI_Register_Map_Received_Bytes(
+    SPIChannel_T peripheral, const SPIPeripheralState_T* peripheral_state );
+
+/**
+ * @brief Common body of the per-channel SPI RXNE IRQ entry points.
+ */
+HW_SPI_ALWAYS_INLINE void
+HW_SPI_Register_Map_Command_From_ISR( SPIChannel_T          peripheral,
+                                      SPIPeripheralState_T* peripheral_state );
+
+/**-----------------------------------------------------------------------------
+ *  Private Function Definitions
+ *------------------------------------------------------------------------------
+ */
+
+static SPIPeripheralState_T* HW_SPI_Register_Map_Get_State( SPIChannel_T peripheral )
+{
+    SPIPeripheralState_T* peripheral_state = HW_SPI_Get_State( peripheral );
+
+    if ( peripheral_state == NULL || peripheral_state->is_configured == false
+         || peripheral_state->register_map_enabled == false )
+    {
+        return NULL;
+    }
+
+    return peripheral_state;
+}
+
+HW_SPI_ALWAYS_INLINE uint32_t HW_SPI_Register_Map_Received_Bytes(
+    SPIChannel_T peripheral, const SPIPeripheralState_T* peripheral_state )
+{
+    return HW_SPI_Wrap_Rx_Buffer_Index(
+        peripheral, HW_SPI_RX_Get_DMA_Write_Index_Fast( peripheral, peripheral_state )
+                        - peripheral_state->rx_transaction_start_index );
+}
+
+/**
+ * @brief Decode the command and load the read response from the SPI RXNE ISR.
+ *
+ * @details
+ *     This is the turnaround-critical path. The first response byte goes
+ *     straight into SPI->DR so it is ready for the DUT's next frame; DMA setup
+ *     for the remainder of the burst happens afterwards, while that first byte
+ *     is being shifted out.
+ *
+ *     RX DMA normally clears RXNE before this ISR runs, so the NVIC pending
+ *     bit is what brings execution here and the command is read back from the
+ *     RX ring. If the ISR is entered before every command byte has landed it
+ *     simply returns and waits for the next RXNE.
+ *
+ * @param peripheral
+ *     Logical SPI peripheral. A literal from the SPI IRQ entry point, so the RX
+ *     ring mask folds to a constant.
+ *
+ * @param peripheral_state
+ *     Register-map slave channel that received a frame.
+ */
+HW_SPI_ALWAYS_INLINE void
+HW_SPI_Register_Map_Command_From_ISR( SPIChannel_T          peripheral,
+                                      SPIPeripheralState_T* peripheral_state )
+{
+    uint32_t                 entry_cycles      = HW_TIMER_Get_Cycle_Count();
+    HWSPIRegisterMapStats_T* stats             = &( peripheral_state->register_map_stats );
+    uint32_t                 start_index       = peripheral_state->rx_transaction_start_index;
+    uint32_t                 command_bytes     = peripheral_state->register_map_command_bytes;
+    uint32_t                 turnaround_cycles = 0U;
+    uint32_t                 address_index     = 0U;
+    uint32_t                 address           = 0U;
+    uint8_t*                 map               = NULL;
+
+    if ( HW_SPI_Register_Map_Received_Bytes( peripheral, peripheral_state ) < command_bytes )
+    {
+        return;
+    }
+
+    LL_SPI_DisableIT_RXNE( peripheral_state->spi_peripheral );
+
+    if ( ( peripheral_state->rx_buffer[start_index]
+           & peripheral_state->register_map_read_flag_mask )
+         != peripheral_state->register_map_read_flag_mask )
+    {
+        stats->write_commands++;
+        return;
+    }
+
+    address_index = HW_SPI_Wrap_Rx_Buffer_Index( peripheral, start_index + command_bytes - 1U );
+    address       = peripheral_state->rx_buffer[address_index]
+              & peripheral_state->register_map_address_mask;
+    map = peripheral_state->register_map[peripheral_state->register_map_active];
+
+    LL_SPI_TransmitData8( peripheral_state->spi_peripheral, map[address] );
+    turnaround_cycles = HW_TIMER_Get_Cycle_Count() - entry_cycles;
+
+    // Anything beyond the command means the DUT already clocked the first
+    // response frame before DR was loaded.
+    if ( HW_SPI_Register_Map_Received_Bytes( peripheral, peripheral_state ) > command_bytes )
+    {
+        stats->late_responses++;
+    }
+
+    if ( address + 1U < HW_SPI_REGISTER_MAP_SIZE_BYTES )
+    {
+        peripheral_state->register_map_burst_active = true;
+
+        // Size the burst to the end of the map; NSS deassert stops it early.
+        if ( HW_SPI_TX_Program_DMA( peripheral_state, &map[address + 1U],
+                                    HW_SPI_REGISTER_MAP_SIZE_BYTES - address - 1U )
+             == false )
+        {
+            peripheral_state->register_map_burst_active = false;
+            HW_SPI_TX_Error_Handler( peripheral );
+        }
+    }
+
+    stats->read_commands++;
+    stats->last_turnaround_cycles = turnaround_cycles;
+    if ( turnaround_cycles > stats->max_turnaround_cycles )
+    {
+        stats->max_turnaround_cycles = turnaround_cycles;
+    }
+}
+
+/**-----------------------------------------------------------------------------
+ *  Public Function Definitions
+ *------------------------------------------------------------------------------
+ */
+
+/**
+ * @brief Clear both register maps, the published index, and the counters.
+ *
+ * @details
+ *     Called from configuration once channel storage is bound. The maps start
+ *     zeroed so a DUT read before the first commit returns 0x00 rather than
+ *     stale data from a previous test. Channels without map storage only reset
+ *     the counters.
+ *
+ * @param peripheral_state
+ *     SPI channel state to reset.
+ */
+void HW_SPI_Register_Map_Reset( SPIPeripheralState_T* peripheral_state )
+{
+    peripheral_state->register_map_active       = 0U;
+    peripheral_state->register_map_burst_active = false;
+    if ( peripheral_state->register_map != NULL )
+    {
+        memset( peripheral_state->register_map, 0, 2U * HW_SPI_REGISTER_MAP_SIZE_BYTES );
+    }
+    memset( &( peripheral_state->register_map_stats ), 0,
+            sizeof( peripheral_state->register_map_stats ) );
+}
+
+/**
+ * @brief Arm command-byte detection at the start of an NSS transaction.
+ *
+ * @details
+ *     Called from the NSS EXTI ISR after the transaction start index has been
+ *     latched. Arming RXNE here rather than permanently keeps the SPI ISR off
+ *     every byte of a burst.
+ *
+ * @param peripheral_state
+ *     Register-map slave channel whose NSS was asserted.
+ */
+void HW_SPI_Register_Map_NSS_Assert_From_ISR( SPIPeripheralState_T* peripheral_state )
+{
+    LL_SPI_EnableIT_RXNE( peripheral_state->spi_peripheral );
+}
+
+/**
+ * @brief Disarm command detection and stop any read burst at NSS deassert.
+ *
+ * @details
+ *     The burst DMA is sized to the end of the map, so it is normally still
+ *     running when the DUT releases NSS. Stopping it here keeps the next
+ *     transaction's command phase from consuming more map bytes.
+ *
+ * @param peripheral_state
+ *     Register-map slave channel whose NSS was released.
+ */
+void HW_SPI_Register_Map_NSS_Deassert_From_ISR( SPIPeripheralState_T* peripheral_state )
+{
+    LL_SPI_DisableIT_RXNE( peripheral_state->spi_peripheral );
+
+    if ( peripheral_state->register_map_burst_active )
+    {
+        LL_SPI_DisableDMAReq_TX( peripheral_state->spi_peripheral );
+        LL_DMA_DisableStream( peripheral_state->tx_dma, peripheral_state->tx_dma_stream );
+        peripheral_state->register_map_burst_active = false;
+    }
+}
+
+bool HW_SPI_Register_Map_Write( SPIChannel_T peripheral, uint8_t address, const uint8_t* data,
+                                uint32_t size_bytes )
+{
+    SPIPeripheralState_T* peripheral_state = HW_SPI_Register_Map_Get_State( peripheral );
+
+    if ( peripheral_state == NULL || data == NULL
+         || size_bytes > HW_SPI_REGISTER_MAP_SIZE_BYTES - address )
+    {
+        return false;
+    }
+
+    // Only the staging copy is written; the ISR never reads it.
+    uint8_t* staging_map =
+        peripheral_state->register_map[peripheral_state->register_map_active ^ 1U];
+    memcpy( &( staging_map[address] ), data, size_bytes );
+    return true;
+}
+
+bool HW_SPI_Register_Map_Commit( SPIChannel_T peripheral )
+{
+    SPIPeripheralState_T* peripheral_state = HW_SPI_Register_Map_Get_State( peripheral );
+    uint8_t               published        = 0U;
+
+    if ( peripheral_state == NULL )
+    {
+        return false;
+    }
+
+    // Masking only the SPI IRQ stops a new burst from latching the old map
+    // between the check and the swap. NSS edge timestamps are unaffected.
+    NVIC_DisableIRQ( peripheral_state->spi_irqn );
+
+    if ( peripheral_state->register_map_burst_active )
+    {
+        NVIC_EnableIRQ( peripheral_state->spi_irqn );
+        peripheral_state->register_map_stats.commit_retries++;
+        return false;
+    }
+
+    published                             = peripheral_state->register_map_active ^ 1U;
+    peripheral_state->register_map_active = published;
+
+    NVIC_EnableIRQ( peripheral_state->spi_irqn );
+
+    // The old published copy is now unreferenced; bring it up to date so the
+    // next tick's partial writes are staged on top of the current values.
+    memcpy( peripheral_state->register_map[published ^ 1U],
+            peripheral_state->register_map[published], HW_SPI_REGISTER_MAP_SIZE_BYTES );
+    return true;
+}
+
+bool HW_SPI_Register_Map_Get_Stats( SPIChannel_T peripheral, HWSPIRegisterMapStats_T* stats )
+{
+    SPIPeripheralState_T* peripheral_state = HW_SPI_Register_Map_Get_State( peripheral );
+
+    if ( peripheral_state == NULL || stats == NULL )
+    {
+        return false;
+    }
+
+    *stats = peripheral_state->register_map_stats;
+    return true;
+}
+
+/**
+ * @brief SPI global IRQ entry point for SPI channel 0 (SPI1).
+ *
+ * @details
+ *     Only RXNE is ever enabled, and only between NSS assert and the command
+ *     byte on a register-map slave channel.
+ */
+void SPI_CHANNEL_0_IRQ( void )
+{
+    HW_SPI_Register_Map_Command_From_ISR( SPI_CHANNEL_0, &( channel_state_array[SPI_CHANNEL_0] ) );
+}
+
+/**
+ * @brief SPI global IRQ entry point for SPI channel 1 (SPI2).
+ *
+ * @details
+ *     Only RXNE is ever enabled, and only between NSS assert and the command
+ *     byte on a register-map slave channel.
+ */
+void SPI_CHANNEL_1_IRQ( void )
+{
+    HW_SPI_Register_Map_Command_From_ISR( SPI_CHANNEL_1, &( channel_state_array[SPI_CHANNEL_1] ) );
+}
@@ -398,7 +398,7 @@ HW_SPI_TX_Complete_Master_Transaction( SPIChannel_T          peripheral,
     // transition into DMA_ACTIVE for the next transaction.
     peripheral_state->tx_transaction_state = HW_SPI_TX_TRANSACTION_IDLE;
 
-    if ( HW_SPI_TX_Start_Master_Packet_DMA( peripheral_state ) == false )
+    if ( HW_SPI_TX_Start_Master_Packet_DMA( peripheral, peripheral_state ) == false )
     {
         HW_SPI_TX_Fault_Master_Transaction( peripheral, peripheral_state );
     }
@@ -496,7 +496,7 @@ HW_SPI_ALWAYS_INLINE void HW_SPI_TX_Handle_Slave_DMA_TC( SPIChannel_T          p
         return;
     }
 
-    if ( HW_SPI_TX_Start_Slave_Stream_DMA( peripheral_state ) == false )
+    if ( HW_SPI_TX_Start_Slave_Stream_DMA( peripheral, peripheral_state ) == false )
     {
         HW_SPI_TX_Error_Handler( peripheral );
     }
@@ -612,7 +612,8 @@ void HW_SPI_TX_Reset_State( SPIPeripheralState_T* peripheral_state )
     peripheral_state->tx_packet_read_position  = 0U;
     peripheral_state->tx_num_packets_pending   = 0U;
     memset( peripheral_state->tx_packet_descriptors, 0,
-            sizeof( peripheral_state->tx_packet_descriptors ) );
+            HW_SPI_TX_Packet_Queue_Depth_Fast( peripheral_state->logical_peripheral )
+                * sizeof( peripheral_state->tx_packet_descriptors[0] ) );
 }
 
 /**
@@ -895,7 +896,7 @@ void HW_SPI_Tx_Trigger( SPIChannel_T peripheral )
             return;
         }
 
-        if ( HW_SPI_TX_Start_Master_Packet_DMA( peripheral_state ) == false )
+        if ( HW_SPI_TX_Start_Master_Packet_DMA( peripheral, peripheral_state ) == false )
         {
             HW_SPI_TX_Fault_Master_Transaction( peripheral, peripheral_state );
         }
@@ -908,7 +909,7 @@ void HW_SPI_Tx_Trigger( SPIChannel_T peripheral )
             return;
         }
 
-        if ( HW_SPI_TX_Start_Slave_Stream_DMA( peripheral_state ) == false )
+        if ( HW_SPI_TX_Start_Slave_Stream_DMA( peripheral, peripheral_state ) == false )
         {
             HW_SPI_TX_Error_Handler( peripheral );
         }
@@ -102,13 +102,15 @@ HW_SPI_ALWAYS_INLINE uint32_t HW_SPI_TX_Get_Contiguous_Free_Bytes_From_Index(
 HW_SPI_ALWAYS_INLINE bool
 HW_SPI_TX_Packet_Queue_Has_Free_Slot( const SPIPeripheralState_T* peripheral_state )
 {
-    return peripheral_state->tx_num_packets_pending < TX_PACKET_QUEUE_DEPTH;
+    return peripheral_state->tx_num_packets_pending
+           < HW_SPI_TX_Packet_Queue_Depth_Fast( peripheral_state->logical_peripheral );
 }
 
 HW_SPI_ALWAYS_INLINE uint32_t HW_SPI_TX_Get_Contiguous_Free_Bytes_From_Index(
     const SPIPeripheralState_T* peripheral_state, uint32_t write_index )
 {
-    if ( HW_SPI_TX_Get_Used_Space_Fast( peripheral_state ) == TX_BUFFER_SIZE_BYTES )
+    if ( HW_SPI_TX_Get_Used_Space_Fast( peripheral_state )
+         == HW_SPI_TX_Buffer_Size_Fast( peripheral_state->logical_peripheral ) )
     {
         return 0U;
     }
@@ -124,7 +126,7 @@ HW_SPI_ALWAYS_INLINE uint32_t HW_SPI_TX_Get_Contiguous_Free_Bytes_From_Index(
     // Otherwise, the contiguous free region runs to the end of tx_buffer. If a
     // master packet does not fit here, the load path may wrap the whole packet
     // to index 0 and intentionally leave the tail bytes unused.
-    return TX_BUFFER_SIZE_BYTES - write_index;
+    return HW_SPI_TX_Buffer_Size_Fast( peripheral_state->logical_peripheral ) - write_index;
 }
 
 /**-----------------------------------------------------------------------------
@@ -158,8 +160,9 @@ HW_SPI_ALWAYS_INLINE uint32_t HW_SPI_TX_Get_Contiguous_Free_Bytes_From_Index(
 bool HW_SPI_TX_Load_Master_Packet( SPIPeripheralState_T* peripheral_state, const uint8_t* data,
                                    uint32_t size )
 {
-    uint32_t packet_start    = 0U;
-    uint32_t contiguous_free = 0U;
+    SPIChannel_T peripheral      = peripheral_state->logical_peripheral;
+    uint32_t     packet_start    = 0U;
+    uint32_t     contiguous_free = 0U;
 
     if ( HW_SPI_Is_Frame_Aligned_Size_Fast( peripheral_state, size ) == false )
     {
@@ -171,7 +174,7 @@ bool HW_SPI_TX_Load_Master_Packet( SPIPeripheralState_T* peripheral_state, const
         return false;
     }
 
-    if ( size > HW_SPI_TX_Get_Free_Space_Fast( peripheral_state ) )
+    if ( size > HW_SPI_TX_Get_Free_Space_Fast( peripheral, peripheral_state ) )
     {
         return false;
     }
@@ -210,11 +213,12 @@ bool HW_SPI_TX_Load_Master_Packet( SPIPeripheralState_T* peripheral_state, const
         ( uint16_t )size;
 
     peripheral_state->tx_packet_write_position =
-        HW_SPI_Wrap_Tx_Packet_Index( peripheral_state->tx_packet_write_position + 1U );
+        HW_SPI_Wrap_Tx_Packet_Index( peripheral,
+                                     peripheral_state->tx_packet_write_position + 1U );
     peripheral_state->tx_num_packets_pending++;
 
     peripheral_state->tx_write_position =
-        HW_SPI_Wrap_Tx_Buffer_Index( peripheral_state->tx_write_position + size );
+        HW_SPI_Wrap_Tx_Buffer_Index( peripheral, peripheral_state->tx_write_position + size );
     peripheral_state->tx_num_bytes_pending = peripheral_state->tx_num_bytes_pending + size;
 
     return true;
@@ -229,10 +233,11 @@ bool HW_SPI_TX_Load_Master_Packet( SPIPeripheralState_T* peripheral_state, const
 bool HW_SPI_TX_Load_Master_Packets( SPIPeripheralState_T* peripheral_state, const uint8_t* data,
                                     uint32_t packet_size_bytes, uint32_t packet_count )
 {
-    uint16_t packet_starts[TX_PACKET_QUEUE_DEPTH];
-    uint32_t candidate_write_position = peripheral_state->tx_write_position;
-    uint32_t queued_bytes             = 0U;
-    uint32_t total_size_bytes         = 0U;
+    SPIChannel_T peripheral = peripheral_state->logical_peripheral;
+    uint16_t     packet_starts[SPI_MAX_TX_PACKET_QUEUE_DEPTH];
+    uint32_t     candidate_write_position = peripheral_state->tx_write_position;
+    uint32_t     queued_bytes             = 0U;
+    uint32_t     total_size_bytes         = 0U;
 
     if ( data == NULL || packet_size_bytes == 0U || packet_count == 0U
          || packet_size_bytes > UINT16_MAX
@@ -242,7 +247,8 @@ bool HW_SPI_TX_Load_Master_Packets( SPIPeripheralState_T* peripheral_state, cons
     }
 
     if ( packet_count
-         > ( uint32_t )( TX_PACKET_QUEUE_DEPTH - peripheral_state->tx_num_packets_pending ) )
+         > HW_SPI_TX_Packet_Queue_Depth_Fast( peripheral )
+               - peripheral_state->tx_num_packets_pending )
     {
         return false;
     }
@@ -253,7 +259,7 @@ bool HW_SPI_TX_Load_Master_Packets( SPIPeripheralState_T* peripheral_state, cons
     }
 
     total_size_bytes = packet_size_bytes * packet_count;
-    if ( total_size_bytes > HW_SPI_TX_Get_Free_Space_Fast( peripheral_state ) )
+    if ( total_size_bytes > HW_SPI_TX_Get_Free_Space_Fast( peripheral, peripheral_state ) )
     {
         return false;
     }
@@ -263,7 +269,7 @@ bool HW_SPI_TX_Load_Master_Packets( SPIPeripheralState_T* peripheral_state, cons
         uint32_t contiguous_free = 0U;
 
         if ( HW_SPI_TX_Get_Used_Space_Fast( peripheral_state ) + queued_bytes
-             < TX_BUFFER_SIZE_BYTES )
+             < HW_SPI_TX_Buffer_Size_Fast( peripheral ) )
         {
             if ( candidate_write_position < peripheral_state->tx_read_position )
             {
@@ -272,7 +278,8 @@ bool HW_SPI_TX_Load_Master_Packets( SPIPeripheralState_T* peripheral_state, cons
             else if ( candidate_write_position >= peripheral_state->tx_read_position
                       || HW_SPI_TX_Get_Used_Space_Fast( peripheral_state ) + queued_bytes == 0U )
             {
-                contiguous_free = TX_BUFFER_SIZE_BYTES - candidate_write_position;
+                contiguous_free =
+                    HW_SPI_TX_Buffer_Size_Fast( peripheral ) - candidate_write_position;
             }
         }
 
@@ -288,7 +295,7 @@ bool HW_SPI_TX_Load_Master_Packets( SPIPeripheralState_T* peripheral_state, cons
             if ( contiguous_free == 0U
                  && HW_SPI_TX_Get_Used_Space_Fast( peripheral_state ) + queued_bytes == 0U )
             {
-                contiguous_free = TX_BUFFER_SIZE_BYTES;
+                contiguous_free = HW_SPI_TX_Buffer_Size_Fast( peripheral );
             }
 
             if ( packet_size_bytes > contiguous_free )
@@ -299,7 +306,8 @@ bool HW_SPI_TX_Load_Master_Packets( SPIPeripheralState_T* peripheral_state, cons
 
         packet_starts[packet_index] = ( uint16_t )candidate_write_position;
         candidate_write_position =
-            HW_SPI_Wrap_Tx_Buffer_Index( candidate_write_position + packet_size_bytes );
+            HW_SPI_Wrap_Tx_Buffer_Index( peripheral,
+                                         candidate_write_position + packet_size_bytes );
         queued_bytes += packet_size_bytes;
     }
 
@@ -313,7 +321,8 @@ bool HW_SPI_TX_Load_Master_Packets( SPIPeripheralState_T* peripheral_state, cons
         descriptor->start_index = packet_starts[packet_index];
         descriptor->size_bytes  = ( uint16_t )packet_size_bytes;
         peripheral_state->tx_packet_write_position =
-            HW_SPI_Wrap_Tx_Packet_Index( peripheral_state->tx_packet_write_position + 1U );
+            HW_SPI_Wrap_Tx_Packet_Index( peripheral,
+                                     peripheral_state->tx_packet_write_position + 1U );
     }
 
     peripheral_state->tx_write_position = candidate_write_position;
@@ -323,88 +332,3 @@ bool HW_SPI_TX_Load_Master_Packets( SPIPeripheralState_T* peripheral_state, cons
 
     return true;
 }
-
-/**
- * @brief Start a master-mode TX DMA transfer for exactly one queued packet.
- *
- * @details
- *     Master TX progresses from the packet descriptor queue. Starting a packet
- *     consumes one descriptor, moves the packet bytes from pending to in-flight,
- *     asserts software CS, and arms one TX DMA transfer. The DMA completion path
- *     is responsible for final-drain handling and CS release.
- *
- * @param peripheral_state
- *     SPI channel state containing the queued packet and DMA resources.
- *
- * @return
- *     true when one packet was successfully handed to DMA; false if no packet
- *     was available, another transaction was active, or DMA setup failed.
- */
-bool HW_SPI_TX_Start_Master_Packet_DMA( SPIPeripheralState_T* peripheral_state )
-{
-    if ( peripheral_state->tx_num_bytes_in_transmission > 0U
-         || peripheral_state->tx_transaction_state != HW_SPI_TX_TRANSACTION_IDLE )
-    {
-        return false;
-    }
-
-    // Check if there are any packets pending
-    if ( peripheral_state->tx_num_packets_pending == 0U )
-    {
-        return false;
-    }
-
-    SPITxPacketDescriptor_T* packet =
-        &( peripheral_state->tx_packet_descriptors[peripheral_state->tx_packet_read_position] );
-
-    if ( packet->size_bytes == 0U )
-    {
-        return false;
-    }
-
-    uint32_t packet_size_bytes = packet->size_bytes;
-    uint8_t* tx_ptr            = &( peripheral_state->tx_buffer[packet->start_index] );
-
-    // Mark the transaction as DMA-active before enabling DMA. The DMA TC IRQ
-    // may run very soon after LL_SPI_EnableDMAReq_TX(), especially for short
-    // packets, so the IRQ must not observe the transaction as idle.
-    // The packet descriptor and pending byte counts are not consumed until DMA
-    // programming succeeds.
-    peripheral_state->tx_num_bytes_in_transmission = packet_size_bytes;
-    peripheral_state->tx_transaction_state         = HW_SPI_TX_TRANSACTION_DMA_ACTIVE;
-
-    // Master software CS is asserted immediately before arming the DMA transfer
-    // for this packet. The actual GPIO access is intentionally hidden behind
-    // HW_SPI_TX_Master_CS_Assert(), which should call the separate GPIO driver.
-    HW_SPI_TX_Master_CS_Assert( peripheral_state );
-
-    if ( HW_SPI_TX_Program_DMA( peripheral_state, tx_ptr, packet_size_bytes ) == false )
-    {
-        HW_SPI_TX_Master_CS_Deassert( peripheral_state );
-        peripheral_state->tx_transaction_state         = HW_SPI_TX_TRANSACTION_ERROR;
-        peripheral_state->tx_num_bytes_in_transmission = 0U;
-        return false;
-    }
-
-    // Move exactly this packet out of the pending software state and into the
-    // in-flight DMA state. The descriptor is consumed after DMA is armed. The
-    // DMA completion IRQ must not start another packet until the automatic-CS
-    // completion path has waited for the final SPI frame to drain and released
-    // CS for this packet.
-    peripheral_state->tx_packet_read_position =
-        HW_SPI_Wrap_Tx_Packet_Index( peripheral_state->tx_packet_read_position + 1U );
-    peripheral_state->tx_num_packets_pending--;
-
-    peripheral_state->tx_num_bytes_pending =
-        peripheral_state->tx_num_bytes_pending - packet_size_bytes;
-
-    peripheral_state->tx_read_position =
-        HW_SPI_Wrap_Tx_Buffer_Index( packet->start_index + packet_size_bytes );
-
-    // Descriptor clearing is for debug/readability only. Descriptor ownership is
-    // controlled by tx_packet_read_position and tx_num_packets_pending.
-    packet->start_index = 0U;
-    packet->size_bytes  = 0U;
-
-    return true;
-}
@@ -716,6 +716,31 @@ void LL_SPI_EnableDMAReq_RX( SPI_TypeDef* SPIx );
  */
 void LL_SPI_Enable( SPI_TypeDef* SPIx );
 
+/**
+ * @brief  Enable Rx buffer not empty IT
+ * @rmtoll CR2          RXNEIE        LL_SPI_EnableIT_RXNE
+ * @param  SPIx SPI Instance
+ * @retval None
+ */
+void LL_SPI_EnableIT_RXNE( SPI_TypeDef* SPIx );
+
+/**
+ * @brief  Disable Rx buffer not empty IT
+ * @rmtoll CR2          RXNEIE        LL_SPI_DisableIT_RXNE
+ * @param  SPIx SPI Instance
+ * @retval None
+ */
+void LL_SPI_DisableIT_RXNE( SPI_TypeDef* SPIx );
+
+/**
+ * @brief  Write 8-Bits in the data register
+ * @rmtoll DR           DR            LL_SPI_TransmitData8
+ * @param  SPIx SPI Instance
+ * @param  TxData Value between Min_Data=0x00 and Max_Data=0xFF
+ * @retval None
+ */
+void LL_SPI_TransmitData8( SPI_TypeDef* SPIx, uint8_t TxData );
+
 /**
  * @brief  Get busy flag
  * @note   The BSY flag is cleared under any one of the following conditions:
@@ -747,6 +772,14 @@ void NVIC_DisableIRQ( IRQn_Type IRQn );
  */
 void NVIC_EnableIRQ( IRQn_Type IRQn );
 
+/**
+  \brief   Set Interrupt Priority
+  \details Sets the priority of a device specific interrupt.
+  \param [in]      IRQn  Device specific interrupt number.
+  \param [in]  priority  Priority to set.
+ */
+void NVIC_SetPriority( IRQn_Type IRQn, uint32_t priority );
+
 // DMA IRQ Handlers
 void DMA1_Stream3_IRQHandler( void );
 void DMA1_Stream4_IRQHandler( void );
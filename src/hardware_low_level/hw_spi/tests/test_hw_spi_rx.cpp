@@ -36,11 +36,12 @@ extern "C"
 #include <stdint.h>
 #include <string.h>
 
-#include "../hw_spi_config.c"     // NOLINT
-#include "../hw_spi_rx.c"         // NOLINT
-#include "../hw_spi_tx_config.c"  // NOLINT
-#include "../hw_spi_tx_master.c"  // NOLINT
-#include "../hw_spi_tx_slave.c"   // NOLINT
+#include "../hw_spi_config.c"              // NOLINT
+#include "../hw_spi_rx.c"                  // NOLINT
+#include "../hw_spi_slave_register_map.c"  // NOLINT
+#include "../hw_spi_tx_config.c"           // NOLINT
+#include "../hw_spi_tx_master.c"           // NOLINT
+#include "../hw_spi_tx_slave.c"            // NOLINT
 }
 
 using ::testing::_;
@@ -57,6 +58,10 @@ using ::testing::StrictMock;
  *------------------------------------------------------------------------------
  */
 
+// Ring sizes follow the SPI size profile this suite was built with.
+static constexpr uint32_t CHANNEL_0_RX_BYTES = SPI_CHANNEL_0_RX_BUFFER_SIZE_BYTES;
+static constexpr uint32_t CHANNEL_1_RX_BYTES = SPI_CHANNEL_1_RX_BUFFER_SIZE_BYTES;
+
 /**-----------------------------------------------------------------------------
  *  Test Doubles / Mocks
  *------------------------------------------------------------------------------
@@ -111,10 +116,12 @@ class MockHWSPI
 
     MOCK_METHOD( void, NVICDisableIRQ, ( IRQn_Type irqn ), () );
     MOCK_METHOD( void, NVICEnableIRQ, ( IRQn_Type irqn ), () );
+    MOCK_METHOD( void, NVICSetPriority, ( IRQn_Type irqn, uint32_t priority ), () );
 
     MOCK_METHOD( void, TimerConfigure, ( Timer_T timer, uint32_t psc, uint32_t arr ), () );
     MOCK_METHOD( void, TimerStart, ( Timer_T timer ), () );
     MOCK_METHOD( void, TimerStop, ( Timer_T timer ), () );
+    MOCK_METHOD( void, TimerStartCycleCounter, (), () );
 };
 
 static MockHWSPI* g_mock = nullptr;
@@ -208,6 +215,22 @@ extern "C" void LL_SPI_Enable( SPI_TypeDef* SPIx )
     }
 }
 
+extern "C" void LL_SPI_EnableIT_RXNE( SPI_TypeDef* SPIx )
+{
+    ( void )SPIx;
+}
+
+extern "C" void LL_SPI_DisableIT_RXNE( SPI_TypeDef* SPIx )
+{
+    ( void )SPIx;
+}
+
+extern "C" void LL_SPI_TransmitData8( SPI_TypeDef* SPIx, uint8_t TxData )
+{
+    ( void )SPIx;
+    ( void )TxData;
+}
+
 extern "C" void LL_DMA_EnableIT_TC( DMA_TypeDef* DMAx, uint32_t Stream )
 {
     if ( g_mock )
@@ -371,6 +394,14 @@ extern "C" void NVIC_EnableIRQ( IRQn_Type IRQn )
     }
 }
 
+extern "C" void NVIC_SetPriority( IRQn_Type IRQn, uint32_t priority )
+{
+    if ( g_mock )
+    {
+        g_mock->NVICSetPriority( IRQn, priority );
+    }
+}
+
 extern "C" void HW_TIMER_Configure_Timer( Timer_T timer, uint32_t psc, uint32_t arr )
 {
     if ( g_mock )
@@ -395,6 +426,19 @@ extern "C" void HW_TIMER_Stop_Timer( Timer_T timer )
     }
 }
 
+extern "C" void HW_TIMER_Start_Cycle_Counter( void )
+{
+    if ( g_mock )
+    {
+        g_mock->TimerStartCycleCounter();
+    }
+}
+
+extern "C" uint32_t HW_TIMER_Get_Cycle_Count( void )
+{
+    return 0U;
+}
+
 /**-----------------------------------------------------------------------------
  *  Test Fixture
  *------------------------------------------------------------------------------
@@ -440,6 +484,7 @@ class HWSPIRxTest : public ::testing::Test
                                  IRQn_Type tx_irqn, Timer_T timer )
     {
         memset( state, 0, sizeof( *state ) );
+        HW_SPI_Bind_Channel_Storage( state, logical );
         state->config                    = config;
         state->logical_peripheral        = logical;
         state->nss_pin                   = config.nss_pin;
@@ -564,7 +609,7 @@ TEST_F( HWSPIRxTest, StartChannel_Channel0ArmsPassiveRxDmaIn8BitMode )
                                       Eq( 0x12345678U ) ) );
     EXPECT_CALL( mock,
                  DMASetDataLength( Eq( SPI_CHANNEL_0_RX_DMA ), Eq( SPI_CHANNEL_0_RX_DMA_STREAM ),
-                                   Eq( RX_BUFFER_SIZE_BYTES ) ) );
+                                   Eq( CHANNEL_0_RX_BYTES ) ) );
     EXPECT_CALL( mock,
                  DMAEnableStream( Eq( SPI_CHANNEL_0_RX_DMA ), Eq( SPI_CHANNEL_0_RX_DMA_STREAM ) ) );
     EXPECT_CALL( mock, SPIEnableDMAReqRX( Eq( SPI_CHANNEL_0_INSTANCE ) ) );
@@ -598,7 +643,7 @@ TEST_F( HWSPIRxTest, StartChannel_Channel1UsesHalfAsManyDmaElementsIn16BitMode )
                                       Eq( 0xCAFEBABEU ) ) );
     EXPECT_CALL( mock,
                  DMASetDataLength( Eq( SPI_CHANNEL_1_RX_DMA ), Eq( SPI_CHANNEL_1_RX_DMA_STREAM ),
-                                   Eq( RX_BUFFER_SIZE_BYTES / 2U ) ) );
+                                   Eq( CHANNEL_1_RX_BYTES / 2U ) ) );
     EXPECT_CALL( mock,
                  DMAEnableStream( Eq( SPI_CHANNEL_1_RX_DMA ), Eq( SPI_CHANNEL_1_RX_DMA_STREAM ) ) );
     EXPECT_CALL( mock, SPIEnableDMAReqRX( Eq( SPI_CHANNEL_1_INSTANCE ) ) );
@@ -612,7 +657,7 @@ TEST_F( HWSPIRxTest, RxPeek_ReturnsEmptySpansWhenDmaWriteEqualsRead )
     HW_SPI_STATE( SPI_CHANNEL_0 )->rx_position = 0U;
     EXPECT_CALL( mock,
                  DMAGetDataLength( Eq( SPI_CHANNEL_0_RX_DMA ), Eq( SPI_CHANNEL_0_RX_DMA_STREAM ) ) )
-        .WillOnce( Return( RX_BUFFER_SIZE_BYTES ) );
+        .WillOnce( Return( CHANNEL_0_RX_BYTES ) );
 
     HWSPIRxSpans_T spans = HW_SPI_Rx_Peek( SPI_CHANNEL_0 );
 
@@ -628,7 +673,7 @@ TEST_F( HWSPIRxTest, RxPeek_ReturnsSingleSpanWhenUnreadDataDoesNotWrap )
     HW_SPI_STATE( SPI_CHANNEL_0 )->rx_position = 100U;
     EXPECT_CALL( mock,
                  DMAGetDataLength( Eq( SPI_CHANNEL_0_RX_DMA ), Eq( SPI_CHANNEL_0_RX_DMA_STREAM ) ) )
-        .WillOnce( Return( 824U ) );  // write index = 200
+        .WillOnce( Return( CHANNEL_0_RX_BYTES - 200U ) );  // write index = 200
 
     HWSPIRxSpans_T spans = HW_SPI_Rx_Peek( SPI_CHANNEL_0 );
 
@@ -641,14 +686,15 @@ TEST_F( HWSPIRxTest, RxPeek_ReturnsSingleSpanWhenUnreadDataDoesNotWrap )
 
 TEST_F( HWSPIRxTest, RxPeek_ReturnsTwoSpansWhenUnreadDataWraps )
 {
-    HW_SPI_STATE( SPI_CHANNEL_0 )->rx_position = 1000U;
+    HW_SPI_STATE( SPI_CHANNEL_0 )->rx_position = CHANNEL_0_RX_BYTES - 24U;
     EXPECT_CALL( mock,
                  DMAGetDataLength( Eq( SPI_CHANNEL_0_RX_DMA ), Eq( SPI_CHANNEL_0_RX_DMA_STREAM ) ) )
-        .WillOnce( Return( 974U ) );  // write index = 50
+        .WillOnce( Return( CHANNEL_0_RX_BYTES - 50U ) );  // write index = 50
 
     HWSPIRxSpans_T spans = HW_SPI_Rx_Peek( SPI_CHANNEL_0 );
 
-    EXPECT_EQ( spans.first_span.data, &HW_SPI_STATE( SPI_CHANNEL_0 )->rx_buffer[1000] );
+    EXPECT_EQ( spans.first_span.data,
+               &HW_SPI_STATE( SPI_CHANNEL_0 )->rx_buffer[CHANNEL_0_RX_BYTES - 24U] );
     EXPECT_EQ( spans.first_span.length_bytes, 24U );
     EXPECT_EQ( spans.second_span.data, &HW_SPI_STATE( SPI_CHANNEL_0 )->rx_buffer[0] );
     EXPECT_EQ( spans.second_span.length_bytes, 50U );
@@ -664,7 +710,7 @@ TEST_F( HWSPIRxTest, RxPeek_ConvertsDmaElementsBackToBytesIn16BitMode )
 
     EXPECT_CALL( mock,
                  DMAGetDataLength( Eq( SPI_CHANNEL_1_RX_DMA ), Eq( SPI_CHANNEL_1_RX_DMA_STREAM ) ) )
-        .WillOnce( Return( 507U ) );  // remaining bytes = 1014, write index = 10
+        .WillOnce( Return( CHANNEL_1_RX_BYTES / 2U - 5U ) );  // write index = 10
 
     HWSPIRxSpans_T spans = HW_SPI_Rx_Peek( SPI_CHANNEL_1 );
 
@@ -683,14 +729,14 @@ TEST_F( HWSPIRxTest, RxPeek_TreatsNdtrReloadToZeroAsWriteIndexZero )
     HWSPIRxSpans_T spans = HW_SPI_Rx_Peek( SPI_CHANNEL_0 );
 
     EXPECT_EQ( spans.first_span.data, &HW_SPI_STATE( SPI_CHANNEL_0 )->rx_buffer[100] );
-    EXPECT_EQ( spans.first_span.length_bytes, RX_BUFFER_SIZE_BYTES - 100U );
+    EXPECT_EQ( spans.first_span.length_bytes, CHANNEL_0_RX_BYTES - 100U );
     EXPECT_EQ( spans.second_span.length_bytes, 0U );
-    EXPECT_EQ( spans.total_length_bytes, RX_BUFFER_SIZE_BYTES - 100U );
+    EXPECT_EQ( spans.total_length_bytes, CHANNEL_0_RX_BYTES - 100U );
 }
 
 TEST_F( HWSPIRxTest, RxConsume_UsesMaskBasedWrapAtEndOfBuffer )
 {
-    HW_SPI_STATE( SPI_CHANNEL_0 )->rx_position = 1000U;
+    HW_SPI_STATE( SPI_CHANNEL_0 )->rx_position = CHANNEL_0_RX_BYTES - 24U;
 
     HW_SPI_Rx_Consume( SPI_CHANNEL_0, 50U );
 
@@ -701,7 +747,7 @@ TEST_F( HWSPIRxTest, RxConsume_HandlesLargePowerOfTwoDistanceWithoutDivision )
 {
     HW_SPI_STATE( SPI_CHANNEL_0 )->rx_position = 17U;
 
-    HW_SPI_Rx_Consume( SPI_CHANNEL_0, RX_BUFFER_SIZE_BYTES * 3U + 9U );
+    HW_SPI_Rx_Consume( SPI_CHANNEL_0, CHANNEL_0_RX_BYTES * 3U + 9U );
 
     EXPECT_EQ( HW_SPI_STATE( SPI_CHANNEL_0 )->rx_position, 26U );
 }
@@ -776,7 +822,7 @@ TEST_F( HWSPIRxTest, StartChannel_WaitsForRxDmaStreamToDisableNotTxDmaStream )
                                       Eq( 0x20000000U ) ) );
     EXPECT_CALL( mock,
                  DMASetDataLength( Eq( SPI_CHANNEL_0_RX_DMA ), Eq( SPI_CHANNEL_0_RX_DMA_STREAM ),
-                                   Eq( RX_BUFFER_SIZE_BYTES ) ) );
+                                   Eq( CHANNEL_0_RX_BYTES ) ) );
     EXPECT_CALL( mock,
                  DMAEnableStream( Eq( SPI_CHANNEL_0_RX_DMA ), Eq( SPI_CHANNEL_0_RX_DMA_STREAM ) ) );
     EXPECT_CALL( mock, SPIEnableDMAReqRX( Eq( SPI_CHANNEL_0_INSTANCE ) ) );
@@ -792,11 +838,324 @@ TEST_F( HWSPIRxTest, StartChannel_WaitsForRxDmaStreamToDisableNotTxDmaStream )
  */
 TEST_F( HWSPIRxTest, RxConsume_Channel1DoesNotModifyChannel0 )
 {
-    HW_SPI_STATE( SPI_CHANNEL_0 )->rx_position = 100U;
-    HW_SPI_STATE( SPI_CHANNEL_1 )->rx_position = 200U;
+    HW_SPI_STATE( SPI_CHANNEL_0 )->rx_position = 10U;
+    HW_SPI_STATE( SPI_CHANNEL_1 )->rx_position = 20U;
 
     HW_SPI_Rx_Consume( SPI_CHANNEL_1, 30U );
 
-    EXPECT_EQ( HW_SPI_STATE( SPI_CHANNEL_0 )->rx_position, 100U );
-    EXPECT_EQ( HW_SPI_STATE( SPI_CHANNEL_1 )->rx_position, 230U );
+    EXPECT_EQ( HW_SPI_STATE( SPI_CHANNEL_0 )->rx_position, 10U );
+    EXPECT_EQ( HW_SPI_STATE( SPI_CHANNEL_1 )->rx_position, 50U );
+}
+
+/**
+ * @brief NSS framing is rejected for master channels and TX-only channels.
+ */
+TEST_F( HWSPIRxTest, ConfigureChannel_RejectsNssFramingWithoutSlaveRx )
+{
+    HWSPIConfig_T master_config  = MakeMasterConfig();
+    master_config.rx_nss_framing = true;
+
+    HWSPIConfig_T dac_config  = MakeSlaveConfig();
+    dac_config.nss_pin        = GPIO_SPI4_NSS;
+    dac_config.rx_nss_framing = true;
+
+    EXPECT_FALSE( HW_SPI_Configure_Channel( SPI_CHANNEL_0, master_config ) );
+    EXPECT_FALSE( HW_SPI_Configure_Channel( SPI_DAC, dac_config ) );
+}
+
+/**
+ * @brief Framed slave configuration starts the timestamp counter and NSS IRQ.
+ */
+TEST_F( HWSPIRxTest, ConfigureChannel_SlaveNssFramingEnablesExtiIrq )
+{
+    HWSPIConfig_T config  = MakeSlaveConfig();
+    config.nss_pin        = GPIO_SPI2_NSS;
+    config.rx_nss_framing = true;
+
+    EXPECT_CALL( mock, SPIInit( Eq( &SPI_CHANNEL_1_HANDLE ) ) ).WillOnce( Return( HAL_OK ) );
+    EXPECT_CALL( mock, DMASetMemorySize( _, _, _ ) ).Times( AnyNumber() );
+    EXPECT_CALL( mock, DMASetPeriphSize( _, _, _ ) ).Times( AnyNumber() );
+    EXPECT_CALL( mock, DMASetPeriphAddress( _, _, _ ) ).Times( AnyNumber() );
+    EXPECT_CALL( mock, SPIDMAGetRegAddr( _ ) ).Times( AnyNumber() );
+    EXPECT_CALL( mock, DMAEnableITTC( _, _ ) ).Times( AnyNumber() );
+    EXPECT_CALL( mock, DMAEnableITTE( _, _ ) ).Times( AnyNumber() );
+    EXPECT_CALL( mock, TimerStartCycleCounter() );
+    EXPECT_CALL( mock,
+                 NVICSetPriority( Eq( SPI_CHANNEL_1_NSS_EXTI_IRQN ), Eq( SPI_IRQ_PRIORITY ) ) );
+    EXPECT_CALL( mock, NVICEnableIRQ( Eq( SPI_CHANNEL_1_NSS_EXTI_IRQN ) ) );
+
+    ASSERT_TRUE( HW_SPI_Configure_Channel( SPI_CHANNEL_1, config ) );
+
+    EXPECT_TRUE( HW_SPI_STATE( SPI_CHANNEL_1 )->rx_nss_framing );
+}
+
+/**
+ * @brief Reconfiguring a framed slave without framing masks its NSS EXTI IRQ.
+ */
+TEST_F( HWSPIRxTest, ConfigureChannel_DisablingNssFramingDisablesExtiIrq )
+{
+    HWSPIConfig_T config  = MakeSlaveConfig();
+    config.nss_pin        = GPIO_SPI2_NSS;
+    config.rx_nss_framing = true;
+
+    EXPECT_CALL( mock, SPIInit( Eq( &SPI_CHANNEL_1_HANDLE ) ) )
+        .Times( 2 )
+        .WillRepeatedly( Return( HAL_OK ) );
+    EXPECT_CALL( mock, DMASetMemorySize( _, _, _ ) ).Times( AnyNumber() );
+    EXPECT_CALL( mock, DMASetPeriphSize( _, _, _ ) ).Times( AnyNumber() );
+    EXPECT_CALL( mock, DMASetPeriphAddress( _, _, _ ) ).Times( AnyNumber() );
+    EXPECT_CALL( mock, SPIDMAGetRegAddr( _ ) ).Times( AnyNumber() );
+    EXPECT_CALL( mock, DMAEnableITTC( _, _ ) ).Times( AnyNumber() );
+    EXPECT_CALL( mock, DMAEnableITTE( _, _ ) ).Times( AnyNumber() );
+    EXPECT_CALL( mock, TimerStartCycleCounter() );
+    EXPECT_CALL( mock,
+                 NVICSetPriority( Eq( SPI_CHANNEL_1_NSS_EXTI_IRQN ), Eq( SPI_IRQ_PRIORITY ) ) );
+    EXPECT_CALL( mock, NVICEnableIRQ( Eq( SPI_CHANNEL_1_NSS_EXTI_IRQN ) ) );
+    EXPECT_CALL( mock, NVICDisableIRQ( Eq( SPI_CHANNEL_1_NSS_EXTI_IRQN ) ) );
+
+    ASSERT_TRUE( HW_SPI_Configure_Channel( SPI_CHANNEL_1, config ) );
+
+    config.rx_nss_framing = false;
+    ASSERT_TRUE( HW_SPI_Configure_Channel( SPI_CHANNEL_1, config ) );
+
+    EXPECT_FALSE( HW_SPI_STATE( SPI_CHANNEL_1 )->rx_nss_framing );
+}
+
+/**
+ * @brief Register-map storage is bound only to channels that can be framed slaves.
+ */
+TEST_F( HWSPIRxTest, BindChannelStorage_RegisterMapOnlyOnSlaveCapableChannels )
+{
+    HW_SPI_Bind_Channel_Storage( HW_SPI_STATE( SPI_CHANNEL_0 ), SPI_CHANNEL_0 );
+    HW_SPI_Bind_Channel_Storage( HW_SPI_STATE( SPI_CHANNEL_1 ), SPI_CHANNEL_1 );
+    HW_SPI_Bind_Channel_Storage( HW_SPI_STATE( SPI_DAC ), SPI_DAC );
+
+    EXPECT_NE( HW_SPI_STATE( SPI_CHANNEL_0 )->register_map, nullptr );
+    EXPECT_NE( HW_SPI_STATE( SPI_CHANNEL_1 )->register_map, nullptr );
+    EXPECT_NE( HW_SPI_STATE( SPI_CHANNEL_0 )->register_map,
+               HW_SPI_STATE( SPI_CHANNEL_1 )->register_map );
+    EXPECT_EQ( HW_SPI_STATE( SPI_DAC )->register_map, nullptr );
+}
+
+/**
+ * @brief Register-map emulation needs a framed 8-bit slave and a valid command size.
+ */
+TEST_F( HWSPIRxTest, ConfigureChannel_RejectsRegisterMapWithoutFramedByteSlave )
+{
+    HWSPIConfig_T unframed_config              = MakeSlaveConfig();
+    unframed_config.register_map.enabled       = true;
+    unframed_config.register_map.command_bytes = 1U;
+
+    HWSPIConfig_T wide_config              = MakeSlaveConfig( SPI_SIZE_16_BIT );
+    wide_config.rx_nss_framing             = true;
+    wide_config.register_map.enabled       = true;
+    wide_config.register_map.command_bytes = 1U;
+
+    HWSPIConfig_T bad_command_config              = MakeSlaveConfig();
+    bad_command_config.rx_nss_framing             = true;
+    bad_command_config.register_map.enabled       = true;
+    bad_command_config.register_map.command_bytes = 3U;
+
+    EXPECT_FALSE( HW_SPI_Configure_Channel( SPI_CHANNEL_0, unframed_config ) );
+    EXPECT_FALSE( HW_SPI_Configure_Channel( SPI_CHANNEL_0, wide_config ) );
+    EXPECT_FALSE( HW_SPI_Configure_Channel( SPI_CHANNEL_0, bad_command_config ) );
+}
+
+/**
+ * @brief A register-map slave also enables its SPI global IRQ for command decode.
+ */
+TEST_F( HWSPIRxTest, ConfigureChannel_RegisterMapEnablesSpiIrq )
+{
+    HWSPIConfig_T config              = MakeSlaveConfig();
+    config.nss_pin                    = GPIO_SPI2_NSS;
+    config.rx_nss_framing             = true;
+    config.register_map.enabled       = true;
+    config.register_map.command_bytes = 1U;
+
+    EXPECT_CALL( mock, SPIInit( Eq( &SPI_CHANNEL_1_HANDLE ) ) ).WillOnce( Return( HAL_OK ) );
+    EXPECT_CALL( mock, DMASetMemorySize( _, _, _ ) ).Times( AnyNumber() );
+    EXPECT_CALL( mock, DMASetPeriphSize( _, _, _ ) ).Times( AnyNumber() );
+    EXPECT_CALL( mock, DMASetPeriphAddress( _, _, _ ) ).Times( AnyNumber() );
+    EXPECT_CALL( mock, SPIDMAGetRegAddr( _ ) ).Times( AnyNumber() );
+    EXPECT_CALL( mock, DMAEnableITTC( _, _ ) ).Times( AnyNumber() );
+    EXPECT_CALL( mock, DMAEnableITTE( _, _ ) ).Times( AnyNumber() );
+    EXPECT_CALL( mock, TimerStartCycleCounter() );
+    EXPECT_CALL( mock,
+                 NVICSetPriority( Eq( SPI_CHANNEL_1_NSS_EXTI_IRQN ), Eq( SPI_IRQ_PRIORITY ) ) );
+    EXPECT_CALL( mock, NVICEnableIRQ( Eq( SPI_CHANNEL_1_NSS_EXTI_IRQN ) ) );
+    EXPECT_CALL( mock, NVICEnableIRQ( Eq( SPI_CHANNEL_1_IRQN ) ) );
+
+    ASSERT_TRUE( HW_SPI_Configure_Channel( SPI_CHANNEL_1, config ) );
+
+    EXPECT_TRUE( HW_SPI_STATE( SPI_CHANNEL_1 )->register_map_enabled );
+    EXPECT_EQ( HW_SPI_STATE( SPI_CHANNEL_1 )->spi_irqn, SPI_CHANNEL_1_IRQN );
+}
+
+/**
+ * @brief One NSS assert/deassert pair produces one timestamped transaction.
+ */
+TEST_F( HWSPIRxTest, NssEdges_QueueOneTransactionWithTimestamps )
+{
+    SPIPeripheralState_T* state = HW_SPI_STATE( SPI_CHANNEL_0 );
+    HWSPIRxTransaction_T  transaction;
+    state->rx_nss_framing = true;
+    state->is_started     = true;
+    state->rx_position    = 10U;
+
+    EXPECT_CALL( mock, DMAGetDataLength( Eq( SPI_CHANNEL_0_RX_DMA ), _ ) )
+        .WillOnce( Return( CHANNEL_0_RX_BYTES - 10U ) )   // assert at index 10
+        .WillOnce( Return( CHANNEL_0_RX_BYTES - 18U ) );  // deassert at index 18
+
+    HW_SPI_RX_NSS_Edge_From_ISR( SPI_CHANNEL_0, state, false, 1000U );
+    EXPECT_FALSE( HW_SPI_Rx_Peek_Transaction( SPI_CHANNEL_0, &transaction ) );
+
+    HW_SPI_RX_NSS_Edge_From_ISR( SPI_CHANNEL_0, state, true, 1450U );
+    ASSERT_TRUE( HW_SPI_Rx_Peek_Transaction( SPI_CHANNEL_0, &transaction ) );
+
+    EXPECT_EQ( transaction.data.first_span.data, &state->rx_buffer[10] );
+    EXPECT_EQ( transaction.data.first_span.length_bytes, 8U );
+    EXPECT_EQ( transaction.data.second_span.length_bytes, 0U );
+    EXPECT_EQ( transaction.data.total_length_bytes, 8U );
+    EXPECT_EQ( transaction.assert_timestamp_cycles, 1000U );
+    EXPECT_EQ( transaction.deassert_timestamp_cycles, 1450U );
+    EXPECT_EQ( transaction.dropped_transactions, 0U );
+
+    HW_SPI_Rx_Consume_Transaction( SPI_CHANNEL_0 );
+
+    EXPECT_EQ( state->rx_position, 18U );
+    EXPECT_FALSE( HW_SPI_Rx_Peek_Transaction( SPI_CHANNEL_0, &transaction ) );
+}
+
+/**
+ * @brief A transaction crossing the end of the RX ring is returned as two spans.
+ */
+TEST_F( HWSPIRxTest, NssEdges_TransactionAcrossRingWrapReturnsTwoSpans )
+{
+    SPIPeripheralState_T* state = HW_SPI_STATE( SPI_CHANNEL_0 );
+    HWSPIRxTransaction_T  transaction;
+    state->rx_nss_framing = true;
+    state->is_started     = true;
+
+    EXPECT_CALL( mock, DMAGetDataLength( Eq( SPI_CHANNEL_0_RX_DMA ), _ ) )
+        .WillOnce( Return( 4U ) )                         // assert at last 4 bytes
+        .WillOnce( Return( CHANNEL_0_RX_BYTES - 6U ) );  // deassert at index 6
+
+    HW_SPI_RX_NSS_Edge_From_ISR( SPI_CHANNEL_0, state, false, 0U );
+    HW_SPI_RX_NSS_Edge_From_ISR( SPI_CHANNEL_0, state, true, 0U );
+
+    ASSERT_TRUE( HW_SPI_Rx_Peek_Transaction( SPI_CHANNEL_0, &transaction ) );
+    EXPECT_EQ( transaction.data.first_span.data, &state->rx_buffer[CHANNEL_0_RX_BYTES - 4U] );
+    EXPECT_EQ( transaction.data.first_span.length_bytes, 4U );
+    EXPECT_EQ( transaction.data.second_span.data, &state->rx_buffer[0] );
+    EXPECT_EQ( transaction.data.second_span.length_bytes, 6U );
+    EXPECT_EQ( transaction.data.total_length_bytes, 10U );
+}
+
+/**
+ * @brief Coalesced edges close the open transaction and start the next one.
+ */
+TEST_F( HWSPIRxTest, NssEdges_LowLevelWhileOpenSplitsBackToBackTransactions )
+{
+    SPIPeripheralState_T* state = HW_SPI_STATE( SPI_CHANNEL_0 );
+    HWSPIRxTransaction_T  transaction;
+    state->rx_nss_framing = true;
+    state->is_started     = true;
+
+    EXPECT_CALL( mock, DMAGetDataLength( Eq( SPI_CHANNEL_0_RX_DMA ), _ ) )
+        .WillOnce( Return( CHANNEL_0_RX_BYTES ) )
+        .WillOnce( Return( CHANNEL_0_RX_BYTES - 4U ) )
+        .WillOnce( Return( CHANNEL_0_RX_BYTES - 6U ) );
+
+    HW_SPI_RX_NSS_Edge_From_ISR( SPI_CHANNEL_0, state, false, 100U );
+    HW_SPI_RX_NSS_Edge_From_ISR( SPI_CHANNEL_0, state, false, 200U );
+    HW_SPI_RX_NSS_Edge_From_ISR( SPI_CHANNEL_0, state, true, 300U );
+
+    ASSERT_TRUE( HW_SPI_Rx_Peek_Transaction( SPI_CHANNEL_0, &transaction ) );
+    EXPECT_EQ( transaction.data.total_length_bytes, 4U );
+    EXPECT_EQ( transaction.deassert_timestamp_cycles, 200U );
+    HW_SPI_Rx_Consume_Transaction( SPI_CHANNEL_0 );
+
+    ASSERT_TRUE( HW_SPI_Rx_Peek_Transaction( SPI_CHANNEL_0, &transaction ) );
+    EXPECT_EQ( transaction.data.first_span.data, &state->rx_buffer[4] );
+    EXPECT_EQ( transaction.data.total_length_bytes, 2U );
+    EXPECT_EQ( transaction.assert_timestamp_cycles, 200U );
+    EXPECT_EQ( transaction.deassert_timestamp_cycles, 300U );
+}
+
+/**
+ * @brief A coalesced fall-then-rise queues the bytes written since the last close.
+ */
+TEST_F( HWSPIRxTest, NssEdges_HighLevelWhileClosedQueuesShortTransaction )
+{
+    SPIPeripheralState_T* state = HW_SPI_STATE( SPI_CHANNEL_0 );
+    HWSPIRxTransaction_T  transaction;
+    state->rx_nss_framing = true;
+    state->is_started     = true;
+
+    EXPECT_CALL( mock, DMAGetDataLength( Eq( SPI_CHANNEL_0_RX_DMA ), _ ) )
+        .WillOnce( Return( CHANNEL_0_RX_BYTES ) )
+        .WillOnce( Return( CHANNEL_0_RX_BYTES - 4U ) )
+        .WillOnce( Return( CHANNEL_0_RX_BYTES - 7U ) );
+
+    HW_SPI_RX_NSS_Edge_From_ISR( SPI_CHANNEL_0, state, false, 100U );
+    HW_SPI_RX_NSS_Edge_From_ISR( SPI_CHANNEL_0, state, true, 200U );
+
+    // Both edges of the second transaction land before the EXTI handler runs.
+    HW_SPI_RX_NSS_Edge_From_ISR( SPI_CHANNEL_0, state, true, 300U );
+
+    ASSERT_TRUE( HW_SPI_Rx_Peek_Transaction( SPI_CHANNEL_0, &transaction ) );
+    EXPECT_EQ( transaction.data.total_length_bytes, 4U );
+    HW_SPI_Rx_Consume_Transaction( SPI_CHANNEL_0 );
+
+    ASSERT_TRUE( HW_SPI_Rx_Peek_Transaction( SPI_CHANNEL_0, &transaction ) );
+    EXPECT_EQ( transaction.data.first_span.data, &state->rx_buffer[4] );
+    EXPECT_EQ( transaction.data.total_length_bytes, 3U );
+    EXPECT_EQ( transaction.assert_timestamp_cycles, 300U );
+    EXPECT_EQ( transaction.deassert_timestamp_cycles, 300U );
+    EXPECT_EQ( transaction.dropped_transactions, 0U );
+}
+
+/**
+ * @brief A full descriptor queue keeps old transactions and counts new losses.
+ */
+TEST_F( HWSPIRxTest, NssEdges_FullQueueCountsDroppedTransactions )
+{
+    SPIPeripheralState_T* state = HW_SPI_STATE( SPI_CHANNEL_0 );
+    HWSPIRxTransaction_T  transaction;
+    state->rx_nss_framing = true;
+    state->is_started     = true;
+
+    EXPECT_CALL( mock, DMAGetDataLength( Eq( SPI_CHANNEL_0_RX_DMA ), _ ) )
+        .WillRepeatedly( Return( CHANNEL_0_RX_BYTES ) );
+
+    for ( uint32_t index = 0U; index < RX_TRANSACTION_QUEUE_DEPTH + 2U; index++ )
+    {
+        HW_SPI_RX_NSS_Edge_From_ISR( SPI_CHANNEL_0, state, false, index );
+        HW_SPI_RX_NSS_Edge_From_ISR( SPI_CHANNEL_0, state, true, index );
+    }
+
+    ASSERT_TRUE( HW_SPI_Rx_Peek_Transaction( SPI_CHANNEL_0, &transaction ) );
+    EXPECT_EQ( transaction.assert_timestamp_cycles, 0U );
+    EXPECT_EQ( transaction.dropped_transactions, 2U );
+}
+
+/**
+ * @brief Edges are ignored unless the channel is started with framing enabled.
+ */
+TEST_F( HWSPIRxTest, NssEdges_IgnoredWhenFramingDisabledOrStopped )
+{
+    SPIPeripheralState_T* state = HW_SPI_STATE( SPI_CHANNEL_0 );
+    HWSPIRxTransaction_T  transaction;
+
+    state->rx_nss_framing = false;
+    state->is_started     = true;
+    HW_SPI_RX_NSS_Edge_From_ISR( SPI_CHANNEL_0, state, false, 1U );
+    HW_SPI_RX_NSS_Edge_From_ISR( SPI_CHANNEL_0, state, true, 2U );
+
+    state->rx_nss_framing = true;
+    state->is_started     = false;
+    HW_SPI_RX_NSS_Edge_From_ISR( SPI_CHANNEL_0, state, false, 3U );
+    HW_SPI_RX_NSS_Edge_From_ISR( SPI_CHANNEL_0, state, true, 4U );
+
+    EXPECT_FALSE( HW_SPI_Rx_Peek_Transaction( SPI_CHANNEL_0, &transaction ) );
 }
@@ -38,11 +38,12 @@ extern "C"
 #include <stdint.h>
 #include <string.h>
 
-#include "../hw_spi_config.c"     // NOLINT
-#include "../hw_spi_rx.c"         // NOLINT
-#include "../hw_spi_tx_config.c"  // NOLINT
-#include "../hw_spi_tx_master.c"  // NOLINT
-#include "../hw_spi_tx_slave.c"   // NOLINT
+#include "../hw_spi_config.c"              // NOLINT
+#include "../hw_spi_rx.c"                  // NOLINT
+#include "../hw_spi_slave_register_map.c"  // NOLINT
+#include "../hw_spi_tx_config.c"           // NOLINT
+#include "../hw_spi_tx_master.c"           // NOLINT
+#include "../hw_spi_tx_slave.c"            // NOLINT
 }
 
 using ::testing::_;
@@ -54,6 +55,15 @@ using ::testing::Invoke;
 using ::testing::Return;
 using ::testing::StrictMock;
 
+/**-----------------------------------------------------------------------------
+ *  Test Constants / Macros
+ *------------------------------------------------------------------------------
+ */
+
+// Ring sizes follow the SPI size profile this suite was built with.
+static constexpr uint32_t CHANNEL_0_TX_BYTES   = SPI_CHANNEL_0_TX_BUFFER_SIZE_BYTES;
+static constexpr uint32_t CHANNEL_0_TX_PACKETS = SPI_CHANNEL_0_TX_PACKET_QUEUE_DEPTH;
+
 enum class GPIOEventKind
 {
     CONFIGURE_OUTPUT,
@@ -100,6 +110,24 @@ extern "C" void HW_GPIO_Reset_Pin( GPIOPin_T pin )
 {
     gpio_events.push_back( { GPIOEventKind::RESET_LOW, pin, false } );
 }
+
+extern "C" bool HW_GPIO_Read_Configurable_Pin( GPIOPin_T pin )
+{
+    ( void )pin;
+    return true;
+}
+
+extern "C" bool HW_GPIO_Configure_Pin_Edge_Interrupt( GPIOPin_T pin, bool enable )
+{
+    ( void )enable;
+    return HW_GPIO_Is_Valid_Pin( pin );
+}
+
+extern "C" bool HW_GPIO_Clear_Edge_Interrupt( GPIOPin_T pin )
+{
+    ( void )pin;
+    return false;
+}
 /**-----------------------------------------------------------------------------
  *  Test Doubles / Mocks
  *------------------------------------------------------------------------------
@@ -154,6 +182,7 @@ class MockHWSPI
 
     MOCK_METHOD( void, NVICDisableIRQ, ( IRQn_Type irqn ), () );
     MOCK_METHOD( void, NVICEnableIRQ, ( IRQn_Type irqn ), () );
+    MOCK_METHOD( void, NVICSetPriority, ( IRQn_Type irqn, uint32_t priority ), () );
 
     MOCK_METHOD( void, TimerConfigure, ( Timer_T timer, uint32_t psc, uint32_t arr ), () );
     MOCK_METHOD( void, TimerStart, ( Timer_T timer ), () );
@@ -251,6 +280,22 @@ extern "C" void LL_SPI_Enable( SPI_TypeDef* SPIx )
     }
 }
 
+extern "C" void LL_SPI_EnableIT_RXNE( SPI_TypeDef* SPIx )
+{
+    ( void )SPIx;
+}
+
+extern "C" void LL_SPI_DisableIT_RXNE( SPI_TypeDef* SPIx )
+{
+    ( void )SPIx;
+}
+
+extern "C" void LL_SPI_TransmitData8( SPI_TypeDef* SPIx, uint8_t TxData )
+{
+    ( void )SPIx;
+    ( void )TxData;
+}
+
 extern "C" void LL_DMA_EnableIT_TC( DMA_TypeDef* DMAx, uint32_t Stream )
 {
     if ( g_mock )
@@ -415,6 +460,14 @@ extern "C" void NVIC_EnableIRQ( IRQn_Type IRQn )
     }
 }
 
+extern "C" void NVIC_SetPriority( IRQn_Type IRQn, uint32_t priority )
+{
+    if ( g_mock )
+    {
+        g_mock->NVICSetPriority( IRQn, priority );
+    }
+}
+
 extern "C" void HW_TIMER_Configure_Timer( Timer_T timer, uint32_t psc, uint32_t arr )
 {
     if ( g_mock )
@@ -439,6 +492,15 @@ extern "C" void HW_TIMER_Stop_Timer( Timer_T timer )
     }
 }
 
+extern "C" void HW_TIMER_Start_Cycle_Counter( void )
+{
+}
+
+extern "C" uint32_t HW_TIMER_Get_Cycle_Count( void )
+{
+    return 0U;
+}
+
 /**-----------------------------------------------------------------------------
  *  Test Fixture
  *------------------------------------------------------------------------------
@@ -484,6 +546,7 @@ class HWSpiMasterTxTest : public ::testing::Test
                                  IRQn_Type tx_irqn, Timer_T timer )
     {
         memset( state, 0, sizeof( *state ) );
+        HW_SPI_Bind_Channel_Storage( state, logical );
         state->config                    = config;
         state->logical_peripheral        = logical;
         state->nss_pin                   = config.nss_pin;
@@ -665,7 +728,7 @@ TEST_F( HWSpiMasterTxTest, LoadTxBuffer_MasterCreatesOnePacketDescriptorPerLoad
 TEST_F( HWSpiMasterTxTest, LoadTxBuffer_MasterWrapsWholePacketRatherThanSplittingPacket )
 {
     const uint8_t data[6]                            = { 1U, 2U, 3U, 4U, 5U, 6U };
-    HW_SPI_STATE( SPI_CHANNEL_0 )->tx_write_position = TX_BUFFER_SIZE_BYTES - 2U;
+    HW_SPI_STATE( SPI_CHANNEL_0 )->tx_write_position = CHANNEL_0_TX_BYTES - 2U;
     HW_SPI_STATE( SPI_CHANNEL_0 )->tx_read_position  = 20U;
 
     EXPECT_CALL( mock, NVICDisableIRQ( SPI_CHANNEL_0_TX_DMA_IRQN ) );
@@ -682,7 +745,7 @@ TEST_F( HWSpiMasterTxTest, LoadTxBuffer_MasterWrapsWholePacketRatherThanSplittin
 TEST_F( HWSpiMasterTxTest, LoadTxBuffer_MasterRejectsWhenDescriptorQueueIsFull )
 {
     const uint8_t one_byte                                = 0x55U;
-    HW_SPI_STATE( SPI_CHANNEL_0 )->tx_num_packets_pending = TX_PACKET_QUEUE_DEPTH;
+    HW_SPI_STATE( SPI_CHANNEL_0 )->tx_num_packets_pending = CHANNEL_0_TX_PACKETS;
 
     EXPECT_CALL( mock, NVICDisableIRQ( SPI_CHANNEL_0_TX_DMA_IRQN ) );
     EXPECT_CALL( mock, NVICEnableIRQ( SPI_CHANNEL_0_TX_DMA_IRQN ) );
@@ -806,9 +869,9 @@ TEST_F( HWSpiMasterTxTest, LoadTxPackets_InsufficientByteCapacityLeavesQueueUnch
 {
     const uint8_t         packets[6] = { 1U, 2U, 3U, 4U, 5U, 6U };
     SPIPeripheralState_T* state      = HW_SPI_STATE( SPI_CHANNEL_0 );
-    state->tx_write_position         = TX_BUFFER_SIZE_BYTES - 4U;
-    state->tx_num_bytes_pending      = TX_BUFFER_SIZE_BYTES - 4U;
-    memset( state->tx_buffer, 0xA5, sizeof( state->tx_buffer ) );
+    state->tx_write_position         = CHANNEL_0_TX_BYTES - 4U;
+    state->tx_num_bytes_pending      = CHANNEL_0_TX_BYTES - 4U;
+    memset( state->tx_buffer, 0xA5, CHANNEL_0_TX_BYTES );
 
     const SPIPeripheralState_T before = *state;
 
@@ -823,7 +886,7 @@ TEST_F( HWSpiMasterTxTest, LoadTxPackets_InsufficientDescriptorCapacityLeavesQue
 {
     const uint8_t         packets[6] = { 1U, 2U, 3U, 4U, 5U, 6U };
     SPIPeripheralState_T* state      = HW_SPI_STATE( SPI_CHANNEL_0 );
-    state->tx_num_packets_pending    = TX_PACKET_QUEUE_DEPTH - 1U;
+    state->tx_num_packets_pending    = CHANNEL_0_TX_PACKETS - 1U;
 
     const SPIPeripheralState_T before = *state;
 
@@ -1165,7 +1228,7 @@ TEST_F( HWSpiMasterTxTest, LoadTxBuffer_MasterDescriptorWriteIndexWrapsAtQueueDe
     const uint8_t first[1]  = { 0xA1U };
     const uint8_t second[1] = { 0xB2U };
 
-    HW_SPI_STATE( SPI_CHANNEL_0 )->tx_packet_write_position = TX_PACKET_QUEUE_DEPTH - 1U;
+    HW_SPI_STATE( SPI_CHANNEL_0 )->tx_packet_write_position = CHANNEL_0_TX_PACKETS - 1U;
 
     EXPECT_CALL( mock, NVICDisableIRQ( SPI_CHANNEL_0_TX_DMA_IRQN ) ).Times( 2 );
     EXPECT_CALL( mock, NVICEnableIRQ( SPI_CHANNEL_0_TX_DMA_IRQN ) ).Times( 2 );
@@ -1174,11 +1237,11 @@ TEST_F( HWSpiMasterTxTest, LoadTxBuffer_MasterDescriptorWriteIndexWrapsAtQueueDe
     EXPECT_TRUE( HW_SPI_Load_Tx_Buffer( SPI_CHANNEL_0, second, sizeof( second ) ) );
 
     EXPECT_EQ( HW_SPI_STATE( SPI_CHANNEL_0 )
-                   ->tx_packet_descriptors[TX_PACKET_QUEUE_DEPTH - 1U]
+                   ->tx_packet_descriptors[CHANNEL_0_TX_PACKETS - 1U]
                    .start_index,
                0U );
     EXPECT_EQ(
-        HW_SPI_STATE( SPI_CHANNEL_0 )->tx_packet_descriptors[TX_PACKET_QUEUE_DEPTH - 1U].size_bytes,
+        HW_SPI_STATE( SPI_CHANNEL_0 )->tx_packet_descriptors[CHANNEL_0_TX_PACKETS - 1U].size_bytes,
         sizeof( first ) );
     EXPECT_EQ( HW_SPI_STATE( SPI_CHANNEL_0 )->tx_packet_descriptors[0].start_index,
                sizeof( first ) );
@@ -1199,7 +1262,7 @@ TEST_F( HWSpiMasterTxTest, LoadTxBuffer_MasterRejectsWhenWrappedHeadSpaceIsTooSm
 {
     const uint8_t data[8] = { 0U, 1U, 2U, 3U, 4U, 5U, 6U, 7U };
 
-    HW_SPI_STATE( SPI_CHANNEL_0 )->tx_write_position = TX_BUFFER_SIZE_BYTES - 2U;
+    HW_SPI_STATE( SPI_CHANNEL_0 )->tx_write_position = CHANNEL_0_TX_BYTES - 2U;
     HW_SPI_STATE( SPI_CHANNEL_0 )->tx_read_position  = 4U;
 
     EXPECT_CALL( mock, NVICDisableIRQ( SPI_CHANNEL_0_TX_DMA_IRQN ) );
@@ -25,6 +25,8 @@
 #include <gtest/gtest.h>
 #include <gmock/gmock.h>
 
+#include <vector>
+
 extern "C"
 {
 #ifndef TEST_BUILD
@@ -36,11 +38,12 @@ extern "C"
 #include <stdint.h>
 #include <string.h>
 
-#include "../hw_spi_config.c"     // NOLINT
-#include "../hw_spi_rx.c"         // NOLINT
-#include "../hw_spi_tx_config.c"  // NOLINT
-#include "../hw_spi_tx_master.c"  // NOLINT
-#include "../hw_spi_tx_slave.c"   // NOLINT
+#include "../hw_spi_config.c"              // NOLINT
+#include "../hw_spi_rx.c"                  // NOLINT
+#include "../hw_spi_slave_register_map.c"  // NOLINT
+#include "../hw_spi_tx_config.c"           // NOLINT
+#include "../hw_spi_tx_master.c"           // NOLINT
+#include "../hw_spi_tx_slave.c"            // NOLINT
 }
 
 using ::testing::_;
@@ -57,6 +60,26 @@ using ::testing::StrictMock;
  *------------------------------------------------------------------------------
  */
 
+// Ring sizes follow the SPI size profile this suite was built with.
+static constexpr uint32_t CHANNEL_0_RX_BYTES = SPI_CHANNEL_0_RX_BUFFER_SIZE_BYTES;
+static constexpr uint32_t CHANNEL_0_TX_BYTES = SPI_CHANNEL_0_TX_BUFFER_SIZE_BYTES;
+
+static constexpr uint32_t REGISTER_MAP_TEST_CYCLES_PER_READ = 37U;
+
+/**
+ * @brief One DUT transaction captured from a logic analyser on a real sensor bus.
+ *
+ * @details
+ *     mosi holds every byte the DUT clocked out while NSS was low: the command
+ *     followed by dummy bytes for reads or payload bytes for writes.
+ */
+struct CapturedSPITransaction
+{
+    std::vector<uint8_t> mosi;
+    bool                 is_read;
+    uint8_t              address;
+};
+
 /**-----------------------------------------------------------------------------
  *  Test Doubles / Mocks
  *------------------------------------------------------------------------------
@@ -111,10 +134,16 @@ class MockHWSPI
 
     MOCK_METHOD( void, NVICDisableIRQ, ( IRQn_Type irqn ), () );
     MOCK_METHOD( void, NVICEnableIRQ, ( IRQn_Type irqn ), () );
+    MOCK_METHOD( void, NVICSetPriority, ( IRQn_Type irqn, uint32_t priority ), () );
 
     MOCK_METHOD( void, TimerConfigure, ( Timer_T timer, uint32_t psc, uint32_t arr ), () );
     MOCK_METHOD( void, TimerStart, ( Timer_T timer ), () );
     MOCK_METHOD( void, TimerStop, ( Timer_T timer ), () );
+    MOCK_METHOD( uint32_t, TimerGetCycleCount, (), () );
+
+    MOCK_METHOD( void, SPIEnableITRXNE, ( SPI_TypeDef * spi ), () );
+    MOCK_METHOD( void, SPIDisableITRXNE, ( SPI_TypeDef * spi ), () );
+    MOCK_METHOD( void, SPITransmitData8, ( SPI_TypeDef * spi, uint8_t data ), () );
 };
 
 static MockHWSPI* g_mock = nullptr;
@@ -371,6 +400,14 @@ extern "C" void NVIC_EnableIRQ( IRQn_Type IRQn )
     }
 }
 
+extern "C" void NVIC_SetPriority( IRQn_Type IRQn, uint32_t priority )
+{
+    if ( g_mock )
+    {
+        g_mock->NVICSetPriority( IRQn, priority );
+    }
+}
+
 extern "C" void HW_TIMER_Configure_Timer( Timer_T timer, uint32_t psc, uint32_t arr )
 {
     if ( g_mock )
@@ -395,6 +432,39 @@ extern "C" void HW_TIMER_Stop_Timer( Timer_T timer )
     }
 }
 
+extern "C" void HW_TIMER_Start_Cycle_Counter( void )
+{
+}
+
+extern "C" uint32_t HW_TIMER_Get_Cycle_Count( void )
+{
+    return g_mock ? g_mock->TimerGetCycleCount() : 0U;
+}
+
+extern "C" void LL_SPI_EnableIT_RXNE( SPI_TypeDef* SPIx )
+{
+    if ( g_mock )
+    {
+        g_mock->SPIEnableITRXNE( SPIx );
+    }
+}
+
+extern "C" void LL_SPI_DisableIT_RXNE( SPI_TypeDef* SPIx )
+{
+    if ( g_mock )
+    {
+        g_mock->SPIDisableITRXNE( SPIx );
+    }
+}
+
+extern "C" void LL_SPI_TransmitData8( SPI_TypeDef* SPIx, uint8_t TxData )
+{
+    if ( g_mock )
+    {
+        g_mock->SPITransmitData8( SPIx, TxData );
+    }
+}
+
 /**-----------------------------------------------------------------------------
  *  Test Fixture
  *------------------------------------------------------------------------------
@@ -440,6 +510,7 @@ class HWSpiSlaveTxTest : public ::testing::Test
                                  IRQn_Type tx_irqn, Timer_T timer )
     {
         memset( state, 0, sizeof( *state ) );
+        HW_SPI_Bind_Channel_Storage( state, logical );
         state->config                    = config;
         state->logical_peripheral        = logical;
         state->nss_pin                   = config.nss_pin;
@@ -512,6 +583,128 @@ class HWSpiSlaveTxTest : public ::testing::Test
         EXPECT_CALL( mock, SPIEnableDMAReqTX( Eq( SPI_CHANNEL_0_INSTANCE ) ) );
     }
 
+    /**
+     * @brief Put channel 0 into started register-map slave mode.
+     *
+     * @details
+     *     The RX DMA remaining count is served from rx_dma_remaining so tests
+     *     can advance the simulated ring as the DUT clocks bytes, and the cycle
+     *     counter advances by REGISTER_MAP_TEST_CYCLES_PER_READ on every read.
+     */
+    SPIPeripheralState_T* ConfigureRegisterMapSlave( uint8_t command_bytes, uint8_t read_flag_mask,
+                                                     uint8_t address_mask )
+    {
+        SPIPeripheralState_T* state  = HW_SPI_STATE( SPI_CHANNEL_0 );
+        HWSPIConfig_T         config = MakeSlaveConfig();
+
+        config.rx_nss_framing              = true;
+        config.register_map.enabled        = true;
+        config.register_map.command_bytes  = command_bytes;
+        config.register_map.read_flag_mask = read_flag_mask;
+        config.register_map.address_mask   = address_mask;
+
+        InitialiseState( state, SPI_CHANNEL_0, config, SPI_CHANNEL_0_RX_DMA,
+                         SPI_CHANNEL_0_RX_DMA_STREAM, SPI_CHANNEL_0_TX_DMA,
+                         SPI_CHANNEL_0_TX_DMA_STREAM, SPI_CHANNEL_0_INSTANCE,
+                         SPI_CHANNEL_0_TX_DMA_IRQN, SPI_CHANNEL_0_TIMER );
+        state->is_started                  = true;
+        state->rx_nss_framing              = true;
+        state->register_map_enabled        = true;
+        state->register_map_command_bytes  = command_bytes;
+        state->register_map_read_flag_mask = read_flag_mask;
+        state->register_map_address_mask   = address_mask;
+        state->spi_irqn                    = SPI_CHANNEL_0_IRQN;
+        HW_SPI_RX_Reset_Transactions( state );
+        HW_SPI_Register_Map_Reset( state );
+
+        rx_dma_remaining = CHANNEL_0_RX_BYTES;
+        cycle_count      = 0U;
+        ExpectRegisterMapBackgroundReads();
+
+        return state;
+    }
+
+    /**
+     * @brief Allow the RX DMA counter and cycle counter reads the ISRs make.
+     *
+     * @details
+     *     Re-arm after Mock::VerifyAndClearExpectations() between phases.
+     */
+    void ExpectRegisterMapBackgroundReads()
+    {
+        EXPECT_CALL( mock, DMAGetDataLength( Eq( SPI_CHANNEL_0_RX_DMA ), _ ) )
+            .Times( AnyNumber() )
+            .WillRepeatedly( Invoke( [this]( void*, uint32_t ) { return rx_dma_remaining; } ) );
+        EXPECT_CALL( mock, TimerGetCycleCount() )
+            .Times( AnyNumber() )
+            .WillRepeatedly( Invoke( [this]() {
+                cycle_count += REGISTER_MAP_TEST_CYCLES_PER_READ;
+                return cycle_count;
+            } ) );
+    }
+
+    /**
+     * @brief Drive one register-map NSS transaction through both EXTI edges and the SPI ISR.
+     *
+     * @details
+     *     Sets strict expectations for the command ISR (direct DR write plus
+     *     burst DMA for reads) and for the burst stop at NSS deassert.
+     */
+    void ReplayTransaction( SPIPeripheralState_T* state, const std::vector<uint8_t>& mosi,
+                            uint32_t command_bytes, bool is_read, uint8_t address,
+                            uint32_t timestamp )
+    {
+        const uint8_t* map = state->register_map[state->register_map_active];
+
+        EXPECT_CALL( mock, SPIEnableITRXNE( Eq( SPI_CHANNEL_0_INSTANCE ) ) );
+        HW_SPI_RX_NSS_Edge_From_ISR( SPI_CHANNEL_0, state, false, timestamp );
+
+        // Command bytes land in the RX ring; RXNE brings in the SPI ISR.
+        ReceiveBytes( state, mosi.data(), command_bytes );
+        EXPECT_CALL( mock, SPIDisableITRXNE( Eq( SPI_CHANNEL_0_INSTANCE ) ) );
+        if ( is_read )
+        {
+            EXPECT_CALL( mock,
+                         SPITransmitData8( Eq( SPI_CHANNEL_0_INSTANCE ), Eq( map[address] ) ) );
+            ExpectChannel0DmaProgram( &map[address + 1U],
+                                      HW_SPI_REGISTER_MAP_SIZE_BYTES - address - 1U );
+        }
+        SPI_CHANNEL_0_IRQ();
+        testing::Mock::VerifyAndClearExpectations( &mock );
+        ExpectRegisterMapBackgroundReads();
+
+        // Remaining bytes are clocked, then NSS release stops any burst.
+        ReceiveBytes( state, mosi.data() + command_bytes,
+                      static_cast<uint32_t>( mosi.size() - command_bytes ) );
+        EXPECT_CALL( mock, SPIDisableITRXNE( Eq( SPI_CHANNEL_0_INSTANCE ) ) );
+        if ( is_read )
+        {
+            EXPECT_CALL( mock, SPIDisableDMAReqTX( Eq( SPI_CHANNEL_0_INSTANCE ) ) );
+            EXPECT_CALL( mock, DMADisableStream( Eq( SPI_CHANNEL_0_TX_DMA ),
+                                                 Eq( SPI_CHANNEL_0_TX_DMA_STREAM ) ) );
+        }
+        HW_SPI_RX_NSS_Edge_From_ISR( SPI_CHANNEL_0, state, true, timestamp + 500U );
+        testing::Mock::VerifyAndClearExpectations( &mock );
+        ExpectRegisterMapBackgroundReads();
+    }
+
+    /**
+     * @brief Simulate the DUT clocking bytes into the channel 0 RX DMA ring.
+     */
+    void ReceiveBytes( SPIPeripheralState_T* state, const uint8_t* data, uint32_t size_bytes )
+    {
+        for ( uint32_t i = 0U; i < size_bytes; i++ )
+        {
+            uint32_t write_index = HW_SPI_RX_Get_DMA_Write_Index_Fast( SPI_CHANNEL_0, state );
+            state->rx_buffer[write_index] = data[i];
+            rx_dma_remaining =
+                ( rx_dma_remaining == 1U ) ? CHANNEL_0_RX_BYTES : rx_dma_remaining - 1U;
+        }
+    }
+
+    uint32_t rx_dma_remaining = CHANNEL_0_RX_BYTES;
+    uint32_t cycle_count      = 0U;
+
     void ExpectChannel1DmaProgram( const uint8_t* expected_ptr, uint32_t expected_elements )
     {
         EXPECT_CALL( mock, SPIDisableDMAReqTX( Eq( SPI_CHANNEL_1_INSTANCE ) ) );
@@ -565,14 +758,14 @@ TEST_F( HWSpiSlaveTxTest, LoadTxBuffer_SlaveWrapsStreamAcrossEndOfRing )
                      SPI_CHANNEL_0_TX_DMA_STREAM, SPI_CHANNEL_0_INSTANCE, SPI_CHANNEL_0_TX_DMA_IRQN,
                      SPI_CHANNEL_0_TIMER );
     const uint8_t data[6]                            = { 1U, 2U, 3U, 4U, 5U, 6U };
-    HW_SPI_STATE( SPI_CHANNEL_0 )->tx_write_position = TX_BUFFER_SIZE_BYTES - 2U;
+    HW_SPI_STATE( SPI_CHANNEL_0 )->tx_write_position = CHANNEL_0_TX_BYTES - 2U;
 
     EXPECT_CALL( mock, NVICDisableIRQ( SPI_CHANNEL_0_TX_DMA_IRQN ) );
     EXPECT_CALL( mock, NVICEnableIRQ( SPI_CHANNEL_0_TX_DMA_IRQN ) );
 
     EXPECT_TRUE( HW_SPI_Load_Tx_Buffer( SPI_CHANNEL_0, data, sizeof( data ) ) );
-    EXPECT_EQ( HW_SPI_STATE( SPI_CHANNEL_0 )->tx_buffer[TX_BUFFER_SIZE_BYTES - 2U], 1U );
-    EXPECT_EQ( HW_SPI_STATE( SPI_CHANNEL_0 )->tx_buffer[TX_BUFFER_SIZE_BYTES - 1U], 2U );
+    EXPECT_EQ( HW_SPI_STATE( SPI_CHANNEL_0 )->tx_buffer[CHANNEL_0_TX_BYTES - 2U], 1U );
+    EXPECT_EQ( HW_SPI_STATE( SPI_CHANNEL_0 )->tx_buffer[CHANNEL_0_TX_BYTES - 1U], 2U );
     EXPECT_EQ( HW_SPI_STATE( SPI_CHANNEL_0 )->tx_buffer[0], 3U );
     EXPECT_EQ( HW_SPI_STATE( SPI_CHANNEL_0 )->tx_buffer[1], 4U );
     EXPECT_EQ( HW_SPI_STATE( SPI_CHANNEL_0 )->tx_buffer[2], 5U );
@@ -603,13 +796,13 @@ TEST_F( HWSpiSlaveTxTest, TxTrigger_SlaveStartsOneContiguousSpanOnly )
                      SPI_CHANNEL_0_RX_DMA, SPI_CHANNEL_0_RX_DMA_STREAM, SPI_CHANNEL_0_TX_DMA,
                      SPI_CHANNEL_0_TX_DMA_STREAM, SPI_CHANNEL_0_INSTANCE, SPI_CHANNEL_0_TX_DMA_IRQN,
                      SPI_CHANNEL_0_TIMER );
-    HW_SPI_STATE( SPI_CHANNEL_0 )->tx_read_position     = TX_BUFFER_SIZE_BYTES - 3U;
+    HW_SPI_STATE( SPI_CHANNEL_0 )->tx_read_position     = CHANNEL_0_TX_BYTES - 3U;
     HW_SPI_STATE( SPI_CHANNEL_0 )->tx_write_position    = 2U;
     HW_SPI_STATE( SPI_CHANNEL_0 )->tx_num_bytes_pending = 5U;
 
     InSequence seq;
     EXPECT_CALL( mock, NVICDisableIRQ( SPI_CHANNEL_0_TX_DMA_IRQN ) );
-    ExpectChannel0DmaProgram( &HW_SPI_STATE( SPI_CHANNEL_0 )->tx_buffer[TX_BUFFER_SIZE_BYTES - 3U],
+    ExpectChannel0DmaProgram( &HW_SPI_STATE( SPI_CHANNEL_0 )->tx_buffer[CHANNEL_0_TX_BYTES - 3U],
                               3U );
     EXPECT_CALL( mock, NVICEnableIRQ( SPI_CHANNEL_0_TX_DMA_IRQN ) );
 
@@ -741,7 +934,7 @@ TEST_F( HWSpiSlaveTxTest, LoadTxBuffer_SlaveAllowsExactFillThenRejectsOverflow )
                      SPI_CHANNEL_0_TX_DMA_STREAM, SPI_CHANNEL_0_INSTANCE, SPI_CHANNEL_0_TX_DMA_IRQN,
                      SPI_CHANNEL_0_TIMER );
 
-    uint8_t full_buffer[TX_BUFFER_SIZE_BYTES];
+    uint8_t full_buffer[CHANNEL_0_TX_BYTES];
     memset( full_buffer, 0x5AU, sizeof( full_buffer ) );
     const uint8_t extra = 0xC3U;
 
@@ -751,7 +944,7 @@ TEST_F( HWSpiSlaveTxTest, LoadTxBuffer_SlaveAllowsExactFillThenRejectsOverflow )
     EXPECT_TRUE( HW_SPI_Load_Tx_Buffer( SPI_CHANNEL_0, full_buffer, sizeof( full_buffer ) ) );
     EXPECT_FALSE( HW_SPI_Load_Tx_Buffer( SPI_CHANNEL_0, &extra, sizeof( extra ) ) );
 
-    EXPECT_EQ( HW_SPI_STATE( SPI_CHANNEL_0 )->tx_num_bytes_pending, TX_BUFFER_SIZE_BYTES );
+    EXPECT_EQ( HW_SPI_STATE( SPI_CHANNEL_0 )->tx_num_bytes_pending, CHANNEL_0_TX_BYTES );
     EXPECT_EQ( HW_SPI_STATE( SPI_CHANNEL_0 )->tx_write_position, 0U );
 }
 
@@ -766,16 +959,16 @@ TEST_F( HWSpiSlaveTxTest, TxTrigger_SlaveNearEndSendsTailSpanAndLeavesWrappedHea
                      SPI_CHANNEL_0_TX_DMA_STREAM, SPI_CHANNEL_0_INSTANCE, SPI_CHANNEL_0_TX_DMA_IRQN,
                      SPI_CHANNEL_0_TIMER );
 
-    HW_SPI_STATE( SPI_CHANNEL_0 )->tx_read_position                     = TX_BUFFER_SIZE_BYTES - 3U;
+    HW_SPI_STATE( SPI_CHANNEL_0 )->tx_read_position                     = CHANNEL_0_TX_BYTES - 3U;
     HW_SPI_STATE( SPI_CHANNEL_0 )->tx_write_position                    = 5U;
     HW_SPI_STATE( SPI_CHANNEL_0 )->tx_num_bytes_pending                 = 8U;
-    HW_SPI_STATE( SPI_CHANNEL_0 )->tx_buffer[TX_BUFFER_SIZE_BYTES - 3U] = 0x10U;
-    HW_SPI_STATE( SPI_CHANNEL_0 )->tx_buffer[TX_BUFFER_SIZE_BYTES - 2U] = 0x11U;
-    HW_SPI_STATE( SPI_CHANNEL_0 )->tx_buffer[TX_BUFFER_SIZE_BYTES - 1U] = 0x12U;
+    HW_SPI_STATE( SPI_CHANNEL_0 )->tx_buffer[CHANNEL_0_TX_BYTES - 3U] = 0x10U;
+    HW_SPI_STATE( SPI_CHANNEL_0 )->tx_buffer[CHANNEL_0_TX_BYTES - 2U] = 0x11U;
+    HW_SPI_STATE( SPI_CHANNEL_0 )->tx_buffer[CHANNEL_0_TX_BYTES - 1U] = 0x12U;
 
     InSequence seq;
     EXPECT_CALL( mock, NVICDisableIRQ( SPI_CHANNEL_0_TX_DMA_IRQN ) );
-    ExpectChannel0DmaProgram( &HW_SPI_STATE( SPI_CHANNEL_0 )->tx_buffer[TX_BUFFER_SIZE_BYTES - 3U],
+    ExpectChannel0DmaProgram( &HW_SPI_STATE( SPI_CHANNEL_0 )->tx_buffer[CHANNEL_0_TX_BYTES - 3U],
                               3U );
     EXPECT_CALL( mock, NVICEnableIRQ( SPI_CHANNEL_0_TX_DMA_IRQN ) );
 
@@ -806,3 +999,189 @@ TEST_F( HWSpiSlaveTxTest, TxIsComplete_SlaveRequiresBsyClearEvenWithoutMasterSta
     EXPECT_CALL( mock, SPIIsBusy( Eq( SPI_CHANNEL_0_INSTANCE ) ) ).WillOnce( Return( 0U ) );
     EXPECT_TRUE( HW_SPI_Tx_Is_Complete( SPI_CHANNEL_0 ) );
 }
+
+/**
+ * @brief Replay a captured IMU polling sequence against the register-map emulator.
+ *
+ * The capture is a typical 6-axis IMU bring-up and poll loop: WHO_AM_I, a
+ * CTRL register write, then a 6-byte accelerometer burst. Bit 7 of the command
+ * marks a read and the low 7 bits select the register.
+ */
+TEST_F( HWSpiSlaveTxTest, RegisterMap_ReplayCapturedImuTransactionsAnswersReadsFromMap )
+{
+    const std::vector<CapturedSPITransaction> capture = {
+        { { 0x8FU, 0x00U }, true, 0x0FU },
+        { { 0x10U, 0x60U }, false, 0x10U },
+        { { 0xA8U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U }, true, 0x28U },
+        { { 0x8FU, 0x00U }, true, 0x0FU },
+    };
+    const uint8_t who_am_i    = 0x6AU;
+    const uint8_t accel[6]    = { 0x11U, 0x22U, 0x33U, 0x44U, 0x55U, 0x66U };
+    uint32_t      timestamp   = 0U;
+    uint32_t      read_count  = 0U;
+    uint32_t      write_count = 0U;
+
+    SPIPeripheralState_T* state = ConfigureRegisterMapSlave( 1U, 0x80U, 0x7FU );
+
+    EXPECT_CALL( mock, NVICDisableIRQ( SPI_CHANNEL_0_IRQN ) );
+    EXPECT_CALL( mock, NVICEnableIRQ( SPI_CHANNEL_0_IRQN ) );
+    ASSERT_TRUE( HW_SPI_Register_Map_Write( SPI_CHANNEL_0, 0x0FU, &who_am_i, 1U ) );
+    ASSERT_TRUE( HW_SPI_Register_Map_Write( SPI_CHANNEL_0, 0x28U, accel, sizeof( accel ) ) );
+    ASSERT_TRUE( HW_SPI_Register_Map_Commit( SPI_CHANNEL_0 ) );
+
+    for ( const CapturedSPITransaction& transaction : capture )
+    {
+        ReplayTransaction( state, transaction.mosi, 1U, transaction.is_read, transaction.address,
+                           timestamp );
+        timestamp += 1000U;
+        if ( transaction.is_read )
+        {
+            read_count++;
+        }
+        else
+        {
+            write_count++;
+        }
+
+        // The full transaction is still queued for the plant model.
+        HWSPIRxTransaction_T captured;
+        ASSERT_TRUE( HW_SPI_Rx_Peek_Transaction( SPI_CHANNEL_0, &captured ) );
+        ASSERT_EQ( captured.data.total_length_bytes, transaction.mosi.size() );
+        EXPECT_EQ( 0, memcmp( captured.data.first_span.data, transaction.mosi.data(),
+                              transaction.mosi.size() ) );
+        HW_SPI_Rx_Consume_Transaction( SPI_CHANNEL_0 );
+        EXPECT_FALSE( state->register_map_burst_active );
+    }
+
+    HWSPIRegisterMapStats_T stats;
+    ASSERT_TRUE( HW_SPI_Register_Map_Get_Stats( SPI_CHANNEL_0, &stats ) );
+    EXPECT_EQ( stats.read_commands, read_count );
+    EXPECT_EQ( stats.write_commands, write_count );
+    EXPECT_EQ( stats.late_responses, 0U );
+    EXPECT_EQ( stats.last_turnaround_cycles, REGISTER_MAP_TEST_CYCLES_PER_READ );
+    EXPECT_EQ( stats.max_turnaround_cycles, REGISTER_MAP_TEST_CYCLES_PER_READ );
+}
+
+TEST_F( HWSpiSlaveTxTest, RegisterMap_TwoByteCommandWaitsForAddressByte )
+{
+    const uint8_t         value = 0xC3U;
+    SPIPeripheralState_T* state = ConfigureRegisterMapSlave( 2U, 0x03U, 0xFFU );
+
+    state->register_map[0][0x42U] = value;
+
+    EXPECT_CALL( mock, SPIEnableITRXNE( Eq( SPI_CHANNEL_0_INSTANCE ) ) );
+    HW_SPI_RX_NSS_Edge_From_ISR( SPI_CHANNEL_0, state, false, 0U );
+
+    // Only the opcode has landed: the ISR must leave RXNE armed and do nothing.
+    const uint8_t opcode = 0x03U;
+    ReceiveBytes( state, &opcode, 1U );
+    SPI_CHANNEL_0_IRQ();
+    testing::Mock::VerifyAndClearExpectations( &mock );
+    ExpectRegisterMapBackgroundReads();
+
+    const uint8_t address = 0x42U;
+    ReceiveBytes( state, &address, 1U );
+    EXPECT_CALL( mock, SPIDisableITRXNE( Eq( SPI_CHANNEL_0_INSTANCE ) ) );
+    EXPECT_CALL( mock, SPITransmitData8( Eq( SPI_CHANNEL_0_INSTANCE ), Eq( value ) ) );
+    ExpectChannel0DmaProgram( &state->register_map[0][0x43U],
+                              HW_SPI_REGISTER_MAP_SIZE_BYTES - 0x43U );
+    SPI_CHANNEL_0_IRQ();
+
+    EXPECT_TRUE( state->register_map_burst_active );
+    EXPECT_EQ( state->register_map_stats.read_commands, 1U );
+}
+
+TEST_F( HWSpiSlaveTxTest, RegisterMap_CountsLateResponseWhenDutClockedPastCommand )
+{
+    SPIPeripheralState_T* state   = ConfigureRegisterMapSlave( 1U, 0x80U, 0x7FU );
+    const uint8_t         mosi[2] = { 0x8FU, 0x00U };
+
+    EXPECT_CALL( mock, SPIEnableITRXNE( Eq( SPI_CHANNEL_0_INSTANCE ) ) );
+    HW_SPI_RX_NSS_Edge_From_ISR( SPI_CHANNEL_0, state, false, 0U );
+
+    // The ISR ran only after the first response frame had already been clocked.
+    ReceiveBytes( state, mosi, sizeof( mosi ) );
+    EXPECT_CALL( mock, SPIDisableITRXNE( Eq( SPI_CHANNEL_0_INSTANCE ) ) );
+    EXPECT_CALL( mock, SPITransmitData8( Eq( SPI_CHANNEL_0_INSTANCE ), Eq( 0x00U ) ) );
+    ExpectChannel0DmaProgram( &state->register_map[0][0x10U],
+                              HW_SPI_REGISTER_MAP_SIZE_BYTES - 0x10U );
+    SPI_CHANNEL_0_IRQ();
+
+    EXPECT_EQ( state->register_map_stats.late_responses, 1U );
+}
+
+TEST_F( HWSpiSlaveTxTest, RegisterMap_LastAddressIsAnsweredWithoutBurstDma )
+{
+    SPIPeripheralState_T* state   = ConfigureRegisterMapSlave( 1U, 0x00U, 0xFFU );
+    const uint8_t         command = 0xFFU;
+
+    state->register_map[0][0xFFU] = 0x5AU;
+
+    EXPECT_CALL( mock, SPIEnableITRXNE( Eq( SPI_CHANNEL_0_INSTANCE ) ) );
+    HW_SPI_RX_NSS_Edge_From_ISR( SPI_CHANNEL_0, state, false, 0U );
+
+    ReceiveBytes( state, &command, 1U );
+    EXPECT_CALL( mock, SPIDisableITRXNE( Eq( SPI_CHANNEL_0_INSTANCE ) ) );
+    EXPECT_CALL( mock, SPITransmitData8( Eq( SPI_CHANNEL_0_INSTANCE ), Eq( 0x5AU ) ) );
+    SPI_CHANNEL_0_IRQ();
+
+    EXPECT_FALSE( state->register_map_burst_active );
+}
+
+TEST_F( HWSpiSlaveTxTest, RegisterMap_WriteIsStagedUntilCommit )
+{
+    SPIPeripheralState_T* state = ConfigureRegisterMapSlave( 1U, 0x80U, 0x7FU );
+    const uint8_t         first = 0x01U;
+    const uint8_t         next  = 0x02U;
+
+    EXPECT_CALL( mock, NVICDisableIRQ( SPI_CHANNEL_0_IRQN ) ).Times( 2 );
+    EXPECT_CALL( mock, NVICEnableIRQ( SPI_CHANNEL_0_IRQN ) ).Times( 2 );
+
+    ASSERT_TRUE( HW_SPI_Register_Map_Write( SPI_CHANNEL_0, 0x20U, &first, 1U ) );
+    EXPECT_EQ( state->register_map[state->register_map_active][0x20U], 0x00U );
+    ASSERT_TRUE( HW_SPI_Register_Map_Commit( SPI_CHANNEL_0 ) );
+    EXPECT_EQ( state->register_map[state->register_map_active][0x20U], first );
+
+    // The new staging copy starts from the published values.
+    EXPECT_EQ( state->register_map[state->register_map_active ^ 1U][0x20U], first );
+
+    ASSERT_TRUE( HW_SPI_Register_Map_Write( SPI_CHANNEL_0, 0x21U, &next, 1U ) );
+    ASSERT_TRUE( HW_SPI_Register_Map_Commit( SPI_CHANNEL_0 ) );
+    EXPECT_EQ( state->register_map[state->register_map_active][0x20U], first );
+    EXPECT_EQ( state->register_map[state->register_map_active][0x21U], next );
+}
+
+TEST_F( HWSpiSlaveTxTest, RegisterMap_CommitIsRefusedDuringReadBurst )
+{
+    SPIPeripheralState_T* state = ConfigureRegisterMapSlave( 1U, 0x80U, 0x7FU );
+
+    state->register_map_burst_active = true;
+
+    EXPECT_CALL( mock, NVICDisableIRQ( SPI_CHANNEL_0_IRQN ) );
+    EXPECT_CALL( mock, NVICEnableIRQ( SPI_CHANNEL_0_IRQN ) );
+    EXPECT_FALSE( HW_SPI_Register_Map_Commit( SPI_CHANNEL_0 ) );
+
+    EXPECT_EQ( state->register_map_active, 0U );
+    EXPECT_EQ( state->register_map_stats.commit_retries, 1U );
+}
+
+TEST_F( HWSpiSlaveTxTest, RegisterMap_WriteRejectsRangePastEndOfMap )
+{
+    const uint8_t data[2] = { 0U, 0U };
+
+    ConfigureRegisterMapSlave( 1U, 0x80U, 0x7FU );
+
+    EXPECT_FALSE( HW_SPI_Register_Map_Write( SPI_CHANNEL_0, 0xFFU, data, sizeof( data ) ) );
+    EXPECT_FALSE( HW_SPI_Register_Map_Write( SPI_CHANNEL_1, 0x00U, data, sizeof( data ) ) );
+}
+
+TEST_F( HWSpiSlaveTxTest, LoadTxBuffer_RejectsStreamOnRegisterMapChannel )
+{
+    const uint8_t data[2] = { 0xAAU, 0xBBU };
+
+    ConfigureRegisterMapSlave( 1U, 0x80U, 0x7FU );
+
+    EXPECT_CALL( mock, NVICDisableIRQ( SPI_CHANNEL_0_TX_DMA_IRQN ) );
+    EXPECT_CALL( mock, NVICEnableIRQ( SPI_CHANNEL_0_TX_DMA_IRQN ) );
+    EXPECT_FALSE( HW_SPI_Load_Tx_Buffer( SPI_CHANNEL_0, data, sizeof( data ) ) );
+}
@@ -28,6 +28,8 @@
 #include <stdbool.h>
 #include "hw_timer.h"
 #include "hw_spi.h"
+#include "hw_uart_dut.h"
+#include "hw_can.h"
 #include <stdint.h>
 
 /**-----------------------------------------------------------------------------
@@ -68,6 +70,44 @@
 #define PWM_CAPTURE_TIMER_CH2_PRIMARY_FLAG TIM_FLAG_CC2
 #define PWM_CAPTURE_TIMER_CH2_SECONDARY_FLAG TIM_FLAG_CC1
 
+/* UART RX silence timeout Timer Defines.
+ * TIM9 and TIM10 are not part of the CubeMX project, so they are brought up here
+ * with LL. Their vectors are shared with TIM1 break and update, which are unused. */
+#define UART_CHANNEL_1_TIMER_INSTANCE TIM9
+#define UART_CHANNEL_1_TIMER_CLOCK LL_APB2_GRP1_PERIPH_TIM9
+#define UART_CHANNEL_1_TIMER_IRQ TIM1_BRK_TIM9_IRQn
+#define UART_CHANNEL_1_TIMER_IRQ_HANDLER TIM1_BRK_TIM9_IRQHandler
+
+#define UART_CHANNEL_2_TIMER_INSTANCE TIM10
+#define UART_CHANNEL_2_TIMER_CLOCK LL_APB2_GRP1_PERIPH_TIM10
+#define UART_CHANNEL_2_TIMER_IRQ TIM1_UP_TIM10_IRQn
+#define UART_CHANNEL_2_TIMER_IRQ_HANDLER TIM1_UP_TIM10_IRQHandler
+
+/* Matches the DUT UART USART and RX DMA priority so RX timeout handling never preempts them. */
+#define UART_TIMER_IRQ_PRIORITY 5U
+
+/* CAN cyclic schedule tick. TIM13 is not part of the CubeMX project either and
+ * its vector is shared with TIM8 update, which is unused. */
+#define CAN_CYCLIC_TIMER_INSTANCE TIM13
+#define CAN_CYCLIC_TIMER_CLOCK LL_APB1_GRP1_PERIPH_TIM13
+#define CAN_CYCLIC_TIMER_IRQ TIM8_UP_TIM13_IRQn
+#define CAN_CYCLIC_TIMER_IRQ_HANDLER TIM8_UP_TIM13_IRQHandler
+
+/* Matches the CAN TX priority so a tick never preempts a TX completion on the mailbox it loads. */
+#define CAN_CYCLIC_TIMER_IRQ_PRIORITY 5U
+
+/* CAN log replay one-shot. TIM1 is generated by CubeMX but otherwise unused; it is
+ * reconfigured here with LL. Its update vector belongs to TIM10, so the shot is
+ * taken from compare channel 1, whose vector TIM1 has to itself. TIM14 is the
+ * HAL tick and is left alone. */
+#define CAN_REPLAY_TIMER_INSTANCE TIM1
+#define CAN_REPLAY_TIMER_CLOCK LL_APB2_GRP1_PERIPH_TIM1
+#define CAN_REPLAY_TIMER_IRQ TIM1_CC_IRQn
+#define CAN_REPLAY_TIMER_IRQ_HANDLER TIM1_CC_IRQHandler
+
+/* Same as the cyclic tick, for the same reason. */
+#define CAN_REPLAY_TIMER_IRQ_PRIORITY 5U
+
 /**-----------------------------------------------------------------------------
  *  Typedefs / Enums / Structures
  *------------------------------------------------------------------------------
@@ -83,6 +123,13 @@
  *------------------------------------------------------------------------------
  */
 
+#ifndef TEST_BUILD
+/* Shared microsecond time base, extended from the DWT cycle counter. */
+static uint32_t time_base_cycles  = 0U;
+static uint32_t time_base_residue = 0U;
+static uint32_t time_base_us      = 0U;
+#endif
+
 /**-----------------------------------------------------------------------------
  *  Private (static) Function Prototypes
  *------------------------------------------------------------------------------
@@ -93,6 +140,103 @@
  *------------------------------------------------------------------------------
  */
 
+#ifndef TEST_BUILD
+/**
+ * @brief Brings up a UART RX timeout timer as a one-shot upcounter.
+ *
+ * @param instance - the TIM9 or TIM10 instance
+ * @param clock - the APB2 clock enable mask for the instance
+ * @param irq - the update interrupt vector for the instance
+ * @param psc - Prescalar
+ * @param arr - AutoReload Register
+ */
+static void HW_TIMER_Configure_Uart_Timer( TIM_TypeDef* instance, uint32_t clock, IRQn_Type irq,
+                                           uint32_t psc, uint32_t arr )
+{
+    LL_APB2_GRP1_EnableClock( clock );
+
+    LL_TIM_DisableIT_UPDATE( instance );
+    LL_TIM_DisableCounter( instance );
+
+    LL_TIM_SetCounterMode( instance, LL_TIM_COUNTERMODE_UP );
+    LL_TIM_SetOnePulseMode( instance, LL_TIM_ONEPULSEMODE_SINGLE );
+    LL_TIM_SetPrescaler( instance, psc );
+    LL_TIM_SetAutoReload( instance, arr );
+
+    // Load the prescaler now rather than at the first overflow
+    LL_TIM_GenerateEvent_UPDATE( instance );
+    // Clear the update flag raised by the forced update to prevent immediate IRQs
+    LL_TIM_ClearFlag_UPDATE( instance );
+
+    NVIC_SetPriority( irq, UART_TIMER_IRQ_PRIORITY );
+    NVIC_EnableIRQ( irq );
+}
+
+/**
+ * @brief Brings up the CAN cyclic tick timer as a free-running upcounter.
+ *
+ * @param psc - Prescalar
+ * @param arr - AutoReload Register
+ */
+static void HW_TIMER_Configure_Can_Cyclic_Timer( uint32_t psc, uint32_t arr )
+{
+    LL_APB1_GRP1_EnableClock( CAN_CYCLIC_TIMER_CLOCK );
+
+    LL_TIM_DisableIT_UPDATE( CAN_CYCLIC_TIMER_INSTANCE );
+    LL_TIM_DisableCounter( CAN_CYCLIC_TIMER_INSTANCE );
+
+    LL_TIM_SetCounterMode( CAN_CYCLIC_TIMER_INSTANCE, LL_TIM_COUNTERMODE_UP );
+    LL_TIM_SetOnePulseMode( CAN_CYCLIC_TIMER_INSTANCE, LL_TIM_ONEPULSEMODE_REPETITIVE );
+    LL_TIM_SetPrescaler( CAN_CYCLIC_TIMER_INSTANCE, psc );
+    LL_TIM_SetAutoReload( CAN_CYCLIC_TIMER_INSTANCE, arr );
+
+    // Load the prescaler now rather than at the first overflow
+    LL_TIM_GenerateEvent_UPDATE( CAN_CYCLIC_TIMER_INSTANCE );
+    // Clear the update flag raised by the forced update to prevent immediate IRQs
+    LL_TIM_ClearFlag_UPDATE( CAN_CYCLIC_TIMER_INSTANCE );
+
+    NVIC_SetPriority( CAN_CYCLIC_TIMER_IRQ, CAN_CYCLIC_TIMER_IRQ_PRIORITY );
+    NVIC_EnableIRQ( CAN_CYCLIC_TIMER_IRQ );
+}
+
+/**
+ * @brief Brings up the CAN replay timer as a one-shot upcounter.
+ *
+ * The shot is the channel 1 compare match. The counter reaches a compare value
+ * of arr + 1 when an update would have fired, and the one-pulse update that
+ * follows stops it. At the full 16-bit range the match comes one count early.
+ *
+ * @param psc - Prescalar
+ * @param arr - AutoReload Register
+ */
+static void HW_TIMER_Configure_Can_Replay_Timer( uint32_t psc, uint32_t arr )
+{
+    uint32_t match = arr < 0xFFFFU ? arr + 1U : arr;
+
+    LL_APB2_GRP1_EnableClock( CAN_REPLAY_TIMER_CLOCK );
+
+    LL_TIM_DisableIT_CC1( CAN_REPLAY_TIMER_INSTANCE );
+    LL_TIM_DisableCounter( CAN_REPLAY_TIMER_INSTANCE );
+
+    LL_TIM_SetCounterMode( CAN_REPLAY_TIMER_INSTANCE, LL_TIM_COUNTERMODE_UP );
+    LL_TIM_SetOnePulseMode( CAN_REPLAY_TIMER_INSTANCE, LL_TIM_ONEPULSEMODE_SINGLE );
+    LL_TIM_SetRepetitionCounter( CAN_REPLAY_TIMER_INSTANCE, 0U );
+    LL_TIM_SetPrescaler( CAN_REPLAY_TIMER_INSTANCE, psc );
+    LL_TIM_SetAutoReload( CAN_REPLAY_TIMER_INSTANCE, match );
+    LL_TIM_OC_SetMode( CAN_REPLAY_TIMER_INSTANCE, LL_TIM_CHANNEL_CH1, LL_TIM_OCMODE_FROZEN );
+    LL_TIM_OC_SetCompareCH1( CAN_REPLAY_TIMER_INSTANCE, match );
+
+    // Load the prescaler now rather than at the first overflow
+    LL_TIM_GenerateEvent_UPDATE( CAN_REPLAY_TIMER_INSTANCE );
+    // Clear the flags raised by the forced update to prevent immediate IRQs
+    LL_TIM_ClearFlag_UPDATE( CAN_REPLAY_TIMER_INSTANCE );
+    LL_TIM_ClearFlag_CC1( CAN_REPLAY_TIMER_INSTANCE );
+
+    NVIC_SetPriority( CAN_REPLAY_TIMER_IRQ, CAN_REPLAY_TIMER_IRQ_PRIORITY );
+    NVIC_EnableIRQ( CAN_REPLAY_TIMER_IRQ );
+}
+#endif
+
 /**-----------------------------------------------------------------------------
  *  Public Function Definitions
  *------------------------------------------------------------------------------
@@ -159,6 +303,68 @@ void SPI_DAC_TIMER_IRQ_HANDLER( void )
 #endif
 }
 
+void UART_CHANNEL_1_TIMER_IRQ_HANDLER( void )
+{
+#ifdef TEST_BUILD
+#else
+    if ( LL_TIM_IsActiveFlag_UPDATE( UART_CHANNEL_1_TIMER_INSTANCE )
+         && LL_TIM_IsEnabledIT_UPDATE( UART_CHANNEL_1_TIMER_INSTANCE ) )
+    {
+        LL_TIM_ClearFlag_UPDATE( UART_CHANNEL_1_TIMER_INSTANCE );
+        LL_TIM_DisableIT_UPDATE( UART_CHANNEL_1_TIMER_INSTANCE );
+
+        // Running Process
+        HW_UART_Rx_Timeout_Callback_From_ISR( HW_UART_CHANNEL_1 );
+    }
+#endif
+}
+
+void UART_CHANNEL_2_TIMER_IRQ_HANDLER( void )
+{
+#ifdef TEST_BUILD
+#else
+    if ( LL_TIM_IsActiveFlag_UPDATE( UART_CHANNEL_2_TIMER_INSTANCE )
+         && LL_TIM_IsEnabledIT_UPDATE( UART_CHANNEL_2_TIMER_INSTANCE ) )
+    {
+        LL_TIM_ClearFlag_UPDATE( UART_CHANNEL_2_TIMER_INSTANCE );
+        LL_TIM_DisableIT_UPDATE( UART_CHANNEL_2_TIMER_INSTANCE );
+
+        // Running Process
+        HW_UART_Rx_Timeout_Callback_From_ISR( HW_UART_CHANNEL_2 );
+    }
+#endif
+}
+
+void CAN_CYCLIC_TIMER_IRQ_HANDLER( void )
+{
+#ifdef TEST_BUILD
+#else
+    if ( LL_TIM_IsActiveFlag_UPDATE( CAN_CYCLIC_TIMER_INSTANCE )
+         && LL_TIM_IsEnabledIT_UPDATE( CAN_CYCLIC_TIMER_INSTANCE ) )
+    {
+        LL_TIM_ClearFlag_UPDATE( CAN_CYCLIC_TIMER_INSTANCE );
+
+        // Running Process
+        HW_CAN_Cyclic_Tick_From_ISR();
+    }
+#endif
+}
+
+void CAN_REPLAY_TIMER_IRQ_HANDLER( void )
+{
+#ifdef TEST_BUILD
+#else
+    if ( LL_TIM_IsActiveFlag_CC1( CAN_REPLAY_TIMER_INSTANCE )
+         && LL_TIM_IsEnabledIT_CC1( CAN_REPLAY_TIMER_INSTANCE ) )
+    {
+        LL_TIM_ClearFlag_CC1( CAN_REPLAY_TIMER_INSTANCE );
+
+        // Running Process
+        HW_CAN_Replay_Tick_From_ISR();
+    }
+#endif
+}
+
 void HW_TIMER_Configure_Timer( Timer_T timer, uint32_t psc, uint32_t arr )
 {
 
@@ -252,6 +458,22 @@ void HW_TIMER_Configure_Timer( Timer_T timer, uint32_t psc, uint32_t arr )
 
             __HAL_TIM_SET_COUNTER( &PWM_CAPTURE_TIMER_CH2_HANDLE, 0u );
             break;
+        case UART_CHANNEL_1_TIMER:
+            HW_TIMER_Configure_Uart_Timer( UART_CHANNEL_1_TIMER_INSTANCE,
+                                           UART_CHANNEL_1_TIMER_CLOCK, UART_CHANNEL_1_TIMER_IRQ,
+                                           psc, arr );
+            break;
+        case UART_CHANNEL_2_TIMER:
+            HW_TIMER_Configure_Uart_Timer( UART_CHANNEL_2_TIMER_INSTANCE,
+                                           UART_CHANNEL_2_TIMER_CLOCK, UART_CHANNEL_2_TIMER_IRQ,
+                                           psc, arr );
+            break;
+        case CAN_CYCLIC_TIMER:
+            HW_TIMER_Configure_Can_Cyclic_Timer( psc, arr );
+            break;
+        case CAN_REPLAY_TIMER:
+            HW_TIMER_Configure_Can_Replay_Timer( psc, arr );
+            break;
         default:
             break;
     }
@@ -323,6 +545,36 @@ void HW_TIMER_Start_Timer( Timer_T timer )
             // Enable counter
             LL_TIM_EnableCounter( SPI_DAC_TIMER_INSTANCE );
             break;
+        case UART_CHANNEL_1_TIMER:
+            // Restarting from zero re-arms the full timeout on every line idle
+            LL_TIM_DisableCounter( UART_CHANNEL_1_TIMER_INSTANCE );
+            LL_TIM_SetCounter( UART_CHANNEL_1_TIMER_INSTANCE, 0U );
+            LL_TIM_ClearFlag_UPDATE( UART_CHANNEL_1_TIMER_INSTANCE );
+            LL_TIM_EnableIT_UPDATE( UART_CHANNEL_1_TIMER_INSTANCE );
+            LL_TIM_EnableCounter( UART_CHANNEL_1_TIMER_INSTANCE );
+            break;
+        case UART_CHANNEL_2_TIMER:
+            // Restarting from zero re-arms the full timeout on every line idle
+            LL_TIM_DisableCounter( UART_CHANNEL_2_TIMER_INSTANCE );
+            LL_TIM_SetCounter( UART_CHANNEL_2_TIMER_INSTANCE, 0U );
+            LL_TIM_ClearFlag_UPDATE( UART_CHANNEL_2_TIMER_INSTANCE );
+            LL_TIM_EnableIT_UPDATE( UART_CHANNEL_2_TIMER_INSTANCE );
+            LL_TIM_EnableCounter( UART_CHANNEL_2_TIMER_INSTANCE );
+            break;
+        case CAN_CYCLIC_TIMER:
+            LL_TIM_DisableCounter( CAN_CYCLIC_TIMER_INSTANCE );
+            LL_TIM_SetCounter( CAN_CYCLIC_TIMER_INSTANCE, 0U );
+            LL_TIM_ClearFlag_UPDATE( CAN_CYCLIC_TIMER_INSTANCE );
+            LL_TIM_EnableIT_UPDATE( CAN_CYCLIC_TIMER_INSTANCE );
+            LL_TIM_EnableCounter( CAN_CYCLIC_TIMER_INSTANCE );
+            break;
+        case CAN_REPLAY_TIMER:
+            LL_TIM_DisableCounter( CAN_REPLAY_TIMER_INSTANCE );
+            LL_TIM_SetCounter( CAN_REPLAY_TIMER_INSTANCE, 0U );
+            LL_TIM_ClearFlag_CC1( CAN_REPLAY_TIMER_INSTANCE );
+            LL_TIM_EnableIT_CC1( CAN_REPLAY_TIMER_INSTANCE );
+            LL_TIM_EnableCounter( CAN_REPLAY_TIMER_INSTANCE );
+            break;
         case ANALOGUE_INPUT_TIMER:
             HAL_TIM_Base_Start( &ANALOGUE_INPUT_TIMER_HANDLE );
             break;
@@ -397,6 +649,29 @@ void HW_TIMER_Stop_Timer( Timer_T timer )
             LL_TIM_DisableCounter( SPI_DAC_TIMER_INSTANCE );
             LL_TIM_ClearFlag_UPDATE( SPI_DAC_TIMER_INSTANCE );
             break;
+
+        case UART_CHANNEL_1_TIMER:
+            LL_TIM_DisableIT_UPDATE( UART_CHANNEL_1_TIMER_INSTANCE );
+            LL_TIM_DisableCounter( UART_CHANNEL_1_TIMER_INSTANCE );
+            LL_TIM_ClearFlag_UPDATE( UART_CHANNEL_1_TIMER_INSTANCE );
+            break;
+
+        case UART_CHANNEL_2_TIMER:
+            LL_TIM_DisableIT_UPDATE( UART_CHANNEL_2_TIMER_INSTANCE );
+            LL_TIM_DisableCounter( UART_CHANNEL_2_TIMER_INSTANCE );
+            LL_TIM_ClearFlag_UPDATE( UART_CHANNEL_2_TIMER_INSTANCE );
+            break;
+
+        case CAN_CYCLIC_TIMER:
+            LL_TIM_DisableIT_UPDATE( CAN_CYCLIC_TIMER_INSTANCE );
+            LL_TIM_DisableCounter( CAN_CYCLIC_TIMER_INSTANCE );
+            LL_TIM_ClearFlag_UPDATE( CAN_CYCLIC_TIMER_INSTANCE );
+            break;
+        case CAN_REPLAY_TIMER:
+            LL_TIM_DisableIT_CC1( CAN_REPLAY_TIMER_INSTANCE );
+            LL_TIM_DisableCounter( CAN_REPLAY_TIMER_INSTANCE );
+            LL_TIM_ClearFlag_CC1( CAN_REPLAY_TIMER_INSTANCE );
+            break;
         case PWM_CAPTURE_TIMER_CH1:
             // Stop input capture on both channels for PWM capture
             HAL_TIM_IC_Stop( &PWM_CAPTURE_TIMER_CH1_HANDLE, PWM_CAPTURE_TIMER_CH1_PRIMARY_CHANNEL );
@@ -438,8 +713,9 @@ uint32_t HW_TIMER_Get_Clock_Hz( Timer_T timer )
     switch ( timer )
     {
         /*
-         * TIM2 and TIM5 are on APB1 (STM32F446).
+         * TIM2, TIM5 and TIM13 are on APB1 (STM32F446).
          */
+        case CAN_CYCLIC_TIMER:
         case PWM_CAPTURE_TIMER_CH1:
         case PWM_CAPTURE_TIMER_CH2:
         case ANALOGUE_INPUT_TIMER:
@@ -462,8 +738,85 @@ uint32_t HW_TIMER_Get_Clock_Hz( Timer_T timer )
             }
         }
 
+        /*
+         * TIM1, TIM9 and TIM10 are on APB2 (STM32F446).
+         */
+        case CAN_REPLAY_TIMER:
+        case UART_CHANNEL_1_TIMER:
+        case UART_CHANNEL_2_TIMER: {
+            pclk = HAL_RCC_GetPCLK2Freq();
+
+            /*
+             * Read APB2 prescaler.
+             * If prescaler != 1, timer clock = 2 × PCLK2.
+             */
+            apb_prescaler = LL_RCC_GetAPB2Prescaler();
+
+            if ( apb_prescaler == LL_RCC_APB2_DIV_1 )
+            {
+                return pclk;
+            }
+            else
+            {
+                return pclk * 2U;
+            }
+        }
+
         default:
             return 0U;
     }
 #endif
 }
+
+void HW_TIMER_Start_Cycle_Counter( void )
+{
+#ifndef TEST_BUILD
+    // The counter is shared by every timestamp user, so only enable it; never
+    // clear CYCCNT here.
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+#endif
+}
+
+uint32_t HW_TIMER_Get_Cycle_Count( void )
+{
+#ifdef TEST_BUILD
+    return 0U;
+#else
+    return DWT->CYCCNT;
+#endif
+}
+
+uint32_t HW_TIMER_Get_Cycle_Clock_Hz( void )
+{
+#ifdef TEST_BUILD
+    return 0U;
+#else
+    return HAL_RCC_GetHCLKFreq();
+#endif
+}
+
+uint32_t HW_TIMER_Get_Time_Us( void )
+{
+#ifdef TEST_BUILD
+    return 0U;
+#else
+    uint32_t cycles_per_us = HAL_RCC_GetHCLKFreq() / 1000000U;
+    uint32_t primask       = __get_PRIMASK();
+    __disable_irq();
+
+    // Carry the sub-microsecond remainder so no cycles are lost between reads
+    uint32_t now     = DWT->CYCCNT;
+    uint32_t elapsed = ( now - time_base_cycles ) + time_base_residue;
+    time_base_cycles = now;
+    if ( cycles_per_us != 0U )
+    {
+        time_base_us += elapsed / cycles_per_us;
+        time_base_residue = elapsed % cycles_per_us;
+    }
+    uint32_t time_us = time_base_us;
+
+    __set_PRIMASK( primask );
+    return time_us;
+#endif
+}
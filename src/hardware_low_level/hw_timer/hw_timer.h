@@ -39,6 +39,10 @@ extern "C"
 /*
  * PWM_CAPTURE_TIMER_CH1 maps to PWM capture logical channel 1 (TIM2)
  * PWM_CAPTURE_TIMER_CH2 maps to PWM capture logical channel 2 (TIM5)
+ * UART_CHANNEL_1_TIMER is the DUT UART channel 1 RX silence timeout (TIM9)
+ * UART_CHANNEL_2_TIMER is the DUT UART channel 2 RX silence timeout (TIM10)
+ * CAN_CYCLIC_TIMER is the periodic CAN schedule tick (TIM13)
+ * CAN_REPLAY_TIMER is the one-shot that paces CAN log replay (TIM1)
  *
  * This does NOT correspond to TIM_CHANNEL_1 / TIM_CHANNEL_2.
  */
@@ -51,6 +55,10 @@ typedef enum Timer_T
     SPI_DAC_TIMER,
     PWM_CAPTURE_TIMER_CH1,
     PWM_CAPTURE_TIMER_CH2,
+    UART_CHANNEL_1_TIMER,
+    UART_CHANNEL_2_TIMER,
+    CAN_CYCLIC_TIMER,
+    CAN_REPLAY_TIMER,
 
 } Timer_T;
 
@@ -95,6 +103,50 @@ void HW_TIMER_Stop_Timer( Timer_T timer );
  */
 uint32_t HW_TIMER_Get_Clock_Hz( Timer_T timer );
 
+/**
+ * @brief Enables the free-running core cycle counter used for timestamps.
+ *
+ * The DWT cycle counter runs at the core clock (180 MHz, ~5.6 ns per count)
+ * and wraps every ~23.8 s. Calling this more than once is harmless and does not
+ * reset the count, so any driver that needs timestamps may call it at setup.
+ */
+void HW_TIMER_Start_Cycle_Counter( void );
+
+/**
+ * @brief Returns the current core cycle count.
+ *
+ * Intended for sub-microsecond event timestamps taken at the top of an ISR.
+ * Differences between two readings are valid across a single counter wrap
+ * when computed with unsigned 32-bit subtraction.
+ *
+ * @return uint32_t The raw DWT cycle count.
+ */
+uint32_t HW_TIMER_Get_Cycle_Count( void );
+
+/**
+ * @brief Gets the rate of the DWT cycle counter in Hz.
+ *
+ * CYCCNT counts core (HCLK) cycles, so this is the figure needed to turn a
+ * cycle-count difference into time.
+ *
+ * @return uint32_t The cycle counter frequency in Hz.
+ */
+uint32_t HW_TIMER_Get_Cycle_Clock_Hz( void );
+
+/**
+ * @brief Returns the shared 32-bit microsecond time base.
+ *
+ * Extends the DWT cycle counter past its ~23.8 s wrap, so readings from any
+ * driver can be compared directly; the time base itself wraps every ~71.6
+ * minutes and differences are taken with unsigned 32-bit subtraction. The
+ * extension must be read at least once per cycle counter wrap; the HAL tick
+ * (TIM14), which runs from startup whether or not the execution manager is
+ * active, reads it every millisecond. Safe to call from any context.
+ *
+ * @return uint32_t Microseconds since the cycle counter was first read.
+ */
+uint32_t HW_TIMER_Get_Time_Us( void );
+
 #ifdef __cplusplus
 }
 #endif
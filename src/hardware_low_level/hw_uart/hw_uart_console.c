@@ -10,15 +10,19 @@
  *      - USART3 console UART initialisation,
  *      - interrupt-driven single-byte RX capture,
  *      - software RX ring buffer management,
- *      - blocking TX primitive for console task-driven output flushing.
+ *      - non-blocking, interrupt-drained TX ring buffer with drop accounting.
  *
  *  Notes:
  *      - RX is interrupt-driven so bytes are captured reliably even while the
  *        console task is not running.
- *      - TX is intentionally blocking and is expected to be called only from
- *        console task context.
- *      - This module does not implement console parsing, command handling, or
- *        TX queueing policy. Those responsibilities belong to console.c.
+ *      - TX never blocks. Bytes are queued into a driver-owned ring and sent
+ *        one contiguous span at a time with HAL_UART_Transmit_IT(). The TX
+ *        complete callback launches the next span. Bytes that do not fit are
+ *        dropped and counted.
+ *      - Both USART3 TX DMA request mappings (DMA1 Stream 3 and Stream 4) are
+ *        owned by SPI channel 1, so TX is interrupt-driven rather than DMA.
+ *      - This module does not implement console parsing or command handling.
+ *        Those responsibilities belong to console.c.
  ******************************************************************************/
 
 /**-----------------------------------------------------------------------------
@@ -45,8 +49,25 @@
 #define HW_UART_CONSOLE_HANDLE ( &huart3 )
 #define HW_UART_CONSOLE_INSTANCE USART3
 
+#define HW_UART_CONSOLE_IRQ USART3_IRQn
+
 #define HW_UART_CONSOLE_RX_BUFFER_SIZE 128U
 
+#ifndef HW_UART_CONSOLE_TX_BUFFER_SIZE
+#define HW_UART_CONSOLE_TX_BUFFER_SIZE 4096U
+#endif
+
+#if ( HW_UART_CONSOLE_TX_BUFFER_SIZE & ( HW_UART_CONSOLE_TX_BUFFER_SIZE - 1U ) ) != 0U
+#error "HW_UART_CONSOLE_TX_BUFFER_SIZE must be a power of 2"
+#endif
+
+#if HW_UART_CONSOLE_TX_BUFFER_SIZE > 0xFFFFU
+#error "HW_UART_CONSOLE_TX_BUFFER_SIZE must fit a single HAL_UART_Transmit_IT() span"
+#endif
+
+/* USART3 sits on the 45 MHz APB1 bus; 16x oversampling caps the baud at PCLK1 / 16. */
+#define HW_UART_CONSOLE_MAX_BAUD_RATE 2812500U
+
 /**-----------------------------------------------------------------------------
  *  Typedefs / Enums / Structures
  *------------------------------------------------------------------------------
@@ -55,14 +76,24 @@
 /**
  * @brief Stores low-level runtime state for the console UART driver.
  *
- * @note This structure tracks RX ring buffer indices and whether the low-level
- *       console UART driver has been successfully initialised.
+ * @note This structure tracks RX and TX ring buffer indices, TX accounting and
+ *       whether the low-level console UART driver has been successfully
+ *       initialised. Fields marked volatile are updated by the USART3 IRQ.
  */
 typedef struct
 {
     uint32_t rx_head;
     uint32_t rx_tail;
 
+    uint32_t          tx_head;            // Next free TX ring slot, written by the task
+    volatile uint32_t tx_tail;            // Oldest unsent TX byte, advanced by the IRQ
+    volatile uint32_t tx_count;           // Queued bytes including the span in flight
+    volatile uint32_t tx_in_flight;       // Length of the span handed to HAL
+    volatile bool     tx_active;          // true while a HAL_UART_Transmit_IT() span runs
+    uint32_t          tx_peak_count;      // Highest tx_count seen since init
+    uint32_t          tx_dropped_bytes;   // Bytes discarded because the ring was full
+    uint32_t          tx_overflow_count;  // Writes that were truncated
+
     bool is_initialised;
 } HwUartConsoleState_T;
 
@@ -78,6 +109,7 @@ typedef struct
 
 static HwUartConsoleState_T uart_console_state;  // Driver-owned runtime state
 static uint8_t           uart_console_rx_buffer[HW_UART_CONSOLE_RX_BUFFER_SIZE];  // RX ring buffer
+static uint8_t           uart_console_tx_buffer[HW_UART_CONSOLE_TX_BUFFER_SIZE];  // TX ring buffer
 static uint8_t           uart_console_rx_byte;      // Single-byte HAL RX staging buffer
 static volatile uint32_t s_rx_overflow_count = 0U;  // Count of dropped RX bytes due to overflow
 
@@ -86,6 +118,61 @@ static volatile uint32_t s_rx_overflow_count = 0U;  // Count of dropped RX bytes
  *------------------------------------------------------------------------------
  */
 
+static inline uint32_t HW_UART_CONSOLE_Irq_Disable( void )
+{
+    uint32_t was_enabled = NVIC_GetEnableIRQ( HW_UART_CONSOLE_IRQ );
+
+    NVIC_DisableIRQ( HW_UART_CONSOLE_IRQ );
+
+    return was_enabled;
+}
+
+static inline void HW_UART_CONSOLE_Irq_Restore( uint32_t was_enabled )
+{
+    if ( was_enabled != 0U )
+    {
+        NVIC_EnableIRQ( HW_UART_CONSOLE_IRQ );
+    }
+}
+
+/*
+ * Hands the next contiguous span of queued TX bytes to HAL_UART_Transmit_IT().
+ *
+ * Contract:
+ * Called with the USART3 IRQ masked from task context, or from the TX complete
+ * callback. No span may already be in flight.
+ *
+ * If the HAL refuses the transfer, the bytes stay queued and the next
+ * HW_UART_CONSOLE_Write() retries.
+ */
+static void HW_UART_CONSOLE_Tx_Start_Next( void )
+{
+    uint32_t tail = uart_console_state.tx_tail;
+    uint32_t span = HW_UART_CONSOLE_TX_BUFFER_SIZE - tail;
+
+    if ( span > uart_console_state.tx_count )
+    {
+        span = uart_console_state.tx_count;
+    }
+
+    if ( span == 0U )
+    {
+        uart_console_state.tx_active = false;
+        return;
+    }
+
+    uart_console_state.tx_in_flight = span;
+    uart_console_state.tx_active    = true;
+
+    if ( HAL_UART_Transmit_IT( HW_UART_CONSOLE_HANDLE, &uart_console_tx_buffer[tail],
+                               ( uint16_t )span )
+         != HAL_OK )
+    {
+        uart_console_state.tx_in_flight = 0U;
+        uart_console_state.tx_active    = false;
+    }
+}
+
 /**-----------------------------------------------------------------------------
  *  Public Function Definitions
  *------------------------------------------------------------------------------
@@ -94,18 +181,25 @@ static volatile uint32_t s_rx_overflow_count = 0U;  // Count of dropped RX bytes
 /**
  * @brief Initialise the low-level console UART driver.
  *
- * Configures USART3 for console operation, resets driver-owned RX state, and
- * starts interrupt-driven single-byte reception using HAL_UART_Receive_IT().
+ * Configures USART3 for console operation, resets driver-owned RX and TX
+ * state, and starts interrupt-driven single-byte reception using
+ * HAL_UART_Receive_IT().
  *
  * @param baud_rate  UART baud rate to apply to the console peripheral.
  *
  * @returns true if initialisation and initial RX interrupt arming succeed.
- * @returns false if UART initialisation or RX interrupt startup fails.
+ * @returns false if the baud rate is zero or above HW_UART_CONSOLE_MAX_BAUD_RATE,
+ *          or if UART initialisation or RX interrupt startup fails.
  */
 bool HW_UART_CONSOLE_Init( uint32_t baud_rate )
 {
     UART_HandleTypeDef* huart = HW_UART_CONSOLE_HANDLE;
 
+    if ( ( baud_rate == 0U ) || ( baud_rate > HW_UART_CONSOLE_MAX_BAUD_RATE ) )
+    {
+        return false;
+    }
+
     huart->Instance        = HW_UART_CONSOLE_INSTANCE;
     huart->Init.BaudRate   = baud_rate;
     huart->Init.WordLength = UART_WORDLENGTH_8B;
@@ -118,9 +212,17 @@ bool HW_UART_CONSOLE_Init( uint32_t baud_rate )
         return false;
     }
 
-    uart_console_state.rx_head        = 0U;
-    uart_console_state.rx_tail        = 0U;
-    uart_console_state.is_initialised = true;
+    uart_console_state.rx_head           = 0U;
+    uart_console_state.rx_tail           = 0U;
+    uart_console_state.tx_head           = 0U;
+    uart_console_state.tx_tail           = 0U;
+    uart_console_state.tx_count          = 0U;
+    uart_console_state.tx_in_flight      = 0U;
+    uart_console_state.tx_active         = false;
+    uart_console_state.tx_peak_count     = 0U;
+    uart_console_state.tx_dropped_bytes  = 0U;
+    uart_console_state.tx_overflow_count = 0U;
+    uart_console_state.is_initialised    = true;
 
     if ( HAL_UART_Receive_IT( huart, &uart_console_rx_byte, 1U ) != HAL_OK )
     {
@@ -177,49 +279,114 @@ bool HW_UART_CONSOLE_Read( uint8_t* dest, uint32_t dest_size, uint32_t* bytes_re
 }
 
 /**
- * @brief Transmit a block of console bytes using a blocking UART call.
+ * @brief Queue console bytes for interrupt-driven transmission.
+ *
+ * Copies as many bytes as fit into the driver-owned TX ring buffer and starts
+ * transmission if the UART is idle. The call never waits for the wire.
  *
- * Sends the provided byte range directly over USART3 using HAL_UART_Transmit().
- * This function is intentionally blocking and is expected to be called only
- * from console task context.
+ * @param data    Pointer to bytes to transmit.
+ * @param length  Number of bytes to transmit.
  *
- * @param data        Pointer to bytes to transmit.
- * @param length      Number of bytes to transmit.
- * @param timeout_ms  HAL transmit timeout in milliseconds.
+ * @returns true if every byte was queued.
+ * @returns false if @p data is null, the driver is uninitialised, or the ring
+ *          buffer could not hold the whole block.
  *
- * @returns true if the full byte range is transmitted successfully.
- * @returns false if arguments are invalid, the driver is uninitialised, or
- *          HAL_UART_Transmit() fails.
+ * @note If the ring buffer is full, the bytes that do not fit are dropped,
+ *       added to tx_dropped_bytes, and tx_overflow_count is incremented.
+ *       The bytes that fit are still sent.
  *
- * @note Blocking TX is intentional. Console output is flushed from task
- *       context so that no UART TX interrupt activity occurs during the
- *       timer-driven execution window.
+ * @note Single producer. Call from console task context only.
  */
-bool HW_UART_CONSOLE_Write_Blocking( const uint8_t* data, uint32_t length, uint32_t timeout_ms )
+bool HW_UART_CONSOLE_Write( const uint8_t* data, uint32_t length )
 {
-    if ( data == NULL )
+    if ( ( data == NULL ) || !uart_console_state.is_initialised )
     {
         return false;
     }
 
-    if ( !uart_console_state.is_initialised )
+    if ( length == 0U )
+    {
+        return true;
+    }
+
+    uint32_t irq_was_enabled = HW_UART_CONSOLE_Irq_Disable();
+    uint32_t free_space      = HW_UART_CONSOLE_TX_BUFFER_SIZE - uart_console_state.tx_count;
+    HW_UART_CONSOLE_Irq_Restore( irq_was_enabled );
+
+    uint32_t queued_length = ( length < free_space ) ? length : free_space;
+
+    if ( queued_length < length )
+    {
+        uart_console_state.tx_dropped_bytes += length - queued_length;
+        uart_console_state.tx_overflow_count++;
+    }
+
+    if ( queued_length == 0U )
     {
         return false;
     }
 
-    if ( length == 0U )
+    uint32_t start_head  = uart_console_state.tx_head;
+    uint32_t first_chunk = HW_UART_CONSOLE_TX_BUFFER_SIZE - start_head;
+
+    if ( first_chunk > queued_length )
     {
-        return true;
+        first_chunk = queued_length;
     }
 
-    if ( timeout_ms == 0U )
+    memcpy( &uart_console_tx_buffer[start_head], data, first_chunk );
+
+    if ( queued_length > first_chunk )
+    {
+        memcpy( &uart_console_tx_buffer[0U], &data[first_chunk], queued_length - first_chunk );
+    }
+
+    irq_was_enabled = HW_UART_CONSOLE_Irq_Disable();
+
+    uart_console_state.tx_head =
+        ( start_head + queued_length ) & ( HW_UART_CONSOLE_TX_BUFFER_SIZE - 1U );
+    uart_console_state.tx_count += queued_length;
+
+    if ( uart_console_state.tx_count > uart_console_state.tx_peak_count )
+    {
+        uart_console_state.tx_peak_count = uart_console_state.tx_count;
+    }
+
+    if ( !uart_console_state.tx_active )
+    {
+        HW_UART_CONSOLE_Tx_Start_Next();
+    }
+
+    HW_UART_CONSOLE_Irq_Restore( irq_was_enabled );
+
+    return ( queued_length == length );
+}
+
+/**
+ * @brief Snapshot the console TX ring accounting.
+ *
+ * @param stats  Output structure written with the current TX counters.
+ *
+ * @returns true if the snapshot was written.
+ * @returns false if @p stats is null.
+ */
+bool HW_UART_CONSOLE_Get_Tx_Stats( HwUartConsoleTxStats_T* stats )
+{
+    if ( stats == NULL )
     {
         return false;
     }
 
-    return ( HAL_UART_Transmit( HW_UART_CONSOLE_HANDLE, ( uint8_t* )data, ( uint16_t )length,
-                                timeout_ms )
-             == HAL_OK );
+    uint32_t irq_was_enabled = HW_UART_CONSOLE_Irq_Disable();
+
+    stats->queued_bytes   = uart_console_state.tx_count;
+    stats->peak_bytes     = uart_console_state.tx_peak_count;
+    stats->dropped_bytes  = uart_console_state.tx_dropped_bytes;
+    stats->overflow_count = uart_console_state.tx_overflow_count;
+
+    HW_UART_CONSOLE_Irq_Restore( irq_was_enabled );
+
+    return true;
 }
 
 /**
@@ -255,6 +422,31 @@ void HAL_UART_RxCpltCallback( UART_HandleTypeDef* huart )
     }
 }
 
+/**
+ * @brief HAL UART TX-complete callback for the console UART.
+ *
+ * Retires the span that has just left the wire and launches the next queued
+ * contiguous span, if any.
+ *
+ * @param huart  HAL UART handle that completed a transmit operation.
+ *
+ * @returns void
+ */
+void HAL_UART_TxCpltCallback( UART_HandleTypeDef* huart )
+{
+    if ( huart->Instance == HW_UART_CONSOLE_INSTANCE )
+    {
+        uint32_t sent = uart_console_state.tx_in_flight;
+
+        uart_console_state.tx_tail =
+            ( uart_console_state.tx_tail + sent ) & ( HW_UART_CONSOLE_TX_BUFFER_SIZE - 1U );
+        uart_console_state.tx_count    -= sent;
+        uart_console_state.tx_in_flight = 0U;
+
+        HW_UART_CONSOLE_Tx_Start_Next();
+    }
+}
+
 /**
  * @brief HAL UART error callback for the console UART.
  *
@@ -276,7 +468,8 @@ void HAL_UART_ErrorCallback( UART_HandleTypeDef* huart )
 /**
  * @brief USART3 interrupt handler for the low-level console UART driver.
  *
- * Forwards USART3 interrupt handling to the HAL UART IRQ dispatcher.
+ * Forwards USART3 interrupt handling to the HAL UART IRQ dispatcher, which
+ * services both RX bytes and the TX span in flight.
  *
  * @returns void
  */
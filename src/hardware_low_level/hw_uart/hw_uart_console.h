@@ -8,8 +8,9 @@
  *
  *  Notes:
  *      - RX is interrupt-driven and buffered internally by the low-level driver.
- *      - TX is provided as a blocking primitive intended for console task
- *        context only.
+ *      - TX is non-blocking. Bytes are queued into a driver-owned ring and
+ *        drained by the USART3 interrupt; bytes that do not fit are dropped
+ *        and counted.
  ******************************************************************************/
 
 #ifndef HW_UART_CONSOLE_H
@@ -38,6 +39,17 @@ extern "C"
  *------------------------------------------------------------------------------
  */
 
+/**
+ * @brief Console TX ring accounting snapshot.
+ */
+typedef struct
+{
+    uint32_t queued_bytes;    // Bytes queued or in flight right now
+    uint32_t peak_bytes;      // Highest queued byte count since init
+    uint32_t dropped_bytes;   // Bytes discarded because the ring was full
+    uint32_t overflow_count;  // HW_UART_CONSOLE_Write() calls that were truncated
+} HwUartConsoleTxStats_T;
+
 /**-----------------------------------------------------------------------------
  *  Public Function Prototypes
  *------------------------------------------------------------------------------
@@ -48,7 +60,8 @@ extern "C"
  *
  * Configures the console UART peripheral and starts interrupt-driven reception.
  *
- * @param baud_rate  UART baud rate for console operation.
+ * @param baud_rate  UART baud rate for console operation, up to 2812500 baud
+ *                   (PCLK1 / 16). 921600 is the console default.
  *
  * @returns true if initialisation succeeds, otherwise false.
  */
@@ -69,17 +82,26 @@ bool HW_UART_CONSOLE_Init( uint32_t baud_rate );
 bool HW_UART_CONSOLE_Read( uint8_t* dest, uint32_t dest_size, uint32_t* bytes_read );
 
 /**
- * @brief Transmit a block of console bytes using a blocking UART call.
+ * @brief Queue console bytes for transmission without blocking.
+ *
+ * @param data    Pointer to bytes to transmit.
+ * @param length  Number of bytes to transmit.
  *
- * @param data        Pointer to bytes to transmit.
- * @param length      Number of bytes to transmit.
- * @param timeout_ms  UART transmit timeout in milliseconds.
+ * @returns true if every byte was queued, otherwise false.
+ *
+ * @note Bytes that do not fit in the TX ring are dropped and counted; see
+ *       HW_UART_CONSOLE_Get_Tx_Stats(). Intended for console task context.
+ */
+bool HW_UART_CONSOLE_Write( const uint8_t* data, uint32_t length );
+
+/**
+ * @brief Read the console TX ring accounting.
  *
- * @returns true if transmission succeeds, otherwise false.
+ * @param stats  Output structure written with the current TX counters.
  *
- * @note Intended for use from console task context.
+ * @returns true if @p stats was written, otherwise false.
  */
-bool HW_UART_CONSOLE_Write_Blocking( const uint8_t* data, uint32_t length, uint32_t timeout_ms );
+bool HW_UART_CONSOLE_Get_Tx_Stats( HwUartConsoleTxStats_T* stats );
 
 #ifdef __cplusplus
 }
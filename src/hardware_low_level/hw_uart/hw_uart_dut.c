@@ -12,8 +12,14 @@
  *      - static hardware interface selection sequencing,
  *      - DMA-backed circular RX buffering,
  *      - lightweight access to unread RX data through zero-copy spans,
+ *      - RX frame boundary markers from USART line idle and RX DMA half/full
+ *        transfer interrupts, with an optional ISR-context wakeup hook,
+ *      - optional RX silence timeout framing, using a one-shot hardware timer to
+ *        extend line idle to the configured gap, with a frame descriptor queue,
  *      - DMA-source TX ring buffering,
- *      - normal mode DMA TX pumping over contiguous TX buffer spans.
+ *      - normal mode DMA TX pumping over contiguous TX buffer spans,
+ *      - RX auto-baud detection, timing RX pin edges through EXTI with the core
+ *        cycle counter because the F446 USART has no auto-baud hardware.
  *
  *      Non-execution stage functions such as configuration and RX startup may use HAL
  *      to simplify peripheral initialisation. Execution-path RX access remains
@@ -57,6 +63,8 @@
 #endif
 
 #include "hw_uart_dut.h"
+#include "hw_timer.h"
+#include "hw_gpio.h"
 #include <stdint.h>
 #include <stdbool.h>
 #include <string.h>
@@ -76,6 +84,10 @@
 #define HW_UART_CH1_TX_DMA_IRQ DMA2_Stream6_IRQn
 #define HW_UART_CH1_TX_DMA_IRQ_HANDLER DMA2_Stream6_IRQHandler
 #define HW_UART_CH1_RX_DMA_IRQ_HANDLER DMA2_Stream2_IRQHandler
+#define HW_UART_CH1_USART_IRQ USART6_IRQn
+#define HW_UART_CH1_USART_IRQ_HANDLER USART6_IRQHandler
+#define HW_UART_CH1_RX_TIMEOUT_TIMER UART_CHANNEL_1_TIMER
+#define HW_UART_CH1_RX_PIN GPIO_USART6_RX
 
 #define HW_UART_CH1_DMA_CONTROLLER DMA2
 #define HW_UART_CH1_DMA_TX_LL_STREAM LL_DMA_STREAM_6
@@ -98,6 +110,10 @@
 #define HW_UART_CH2_TX_DMA_IRQ DMA1_Stream6_IRQn
 #define HW_UART_CH2_TX_DMA_IRQ_HANDLER DMA1_Stream6_IRQHandler
 #define HW_UART_CH2_RX_DMA_IRQ_HANDLER DMA1_Stream5_IRQHandler
+#define HW_UART_CH2_USART_IRQ USART2_IRQn
+#define HW_UART_CH2_USART_IRQ_HANDLER USART2_IRQHandler
+#define HW_UART_CH2_RX_TIMEOUT_TIMER UART_CHANNEL_2_TIMER
+#define HW_UART_CH2_RX_PIN GPIO_USART2_RX
 
 #define HW_UART_CH2_DMA_CONTROLLER DMA1
 #define HW_UART_CH2_DMA_TX_LL_STREAM LL_DMA_STREAM_6
@@ -111,6 +127,10 @@
     ( DMA_HIFCR_CTCIF5 | DMA_HIFCR_CTEIF5 | DMA_HIFCR_CFEIF5 | DMA_HIFCR_CDMEIF5                   \
       | DMA_HIFCR_CHTIF5 )
 
+/* Both RX pins (PC7, PD6) share one EXTI vector, used only for auto-baud capture. */
+#define HW_UART_RX_EDGE_IRQ EXTI9_5_IRQn
+#define HW_UART_RX_EDGE_IRQ_HANDLER EXTI9_5_IRQHandler
+
 /* Placeholder interface selection line definitions. */
 #define HW_UART_CH1_MODE_SEL0_LINE GPIO_PIN_0
 #define HW_UART_CH1_MODE_SEL1_LINE GPIO_PIN_1
@@ -129,9 +149,53 @@
 #error "HW_UART_RX_BUFFER_SIZE must be a power of 2"
 #endif
 
+#if ( ( HW_UART_RX_BOUNDARY_QUEUE_DEPTH & ( HW_UART_RX_BOUNDARY_QUEUE_DEPTH - 1U ) ) != 0U )
+#error "HW_UART_RX_BOUNDARY_QUEUE_DEPTH must be a power of 2"
+#endif
+
+#if ( ( HW_UART_RX_FRAME_QUEUE_DEPTH & ( HW_UART_RX_FRAME_QUEUE_DEPTH - 1U ) ) != 0U )
+#error "HW_UART_RX_FRAME_QUEUE_DEPTH must be a power of 2"
+#endif
+
+#if ( ( HW_UART_TX_SEGMENT_QUEUE_DEPTH & ( HW_UART_TX_SEGMENT_QUEUE_DEPTH - 1U ) ) != 0U )
+#error "HW_UART_TX_SEGMENT_QUEUE_DEPTH must be a power of 2"
+#endif
+
+/* One-shot RX timeout timer counter and prescaler are both 16 bit. */
+#define HW_UART_RX_TIMEOUT_TIMER_MAX_COUNT 65536U
+
+/* USART line idle IRQ priority. Matches the RX DMA stream priority set by CubeMX so the
+ * two boundary producers of a channel never preempt each other, and stays at or below
+ * configMAX_SYSCALL_INTERRUPT_PRIORITY so notify hooks may use FreeRTOS FromISR calls. */
+#define HW_UART_USART_IRQ_PRIORITY 5U
+
+/* Rate the USART runs at while auto-baud capture is pending, so the RX pin is muxed. */
+#define HW_UART_AUTO_BAUD_PROBE_RATE 115200U
+
+/* Detectable rate range. The upper limit also sets the glitch rejection width. */
+#define HW_UART_AUTO_BAUD_MIN_RATE 300U
+#define HW_UART_AUTO_BAUD_MAX_RATE 1000000U
+
+/* Longest run between edges inside a character: start plus 9 data bits at 0x000. */
+#define HW_UART_AUTO_BAUD_MAX_RUN_BITS 10U
+
+/* Fewest bit times an estimate must be averaged over. */
+#define HW_UART_AUTO_BAUD_MIN_BITS 20U
+
+/* A measured rate within this error of a standard rate is snapped to it. */
+#define HW_UART_AUTO_BAUD_SNAP_PPM 25000U
+
+/* Keeps captured edge intervals ordered before the volatile capture state update. */
+#ifndef HW_UART_COMPILER_BARRIER
+#define HW_UART_COMPILER_BARRIER() __asm volatile( "" ::: "memory" )
+#endif
+
 /* TX DMA disable timeout iterations */
 #define HW_UART_TX_DMA_DISABLE_TIMEOUT_ITERATIONS 1000U
 
+/* Largest single normal mode DMA transfer, limited by the 16 bit NDTR register. */
+#define HW_UART_TX_DMA_MAX_LENGTH 65535U
+
 /**-----------------------------------------------------------------------------
  *  Typedefs / Enums / Structures
  *------------------------------------------------------------------------------
@@ -180,6 +244,55 @@ typedef struct
     uint16_t volt_sel1_line;  // GPIO pin number for VOLT_SEL bit 1
 } HwUartSelectionLines_T;
 
+/**
+ * @brief  Records the RX DMA write index at which a frame boundary event occurred.
+ */
+typedef struct
+{
+    uint32_t end_index;  // RX buffer index one past the last byte before the boundary
+    bool     line_idle;  // true for USART line idle, false for DMA half/full transfer
+} HwUartRxBoundary_T;
+
+/**
+ * @brief  A queued zero copy TX segment and its place in the TX byte stream.
+ */
+typedef struct
+{
+    const uint8_t* data;
+    uint32_t       length_bytes;
+    uint32_t       ring_marker;  // tx_ring_sent_total value at which the segment goes on air
+} HwUartTxSegmentEntry_T;
+
+/**
+ * @brief  Auto-baud capture progress, owned by the edge interrupt until CAPTURED.
+ */
+typedef enum
+{
+    HW_UART_AUTO_BAUD_STATE_IDLE = 0,
+    HW_UART_AUTO_BAUD_STATE_CAPTURING,
+    HW_UART_AUTO_BAUD_STATE_CAPTURED,
+    HW_UART_AUTO_BAUD_STATE_LOCKED
+} HwUartAutoBaudState_T;
+
+/**
+ * @brief  Stores RX edge timing captured for auto-baud detection.
+ *
+ * @note   While CAPTURING, the EXTI handler is the only writer. Each edge whose
+ *         level differs from the previous edge appends the cycle count between
+ *         them to intervals. An edge at the same level as the previous one means
+ *         an edge was missed, so the timing reference is dropped instead.
+ */
+typedef struct
+{
+    volatile HwUartAutoBaudState_T state;
+    volatile uint32_t              interval_count;
+    uint32_t                       last_edge_cycles;
+    bool                           last_edge_level;
+    bool                           has_reference;
+    uint32_t                       intervals[HW_UART_AUTO_BAUD_EDGE_INTERVALS];
+    HwUartAutoBaudResult_T         result;
+} HwUartAutoBaudCapture_T;
+
 /**
  * @brief  Stores low-level runtime state associated with a UART channel.
  *
@@ -197,7 +310,24 @@ typedef struct
  *           including queued bytes and bytes currently being consumed by DMA,
  *         - tx_dma_length_bytes records the active linear DMA transfer length,
  *         - tx_dma_active indicates that a normal-mode DMA transfer is currently
- *           reading from the TX ring buffer.
+ *           reading from the TX ring buffer or from a zero copy segment.
+ *
+ * @note   Zero copy segments form a second queue appended at tx_segment_head and
+ *         retired at tx_segment_tail, both free running. Each entry records the
+ *         value tx_ring_sent_total will have when every ring byte loaded before
+ *         it has been sent, so the pump drains the ring up to that marker, then
+ *         streams the segment, tracking progress in tx_segment_offset.
+ *
+ * @note   The RX boundary fields implement a single-producer, single-consumer
+ *         marker queue. The USART and RX DMA interrupts append at
+ *         rx_boundary_head; HW_UART_Rx_Peek_Frame() retires passed markers by
+ *         advancing rx_boundary_tail. Both indices are free running.
+ *
+ * @note   The RX frame fields implement the silence timeout descriptor queue in
+ *         the same way. The timeout path appends at rx_frame_head and
+ *         HW_UART_Rx_Release_Timeout_Frame() advances rx_frame_tail. Bytes from
+ *         rx_frame_start_index up to the DMA write index belong to the frame that
+ *         is still being received.
  */
 typedef struct
 {
@@ -213,6 +343,24 @@ typedef struct
     volatile uint32_t tx_count;
     volatile uint32_t tx_dma_length_bytes;
     volatile bool     tx_dma_active;
+    volatile bool     tx_dma_from_segment;  // Active transfer reads segment memory
+    volatile uint32_t tx_ring_sent_total;   // Free running count of ring bytes sent
+    volatile uint32_t tx_segment_head;
+    volatile uint32_t tx_segment_tail;      // Also the free running retired count
+    volatile uint32_t tx_segment_offset;    // Bytes of the oldest segment already sent
+
+    volatile uint32_t rx_boundary_head;
+    volatile uint32_t rx_boundary_tail;
+    volatile uint32_t rx_boundaries_dropped;  // Markers lost to a full queue; frames merge
+    HwUartRxNotify_T  rx_notify;
+
+    bool              rx_timeout_uses_timer;   // Timeout exceeds the line idle detection time
+    volatile uint32_t rx_timeout_armed_index;  // DMA write index when line idle was detected
+    volatile uint32_t rx_frame_start_index;    // RX buffer index of the open frame's first byte
+    volatile uint32_t rx_frame_errors;         // HwUartRxFrameError_T bits for the open frame
+    volatile uint32_t rx_frame_head;
+    volatile uint32_t rx_frame_tail;
+    volatile uint32_t rx_frames_dropped;  // Descriptors lost to a full queue; frames merge
 
 } HwUartRuntimeState_T;
 
@@ -228,10 +376,14 @@ typedef struct
  */
 typedef struct
 {
-    HwUartConfig_T       config;
-    HwUartRuntimeState_T runtime;
-    uint8_t              rx_buffer[HW_UART_RX_BUFFER_SIZE];
-    uint8_t              tx_buffer[HW_UART_TX_BUFFER_SIZE];
+    HwUartConfig_T            config;
+    HwUartRuntimeState_T      runtime;
+    uint8_t                   rx_buffer[HW_UART_RX_BUFFER_SIZE];
+    uint8_t                   tx_buffer[HW_UART_TX_BUFFER_SIZE];
+    HwUartRxBoundary_T        rx_boundaries[HW_UART_RX_BOUNDARY_QUEUE_DEPTH];
+    HwUartRxFrameDescriptor_T rx_frames[HW_UART_RX_FRAME_QUEUE_DEPTH];
+    HwUartTxSegmentEntry_T    tx_segments[HW_UART_TX_SEGMENT_QUEUE_DEPTH];
+    HwUartAutoBaudCapture_T   auto_baud;
 } HwUartChannelState_T;
 
 /**
@@ -256,6 +408,10 @@ typedef struct
 
     volatile uint32_t* rx_dma_ifcr_reg;
     uint32_t           rx_dma_ifcr_mask;
+
+    IRQn_Type usart_irq;
+    Timer_T   rx_timeout_timer;
+    GPIOPin_T rx_pin;
 } HwUartHardwareMap_T;
 
 /**-----------------------------------------------------------------------------
@@ -284,7 +440,10 @@ static const HwUartHardwareMap_T hw_uart_hardware_map[HW_UART_CHANNEL_COUNT] = {
                             .tx_dma_ifcr_reg   = HW_UART_CH1_DMA_TX_IFCR_REG,
                             .tx_dma_ifcr_mask  = HW_UART_CH1_DMA_TX_IFCR_MASK,
                             .rx_dma_ifcr_reg   = HW_UART_CH1_DMA_RX_IFCR_REG,
-                            .rx_dma_ifcr_mask  = HW_UART_CH1_DMA_RX_IFCR_MASK },
+                            .rx_dma_ifcr_mask  = HW_UART_CH1_DMA_RX_IFCR_MASK,
+                            .usart_irq         = HW_UART_CH1_USART_IRQ,
+                            .rx_timeout_timer  = HW_UART_CH1_RX_TIMEOUT_TIMER,
+                            .rx_pin            = HW_UART_CH1_RX_PIN },
 
     [HW_UART_CHANNEL_2] = { .uart_instance     = HW_UART_CH2_USART,
                             .rx_dma_stream     = HW_UART_CH2_DMA_RX_STREAM,
@@ -296,7 +455,17 @@ static const HwUartHardwareMap_T hw_uart_hardware_map[HW_UART_CHANNEL_COUNT] = {
                             .tx_dma_ifcr_reg   = HW_UART_CH2_DMA_TX_IFCR_REG,
                             .tx_dma_ifcr_mask  = HW_UART_CH2_DMA_TX_IFCR_MASK,
                             .rx_dma_ifcr_reg   = HW_UART_CH2_DMA_RX_IFCR_REG,
-                            .rx_dma_ifcr_mask  = HW_UART_CH2_DMA_RX_IFCR_MASK } };
+                            .rx_dma_ifcr_mask  = HW_UART_CH2_DMA_RX_IFCR_MASK,
+                            .usart_irq         = HW_UART_CH2_USART_IRQ,
+                            .rx_timeout_timer  = HW_UART_CH2_RX_TIMEOUT_TIMER,
+                            .rx_pin            = HW_UART_CH2_RX_PIN } };
+
+/* Rates an auto-baud measurement is snapped to, in ascending order */
+static const uint32_t hw_uart_auto_baud_standard_rates[] = {
+    300U,    600U,    1200U,   2400U,   4800U,   9600U,   14400U,  19200U,  28800U,
+    38400U,  57600U,  76800U,  115200U, 230400U, 250000U, 460800U, 500000U, 921600U,
+    1000000U,
+};
 
 /* Fixed board-level mapping from logical UART channels to interface selection lines */
 static const HwUartSelectionLines_T uart_selection_lines[HW_UART_CHANNEL_COUNT] = {
@@ -316,6 +485,9 @@ static const HwUartSelectionLines_T uart_selection_lines[HW_UART_CHANNEL_COUNT]
 static inline void HW_UART_Tx_Complete_Handler( HwUartChannel_T channel );
 static inline void HW_UART_Tx_Error_Handler( HwUartChannel_T channel );
 static inline void HW_UART_Rx_Error_Handler( HwUartChannel_T channel );
+static inline void HW_UART_Rx_Record_Boundary( HwUartChannel_T channel, bool line_idle );
+static inline void HW_UART_Rx_Timeout_Elapsed( HwUartChannel_T channel );
+static inline void HW_UART_Auto_Baud_Record_Edge( HwUartChannel_T channel, uint32_t edge_cycles );
 
 /**-----------------------------------------------------------------------------
  *  Interrupt Handler Prototypes
@@ -325,6 +497,9 @@ void HW_UART_CH1_TX_DMA_IRQ_HANDLER( void );
 void HW_UART_CH2_TX_DMA_IRQ_HANDLER( void );
 void HW_UART_CH1_RX_DMA_IRQ_HANDLER( void );
 void HW_UART_CH2_RX_DMA_IRQ_HANDLER( void );
+void HW_UART_CH1_USART_IRQ_HANDLER( void );
+void HW_UART_CH2_USART_IRQ_HANDLER( void );
+void HW_UART_RX_EDGE_IRQ_HANDLER( void );
 /**-----------------------------------------------------------------------------
  *  Private (static) Function Definitions
  *------------------------------------------------------------------------------
@@ -353,7 +528,8 @@ static bool HW_UART_Configuration_Is_Valid( const HwUartConfig_T* config )
 
     if ( config->interface_mode == HW_UART_MODE_DISABLED )
     {
-        return ( !config->rx_enabled && !config->tx_enabled && config->baud_rate == 0U );
+        return ( !config->rx_enabled && !config->tx_enabled && config->baud_rate == 0U
+                 && config->rx_timeout_bits == 0U );
     }
 
     if ( !config->rx_enabled && !config->tx_enabled )
@@ -366,6 +542,14 @@ static bool HW_UART_Configuration_Is_Valid( const HwUartConfig_T* config )
         return false;
     }
 
+    /* Auto-baud detects the rate from RX traffic, so it needs the receiver. */
+    const bool auto_baud = ( config->baud_rate == HW_UART_BAUD_RATE_AUTO );
+
+    if ( auto_baud && !config->rx_enabled )
+    {
+        return false;
+    }
+
     if ( config->word_length != HW_UART_WORD_LENGTH_8_BITS
          && config->word_length != HW_UART_WORD_LENGTH_9_BITS )
     {
@@ -383,17 +567,22 @@ static bool HW_UART_Configuration_Is_Valid( const HwUartConfig_T* config )
         return false;
     }
 
+    if ( config->rx_timeout_bits > HW_UART_RX_TIMEOUT_MAX_BITS )
+    {
+        return false;
+    }
+
     bool valid_baud = false;
 
     switch ( config->interface_mode )
     {
         case HW_UART_MODE_TTL_3V3:
         case HW_UART_MODE_TTL_5V0:
-            valid_baud = ( config->baud_rate <= 2000000U );
+            valid_baud = auto_baud || ( config->baud_rate <= 2000000U );
             break;
 
         case HW_UART_MODE_RS232:
-            valid_baud = ( config->baud_rate <= 1000000U );
+            valid_baud = auto_baud || ( config->baud_rate <= 1000000U );
             break;
 
         case HW_UART_MODE_DISABLED:
@@ -458,6 +647,110 @@ static inline uint32_t HW_UART_Advance_Index_Helper( uint32_t current_index, uin
     return ( current_index + advance_by ) & ( HW_UART_RX_BUFFER_SIZE - 1U );
 }
 
+/**
+ * @brief  Derives the current RX DMA write index from the stream NDTR register.
+ *
+ * @param  channel The UART channel whose RX DMA stream is sampled.
+ *
+ * @return Index of the next RX buffer byte the DMA engine will write.
+ *
+ * @note   Shared by the execution path and the boundary interrupts so both
+ *         agree on the wrap convention when NDTR reloads to the full size.
+ */
+static inline uint32_t HW_UART_Rx_Dma_Write_Index( HwUartChannel_T channel )
+{
+    uint32_t dma_remaining = hw_uart_hardware_map[channel].rx_dma_stream->NDTR;
+
+    return ( HW_UART_RX_BUFFER_SIZE - dma_remaining ) & ( HW_UART_RX_BUFFER_SIZE - 1U );
+}
+
+/**
+ * @brief  Builds the zero copy span view of a region of the RX DMA circular buffer.
+ *
+ * @param  rx_buffer    The channel's RX DMA buffer.
+ * @param  start_index  RX buffer index of the first byte in the region.
+ * @param  length_bytes Number of bytes in the region, at most the buffer size.
+ *
+ * @return One span, or two if the region wraps past the end of the buffer.
+ */
+static inline HwUartRxSpans_T HW_UART_Rx_Make_Spans( uint8_t* rx_buffer, uint32_t start_index,
+                                                     uint32_t length_bytes )
+{
+    uint32_t first_span_length = HW_UART_RX_BUFFER_SIZE - start_index;
+
+    if ( length_bytes <= first_span_length )
+    {
+        /* Single contiguous region. */
+        return ( HwUartRxSpans_T ){
+            .first_span         = { .data = &rx_buffer[start_index], .length_bytes = length_bytes },
+            .second_span        = { .data = &rx_buffer[0], .length_bytes = 0U },
+            .total_length_bytes = length_bytes };
+    }
+
+    /* Wrapped region split into two contiguous spans. */
+    return ( HwUartRxSpans_T ){
+        .first_span         = { .data         = &rx_buffer[start_index],
+                                .length_bytes = first_span_length },
+        .second_span        = { .data         = &rx_buffer[0],
+                                .length_bytes = length_bytes - first_span_length },
+        .total_length_bytes = length_bytes };
+}
+
+/**
+ * @brief  Programs the one-shot RX timeout timer for the stored channel configuration.
+ *
+ * @param  channel The UART channel to prepare.
+ *
+ * @return true if no timer is needed or the timer was configured.
+ * @return false if the timeout cannot be represented by the 16 bit prescaler and
+ *         counter at the configured baud rate.
+ *
+ * @note   This function is used only in the non-hot-path configuration stage.
+ *
+ * @note   Line idle is detected by the USART after one full character of idle
+ *         line, i.e. start, data, parity and stop bits. The timer only covers the
+ *         remaining part of rx_timeout_bits, rounded up to whole timer ticks.
+ */
+static bool HW_UART_Rx_Timeout_Timer_Setup( HwUartChannel_T channel )
+{
+    HwUartChannelState_T* state = &hw_uart_channel_states[channel];
+    const HwUartConfig_T* cfg   = &state->config;
+
+    uint32_t character_bits = 1U + ( uint32_t )cfg->word_length + ( uint32_t )cfg->stop_bits;
+
+    state->runtime.rx_timeout_uses_timer = false;
+
+    if ( !cfg->rx_enabled || cfg->rx_timeout_bits <= character_bits )
+    {
+        return true;
+    }
+
+    Timer_T  timer     = hw_uart_hardware_map[channel].rx_timeout_timer;
+    uint64_t wait_bits = ( uint64_t )( cfg->rx_timeout_bits - character_bits );
+    uint64_t ticks = ( ( wait_bits * HW_TIMER_Get_Clock_Hz( timer ) ) + cfg->baud_rate - 1U )
+                     / cfg->baud_rate;
+
+    if ( ticks == 0U )
+    {
+        ticks = 1U;
+    }
+
+    uint64_t prescaler = ( ticks - 1U ) / HW_UART_RX_TIMEOUT_TIMER_MAX_COUNT;
+
+    if ( prescaler >= HW_UART_RX_TIMEOUT_TIMER_MAX_COUNT )
+    {
+        return false;
+    }
+
+    uint64_t period = ( ticks + prescaler ) / ( prescaler + 1U );
+
+    HW_TIMER_Configure_Timer( timer, ( uint32_t )prescaler, ( uint32_t )( period - 1U ) );
+    HW_TIMER_Start_Cycle_Counter();
+
+    state->runtime.rx_timeout_uses_timer = true;
+    return true;
+}
+
 static inline uint32_t HW_UART_Tx_Dma_Irq_Disable( HwUartChannel_T channel )
 {
     IRQn_Type irq         = hw_uart_hardware_map[channel].tx_dma_irq;
@@ -589,13 +882,18 @@ static bool HW_UART_Apply_Static_Hardware_Selection( HwUartChannel_T       chann
  *
  * @note   Runtime RX and TX operations assume this initialisation has already completed
  *         successfully and do not reinitialise the peripheral.
+ *
+ * @note   While auto-baud detection is pending the USART runs at a probe rate. This
+ *         only serves to mux the RX pin; nothing is received until the rate locks.
  */
 static bool HW_UART_Init_Channel( HwUartChannel_T channel )
 {
     HwUartChannelState_T* state = &hw_uart_channel_states[channel];
     UART_HandleTypeDef*   huart = hw_uart_hardware_map[channel].uart_handle;
 
-    huart->Init.BaudRate = state->config.baud_rate;
+    huart->Init.BaudRate = ( state->config.baud_rate == HW_UART_BAUD_RATE_AUTO )
+                               ? HW_UART_AUTO_BAUD_PROBE_RATE
+                               : state->config.baud_rate;
 
     switch ( state->config.word_length )
     {
@@ -664,6 +962,12 @@ static bool HW_UART_Init_Channel( HwUartChannel_T channel )
  *         tx_count, clears the active transfer state, and restarts the TX DMA pump
  *         if queued data remains.
  *
+ * @note   When the completed transfer read a zero copy segment, the segment
+ *         offset advances instead, and the segment is retired once all of it
+ *         has been read. The next launch follows immediately, so back to back
+ *         segments only see the re-arm latency, which the USART data register
+ *         and shift register cover at any supported baud rate.
+ *
  * @note   If the queued TX data wraps around the end of the TX ring buffer,
  *         this completion handler causes the next contiguous span to be launched
  *         as a separate normal mode DMA transfer.
@@ -680,13 +984,33 @@ static inline void HW_UART_Tx_Complete_Handler( HwUartChannel_T channel )
 
     uint32_t completed_length = runtime->tx_dma_length_bytes;
 
-    runtime->tx_tail = ( runtime->tx_tail + completed_length ) % HW_UART_TX_BUFFER_SIZE;
+    if ( runtime->tx_dma_from_segment )
+    {
+        const HwUartTxSegmentEntry_T* entry =
+            &hw_uart_channel_states[channel]
+                 .tx_segments[runtime->tx_segment_tail & ( HW_UART_TX_SEGMENT_QUEUE_DEPTH - 1U )];
+
+        runtime->tx_segment_offset += completed_length;
+
+        if ( runtime->tx_segment_offset == entry->length_bytes )
+        {
+            runtime->tx_segment_offset = 0U;
+            runtime->tx_segment_tail++;
+        }
+    }
+    else
+    {
+        runtime->tx_tail = ( runtime->tx_tail + completed_length ) % HW_UART_TX_BUFFER_SIZE;
+
+        runtime->tx_count -= completed_length;
+        runtime->tx_ring_sent_total += completed_length;
+    }
 
-    runtime->tx_count -= completed_length;
     runtime->tx_dma_length_bytes = 0U;
     runtime->tx_dma_active       = false;
+    runtime->tx_dma_from_segment = false;
 
-    if ( runtime->tx_count > 0U )
+    if ( runtime->tx_count > 0U || runtime->tx_segment_head != runtime->tx_segment_tail )
     {
         ( void )HW_UART_Tx_Trigger( channel );
     }
@@ -703,6 +1027,9 @@ static inline void HW_UART_Tx_Complete_Handler( HwUartChannel_T channel )
  *         transfer. This handler disables the UART DMA TX request, clears the TX
  *         ring buffer state, and releases the active DMA transfer state.
  *
+ * @note   Queued zero copy segments are dropped and counted as retired, so the
+ *         caller regains ownership of their memory.
+ *
  * @note   This function does not attempt recovery or retry. Higher layers are
  *         expected to treat this as a fault condition and abort execution for
  *         deterministic behaviour requirements.
@@ -720,6 +1047,9 @@ static inline void HW_UART_Tx_Error_Handler( HwUartChannel_T channel )
     runtime->tx_count            = 0U;
     runtime->tx_dma_length_bytes = 0U;
     runtime->tx_dma_active       = false;
+    runtime->tx_dma_from_segment = false;
+    runtime->tx_segment_offset   = 0U;
+    runtime->tx_segment_tail     = runtime->tx_segment_head;
 
     /* Future fault implementation:
      * runtime->latched_faults |= HW_UART_FAULT_DMA_ERROR;
@@ -743,207 +1073,744 @@ static inline void HW_UART_Rx_Error_Handler( HwUartChannel_T channel )
      */
 }
 
-/**-----------------------------------------------------------------------------
- *  Public Function Definitions
- *------------------------------------------------------------------------------
+/**
+ * @brief  Records an RX frame boundary at the current DMA write index.
+ *
+ * @param  channel   The UART channel on which the boundary event occurred.
+ * @param  line_idle true for a USART line idle event, false for an RX DMA
+ *                   half-transfer or transfer-complete event.
+ *
+ * @return void
+ *
+ * @note   Called only from the USART and RX DMA interrupt handlers of the channel.
+ *         Both run at the same NVIC priority, so this producer is never re-entered.
+ *
+ * @note   The marker is taken at the live write index rather than the fixed half or
+ *         end of buffer position, so bytes that arrived during interrupt latency are
+ *         covered by the same wakeup.
+ *
+ * @note   If the marker queue is full the new marker is dropped and counted. No RX
+ *         data is lost; the affected frames are reported as one longer frame.
  */
-
-/* Applies validated configuration and resets runtime state. */
-bool HW_UART_Configure_Channel( HwUartChannel_T channel, const HwUartConfig_T* config )
+static inline void HW_UART_Rx_Record_Boundary( HwUartChannel_T channel, bool line_idle )
 {
-    if ( channel >= HW_UART_CHANNEL_COUNT )
-    {
-        return false;
-    }
+    HwUartChannelState_T* state   = &hw_uart_channel_states[channel];
+    HwUartRuntimeState_T* runtime = &state->runtime;
 
-    if ( !HW_UART_Configuration_Is_Valid( config ) )
+    if ( !runtime->rx_running )
     {
-        return false;
+        return;
     }
 
-    HwUartChannelState_T* state = &hw_uart_channel_states[channel];
+    uint32_t head = runtime->rx_boundary_head;
 
-    /* Refuse to reconfigure while RX DMA is active. */
-    if ( state->runtime.rx_running )
+    if ( ( head - runtime->rx_boundary_tail ) >= HW_UART_RX_BOUNDARY_QUEUE_DEPTH )
     {
-        return false;
+        runtime->rx_boundaries_dropped++;
     }
-    /* Refuse to reconfigure while TX DMA is active or queued data remains. */
-    if ( state->runtime.tx_dma_active || state->runtime.tx_count > 0U )
+    else
     {
-        return false;
-    }
+        HwUartRxBoundary_T* boundary =
+            &state->rx_boundaries[head & ( HW_UART_RX_BOUNDARY_QUEUE_DEPTH - 1U )];
 
-    if ( !HW_UART_Apply_Static_Hardware_Selection( channel, config->interface_mode ) )
-    {
-        return false;
+        boundary->end_index       = HW_UART_Rx_Dma_Write_Index( channel );
+        boundary->line_idle       = line_idle;
+        runtime->rx_boundary_head = head + 1U;
     }
 
-    /* Store the new configuration and reset runtime state. */
-    state->runtime.is_configured_and_initialised = false;
-    state->config                                = *config;
-
-    state->runtime.latched_faults = 0U;
-    state->runtime.rx_read_index  = 0U;
-    state->runtime.rx_running     = false;
-
-    state->runtime.tx_head             = 0U;
-    state->runtime.tx_tail             = 0U;
-    state->runtime.tx_count            = 0U;
-    state->runtime.tx_dma_length_bytes = 0U;
-    state->runtime.tx_dma_active       = false;
+    HwUartRxNotify_T notify = runtime->rx_notify;
 
-    if ( !HW_UART_Init_Channel( channel ) )
+    if ( notify != NULL )
     {
-        return false;
+        notify( channel );
     }
-
-    state->runtime.is_configured_and_initialised = true;
-    return true;
 }
 
-/* Starts DMA-backed UART reception for the specified channel. */
-bool HW_UART_Rx_Start( HwUartChannel_T channel )
+/**
+ * @brief  Closes the open RX frame once the configured line silence has elapsed.
+ *
+ * @param  channel The UART channel whose silence timeout elapsed.
+ *
+ * @return void
+ *
+ * @note   Called from the USART interrupt when the timeout fits inside the line
+ *         idle detection time, otherwise from the RX timeout timer interrupt. Both
+ *         run at the RX DMA priority, so the descriptor producer is never re-entered.
+ *
+ * @note   If the DMA write index moved since line idle was detected, a byte arrived
+ *         inside the timeout window and the frame stays open. Its own line idle
+ *         event re-arms the timer.
+ *
+ * @note   If the descriptor queue is full the frame is left open and flagged as
+ *         merged, so no RX data is lost and the next descriptor covers both frames.
+ */
+static inline void HW_UART_Rx_Timeout_Elapsed( HwUartChannel_T channel )
 {
-    if ( channel >= HW_UART_CHANNEL_COUNT )
+    HwUartChannelState_T* state   = &hw_uart_channel_states[channel];
+    HwUartRuntimeState_T* runtime = &state->runtime;
+
+    if ( !runtime->rx_running )
     {
-        return false;
+        return;
     }
 
-    HwUartChannelState_T*      state  = &hw_uart_channel_states[channel];
-    const HwUartHardwareMap_T* hw_map = &hw_uart_hardware_map[channel];
-    UART_HandleTypeDef*        huart  = hw_map->uart_handle;
+    uint32_t write_index = HW_UART_Rx_Dma_Write_Index( channel );
 
-    if ( !state->runtime.is_configured_and_initialised || !state->config.rx_enabled )
+    if ( write_index != runtime->rx_timeout_armed_index )
     {
-        return false;
+        return;
     }
 
-    if ( state->runtime.rx_running )
+    uint32_t start_index = runtime->rx_frame_start_index;
+    uint32_t length      = HW_UART_Unread_Bytes_Count_Helper( start_index, write_index );
+
+    if ( length == 0U )
     {
-        return false;
+        return;
     }
 
-    /* Reset RX state and clear stale buffered data before enabling DMA reception. */
-    state->runtime.rx_read_index = 0U;
+    uint32_t head = runtime->rx_frame_head;
 
-    for ( uint32_t i = 0U; i < HW_UART_RX_BUFFER_SIZE; i++ )
+    if ( ( head - runtime->rx_frame_tail ) >= HW_UART_RX_FRAME_QUEUE_DEPTH )
     {
-        state->rx_buffer[i] = 0U;
+        runtime->rx_frames_dropped++;
+        runtime->rx_frame_errors |= ( uint32_t )HW_UART_RX_FRAME_ERROR_MERGED;
     }
-
-    if ( HAL_UART_Receive_DMA( huart, state->rx_buffer, HW_UART_RX_BUFFER_SIZE ) != HAL_OK )
+    else
     {
-        return false;
-    }
+        HwUartRxFrameDescriptor_T* frame =
+            &state->rx_frames[head & ( HW_UART_RX_FRAME_QUEUE_DEPTH - 1U )];
 
-    if ( huart->hdmarx != NULL )
-    {
-        __HAL_DMA_DISABLE_IT( huart->hdmarx, DMA_IT_HT );
-        __HAL_DMA_DISABLE_IT( huart->hdmarx, DMA_IT_TC );
+        frame->offset           = start_index;
+        frame->length_bytes     = length;
+        frame->timestamp_cycles = HW_TIMER_Get_Cycle_Count();
+        frame->error_flags      = runtime->rx_frame_errors;
+
+        runtime->rx_frame_start_index = write_index;
+        runtime->rx_frame_errors      = 0U;
+        runtime->rx_frame_head        = head + 1U;
     }
 
-    state->runtime.rx_running = true;
-    return true;
+    HW_UART_Rx_Record_Boundary( channel, true );
 }
 
-/* Stops the RX DMA for a given channel */
-bool HW_UART_Rx_Stop( HwUartChannel_T channel )
+/**
+ * @brief  Handles a USART interrupt for a DUT channel.
+ *
+ * @param  channel The UART channel whose USART raised the interrupt.
+ *
+ * @return void
+ *
+ * @note   The SR then DR read sequence clears IDLE together with any ORE, NE, FE,
+ *         or PE flag raised through the error interrupt enabled by HAL when RX DMA
+ *         starts. Error flags are latched into the open silence timeout frame. DR
+ *         is read only when IDLE or an error flag is set, so an entry with neither
+ *         cannot take a byte from under RX DMA.
+ *
+ * @note   Without a silence timeout, line idle records a boundary directly. With
+ *         one, line idle samples the DMA write index and either closes the frame
+ *         at once or starts the one-shot timer for the rest of the timeout.
+ */
+static inline void HW_UART_Usart_Irq_Handler( HwUartChannel_T channel )
 {
-    if ( channel >= HW_UART_CHANNEL_COUNT )
+    HwUartChannelState_T* state     = &hw_uart_channel_states[channel];
+    USART_TypeDef*        uart      = hw_uart_hardware_map[channel].uart_instance;
+    const bool            line_idle = ( LL_USART_IsActiveFlag_IDLE( uart ) != 0U );
+    uint32_t              errors    = HW_UART_RX_FRAME_ERROR_NONE;
+
+    if ( LL_USART_IsActiveFlag_PE( uart ) != 0U )
     {
-        return false;
+        errors |= ( uint32_t )HW_UART_RX_FRAME_ERROR_PARITY;
     }
-
-    HwUartChannelState_T*      state  = &hw_uart_channel_states[channel];
-    const HwUartHardwareMap_T* hw_map = &hw_uart_hardware_map[channel];
-    UART_HandleTypeDef*        huart  = hw_map->uart_handle;
-
-    if ( !state->runtime.is_configured_and_initialised || !state->runtime.rx_running )
+    if ( LL_USART_IsActiveFlag_FE( uart ) != 0U )
     {
-        return false;
+        errors |= ( uint32_t )HW_UART_RX_FRAME_ERROR_FRAMING;
+    }
+    if ( LL_USART_IsActiveFlag_NE( uart ) != 0U )
+    {
+        errors |= ( uint32_t )HW_UART_RX_FRAME_ERROR_NOISE;
+    }
+    if ( LL_USART_IsActiveFlag_ORE( uart ) != 0U )
+    {
+        errors |= ( uint32_t )HW_UART_RX_FRAME_ERROR_OVERRUN;
     }
 
-    if ( HAL_UART_AbortReceive( huart ) != HAL_OK )
+    if ( line_idle )
     {
-        return false;
+        LL_USART_ClearFlag_IDLE( uart );
+    }
+    else if ( errors != ( uint32_t )HW_UART_RX_FRAME_ERROR_NONE )
+    {
+        LL_USART_ClearFlag_ORE( uart );
     }
 
-    state->runtime.rx_running    = false;
-    state->runtime.rx_read_index = 0U;
-    return true;
-}
+    state->runtime.rx_frame_errors |= errors;
 
-/* Public Helper to check if Rx is running*/
-bool HW_UART_Rx_Is_Running( HwUartChannel_T channel )
-{
-    if ( channel >= HW_UART_CHANNEL_COUNT )
+    if ( !line_idle )
     {
-        return false;
+        return;
     }
 
-    HwUartChannelState_T* state = &hw_uart_channel_states[channel];
-
-    if ( !state->runtime.is_configured_and_initialised )
+    if ( state->config.rx_timeout_bits == 0U )
     {
-        return false;
+        HW_UART_Rx_Record_Boundary( channel, true );
+        return;
     }
 
-    return state->runtime.rx_running;
+    state->runtime.rx_timeout_armed_index = HW_UART_Rx_Dma_Write_Index( channel );
+
+    if ( state->runtime.rx_timeout_uses_timer )
+    {
+        HW_TIMER_Start_Timer( hw_uart_hardware_map[channel].rx_timeout_timer );
+    }
+    else
+    {
+        HW_UART_Rx_Timeout_Elapsed( channel );
+    }
 }
 
-/*
- * Returns spans into the RX DMA circular buffer containing unread data.
+/**
+ * @brief  Arms RX edge capture for auto-baud detection on the specified channel.
  *
- * Contract:
- * The caller must provide a valid UART channel.
- * The channel must already be configured and RX DMA must be running.
- * The returned spans are transient views into the driver owned RX DMA buffer.
- * Higher layers must copy data if it must persist beyond the current processing step.
+ * @param  channel The UART channel whose RX pin is to be timed.
+ *
+ * @note   This function is used only in the non-hot-path configuration stage and by
+ *         HW_UART_Auto_Baud_Poll() to retry after a failed estimate.
+ *
+ * @note   The edge interrupt is disabled while the capture is reset so a stale edge
+ *         cannot land in the new capture, then enabled on both edges.
  */
-HwUartRxSpans_T HW_UART_Rx_Peek( HwUartChannel_T channel )
+static void HW_UART_Auto_Baud_Arm( HwUartChannel_T channel )
 {
-    HwUartChannelState_T*      state      = &hw_uart_channel_states[channel];
-    const HwUartHardwareMap_T* hw_map     = &hw_uart_hardware_map[channel];
-    uint8_t*                   rx_buffer  = state->rx_buffer;
-    uint32_t                   read_index = state->runtime.rx_read_index;
+    HwUartAutoBaudCapture_T* capture = &hw_uart_channel_states[channel].auto_baud;
+    const GPIOPin_T          rx_pin  = hw_uart_hardware_map[channel].rx_pin;
 
-    /* Derive the current DMA write index from NDTR. */
-    uint32_t dma_remaining   = hw_map->rx_dma_stream->NDTR;
-    uint32_t dma_write_index = HW_UART_RX_BUFFER_SIZE - dma_remaining;
+    HW_GPIO_Configure_Pin_Edge_Interrupt( rx_pin, false );
 
-    if ( dma_write_index == HW_UART_RX_BUFFER_SIZE )
-    {
-        dma_write_index = 0U;
-    }
+    capture->interval_count = 0U;
+    capture->has_reference  = false;
+    capture->state          = HW_UART_AUTO_BAUD_STATE_CAPTURING;
 
-    uint32_t unread_bytes = HW_UART_Unread_Bytes_Count_Helper( read_index, dma_write_index );
+    HW_TIMER_Start_Cycle_Counter();
+    HW_GPIO_Configure_Pin_Edge_Interrupt( rx_pin, true );
 
-    if ( unread_bytes == 0U )
+    NVIC_SetPriority( HW_UART_RX_EDGE_IRQ, HW_UART_USART_IRQ_PRIORITY );
+    NVIC_EnableIRQ( HW_UART_RX_EDGE_IRQ );
+}
+
+/**
+ * @brief  Abandons any auto-baud capture or lock on the specified channel.
+ *
+ * @note   The shared EXTI vector stays enabled, as the other channel may still be
+ *         capturing. With no pin armed it is never entered.
+ */
+static void HW_UART_Auto_Baud_Disarm( HwUartChannel_T channel )
+{
+    HwUartAutoBaudCapture_T* capture = &hw_uart_channel_states[channel].auto_baud;
+
+    if ( capture->state == HW_UART_AUTO_BAUD_STATE_CAPTURING )
     {
-        /* No Data Available */
-        return ( HwUartRxSpans_T ){ .first_span  = { .data = &rx_buffer[0], .length_bytes = 0U },
-                                    .second_span = { .data = &rx_buffer[0], .length_bytes = 0U },
-                                    .total_length_bytes = 0U };
+        HW_GPIO_Configure_Pin_Edge_Interrupt( hw_uart_hardware_map[channel].rx_pin, false );
     }
 
-    if ( dma_write_index >= read_index )
+    capture->state = HW_UART_AUTO_BAUD_STATE_IDLE;
+}
+
+/**
+ * @brief  Rounds an edge-to-edge run to a whole number of bit times.
+ *
+ * @param  run_cycles     Run length in core cycles.
+ * @param  bit_cycles_num Numerator of the bit time in core cycles.
+ * @param  bit_cycles_den Denominator of the bit time, so fractional bit times keep
+ *                        their precision.
+ * @param  tolerance_div  The run must lie within 1 / tolerance_div of a bit from a
+ *                        whole count. 2 accepts any run.
+ *
+ * @return The run length in bits, or 0 if it is outside the tolerance or longer
+ *         than any run inside a character. Such runs include line idle between
+ *         characters and are left out of the estimate.
+ */
+static uint32_t HW_UART_Auto_Baud_Run_Bits( uint32_t run_cycles, uint64_t bit_cycles_num,
+                                            uint64_t bit_cycles_den, uint32_t tolerance_div )
+{
+    uint64_t scaled   = ( uint64_t )run_cycles * bit_cycles_den;
+    uint64_t bits     = ( scaled + ( bit_cycles_num / 2U ) ) / bit_cycles_num;
+    uint64_t nearest  = bits * bit_cycles_num;
+    uint64_t residual = ( scaled > nearest ) ? ( scaled - nearest ) : ( nearest - scaled );
+
+    if ( bits > HW_UART_AUTO_BAUD_MAX_RUN_BITS || ( tolerance_div * residual ) > bit_cycles_num )
     {
-        /* Single contiguous unread region. */
-        return ( HwUartRxSpans_T ){
-            .first_span         = { .data = &rx_buffer[read_index], .length_bytes = unread_bytes },
-            .second_span        = { .data = &rx_buffer[0], .length_bytes = 0U },
-            .total_length_bytes = unread_bytes };
+        return 0U;
     }
 
-    /* Wrapped unread region split into two contiguous spans. */
-    uint32_t first_span_length  = HW_UART_RX_BUFFER_SIZE - read_index;
-    uint32_t second_span_length = unread_bytes - first_span_length;
+    return ( uint32_t )bits;
+}
 
-    return ( HwUartRxSpans_T ){
-        .first_span         = { .data = &rx_buffer[read_index], .length_bytes = first_span_length },
-        .second_span        = { .data = &rx_buffer[0], .length_bytes = second_span_length },
-        .total_length_bytes = unread_bytes };
+/**
+ * @brief  Estimates the DUT baud rate from captured RX edge intervals.
+ *
+ * @param  intervals      Cycle counts between consecutive RX edges.
+ * @param  count          Number of intervals.
+ * @param  cycle_clock_hz Core cycle counter rate.
+ * @param  result         Output receiving the measured and selected rates.
+ *
+ * @return true if enough whole-bit runs were found and the rate is in range.
+ *
+ * @note   Pulses shorter than half the fastest supported bit are glitches. A glitch
+ *         splits one run into three intervals, which are joined back together.
+ *
+ * @note   The runs close to the shortest are taken as single bits, and their mean
+ *         length counts the bits in every run. The bit time averaged over all
+ *         counted runs then recounts them for the final estimate, this time
+ *         leaving out runs more than a quarter bit from a whole count, such as
+ *         idle gaps of arbitrary length.
+ */
+static bool HW_UART_Auto_Baud_Estimate( const uint32_t* intervals, uint32_t count,
+                                        uint32_t cycle_clock_hz, HwUartAutoBaudResult_T* result )
+{
+    uint32_t       runs[HW_UART_AUTO_BAUD_EDGE_INTERVALS];
+    uint32_t       run_count     = 0U;
+    uint32_t       shortest_run  = UINT32_MAX;
+    const uint32_t glitch_cycles = cycle_clock_hz / ( 2U * HW_UART_AUTO_BAUD_MAX_RATE );
+
+    if ( cycle_clock_hz == 0U )
+    {
+        return false;
+    }
+
+    for ( uint32_t i = 0U; i < count; i++ )
+    {
+        if ( intervals[i] >= glitch_cycles )
+        {
+            runs[run_count] = intervals[i];
+            run_count++;
+        }
+        else if ( run_count == 0U )
+        {
+            i++;  // The run after a leading glitch started before the capture
+        }
+        else if ( ( i + 1U ) < count )
+        {
+            runs[run_count - 1U] += intervals[i] + intervals[i + 1U];
+            i++;
+        }
+        else
+        {
+            run_count--;  // The run before a trailing glitch is incomplete
+        }
+    }
+
+    if ( run_count == 0U )
+    {
+        return false;
+    }
+
+    for ( uint32_t i = 0U; i < run_count; i++ )
+    {
+        if ( runs[i] < shortest_run )
+        {
+            shortest_run = runs[i];
+        }
+    }
+
+    /* Average every run short enough to be a single bit, so latency jitter on the
+     * shortest one does not set the unit. Two bit runs are at least 1.75x longer. */
+    uint64_t single_bit_cycles = 0U;
+    uint64_t single_bit_runs   = 0U;
+
+    for ( uint32_t i = 0U; i < run_count; i++ )
+    {
+        if ( ( 4U * ( uint64_t )runs[i] ) < ( 7U * ( uint64_t )shortest_run ) )
+        {
+            single_bit_cycles += runs[i];
+            single_bit_runs++;
+        }
+    }
+
+    uint64_t cycles = 0U;
+    uint64_t bits   = 0U;
+
+    for ( uint32_t i = 0U; i < run_count; i++ )
+    {
+        uint32_t run_bits =
+            HW_UART_Auto_Baud_Run_Bits( runs[i], single_bit_cycles, single_bit_runs, 2U );
+
+        cycles += ( run_bits != 0U ) ? runs[i] : 0U;
+        bits   += run_bits;
+    }
+
+    if ( bits == 0U )
+    {
+        return false;
+    }
+
+    uint64_t refined_cycles = 0U;
+    uint64_t refined_bits   = 0U;
+
+    for ( uint32_t i = 0U; i < run_count; i++ )
+    {
+        uint32_t run_bits = HW_UART_Auto_Baud_Run_Bits( runs[i], cycles, bits, 4U );
+
+        refined_cycles += ( run_bits != 0U ) ? runs[i] : 0U;
+        refined_bits   += run_bits;
+    }
+
+    if ( refined_bits < HW_UART_AUTO_BAUD_MIN_BITS )
+    {
+        return false;
+    }
+
+    uint64_t scaled_bits = ( uint64_t )cycle_clock_hz * refined_bits;
+    uint64_t measured    = ( scaled_bits + ( refined_cycles / 2U ) ) / refined_cycles;
+
+    if ( measured < HW_UART_AUTO_BAUD_MIN_RATE || measured > HW_UART_AUTO_BAUD_MAX_RATE )
+    {
+        return false;
+    }
+
+    uint32_t selected = ( uint32_t )measured;
+    uint64_t best_ppm = HW_UART_AUTO_BAUD_SNAP_PPM;
+
+    for ( uint32_t i = 0U; i < ( sizeof( hw_uart_auto_baud_standard_rates )
+                                 / sizeof( hw_uart_auto_baud_standard_rates[0] ) );
+          i++ )
+    {
+        uint64_t rate = hw_uart_auto_baud_standard_rates[i];
+        uint64_t diff = ( measured > rate ) ? ( measured - rate ) : ( rate - measured );
+        uint64_t ppm  = ( diff * 1000000U ) / rate;
+
+        if ( ppm <= best_ppm )
+        {
+            best_ppm = ppm;
+            selected = ( uint32_t )rate;
+        }
+    }
+
+    result->measured_baud = ( uint32_t )measured;
+    result->selected_baud = selected;
+    result->error_ppm =
+        ( int32_t )( ( ( ( int64_t )measured - ( int64_t )selected ) * 1000000 ) / selected );
+    result->bits_measured = ( uint32_t )refined_bits;
+    return true;
+}
+
+/**
+ * @brief  Records one RX pin edge for auto-baud capture.
+ *
+ * @param  channel     The UART channel whose RX pin changed level.
+ * @param  edge_cycles Core cycle count sampled on entry to the EXTI handler.
+ *
+ * @note   Called from the shared EXTI handler only. Once the interval buffer is full
+ *         the pin's edge interrupt is disabled and the capture is handed to
+ *         HW_UART_Auto_Baud_Poll() for the estimate.
+ */
+static inline void HW_UART_Auto_Baud_Record_Edge( HwUartChannel_T channel, uint32_t edge_cycles )
+{
+    HwUartAutoBaudCapture_T* capture = &hw_uart_channel_states[channel].auto_baud;
+    const GPIOPin_T          rx_pin  = hw_uart_hardware_map[channel].rx_pin;
+
+    if ( capture->state != HW_UART_AUTO_BAUD_STATE_CAPTURING )
+    {
+        return;
+    }
+
+    const bool level = HW_GPIO_Read_Configurable_Pin( rx_pin );
+
+    if ( !capture->has_reference )
+    {
+        capture->has_reference = true;
+    }
+    else if ( level == capture->last_edge_level )
+    {
+        capture->has_reference = false;  // Two edges merged into one interrupt
+    }
+    else
+    {
+        capture->intervals[capture->interval_count] = edge_cycles - capture->last_edge_cycles;
+        capture->interval_count++;
+
+        if ( capture->interval_count == HW_UART_AUTO_BAUD_EDGE_INTERVALS )
+        {
+            HW_GPIO_Configure_Pin_Edge_Interrupt( rx_pin, false );
+            HW_UART_COMPILER_BARRIER();
+            capture->state = HW_UART_AUTO_BAUD_STATE_CAPTURED;
+        }
+    }
+
+    capture->last_edge_cycles = edge_cycles;
+    capture->last_edge_level  = level;
+}
+
+/**-----------------------------------------------------------------------------
+ *  Public Function Definitions
+ *------------------------------------------------------------------------------
+ */
+
+/* Applies validated configuration and resets runtime state. */
+bool HW_UART_Configure_Channel( HwUartChannel_T channel, const HwUartConfig_T* config )
+{
+    if ( channel >= HW_UART_CHANNEL_COUNT )
+    {
+        return false;
+    }
+
+    if ( !HW_UART_Configuration_Is_Valid( config ) )
+    {
+        return false;
+    }
+
+    HwUartChannelState_T* state = &hw_uart_channel_states[channel];
+
+    /* Refuse to reconfigure while RX DMA is active. */
+    if ( state->runtime.rx_running )
+    {
+        return false;
+    }
+    /* Refuse to reconfigure while TX DMA is active or queued data remains. */
+    if ( state->runtime.tx_dma_active || state->runtime.tx_count > 0U
+         || state->runtime.tx_segment_head != state->runtime.tx_segment_tail )
+    {
+        return false;
+    }
+
+    if ( !HW_UART_Apply_Static_Hardware_Selection( channel, config->interface_mode ) )
+    {
+        return false;
+    }
+
+    HW_UART_Auto_Baud_Disarm( channel );
+
+    /* Store the new configuration and reset runtime state. */
+    state->runtime.is_configured_and_initialised = false;
+    state->config                                = *config;
+
+    state->runtime.latched_faults = 0U;
+    state->runtime.rx_read_index  = 0U;
+    state->runtime.rx_running     = false;
+
+    state->runtime.tx_head             = 0U;
+    state->runtime.tx_tail             = 0U;
+    state->runtime.tx_count            = 0U;
+    state->runtime.tx_dma_length_bytes = 0U;
+    state->runtime.tx_dma_active       = false;
+    state->runtime.tx_dma_from_segment = false;
+    state->runtime.tx_segment_offset   = 0U;
+
+    if ( !HW_UART_Init_Channel( channel ) )
+    {
+        return false;
+    }
+
+    /* The rate, and with it the timeout timer, is applied once auto-baud locks. */
+    if ( config->baud_rate == HW_UART_BAUD_RATE_AUTO )
+    {
+        HW_UART_Auto_Baud_Arm( channel );
+        return true;
+    }
+
+    if ( !HW_UART_Rx_Timeout_Timer_Setup( channel ) )
+    {
+        return false;
+    }
+
+    state->runtime.is_configured_and_initialised = true;
+    return true;
+}
+
+/* Estimates and applies the DUT rate once auto-baud capture has completed. */
+HwUartAutoBaudStatus_T HW_UART_Auto_Baud_Poll( HwUartChannel_T         channel,
+                                               HwUartAutoBaudResult_T* result )
+{
+    if ( channel >= HW_UART_CHANNEL_COUNT || result == NULL )
+    {
+        return HW_UART_AUTO_BAUD_INACTIVE;
+    }
+
+    HwUartChannelState_T*    state   = &hw_uart_channel_states[channel];
+    HwUartAutoBaudCapture_T* capture = &state->auto_baud;
+
+    switch ( capture->state )
+    {
+        case HW_UART_AUTO_BAUD_STATE_CAPTURING:
+            return HW_UART_AUTO_BAUD_CAPTURING;
+        case HW_UART_AUTO_BAUD_STATE_LOCKED:
+            *result = capture->result;
+            return HW_UART_AUTO_BAUD_LOCKED;
+        case HW_UART_AUTO_BAUD_STATE_CAPTURED:
+            break;
+        case HW_UART_AUTO_BAUD_STATE_IDLE:
+        default:
+            return HW_UART_AUTO_BAUD_INACTIVE;
+    }
+
+    memset( result, 0, sizeof( *result ) );
+
+    if ( !HW_UART_Auto_Baud_Estimate( capture->intervals, capture->interval_count,
+                                      HW_TIMER_Get_Cycle_Clock_Hz(), result ) )
+    {
+        HW_UART_Auto_Baud_Arm( channel );
+        return HW_UART_AUTO_BAUD_FAILED;
+    }
+
+    state->config.baud_rate = result->selected_baud;
+
+    if ( !HW_UART_Init_Channel( channel ) || !HW_UART_Rx_Timeout_Timer_Setup( channel ) )
+    {
+        capture->state = HW_UART_AUTO_BAUD_STATE_IDLE;
+        return HW_UART_AUTO_BAUD_FAILED;
+    }
+
+    capture->result                              = *result;
+    capture->state                               = HW_UART_AUTO_BAUD_STATE_LOCKED;
+    state->runtime.is_configured_and_initialised = true;
+    return HW_UART_AUTO_BAUD_LOCKED;
+}
+
+/* Starts DMA-backed UART reception for the specified channel. */
+bool HW_UART_Rx_Start( HwUartChannel_T channel )
+{
+    if ( channel >= HW_UART_CHANNEL_COUNT )
+    {
+        return false;
+    }
+
+    HwUartChannelState_T*      state  = &hw_uart_channel_states[channel];
+    const HwUartHardwareMap_T* hw_map = &hw_uart_hardware_map[channel];
+    UART_HandleTypeDef*        huart  = hw_map->uart_handle;
+
+    if ( !state->runtime.is_configured_and_initialised || !state->config.rx_enabled )
+    {
+        return false;
+    }
+
+    if ( state->runtime.rx_running )
+    {
+        return false;
+    }
+
+    /* Reset RX state and clear stale buffered data before enabling DMA reception. */
+    state->runtime.rx_read_index         = 0U;
+    state->runtime.rx_boundary_head      = 0U;
+    state->runtime.rx_boundary_tail      = 0U;
+    state->runtime.rx_boundaries_dropped = 0U;
+
+    state->runtime.rx_timeout_armed_index = 0U;
+    state->runtime.rx_frame_start_index   = 0U;
+    state->runtime.rx_frame_errors        = 0U;
+    state->runtime.rx_frame_head          = 0U;
+    state->runtime.rx_frame_tail          = 0U;
+    state->runtime.rx_frames_dropped      = 0U;
+
+    for ( uint32_t i = 0U; i < HW_UART_RX_BUFFER_SIZE; i++ )
+    {
+        state->rx_buffer[i] = 0U;
+    }
+
+    if ( HAL_UART_Receive_DMA( huart, state->rx_buffer, HW_UART_RX_BUFFER_SIZE ) != HAL_OK )
+    {
+        return false;
+    }
+
+    /* Half and full transfer events bound long bursts before the circular buffer wraps. */
+    if ( huart->hdmarx != NULL )
+    {
+        __HAL_DMA_ENABLE_IT( huart->hdmarx, DMA_IT_HT | DMA_IT_TC );
+    }
+
+    state->runtime.rx_running = true;
+
+    /* Line idle marks the inter-frame gap. Discard an IDLE latched before RX started. */
+    LL_USART_ClearFlag_IDLE( hw_map->uart_instance );
+    LL_USART_EnableIT_IDLE( hw_map->uart_instance );
+
+    NVIC_SetPriority( hw_map->usart_irq, HW_UART_USART_IRQ_PRIORITY );
+    NVIC_EnableIRQ( hw_map->usart_irq );
+
+    return true;
+}
+
+/* Stops the RX DMA for a given channel */
+bool HW_UART_Rx_Stop( HwUartChannel_T channel )
+{
+    if ( channel >= HW_UART_CHANNEL_COUNT )
+    {
+        return false;
+    }
+
+    HwUartChannelState_T*      state  = &hw_uart_channel_states[channel];
+    const HwUartHardwareMap_T* hw_map = &hw_uart_hardware_map[channel];
+    UART_HandleTypeDef*        huart  = hw_map->uart_handle;
+
+    if ( !state->runtime.is_configured_and_initialised || !state->runtime.rx_running )
+    {
+        return false;
+    }
+
+    LL_USART_DisableIT_IDLE( hw_map->uart_instance );
+
+    if ( HAL_UART_AbortReceive( huart ) != HAL_OK )
+    {
+        LL_USART_EnableIT_IDLE( hw_map->uart_instance );
+        return false;
+    }
+
+    if ( state->runtime.rx_timeout_uses_timer )
+    {
+        HW_TIMER_Stop_Timer( hw_map->rx_timeout_timer );
+    }
+
+    state->runtime.rx_running    = false;
+    state->runtime.rx_read_index = 0U;
+    return true;
+}
+
+/* Public Helper to check if Rx is running*/
+bool HW_UART_Rx_Is_Running( HwUartChannel_T channel )
+{
+    if ( channel >= HW_UART_CHANNEL_COUNT )
+    {
+        return false;
+    }
+
+    HwUartChannelState_T* state = &hw_uart_channel_states[channel];
+
+    if ( !state->runtime.is_configured_and_initialised )
+    {
+        return false;
+    }
+
+    return state->runtime.rx_running;
+}
+
+/*
+ * Returns spans into the RX DMA circular buffer containing unread data.
+ *
+ * Contract:
+ * The caller must provide a valid UART channel.
+ * The channel must already be configured and RX DMA must be running.
+ * The returned spans are transient views into the driver owned RX DMA buffer.
+ * Higher layers must copy data if it must persist beyond the current processing step.
+ */
+HwUartRxSpans_T HW_UART_Rx_Peek( HwUartChannel_T channel )
+{
+    HwUartChannelState_T* state      = &hw_uart_channel_states[channel];
+    uint8_t*              rx_buffer  = state->rx_buffer;
+    uint32_t              read_index = state->runtime.rx_read_index;
+
+    /* Derive the current DMA write index from NDTR. */
+    uint32_t dma_write_index = HW_UART_Rx_Dma_Write_Index( channel );
+
+    uint32_t unread_bytes = HW_UART_Unread_Bytes_Count_Helper( read_index, dma_write_index );
+
+    if ( unread_bytes == 0U )
+    {
+        /* No Data Available */
+        return ( HwUartRxSpans_T ){ .first_span  = { .data = &rx_buffer[0], .length_bytes = 0U },
+                                    .second_span = { .data = &rx_buffer[0], .length_bytes = 0U },
+                                    .total_length_bytes = 0U };
+    }
+
+    return HW_UART_Rx_Make_Spans( rx_buffer, read_index, unread_bytes );
 }
 
 /*
@@ -963,6 +1830,147 @@ void HW_UART_Rx_Consume( HwUartChannel_T channel, uint32_t bytes_to_consume )
         HW_UART_Advance_Index_Helper( state->runtime.rx_read_index, bytes_to_consume );
 }
 
+/*
+ * Reports the oldest unread frame delimited by a recorded boundary marker.
+ *
+ * Contract:
+ * The caller must provide a valid UART channel and a non-null frame.
+ * The channel must already be configured and RX DMA must be running.
+ *
+ * A marker is pending while its end index lies within the unread region, i.e.
+ * 0 < (end_index - read_index) <= unread bytes. Older markers have been passed
+ * by HW_UART_Rx_Consume() and are retired from the tail here, which keeps this
+ * function the sole writer of rx_boundary_tail.
+ */
+bool HW_UART_Rx_Peek_Frame( HwUartChannel_T channel, HwUartRxFrame_T* frame )
+{
+    HwUartChannelState_T* state      = &hw_uart_channel_states[channel];
+    HwUartRuntimeState_T* runtime    = &state->runtime;
+    uint32_t              read_index = runtime->rx_read_index;
+    uint32_t              head       = runtime->rx_boundary_head;
+    uint32_t              tail       = runtime->rx_boundary_tail;
+
+    uint32_t unread_bytes =
+        HW_UART_Unread_Bytes_Count_Helper( read_index, HW_UART_Rx_Dma_Write_Index( channel ) );
+
+    /* Retire markers the consumer has already read past. */
+    while ( tail != head )
+    {
+        const HwUartRxBoundary_T* boundary =
+            &state->rx_boundaries[tail & ( HW_UART_RX_BOUNDARY_QUEUE_DEPTH - 1U )];
+        uint32_t distance = HW_UART_Unread_Bytes_Count_Helper( read_index, boundary->end_index );
+
+        if ( distance != 0U && distance <= unread_bytes )
+        {
+            break;
+        }
+
+        tail++;
+    }
+
+    runtime->rx_boundary_tail = tail;
+
+    if ( tail == head )
+    {
+        return false;
+    }
+
+    /* Prefer the first line idle gap; otherwise drain up to the newest transfer marker. */
+    uint32_t chunk_length = 0U;
+
+    for ( uint32_t marker = tail; marker != head; marker++ )
+    {
+        const HwUartRxBoundary_T* boundary =
+            &state->rx_boundaries[marker & ( HW_UART_RX_BOUNDARY_QUEUE_DEPTH - 1U )];
+        uint32_t distance = HW_UART_Unread_Bytes_Count_Helper( read_index, boundary->end_index );
+
+        if ( boundary->line_idle )
+        {
+            frame->length_bytes  = distance;
+            frame->ended_by_idle = true;
+            return true;
+        }
+
+        chunk_length = distance;
+    }
+
+    frame->length_bytes  = chunk_length;
+    frame->ended_by_idle = false;
+    return true;
+}
+
+/* Stores the ISR-context boundary notification hook for a channel. */
+bool HW_UART_Rx_Set_Notify( HwUartChannel_T channel, HwUartRxNotify_T notify )
+{
+    if ( channel >= HW_UART_CHANNEL_COUNT )
+    {
+        return false;
+    }
+
+    hw_uart_channel_states[channel].runtime.rx_notify = notify;
+    return true;
+}
+
+/*
+ * Reports the oldest frame closed by the RX silence timeout.
+ *
+ * Contract:
+ * The caller must provide a valid UART channel and non-null outputs.
+ * The channel must be configured with a silence timeout and RX DMA must be running.
+ *
+ * The descriptor is copied out before the spans are built, so a frame closed by
+ * the timeout interrupt in between does not affect the returned view.
+ */
+bool HW_UART_Rx_Peek_Timeout_Frame( HwUartChannel_T channel, HwUartRxFrameDescriptor_T* descriptor,
+                                    HwUartRxSpans_T* spans )
+{
+    HwUartChannelState_T* state = &hw_uart_channel_states[channel];
+    uint32_t              tail  = state->runtime.rx_frame_tail;
+
+    if ( tail == state->runtime.rx_frame_head )
+    {
+        return false;
+    }
+
+    *descriptor = state->rx_frames[tail & ( HW_UART_RX_FRAME_QUEUE_DEPTH - 1U )];
+    *spans      = HW_UART_Rx_Make_Spans( state->rx_buffer, descriptor->offset,
+                                         descriptor->length_bytes );
+    return true;
+}
+
+/*
+ * Releases the oldest silence timeout frame.
+ *
+ * Contract:
+ * The caller must provide a valid UART channel.
+ *
+ * This function is the sole writer of rx_frame_tail and, in silence timeout mode,
+ * of rx_read_index.
+ */
+void HW_UART_Rx_Release_Timeout_Frame( HwUartChannel_T channel )
+{
+    HwUartChannelState_T* state = &hw_uart_channel_states[channel];
+    uint32_t              tail  = state->runtime.rx_frame_tail;
+
+    if ( tail == state->runtime.rx_frame_head )
+    {
+        return;
+    }
+
+    const HwUartRxFrameDescriptor_T* frame =
+        &state->rx_frames[tail & ( HW_UART_RX_FRAME_QUEUE_DEPTH - 1U )];
+
+    state->runtime.rx_read_index =
+        HW_UART_Advance_Index_Helper( frame->offset, frame->length_bytes );
+    state->runtime.rx_frame_tail = tail + 1U;
+}
+
+/* Timer layer entry point for an elapsed RX silence timeout. */
+void HW_UART_Rx_Timeout_Callback_From_ISR( HwUartChannel_T channel )
+{
+    HW_UART_Rx_Timeout_Elapsed( channel );
+}
+
 /*
  * Copies a complete payload directly into the TX DMA source ring buffer.
  *
@@ -1047,6 +2055,10 @@ bool HW_UART_Tx_Load_Buffer( HwUartChannel_T channel, const uint8_t* data, uint3
  * If queued data wraps around the end of the ring buffer, only the first
  * contiguous span is launched. The wrapped span is launched by the completion
  * handler after the first span completes.
+ *
+ * While zero copy segments are queued, ring bytes are only launched up to the
+ * oldest segment's marker. Once the marker is reached the launch reads the
+ * segment memory directly, at most HW_UART_TX_DMA_MAX_LENGTH bytes at a time.
  */
 bool HW_UART_Tx_Trigger( HwUartChannel_T channel )
 {
@@ -1065,22 +2077,51 @@ bool HW_UART_Tx_Trigger( HwUartChannel_T channel )
         return true;
     }
 
-    /* No queued data exists, so there is no DMA transfer to launch. */
-    if ( state->runtime.tx_count == 0U )
+    uint32_t       ring_length  = state->runtime.tx_count;
+    bool           from_segment = false;
+    const uint8_t* dma_source;
+    uint32_t       dma_length;
+
+    if ( state->runtime.tx_segment_head != state->runtime.tx_segment_tail )
     {
-        HW_UART_Tx_Dma_Irq_Restore( channel, tx_irq_was_enabled );
-        return true;
-    }
+        const HwUartTxSegmentEntry_T* entry =
+            &state->tx_segments[state->runtime.tx_segment_tail
+                                & ( HW_UART_TX_SEGMENT_QUEUE_DEPTH - 1U )];
 
-    uint32_t dma_length = HW_UART_TX_BUFFER_SIZE - state->runtime.tx_tail;
+        /* Only ring bytes loaded before the oldest segment may go first. */
+        ring_length = entry->ring_marker - state->runtime.tx_ring_sent_total;
 
-    if ( dma_length > state->runtime.tx_count )
-    {
-        dma_length = state->runtime.tx_count;
+        if ( ring_length == 0U )
+        {
+            from_segment = true;
+            dma_source   = &entry->data[state->runtime.tx_segment_offset];
+            dma_length   = entry->length_bytes - state->runtime.tx_segment_offset;
+
+            if ( dma_length > HW_UART_TX_DMA_MAX_LENGTH )
+            {
+                dma_length = HW_UART_TX_DMA_MAX_LENGTH;
+            }
+        }
     }
 
-    /* Capture the starting index for the DMA transfer*/
-    uint32_t dma_start_index = state->runtime.tx_tail;
+    if ( !from_segment )
+    {
+        /* No queued data exists, so there is no DMA transfer to launch. */
+        if ( ring_length == 0U )
+        {
+            HW_UART_Tx_Dma_Irq_Restore( channel, tx_irq_was_enabled );
+            return true;
+        }
+
+        dma_length = HW_UART_TX_BUFFER_SIZE - state->runtime.tx_tail;
+
+        if ( dma_length > ring_length )
+        {
+            dma_length = ring_length;
+        }
+
+        dma_source = &state->tx_buffer[state->runtime.tx_tail];
+    }
 
     LL_DMA_DisableStream( tx_dma_controller, tx_ll_stream );
 
@@ -1099,11 +2140,11 @@ bool HW_UART_Tx_Trigger( HwUartChannel_T channel )
 
     state->runtime.tx_dma_length_bytes = dma_length;
     state->runtime.tx_dma_active       = true;
+    state->runtime.tx_dma_from_segment = from_segment;
 
     *( hw_map->tx_dma_ifcr_reg ) = hw_map->tx_dma_ifcr_mask;
 
-    LL_DMA_SetMemoryAddress( tx_dma_controller, tx_ll_stream,
-                             ( uint32_t )( uintptr_t )&state->tx_buffer[dma_start_index] );
+    LL_DMA_SetMemoryAddress( tx_dma_controller, tx_ll_stream, ( uint32_t )( uintptr_t )dma_source );
 
     LL_DMA_SetPeriphAddress( tx_dma_controller, tx_ll_stream,
                              ( uint32_t )( uintptr_t )( &( uart->DR ) ) );
@@ -1125,12 +2166,66 @@ bool HW_UART_Tx_Trigger( HwUartChannel_T channel )
     return true;
 }
 
+/*
+ * Queues zero copy segments behind the ring bytes loaded so far.
+ *
+ * Contract:
+ * The caller must provide a valid UART channel.
+ * count and every segment length must be greater than zero.
+ * The channel must already be configured for TX.
+ * The execution layer is the sole producer for each UART channel.
+ *
+ * Every segment in one submission shares the same ring marker, so they go on air
+ * back to back. Returns false only when the segment queue lacks count free slots.
+ */
+bool HW_UART_Tx_Submit_Zero_Copy( HwUartChannel_T channel, const HwUartTxSegment_T* segments,
+                                  uint32_t count )
+{
+    HwUartChannelState_T* state = &hw_uart_channel_states[channel];
+
+    uint32_t tx_irq_was_enabled = HW_UART_Tx_Dma_Irq_Disable( channel );
+
+    uint32_t head       = state->runtime.tx_segment_head;
+    uint32_t queued     = head - state->runtime.tx_segment_tail;
+    uint32_t free_slots = HW_UART_TX_SEGMENT_QUEUE_DEPTH - queued;
+
+    if ( count > free_slots )
+    {
+        HW_UART_Tx_Dma_Irq_Restore( channel, tx_irq_was_enabled );
+        return false;
+    }
+
+    uint32_t ring_marker = state->runtime.tx_ring_sent_total + state->runtime.tx_count;
+
+    for ( uint32_t i = 0U; i < count; i++ )
+    {
+        HwUartTxSegmentEntry_T* entry =
+            &state->tx_segments[( head + i ) & ( HW_UART_TX_SEGMENT_QUEUE_DEPTH - 1U )];
+
+        entry->data         = segments[i].data;
+        entry->length_bytes = segments[i].length_bytes;
+        entry->ring_marker  = ring_marker;
+    }
+
+    state->runtime.tx_segment_head = head + count;
+
+    HW_UART_Tx_Dma_Irq_Restore( channel, tx_irq_was_enabled );
+
+    return true;
+}
+
+uint32_t HW_UART_Tx_Segments_Retired( HwUartChannel_T channel )
+{
+    return hw_uart_channel_states[channel].runtime.tx_segment_tail;
+}
+
 bool HW_UART_Is_Tx_Complete( HwUartChannel_T channel )
 {
     HwUartRuntimeState_T* runtime = &hw_uart_channel_states[channel].runtime;
     USART_TypeDef*        uart    = hw_uart_hardware_map[channel].uart_instance;
 
-    const bool dma_idle = ( runtime->tx_count == 0U ) && ( runtime->tx_dma_active == false );
+    const bool dma_idle = ( runtime->tx_count == 0U ) && ( runtime->tx_dma_active == false )
+                          && ( runtime->tx_segment_head == runtime->tx_segment_tail );
 
     const bool wire_idle = ( LL_USART_IsActiveFlag_TC( uart ) != 0U );
 
@@ -1220,8 +2315,8 @@ void HW_UART_CH2_TX_DMA_IRQ_HANDLER( void )
  *         HW_UART_CH1_RX_DMA_IRQ_HANDLER macro, which expands to the
  *         device-specific DMA stream IRQ handler, DMA2_Stream2_IRQHandler.
  *
- * @note   RX DMA half-transfer and transfer-complete events are not used by the
- *         polling RX design. They are cleared if they occur unexpectedly.
+ * @note   RX DMA half-transfer and transfer-complete events record a frame
+ *         boundary marker so long bursts are drained before the buffer wraps.
  *
  * @note   RX DMA error handling is intentionally minimal until the UART fault
  *         bitmask is implemented. This handler exists to provide a valid vector,
@@ -1253,11 +2348,13 @@ void HW_UART_CH1_RX_DMA_IRQ_HANDLER( void )
     else if ( LL_DMA_IsActiveFlag_HT2( DMA2 ) )
     {
         *( hw_map->rx_dma_ifcr_reg ) = hw_map->rx_dma_ifcr_mask;
+        HW_UART_Rx_Record_Boundary( HW_UART_CHANNEL_1, false );
     }
 
     else if ( LL_DMA_IsActiveFlag_TC2( DMA2 ) )
     {
         *( hw_map->rx_dma_ifcr_reg ) = hw_map->rx_dma_ifcr_mask;
+        HW_UART_Rx_Record_Boundary( HW_UART_CHANNEL_1, false );
     }
 }
 
@@ -1268,8 +2365,8 @@ void HW_UART_CH1_RX_DMA_IRQ_HANDLER( void )
  *         HW_UART_CH2_RX_DMA_IRQ_HANDLER macro, which expands to the
  *         device-specific DMA stream IRQ handler, DMA1_Stream5_IRQHandler.
  *
- * @note   RX DMA half-transfer and transfer-complete events are not used by the
- *         polling RX design. They are cleared if they occur unexpectedly.
+ * @note   RX DMA half-transfer and transfer-complete events record a frame
+ *         boundary marker so long bursts are drained before the buffer wraps.
  *
  * @note   RX DMA error handling is intentionally minimal until the UART fault
  *         bitmask is implemented. This handler exists to provide a valid vector,
@@ -1301,10 +2398,64 @@ void HW_UART_CH2_RX_DMA_IRQ_HANDLER( void )
     else if ( LL_DMA_IsActiveFlag_HT5( DMA1 ) )
     {
         *( hw_map->rx_dma_ifcr_reg ) = hw_map->rx_dma_ifcr_mask;
+        HW_UART_Rx_Record_Boundary( HW_UART_CHANNEL_2, false );
     }
 
     else if ( LL_DMA_IsActiveFlag_TC5( DMA1 ) )
     {
         *( hw_map->rx_dma_ifcr_reg ) = hw_map->rx_dma_ifcr_mask;
+        HW_UART_Rx_Record_Boundary( HW_UART_CHANNEL_2, false );
     }
-}
\ No newline at end of file
+}
+/**
+ * @brief  USART interrupt service routine for UART Channel 1.
+ *
+ * @note   This function is bound to the MCU interrupt vector via the
+ *         HW_UART_CH1_USART_IRQ_HANDLER macro, which expands to USART6_IRQHandler.
+ *
+ * @note   Line idle records a frame boundary marker one character time after the
+ *         last received byte, so responses are seen without waiting for a poll.
+ *         With an RX silence timeout configured it arms the timeout instead.
+ */
+void HW_UART_CH1_USART_IRQ_HANDLER( void )
+{
+    HW_UART_Usart_Irq_Handler( HW_UART_CHANNEL_1 );
+}
+
+/**
+ * @brief  USART interrupt service routine for UART Channel 2.
+ *
+ * @note   This function is bound to the MCU interrupt vector via the
+ *         HW_UART_CH2_USART_IRQ_HANDLER macro, which expands to USART2_IRQHandler.
+ *
+ * @note   Line idle records a frame boundary marker one character time after the
+ *         last received byte, so responses are seen without waiting for a poll.
+ *         With an RX silence timeout configured it arms the timeout instead.
+ */
+void HW_UART_CH2_USART_IRQ_HANDLER( void )
+{
+    HW_UART_Usart_Irq_Handler( HW_UART_CHANNEL_2 );
+}
+
+/**
+ * @brief  EXTI lines 5 to 9 interrupt service routine, shared by both UART RX pins.
+ *
+ * @note   This function is bound to the MCU interrupt vector via the
+ *         HW_UART_RX_EDGE_IRQ_HANDLER macro, which expands to EXTI9_5_IRQHandler.
+ *
+ * @note   RX pin edge interrupts are only enabled while auto-baud capture is
+ *         pending. The cycle count is sampled first, so the fixed interrupt entry
+ *         latency cancels out of every edge-to-edge interval.
+ */
+void HW_UART_RX_EDGE_IRQ_HANDLER( void )
+{
+    const uint32_t edge_cycles = HW_TIMER_Get_Cycle_Count();
+
+    for ( uint32_t channel = 0U; channel < HW_UART_CHANNEL_COUNT; channel++ )
+    {
+        if ( HW_GPIO_Clear_Edge_Interrupt( hw_uart_hardware_map[channel].rx_pin ) )
+        {
+            HW_UART_Auto_Baud_Record_Edge( ( HwUartChannel_T )channel, edge_cycles );
+        }
+    }
+}
@@ -8,10 +8,16 @@
  *
  *      This module provides:
  *      1. Configuration of UART channels and interface modes.
- *      2. DMA backed continuous RX operation.
- *      3. Efficient access to received data through zero copy RX span views.
- *      4. DMA source TX ring buffering.
- *      5. Normal mode DMA TX pumping over contiguous TX buffer spans.
+ *      2. DMA backed continuous RX operation with line idle and DMA half/full
+ *         transfer frame boundary markers.
+ *      3. Optional inter-character silence timeout framing with a queue of
+ *         frame descriptors (offset, length, timestamp, error flags).
+ *      4. Efficient access to received data through zero copy RX span views.
+ *      5. DMA source TX ring buffering.
+ *      6. Normal mode DMA TX pumping over contiguous TX buffer spans.
+ *      7. RX auto-baud detection from edge timing on the RX pin.
+ *      8. Zero copy TX of caller owned segments (flash or RAM) chained by the
+ *         DMA completion interrupt, for bursts larger than the TX ring buffer.
  *
  *      The low level driver owns the RX DMA circular buffer, the TX DMA source
  *      ring buffer, and all associated buffer management state.
@@ -28,6 +34,12 @@
  *      queued TX data wraps around the end of the TX buffer, the low level driver
  *      transmits it using multiple normal mode DMA launches.
  *
+ *      Bulk TX data (e.g. a firmware image streamed to a DUT bootloader) can
+ *      instead be submitted as a list of zero copy segments. The DMA streams
+ *      directly from the caller's memory, one segment (or 65535 byte piece of
+ *      a segment) per normal mode launch, interleaved in submission order with
+ *      bytes copied into the TX ring buffer.
+ *
  *  Execution path API contract:
  *      Unless stated otherwise, execution path functions assume valid input.
  *      The caller must provide a valid channel, must ensure the channel has been
@@ -52,6 +64,25 @@
  *      4. Copy data if persistence is required.
  *      5. Call HW_UART_Rx_Consume() after processing to advance the read index.
  *
+ *  Typical framed RX usage:
+ *      1. Optionally install a wakeup hook using HW_UART_Rx_Set_Notify().
+ *      2. Start RX using HW_UART_Rx_Start().
+ *      3. On wakeup, call HW_UART_Rx_Peek_Frame() to find the next frame length.
+ *      4. Read that many bytes through HW_UART_Rx_Peek() and consume them.
+ *
+ *  Typical silence timeout RX usage (e.g. Modbus RTU):
+ *      1. Configure the channel with a non-zero rx_timeout_bits.
+ *      2. Start RX using HW_UART_Rx_Start().
+ *      3. On wakeup, call HW_UART_Rx_Peek_Timeout_Frame() to obtain the oldest
+ *         frame descriptor and its zero copy spans.
+ *      4. Call HW_UART_Rx_Release_Timeout_Frame() once the frame is processed.
+ *
+ *  Typical auto-baud usage:
+ *      1. Configure the channel with baud_rate set to HW_UART_BAUD_RATE_AUTO.
+ *      2. Let the DUT transmit a few characters.
+ *      3. Call HW_UART_Auto_Baud_Poll() until it reports LOCKED.
+ *      4. Start RX using HW_UART_Rx_Start() at the detected rate.
+ *
  *  Typical TX usage:
  *      1. Configure channel using HW_UART_Configure_Channel().
  *      2. Queue TX data using HW_UART_Tx_Load_Buffer().
@@ -59,6 +90,12 @@
  *      4. Continue queueing additional TX data while buffer space remains.
  *      5. Treat a false return from HW_UART_Tx_Load_Buffer() as TX buffer capacity
  *         exhaustion or scheduling failure.
+ *
+ *  Typical zero copy TX usage:
+ *      1. Submit one or more segments using HW_UART_Tx_Submit_Zero_Copy().
+ *      2. Call HW_UART_Tx_Trigger() to start the DMA pump if it is idle.
+ *      3. Keep each segment's memory unchanged until HW_UART_Tx_Segments_Retired()
+ *         has advanced past it, then reuse or resubmit it.
  ******************************************************************************/
 
 #ifndef HW_UART_DUT_H
@@ -84,6 +121,32 @@ extern "C"
 
 #define HW_UART_TX_BUFFER_SIZE 256U
 
+/* RX frame boundary queue depth. Must remain a power of 2 for mask-based indexing. */
+#ifndef HW_UART_RX_BOUNDARY_QUEUE_DEPTH
+#define HW_UART_RX_BOUNDARY_QUEUE_DEPTH 32U
+#endif
+
+/* RX silence timeout frame descriptor queue depth. Must remain a power of 2. */
+#ifndef HW_UART_RX_FRAME_QUEUE_DEPTH
+#define HW_UART_RX_FRAME_QUEUE_DEPTH 16U
+#endif
+
+/* Longest supported RX silence timeout in bit times, e.g. 3.5 characters of 11 bits is 39. */
+#define HW_UART_RX_TIMEOUT_MAX_BITS 1024U
+
+/* baud_rate value requesting auto-baud detection from the DUT's RX traffic. */
+#define HW_UART_BAUD_RATE_AUTO 0xFFFFFFFFU
+
+/* RX edge intervals captured before an auto-baud estimate is made. */
+#ifndef HW_UART_AUTO_BAUD_EDGE_INTERVALS
+#define HW_UART_AUTO_BAUD_EDGE_INTERVALS 32U
+#endif
+
+/* Zero copy TX segment queue depth. Must remain a power of 2 for mask-based indexing. */
+#ifndef HW_UART_TX_SEGMENT_QUEUE_DEPTH
+#define HW_UART_TX_SEGMENT_QUEUE_DEPTH 8U
+#endif
+
 /* Number of UART channels supported by the hardware */
 #define HW_UART_CHANNEL_COUNT 2U
 
@@ -175,6 +238,8 @@ typedef struct
 
     bool rx_enabled;  // Enable reception functionality
     bool tx_enabled;  // Enable transmission functionality
+
+    uint32_t rx_timeout_bits;  // RX line silence in bit times that closes a frame, 0 disables
 } HwUartConfig_T;
 
 /**
@@ -207,6 +272,99 @@ typedef struct
     uint32_t total_length_bytes;  // Total number of unread bytes across both spans for convenience
 } HwUartRxSpans_T;
 
+/**
+ * @brief  Describes the oldest unread RX frame delimited by a recorded boundary marker.
+ *
+ * @note   Boundary markers are recorded from interrupt context on USART line idle
+ *         and on RX DMA half-transfer and transfer-complete events. Line idle marks
+ *         a real inter-frame gap. Half and complete transfer markers only bound
+ *         long bursts so that they can be drained before the circular buffer wraps.
+ */
+typedef struct
+{
+    uint32_t length_bytes;   // Unread bytes from the read index up to the boundary
+    bool     ended_by_idle;  // true if the boundary is a USART line idle gap
+} HwUartRxFrame_T;
+
+/**
+ * @brief  Error conditions latched while a silence timeout frame was received.
+ *
+ * @note   Reported as a bitmask in HwUartRxFrameDescriptor_T::error_flags.
+ */
+typedef enum
+{
+    HW_UART_RX_FRAME_ERROR_NONE    = 0U,
+    HW_UART_RX_FRAME_ERROR_PARITY  = ( 1U << 0 ),  // USART parity error
+    HW_UART_RX_FRAME_ERROR_FRAMING = ( 1U << 1 ),  // USART framing error (missing stop bit)
+    HW_UART_RX_FRAME_ERROR_NOISE   = ( 1U << 2 ),  // USART noise detected on a sample
+    HW_UART_RX_FRAME_ERROR_OVERRUN = ( 1U << 3 ),  // USART overrun, at least one byte lost
+    HW_UART_RX_FRAME_ERROR_MERGED  = ( 1U << 4 )   // Descriptor queue was full, so earlier
+                                                   // frames are merged into this one
+} HwUartRxFrameError_T;
+
+/**
+ * @brief  Describes one RX frame delimited by the configured line silence timeout.
+ *
+ * @note   The frame bytes stay in the driver owned RX DMA buffer. offset and
+ *         length_bytes locate them, and HW_UART_Rx_Peek_Timeout_Frame() returns
+ *         the matching zero copy spans alongside the descriptor.
+ */
+typedef struct
+{
+    uint32_t offset;            // RX buffer index of the first frame byte
+    uint32_t length_bytes;      // Number of bytes in the frame
+    uint32_t timestamp_cycles;  // Core cycle count when the silence timeout elapsed
+    uint32_t error_flags;       // HwUartRxFrameError_T bits latched during the frame
+} HwUartRxFrameDescriptor_T;
+
+/**
+ * @brief  Progress of auto-baud detection on a channel.
+ */
+typedef enum
+{
+    HW_UART_AUTO_BAUD_INACTIVE = 0,  // Channel was not configured with HW_UART_BAUD_RATE_AUTO
+    HW_UART_AUTO_BAUD_CAPTURING,     // Waiting for RX edges from the DUT
+    HW_UART_AUTO_BAUD_LOCKED,        // Rate detected and applied to the channel
+    HW_UART_AUTO_BAUD_FAILED         // Captured edges gave no usable rate, capture restarted
+} HwUartAutoBaudStatus_T;
+
+/**
+ * @brief  Outcome of an auto-baud estimate.
+ *
+ * @note   selected_baud is the standard rate nearest to measured_baud when it lies
+ *         within the snap tolerance, otherwise measured_baud itself. error_ppm is
+ *         the DUT's rate error relative to selected_baud.
+ */
+typedef struct
+{
+    uint32_t measured_baud;  // Rate measured from the RX edge timing
+    uint32_t selected_baud;  // Rate the channel is configured with after lock
+    int32_t  error_ppm;      // (measured - selected) / selected in parts per million
+    uint32_t bits_measured;  // Bit times the estimate was averaged over
+} HwUartAutoBaudResult_T;
+
+/**
+ * @brief  One caller owned block of memory to transmit without copying.
+ *
+ * @note   data may point anywhere the DMA controller can read, including the
+ *         internal flash. It is borrowed by the driver from submission until the
+ *         segment is retired, see HW_UART_Tx_Segments_Retired().
+ */
+typedef struct
+{
+    const uint8_t* data;
+    uint32_t       length_bytes;
+} HwUartTxSegment_T;
+
+/**
+ * @brief  Optional RX boundary notification hook.
+ *
+ * @note   Invoked from interrupt context each time a boundary marker is recorded.
+ *         Implementations must be ISR safe, e.g. xTaskNotifyFromISR() to wake a
+ *         waiting task or setting a flag polled by the executor.
+ */
+typedef void ( *HwUartRxNotify_T )( HwUartChannel_T channel );
+
 /**-----------------------------------------------------------------------------
  *  Public Function Prototypes
  *------------------------------------------------------------------------------
@@ -239,9 +397,44 @@ typedef struct
  *
  * @note   This function must be called successfully before invoking
  *         HW_UART_Rx_Start() or any TX-related operations.
+ *
+ * @note   A non-zero rx_timeout_bits longer than one character also programs the
+ *         channel's one-shot RX timeout timer. The F446 USART has no receiver
+ *         timeout block, so the timer extends the one character line idle event
+ *         to the requested silence.
+ *
+ * @note   A baud_rate of HW_UART_BAUD_RATE_AUTO requires rx_enabled. The USART is
+ *         initialised at a probe rate and edge capture is armed on the RX pin, but
+ *         the channel is not usable until HW_UART_Auto_Baud_Poll() reports LOCKED.
  */
 bool HW_UART_Configure_Channel( HwUartChannel_T channel, const HwUartConfig_T* config );
 
+/**
+ * @brief  Advances auto-baud detection and applies the detected rate once known.
+ *
+ * @param  channel The UART channel configured with HW_UART_BAUD_RATE_AUTO.
+ * @param  result  Output receiving the estimate when LOCKED or FAILED is returned.
+ *
+ * @return HW_UART_AUTO_BAUD_INACTIVE if the channel is invalid, result is null,
+ *         or auto-baud was not requested.
+ * @return HW_UART_AUTO_BAUD_CAPTURING while edges are still being captured.
+ * @return HW_UART_AUTO_BAUD_LOCKED once the rate is applied. Later calls keep
+ *         returning LOCKED with the same result until the channel is reconfigured.
+ * @return HW_UART_AUTO_BAUD_FAILED if the captured edges gave no usable rate or the
+ *         USART could not be reinitialised. Capture is re-armed in the first case.
+ *
+ * @note   This function is intended for non-hot-path setup polling. The estimate
+ *         runs here, not in the edge interrupt.
+ *
+ * @note   The F446 USART has no auto-baud hardware. Both edges of the RX pin are
+ *         timestamped with the core cycle counter from EXTI, and the bit time is
+ *         the shortest run between edges refined over all runs of up to ten bits.
+ *         The DUT traffic must therefore contain isolated single bits, which any
+ *         few printable ASCII characters do.
+ */
+HwUartAutoBaudStatus_T HW_UART_Auto_Baud_Poll( HwUartChannel_T         channel,
+                                               HwUartAutoBaudResult_T* result );
+
 /**
  * @brief  Starts UART reception for the specified channel using DMA into the
  *         LL driver owned circular RX buffer.
@@ -270,6 +463,15 @@ bool HW_UART_Configure_Channel( HwUartChannel_T channel, const HwUartConfig_T* c
  *
  * @note   RX operation is considered active once this function returns true, and
  *         can be queried via the runtime state.
+ *
+ * @note   The USART line idle interrupt and the RX DMA half-transfer and
+ *         transfer-complete interrupts are enabled. Each event records a frame
+ *         boundary marker and invokes the hook installed by HW_UART_Rx_Set_Notify().
+ *         The boundary queue is reset on every start.
+ *
+ * @note   With a non-zero rx_timeout_bits, the line idle marker is deferred until
+ *         the full silence timeout has elapsed, and a frame descriptor is queued
+ *         at the same point. The descriptor queue is reset on every start.
  */
 bool HW_UART_Rx_Start( HwUartChannel_T channel );
 
@@ -321,6 +523,98 @@ HwUartRxSpans_T HW_UART_Rx_Peek( HwUartChannel_T channel );
  */
 void HW_UART_Rx_Consume( HwUartChannel_T channel, uint32_t bytes_to_consume );
 
+/**
+ * @brief  Reports the length of the oldest unread RX frame delimited by a boundary marker.
+ *
+ * @param  channel The UART channel to inspect.
+ * @param  frame   Output receiving the frame length and whether it ended on line idle.
+ *
+ * @return true if at least one unread boundary marker is pending.
+ * @return false if no boundary has been recorded past the current read index.
+ *
+ * @note   Execution path function. Assumes valid input.
+ *
+ * @note   Contract:
+ *         The caller must provide a valid UART channel and a non-null frame.
+ *         The channel must already be configured and RX DMA must be running.
+ *
+ * @note   Markers already passed by HW_UART_Rx_Consume() are discarded here, so
+ *         frame and byte based consumption may be mixed freely.
+ *
+ * @note   If a line idle marker is pending, the frame ends at the first one. If
+ *         only half or complete transfer markers are pending, the frame ends at the
+ *         newest of them and ended_by_idle is false.
+ *
+ * @note   The frame bytes are read through HW_UART_Rx_Peek() and released through
+ *         HW_UART_Rx_Consume() as usual.
+ */
+bool HW_UART_Rx_Peek_Frame( HwUartChannel_T channel, HwUartRxFrame_T* frame );
+
+/**
+ * @brief  Installs or clears the RX boundary notification hook for a channel.
+ *
+ * @param  channel The UART channel to update.
+ * @param  notify  Hook to invoke from interrupt context, or NULL to disable.
+ *
+ * @return true if the hook was stored.
+ * @return false if the channel is invalid.
+ *
+ * @note   This function is intended for non-hot-path setup. The hook is kept
+ *         across reconfiguration and RX restart.
+ */
+bool HW_UART_Rx_Set_Notify( HwUartChannel_T channel, HwUartRxNotify_T notify );
+
+/**
+ * @brief  Reports the oldest RX frame closed by the configured line silence timeout.
+ *
+ * @param  channel    The UART channel to inspect.
+ * @param  descriptor Output receiving the frame offset, length, timestamp and error flags.
+ * @param  spans      Output receiving a zero copy view of the frame bytes.
+ *
+ * @return true if a completed frame is queued.
+ * @return false if no frame has been closed since the last release.
+ *
+ * @note   Execution path function. Assumes valid input.
+ *
+ * @note   Contract:
+ *         The caller must provide a valid UART channel and non-null outputs.
+ *         The channel must be configured with a non-zero rx_timeout_bits and RX
+ *         DMA must be running. RX data on the channel must only be released
+ *         through HW_UART_Rx_Release_Timeout_Frame(), not HW_UART_Rx_Consume().
+ *
+ * @note   The descriptor stays queued until it is released, so repeated calls
+ *         return the same frame.
+ */
+bool HW_UART_Rx_Peek_Timeout_Frame( HwUartChannel_T channel, HwUartRxFrameDescriptor_T* descriptor,
+                                    HwUartRxSpans_T* spans );
+
+/**
+ * @brief  Releases the oldest silence timeout frame and its RX buffer bytes.
+ *
+ * @param  channel The UART channel to update.
+ *
+ * @note   Execution path function. Assumes valid input.
+ *
+ * @note   Contract:
+ *         The caller must provide a valid UART channel. Calling this with no
+ *         frame queued has no effect.
+ *
+ * @note   The RX read index is advanced to the end of the released frame.
+ */
+void HW_UART_Rx_Release_Timeout_Frame( HwUartChannel_T channel );
+
+/**
+ * @brief  Completes an RX silence timeout from the channel's one-shot timer ISR.
+ *
+ * @param  channel The UART channel whose RX timeout timer elapsed.
+ *
+ * @note   Invoked by the hardware timer layer only. The timer is armed on each
+ *         USART line idle event for the part of the timeout beyond the one
+ *         character idle detection time. If no byte arrived in the meantime, the
+ *         pending bytes are closed as one frame descriptor.
+ */
+void HW_UART_Rx_Timeout_Callback_From_ISR( HwUartChannel_T channel );
+
 /**
  * @brief  Copies a complete transmit payload into the TX DMA source ring buffer.
  *
@@ -382,11 +676,15 @@ bool HW_UART_Tx_Load_Buffer( HwUartChannel_T channel, const uint8_t* data, uint3
  *         contiguous span is launched. The wrapped span is launched by the DMA
  *         completion handler after the first span completes.
  *
+ * @note   When a zero copy segment is next in line, the launch reads from the
+ *         segment memory instead of the ring buffer, up to the 65535 item DMA
+ *         transfer limit. The completion handler chains the remaining pieces.
+ *
  * @note   If a TX DMA transfer is already active, this function leaves the active
  *         transfer untouched and returns true.
  *
- * @note   If no TX data is queued, this function performs no hardware action and
- *         returns true.
+ * @note   If no TX data or segment is queued, this function performs no hardware
+ *         action and returns true.
  *
  * @note   This implementation does not use HAL for TX transfer setup. It directly
  *         controls the DMA stream and UART DMA request using LL functions and
@@ -394,11 +692,64 @@ bool HW_UART_Tx_Load_Buffer( HwUartChannel_T channel, const uint8_t* data, uint3
  */
 bool HW_UART_Tx_Trigger( HwUartChannel_T channel );
 
+/**
+ * @brief  Queues caller owned segments for zero copy DMA transmission.
+ *
+ * @param  channel The UART channel to transmit on.
+ * @param  segments Array of segments to queue in transmission order.
+ * @param  count Number of entries in segments.
+ *
+ * @return true if all segments were queued.
+ * @return false if fewer than count segment queue slots are free.
+ *
+ * @note   Execution path function. Assumes valid input.
+ *
+ * @note   Contract:
+ *         The caller must provide a valid UART channel.
+ *         count must be greater than zero and every segment length must be
+ *         greater than zero.
+ *         The channel must already be configured for TX.
+ *         The execution layer is the sole producer for each UART channel.
+ *         Segment memory must stay valid and unchanged until retired.
+ *
+ * @note   This function is atomic at the submission level. Either every segment
+ *         is queued or none is.
+ *
+ * @note   Segments are ordered with respect to HW_UART_Tx_Load_Buffer() payloads.
+ *         Ring buffer bytes loaded before the submission are sent first and bytes
+ *         loaded after it are sent once the last segment has been read by DMA.
+ *
+ * @note   A segment longer than the 65535 item DMA transfer limit is sent as
+ *         several launches without further caller involvement.
+ *
+ * @note   Like HW_UART_Tx_Load_Buffer(), this function does not start
+ *         transmission. Call HW_UART_Tx_Trigger() afterwards.
+ */
+bool HW_UART_Tx_Submit_Zero_Copy( HwUartChannel_T channel, const HwUartTxSegment_T* segments,
+                                  uint32_t count );
+
+/**
+ * @brief  Returns the number of zero copy segments the driver has released.
+ *
+ * @param  channel The UART channel to inspect.
+ *
+ * @return Free running count of retired segments since boot.
+ *
+ * @note   Execution path function. Assumes valid input.
+ *
+ * @note   A segment is retired once DMA has read its last byte, or when a TX DMA
+ *         error drops it unsent. Its memory may then be reused. Segments retire
+ *         in submission order, so comparing this count against the number of
+ *         segments submitted identifies which buffers are free.
+ */
+uint32_t HW_UART_Tx_Segments_Retired( HwUartChannel_T channel );
+
 /**
  * @brief Reports whether TX is fully complete for a DUT UART channel.
  *
  * TX is complete only when:
- * 1. The low-level TX DMA source ring buffer has no queued bytes.
+ * 1. The low-level TX DMA source ring buffer has no queued bytes and no zero
+ *    copy segments remain queued.
  * 2. No TX DMA transfer is active.
  * 3. The USART transmission-complete flag is set, indicating that the final
  *    stop bit has left the UART.
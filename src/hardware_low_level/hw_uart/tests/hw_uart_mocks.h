@@ -116,7 +116,15 @@ extern "C"
 #define SET_BIT( REG, BIT ) ( ( REG ) |= ( BIT ) )
 #define CLEAR_BIT( REG, BIT ) ( ( REG ) &= ~( BIT ) )
 
+#define USART_SR_PE ( 1U << 0 )
+#define USART_SR_FE ( 1U << 1 )
+#define USART_SR_NE ( 1U << 2 )
+#define USART_SR_ORE ( 1U << 3 )
+#define USART_SR_IDLE ( 1U << 4 )
 #define USART_SR_TC ( 1U << 6 )
+
+/* USART control bits used by DUT RX line idle tests. */
+#define USART_CR1_IDLEIE ( 1U << 4 )
 /**-----------------------------------------------------------------------------
  *  Public Typedefs / Enums / Structures
  *------------------------------------------------------------------------------
@@ -125,7 +133,11 @@ extern "C"
 typedef enum
 {
     DMA1_Stream6_IRQn = 0,
-    DMA2_Stream6_IRQn = 1
+    DMA2_Stream6_IRQn = 1,
+    USART2_IRQn       = 2,
+    USART6_IRQn       = 3,
+    USART3_IRQn       = 4,
+    EXTI9_5_IRQn      = 5
 } IRQn_Type;
 
 typedef struct
@@ -160,6 +172,7 @@ typedef struct
 {
     DMA_Stream_TypeDef* Instance;
     uint32_t            disabled_interrupt_mask;
+    uint32_t            enabled_interrupt_mask;
 } DMA_HandleTypeDef;
 
 typedef struct
@@ -201,6 +214,15 @@ typedef enum
         }                                                                                          \
     } while ( 0 )
 
+#define __HAL_DMA_ENABLE_IT( __HANDLE__, __INTERRUPT__ )                                           \
+    do                                                                                             \
+    {                                                                                              \
+        if ( ( __HANDLE__ ) != 0 )                                                                 \
+        {                                                                                          \
+            ( __HANDLE__ )->enabled_interrupt_mask |= ( __INTERRUPT__ );                           \
+        }                                                                                          \
+    } while ( 0 )
+
 /**-----------------------------------------------------------------------------
  *  Mock Peripheral Instances
  *------------------------------------------------------------------------------
@@ -275,8 +297,9 @@ HAL_StatusTypeDef HAL_UART_Init( UART_HandleTypeDef* huart );
 HAL_StatusTypeDef HAL_UART_Receive_DMA( UART_HandleTypeDef* huart, uint8_t* pData, uint16_t Size );
 HAL_StatusTypeDef HAL_UART_AbortReceive( UART_HandleTypeDef* huart );
 int               HAL_UART_Receive_IT( UART_HandleTypeDef* huart, uint8_t* data, uint16_t size );
-int  HAL_UART_Transmit( UART_HandleTypeDef* huart, uint8_t* data, uint16_t size, uint32_t timeout );
-void HAL_UART_IRQHandler( UART_HandleTypeDef* huart );
+HAL_StatusTypeDef HAL_UART_Transmit_IT( UART_HandleTypeDef* huart, const uint8_t* data,
+                                        uint16_t size );
+void              HAL_UART_IRQHandler( UART_HandleTypeDef* huart );
 
 /* LL DMA and USART seams used by DUT TX DMA path. */
 void     LL_DMA_DisableStream( DMA_TypeDef* dma, uint32_t stream );
@@ -312,10 +335,24 @@ void LL_USART_DisableDMAReq_TX( USART_TypeDef* usart );
 uint32_t NVIC_GetEnableIRQ( IRQn_Type IRQn );
 void     NVIC_DisableIRQ( IRQn_Type IRQn );
 void     NVIC_EnableIRQ( IRQn_Type IRQn );
+void     NVIC_SetPriority( IRQn_Type IRQn, uint32_t priority );
 
 uint32_t LL_USART_IsActiveFlag_TC( USART_TypeDef* usart );
 void     LL_USART_ClearFlag_TC( USART_TypeDef* usart );
 
+/* LL USART seams used by DUT RX line idle boundary detection. */
+uint32_t LL_USART_IsActiveFlag_IDLE( USART_TypeDef* usart );
+void     LL_USART_ClearFlag_IDLE( USART_TypeDef* usart );
+void     LL_USART_EnableIT_IDLE( USART_TypeDef* usart );
+void     LL_USART_DisableIT_IDLE( USART_TypeDef* usart );
+
+/* LL USART seams used by DUT RX silence timeout frame error latching. */
+uint32_t LL_USART_IsActiveFlag_PE( USART_TypeDef* usart );
+uint32_t LL_USART_IsActiveFlag_FE( USART_TypeDef* usart );
+uint32_t LL_USART_IsActiveFlag_NE( USART_TypeDef* usart );
+uint32_t LL_USART_IsActiveFlag_ORE( USART_TypeDef* usart );
+void     LL_USART_ClearFlag_ORE( USART_TypeDef* usart );
+
 /* NOLINTEND */
 
 #ifdef __cplusplus
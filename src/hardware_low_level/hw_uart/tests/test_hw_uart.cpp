@@ -30,6 +30,7 @@
 
 #include <gtest/gtest.h>
 #include <gmock/gmock.h>
+#include <cmath>
 
 extern "C"
 {
@@ -39,6 +40,8 @@ extern "C"
 #include "hw_uart_mocks.h"
 #include "hw_uart_dut.h"
 #include "hw_uart_console.h"
+#include "hw_timer.h"
+#include "hw_gpio.h"
 }
 
 /**-----------------------------------------------------------------------------
@@ -51,6 +54,7 @@ extern "C"
 
 using ::testing::_;
 using ::testing::DoAll;
+using ::testing::InSequence;
 using ::testing::NiceMock;
 using ::testing::NotNull;
 using ::testing::Return;
@@ -68,7 +72,7 @@ class MockHalUart
     MOCK_METHOD( HAL_StatusTypeDef, ReceiveDMA, ( UART_HandleTypeDef*, uint8_t*, uint16_t ) );
     MOCK_METHOD( HAL_StatusTypeDef, AbortReceive, ( UART_HandleTypeDef* ));
     MOCK_METHOD( int, ReceiveIT, ( UART_HandleTypeDef*, uint8_t*, uint16_t ) );
-    MOCK_METHOD( int, Transmit, ( UART_HandleTypeDef*, uint8_t*, uint16_t, uint32_t ) );
+    MOCK_METHOD( HAL_StatusTypeDef, TransmitIT, ( UART_HandleTypeDef*, const uint8_t*, uint16_t ) );
     MOCK_METHOD( void, IRQHandler, ( UART_HandleTypeDef* ));
 };
 
@@ -80,15 +84,46 @@ DMA_TypeDef fake_dma1 = { 0U, 0U, 0U, 0U };
 DMA_TypeDef fake_dma2 = { 0U, 0U, 0U, 0U };
 }
 
-uint32_t mock_nvic_enabled[2]   = { 1U, 1U };
+uint32_t mock_nvic_enabled[6]   = { 1U, 1U, 0U, 0U, 1U, 0U };
+uint32_t mock_nvic_priority[6]  = { 0U, 0U, 0U, 0U, 0U, 0U };
 uint32_t mock_irq_disable_count = 0U;
 uint32_t mock_irq_enable_count  = 0U;
 
+/* RX boundary notification hook capture. */
+uint32_t        mock_rx_notify_count   = 0U;
+HwUartChannel_T mock_rx_notify_channel = HW_UART_CHANNEL_1;
+
+/* RX silence timeout timer capture. */
+#define TEST_HW_UART_TIMER_CLOCK_HZ 180000000U
+#define TEST_HW_UART_TIMER_COUNT ( UART_CHANNEL_2_TIMER + 1 )
+
+uint32_t mock_timer_configure_count[TEST_HW_UART_TIMER_COUNT] = {};
+uint32_t mock_timer_start_count[TEST_HW_UART_TIMER_COUNT]     = {};
+uint32_t mock_timer_stop_count[TEST_HW_UART_TIMER_COUNT]      = {};
+uint32_t mock_timer_psc                                       = 0U;
+uint32_t mock_timer_arr                                       = 0U;
+uint32_t mock_cycle_count                                     = 0U;
+
+/* USART SR then DR clear sequences, each of which reads DR once. */
+uint32_t mock_usart_dr_reads = 0U;
+
+/* RX pin edge interrupt capture for auto-baud. */
+bool mock_gpio_edge_enabled[GPIO_NUM_PINS] = {};
+bool mock_gpio_edge_pending[GPIO_NUM_PINS] = {};
+bool mock_gpio_level[GPIO_NUM_PINS]        = {};
+
 /**-----------------------------------------------------------------------------
  *  Private Helper Functions
  *------------------------------------------------------------------------------
  */
 
+/* The channel count read through a volatile so the out-of-range value is not folded. */
+static HwUartChannel_T TEST_HW_UART_Invalid_Channel( void )
+{
+    volatile uint32_t invalid_channel = HW_UART_CHANNEL_COUNT;
+    return static_cast<HwUartChannel_T>( invalid_channel );
+}
+
 static HwUartConfig_T TEST_HW_UART_Make_Tx_Rx_Config()
 {
     HwUartConfig_T config = {};
@@ -129,6 +164,27 @@ static HwUartConfig_T TEST_HW_UART_Make_Disabled_Config()
     return config;
 }
 
+/* Modbus RTU style 3.5 character silence at 8N1, rounded up to whole bit times. */
+#define TEST_HW_UART_MODBUS_TIMEOUT_BITS 35U
+
+static HwUartConfig_T TEST_HW_UART_Make_Rx_Timeout_Config( uint32_t rx_timeout_bits )
+{
+    HwUartConfig_T config = TEST_HW_UART_Make_Tx_Rx_Config();
+
+    config.rx_timeout_bits = rx_timeout_bits;
+
+    return config;
+}
+
+static HwUartConfig_T TEST_HW_UART_Make_Auto_Baud_Config()
+{
+    HwUartConfig_T config = TEST_HW_UART_Make_Tx_Rx_Config();
+
+    config.baud_rate = HW_UART_BAUD_RATE_AUTO;
+
+    return config;
+}
+
 static DMA_Stream_TypeDef* TEST_HW_UART_Get_Tx_Stream( DMA_TypeDef* dma, uint32_t stream )
 {
     if ( stream != LL_DMA_STREAM_6 )
@@ -173,6 +229,13 @@ static void TEST_HW_UART_Reset_Dma_Handle( DMA_HandleTypeDef* handle, DMA_Stream
 {
     handle->Instance                = stream;
     handle->disabled_interrupt_mask = 0U;
+    handle->enabled_interrupt_mask  = 0U;
+}
+
+static void TEST_HW_UART_Rx_Notify( HwUartChannel_T channel )
+{
+    mock_rx_notify_count++;
+    mock_rx_notify_channel = channel;
 }
 
 /**-----------------------------------------------------------------------------
@@ -199,6 +262,11 @@ extern "C" void NVIC_EnableIRQ( IRQn_Type IRQn )
     mock_irq_enable_count++;
 }
 
+extern "C" void NVIC_SetPriority( IRQn_Type IRQn, uint32_t priority )
+{
+    mock_nvic_priority[IRQn] = priority;
+}
+
 extern "C" HAL_StatusTypeDef HAL_UART_Init( UART_HandleTypeDef* huart )
 {
     return g_mock_hal->Init( huart );
@@ -220,10 +288,10 @@ extern "C" int HAL_UART_Receive_IT( UART_HandleTypeDef* huart, uint8_t* data, ui
     return g_mock_hal->ReceiveIT( huart, data, size );
 }
 
-extern "C" int HAL_UART_Transmit( UART_HandleTypeDef* huart, uint8_t* data, uint16_t size,
-                                  uint32_t timeout )
+extern "C" HAL_StatusTypeDef HAL_UART_Transmit_IT( UART_HandleTypeDef* huart, const uint8_t* data,
+                                                   uint16_t size )
 {
-    return g_mock_hal->Transmit( huart, data, size, timeout );
+    return g_mock_hal->TransmitIT( huart, data, size );
 }
 
 extern "C" void HAL_UART_IRQHandler( UART_HandleTypeDef* huart )
@@ -477,6 +545,150 @@ extern "C" void LL_USART_ClearFlag_TC( USART_TypeDef* usart )
     }
 }
 
+extern "C" uint32_t LL_USART_IsActiveFlag_IDLE( USART_TypeDef* usart )
+{
+    if ( usart == nullptr )
+    {
+        return 0U;
+    }
+
+    return ( ( usart->SR & USART_SR_IDLE ) != 0U ) ? 1U : 0U;
+}
+
+extern "C" void LL_USART_ClearFlag_IDLE( USART_TypeDef* usart )
+{
+    if ( usart != nullptr )
+    {
+        mock_usart_dr_reads++;
+        /* The SR then DR read sequence also clears the receive error flags. */
+        CLEAR_BIT( usart->SR, USART_SR_IDLE | USART_SR_PE | USART_SR_FE | USART_SR_NE
+                                  | USART_SR_ORE );
+    }
+}
+
+extern "C" void LL_USART_EnableIT_IDLE( USART_TypeDef* usart )
+{
+    if ( usart != nullptr )
+    {
+        SET_BIT( usart->CR1, USART_CR1_IDLEIE );
+    }
+}
+
+extern "C" void LL_USART_DisableIT_IDLE( USART_TypeDef* usart )
+{
+    if ( usart != nullptr )
+    {
+        CLEAR_BIT( usart->CR1, USART_CR1_IDLEIE );
+    }
+}
+
+extern "C" uint32_t LL_USART_IsActiveFlag_PE( USART_TypeDef* usart )
+{
+    if ( usart == nullptr )
+    {
+        return 0U;
+    }
+
+    return ( ( usart->SR & USART_SR_PE ) != 0U ) ? 1U : 0U;
+}
+
+extern "C" uint32_t LL_USART_IsActiveFlag_FE( USART_TypeDef* usart )
+{
+    if ( usart == nullptr )
+    {
+        return 0U;
+    }
+
+    return ( ( usart->SR & USART_SR_FE ) != 0U ) ? 1U : 0U;
+}
+
+extern "C" uint32_t LL_USART_IsActiveFlag_NE( USART_TypeDef* usart )
+{
+    if ( usart == nullptr )
+    {
+        return 0U;
+    }
+
+    return ( ( usart->SR & USART_SR_NE ) != 0U ) ? 1U : 0U;
+}
+
+extern "C" uint32_t LL_USART_IsActiveFlag_ORE( USART_TypeDef* usart )
+{
+    if ( usart == nullptr )
+    {
+        return 0U;
+    }
+
+    return ( ( usart->SR & USART_SR_ORE ) != 0U ) ? 1U : 0U;
+}
+
+extern "C" void LL_USART_ClearFlag_ORE( USART_TypeDef* usart )
+{
+    if ( usart != nullptr )
+    {
+        mock_usart_dr_reads++;
+        /* Same SR then DR read sequence as IDLE; clears every receive error flag. */
+        CLEAR_BIT( usart->SR, USART_SR_PE | USART_SR_FE | USART_SR_NE | USART_SR_ORE );
+    }
+}
+
+extern "C" void HW_TIMER_Configure_Timer( Timer_T timer, uint32_t psc, uint32_t arr )
+{
+    mock_timer_configure_count[timer]++;
+    mock_timer_psc = psc;
+    mock_timer_arr = arr;
+}
+
+extern "C" void HW_TIMER_Start_Timer( Timer_T timer )
+{
+    mock_timer_start_count[timer]++;
+}
+
+extern "C" void HW_TIMER_Stop_Timer( Timer_T timer )
+{
+    mock_timer_stop_count[timer]++;
+}
+
+extern "C" uint32_t HW_TIMER_Get_Clock_Hz( Timer_T timer )
+{
+    ( void )timer;
+    return TEST_HW_UART_TIMER_CLOCK_HZ;
+}
+
+extern "C" void HW_TIMER_Start_Cycle_Counter( void )
+{
+}
+
+extern "C" uint32_t HW_TIMER_Get_Cycle_Count( void )
+{
+    return mock_cycle_count;
+}
+
+extern "C" uint32_t HW_TIMER_Get_Cycle_Clock_Hz( void )
+{
+    return TEST_HW_UART_TIMER_CLOCK_HZ;
+}
+
+extern "C" bool HW_GPIO_Configure_Pin_Edge_Interrupt( GPIOPin_T pin, bool enable )
+{
+    mock_gpio_edge_enabled[pin] = enable;
+    mock_gpio_edge_pending[pin] = false;
+    return true;
+}
+
+extern "C" bool HW_GPIO_Clear_Edge_Interrupt( GPIOPin_T pin )
+{
+    bool pending = mock_gpio_edge_pending[pin];
+
+    mock_gpio_edge_pending[pin] = false;
+    return pending;
+}
+
+extern "C" bool HW_GPIO_Read_Configurable_Pin( GPIOPin_T pin )
+{
+    return mock_gpio_level[pin];
+}
+
 // NOLINTEND
 
 /**-----------------------------------------------------------------------------
@@ -494,6 +706,81 @@ void USART3_IRQHandler( void );
 #include "hw_uart_console.c"
 }
 
+/**-----------------------------------------------------------------------------
+ *  RX Boundary Helpers
+ *------------------------------------------------------------------------------
+ */
+
+/* Positions the channel 1 RX DMA write index by programming the remaining count. */
+static void TEST_HW_UART_Set_Ch1_Rx_Write_Index( uint32_t write_index )
+{
+    DMA2_Stream2->NDTR = TEST_HW_UART_RX_BUFFER_SIZE - write_index;
+}
+
+/* Simulates the DUT going quiet for one character time after the last byte. */
+static void TEST_HW_UART_Ch1_Line_Idle( uint32_t write_index )
+{
+    TEST_HW_UART_Set_Ch1_Rx_Write_Index( write_index );
+    SET_BIT( USART6->SR, USART_SR_IDLE );
+    USART6_IRQHandler();
+}
+
+/**-----------------------------------------------------------------------------
+ *  Auto-baud Helpers
+ *------------------------------------------------------------------------------
+ */
+
+/* Delivers one channel 1 RX pin edge through the shared EXTI vector. */
+static void TEST_HW_UART_Ch1_Rx_Edge( uint32_t cycles, bool level )
+{
+    mock_cycle_count                       = cycles;
+    mock_gpio_level[GPIO_USART6_RX]        = level;
+    mock_gpio_edge_pending[GPIO_USART6_RX] = true;
+    EXTI9_5_IRQHandler();
+}
+
+/*
+ * Drives 8N1 characters onto the channel 1 RX pin as edge interrupts. idle_bits of
+ * idle line follow every stop bit, and each edge is late or early by jitter_cycles
+ * in turn to model interrupt latency. Returns the cycle time after the last idle.
+ */
+static double TEST_HW_UART_Ch1_Send_Chars( const char* text, double baud, double idle_bits,
+                                           double jitter_cycles, double start_cycles )
+{
+    const double bit_cycles = ( double )TEST_HW_UART_TIMER_CLOCK_HZ / baud;
+    double       t          = start_cycles;
+    double       jitter     = jitter_cycles;
+    bool         level      = true;
+
+    for ( const char* c = text; *c != '\0'; c++ )
+    {
+        bool bits[10];
+
+        bits[0] = false;
+        for ( uint32_t b = 0U; b < 8U; b++ )
+        {
+            bits[1U + b] = ( ( ( uint8_t )*c >> b ) & 1U ) != 0U;
+        }
+        bits[9] = true;
+
+        for ( uint32_t i = 0U; i < 10U; i++ )
+        {
+            if ( bits[i] != level )
+            {
+                level = bits[i];
+                TEST_HW_UART_Ch1_Rx_Edge(
+                    ( uint32_t )( uint64_t )std::llround( t + ( i * bit_cycles ) + jitter ),
+                    level );
+                jitter = -jitter;
+            }
+        }
+
+        t += ( 10.0 + idle_bits ) * bit_cycles;
+    }
+
+    return t;
+}
+
 /**-----------------------------------------------------------------------------
  *  Test Fixture
  *------------------------------------------------------------------------------
@@ -517,7 +804,7 @@ class UartTest : public ::testing::Test
                 captured_rx_it_data = data;
                 return HAL_OK;
             } );
-        ON_CALL( mock_hal, Transmit( _, _, _, _ ) ).WillByDefault( Return( HAL_OK ) );
+        ON_CALL( mock_hal, TransmitIT( _, _, _ ) ).WillByDefault( Return( HAL_OK ) );
 
         fake_dma1.LISR  = 0U;
         fake_dma1.HISR  = 0U;
@@ -571,12 +858,33 @@ class UartTest : public ::testing::Test
 
         mock_nvic_enabled[DMA1_Stream6_IRQn] = 1U;
         mock_nvic_enabled[DMA2_Stream6_IRQn] = 1U;
+        mock_nvic_enabled[USART2_IRQn]       = 0U;
+        mock_nvic_enabled[USART6_IRQn]       = 0U;
+        mock_nvic_enabled[USART3_IRQn]       = 1U;
+        mock_nvic_priority[USART2_IRQn]      = 0U;
+        mock_nvic_priority[USART6_IRQn]      = 0U;
         mock_irq_disable_count               = 0U;
         mock_irq_enable_count                = 0U;
+        mock_rx_notify_count                 = 0U;
+        mock_rx_notify_channel               = HW_UART_CHANNEL_1;
+        mock_timer_psc                       = 0U;
+        mock_timer_arr                       = 0U;
+        mock_cycle_count                     = 0U;
+        mock_usart_dr_reads                  = 0U;
+        mock_nvic_enabled[EXTI9_5_IRQn]      = 0U;
+        mock_nvic_priority[EXTI9_5_IRQn]     = 0U;
+
+        memset( mock_timer_configure_count, 0, sizeof( mock_timer_configure_count ) );
+        memset( mock_timer_start_count, 0, sizeof( mock_timer_start_count ) );
+        memset( mock_timer_stop_count, 0, sizeof( mock_timer_stop_count ) );
+        memset( mock_gpio_edge_enabled, 0, sizeof( mock_gpio_edge_enabled ) );
+        memset( mock_gpio_edge_pending, 0, sizeof( mock_gpio_edge_pending ) );
+        memset( mock_gpio_level, 0, sizeof( mock_gpio_level ) );
 
         memset( hw_uart_channel_states, 0, sizeof( hw_uart_channel_states ) );
         memset( &uart_console_state, 0, sizeof( uart_console_state ) );
         memset( uart_console_rx_buffer, 0, sizeof( uart_console_rx_buffer ) );
+        memset( uart_console_tx_buffer, 0, sizeof( uart_console_tx_buffer ) );
 
         uart_console_rx_byte = 0U;
         s_rx_overflow_count  = 0U;
@@ -1255,6 +1563,184 @@ TEST_F( UartTest, DutTxWrapIsSentAsTwoLinearDmaTransfers )
     EXPECT_TRUE( HW_UART_Is_Tx_Complete( HW_UART_CHANNEL_1 ) );
 }
 
+TEST_F( UartTest, DutTxZeroCopyTriggerStreamsFromSegmentMemory )
+{
+    HwUartConfig_T    config      = TEST_HW_UART_Make_Tx_Only_Config();
+    static uint8_t    image[1000] = {};
+    HwUartTxSegment_T segment     = { image, sizeof( image ) };
+
+    ASSERT_TRUE( HW_UART_Configure_Channel( HW_UART_CHANNEL_1, &config ) );
+    ASSERT_TRUE( HW_UART_Tx_Submit_Zero_Copy( HW_UART_CHANNEL_1, &segment, 1U ) );
+    ASSERT_TRUE( HW_UART_Tx_Trigger( HW_UART_CHANNEL_1 ) );
+
+    EXPECT_EQ( DMA2_Stream6->M0AR, ( uint32_t )( uintptr_t )image );
+    EXPECT_EQ( DMA2_Stream6->NDTR, sizeof( image ) );
+    EXPECT_EQ( hw_uart_channel_states[HW_UART_CHANNEL_1].runtime.tx_count, 0U );
+    EXPECT_EQ( HW_UART_Tx_Segments_Retired( HW_UART_CHANNEL_1 ), 0U );
+
+    fake_dma2.HISR |= DMA_HISR_TCIF6;
+    DMA2_Stream6_IRQHandler();
+
+    EXPECT_EQ( HW_UART_Tx_Segments_Retired( HW_UART_CHANNEL_1 ), 1U );
+    EXPECT_FALSE( hw_uart_channel_states[HW_UART_CHANNEL_1].runtime.tx_dma_active );
+
+    SET_BIT( USART6->SR, USART_SR_TC );
+    EXPECT_TRUE( HW_UART_Is_Tx_Complete( HW_UART_CHANNEL_1 ) );
+}
+
+TEST_F( UartTest, DutTxZeroCopySplitsSegmentAtDmaLengthLimit )
+{
+    HwUartConfig_T    config        = TEST_HW_UART_Make_Tx_Only_Config();
+    static uint8_t    image[70000U] = {};
+    HwUartTxSegment_T segment       = { image, sizeof( image ) };
+
+    ASSERT_TRUE( HW_UART_Configure_Channel( HW_UART_CHANNEL_1, &config ) );
+    ASSERT_TRUE( HW_UART_Tx_Submit_Zero_Copy( HW_UART_CHANNEL_1, &segment, 1U ) );
+    ASSERT_TRUE( HW_UART_Tx_Trigger( HW_UART_CHANNEL_1 ) );
+
+    EXPECT_EQ( DMA2_Stream6->M0AR, ( uint32_t )( uintptr_t )image );
+    EXPECT_EQ( DMA2_Stream6->NDTR, 65535U );
+
+    fake_dma2.HISR |= DMA_HISR_TCIF6;
+    DMA2_Stream6_IRQHandler();
+    fake_dma2.HISR = 0U;
+
+    EXPECT_EQ( DMA2_Stream6->M0AR, ( uint32_t )( uintptr_t )&image[65535U] );
+    EXPECT_EQ( DMA2_Stream6->NDTR, sizeof( image ) - 65535U );
+    EXPECT_EQ( HW_UART_Tx_Segments_Retired( HW_UART_CHANNEL_1 ), 0U );
+
+    fake_dma2.HISR |= DMA_HISR_TCIF6;
+    DMA2_Stream6_IRQHandler();
+
+    EXPECT_EQ( HW_UART_Tx_Segments_Retired( HW_UART_CHANNEL_1 ), 1U );
+    EXPECT_FALSE( hw_uart_channel_states[HW_UART_CHANNEL_1].runtime.tx_dma_active );
+}
+
+TEST_F( UartTest, DutTxZeroCopyChainsSegmentsBackToBackFromCompletionInterrupt )
+{
+    HwUartConfig_T    config      = TEST_HW_UART_Make_Tx_Only_Config();
+    static uint8_t    first[300]  = {};
+    static uint8_t    second[40]  = {};
+    static uint8_t    third[5000] = {};
+    HwUartTxSegment_T segments[3] = { { first, sizeof( first ) },
+                                      { second, sizeof( second ) },
+                                      { third, sizeof( third ) } };
+
+    ASSERT_TRUE( HW_UART_Configure_Channel( HW_UART_CHANNEL_1, &config ) );
+    ASSERT_TRUE( HW_UART_Tx_Submit_Zero_Copy( HW_UART_CHANNEL_1, segments, 3U ) );
+    ASSERT_TRUE( HW_UART_Tx_Trigger( HW_UART_CHANNEL_1 ) );
+
+    for ( uint32_t i = 0U; i < 3U; i++ )
+    {
+        EXPECT_EQ( DMA2_Stream6->M0AR, ( uint32_t )( uintptr_t )segments[i].data );
+        EXPECT_EQ( DMA2_Stream6->NDTR, segments[i].length_bytes );
+        EXPECT_NE( DMA2_Stream6->CR & DMA_SxCR_EN, 0U );
+
+        fake_dma2.HISR |= DMA_HISR_TCIF6;
+        DMA2_Stream6_IRQHandler();
+        fake_dma2.HISR = 0U;
+
+        EXPECT_EQ( HW_UART_Tx_Segments_Retired( HW_UART_CHANNEL_1 ), i + 1U );
+    }
+
+    EXPECT_FALSE( hw_uart_channel_states[HW_UART_CHANNEL_1].runtime.tx_dma_active );
+}
+
+TEST_F( UartTest, DutTxZeroCopySegmentsKeepOrderWithRingPayloads )
+{
+    HwUartConfig_T    config     = TEST_HW_UART_Make_Tx_Only_Config();
+    uint8_t           before[3]  = { 0x11U, 0x22U, 0x33U };
+    uint8_t           after[2]   = { 0x44U, 0x55U };
+    static uint8_t    image[600] = {};
+    HwUartTxSegment_T segment    = { image, sizeof( image ) };
+
+    ASSERT_TRUE( HW_UART_Configure_Channel( HW_UART_CHANNEL_1, &config ) );
+    ASSERT_TRUE( HW_UART_Tx_Load_Buffer( HW_UART_CHANNEL_1, before, sizeof( before ) ) );
+    ASSERT_TRUE( HW_UART_Tx_Submit_Zero_Copy( HW_UART_CHANNEL_1, &segment, 1U ) );
+    ASSERT_TRUE( HW_UART_Tx_Load_Buffer( HW_UART_CHANNEL_1, after, sizeof( after ) ) );
+    ASSERT_TRUE( HW_UART_Tx_Trigger( HW_UART_CHANNEL_1 ) );
+
+    /* Ring bytes loaded before the submission go first, and only those. */
+    EXPECT_EQ( DMA2_Stream6->M0AR,
+               ( uint32_t )( uintptr_t )&hw_uart_channel_states[HW_UART_CHANNEL_1].tx_buffer[0] );
+    EXPECT_EQ( DMA2_Stream6->NDTR, sizeof( before ) );
+
+    fake_dma2.HISR |= DMA_HISR_TCIF6;
+    DMA2_Stream6_IRQHandler();
+    fake_dma2.HISR = 0U;
+
+    EXPECT_EQ( DMA2_Stream6->M0AR, ( uint32_t )( uintptr_t )image );
+    EXPECT_EQ( DMA2_Stream6->NDTR, sizeof( image ) );
+
+    fake_dma2.HISR |= DMA_HISR_TCIF6;
+    DMA2_Stream6_IRQHandler();
+    fake_dma2.HISR = 0U;
+
+    EXPECT_EQ( DMA2_Stream6->M0AR,
+               ( uint32_t )( uintptr_t )&hw_uart_channel_states[HW_UART_CHANNEL_1]
+                   .tx_buffer[sizeof( before )] );
+    EXPECT_EQ( DMA2_Stream6->NDTR, sizeof( after ) );
+
+    fake_dma2.HISR |= DMA_HISR_TCIF6;
+    DMA2_Stream6_IRQHandler();
+
+    SET_BIT( USART6->SR, USART_SR_TC );
+    EXPECT_TRUE( HW_UART_Is_Tx_Complete( HW_UART_CHANNEL_1 ) );
+}
+
+TEST_F( UartTest, DutTxZeroCopySubmitIsAllOrNothingWhenQueueLacksSlots )
+{
+    HwUartConfig_T    config                                   = TEST_HW_UART_Make_Tx_Only_Config();
+    static uint8_t    image[16]                                = {};
+    HwUartTxSegment_T segments[HW_UART_TX_SEGMENT_QUEUE_DEPTH] = {};
+
+    for ( uint32_t i = 0U; i < HW_UART_TX_SEGMENT_QUEUE_DEPTH; i++ )
+    {
+        segments[i] = { image, sizeof( image ) };
+    }
+
+    ASSERT_TRUE( HW_UART_Configure_Channel( HW_UART_CHANNEL_1, &config ) );
+    ASSERT_TRUE( HW_UART_Tx_Submit_Zero_Copy( HW_UART_CHANNEL_1, segments,
+                                              HW_UART_TX_SEGMENT_QUEUE_DEPTH - 1U ) );
+
+    EXPECT_FALSE( HW_UART_Tx_Submit_Zero_Copy( HW_UART_CHANNEL_1, segments, 2U ) );
+    EXPECT_EQ( hw_uart_channel_states[HW_UART_CHANNEL_1].runtime.tx_segment_head,
+               HW_UART_TX_SEGMENT_QUEUE_DEPTH - 1U );
+
+    EXPECT_TRUE( HW_UART_Tx_Submit_Zero_Copy( HW_UART_CHANNEL_1, segments, 1U ) );
+}
+
+TEST_F( UartTest, DutTxZeroCopyErrorRetiresQueuedSegmentsUnsent )
+{
+    HwUartConfig_T    config      = TEST_HW_UART_Make_Tx_Only_Config();
+    static uint8_t    image[100]  = {};
+    HwUartTxSegment_T segments[3] = { { image, 10U }, { image, 20U }, { image, 30U } };
+
+    ASSERT_TRUE( HW_UART_Configure_Channel( HW_UART_CHANNEL_1, &config ) );
+    ASSERT_TRUE( HW_UART_Tx_Submit_Zero_Copy( HW_UART_CHANNEL_1, segments, 3U ) );
+    ASSERT_TRUE( HW_UART_Tx_Trigger( HW_UART_CHANNEL_1 ) );
+
+    fake_dma2.HISR |= DMA_HISR_TEIF6;
+    DMA2_Stream6_IRQHandler();
+
+    EXPECT_EQ( HW_UART_Tx_Segments_Retired( HW_UART_CHANNEL_1 ), 3U );
+
+    SET_BIT( USART6->SR, USART_SR_TC );
+    EXPECT_TRUE( HW_UART_Is_Tx_Complete( HW_UART_CHANNEL_1 ) );
+}
+
+TEST_F( UartTest, DutConfigureRefusesWhileZeroCopySegmentsQueued )
+{
+    HwUartConfig_T    config     = TEST_HW_UART_Make_Tx_Only_Config();
+    static uint8_t    image[100] = {};
+    HwUartTxSegment_T segment    = { image, sizeof( image ) };
+
+    ASSERT_TRUE( HW_UART_Configure_Channel( HW_UART_CHANNEL_1, &config ) );
+    ASSERT_TRUE( HW_UART_Tx_Submit_Zero_Copy( HW_UART_CHANNEL_1, &segment, 1U ) );
+
+    EXPECT_FALSE( HW_UART_Configure_Channel( HW_UART_CHANNEL_1, &config ) );
+}
+
 TEST_F( UartTest, ConsoleInitConfiguresUsart3AndArmsRxInterrupt )
 {
     EXPECT_CALL( mock_hal, Init( &huart3 ) ).WillOnce( Return( HAL_OK ) );
@@ -1441,18 +1927,35 @@ TEST_F( UartTest, ConsoleErrorCallbackIgnoresOtherUart )
     HAL_UART_ErrorCallback( &huart6 );
 }
 
-TEST_F( UartTest, ConsoleWriteRejectsNullData )
+TEST_F( UartTest, ConsoleInitRejectsBaudRatesOutsideUsart3Range )
 {
-    ASSERT_TRUE( HW_UART_CONSOLE_Init( 115200U ) );
+    EXPECT_CALL( mock_hal, Init( _ ) ).Times( 0 );
 
-    EXPECT_FALSE( HW_UART_CONSOLE_Write_Blocking( nullptr, 1U, 100U ) );
+    EXPECT_FALSE( HW_UART_CONSOLE_Init( 0U ) );
+    EXPECT_FALSE( HW_UART_CONSOLE_Init( HW_UART_CONSOLE_MAX_BAUD_RATE + 1U ) );
 }
 
-TEST_F( UartTest, ConsoleWriteRejectsBeforeInit )
+TEST_F( UartTest, ConsoleInitAcceptsHighSpeedConsoleBaud )
+{
+    ASSERT_TRUE( HW_UART_CONSOLE_Init( 921600U ) );
+
+    EXPECT_EQ( huart3.Init.BaudRate, 921600U );
+}
+
+TEST_F( UartTest, ConsoleWriteRejectsNullData )
+{
+    ASSERT_TRUE( HW_UART_CONSOLE_Init( 115200U ) );
+
+    EXPECT_FALSE( HW_UART_CONSOLE_Write( nullptr, 1U ) );
+}
+
+TEST_F( UartTest, ConsoleWriteRejectsBeforeInit )
 {
     uint8_t payload[2] = { 'O', 'K' };
 
-    EXPECT_FALSE( HW_UART_CONSOLE_Write_Blocking( payload, sizeof( payload ), 100U ) );
+    EXPECT_CALL( mock_hal, TransmitIT( _, _, _ ) ).Times( 0 );
+
+    EXPECT_FALSE( HW_UART_CONSOLE_Write( payload, sizeof( payload ) ) );
 }
 
 TEST_F( UartTest, ConsoleWriteZeroLengthSucceedsAfterInitWithoutTransmit )
@@ -1461,44 +1964,172 @@ TEST_F( UartTest, ConsoleWriteZeroLengthSucceedsAfterInitWithoutTransmit )
 
     ASSERT_TRUE( HW_UART_CONSOLE_Init( 115200U ) );
 
-    EXPECT_CALL( mock_hal, Transmit( _, _, _, _ ) ).Times( 0 );
+    EXPECT_CALL( mock_hal, TransmitIT( _, _, _ ) ).Times( 0 );
 
-    EXPECT_TRUE( HW_UART_CONSOLE_Write_Blocking( payload, 0U, 100U ) );
+    EXPECT_TRUE( HW_UART_CONSOLE_Write( payload, 0U ) );
 }
 
-TEST_F( UartTest, ConsoleWriteRejectsZeroTimeout )
+TEST_F( UartTest, ConsoleWriteStartsInterruptTransmitFromTxRingWhenIdle )
 {
     uint8_t payload[2] = { 'O', 'K' };
 
     ASSERT_TRUE( HW_UART_CONSOLE_Init( 115200U ) );
 
-    EXPECT_CALL( mock_hal, Transmit( _, _, _, _ ) ).Times( 0 );
+    EXPECT_CALL( mock_hal, TransmitIT( &huart3, &uart_console_tx_buffer[0],
+                                       static_cast<uint16_t>( sizeof( payload ) ) ) )
+        .WillOnce( Return( HAL_OK ) );
+
+    EXPECT_TRUE( HW_UART_CONSOLE_Write( payload, sizeof( payload ) ) );
 
-    EXPECT_FALSE( HW_UART_CONSOLE_Write_Blocking( payload, sizeof( payload ), 0U ) );
+    EXPECT_EQ( uart_console_tx_buffer[0], 'O' );
+    EXPECT_EQ( uart_console_tx_buffer[1], 'K' );
+    EXPECT_TRUE( uart_console_state.tx_active );
 }
 
-TEST_F( UartTest, ConsoleWriteCallsBlockingHalTransmit )
+TEST_F( UartTest, ConsoleWriteMasksConsoleIrqAndRestoresIt )
 {
     uint8_t payload[2] = { 'O', 'K' };
 
     ASSERT_TRUE( HW_UART_CONSOLE_Init( 115200U ) );
 
-    EXPECT_CALL( mock_hal,
-                 Transmit( &huart3, payload, static_cast<uint16_t>( sizeof( payload ) ), 100U ) )
+    EXPECT_TRUE( HW_UART_CONSOLE_Write( payload, sizeof( payload ) ) );
+
+    EXPECT_GT( mock_irq_disable_count, 0U );
+    EXPECT_EQ( mock_irq_enable_count, mock_irq_disable_count );
+    EXPECT_EQ( mock_nvic_enabled[USART3_IRQn], 1U );
+}
+
+TEST_F( UartTest, ConsoleWriteWhileTransmittingOnlyQueues )
+{
+    uint8_t first[2]  = { 'O', 'K' };
+    uint8_t second[3] = { '\r', '\n', '>' };
+
+    ASSERT_TRUE( HW_UART_CONSOLE_Init( 115200U ) );
+
+    EXPECT_CALL( mock_hal, TransmitIT( &huart3, _, _ ) ).WillOnce( Return( HAL_OK ) );
+
+    EXPECT_TRUE( HW_UART_CONSOLE_Write( first, sizeof( first ) ) );
+    EXPECT_TRUE( HW_UART_CONSOLE_Write( second, sizeof( second ) ) );
+
+    EXPECT_EQ( uart_console_state.tx_count, 5U );
+}
+
+TEST_F( UartTest, ConsoleTxCompleteLaunchesNextQueuedSpan )
+{
+    uint8_t first[2]  = { 'O', 'K' };
+    uint8_t second[3] = { '\r', '\n', '>' };
+
+    ASSERT_TRUE( HW_UART_CONSOLE_Init( 115200U ) );
+
+    EXPECT_TRUE( HW_UART_CONSOLE_Write( first, sizeof( first ) ) );
+    EXPECT_TRUE( HW_UART_CONSOLE_Write( second, sizeof( second ) ) );
+
+    EXPECT_CALL( mock_hal, TransmitIT( &huart3, &uart_console_tx_buffer[2], 3U ) )
         .WillOnce( Return( HAL_OK ) );
 
-    EXPECT_TRUE( HW_UART_CONSOLE_Write_Blocking( payload, sizeof( payload ), 100U ) );
+    HAL_UART_TxCpltCallback( &huart3 );
+
+    EXPECT_EQ( uart_console_state.tx_count, 3U );
+    EXPECT_TRUE( uart_console_state.tx_active );
+
+    HAL_UART_TxCpltCallback( &huart3 );
+
+    EXPECT_EQ( uart_console_state.tx_count, 0U );
+    EXPECT_FALSE( uart_console_state.tx_active );
+}
+
+TEST_F( UartTest, ConsoleTxCompleteSplitsWrappedDataIntoTwoSpans )
+{
+    static uint8_t fill[HW_UART_CONSOLE_TX_BUFFER_SIZE - 2U] = {};
+    uint8_t        payload[5] = { 'a', 'b', 'c', 'd', 'e' };
+
+    ASSERT_TRUE( HW_UART_CONSOLE_Init( 115200U ) );
+
+    EXPECT_TRUE( HW_UART_CONSOLE_Write( fill, sizeof( fill ) ) );
+    HAL_UART_TxCpltCallback( &huart3 );
+
+    {
+        InSequence seq;
+
+        EXPECT_CALL( mock_hal, TransmitIT( &huart3, &uart_console_tx_buffer[sizeof( fill )], 2U ) )
+            .WillOnce( Return( HAL_OK ) );
+        EXPECT_CALL( mock_hal, TransmitIT( &huart3, &uart_console_tx_buffer[0], 3U ) )
+            .WillOnce( Return( HAL_OK ) );
+    }
+
+    EXPECT_TRUE( HW_UART_CONSOLE_Write( payload, sizeof( payload ) ) );
+    HAL_UART_TxCpltCallback( &huart3 );
+
+    EXPECT_EQ( uart_console_tx_buffer[sizeof( fill ) + 1U], 'b' );
+    EXPECT_EQ( uart_console_tx_buffer[0], 'c' );
+    EXPECT_EQ( uart_console_tx_buffer[2], 'e' );
 }
 
-TEST_F( UartTest, ConsoleWriteFailsIfHalTransmitFails )
+TEST_F( UartTest, ConsoleWriteDropsBytesBeyondTxRingAndCountsOverflow )
+{
+    static uint8_t         fill[HW_UART_CONSOLE_TX_BUFFER_SIZE + 10U] = {};
+    uint8_t                extra = '!';
+    HwUartConsoleTxStats_T stats = {};
+
+    ASSERT_TRUE( HW_UART_CONSOLE_Init( 115200U ) );
+
+    EXPECT_FALSE( HW_UART_CONSOLE_Write( fill, sizeof( fill ) ) );
+    EXPECT_FALSE( HW_UART_CONSOLE_Write( &extra, 1U ) );
+
+    ASSERT_TRUE( HW_UART_CONSOLE_Get_Tx_Stats( &stats ) );
+    EXPECT_EQ( stats.queued_bytes, HW_UART_CONSOLE_TX_BUFFER_SIZE );
+    EXPECT_EQ( stats.peak_bytes, HW_UART_CONSOLE_TX_BUFFER_SIZE );
+    EXPECT_EQ( stats.dropped_bytes, 11U );
+    EXPECT_EQ( stats.overflow_count, 2U );
+
+    /* Draining the ring makes room again; the peak is kept. */
+    HAL_UART_TxCpltCallback( &huart3 );
+
+    EXPECT_TRUE( HW_UART_CONSOLE_Write( &extra, 1U ) );
+    ASSERT_TRUE( HW_UART_CONSOLE_Get_Tx_Stats( &stats ) );
+    EXPECT_EQ( stats.queued_bytes, 1U );
+    EXPECT_EQ( stats.peak_bytes, HW_UART_CONSOLE_TX_BUFFER_SIZE );
+}
+
+TEST_F( UartTest, ConsoleWriteRetriesWhenHalRefusesTransmit )
+{
+    uint8_t first[2]  = { 'O', 'K' };
+    uint8_t second[1] = { '>' };
+
+    ASSERT_TRUE( HW_UART_CONSOLE_Init( 115200U ) );
+
+    {
+        InSequence seq;
+
+        EXPECT_CALL( mock_hal, TransmitIT( &huart3, &uart_console_tx_buffer[0], 2U ) )
+            .WillOnce( Return( HAL_BUSY ) );
+        EXPECT_CALL( mock_hal, TransmitIT( &huart3, &uart_console_tx_buffer[0], 3U ) )
+            .WillOnce( Return( HAL_OK ) );
+    }
+
+    EXPECT_TRUE( HW_UART_CONSOLE_Write( first, sizeof( first ) ) );
+    EXPECT_FALSE( uart_console_state.tx_active );
+
+    EXPECT_TRUE( HW_UART_CONSOLE_Write( second, sizeof( second ) ) );
+    EXPECT_TRUE( uart_console_state.tx_active );
+}
+
+TEST_F( UartTest, ConsoleTxCompleteIgnoresOtherUart )
 {
     uint8_t payload[2] = { 'O', 'K' };
 
     ASSERT_TRUE( HW_UART_CONSOLE_Init( 115200U ) );
+    EXPECT_TRUE( HW_UART_CONSOLE_Write( payload, sizeof( payload ) ) );
 
-    EXPECT_CALL( mock_hal, Transmit( _, _, _, _ ) ).WillOnce( Return( HAL_ERROR ) );
+    HAL_UART_TxCpltCallback( &huart6 );
 
-    EXPECT_FALSE( HW_UART_CONSOLE_Write_Blocking( payload, sizeof( payload ), 100U ) );
+    EXPECT_EQ( uart_console_state.tx_count, 2U );
+    EXPECT_TRUE( uart_console_state.tx_active );
+}
+
+TEST_F( UartTest, ConsoleGetTxStatsRejectsNull )
+{
+    EXPECT_FALSE( HW_UART_CONSOLE_Get_Tx_Stats( nullptr ) );
 }
 
 TEST_F( UartTest, ConsoleIrqHandlerDispatchesToHal )
@@ -1535,7 +2166,7 @@ TEST_F( UartTest, DutRxDmaChannel1FifoErrorClearsRxStreamFlags )
     EXPECT_EQ( fake_dma2.LIFCR, HW_UART_CH1_DMA_RX_IFCR_MASK );
 }
 
-TEST_F( UartTest, DutRxDmaChannel1UnexpectedHalfTransferClearsRxStreamFlags )
+TEST_F( UartTest, DutRxDmaChannel1HalfTransferClearsRxStreamFlags )
 {
     fake_dma2.LISR |= DMA_LISR_HTIF2;
 
@@ -1544,7 +2175,7 @@ TEST_F( UartTest, DutRxDmaChannel1UnexpectedHalfTransferClearsRxStreamFlags )
     EXPECT_EQ( fake_dma2.LIFCR, HW_UART_CH1_DMA_RX_IFCR_MASK );
 }
 
-TEST_F( UartTest, DutRxDmaChannel1UnexpectedTransferCompleteClearsRxStreamFlags )
+TEST_F( UartTest, DutRxDmaChannel1TransferCompleteClearsRxStreamFlags )
 {
     fake_dma2.LISR |= DMA_LISR_TCIF2;
 
@@ -1580,7 +2211,7 @@ TEST_F( UartTest, DutRxDmaChannel2FifoErrorClearsRxStreamFlags )
     EXPECT_EQ( fake_dma1.HIFCR, HW_UART_CH2_DMA_RX_IFCR_MASK );
 }
 
-TEST_F( UartTest, DutRxDmaChannel2UnexpectedHalfTransferClearsRxStreamFlags )
+TEST_F( UartTest, DutRxDmaChannel2HalfTransferClearsRxStreamFlags )
 {
     fake_dma1.HISR |= DMA_HISR_HTIF5;
 
@@ -1589,7 +2220,7 @@ TEST_F( UartTest, DutRxDmaChannel2UnexpectedHalfTransferClearsRxStreamFlags )
     EXPECT_EQ( fake_dma1.HIFCR, HW_UART_CH2_DMA_RX_IFCR_MASK );
 }
 
-TEST_F( UartTest, DutRxDmaChannel2UnexpectedTransferCompleteClearsRxStreamFlags )
+TEST_F( UartTest, DutRxDmaChannel2TransferCompleteClearsRxStreamFlags )
 {
     fake_dma1.HISR |= DMA_HISR_TCIF5;
 
@@ -1614,7 +2245,7 @@ TEST_F( UartTest, DutRxDmaErrorDoesNotChangeRxRunningStateBeforeFaultPolicyExist
     EXPECT_EQ( fake_dma2.LIFCR, HW_UART_CH1_DMA_RX_IFCR_MASK );
 }
 
-TEST_F( UartTest, DutRxStartChannel1DisablesUnusedRxDmaHalfAndCompleteInterrupts )
+TEST_F( UartTest, DutRxStartChannel1EnablesRxDmaHalfAndCompleteInterrupts )
 {
     HwUartConfig_T config = TEST_HW_UART_Make_Tx_Rx_Config();
 
@@ -1622,11 +2253,12 @@ TEST_F( UartTest, DutRxStartChannel1DisablesUnusedRxDmaHalfAndCompleteInterrupts
     ASSERT_TRUE( HW_UART_Rx_Start( HW_UART_CHANNEL_1 ) );
 
     ASSERT_NE( huart6.hdmarx, nullptr );
-    EXPECT_NE( huart6.hdmarx->disabled_interrupt_mask & DMA_IT_HT, 0U );
-    EXPECT_NE( huart6.hdmarx->disabled_interrupt_mask & DMA_IT_TC, 0U );
+    EXPECT_NE( huart6.hdmarx->enabled_interrupt_mask & DMA_IT_HT, 0U );
+    EXPECT_NE( huart6.hdmarx->enabled_interrupt_mask & DMA_IT_TC, 0U );
+    EXPECT_EQ( huart6.hdmarx->disabled_interrupt_mask & ( DMA_IT_HT | DMA_IT_TC ), 0U );
 }
 
-TEST_F( UartTest, DutRxStartChannel2DisablesUnusedRxDmaHalfAndCompleteInterrupts )
+TEST_F( UartTest, DutRxStartChannel2EnablesRxDmaHalfAndCompleteInterrupts )
 {
     HwUartConfig_T config = TEST_HW_UART_Make_Tx_Rx_Config();
 
@@ -1634,6 +2266,859 @@ TEST_F( UartTest, DutRxStartChannel2DisablesUnusedRxDmaHalfAndCompleteInterrupts
     ASSERT_TRUE( HW_UART_Rx_Start( HW_UART_CHANNEL_2 ) );
 
     ASSERT_NE( huart2.hdmarx, nullptr );
-    EXPECT_NE( huart2.hdmarx->disabled_interrupt_mask & DMA_IT_HT, 0U );
-    EXPECT_NE( huart2.hdmarx->disabled_interrupt_mask & DMA_IT_TC, 0U );
+    EXPECT_NE( huart2.hdmarx->enabled_interrupt_mask & DMA_IT_HT, 0U );
+    EXPECT_NE( huart2.hdmarx->enabled_interrupt_mask & DMA_IT_TC, 0U );
+    EXPECT_EQ( huart2.hdmarx->disabled_interrupt_mask & ( DMA_IT_HT | DMA_IT_TC ), 0U );
+}
+
+TEST_F( UartTest, DutRxStartEnablesLineIdleInterruptAtRxDmaPriority )
+{
+    HwUartConfig_T config = TEST_HW_UART_Make_Tx_Rx_Config();
+
+    SET_BIT( USART6->SR, USART_SR_IDLE );
+
+    ASSERT_TRUE( HW_UART_Configure_Channel( HW_UART_CHANNEL_1, &config ) );
+    ASSERT_TRUE( HW_UART_Rx_Start( HW_UART_CHANNEL_1 ) );
+
+    EXPECT_NE( USART6->CR1 & USART_CR1_IDLEIE, 0U );
+    EXPECT_EQ( USART6->SR & USART_SR_IDLE, 0U );
+    EXPECT_EQ( mock_nvic_enabled[USART6_IRQn], 1U );
+    EXPECT_EQ( mock_nvic_priority[USART6_IRQn], HW_UART_USART_IRQ_PRIORITY );
+    EXPECT_EQ( mock_nvic_enabled[USART2_IRQn], 0U );
+}
+
+TEST_F( UartTest, DutRxStopDisablesLineIdleInterrupt )
+{
+    HwUartConfig_T config = TEST_HW_UART_Make_Tx_Rx_Config();
+
+    ASSERT_TRUE( HW_UART_Configure_Channel( HW_UART_CHANNEL_2, &config ) );
+    ASSERT_TRUE( HW_UART_Rx_Start( HW_UART_CHANNEL_2 ) );
+    ASSERT_TRUE( HW_UART_Rx_Stop( HW_UART_CHANNEL_2 ) );
+
+    EXPECT_EQ( USART2->CR1 & USART_CR1_IDLEIE, 0U );
+}
+
+TEST_F( UartTest, DutRxPeekFrameReportsNothingBeforeAnyBoundary )
+{
+    HwUartConfig_T  config = TEST_HW_UART_Make_Tx_Rx_Config();
+    HwUartRxFrame_T frame  = {};
+
+    ASSERT_TRUE( HW_UART_Configure_Channel( HW_UART_CHANNEL_1, &config ) );
+    ASSERT_TRUE( HW_UART_Rx_Start( HW_UART_CHANNEL_1 ) );
+
+    TEST_HW_UART_Set_Ch1_Rx_Write_Index( 7U );
+
+    EXPECT_FALSE( HW_UART_Rx_Peek_Frame( HW_UART_CHANNEL_1, &frame ) );
+}
+
+TEST_F( UartTest, DutRxLineIdleRecordsFrameBoundaryAndNotifies )
+{
+    HwUartConfig_T  config = TEST_HW_UART_Make_Tx_Rx_Config();
+    HwUartRxFrame_T frame  = {};
+
+    ASSERT_TRUE( HW_UART_Rx_Set_Notify( HW_UART_CHANNEL_2, TEST_HW_UART_Rx_Notify ) );
+    ASSERT_TRUE( HW_UART_Configure_Channel( HW_UART_CHANNEL_2, &config ) );
+    ASSERT_TRUE( HW_UART_Rx_Start( HW_UART_CHANNEL_2 ) );
+
+    DMA1_Stream5->NDTR = TEST_HW_UART_RX_BUFFER_SIZE - 6U;
+    SET_BIT( USART2->SR, USART_SR_IDLE );
+    USART2_IRQHandler();
+
+    EXPECT_EQ( USART2->SR & USART_SR_IDLE, 0U );
+    EXPECT_EQ( mock_rx_notify_count, 1U );
+    EXPECT_EQ( mock_rx_notify_channel, HW_UART_CHANNEL_2 );
+
+    ASSERT_TRUE( HW_UART_Rx_Peek_Frame( HW_UART_CHANNEL_2, &frame ) );
+    EXPECT_EQ( frame.length_bytes, 6U );
+    EXPECT_TRUE( frame.ended_by_idle );
+}
+
+TEST_F( UartTest, DutRxUsartInterruptWithoutIdleRecordsNoBoundary )
+{
+    HwUartConfig_T  config = TEST_HW_UART_Make_Tx_Rx_Config();
+    HwUartRxFrame_T frame  = {};
+
+    ASSERT_TRUE( HW_UART_Rx_Set_Notify( HW_UART_CHANNEL_1, TEST_HW_UART_Rx_Notify ) );
+    ASSERT_TRUE( HW_UART_Configure_Channel( HW_UART_CHANNEL_1, &config ) );
+    ASSERT_TRUE( HW_UART_Rx_Start( HW_UART_CHANNEL_1 ) );
+
+    TEST_HW_UART_Set_Ch1_Rx_Write_Index( 4U );
+    USART6_IRQHandler();
+
+    EXPECT_EQ( mock_rx_notify_count, 0U );
+    EXPECT_FALSE( HW_UART_Rx_Peek_Frame( HW_UART_CHANNEL_1, &frame ) );
+}
+
+TEST_F( UartTest, DutRxBoundaryIsIgnoredWhileRxStopped )
+{
+    HwUartConfig_T config = TEST_HW_UART_Make_Tx_Rx_Config();
+
+    ASSERT_TRUE( HW_UART_Rx_Set_Notify( HW_UART_CHANNEL_1, TEST_HW_UART_Rx_Notify ) );
+    ASSERT_TRUE( HW_UART_Configure_Channel( HW_UART_CHANNEL_1, &config ) );
+
+    TEST_HW_UART_Ch1_Line_Idle( 4U );
+
+    EXPECT_EQ( mock_rx_notify_count, 0U );
+    EXPECT_EQ( hw_uart_channel_states[HW_UART_CHANNEL_1].runtime.rx_boundary_head, 0U );
+}
+
+TEST_F( UartTest, DutRxConsecutiveFramesAreReportedInOrder )
+{
+    HwUartConfig_T  config = TEST_HW_UART_Make_Tx_Rx_Config();
+    HwUartRxFrame_T frame  = {};
+
+    ASSERT_TRUE( HW_UART_Configure_Channel( HW_UART_CHANNEL_1, &config ) );
+    ASSERT_TRUE( HW_UART_Rx_Start( HW_UART_CHANNEL_1 ) );
+
+    TEST_HW_UART_Ch1_Line_Idle( 3U );
+    TEST_HW_UART_Ch1_Line_Idle( 10U );
+
+    ASSERT_TRUE( HW_UART_Rx_Peek_Frame( HW_UART_CHANNEL_1, &frame ) );
+    EXPECT_EQ( frame.length_bytes, 3U );
+    HW_UART_Rx_Consume( HW_UART_CHANNEL_1, frame.length_bytes );
+
+    ASSERT_TRUE( HW_UART_Rx_Peek_Frame( HW_UART_CHANNEL_1, &frame ) );
+    EXPECT_EQ( frame.length_bytes, 7U );
+    HW_UART_Rx_Consume( HW_UART_CHANNEL_1, frame.length_bytes );
+
+    EXPECT_FALSE( HW_UART_Rx_Peek_Frame( HW_UART_CHANNEL_1, &frame ) );
+}
+
+TEST_F( UartTest, DutRxFrameSpanningRingWrapIsMeasuredAcrossTheWrap )
+{
+    HwUartConfig_T  config = TEST_HW_UART_Make_Tx_Rx_Config();
+    HwUartRxFrame_T frame  = {};
+
+    ASSERT_TRUE( HW_UART_Configure_Channel( HW_UART_CHANNEL_1, &config ) );
+    ASSERT_TRUE( HW_UART_Rx_Start( HW_UART_CHANNEL_1 ) );
+
+    /* First frame ends four bytes before the end of the ring. */
+    TEST_HW_UART_Ch1_Line_Idle( TEST_HW_UART_RX_BUFFER_SIZE - 4U );
+    HW_UART_Rx_Consume( HW_UART_CHANNEL_1, TEST_HW_UART_RX_BUFFER_SIZE - 4U );
+
+    /* Second frame wraps: DMA reloads NDTR, fires TC at the wrap, then idles at index 5. */
+    TEST_HW_UART_Set_Ch1_Rx_Write_Index( 0U );
+    fake_dma2.LISR |= DMA_LISR_TCIF2;
+    DMA2_Stream2_IRQHandler();
+    TEST_HW_UART_Ch1_Line_Idle( 5U );
+
+    ASSERT_TRUE( HW_UART_Rx_Peek_Frame( HW_UART_CHANNEL_1, &frame ) );
+    EXPECT_EQ( frame.length_bytes, 9U );
+    EXPECT_TRUE( frame.ended_by_idle );
+
+    HwUartRxSpans_T spans = HW_UART_Rx_Peek( HW_UART_CHANNEL_1 );
+    EXPECT_EQ( spans.first_span.length_bytes, 4U );
+    EXPECT_EQ( spans.second_span.length_bytes, 5U );
+
+    HW_UART_Rx_Consume( HW_UART_CHANNEL_1, frame.length_bytes );
+    EXPECT_FALSE( HW_UART_Rx_Peek_Frame( HW_UART_CHANNEL_1, &frame ) );
+}
+
+TEST_F( UartTest, DutRxHalfTransferBoundsLongBurstWithoutIdle )
+{
+    HwUartConfig_T  config = TEST_HW_UART_Make_Tx_Rx_Config();
+    HwUartRxFrame_T frame  = {};
+
+    ASSERT_TRUE( HW_UART_Rx_Set_Notify( HW_UART_CHANNEL_1, TEST_HW_UART_Rx_Notify ) );
+    ASSERT_TRUE( HW_UART_Configure_Channel( HW_UART_CHANNEL_1, &config ) );
+    ASSERT_TRUE( HW_UART_Rx_Start( HW_UART_CHANNEL_1 ) );
+
+    /* Two bytes arrive during interrupt latency; the marker covers them too. */
+    TEST_HW_UART_Set_Ch1_Rx_Write_Index( ( TEST_HW_UART_RX_BUFFER_SIZE / 2U ) + 2U );
+    fake_dma2.LISR |= DMA_LISR_HTIF2;
+    DMA2_Stream2_IRQHandler();
+
+    EXPECT_EQ( fake_dma2.LIFCR, HW_UART_CH1_DMA_RX_IFCR_MASK );
+    EXPECT_EQ( mock_rx_notify_count, 1U );
+
+    ASSERT_TRUE( HW_UART_Rx_Peek_Frame( HW_UART_CHANNEL_1, &frame ) );
+    EXPECT_EQ( frame.length_bytes, ( TEST_HW_UART_RX_BUFFER_SIZE / 2U ) + 2U );
+    EXPECT_FALSE( frame.ended_by_idle );
+}
+
+TEST_F( UartTest, DutRxPeekFramePrefersIdleGapOverLaterTransferMarker )
+{
+    HwUartConfig_T  config = TEST_HW_UART_Make_Tx_Rx_Config();
+    HwUartRxFrame_T frame  = {};
+
+    ASSERT_TRUE( HW_UART_Configure_Channel( HW_UART_CHANNEL_1, &config ) );
+    ASSERT_TRUE( HW_UART_Rx_Start( HW_UART_CHANNEL_1 ) );
+
+    TEST_HW_UART_Ch1_Line_Idle( 12U );
+
+    TEST_HW_UART_Set_Ch1_Rx_Write_Index( TEST_HW_UART_RX_BUFFER_SIZE / 2U );
+    fake_dma2.LISR |= DMA_LISR_HTIF2;
+    DMA2_Stream2_IRQHandler();
+
+    ASSERT_TRUE( HW_UART_Rx_Peek_Frame( HW_UART_CHANNEL_1, &frame ) );
+    EXPECT_EQ( frame.length_bytes, 12U );
+    EXPECT_TRUE( frame.ended_by_idle );
+}
+
+TEST_F( UartTest, DutRxByteConsumptionRetiresPassedBoundaries )
+{
+    HwUartConfig_T  config = TEST_HW_UART_Make_Tx_Rx_Config();
+    HwUartRxFrame_T frame  = {};
+
+    ASSERT_TRUE( HW_UART_Configure_Channel( HW_UART_CHANNEL_1, &config ) );
+    ASSERT_TRUE( HW_UART_Rx_Start( HW_UART_CHANNEL_1 ) );
+
+    TEST_HW_UART_Ch1_Line_Idle( 4U );
+    TEST_HW_UART_Ch1_Line_Idle( 9U );
+    TEST_HW_UART_Ch1_Line_Idle( 15U );
+
+    /* A plain byte read passes the first boundary and lands inside the second frame. */
+    HW_UART_Rx_Consume( HW_UART_CHANNEL_1, 6U );
+
+    ASSERT_TRUE( HW_UART_Rx_Peek_Frame( HW_UART_CHANNEL_1, &frame ) );
+    EXPECT_EQ( frame.length_bytes, 3U );
+    EXPECT_EQ( hw_uart_channel_states[HW_UART_CHANNEL_1].runtime.rx_boundary_tail, 1U );
+}
+
+TEST_F( UartTest, DutRxBoundaryQueueTracksMarkersAcrossQueueIndexWrap )
+{
+    HwUartConfig_T  config = TEST_HW_UART_Make_Tx_Rx_Config();
+    HwUartRxFrame_T frame  = {};
+    uint32_t        end    = 0U;
+
+    ASSERT_TRUE( HW_UART_Configure_Channel( HW_UART_CHANNEL_1, &config ) );
+    ASSERT_TRUE( HW_UART_Rx_Start( HW_UART_CHANNEL_1 ) );
+
+    for ( uint32_t frame_number = 0U; frame_number < ( 3U * HW_UART_RX_BOUNDARY_QUEUE_DEPTH );
+          frame_number++ )
+    {
+        uint32_t length = ( frame_number % 5U ) + 1U;
+
+        end = ( end + length ) & ( TEST_HW_UART_RX_BUFFER_SIZE - 1U );
+        TEST_HW_UART_Ch1_Line_Idle( end );
+
+        ASSERT_TRUE( HW_UART_Rx_Peek_Frame( HW_UART_CHANNEL_1, &frame ) );
+        EXPECT_EQ( frame.length_bytes, length );
+        HW_UART_Rx_Consume( HW_UART_CHANNEL_1, frame.length_bytes );
+    }
+
+    EXPECT_EQ( hw_uart_channel_states[HW_UART_CHANNEL_1].runtime.rx_boundaries_dropped, 0U );
+}
+
+TEST_F( UartTest, DutRxFullBoundaryQueueDropsMarkerAndMergesFrames )
+{
+    HwUartConfig_T  config = TEST_HW_UART_Make_Tx_Rx_Config();
+    HwUartRxFrame_T frame  = {};
+
+    ASSERT_TRUE( HW_UART_Rx_Set_Notify( HW_UART_CHANNEL_1, TEST_HW_UART_Rx_Notify ) );
+    ASSERT_TRUE( HW_UART_Configure_Channel( HW_UART_CHANNEL_1, &config ) );
+    ASSERT_TRUE( HW_UART_Rx_Start( HW_UART_CHANNEL_1 ) );
+
+    for ( uint32_t marker = 1U; marker <= HW_UART_RX_BOUNDARY_QUEUE_DEPTH + 1U; marker++ )
+    {
+        TEST_HW_UART_Ch1_Line_Idle( 2U * marker );
+    }
+
+    EXPECT_EQ( hw_uart_channel_states[HW_UART_CHANNEL_1].runtime.rx_boundaries_dropped, 1U );
+    EXPECT_EQ( mock_rx_notify_count, HW_UART_RX_BOUNDARY_QUEUE_DEPTH + 1U );
+
+    /* Drain all but the last queued frame; it absorbs the bytes of the dropped marker. */
+    for ( uint32_t marker = 1U; marker < HW_UART_RX_BOUNDARY_QUEUE_DEPTH; marker++ )
+    {
+        ASSERT_TRUE( HW_UART_Rx_Peek_Frame( HW_UART_CHANNEL_1, &frame ) );
+        HW_UART_Rx_Consume( HW_UART_CHANNEL_1, frame.length_bytes );
+    }
+
+    ASSERT_TRUE( HW_UART_Rx_Peek_Frame( HW_UART_CHANNEL_1, &frame ) );
+    EXPECT_EQ( frame.length_bytes, 2U );
+    HW_UART_Rx_Consume( HW_UART_CHANNEL_1, frame.length_bytes );
+
+    EXPECT_FALSE( HW_UART_Rx_Peek_Frame( HW_UART_CHANNEL_1, &frame ) );
+    EXPECT_EQ( HW_UART_Rx_Peek( HW_UART_CHANNEL_1 ).total_length_bytes, 2U );
+}
+
+TEST_F( UartTest, DutRxStartResetsBoundaryQueue )
+{
+    HwUartConfig_T  config = TEST_HW_UART_Make_Tx_Rx_Config();
+    HwUartRxFrame_T frame  = {};
+
+    ASSERT_TRUE( HW_UART_Configure_Channel( HW_UART_CHANNEL_1, &config ) );
+    ASSERT_TRUE( HW_UART_Rx_Start( HW_UART_CHANNEL_1 ) );
+
+    TEST_HW_UART_Ch1_Line_Idle( 8U );
+
+    ASSERT_TRUE( HW_UART_Rx_Stop( HW_UART_CHANNEL_1 ) );
+    ASSERT_TRUE( HW_UART_Rx_Start( HW_UART_CHANNEL_1 ) );
+
+    TEST_HW_UART_Set_Ch1_Rx_Write_Index( 8U );
+    EXPECT_FALSE( HW_UART_Rx_Peek_Frame( HW_UART_CHANNEL_1, &frame ) );
+}
+
+TEST_F( UartTest, DutRxSetNotifyRejectsInvalidChannel )
+{
+    EXPECT_FALSE( HW_UART_Rx_Set_Notify( TEST_HW_UART_Invalid_Channel(), TEST_HW_UART_Rx_Notify ) );
+}
+
+TEST_F( UartTest, DutPrivateConfigurationRejectsRxTimeoutAboveMaximum )
+{
+    HwUartConfig_T config = TEST_HW_UART_Make_Rx_Timeout_Config( HW_UART_RX_TIMEOUT_MAX_BITS );
+
+    EXPECT_TRUE( HW_UART_Configuration_Is_Valid( &config ) );
+
+    config.rx_timeout_bits = HW_UART_RX_TIMEOUT_MAX_BITS + 1U;
+
+    EXPECT_FALSE( HW_UART_Configuration_Is_Valid( &config ) );
+}
+
+TEST_F( UartTest, DutPrivateConfigurationRejectsDisabledConfigWithRxTimeout )
+{
+    HwUartConfig_T config = TEST_HW_UART_Make_Disabled_Config();
+
+    config.rx_timeout_bits = TEST_HW_UART_MODBUS_TIMEOUT_BITS;
+
+    EXPECT_FALSE( HW_UART_Configuration_Is_Valid( &config ) );
+}
+
+TEST_F( UartTest, DutConfigureProgramsRxTimeoutTimerForSilenceBeyondLineIdle )
+{
+    HwUartConfig_T config = TEST_HW_UART_Make_Rx_Timeout_Config( TEST_HW_UART_MODBUS_TIMEOUT_BITS );
+
+    ASSERT_TRUE( HW_UART_Configure_Channel( HW_UART_CHANNEL_1, &config ) );
+
+    /* 35 - 10 bit idle detection = 25 bits at 115200 baud = 39062.5 ticks at 180 MHz. */
+    EXPECT_EQ( mock_timer_configure_count[UART_CHANNEL_1_TIMER], 1U );
+    EXPECT_EQ( mock_timer_psc, 0U );
+    EXPECT_EQ( mock_timer_arr, 39062U );
+    EXPECT_TRUE( hw_uart_channel_states[HW_UART_CHANNEL_1].runtime.rx_timeout_uses_timer );
+}
+
+TEST_F( UartTest, DutConfigureScalesRxTimeoutTimerPrescalerAtLowBaud )
+{
+    HwUartConfig_T config = TEST_HW_UART_Make_Rx_Timeout_Config( 39U );
+
+    config.baud_rate   = 1200U;
+    config.word_length = HW_UART_WORD_LENGTH_9_BITS;
+    config.parity      = HW_UART_PARITY_EVEN;
+
+    ASSERT_TRUE( HW_UART_Configure_Channel( HW_UART_CHANNEL_2, &config ) );
+
+    /* 39 - 11 = 28 bits at 1200 baud is 4200000 ticks; 65 x 64616 covers it. */
+    EXPECT_EQ( mock_timer_configure_count[UART_CHANNEL_2_TIMER], 1U );
+    EXPECT_EQ( mock_timer_psc, 64U );
+    EXPECT_EQ( mock_timer_arr, 64615U );
+}
+
+TEST_F( UartTest, DutConfigureRejectsRxTimeoutBeyondTimerRange )
+{
+    HwUartConfig_T config = TEST_HW_UART_Make_Rx_Timeout_Config( HW_UART_RX_TIMEOUT_MAX_BITS );
+
+    config.baud_rate = 1U;
+
+    EXPECT_FALSE( HW_UART_Configure_Channel( HW_UART_CHANNEL_1, &config ) );
+    EXPECT_FALSE( HW_UART_Rx_Start( HW_UART_CHANNEL_1 ) );
+}
+
+TEST_F( UartTest, DutRxTimeoutWithinLineIdleClosesFrameWithoutTimer )
+{
+    HwUartConfig_T            config = TEST_HW_UART_Make_Rx_Timeout_Config( 10U );
+    HwUartRxFrameDescriptor_T frame  = {};
+    HwUartRxSpans_T           spans  = {};
+
+    ASSERT_TRUE( HW_UART_Configure_Channel( HW_UART_CHANNEL_1, &config ) );
+    ASSERT_TRUE( HW_UART_Rx_Start( HW_UART_CHANNEL_1 ) );
+
+    TEST_HW_UART_Ch1_Line_Idle( 6U );
+
+    EXPECT_EQ( mock_timer_configure_count[UART_CHANNEL_1_TIMER], 0U );
+    EXPECT_EQ( mock_timer_start_count[UART_CHANNEL_1_TIMER], 0U );
+    ASSERT_TRUE( HW_UART_Rx_Peek_Timeout_Frame( HW_UART_CHANNEL_1, &frame, &spans ) );
+    EXPECT_EQ( frame.length_bytes, 6U );
+}
+
+TEST_F( UartTest, DutRxLineIdleArmsTimeoutAndElapsedTimeoutQueuesFrame )
+{
+    HwUartConfig_T config = TEST_HW_UART_Make_Rx_Timeout_Config( TEST_HW_UART_MODBUS_TIMEOUT_BITS );
+    HwUartRxFrameDescriptor_T frame = {};
+    HwUartRxSpans_T           spans = {};
+    HwUartRxFrame_T           boundary = {};
+
+    ASSERT_TRUE( HW_UART_Rx_Set_Notify( HW_UART_CHANNEL_1, TEST_HW_UART_Rx_Notify ) );
+    ASSERT_TRUE( HW_UART_Configure_Channel( HW_UART_CHANNEL_1, &config ) );
+    ASSERT_TRUE( HW_UART_Rx_Start( HW_UART_CHANNEL_1 ) );
+
+    hw_uart_channel_states[HW_UART_CHANNEL_1].rx_buffer[0] = 0x11U;
+    hw_uart_channel_states[HW_UART_CHANNEL_1].rx_buffer[4] = 0x55U;
+
+    TEST_HW_UART_Ch1_Line_Idle( 5U );
+
+    /* One character of idle is not yet a frame gap. */
+    EXPECT_EQ( mock_timer_start_count[UART_CHANNEL_1_TIMER], 1U );
+    EXPECT_FALSE( HW_UART_Rx_Peek_Timeout_Frame( HW_UART_CHANNEL_1, &frame, &spans ) );
+    EXPECT_FALSE( HW_UART_Rx_Peek_Frame( HW_UART_CHANNEL_1, &boundary ) );
+    EXPECT_EQ( mock_rx_notify_count, 0U );
+
+    mock_cycle_count = 4242U;
+    HW_UART_Rx_Timeout_Callback_From_ISR( HW_UART_CHANNEL_1 );
+
+    ASSERT_TRUE( HW_UART_Rx_Peek_Timeout_Frame( HW_UART_CHANNEL_1, &frame, &spans ) );
+    EXPECT_EQ( frame.offset, 0U );
+    EXPECT_EQ( frame.length_bytes, 5U );
+    EXPECT_EQ( frame.timestamp_cycles, 4242U );
+    EXPECT_EQ( frame.error_flags, ( uint32_t )HW_UART_RX_FRAME_ERROR_NONE );
+    EXPECT_EQ( spans.total_length_bytes, 5U );
+    EXPECT_EQ( spans.first_span.data[0], 0x11U );
+    EXPECT_EQ( spans.first_span.data[4], 0x55U );
+    EXPECT_EQ( mock_rx_notify_count, 1U );
+
+    /* The line idle boundary is deferred to the timeout as well. */
+    ASSERT_TRUE( HW_UART_Rx_Peek_Frame( HW_UART_CHANNEL_1, &boundary ) );
+    EXPECT_EQ( boundary.length_bytes, 5U );
+    EXPECT_TRUE( boundary.ended_by_idle );
+}
+
+TEST_F( UartTest, DutRxByteInsideTimeoutWindowKeepsFrameOpen )
+{
+    HwUartConfig_T config = TEST_HW_UART_Make_Rx_Timeout_Config( TEST_HW_UART_MODBUS_TIMEOUT_BITS );
+    HwUartRxFrameDescriptor_T frame = {};
+    HwUartRxSpans_T           spans = {};
+
+    ASSERT_TRUE( HW_UART_Configure_Channel( HW_UART_CHANNEL_1, &config ) );
+    ASSERT_TRUE( HW_UART_Rx_Start( HW_UART_CHANNEL_1 ) );
+
+    /* A 1.5 character inter-byte gap trips line idle but not the 3.5 character timeout. */
+    TEST_HW_UART_Ch1_Line_Idle( 4U );
+    TEST_HW_UART_Set_Ch1_Rx_Write_Index( 6U );
+    HW_UART_Rx_Timeout_Callback_From_ISR( HW_UART_CHANNEL_1 );
+
+    EXPECT_FALSE( HW_UART_Rx_Peek_Timeout_Frame( HW_UART_CHANNEL_1, &frame, &spans ) );
+
+    TEST_HW_UART_Ch1_Line_Idle( 9U );
+    HW_UART_Rx_Timeout_Callback_From_ISR( HW_UART_CHANNEL_1 );
+
+    EXPECT_EQ( mock_timer_start_count[UART_CHANNEL_1_TIMER], 2U );
+    ASSERT_TRUE( HW_UART_Rx_Peek_Timeout_Frame( HW_UART_CHANNEL_1, &frame, &spans ) );
+    EXPECT_EQ( frame.offset, 0U );
+    EXPECT_EQ( frame.length_bytes, 9U );
+}
+
+TEST_F( UartTest, DutRxReleaseTimeoutFrameAdvancesToNextFrame )
+{
+    HwUartConfig_T config = TEST_HW_UART_Make_Rx_Timeout_Config( TEST_HW_UART_MODBUS_TIMEOUT_BITS );
+    HwUartRxFrameDescriptor_T frame = {};
+    HwUartRxSpans_T           spans = {};
+
+    ASSERT_TRUE( HW_UART_Configure_Channel( HW_UART_CHANNEL_1, &config ) );
+    ASSERT_TRUE( HW_UART_Rx_Start( HW_UART_CHANNEL_1 ) );
+
+    TEST_HW_UART_Ch1_Line_Idle( 8U );
+    HW_UART_Rx_Timeout_Callback_From_ISR( HW_UART_CHANNEL_1 );
+    TEST_HW_UART_Ch1_Line_Idle( 11U );
+    HW_UART_Rx_Timeout_Callback_From_ISR( HW_UART_CHANNEL_1 );
+
+    /* Bytes of a frame still being received stay outside every descriptor. */
+    TEST_HW_UART_Set_Ch1_Rx_Write_Index( 14U );
+
+    ASSERT_TRUE( HW_UART_Rx_Peek_Timeout_Frame( HW_UART_CHANNEL_1, &frame, &spans ) );
+    EXPECT_EQ( frame.length_bytes, 8U );
+    HW_UART_Rx_Release_Timeout_Frame( HW_UART_CHANNEL_1 );
+
+    ASSERT_TRUE( HW_UART_Rx_Peek_Timeout_Frame( HW_UART_CHANNEL_1, &frame, &spans ) );
+    EXPECT_EQ( frame.offset, 8U );
+    EXPECT_EQ( frame.length_bytes, 3U );
+    HW_UART_Rx_Release_Timeout_Frame( HW_UART_CHANNEL_1 );
+
+    EXPECT_FALSE( HW_UART_Rx_Peek_Timeout_Frame( HW_UART_CHANNEL_1, &frame, &spans ) );
+    EXPECT_EQ( HW_UART_Rx_Peek( HW_UART_CHANNEL_1 ).total_length_bytes, 3U );
+
+    /* Releasing with nothing queued leaves the read index alone. */
+    HW_UART_Rx_Release_Timeout_Frame( HW_UART_CHANNEL_1 );
+    EXPECT_EQ( hw_uart_channel_states[HW_UART_CHANNEL_1].runtime.rx_read_index, 11U );
+}
+
+TEST_F( UartTest, DutRxTimeoutFrameAcrossRingWrapReturnsTwoSpans )
+{
+    HwUartConfig_T config = TEST_HW_UART_Make_Rx_Timeout_Config( TEST_HW_UART_MODBUS_TIMEOUT_BITS );
+    HwUartRxFrameDescriptor_T frame     = {};
+    HwUartRxSpans_T           spans     = {};
+    const uint8_t*            rx_buffer = hw_uart_channel_states[HW_UART_CHANNEL_1].rx_buffer;
+
+    ASSERT_TRUE( HW_UART_Configure_Channel( HW_UART_CHANNEL_1, &config ) );
+    ASSERT_TRUE( HW_UART_Rx_Start( HW_UART_CHANNEL_1 ) );
+
+    TEST_HW_UART_Ch1_Line_Idle( TEST_HW_UART_RX_BUFFER_SIZE - 6U );
+    HW_UART_Rx_Timeout_Callback_From_ISR( HW_UART_CHANNEL_1 );
+    ASSERT_TRUE( HW_UART_Rx_Peek_Timeout_Frame( HW_UART_CHANNEL_1, &frame, &spans ) );
+    HW_UART_Rx_Release_Timeout_Frame( HW_UART_CHANNEL_1 );
+
+    TEST_HW_UART_Ch1_Line_Idle( 4U );
+    HW_UART_Rx_Timeout_Callback_From_ISR( HW_UART_CHANNEL_1 );
+
+    ASSERT_TRUE( HW_UART_Rx_Peek_Timeout_Frame( HW_UART_CHANNEL_1, &frame, &spans ) );
+    EXPECT_EQ( frame.offset, TEST_HW_UART_RX_BUFFER_SIZE - 6U );
+    EXPECT_EQ( frame.length_bytes, 10U );
+    EXPECT_EQ( spans.first_span.data, &rx_buffer[TEST_HW_UART_RX_BUFFER_SIZE - 6U] );
+    EXPECT_EQ( spans.first_span.length_bytes, 6U );
+    EXPECT_EQ( spans.second_span.data, &rx_buffer[0] );
+    EXPECT_EQ( spans.second_span.length_bytes, 4U );
+    EXPECT_EQ( spans.total_length_bytes, 10U );
+}
+
+TEST_F( UartTest, DutUsartIrqReadsDrOnlyWhenIdleOrAnErrorIsFlagged )
+{
+    HwUartConfig_T config = TEST_HW_UART_Make_Rx_Timeout_Config( TEST_HW_UART_MODBUS_TIMEOUT_BITS );
+
+    ASSERT_TRUE( HW_UART_Configure_Channel( HW_UART_CHANNEL_1, &config ) );
+    ASSERT_TRUE( HW_UART_Rx_Start( HW_UART_CHANNEL_1 ) );
+    mock_usart_dr_reads = 0U;
+
+    USART6_IRQHandler();
+    EXPECT_EQ( mock_usart_dr_reads, 0U );
+
+    SET_BIT( USART6->SR, USART_SR_ORE );
+    USART6_IRQHandler();
+    EXPECT_EQ( mock_usart_dr_reads, 1U );
+    EXPECT_EQ( USART6->SR & USART_SR_ORE, 0U );
+    EXPECT_EQ( mock_timer_start_count[UART_CHANNEL_1_TIMER], 0U );
+
+    TEST_HW_UART_Ch1_Line_Idle( 3U );
+    EXPECT_EQ( mock_usart_dr_reads, 2U );
+    EXPECT_EQ( USART6->SR & USART_SR_IDLE, 0U );
+}
+
+TEST_F( UartTest, DutRxUsartErrorsAreLatchedIntoTheOpenFrameOnly )
+{
+    HwUartConfig_T config = TEST_HW_UART_Make_Rx_Timeout_Config( TEST_HW_UART_MODBUS_TIMEOUT_BITS );
+    HwUartRxFrameDescriptor_T frame = {};
+    HwUartRxSpans_T           spans = {};
+
+    ASSERT_TRUE( HW_UART_Configure_Channel( HW_UART_CHANNEL_1, &config ) );
+    ASSERT_TRUE( HW_UART_Rx_Start( HW_UART_CHANNEL_1 ) );
+
+    SET_BIT( USART6->SR, USART_SR_PE | USART_SR_ORE );
+    TEST_HW_UART_Ch1_Line_Idle( 3U );
+    HW_UART_Rx_Timeout_Callback_From_ISR( HW_UART_CHANNEL_1 );
+
+    TEST_HW_UART_Ch1_Line_Idle( 7U );
+    HW_UART_Rx_Timeout_Callback_From_ISR( HW_UART_CHANNEL_1 );
+
+    EXPECT_EQ( USART6->SR & ( USART_SR_PE | USART_SR_ORE ), 0U );
+
+    ASSERT_TRUE( HW_UART_Rx_Peek_Timeout_Frame( HW_UART_CHANNEL_1, &frame, &spans ) );
+    EXPECT_EQ( frame.error_flags,
+               ( uint32_t )( HW_UART_RX_FRAME_ERROR_PARITY | HW_UART_RX_FRAME_ERROR_OVERRUN ) );
+    HW_UART_Rx_Release_Timeout_Frame( HW_UART_CHANNEL_1 );
+
+    ASSERT_TRUE( HW_UART_Rx_Peek_Timeout_Frame( HW_UART_CHANNEL_1, &frame, &spans ) );
+    EXPECT_EQ( frame.error_flags, ( uint32_t )HW_UART_RX_FRAME_ERROR_NONE );
+}
+
+TEST_F( UartTest, DutRxFullFrameQueueMergesFramesAndFlagsThem )
+{
+    HwUartConfig_T config = TEST_HW_UART_Make_Rx_Timeout_Config( TEST_HW_UART_MODBUS_TIMEOUT_BITS );
+    HwUartRxFrameDescriptor_T frame = {};
+    HwUartRxSpans_T           spans = {};
+
+    ASSERT_TRUE( HW_UART_Configure_Channel( HW_UART_CHANNEL_1, &config ) );
+    ASSERT_TRUE( HW_UART_Rx_Start( HW_UART_CHANNEL_1 ) );
+
+    for ( uint32_t index = 1U; index <= HW_UART_RX_FRAME_QUEUE_DEPTH + 1U; index++ )
+    {
+        TEST_HW_UART_Ch1_Line_Idle( 2U * index );
+        HW_UART_Rx_Timeout_Callback_From_ISR( HW_UART_CHANNEL_1 );
+    }
+
+    EXPECT_EQ( hw_uart_channel_states[HW_UART_CHANNEL_1].runtime.rx_frames_dropped, 1U );
+
+    HW_UART_Rx_Release_Timeout_Frame( HW_UART_CHANNEL_1 );
+
+    TEST_HW_UART_Ch1_Line_Idle( 2U * ( HW_UART_RX_FRAME_QUEUE_DEPTH + 2U ) );
+    HW_UART_Rx_Timeout_Callback_From_ISR( HW_UART_CHANNEL_1 );
+
+    for ( uint32_t index = 1U; index < HW_UART_RX_FRAME_QUEUE_DEPTH; index++ )
+    {
+        ASSERT_TRUE( HW_UART_Rx_Peek_Timeout_Frame( HW_UART_CHANNEL_1, &frame, &spans ) );
+        EXPECT_EQ( frame.error_flags, ( uint32_t )HW_UART_RX_FRAME_ERROR_NONE );
+        HW_UART_Rx_Release_Timeout_Frame( HW_UART_CHANNEL_1 );
+    }
+
+    /* The dropped frame and the one after it are reported together. */
+    ASSERT_TRUE( HW_UART_Rx_Peek_Timeout_Frame( HW_UART_CHANNEL_1, &frame, &spans ) );
+    EXPECT_EQ( frame.offset, 2U * HW_UART_RX_FRAME_QUEUE_DEPTH );
+    EXPECT_EQ( frame.length_bytes, 4U );
+    EXPECT_EQ( frame.error_flags, ( uint32_t )HW_UART_RX_FRAME_ERROR_MERGED );
+}
+
+TEST_F( UartTest, DutRxStopStopsTimeoutTimerAndStartResetsFrameQueue )
+{
+    HwUartConfig_T config = TEST_HW_UART_Make_Rx_Timeout_Config( TEST_HW_UART_MODBUS_TIMEOUT_BITS );
+    HwUartRxFrameDescriptor_T frame = {};
+    HwUartRxSpans_T           spans = {};
+
+    ASSERT_TRUE( HW_UART_Configure_Channel( HW_UART_CHANNEL_1, &config ) );
+    ASSERT_TRUE( HW_UART_Rx_Start( HW_UART_CHANNEL_1 ) );
+
+    TEST_HW_UART_Ch1_Line_Idle( 5U );
+    HW_UART_Rx_Timeout_Callback_From_ISR( HW_UART_CHANNEL_1 );
+
+    ASSERT_TRUE( HW_UART_Rx_Stop( HW_UART_CHANNEL_1 ) );
+    EXPECT_EQ( mock_timer_stop_count[UART_CHANNEL_1_TIMER], 1U );
+
+    /* A timer interrupt racing the stop must not queue anything. */
+    HW_UART_Rx_Timeout_Callback_From_ISR( HW_UART_CHANNEL_1 );
+
+    ASSERT_TRUE( HW_UART_Rx_Start( HW_UART_CHANNEL_1 ) );
+    TEST_HW_UART_Set_Ch1_Rx_Write_Index( 5U );
+
+    EXPECT_FALSE( HW_UART_Rx_Peek_Timeout_Frame( HW_UART_CHANNEL_1, &frame, &spans ) );
+}
+
+TEST_F( UartTest, DutPrivateConfigurationAcceptsAutoBaudWithRx )
+{
+    HwUartConfig_T config = TEST_HW_UART_Make_Auto_Baud_Config();
+
+    EXPECT_TRUE( HW_UART_Configuration_Is_Valid( &config ) );
+
+    config.interface_mode = HW_UART_MODE_RS232;
+    EXPECT_TRUE( HW_UART_Configuration_Is_Valid( &config ) );
+}
+
+TEST_F( UartTest, DutPrivateConfigurationRejectsAutoBaudWithoutRx )
+{
+    HwUartConfig_T config = TEST_HW_UART_Make_Auto_Baud_Config();
+
+    config.rx_enabled = false;
+
+    EXPECT_FALSE( HW_UART_Configuration_Is_Valid( &config ) );
+}
+
+TEST_F( UartTest, DutConfigureAutoBaudProbesUsartAndArmsRxEdgeCapture )
+{
+    HwUartConfig_T         config = TEST_HW_UART_Make_Auto_Baud_Config();
+    HwUartAutoBaudResult_T result = {};
+
+    ASSERT_TRUE( HW_UART_Configure_Channel( HW_UART_CHANNEL_1, &config ) );
+
+    EXPECT_EQ( huart6.Init.BaudRate, HW_UART_AUTO_BAUD_PROBE_RATE );
+    EXPECT_TRUE( mock_gpio_edge_enabled[GPIO_USART6_RX] );
+    EXPECT_FALSE( mock_gpio_edge_enabled[GPIO_USART2_RX] );
+    EXPECT_EQ( mock_nvic_enabled[EXTI9_5_IRQn], 1U );
+    EXPECT_EQ( mock_nvic_priority[EXTI9_5_IRQn], HW_UART_USART_IRQ_PRIORITY );
+    EXPECT_EQ( HW_UART_Auto_Baud_Poll( HW_UART_CHANNEL_1, &result ), HW_UART_AUTO_BAUD_CAPTURING );
+
+    /* Reception waits for the real rate. */
+    EXPECT_FALSE( HW_UART_Rx_Start( HW_UART_CHANNEL_1 ) );
+}
+
+TEST_F( UartTest, DutAutoBaudLocksOntoStandardRatesWithinAFewCharacters )
+{
+    const uint32_t rates[] = { 9600U, 115200U, 460800U, 921600U };
+
+    for ( uint32_t rate : rates )
+    {
+        HwUartConfig_T         config = TEST_HW_UART_Make_Auto_Baud_Config();
+        HwUartAutoBaudResult_T result = {};
+
+        ASSERT_TRUE( HW_UART_Configure_Channel( HW_UART_CHANNEL_1, &config ) );
+
+        TEST_HW_UART_Ch1_Send_Chars( "Hello\r\n", rate, 0.0, 10.0, 1000.0 );
+
+        ASSERT_EQ( HW_UART_Auto_Baud_Poll( HW_UART_CHANNEL_1, &result ), HW_UART_AUTO_BAUD_LOCKED )
+            << rate;
+        EXPECT_EQ( result.selected_baud, rate );
+        EXPECT_LT( std::abs( result.error_ppm ), 1000 ) << rate;
+        EXPECT_GE( result.bits_measured, HW_UART_AUTO_BAUD_MIN_BITS );
+        EXPECT_EQ( huart6.Init.BaudRate, rate );
+        EXPECT_FALSE( mock_gpio_edge_enabled[GPIO_USART6_RX] );
+
+        ASSERT_TRUE( HW_UART_Rx_Start( HW_UART_CHANNEL_1 ) );
+        ASSERT_TRUE( HW_UART_Rx_Stop( HW_UART_CHANNEL_1 ) );
+    }
+}
+
+TEST_F( UartTest, DutAutoBaudMeasuresAcrossCycleCounterWrap )
+{
+    HwUartConfig_T         config = TEST_HW_UART_Make_Auto_Baud_Config();
+    HwUartAutoBaudResult_T result = {};
+
+    ASSERT_TRUE( HW_UART_Configure_Channel( HW_UART_CHANNEL_1, &config ) );
+
+    TEST_HW_UART_Ch1_Send_Chars( "Hello\r\n", 57600.0, 0.0, 0.0, 4294960000.0 );
+
+    ASSERT_EQ( HW_UART_Auto_Baud_Poll( HW_UART_CHANNEL_1, &result ), HW_UART_AUTO_BAUD_LOCKED );
+    EXPECT_EQ( result.selected_baud, 57600U );
+}
+
+TEST_F( UartTest, DutAutoBaudReportsDutRateErrorAndAppliesStandardRate )
+{
+    HwUartConfig_T         config = TEST_HW_UART_Make_Auto_Baud_Config();
+    HwUartAutoBaudResult_T result = {};
+
+    ASSERT_TRUE( HW_UART_Configure_Channel( HW_UART_CHANNEL_1, &config ) );
+
+    /* DUT clock 1.2 % fast. */
+    TEST_HW_UART_Ch1_Send_Chars( "Hello\r\n", 115200.0 * 1.012, 0.0, 10.0, 1000.0 );
+
+    ASSERT_EQ( HW_UART_Auto_Baud_Poll( HW_UART_CHANNEL_1, &result ), HW_UART_AUTO_BAUD_LOCKED );
+    EXPECT_EQ( result.selected_baud, 115200U );
+    EXPECT_NEAR( result.measured_baud, 116582U, 60U );
+    EXPECT_NEAR( result.error_ppm, 12000, 500 );
+    EXPECT_EQ( huart6.Init.BaudRate, 115200U );
+}
+
+TEST_F( UartTest, DutAutoBaudKeepsMeasuredRateWhenNoStandardRateIsClose )
+{
+    HwUartConfig_T         config = TEST_HW_UART_Make_Auto_Baud_Config();
+    HwUartAutoBaudResult_T result = {};
+
+    ASSERT_TRUE( HW_UART_Configure_Channel( HW_UART_CHANNEL_1, &config ) );
+
+    TEST_HW_UART_Ch1_Send_Chars( "Hello\r\n", 31250.0, 0.0, 10.0, 1000.0 );
+
+    ASSERT_EQ( HW_UART_Auto_Baud_Poll( HW_UART_CHANNEL_1, &result ), HW_UART_AUTO_BAUD_LOCKED );
+    EXPECT_NEAR( result.selected_baud, 31250U, 2U );
+    EXPECT_EQ( result.selected_baud, result.measured_baud );
+    EXPECT_EQ( result.error_ppm, 0 );
+    EXPECT_EQ( huart6.Init.BaudRate, result.selected_baud );
+}
+
+TEST_F( UartTest, DutAutoBaudSkipsFractionalIdleGapsBetweenCharacters )
+{
+    HwUartConfig_T         config = TEST_HW_UART_Make_Auto_Baud_Config();
+    HwUartAutoBaudResult_T result = {};
+
+    ASSERT_TRUE( HW_UART_Configure_Channel( HW_UART_CHANNEL_1, &config ) );
+
+    TEST_HW_UART_Ch1_Send_Chars( "Hello\r\n", 57600.0, 2.5, 0.0, 1000.0 );
+
+    ASSERT_EQ( HW_UART_Auto_Baud_Poll( HW_UART_CHANNEL_1, &result ), HW_UART_AUTO_BAUD_LOCKED );
+    EXPECT_EQ( result.selected_baud, 57600U );
+    EXPECT_LT( std::abs( result.error_ppm ), 100 );
+}
+
+TEST_F( UartTest, DutAutoBaudRejoinsRunSplitByGlitch )
+{
+    HwUartConfig_T         config     = TEST_HW_UART_Make_Auto_Baud_Config();
+    HwUartAutoBaudResult_T result     = {};
+    const double           bit_cycles = ( double )TEST_HW_UART_TIMER_CLOCK_HZ / 115200.0;
+
+    ASSERT_TRUE( HW_UART_Configure_Channel( HW_UART_CHANNEL_1, &config ) );
+
+    double t = TEST_HW_UART_Ch1_Send_Chars( "UU", 115200.0, 0.0, 0.0, 1000.0 );
+
+    /* 40 cycle low pulse in the middle of a three bit high run. */
+    TEST_HW_UART_Ch1_Rx_Edge( ( uint32_t )( t + ( 0.5 * bit_cycles ) ), false );
+    TEST_HW_UART_Ch1_Rx_Edge( ( uint32_t )( t + ( 0.5 * bit_cycles ) + 40.0 ), true );
+
+    TEST_HW_UART_Ch1_Send_Chars( "UUUU", 115200.0, 0.0, 0.0, t + ( 2.0 * bit_cycles ) );
+
+    ASSERT_EQ( HW_UART_Auto_Baud_Poll( HW_UART_CHANNEL_1, &result ), HW_UART_AUTO_BAUD_LOCKED );
+    EXPECT_EQ( result.selected_baud, 115200U );
+    EXPECT_LT( std::abs( result.error_ppm ), 1000 );
+}
+
+TEST_F( UartTest, DutAutoBaudDropsTimingReferenceWhenAnEdgeIsMissed )
+{
+    HwUartConfig_T config = TEST_HW_UART_Make_Auto_Baud_Config();
+
+    ASSERT_TRUE( HW_UART_Configure_Channel( HW_UART_CHANNEL_1, &config ) );
+
+    TEST_HW_UART_Ch1_Rx_Edge( 1000U, false );
+    TEST_HW_UART_Ch1_Rx_Edge( 2000U, true );
+    ASSERT_EQ( hw_uart_channel_states[HW_UART_CHANNEL_1].auto_baud.interval_count, 1U );
+
+    /* Two edges merged into one interrupt: same level as before. */
+    TEST_HW_UART_Ch1_Rx_Edge( 5000U, true );
+    TEST_HW_UART_Ch1_Rx_Edge( 6000U, false );
+    EXPECT_EQ( hw_uart_channel_states[HW_UART_CHANNEL_1].auto_baud.interval_count, 1U );
+
+    TEST_HW_UART_Ch1_Rx_Edge( 7500U, true );
+    ASSERT_EQ( hw_uart_channel_states[HW_UART_CHANNEL_1].auto_baud.interval_count, 2U );
+    EXPECT_EQ( hw_uart_channel_states[HW_UART_CHANNEL_1].auto_baud.intervals[1], 1500U );
+}
+
+TEST_F( UartTest, DutAutoBaudFailureOutOfRangeRearmsCapture )
+{
+    HwUartConfig_T         config = TEST_HW_UART_Make_Auto_Baud_Config();
+    HwUartAutoBaudResult_T result = {};
+
+    ASSERT_TRUE( HW_UART_Configure_Channel( HW_UART_CHANNEL_1, &config ) );
+
+    TEST_HW_UART_Ch1_Send_Chars( "UUUU", 200.0, 0.0, 0.0, 1000.0 );
+
+    EXPECT_EQ( HW_UART_Auto_Baud_Poll( HW_UART_CHANNEL_1, &result ), HW_UART_AUTO_BAUD_FAILED );
+    EXPECT_TRUE( mock_gpio_edge_enabled[GPIO_USART6_RX] );
+    EXPECT_EQ( hw_uart_channel_states[HW_UART_CHANNEL_1].auto_baud.interval_count, 0U );
+    EXPECT_EQ( HW_UART_Auto_Baud_Poll( HW_UART_CHANNEL_1, &result ), HW_UART_AUTO_BAUD_CAPTURING );
+    EXPECT_EQ( huart6.Init.BaudRate, HW_UART_AUTO_BAUD_PROBE_RATE );
+
+    TEST_HW_UART_Ch1_Send_Chars( "Hello\r\n", 19200.0, 0.0, 10.0, 1000.0 );
+
+    EXPECT_EQ( HW_UART_Auto_Baud_Poll( HW_UART_CHANNEL_1, &result ), HW_UART_AUTO_BAUD_LOCKED );
+    EXPECT_EQ( result.selected_baud, 19200U );
+}
+
+TEST_F( UartTest, DutAutoBaudLockProgramsRxTimeoutTimerForDetectedRate )
+{
+    HwUartConfig_T         config = TEST_HW_UART_Make_Auto_Baud_Config();
+    HwUartAutoBaudResult_T result = {};
+
+    config.rx_timeout_bits = TEST_HW_UART_MODBUS_TIMEOUT_BITS;
+
+    ASSERT_TRUE( HW_UART_Configure_Channel( HW_UART_CHANNEL_1, &config ) );
+    EXPECT_EQ( mock_timer_configure_count[UART_CHANNEL_1_TIMER], 0U );
+
+    TEST_HW_UART_Ch1_Send_Chars( "Hello\r\n", 9600.0, 0.0, 10.0, 1000.0 );
+
+    ASSERT_EQ( HW_UART_Auto_Baud_Poll( HW_UART_CHANNEL_1, &result ), HW_UART_AUTO_BAUD_LOCKED );
+    EXPECT_EQ( mock_timer_configure_count[UART_CHANNEL_1_TIMER], 1U );
+    EXPECT_TRUE( hw_uart_channel_states[HW_UART_CHANNEL_1].runtime.rx_timeout_uses_timer );
+
+    /* The lock is sticky until the channel is reconfigured. */
+    EXPECT_EQ( HW_UART_Auto_Baud_Poll( HW_UART_CHANNEL_1, &result ), HW_UART_AUTO_BAUD_LOCKED );
+    EXPECT_EQ( result.selected_baud, 9600U );
+    EXPECT_EQ( mock_timer_configure_count[UART_CHANNEL_1_TIMER], 1U );
+}
+
+TEST_F( UartTest, DutReconfigureDisarmsAutoBaudCapture )
+{
+    HwUartConfig_T         auto_config  = TEST_HW_UART_Make_Auto_Baud_Config();
+    HwUartConfig_T         fixed_config = TEST_HW_UART_Make_Tx_Rx_Config();
+    HwUartAutoBaudResult_T result       = {};
+
+    ASSERT_TRUE( HW_UART_Configure_Channel( HW_UART_CHANNEL_1, &auto_config ) );
+    ASSERT_TRUE( HW_UART_Configure_Channel( HW_UART_CHANNEL_1, &fixed_config ) );
+
+    EXPECT_FALSE( mock_gpio_edge_enabled[GPIO_USART6_RX] );
+    EXPECT_EQ( HW_UART_Auto_Baud_Poll( HW_UART_CHANNEL_1, &result ), HW_UART_AUTO_BAUD_INACTIVE );
+
+    /* An edge raced against the reconfiguration is ignored. */
+    TEST_HW_UART_Ch1_Rx_Edge( 1000U, false );
+    EXPECT_EQ( hw_uart_channel_states[HW_UART_CHANNEL_1].auto_baud.interval_count, 0U );
+}
+
+TEST_F( UartTest, DutAutoBaudEdgeOnChannel2PinOnlyFeedsChannel2 )
+{
+    HwUartConfig_T config = TEST_HW_UART_Make_Auto_Baud_Config();
+
+    ASSERT_TRUE( HW_UART_Configure_Channel( HW_UART_CHANNEL_1, &config ) );
+    ASSERT_TRUE( HW_UART_Configure_Channel( HW_UART_CHANNEL_2, &config ) );
+
+    for ( uint32_t i = 0U; i < 3U; i++ )
+    {
+        mock_cycle_count                       = 1000U * ( i + 1U );
+        mock_gpio_level[GPIO_USART2_RX]        = ( i % 2U ) != 0U;
+        mock_gpio_edge_pending[GPIO_USART2_RX] = true;
+        EXTI9_5_IRQHandler();
+    }
+
+    EXPECT_EQ( hw_uart_channel_states[HW_UART_CHANNEL_1].auto_baud.interval_count, 0U );
+    EXPECT_EQ( hw_uart_channel_states[HW_UART_CHANNEL_2].auto_baud.interval_count, 2U );
+}
+
+TEST_F( UartTest, DutAutoBaudPollRejectsInvalidArguments )
+{
+    HwUartAutoBaudResult_T result = {};
+    HwUartConfig_T         config = TEST_HW_UART_Make_Auto_Baud_Config();
+
+    ASSERT_TRUE( HW_UART_Configure_Channel( HW_UART_CHANNEL_1, &config ) );
+
+    EXPECT_EQ( HW_UART_Auto_Baud_Poll( TEST_HW_UART_Invalid_Channel(), &result ),
+               HW_UART_AUTO_BAUD_INACTIVE );
+    EXPECT_EQ( HW_UART_Auto_Baud_Poll( HW_UART_CHANNEL_1, nullptr ), HW_UART_AUTO_BAUD_INACTIVE );
+    EXPECT_EQ( HW_UART_Auto_Baud_Poll( HW_UART_CHANNEL_2, &result ), HW_UART_AUTO_BAUD_INACTIVE );
 }
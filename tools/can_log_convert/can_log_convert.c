@@ -0,0 +1,456 @@
+/******************************************************************************
+ *  File:       can_log_convert.c
+ *  Author:     Timothy Vogelsang
+ *  Created:    18-Oct-2026
+ *
+ *  Description:
+ *      Trace line parsers and compact replay log encoder.
+ *
+ *  Notes:
+    Both trace formats are whitespace separated, so each parser splits its
+    line into tokens first and then checks them in order:
+
+        candump:  (1436509052.249713)  can0  18DAF110#0210
+                  time                 chan  id#data
+
+        ASC:      0.012345  1     18DAF110x  Rx  d  2  02 10
+                  time      chan  id         dir d  dlc bytes
+ ******************************************************************************/
+
+/**-----------------------------------------------------------------------------
+ *  Includes
+ *------------------------------------------------------------------------------
+ */
+
+#include "can_log_convert.h"
+#include "hw_can_replay.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+/**-----------------------------------------------------------------------------
+ *  Defines / Macros
+ *------------------------------------------------------------------------------
+ */
+
+#define CAN_LOG_MAX_TOKENS ( 16U )
+#define CAN_LOG_MAX_DLC ( 8U )
+#define CAN_LOG_STANDARD_ID_MAX ( 0x7FFU )
+#define CAN_LOG_EXTENDED_ID_MAX ( 0x1FFFFFFFU )
+#define CAN_LOG_US_DIGITS ( 6U )
+
+/* candump marks error frames with this bit of an eight-digit identifier. */
+#define CAN_LOG_CANDUMP_ERROR_FLAG ( 0x20000000U )
+#define CAN_LOG_CANDUMP_STANDARD_DIGITS ( 3U )
+#define CAN_LOG_CANDUMP_EXTENDED_DIGITS ( 8U )
+
+/**-----------------------------------------------------------------------------
+ *  Private Typedefs / Enums / Structures
+ *------------------------------------------------------------------------------
+ */
+
+/** Tokens of one line; each points into the line and has its own length. */
+typedef struct CAN_Log_Tokens_T
+{
+    const char* text[CAN_LOG_MAX_TOKENS];
+    size_t      length[CAN_LOG_MAX_TOKENS];
+    size_t      count;
+} CAN_Log_Tokens_T;
+
+/**-----------------------------------------------------------------------------
+ *  Private Function Definitions
+ *------------------------------------------------------------------------------
+ */
+
+static bool CAN_Log_Is_Space( char c )
+{
+    return c == ' ' || c == '\t' || c == '\r' || c == '\n';
+}
+
+/** Split a line at whitespace. Tokens past CAN_LOG_MAX_TOKENS are dropped. */
+static void CAN_Log_Tokenise( const char* line, CAN_Log_Tokens_T* tokens )
+{
+    tokens->count = 0U;
+    while ( *line != '\0' && tokens->count < CAN_LOG_MAX_TOKENS )
+    {
+        while ( CAN_Log_Is_Space( *line ) )
+        {
+            line++;
+        }
+        if ( *line == '\0' )
+        {
+            break;
+        }
+
+        const char* start = line;
+        while ( *line != '\0' && !CAN_Log_Is_Space( *line ) )
+        {
+            line++;
+        }
+        tokens->text[tokens->count]   = start;
+        tokens->length[tokens->count] = ( size_t )( line - start );
+        tokens->count++;
+    }
+}
+
+static bool CAN_Log_Token_Is( const CAN_Log_Tokens_T* tokens, size_t index, const char* word )
+{
+    size_t length = strlen( word );
+    return index < tokens->count && tokens->length[index] == length
+           && strncmp( tokens->text[index], word, length ) == 0;
+}
+
+/** Value of one digit in base 16 or 10, or -1 when it is not a digit of that base. */
+static int CAN_Log_Digit( char c, bool decimal )
+{
+    if ( c >= '0' && c <= '9' )
+    {
+        return c - '0';
+    }
+    if ( !decimal && c >= 'a' && c <= 'f' )
+    {
+        return c - 'a' + 10;
+    }
+    if ( !decimal && c >= 'A' && c <= 'F' )
+    {
+        return c - 'A' + 10;
+    }
+    return -1;
+}
+
+/** Parse all of text[0..length) as an unsigned number no larger than max. */
+static bool CAN_Log_Parse_Number( const char* text, size_t length, bool decimal, uint32_t max,
+                                  uint32_t* value )
+{
+    uint64_t result = 0U;
+    if ( length == 0U )
+    {
+        return false;
+    }
+    for ( size_t i = 0U; i < length; i++ )
+    {
+        int digit = CAN_Log_Digit( text[i], decimal );
+        if ( digit < 0 )
+        {
+            return false;
+        }
+        result = result * ( decimal ? 10U : 16U ) + ( uint64_t )digit;
+        if ( result > max )
+        {
+            return false;
+        }
+    }
+    *value = ( uint32_t )result;
+    return true;
+}
+
+/**
+ * Parse "seconds[.fraction]" into whole microseconds. Fraction digits past
+ * the sixth are dropped.
+ */
+static bool CAN_Log_Parse_Time( const char* text, size_t length, uint64_t* time_us )
+{
+    uint64_t seconds  = 0U;
+    uint64_t fraction = 0U;
+    size_t   i        = 0U;
+
+    for ( ; i < length && text[i] >= '0' && text[i] <= '9'; i++ )
+    {
+        if ( seconds > UINT64_MAX / 10U / 1000000U )
+        {
+            return false;
+        }
+        seconds = seconds * 10U + ( uint64_t )( text[i] - '0' );
+    }
+    if ( i == 0U )
+    {
+        return false;
+    }
+
+    uint8_t digits = 0U;
+    if ( i < length && text[i] == '.' )
+    {
+        for ( i++; i < length && text[i] >= '0' && text[i] <= '9'; i++ )
+        {
+            if ( digits < CAN_LOG_US_DIGITS )
+            {
+                fraction = fraction * 10U + ( uint64_t )( text[i] - '0' );
+                digits++;
+            }
+        }
+    }
+    if ( i != length )
+    {
+        return false;
+    }
+    for ( ; digits < CAN_LOG_US_DIGITS; digits++ )
+    {
+        fraction *= 10U;
+    }
+
+    *time_us = seconds * 1000000U + fraction;
+    return true;
+}
+
+static void CAN_Log_Copy_Channel( CAN_Log_Frame_T* frame, const char* text, size_t length )
+{
+    if ( length >= CAN_LOG_CHANNEL_SIZE )
+    {
+        length = CAN_LOG_CHANNEL_SIZE - 1U;
+    }
+    memcpy( frame->channel, text, length );
+    frame->channel[length] = '\0';
+}
+
+static void CAN_Log_Write_Le( uint8_t bytes[], uint32_t value, uint8_t count )
+{
+    for ( uint8_t i = 0U; i < count; i++ )
+    {
+        bytes[i] = ( uint8_t )( value >> ( i * 8U ) );
+    }
+}
+
+/**-----------------------------------------------------------------------------
+ *  Public Function Definitions
+ *------------------------------------------------------------------------------
+ */
+
+CAN_Log_Line_T CAN_Log_Parse_Candump( const char* line, CAN_Log_Frame_T* frame )
+{
+    CAN_Log_Tokens_T tokens;
+    CAN_Log_Tokenise( line, &tokens );
+    if ( tokens.count == 0U )
+    {
+        return CAN_LOG_LINE_SKIP;
+    }
+    if ( tokens.count < 3U || tokens.length[0] < 3U || tokens.text[0][0] != '('
+         || tokens.text[0][tokens.length[0] - 1U] != ')' )
+    {
+        return CAN_LOG_LINE_ERROR;
+    }
+
+    memset( frame, 0, sizeof( *frame ) );
+    if ( !CAN_Log_Parse_Time( &tokens.text[0][1], tokens.length[0] - 2U, &frame->time_us ) )
+    {
+        return CAN_LOG_LINE_ERROR;
+    }
+    CAN_Log_Copy_Channel( frame, tokens.text[1], tokens.length[1] );
+
+    const char* text   = tokens.text[2];
+    size_t      length = tokens.length[2];
+    const char* hash   = memchr( text, '#', length );
+    if ( hash == NULL )
+    {
+        return CAN_LOG_LINE_ERROR;
+    }
+
+    size_t      id_digits = ( size_t )( hash - text );
+    const char* data      = hash + 1;
+    size_t      remaining = length - id_digits - 1U;
+    if ( remaining > 0U && ( data[0] == '#' || data[0] == 'R' || data[0] == 'r' ) )
+    {
+        return CAN_LOG_LINE_SKIP; // CAN FD or remote frame
+    }
+
+    uint32_t id = 0U;
+    if ( id_digits == CAN_LOG_CANDUMP_EXTENDED_DIGITS
+         && CAN_Log_Parse_Number( text, id_digits, false, UINT32_MAX, &id ) )
+    {
+        if ( ( id & CAN_LOG_CANDUMP_ERROR_FLAG ) != 0U )
+        {
+            return CAN_LOG_LINE_SKIP;
+        }
+        if ( id > CAN_LOG_EXTENDED_ID_MAX )
+        {
+            return CAN_LOG_LINE_ERROR;
+        }
+        frame->extended = true;
+    }
+    else if ( id_digits != CAN_LOG_CANDUMP_STANDARD_DIGITS
+              || !CAN_Log_Parse_Number( text, id_digits, false, CAN_LOG_STANDARD_ID_MAX, &id ) )
+    {
+        return CAN_LOG_LINE_ERROR;
+    }
+    frame->id = id;
+
+    // A '_' suffix carries a raw DLC above eight, which the rig does not send
+    const char* suffix = memchr( data, '_', remaining );
+    if ( suffix != NULL )
+    {
+        remaining = ( size_t )( suffix - data );
+    }
+    if ( remaining % 2U != 0U || remaining / 2U > CAN_LOG_MAX_DLC )
+    {
+        return CAN_LOG_LINE_ERROR;
+    }
+
+    frame->dlc = ( uint8_t )( remaining / 2U );
+    for ( uint8_t i = 0U; i < frame->dlc; i++ )
+    {
+        uint32_t byte = 0U;
+        if ( !CAN_Log_Parse_Number( &data[i * 2U], 2U, false, 0xFFU, &byte ) )
+        {
+            return CAN_LOG_LINE_ERROR;
+        }
+        frame->data[i] = ( uint8_t )byte;
+    }
+    return CAN_LOG_LINE_FRAME;
+}
+
+CAN_Log_Line_T CAN_Log_Parse_Asc( const char* line, CAN_Log_Asc_State_T* state,
+                                  CAN_Log_Frame_T* frame )
+{
+    CAN_Log_Tokens_T tokens;
+    CAN_Log_Tokenise( line, &tokens );
+    if ( CAN_Log_Token_Is( &tokens, 0U, "base" ) )
+    {
+        if ( CAN_Log_Token_Is( &tokens, 1U, "dec" ) )
+        {
+            state->decimal = true;
+        }
+        else if ( CAN_Log_Token_Is( &tokens, 1U, "hex" ) )
+        {
+            state->decimal = false;
+        }
+        else
+        {
+            return CAN_LOG_LINE_ERROR;
+        }
+
+        // Relative timestamps count from the previous event, not only the previous frame
+        if ( CAN_Log_Token_Is( &tokens, 3U, "relative" ) )
+        {
+            return CAN_LOG_LINE_ERROR;
+        }
+        return CAN_LOG_LINE_SKIP;
+    }
+
+    // Header, trigger block and event lines do not start with time and channel number
+    memset( frame, 0, sizeof( *frame ) );
+    uint32_t channel = 0U;
+    if ( tokens.count < 3U
+         || !CAN_Log_Parse_Time( tokens.text[0], tokens.length[0], &frame->time_us )
+         || !CAN_Log_Parse_Number( tokens.text[1], tokens.length[1], true, UINT32_MAX,
+                                   &channel ) )
+    {
+        return CAN_LOG_LINE_SKIP;
+    }
+    CAN_Log_Copy_Channel( frame, tokens.text[1], tokens.length[1] );
+
+    // Error frames and statistics share the layout but carry a word for an identifier
+    const char* id_text   = tokens.text[2];
+    size_t      id_length = tokens.length[2];
+    if ( id_length > 1U && id_text[id_length - 1U] == 'x' )
+    {
+        frame->extended = true;
+        id_length--;
+    }
+    uint32_t id_max = frame->extended ? CAN_LOG_EXTENDED_ID_MAX : CAN_LOG_STANDARD_ID_MAX;
+    for ( size_t i = 0U; i < id_length; i++ )
+    {
+        if ( CAN_Log_Digit( id_text[i], state->decimal ) < 0 )
+        {
+            return CAN_LOG_LINE_SKIP;
+        }
+    }
+    if ( !CAN_Log_Parse_Number( id_text, id_length, state->decimal, id_max, &frame->id ) )
+    {
+        return CAN_LOG_LINE_ERROR;
+    }
+
+    if ( !CAN_Log_Token_Is( &tokens, 3U, "Rx" ) && !CAN_Log_Token_Is( &tokens, 3U, "Tx" ) )
+    {
+        return CAN_LOG_LINE_ERROR;
+    }
+    if ( CAN_Log_Token_Is( &tokens, 4U, "r" ) )
+    {
+        return CAN_LOG_LINE_SKIP;
+    }
+
+    uint32_t dlc = 0U;
+    if ( !CAN_Log_Token_Is( &tokens, 4U, "d" ) || tokens.count < 6U
+         || !CAN_Log_Parse_Number( tokens.text[5], tokens.length[5], false, CAN_LOG_MAX_DLC,
+                                   &dlc )
+         || tokens.count < 6U + dlc )
+    {
+        return CAN_LOG_LINE_ERROR;
+    }
+
+    frame->dlc = ( uint8_t )dlc;
+    for ( uint8_t i = 0U; i < frame->dlc; i++ )
+    {
+        uint32_t byte = 0U;
+        if ( !CAN_Log_Parse_Number( tokens.text[6U + i], tokens.length[6U + i], state->decimal,
+                                    0xFFU, &byte ) )
+        {
+            return CAN_LOG_LINE_ERROR;
+        }
+        frame->data[i] = ( uint8_t )byte;
+    }
+    return CAN_LOG_LINE_FRAME;
+}
+
+CAN_Log_Result_T CAN_Log_Encode( const CAN_Log_Frame_T frames[], size_t count, uint32_t gap_us,
+                                 uint8_t** log, size_t* length )
+{
+    if ( count == 0U )
+    {
+        return CAN_LOG_RESULT_EMPTY;
+    }
+    if ( count > UINT32_MAX )
+    {
+        return CAN_LOG_RESULT_NO_MEMORY;
+    }
+
+    for ( size_t i = 1U; i < count; i++ )
+    {
+        if ( frames[i].time_us < frames[i - 1U].time_us )
+        {
+            return CAN_LOG_RESULT_OUT_OF_ORDER;
+        }
+    }
+    uint64_t pass_us = frames[count - 1U].time_us - frames[0].time_us + gap_us;
+    if ( pass_us > UINT32_MAX )
+    {
+        return CAN_LOG_RESULT_GAP_TOO_LONG;
+    }
+
+    uint8_t* bytes = malloc( HW_CAN_REPLAY_HEADER_SIZE + count * HW_CAN_REPLAY_RECORD_MAX_SIZE );
+    if ( bytes == NULL )
+    {
+        return CAN_LOG_RESULT_NO_MEMORY;
+    }
+
+    memset( bytes, 0, HW_CAN_REPLAY_HEADER_SIZE );
+    memcpy( bytes, HW_CAN_REPLAY_MAGIC, HW_CAN_REPLAY_MAGIC_SIZE );
+    bytes[HW_CAN_REPLAY_MAGIC_SIZE] = HW_CAN_REPLAY_VERSION;
+    CAN_Log_Write_Le( &bytes[8], ( uint32_t )count, 4U );
+    CAN_Log_Write_Le( &bytes[12], ( uint32_t )pass_us, 4U );
+
+    size_t offset = HW_CAN_REPLAY_HEADER_SIZE;
+    for ( size_t i = 0U; i < count; i++ )
+    {
+        const CAN_Log_Frame_T* frame = &frames[i];
+        uint32_t delta_us = i == 0U ? 0U : ( uint32_t )( frame->time_us - frames[i - 1U].time_us );
+        uint8_t  delta_bytes = delta_us > 0xFFFFFFU ? 4U
+                               : delta_us > 0xFFFFU ? 3U
+                               : delta_us > 0xFFU   ? 2U
+                                                    : 1U;
+        uint8_t  id_bytes    = frame->extended ? 4U : 2U;
+
+        bytes[offset] = ( uint8_t )( frame->dlc
+                                     | ( ( delta_bytes - 1U ) << HW_CAN_REPLAY_TAG_DELTA_SHIFT )
+                                     | ( frame->extended ? HW_CAN_REPLAY_TAG_EXTENDED : 0U ) );
+        offset++;
+        CAN_Log_Write_Le( &bytes[offset], delta_us, delta_bytes );
+        offset += delta_bytes;
+        CAN_Log_Write_Le( &bytes[offset], frame->id, id_bytes );
+        offset += id_bytes;
+        memcpy( &bytes[offset], frame->data, frame->dlc );
+        offset += frame->dlc;
+    }
+
+    *log    = bytes;
+    *length = offset;
+    return CAN_LOG_RESULT_OK;
+}
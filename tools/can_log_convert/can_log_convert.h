@@ -0,0 +1,137 @@
+/******************************************************************************
+ *  File:       can_log_convert.h
+ *  Author:     Timothy Vogelsang
+ *  Created:    18-Oct-2026
+ *
+ *  Description:
+ *      Host-side conversion of candump and Vector ASC traces into the compact
+ *      CAN replay log described in hw_can_replay.h.
+ *
+ *      Trace lines are parsed one at a time into frames with absolute
+ *      microsecond timestamps. The frames of one trace are then encoded into
+ *      a log whose first frame is due at the start of each pass and whose
+ *      records carry the recorded gaps in the narrowest delta field.
+ *
+ *  Notes:
+ *      Timestamps are read as whole microseconds without going through
+ *      floating point, so long absolute candump timestamps keep their last
+ *      digit. Remote, CAN FD, error and event lines are skipped.
+ ******************************************************************************/
+
+#ifndef CAN_LOG_CONVERT_H
+#define CAN_LOG_CONVERT_H
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/**-----------------------------------------------------------------------------
+ *  Includes
+ *------------------------------------------------------------------------------
+ */
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/**-----------------------------------------------------------------------------
+ *  Public Defines / Macros
+ *------------------------------------------------------------------------------
+ */
+
+/** Longest interface or channel name kept for filtering, including the terminator. */
+#define CAN_LOG_CHANNEL_SIZE ( 32U )
+
+/**-----------------------------------------------------------------------------
+ *  Public Typedefs / Enums / Structures
+ *------------------------------------------------------------------------------
+ */
+
+/** Outcome of parsing one trace line. */
+typedef enum CAN_Log_Line_T
+{
+    CAN_LOG_LINE_FRAME = 0,
+    CAN_LOG_LINE_SKIP,
+    CAN_LOG_LINE_ERROR,
+} CAN_Log_Line_T;
+
+/** Outcome of encoding a log. */
+typedef enum CAN_Log_Result_T
+{
+    CAN_LOG_RESULT_OK = 0,
+    CAN_LOG_RESULT_EMPTY,
+    CAN_LOG_RESULT_OUT_OF_ORDER,
+    CAN_LOG_RESULT_GAP_TOO_LONG,
+    CAN_LOG_RESULT_NO_MEMORY,
+} CAN_Log_Result_T;
+
+/** One classic CAN data frame read from a trace. */
+typedef struct CAN_Log_Frame_T
+{
+    uint64_t time_us;
+    uint32_t id;
+    bool     extended;
+    uint8_t  dlc;
+    uint8_t  data[8];
+    char     channel[CAN_LOG_CHANNEL_SIZE];
+} CAN_Log_Frame_T;
+
+/**
+ * Number base of identifiers and data bytes in an ASC trace. Set by its
+ * "base hex" or "base dec" header line; hexadecimal until one is seen.
+ */
+typedef struct CAN_Log_Asc_State_T
+{
+    bool decimal;
+} CAN_Log_Asc_State_T;
+
+/**-----------------------------------------------------------------------------
+ *  Public Function Prototypes
+ *------------------------------------------------------------------------------
+ */
+
+/**
+ * @brief Parse one line of a candump -l trace.
+ *
+ * The expected form is "(seconds.micros) interface ID#DATA". Eight identifier
+ * digits mark an extended frame. Remote frames, CAN FD frames, error frames
+ * and blank lines are skipped; any other line that does not match is an
+ * error.
+ */
+CAN_Log_Line_T CAN_Log_Parse_Candump( const char* line, CAN_Log_Frame_T* frame );
+
+/**
+ * @brief Parse one line of a Vector ASC trace.
+ *
+ * Frame lines have the form "seconds channel ID[x] Rx|Tx d DLC bytes...",
+ * with a trailing 'x' marking an extended identifier. The "base" header line
+ * updates state and is an error when it selects relative timestamps. Remote
+ * frames, error frames, CAN FD and event lines are skipped. A frame line whose
+ * identifier is out of range or whose remainder does not parse is an error.
+ */
+CAN_Log_Line_T CAN_Log_Parse_Asc( const char* line, CAN_Log_Asc_State_T* state,
+                                  CAN_Log_Frame_T* frame );
+
+/**
+ * @brief Encode frames into a compact replay log.
+ *
+ * The first frame is due at the start of each pass and every later frame
+ * keeps its gap to the one before. A pass lasts from the first frame to the
+ * last plus gap_us, which is the pause before the log repeats.
+ *
+ * @param log     Set to a buffer allocated with malloc; the caller frees it.
+ * @param length  Set to the number of bytes in log.
+ *
+ * @return CAN_LOG_RESULT_EMPTY for no frames, CAN_LOG_RESULT_OUT_OF_ORDER when
+ *         a timestamp goes backwards, CAN_LOG_RESULT_GAP_TOO_LONG when a gap
+ *         or the whole pass does not fit 32 bits of microseconds.
+ */
+CAN_Log_Result_T CAN_Log_Encode( const CAN_Log_Frame_T frames[], size_t count, uint32_t gap_us,
+                                 uint8_t** log, size_t* length );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CAN_LOG_CONVERT_H */
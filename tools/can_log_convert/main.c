@@ -0,0 +1,223 @@
+/******************************************************************************
+ *  File:       main.c
+ *  Author:     Timothy Vogelsang
+ *  Created:    18-Oct-2026
+ *
+ *  Description:
+ *      Command line front end of the CAN trace to replay log converter.
+ *
+ *      can_log_convert [--format candump|asc] [--channel NAME] [--gap-us N]
+ *                      INPUT OUTPUT
+ *
+ *      The format defaults to asc for files ending in .asc and candump
+ *      otherwise. --channel keeps only frames from one candump interface or
+ *      ASC channel number. --gap-us sets the pause after the last frame before
+ *      a looped log repeats; it defaults to the trace's mean frame gap.
+ ******************************************************************************/
+
+/**-----------------------------------------------------------------------------
+ *  Includes
+ *------------------------------------------------------------------------------
+ */
+
+#include "can_log_convert.h"
+
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/**-----------------------------------------------------------------------------
+ *  Defines / Macros
+ *------------------------------------------------------------------------------
+ */
+
+#define CAN_LOG_LINE_SIZE ( 4096U )
+#define CAN_LOG_INITIAL_FRAMES ( 1024U )
+
+/**-----------------------------------------------------------------------------
+ *  Private Function Definitions
+ *------------------------------------------------------------------------------
+ */
+
+static int CAN_Log_Usage( const char* program )
+{
+    fprintf( stderr,
+             "usage: %s [--format candump|asc] [--channel NAME] [--gap-us N] INPUT OUTPUT\n",
+             program );
+    return EXIT_FAILURE;
+}
+
+static bool CAN_Log_Ends_With( const char* text, const char* suffix )
+{
+    size_t text_length   = strlen( text );
+    size_t suffix_length = strlen( suffix );
+    return text_length >= suffix_length
+           && strcmp( &text[text_length - suffix_length], suffix ) == 0;
+}
+
+static const char* CAN_Log_Result_Text( CAN_Log_Result_T result )
+{
+    switch ( result )
+    {
+        case CAN_LOG_RESULT_OK:
+            return "ok";
+        case CAN_LOG_RESULT_EMPTY:
+            return "no frames to convert";
+        case CAN_LOG_RESULT_OUT_OF_ORDER:
+            return "timestamps go backwards";
+        case CAN_LOG_RESULT_GAP_TOO_LONG:
+            return "trace is longer than 4294 s";
+        case CAN_LOG_RESULT_NO_MEMORY:
+        default:
+            return "out of memory";
+    }
+}
+
+/**-----------------------------------------------------------------------------
+ *  Public Function Definitions
+ *------------------------------------------------------------------------------
+ */
+
+int main( int argc, char* argv[] )
+{
+    const char* format  = NULL;
+    const char* channel = NULL;
+    const char* input   = NULL;
+    const char* output  = NULL;
+    bool        has_gap = false;
+    uint32_t    gap_us  = 0U;
+
+    for ( int i = 1; i < argc; i++ )
+    {
+        if ( strcmp( argv[i], "--format" ) == 0 && i + 1 < argc )
+        {
+            format = argv[++i];
+        }
+        else if ( strcmp( argv[i], "--channel" ) == 0 && i + 1 < argc )
+        {
+            channel = argv[++i];
+        }
+        else if ( strcmp( argv[i], "--gap-us" ) == 0 && i + 1 < argc )
+        {
+            char* end = NULL;
+            errno     = 0;
+            unsigned long value = strtoul( argv[++i], &end, 10 );
+            if ( errno != 0 || *end != '\0' || value > UINT32_MAX )
+            {
+                return CAN_Log_Usage( argv[0] );
+            }
+            gap_us  = ( uint32_t )value;
+            has_gap = true;
+        }
+        else if ( input == NULL )
+        {
+            input = argv[i];
+        }
+        else if ( output == NULL )
+        {
+            output = argv[i];
+        }
+        else
+        {
+            return CAN_Log_Usage( argv[0] );
+        }
+    }
+    if ( input == NULL || output == NULL )
+    {
+        return CAN_Log_Usage( argv[0] );
+    }
+
+    bool asc = format != NULL ? strcmp( format, "asc" ) == 0
+                              : CAN_Log_Ends_With( input, ".asc" )
+                                    || CAN_Log_Ends_With( input, ".ASC" );
+    if ( format != NULL && !asc && strcmp( format, "candump" ) != 0 )
+    {
+        return CAN_Log_Usage( argv[0] );
+    }
+
+    FILE* in = fopen( input, "r" );
+    if ( in == NULL )
+    {
+        fprintf( stderr, "%s: %s\n", input, strerror( errno ) );
+        return EXIT_FAILURE;
+    }
+
+    CAN_Log_Frame_T*    frames    = NULL;
+    size_t              count     = 0U;
+    size_t              capacity  = 0U;
+    size_t              skipped   = 0U;
+    unsigned long       line_no   = 0U;
+    CAN_Log_Asc_State_T asc_state = { 0 };
+    char                line[CAN_LOG_LINE_SIZE];
+
+    while ( fgets( line, sizeof( line ), in ) != NULL )
+    {
+        line_no++;
+
+        CAN_Log_Frame_T frame;
+        CAN_Log_Line_T  parsed = asc ? CAN_Log_Parse_Asc( line, &asc_state, &frame )
+                                     : CAN_Log_Parse_Candump( line, &frame );
+        if ( parsed == CAN_LOG_LINE_ERROR )
+        {
+            fprintf( stderr, "%s:%lu: cannot parse line\n", input, line_no );
+            fclose( in );
+            free( frames );
+            return EXIT_FAILURE;
+        }
+        if ( parsed == CAN_LOG_LINE_SKIP )
+        {
+            skipped++;
+            continue;
+        }
+        if ( channel != NULL && strcmp( frame.channel, channel ) != 0 )
+        {
+            continue;
+        }
+
+        if ( count == capacity )
+        {
+            size_t           grown = capacity == 0U ? CAN_LOG_INITIAL_FRAMES : capacity * 2U;
+            CAN_Log_Frame_T* more  = realloc( frames, grown * sizeof( *frames ) );
+            if ( more == NULL )
+            {
+                fprintf( stderr, "%s\n", CAN_Log_Result_Text( CAN_LOG_RESULT_NO_MEMORY ) );
+                fclose( in );
+                free( frames );
+                return EXIT_FAILURE;
+            }
+            frames   = more;
+            capacity = grown;
+        }
+        frames[count++] = frame;
+    }
+    fclose( in );
+
+    if ( !has_gap && count > 1U )
+    {
+        uint64_t span_us = frames[count - 1U].time_us - frames[0].time_us;
+        gap_us           = ( uint32_t )( span_us / ( count - 1U ) );
+    }
+
+    uint8_t*         log    = NULL;
+    size_t           length = 0U;
+    CAN_Log_Result_T result = CAN_Log_Encode( frames, count, gap_us, &log, &length );
+    free( frames );
+    if ( result != CAN_LOG_RESULT_OK )
+    {
+        fprintf( stderr, "%s: %s\n", input, CAN_Log_Result_Text( result ) );
+        return EXIT_FAILURE;
+    }
+
+    FILE* out = fopen( output, "wb" );
+    if ( out == NULL || fwrite( log, 1U, length, out ) != length || fclose( out ) != 0 )
+    {
+        fprintf( stderr, "%s: %s\n", output, strerror( errno ) );
+        free( log );
+        return EXIT_FAILURE;
+    }
+    free( log );
+
+    printf( "%zu frames, %zu lines skipped, %zu bytes\n", count, skipped, length );
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,209 @@
+/******************************************************************************
+ *  File:       test_can_log_convert.cpp
+ *
+ *  Description:
+ *      Unit tests for the candump and ASC trace parsers and the compact
+ *      replay log encoder.
+ ******************************************************************************/
+
+#include <gtest/gtest.h>
+
+extern "C"
+{
+#include "can_log_convert.h"
+#include "hw_can_replay.h"
+}
+
+#include <cstdint>
+#include <cstdlib>
+#include <vector>
+
+/** Encode frames and hand the log back as a vector. */
+static std::vector<uint8_t> Encode( const std::vector<CAN_Log_Frame_T>& frames, uint32_t gap_us )
+{
+    uint8_t* log    = nullptr;
+    size_t   length = 0U;
+    EXPECT_EQ( CAN_Log_Encode( frames.data(), frames.size(), gap_us, &log, &length ),
+               CAN_LOG_RESULT_OK );
+    std::vector<uint8_t> bytes( log, log + length );
+    std::free( log );
+    return bytes;
+}
+
+TEST( CANLogConvertTest, CandumpParsesStandardAndExtendedFrames )
+{
+    CAN_Log_Frame_T frame;
+    ASSERT_EQ( CAN_Log_Parse_Candump( "(1436509052.249713) vcan0 44C#A6B2\n", &frame ),
+               CAN_LOG_LINE_FRAME );
+    EXPECT_EQ( frame.time_us, 1436509052249713ULL );
+    EXPECT_STREQ( frame.channel, "vcan0" );
+    EXPECT_EQ( frame.id, 0x44CU );
+    EXPECT_FALSE( frame.extended );
+    EXPECT_EQ( frame.dlc, 2U );
+    EXPECT_EQ( frame.data[0], 0xA6U );
+    EXPECT_EQ( frame.data[1], 0xB2U );
+
+    ASSERT_EQ( CAN_Log_Parse_Candump( "(0.5) can1 18DAF110#0102030405060708", &frame ),
+               CAN_LOG_LINE_FRAME );
+    EXPECT_EQ( frame.time_us, 500000U );
+    EXPECT_EQ( frame.id, 0x18DAF110U );
+    EXPECT_TRUE( frame.extended );
+    EXPECT_EQ( frame.dlc, 8U );
+    EXPECT_EQ( frame.data[7], 0x08U );
+
+    ASSERT_EQ( CAN_Log_Parse_Candump( "(1.000001) can0 123#", &frame ), CAN_LOG_LINE_FRAME );
+    EXPECT_EQ( frame.dlc, 0U );
+    EXPECT_EQ( frame.time_us, 1000001U );
+}
+
+TEST( CANLogConvertTest, CandumpSkipsUnsupportedFramesAndRejectsMalformedLines )
+{
+    CAN_Log_Frame_T frame;
+    EXPECT_EQ( CAN_Log_Parse_Candump( "\n", &frame ), CAN_LOG_LINE_SKIP );
+    EXPECT_EQ( CAN_Log_Parse_Candump( "(1.0) can0 123#R", &frame ), CAN_LOG_LINE_SKIP );
+    EXPECT_EQ( CAN_Log_Parse_Candump( "(1.0) can0 123##311223344", &frame ), CAN_LOG_LINE_SKIP );
+    EXPECT_EQ( CAN_Log_Parse_Candump( "(1.0) can0 20000004#0004000000000000", &frame ),
+               CAN_LOG_LINE_SKIP );
+
+    EXPECT_EQ( CAN_Log_Parse_Candump( "1.0 can0 123#00", &frame ), CAN_LOG_LINE_ERROR );
+    EXPECT_EQ( CAN_Log_Parse_Candump( "(1.0) can0 800#00", &frame ), CAN_LOG_LINE_ERROR );
+    EXPECT_EQ( CAN_Log_Parse_Candump( "(1.0) can0 12#00", &frame ), CAN_LOG_LINE_ERROR );
+    EXPECT_EQ( CAN_Log_Parse_Candump( "(1.0) can0 123#001", &frame ), CAN_LOG_LINE_ERROR );
+    EXPECT_EQ( CAN_Log_Parse_Candump( "(1.0) can0 123#001122334455667788", &frame ),
+               CAN_LOG_LINE_ERROR );
+    EXPECT_EQ( CAN_Log_Parse_Candump( "(1.0) can0 123#0G", &frame ), CAN_LOG_LINE_ERROR );
+    EXPECT_EQ( CAN_Log_Parse_Candump( "(1.x) can0 123#00", &frame ), CAN_LOG_LINE_ERROR );
+}
+
+TEST( CANLogConvertTest, AscParsesFramesInBothBases )
+{
+    CAN_Log_Asc_State_T state = {};
+    CAN_Log_Frame_T     frame;
+
+    EXPECT_EQ( CAN_Log_Parse_Asc( "date Tue Mar 12 10:00:00.000 am 2024", &state, &frame ),
+               CAN_LOG_LINE_SKIP );
+    EXPECT_EQ( CAN_Log_Parse_Asc( "base hex  timestamps absolute", &state, &frame ),
+               CAN_LOG_LINE_SKIP );
+    EXPECT_EQ( CAN_Log_Parse_Asc( "Begin Triggerblock Tue Mar 12", &state, &frame ),
+               CAN_LOG_LINE_SKIP );
+    EXPECT_EQ( CAN_Log_Parse_Asc( "   0.000000 Start of measurement", &state, &frame ),
+               CAN_LOG_LINE_SKIP );
+
+    ASSERT_EQ( CAN_Log_Parse_Asc( "   1.234567 1  7E0             Rx   d 3 02 10 03  Length = 0",
+                                  &state, &frame ),
+               CAN_LOG_LINE_FRAME );
+    EXPECT_EQ( frame.time_us, 1234567U );
+    EXPECT_STREQ( frame.channel, "1" );
+    EXPECT_EQ( frame.id, 0x7E0U );
+    EXPECT_FALSE( frame.extended );
+    EXPECT_EQ( frame.dlc, 3U );
+    EXPECT_EQ( frame.data[2], 0x03U );
+
+    ASSERT_EQ( CAN_Log_Parse_Asc( "   2.5 2  18DAF110x  Tx   d 1 FF", &state, &frame ),
+               CAN_LOG_LINE_FRAME );
+    EXPECT_EQ( frame.id, 0x18DAF110U );
+    EXPECT_TRUE( frame.extended );
+    EXPECT_EQ( frame.time_us, 2500000U );
+
+    EXPECT_EQ( CAN_Log_Parse_Asc( "base dec  timestamps absolute", &state, &frame ),
+               CAN_LOG_LINE_SKIP );
+    ASSERT_EQ( CAN_Log_Parse_Asc( "   3.000000 1  2016  Rx   d 2 2 255", &state, &frame ),
+               CAN_LOG_LINE_FRAME );
+    EXPECT_EQ( frame.id, 2016U );
+    EXPECT_EQ( frame.data[1], 255U );
+}
+
+TEST( CANLogConvertTest, AscSkipsEventsAndRejectsMalformedFrames )
+{
+    CAN_Log_Asc_State_T state = {};
+    CAN_Log_Frame_T     frame;
+
+    EXPECT_EQ( CAN_Log_Parse_Asc( "   1.0 1  ErrorFrame", &state, &frame ), CAN_LOG_LINE_SKIP );
+    EXPECT_EQ( CAN_Log_Parse_Asc( "   1.0 1  123  Rx   r", &state, &frame ), CAN_LOG_LINE_SKIP );
+    EXPECT_EQ( CAN_Log_Parse_Asc( "   1.0 CANFD 1 Rx 123 1 0 8 8 01 02", &state, &frame ),
+               CAN_LOG_LINE_SKIP );
+    EXPECT_EQ( CAN_Log_Parse_Asc( "   1.0 1  Statistic: D 0 R 0", &state, &frame ),
+               CAN_LOG_LINE_SKIP );
+    EXPECT_EQ( CAN_Log_Parse_Asc( "End TriggerBlock", &state, &frame ), CAN_LOG_LINE_SKIP );
+
+    EXPECT_EQ( CAN_Log_Parse_Asc( "   1.0 1  800  Rx   d 0", &state, &frame ),
+               CAN_LOG_LINE_ERROR );
+    EXPECT_EQ( CAN_Log_Parse_Asc( "   1.0 1  123  Rx   d 3 01 02", &state, &frame ),
+               CAN_LOG_LINE_ERROR );
+    EXPECT_EQ( CAN_Log_Parse_Asc( "   1.0 1  123  Rx   d 9", &state, &frame ),
+               CAN_LOG_LINE_ERROR );
+    EXPECT_EQ( CAN_Log_Parse_Asc( "   1.0 1  123  Up   d 0", &state, &frame ),
+               CAN_LOG_LINE_ERROR );
+    EXPECT_EQ( CAN_Log_Parse_Asc( "base hex  timestamps relative", &state, &frame ),
+               CAN_LOG_LINE_ERROR );
+}
+
+TEST( CANLogConvertTest, EncodedLogPlaysBackWithRecordedGaps )
+{
+    std::vector<CAN_Log_Frame_T> frames( 4U );
+    const uint64_t               times[] = { 5000000U, 5000100U, 5070100U, 21000000U };
+    const uint32_t               ids[]   = { 0x100U, 0x18DAF110U, 0x7FFU, 0x001U };
+    for ( size_t i = 0U; i < frames.size(); i++ )
+    {
+        frames[i]          = {};
+        frames[i].time_us  = times[i];
+        frames[i].id       = ids[i];
+        frames[i].extended = ids[i] > 0x7FFU;
+        frames[i].dlc      = static_cast<uint8_t>( i * 2U );
+        frames[i].data[0]  = static_cast<uint8_t>( 0xA0U + i );
+    }
+
+    std::vector<uint8_t> log = Encode( frames, 1000U );
+
+    /* Deltas 0, 100, 70000 and 15929900 take one, one, three and three bytes */
+    EXPECT_EQ( log.size(), 16U + ( 1U + 1U + 2U + 0U ) + ( 1U + 1U + 4U + 2U )
+                               + ( 1U + 3U + 2U + 4U ) + ( 1U + 3U + 2U + 6U ) );
+    uint32_t frame_count = 0U;
+    ASSERT_TRUE(
+        HW_CAN_Replay_Validate( log.data(), static_cast<uint32_t>( log.size() ), &frame_count ) );
+    EXPECT_EQ( frame_count, 4U );
+
+    HW_CAN_Replay_T replay;
+    ASSERT_TRUE( HW_CAN_Replay_Load( &replay, log.data(), static_cast<uint32_t>( log.size() ),
+                                     HW_CAN_REPLAY_TIME_SCALE_UNITY, 2U, 0U ) );
+    EXPECT_EQ( replay.pass_us, 16001000U );
+    for ( size_t pass = 0U; pass < 2U; pass++ )
+    {
+        for ( size_t i = 0U; i < frames.size(); i++ )
+        {
+            const HW_CAN_Replay_Frame_T* frame = HW_CAN_Replay_Take( &replay );
+            ASSERT_NE( frame, nullptr );
+            EXPECT_EQ( frame->due_us, pass * 16001000U + ( times[i] - times[0] ) );
+            EXPECT_EQ( frame->id, ids[i] );
+            EXPECT_EQ( frame->extended, frames[i].extended );
+            EXPECT_EQ( frame->dlc, frames[i].dlc );
+            if ( frame->dlc > 0U )
+            {
+                EXPECT_EQ( frame->data[0], frames[i].data[0] );
+            }
+            HW_CAN_Replay_Complete( &replay, frame->due_us, true );
+        }
+    }
+    EXPECT_TRUE( HW_CAN_Replay_Finished( &replay ) );
+}
+
+TEST( CANLogConvertTest, EncodeRejectsEmptyUnorderedAndOverlongTraces )
+{
+    uint8_t*                     log    = nullptr;
+    size_t                       length = 0U;
+    std::vector<CAN_Log_Frame_T> frames( 2U );
+    frames[0]         = {};
+    frames[1]         = {};
+    frames[0].time_us = 2000U;
+    frames[1].time_us = 1000U;
+
+    EXPECT_EQ( CAN_Log_Encode( frames.data(), 0U, 0U, &log, &length ), CAN_LOG_RESULT_EMPTY );
+    EXPECT_EQ( CAN_Log_Encode( frames.data(), 2U, 0U, &log, &length ),
+               CAN_LOG_RESULT_OUT_OF_ORDER );
+
+    frames[1].time_us = 2000U + static_cast<uint64_t>( UINT32_MAX );
+    EXPECT_EQ( CAN_Log_Encode( frames.data(), 2U, 0U, &log, &length ), CAN_LOG_RESULT_OK );
+    std::free( log );
+    EXPECT_EQ( CAN_Log_Encode( frames.data(), 2U, 1U, &log, &length ),
+               CAN_LOG_RESULT_GAP_TOO_LONG );
+}